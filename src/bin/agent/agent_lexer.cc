@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 58
-#define YY_END_OF_BUFFER 59
+#define YY_NUM_RULES 62
+#define YY_END_OF_BUFFER 63
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,43 +700,48 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[320] =
+static const flex_int16_t yy_accept[368] =
     {   0,
-       51,   51,    0,    0,    0,    0,    0,    0,    0,    0,
-       59,   57,   10,   11,   57,    1,   51,   48,   51,   51,
-       57,   50,   49,   57,   57,   57,   57,   57,   44,   45,
-       57,   57,   57,   46,   47,    5,    5,    5,   57,   57,
-       57,   10,   11,    0,    0,   40,    0,    0,    0,    0,
+       55,   55,    0,    0,    0,    0,    0,    0,    0,    0,
+       63,    1,   61,   61,   61,   10,   11,   48,   49,   50,
+       51,   52,   53,   55,   54,   55,   55,   61,   61,   61,
+       61,   61,   61,   61,   61,    5,    5,    5,   61,   61,
+       61,    1,    3,    2,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    1,   51,   51,    0,   50,   51,    3,    2,    6,
-        0,   51,    0,    0,    0,    0,    0,    0,    4,    0,
-        0,    9,    0,   41,    0,    0,    0,    0,    0,   43,
+        0,    0,    0,    0,   44,    6,   10,   11,   54,   55,
+        0,   55,   55,    0,   55,    0,    0,    0,    0,    0,
+        0,    4,    0,    0,    9,    2,    0,    0,   45,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    2,    0,
-        0,    0,    0,    0,    0,    0,    8,    0,    0,    0,
-        0,    0,   42,    0,    0,    0,   20,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   56,   54,    0,   53,   52,    0,    0,
+        0,    0,    0,    0,    0,   47,    0,    0,    0,    0,
+        0,    0,    0,    0,    8,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   20,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   46,   58,   56,    0,    0,
+       60,   57,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   55,   52,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,    0,    0,   23,
-
-        0,    0,    0,    0,   37,   38,    0,    0,    0,    0,
-        0,   18,   19,   32,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    7,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   34,
-       31,    0,    0,    0,    0,    0,    0,    0,   27,   16,
-        0,    0,    0,    0,    0,   25,   28,   33,    0,    0,
-        0,    0,    0,    0,    0,   39,    0,    0,    0,    0,
-        0,    0,    0,   36,    0,    0,    0,    0,    0,    0,
-        0,   13,   14,    0,    0,    0,    0,    0,    0,    0,
-       35,    0,    0,   26,    0,    0,    0,    0,    0,    0,
-
-        0,   21,   22,    0,    0,    0,    0,    0,   15,   12,
-        0,    0,    0,    0,    0,   30,   17,   24,    0
+       56,   59,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   29,    0,    0,    0,    0,    0,
+        0,   23,    0,    0,    0,    0,    0,    0,    0,   35,
+        0,   41,   42,    0,    0,    0,    0,    0,   18,   19,
+       32,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    7,    0,   34,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   31,    0,    0,    0,    0,    0,   33,    0,    0,
+        0,    0,    0,   27,   16,    0,    0,    0,    0,    0,
+       28,   25,    0,    0,    0,    0,    0,    0,    0,    0,
+
+       40,    0,   43,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       13,   14,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   38,    0,    0,    0,   26,   36,   39,    0,
+       21,   22,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   15,   12,    0,    0,    0,    0,    0,
+        0,   30,    0,   17,   24,   37,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -753,8 +758,8 @@ static const YY_CHAR yy_ec[256] =
        34,   35,   36,    5,   37,    5,   38,   39,   40,   41,
 
        42,   43,   44,   45,   46,    5,   47,   48,   49,   50,
-       51,   52,    5,   53,   54,   55,   56,   57,    5,   58,
-       59,   60,   61,    5,   62,    5,    5,    5,    5,    5,
+       51,   52,   53,   54,   55,   56,   57,   58,   59,   60,
+       61,   62,   63,    5,   64,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -771,581 +776,383 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[63] =
+static const YY_CHAR yy_meta[65] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    3,    3,    3,
-        3,    5,    5,    5,    5,    5,    5,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    5,    5,    5,
-        5,    5,    5,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[332] =
+static const flex_int16_t yy_base[368] =
     {   0,
-        0,    0,   61,   64,   67,    0,   65,   69,   49,   66,
-      277, 2102,   86,  269,  129,    0,  124, 2102,  172,  129,
-       84,  178, 2102,  250,   91,   76,   71,   89, 2102, 2102,
-       96,   91,   95, 2102, 2102, 2102,   87,  250,  196,    0,
-      222,  119,  236,  114,  199, 2102,  205,  215,  222,  209,
-      235,  252,  273,  279,  287,  297,  304,  310,  317,  323,
-      345,    0,  345,  367,  361,  374,  387, 2102,    0, 2102,
-      144,  215,  128,  134,  119,  171,  185,  135, 2102,  172,
-      204, 2102,  161, 2102,  392,  405,  416,  422,  203,  435,
-      457,  457,  484,  502,  508,  514,  520,  526,  533,  544,
-
-      550,  556,  563,  572,  581,  591,  598,  608,    0,  172,
-      199,  209,  212,  221,  219,  149, 2102,    0,  618,  626,
-      633,  167, 2102,  665,  661,  639, 2102,  696,  710,  716,
-      722,  731,  737,  747,  753,  762,  773,  783,  792,  800,
-      810,  827,  242, 2102, 2102,  275, 2102, 2102,  109,    0,
-      835,  847,  854,  887,  873,  884,  915,  930,  937,  950,
-      960,  967,  973,  985,  991,  997, 1008, 1016, 1022, 1034,
-     1043, 1052, 2102, 2102,  122,    0, 1065, 1071, 1078, 1087,
-     1095, 1132, 1101, 1109, 1117, 1131, 1161, 1175, 1181, 1187,
-     1196, 1202, 1211, 1217, 2102, 1223, 1232, 1241, 1258, 2102,
-
-     1279,  109,    0, 1288, 2102, 2102, 1294, 1302, 1314, 1324,
-     1332, 2102, 2102, 2102, 1349, 1355, 1374, 1380, 1386, 1392,
-     1398, 1410, 1416, 1429, 1435, 1447, 2102, 1454, 1460, 1466,
-     1472, 1485, 1491, 1503, 1509, 1515, 1521, 1527, 1534, 2102,
-     2102, 1540, 1551, 1564, 1570, 1576, 1586, 1594, 2102, 2102,
-     1600, 1606, 1612, 1630, 1636, 2102, 2102, 2102, 1643, 1654,
-     1661, 1667, 1673, 1680, 1698, 2102, 1708, 1691, 1715, 1721,
-     1728, 1735, 1743, 2102, 1751, 1759, 1770, 1778, 1786, 1800,
-     1813, 2102, 2102, 1821, 1827, 1835, 1841, 1851, 1857, 1863,
-     2102, 1878, 1887, 2102, 1893, 1899, 1913, 1923, 1934, 1940,
-
-     1948, 2102, 2102, 1954, 1960, 1971, 1978, 1990, 2102, 2102,
-     1998, 2006, 2013, 2021, 2028, 2102, 2102, 2102, 2102, 2063,
-     2068, 2073, 2078, 2083, 2088, 2093, 2096,  132,  128,  121,
-      111
+       65,    0,  129,    0,  188,    0,  190,    0,  187,    0,
+      209,  252,  203,  316,  189,  217,  209,    0,    0,    0,
+        0,    0,    0,  369,    0,  211,  225,  382,  193,  191,
+      349,  164,  194,  178,    0,    0,  230,    0,  195,  408,
+      226,    0,    0,  472,  536,  577,  350,  349,  210,  198,
+      205,  204,  338,  591,  342,  349,  356,  356,  546,  365,
+      351,  376,  557,  636,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  599,    0,  578,  418,  673,  561,  674,
+      565,    0,  574,  610,    0,    0,    0,  697,    0,  559,
+      581,  565,  563,  654,  665,  662,  658,  703,  672,  672,
+
+      656,  663,  659,  672,  678,  669,  663,  678,  669,  682,
+      669,  684,  681,  754,    0,    0,  815,  702,  687,  849,
+      675,  853,  683,  685,    0,    0,  868,  679,  688,  696,
+      689,  685,  690,  699,  696,  690,    0,  691,  697,  695,
+      705,  834,  843,  834,  847,  844,  843,  860,  842,  858,
+      848,  843,  898,    0,    0,    0,    0,    0,  890,  863,
+        0,    0,  860,  928,  876,  873,  884,  873,  888,  875,
+      931,  884,  889,  879,  890,  941,  890,  891,  938,  917,
+      922,  955,  905,  920,  915,  923,  961,  962,  968,  961,
+        0,    0,  938,  991,  926,  919,  926,  943,  984,  940,
+
+      986,  987,  953,  945,  946,  946,  950, 1003, 1004, 1005,
+     1001,  974,  966,  967,    0,  966,  975,  982, 1014,  979,
+      988,    0, 1021,  997, 1051, 1034,  999, 1031,  993,    0,
+     1002,    0,    0, 1001, 1008,  997, 1006, 1013,    0,    0,
+        0, 1008, 1006, 1007, 1014, 1009, 1065, 1021, 1023, 1025,
+     1035, 1031,    0,    0,    0,    0, 1077, 1045, 1023, 1074,
+     1031, 1081, 1082, 1085, 1039, 1052, 1044, 1046, 1097, 1098,
+     1054,    0, 1047, 1065, 1062, 1060, 1060,    0, 1073, 1051,
+     1107, 1076, 1109,    0,    0, 1061, 1075, 1079, 1063, 1064,
+        0,    0, 1069, 1111, 1069, 1062, 1079, 1070, 1078, 1076,
+
+        0, 1085,    0, 1079, 1083, 1078, 1127, 1128, 1079, 1084,
+     1082, 1096, 1083, 1098, 1099, 1100, 1101, 1104, 1139, 1108,
+        0,    0, 1101, 1097, 1143, 1144, 1145, 1092, 1147, 1148,
+     1105, 1109,    0, 1103, 1107, 1111,    0,    0,    0, 1104,
+        0,    0, 1105, 1120, 1117, 1114, 1119, 1160, 1161, 1112,
+     1127, 1115, 1131,    0,    0, 1117, 1118, 1168, 1114, 1170,
+     1171,    0, 1172,    0,    0,    0,    1
     } ;
 
-static const flex_int16_t yy_def[332] =
+static const flex_int16_t yy_def[368] =
     {   0,
-      319,    1,  320,  320,    1,    5,    5,    5,    5,    5,
-      319,  319,  319,  319,  321,  322,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  323,
-      319,  319,  319,  324,  321,  319,  321,  321,  321,  325,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  322,  319,  319,  319,  319,  319,  319,  326,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      323,  319,  324,  319,  319,  321,  321,  321,  327,  321,
-      325,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-
-      321,  321,  321,  321,  321,  321,  321,  321,  326,  319,
-      319,  319,  319,  319,  319,  319,  319,  328,  321,  321,
-      321,  327,  319,  325,  321,  321,  319,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  321,  319,  319,  319,  319,  319,  319,  319,  329,
-      321,  321,  321,  325,  321,  321,  321,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  321,  319,  319,  319,  330,  321,  321,  321,  321,
-      321,  325,  321,  321,  321,  321,  321,  321,  321,  321,
-      321,  321,  321,  321,  319,  321,  321,  321,  321,  319,
-
-      321,  319,  331,  321,  319,  319,  321,  321,  321,  321,
-      321,  319,  319,  319,  321,  321,  321,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  319,  321,  321,  321,
-      321,  321,  321,  321,  321,  321,  321,  321,  321,  319,
-      319,  321,  321,  321,  321,  321,  321,  321,  319,  319,
-      321,  321,  321,  321,  321,  319,  319,  319,  321,  321,
-      321,  321,  321,  321,  321,  319,  321,  321,  321,  321,
-      321,  321,  321,  319,  321,  321,  321,  321,  321,  321,
-      321,  319,  319,  321,  321,  321,  321,  321,  321,  321,
-      319,  321,  321,  319,  321,  321,  321,  321,  321,  321,
-
-      321,  319,  319,  321,  321,  321,  321,  321,  319,  319,
-      321,  321,  321,  321,  321,  319,  319,  319,    0,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319
+      367,    1,  367,    3,    1,    5,    5,    7,    5,    9,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,   24,   24,   24,  367,  367,  367,
+      367,   29,   30,   31,  367,   16,  367,  367,  367,  367,
+      367,   12,  367,  367,  367,   14,   46,   46,   46,   49,
+       49,   49,   49,   49,   49,   49,   49,   46,   49,   46,
+       49,   46,   48,  367,  367,  367,   16,   17,   24,   27,
+       28,   26,   27,   28,   74,  367,   76,  367,   78,  367,
+       80,  367,  367,   40,  367,   44,   45,  367,  367,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,  367,   49,   49,  367,  367,  118,  367,
+      120,  367,  122,  367,  367,   45,  367,   48,   49,   49,
+       49,   49,   49,   49,   49,   49,  367,   49,   49,   48,
+       49,   49,   49,   49,   49,   49,   49,   46,   49,   49,
+       49,   49,  114,  117,  117,  367,  367,  367,  367,  159,
+      367,  367,  367,  367,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   48,   49,   49,
+       46,   49,   49,   49,   49,   49,   49,   49,   49,  114,
+      367,  367,  367,  367,   49,   49,   49,   49,   49,   49,
+
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,  367,   49,   49,   49,   49,   49,
+       49,  367,  114,  367,  367,   49,   49,   49,   49,  367,
+       49,  367,  367,   49,   49,   49,   49,   49,  367,  367,
+      367,   49,   49,   49,   48,   49,   49,   49,   49,   48,
+       49,   49,   49,  367,   45,  367,   49,   49,   49,   49,
+       48,   49,   49,   49,   49,   49,   48,   49,   49,   49,
+       49,  367,   49,   49,   49,   49,   49,  367,   46,   49,
+       49,   46,   49,  367,  367,   48,   49,   49,   49,   49,
+      367,  367,   49,   49,   49,   49,   49,   49,   49,   49,
+
+      367,   49,  367,   49,   49,   49,   49,   49,   49,   49,
+       48,   49,   49,   49,   49,   49,   49,   49,   49,   46,
+      367,  367,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,  367,   49,   49,   49,  367,  367,  367,   49,
+      367,  367,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   48,   49,  367,  367,   48,   48,   49,   49,   49,
+       49,  367,   49,  367,  367,  367,    0
     } ;
 
-static const flex_int16_t yy_nxt[2165] =
+static const flex_int16_t yy_nxt[1237] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   23,   24,   12,
-       12,   12,   12,   12,   12,   25,   26,   12,   27,   12,
-       12,   28,   12,   29,   12,   30,   12,   12,   12,   12,
-       12,   25,   31,   12,   12,   12,   12,   12,   12,   32,
-       12,   12,   12,   12,   33,   12,   12,   12,   12,   12,
-       34,   35,   37,   14,   37,   37,   14,   37,   38,   41,
-       40,   38,   12,   12,   40,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   12,   12,   41,   42,   42,   42,
-       42,   68,   12,   12,   12,   12,   69,   73,   12,   71,
-
-       12,   71,   12,   74,   72,   72,   72,   72,   12,   12,
-       12,   12,   39,   73,   12,   83,   12,   73,   75,   84,
-       42,   12,   42,   74,   75,  203,   74,   12,   12,   44,
-       44,   44,  176,   76,   46,   63,  150,   64,   64,   64,
-       64,   75,   67,   67,   67,   67,   77,   78,   85,   65,
-      227,  112,   47,   48,   65,  110,   49,   72,   72,   72,
-       72,  111,  202,   50,  175,   65,   84,  112,   51,   52,
-       65,   53,  123,   54,  112,  110,   55,   56,   57,   58,
-       59,  111,   60,   63,   61,   66,   66,   66,   66,   63,
-      115,   66,   66,   66,   66,   85,  149,   65,  110,   44,
-
-       44,   44,  143,   65,   46,   44,   44,   44,  123,  117,
-       46,  116,  111,   65,   90,   44,   44,   44,  113,   65,
-       46,   45,   44,   44,   44,  143,  144,   46,   72,   72,
-       72,   72,  114,   50,  145,   44,   44,   44,   43,   50,
-       46,   82,  143,   45,  145,   80,  144,   45,  144,   50,
-      145,   45,   44,   44,   44,   86,   50,   46,   45,   87,
-      148,   45,   79,   45,   91,  146,   93,  173,  147,   50,
-       70,   43,   88,   44,   44,   44,  319,  319,   46,   44,
-       44,   44,  319,  173,   46,   92,   50,   44,   44,   44,
-      319,  319,   46,   94,  319,  319,   95,   44,   44,   44,
-
-      173,  319,   46,  319,   44,   44,   44,   50,  319,   46,
-       44,   44,   44,   50,  319,   46,  174,   44,   44,   44,
-       96,   50,   46,   44,   44,   44,  319,  319,   46,   97,
-      319,   50,   99,   98,  101,  319,  319,  100,   50,  319,
-      319,  102,  319,  319,   50,   44,   44,   44,  319,  319,
-       46,   50,  319,  319,  104,  319,  319,   50,   67,   67,
-       67,   67,  319,  319,  105,  103,  319,  319,  319,   71,
-       65,   71,  319,  106,   72,   72,   72,   72,   63,   50,
-       64,   64,   64,   64,  319,   63,   65,   66,   66,   66,
-       66,  319,   65,  319,  107,  319,  319,   83,  108,   65,
-
-       67,   67,   67,   67,   83,   44,   44,   44,   65,  319,
-       46,  319,   65,  319,  319,   65,   44,   44,   44,  319,
-      319,   46,   44,   44,   44,  319,   83,   46,   65,  319,
-       83,  319,  319,  319,   83,   44,   44,   44,  319,   50,
-       46,   83,  319,  319,   83,  319,   83,  118,  319,  319,
-       50,  319,  319,  319,  119,  120,   50,   44,   44,   44,
-      319,  319,   46,  319,  319,  121,  319,  319,  319,   50,
-      124,  124,  124,  124,  319,  319,  319,  319,  124,  124,
-      124,  124,  124,  124,   44,   44,   44,  319,  319,  127,
-      319,   50,  319,  319,  124,  124,  124,  124,  124,  124,
-
-      319,  319,   44,   44,   44,  125,  126,   46,   44,   44,
-       44,  319,  319,   46,   44,   44,   44,  319,   50,   46,
-       44,   44,   44,  319,  319,   46,   44,   44,   44,  319,
-      319,   46,  319,   44,   44,   44,   50,  319,   46,  319,
-      128,  319,   50,  319,   44,   44,   44,  129,   50,   46,
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-       50,   46,  319,   44,   44,   44,  319,   50,   46,  130,
-      131,  133,   44,   44,   44,  319,  319,   46,   50,  319,
-      132,   44,   44,   44,   50,  319,   46,  134,  319,  319,
-       50,   44,   44,   44,  319,  319,   46,   50,   44,   44,
-
-       44,  319,  319,   46,  136,  319,   50,  135,   44,   44,
-       44,  319,  319,   46,  319,   50,  319,  137,   44,   44,
-       44,  319,  319,   46,  138,   50,   44,   44,   44,  319,
-      140,   46,   50,   44,   44,   44,  319,  139,   46,   44,
-       44,   44,   50,  141,   46,  319,  319,  319,  319,  142,
-      319,  319,   50,  319,  319,  319,  319,  319,  319,  319,
-       50,   44,   44,   44,  319,  319,   46,   50,  319,  319,
-      319,  319,  151,   50,  319,  319,  153,  152,  154,  154,
-      154,  154,  319,  319,  319,  319,  154,  154,  154,  154,
-      154,  154,  319,  156,  319,   50,   44,   44,   44,  319,
-
-      319,   46,  154,  154,  154,  154,  154,  154,  319,  155,
-       44,   44,   44,  319,  319,   46,   44,   44,   44,  319,
-      319,   46,   44,   44,   44,  319,  319,   46,  319,  319,
-       50,   44,   44,   44,  319,  319,   46,   44,   44,   44,
-      319,  319,   46,  319,   50,  319,  319,   44,   44,   44,
-       50,  157,   46,   44,   44,   44,   50,  319,   46,  319,
-      319,  158,   44,   44,   44,   50,  319,   46,  160,  159,
-      319,   50,  319,   44,   44,   44,  319,  319,   46,  319,
-      319,   50,  161,   44,   44,   44,  319,   50,   46,  162,
-      163,  319,   44,   44,   44,  319,   50,   46,  319,  319,
-
-       44,   44,   44,  166,  319,   46,  164,   50,  319,  165,
-       44,   44,   44,  319,  319,   46,  319,   50,  319,  319,
-      168,  319,  319,  319,  167,  319,   50,   44,   44,   44,
-      319,  319,   46,  169,   50,   44,   44,   44,  319,  319,
-       46,  319,  319,  319,   50,  319,  170,   44,   44,   44,
-      319,  319,   46,  319,   44,   44,   44,  319,  319,   46,
-      319,   50,  178,  179,  319,  319,  319,  171,  319,   50,
-      319,  180,  319,   44,   44,   44,  319,  319,   46,  172,
-      319,   50,  319,  319,   44,   44,   44,  177,   50,   46,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  181,
-
-      182,  182,  182,  182,  319,  319,  319,   50,  182,  182,
-      182,  182,  182,  182,  183,   44,   44,   44,   50,  319,
-       46,  319,  319,  319,  182,  182,  182,  182,  182,  182,
-       44,   44,   44,  319,  319,   46,  184,   44,   44,   44,
-      319,  319,   46,  319,  319,  186,  187,  319,  319,   50,
-       44,   44,   44,  319,  319,   46,  319,  319,  185,  319,
-       44,   44,   44,  319,   50,   46,  319,   44,   44,   44,
-      190,   50,   46,   44,   44,   44,  319,  319,   46,  319,
-      319,  188,  319,  319,   50,   44,   44,   44,  319,  319,
-       46,   44,   44,   44,   50,  319,   46,   44,   44,   44,
-
-      319,   50,  195,  189,  191,  319,  319,   50,   44,   44,
-       44,  319,  319,   46,  192,  319,   44,   44,   44,   50,
-      319,   46,   44,   44,   44,   50,  319,   46,  319,  319,
-      193,   50,  194,  319,   44,   44,   44,  319,  319,   46,
-      319,  319,   50,   44,   44,   44,  319,  319,  200,  319,
-       50,  319,   44,   44,   44,  319,   50,   46,  319,  319,
-      319,  319,  201,  196,  197,   44,   44,   44,   50,  319,
-       46,   44,   44,   44,  198,  199,  205,   50,   44,   44,
-       44,  319,  319,  206,  319,  319,   50,   44,   44,   44,
-      319,  319,   46,  319,  319,   44,   44,   44,  319,   50,
-
-       46,   44,   44,   44,  319,   50,   46,  319,  319,   44,
-       44,   44,   50,  319,   46,  204,  319,   44,   44,   44,
-      319,   50,   46,  319,  319,  319,  319,  207,  319,   50,
-      319,   44,   44,   44,  319,   50,  212,  319,  319,  319,
-      319,  319,  319,   50,  208,   45,   45,   45,   45,  319,
-      209,   50,  319,   45,   45,   45,   45,   45,   45,  210,
-      319,   44,   44,   44,  211,   50,  213,  319,  319,   45,
-       45,   45,   45,   45,   45,   44,   44,   44,  319,  319,
-      214,   44,   44,   44,  319,  319,   46,   44,   44,   44,
-      319,  215,   46,  319,  319,   50,   44,   44,   44,  319,
-
-      319,   46,   44,   44,   44,  319,  319,   46,  319,   50,
-      319,   44,   44,   44,  319,   50,   46,   44,   44,   44,
-      319,   50,   46,   44,   44,   44,  319,  319,   46,  319,
-       50,  216,   44,   44,   44,  319,   50,   46,  217,  319,
-      319,   44,   44,   44,  319,   50,   46,  319,  218,  319,
-      319,   50,  319,  319,  219,  319,  319,   50,   44,   44,
-       44,  319,  319,   46,  319,  319,   50,  319,  319,  221,
-      220,  319,  319,  223,  319,   50,  319,  222,  319,   44,
-       44,   44,  319,  319,   46,  319,  224,  319,   44,   44,
-       44,  319,   50,   46,   44,   44,   44,  319,  319,   46,
-
-      319,  319,   44,   44,   44,  319,  319,   46,  319,  319,
-      319,  319,  225,   50,   44,   44,   44,  319,  226,   46,
-      319,  319,   50,  319,   44,   44,   44,  319,   50,   46,
-      319,  319,   44,   44,   44,  228,   50,   46,  319,  319,
-      319,  319,  319,  229,  319,  230,  319,  319,   50,   44,
-       44,   44,  319,  319,   46,   44,   44,   44,   50,  319,
-       46,  319,  319,  319,  319,  319,   50,  319,  231,  319,
-      319,  232,  319,  233,   44,   44,   44,  319,  319,   46,
-       44,   44,   44,   50,  319,   46,   44,   44,   44,   50,
-      319,   46,   44,   44,   44,  319,  234,   46,   44,   44,
-
-       44,  319,  319,  240,  319,  235,  319,  319,   50,  319,
-       44,   44,   44,  319,   50,  241,   44,   44,   44,  319,
-       50,   46,  319,  319,  236,  319,   50,  319,  319,   44,
-       44,   44,   50,  239,   46,   44,   44,   44,  237,  238,
-       46,  319,  319,  319,   50,  245,  242,   44,   44,   44,
-       50,  319,   46,  319,   44,   44,   44,  319,  319,   46,
-       44,   44,   44,   50,  247,   46,   44,   44,   44,   50,
-      243,  249,   44,   44,   44,  319,  319,  250,  319,  319,
-      319,   50,  319,  244,  319,   44,   44,   44,   50,  319,
-       46,   44,   44,   44,   50,  251,   46,  246,  319,  319,
-
-       50,  319,  319,   44,   44,   44,   50,  319,   46,   44,
-       44,   44,  319,  248,   46,   44,   44,   44,  319,   50,
-       46,   44,   44,   44,  319,   50,  256,   44,   44,   44,
-      319,  319,  257,  319,   44,   44,   44,   50,  319,  258,
-       44,   44,   44,   50,  319,   46,  319,  252,  253,   50,
-      319,   44,   44,   44,  319,   50,   46,  319,  319,  319,
-      319,   50,  254,  319,   44,   44,   44,  255,   50,   46,
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-      319,   46,  319,  319,  319,   50,   44,   44,   44,  319,
-      259,   46,  260,  319,   44,   44,   44,  319,   50,  266,
-
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-       50,   46,   44,   44,   44,  319,  319,   46,  319,  262,
-       50,  319,  261,  265,  263,  264,  319,  319,   50,  319,
-       44,   44,   44,  319,   50,   46,   44,   44,   44,  319,
-       50,   46,  319,   44,   44,   44,   50,  268,   46,  319,
-      269,  319,  319,  267,   44,   44,   44,  319,  319,   46,
-      319,   44,   44,   44,   50,  319,  274,   44,   44,   44,
-       50,  319,   46,   44,   44,   44,  319,   50,   46,  319,
-       44,   44,   44,  319,  270,   46,  319,  319,   50,  319,
-      271,   44,   44,   44,  272,   50,   46,  319,   44,   44,
-
-       44,   50,  319,   46,  275,  319,  273,   50,   44,   44,
-       44,  319,  319,   46,   50,   44,   44,   44,  319,  319,
-       46,   44,   44,   44,  319,   50,  282,  319,   44,   44,
-       44,  276,   50,  283,  277,   44,   44,   44,  280,  319,
-       46,  278,   50,   44,   44,   44,  319,  319,   46,   50,
-      319,   44,   44,   44,  319,   50,   46,  319,  279,   44,
-       44,   44,   50,  319,   46,  319,  319,  281,  319,   50,
-       44,   44,   44,  319,  319,   46,  319,   50,   44,   44,
-       44,  319,  319,   46,  319,   50,   44,   44,   44,  284,
-      319,   46,  319,   50,  319,  319,  285,  319,  319,  286,
-
-       44,   44,   44,  319,   50,  291,  319,  319,  319,  319,
-      287,  288,   50,   44,   44,   44,  319,  319,   46,  289,
-       50,   44,   44,   44,  319,  290,   46,   44,   44,   44,
-      319,  319,  294,  319,   50,   44,   44,   44,  319,  319,
-       46,   44,   44,   44,  319,  319,   46,   50,  319,  319,
-      292,   44,   44,   44,  319,   50,   46,   44,   44,   44,
-      319,   50,   46,   44,   44,   44,  293,  319,   46,   50,
-      319,  319,  319,  319,  319,   50,  295,  319,   44,   44,
-       44,  319,  296,   46,  319,   50,  319,   44,   44,   44,
-      319,   50,   46,   44,   44,   44,  319,   50,  302,   44,
-
-       44,   44,  319,  319,  303,  319,  298,  319,  297,  299,
-      319,  319,   50,   44,   44,   44,  319,  319,   46,  319,
-      319,   50,  319,   44,   44,   44,  319,   50,   46,  319,
-      300,  319,  319,   50,   44,   44,   44,  301,  319,   46,
-       44,   44,   44,  319,  319,   46,  319,   50,   44,   44,
-       44,  319,  319,   46,   44,   44,   44,   50,  319,  309,
-       44,   44,   44,  319,  319,  310,  319,  304,   50,  319,
-      319,   44,   44,   44,   50,  306,   46,  305,   44,   44,
-       44,  319,   50,   46,  319,  307,  319,  319,   50,  319,
-       44,   44,   44,  319,   50,   46,  319,  308,   44,   44,
-
-       44,  319,  319,   46,  319,   50,   44,   44,   44,  319,
-      319,   46,   50,   44,   44,   44,  319,  319,  316,  312,
-      319,   44,   44,   44,   50,  311,  317,  319,   44,   44,
-       44,  319,   50,  318,  319,  319,  319,  319,  319,  319,
-       50,  319,  319,  313,  319,  319,  319,   50,  319,  319,
-      319,  314,  319,  319,  319,   50,  319,  319,  319,  315,
-      319,  319,   50,   36,   36,   36,   36,   36,   45,   45,
-       45,   45,   45,   62,  319,   62,   62,   62,   81,  319,
-       81,  319,   81,   83,   83,   83,   83,   83,   89,   89,
-       89,   89,   89,  109,  319,  109,  109,  109,  122,  122,
-
-      122,   11,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319
+       11,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,   35,   16,   17,   16,   35,
+       14,   12,   35,   26,   22,   24,   27,   13,   25,   25,
+       25,   25,   23,   15,   35,   35,   35,   35,   35,   35,
+       28,   33,   35,   34,   35,   35,   32,   35,   18,   35,
+
+       19,   35,   35,   35,   35,   35,   28,   30,   35,   35,
+       35,   35,   35,   35,   31,   35,   35,   35,   35,   35,
+       29,   35,   35,   35,   35,   35,   35,   20,   21,   38,
+       36,   17,   36,   38,   38,   38,   37,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   38,   38,   38,   38,   38,   38,   38,
+       38,   38,   38,   35,   35,   40,   35,   35,   35,   35,
+
+       35,   35,   35,   35,   35,   35,   35,   41,  367,   66,
+       43,   68,   79,   35,   35,   44,   35,   77,   67,   35,
+       67,   35,   77,   35,   72,   72,   72,   72,   78,   35,
+       35,   79,   35,   39,   80,   35,  367,   35,   73,   73,
+       73,   73,   82,   35,   83,   85,   76,   49,   94,   95,
+       35,   35,   42,   42,   96,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   45,   45,   45,   49,
+       49,   65,   49,   49,   49,   49,   49,   49,   49,   49,
+       49,   49,   49,   49,   49,   49,   49,   49,   49,   50,
+       51,   49,   49,   52,   49,   49,   49,   49,   49,   49,
+       64,   49,   49,   48,   49,   53,   54,   49,   55,   49,
+       56,   49,   49,   57,   46,   58,   59,   60,   61,   62,
+       47,   49,   63,   49,   49,   49,   49,   49,   49,   49,
+       70,   80,   69,   69,   69,   69,   49,   49,   97,  101,
+       74,   92,   74,  106,   71,   75,   75,   75,   75,  102,
+
+       91,  105,  109,   93,  103,   81,  104,  110,   84,   84,
+       71,   84,   84,  111,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   84,   84,   84,   84,   84,   84,   84,   84,
+       84,   84,   86,   86,  118,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   86,   86,   86,   86,
+       86,   86,   86,   86,   86,   86,   87,   87,   87,   87,
+       87,   89,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       88,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+       87,   87,   87,   87,   87,   87,   87,   87,   87,   87,
+
+       49,   49,  107,  108,   49,   98,  113,  367,  121,  367,
+      118,  112,  123,  124,   90,  125,   49,   49,  128,   49,
+      129,   49,  130,  131,   49,   49,   49,   49,   49,   49,
+       49,   49,   99,   49,  119,  100,  117,  117,  117,  117,
+      117,  116,  117,  117,  117,  117,  117,  117,  115,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+      115,  117,  117,  117,  115,  117,  117,  117,  115,  117,
+      117,  117,  117,  117,  117,  115,  117,  117,  117,  115,
+      117,  115,  114,  117,  117,  117,  117,  117,  117,  117,
+
+      121,  122,  126,  132,  133,  134,  135,  136,  137,  126,
+      138,  139,  140,  141,  142,  143,  144,  145,  146,  147,
+      120,  122,  148,  149,  150,  151,  152,  157,  158,  160,
+      162,  126,  163,  166,  167,  126,  165,  168,  169,  126,
+      170,  171,  172,  157,  173,  174,  126,  175,  176,  177,
+      126,  178,  126,  127,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  153,  153,  153,
+      153,  154,  154,  154,  154,  153,  153,  153,  153,  153,
+      153,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  153,  153,  153,  153,  153,  153,  154,  154,  154,
+
+      154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+      154,  154,  154,  154,  154,  154,  154,  154,  155,  155,
+      156,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      155,  155,  155,  155,  155,  155,  155,  155,  155,  160,
+      161,  164,  164,  164,  164,  179,  180,  181,  182,  164,
+      164,  164,  164,  164,  164,  183,  184,  185,  186,  187,
+
+      161,  188,  189,  159,  192,  164,  164,  164,  164,  164,
+      164,  190,  190,  190,  190,  192,  193,  195,  196,  190,
+      190,  190,  190,  190,  190,  197,  198,  199,  200,  204,
+      205,  191,  206,  207,  210,  190,  190,  190,  190,  190,
+      190,  194,  194,  194,  194,  211,  201,  202,  212,  194,
+      194,  194,  194,  194,  194,  203,  208,  209,  213,  214,
+      215,  216,  217,  218,  219,  194,  194,  194,  194,  194,
+      194,  220,  221,  222,  223,  223,  223,  223,  224,  226,
+      227,  228,  223,  223,  223,  223,  223,  223,  229,  230,
+      231,  232,  233,  234,  235,  236,  237,  238,  223,  223,
+
+      223,  223,  223,  223,  225,  225,  225,  225,  239,  240,
+      241,  242,  225,  225,  225,  225,  225,  225,  243,  245,
+      246,  247,  248,  249,  250,  244,  251,  252,  225,  225,
+      225,  225,  225,  225,  253,  253,  253,  253,  254,  256,
+      257,  258,  253,  253,  253,  253,  253,  253,  259,  260,
+      261,  262,  263,  264,  265,  266,  267,  268,  253,  253,
+      253,  253,  253,  253,  255,  255,  255,  255,  269,  270,
+      272,  273,  255,  255,  255,  255,  255,  255,  274,  275,
+      276,  277,  278,  281,  282,  283,  284,  285,  255,  255,
+      255,  255,  255,  255,  279,  286,  287,  288,  289,  290,
+
+      280,  271,  291,  292,  293,  294,  295,  296,  297,  298,
+      299,  300,  301,  302,  303,  304,  305,  306,  307,  308,
+      309,  310,  311,  312,  313,  314,  315,  316,  317,  318,
+      319,  320,  321,  322,  323,  324,  325,  326,  327,  328,
+      329,  330,  331,  332,  333,  334,  335,  336,  337,  338,
+      339,  340,  341,  342,  343,  344,  345,  346,  347,  348,
+      349,  350,  351,  352,  353,  354,  355,  356,  357,  358,
+      359,  360,  361,  362,  363,  364,  365,  366,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[2165] =
+static const flex_int16_t yy_chk[1237] =
     {   0,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,  367,  367,  367,  367,  367,
+      367,  367,  367,  367,  367,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    3,    3,    3,    4,    4,    4,    3,    9,
-        7,    4,    5,    5,    8,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,    5,    5,   10,   13,   37,   13,
-       37,   21,    5,    5,    9,    5,   21,   26,    5,   25,
-
-        5,   25,    5,   27,   25,   25,   25,   25,    5,    5,
-        7,   10,    5,   26,    8,  331,    5,   31,   28,   44,
-       42,    5,   42,   32,   33,  330,   27,    5,    5,   15,
-       15,   15,  329,   31,   15,   17,  328,   17,   17,   17,
-       17,   28,   20,   20,   20,   20,   32,   33,   44,   17,
-      202,   75,   15,   15,   20,   73,   15,   71,   71,   71,
-       71,   74,  175,   15,  149,   17,   83,   78,   15,   15,
-       20,   15,  122,   15,   75,   73,   15,   15,   15,   15,
-       15,   74,   15,   19,   15,   19,   19,   19,   19,   22,
-       78,   22,   22,   22,   22,   83,  116,   19,   76,   45,
-
-       45,   45,  110,   22,   45,   47,   47,   47,   89,   81,
-       47,   80,   77,   19,   50,   48,   48,   48,   76,   22,
-       48,   50,   49,   49,   49,  110,  111,   49,   72,   72,
-       72,   72,   77,   45,  112,   51,   51,   51,   43,   47,
-       51,   41,  113,   50,  115,   39,  111,   50,  114,   48,
-      112,   50,   52,   52,   52,   47,   49,   52,   50,   48,
-      115,   50,   38,   50,   50,  113,   52,  143,  114,   51,
-       24,   14,   49,   53,   53,   53,   11,    0,   53,   54,
-       54,   54,    0,  143,   54,   51,   52,   55,   55,   55,
-        0,    0,   55,   52,    0,    0,   52,   56,   56,   56,
-
-      146,    0,   56,    0,   57,   57,   57,   53,    0,   57,
-       58,   58,   58,   54,    0,   58,  146,   59,   59,   59,
-       53,   55,   59,   60,   60,   60,    0,    0,   60,   54,
-        0,   56,   55,   54,   56,    0,    0,   55,   57,    0,
-        0,   57,    0,    0,   58,   61,   61,   61,    0,    0,
-       61,   59,    0,    0,   59,    0,    0,   60,   63,   63,
-       63,   63,    0,    0,   60,   58,    0,    0,    0,   65,
-       63,   65,    0,   60,   65,   65,   65,   65,   64,   61,
-       64,   64,   64,   64,    0,   66,   63,   66,   66,   66,
-       66,    0,   64,    0,   61,    0,    0,   85,   61,   66,
-
-       67,   67,   67,   67,   85,   86,   86,   86,   64,    0,
-       86,    0,   67,    0,    0,   66,   87,   87,   87,    0,
-        0,   87,   88,   88,   88,    0,   85,   88,   67,    0,
-       85,    0,    0,    0,   85,   90,   90,   90,    0,   86,
-       90,   85,    0,    0,   85,    0,   85,   85,    0,    0,
-       87,    0,    0,    0,   86,   87,   88,   92,   92,   92,
-        0,    0,   92,    0,    0,   88,    0,    0,    0,   90,
-       91,   91,   91,   91,    0,    0,    0,    0,   91,   91,
-       91,   91,   91,   91,   93,   93,   93,    0,    0,   93,
-        0,   92,    0,    0,   91,   91,   91,   91,   91,   91,
-
-        0,    0,   94,   94,   94,   92,   92,   94,   95,   95,
-       95,    0,    0,   95,   96,   96,   96,    0,   93,   96,
-       97,   97,   97,    0,    0,   97,   98,   98,   98,    0,
-        0,   98,    0,   99,   99,   99,   94,    0,   99,    0,
-       94,    0,   95,    0,  100,  100,  100,   95,   96,  100,
-      101,  101,  101,    0,   97,  101,  102,  102,  102,    0,
-       98,  102,    0,  103,  103,  103,    0,   99,  103,   96,
-       97,   99,  104,  104,  104,    0,    0,  104,  100,    0,
-       98,  105,  105,  105,  101,    0,  105,  100,    0,    0,
-      102,  106,  106,  106,    0,    0,  106,  103,  107,  107,
-
-      107,    0,    0,  107,  102,    0,  104,  101,  108,  108,
-      108,    0,    0,  108,    0,  105,    0,  103,  119,  119,
-      119,    0,    0,  119,  104,  106,  120,  120,  120,    0,
-      106,  120,  107,  121,  121,  121,    0,  105,  121,  126,
-      126,  126,  108,  107,  126,    0,    0,    0,    0,  108,
-        0,    0,  119,    0,    0,    0,    0,    0,    0,    0,
-      120,  125,  125,  125,    0,    0,  125,  121,    0,    0,
-        0,    0,  119,  126,    0,    0,  121,  120,  124,  124,
-      124,  124,    0,    0,    0,    0,  124,  124,  124,  124,
-      124,  124,    0,  126,    0,  125,  128,  128,  128,    0,
-
-        0,  128,  124,  124,  124,  124,  124,  124,    0,  125,
-      129,  129,  129,    0,    0,  129,  130,  130,  130,    0,
-        0,  130,  131,  131,  131,    0,    0,  131,    0,    0,
-      128,  132,  132,  132,    0,    0,  132,  133,  133,  133,
-        0,    0,  133,    0,  129,    0,    0,  134,  134,  134,
-      130,  128,  134,  135,  135,  135,  131,    0,  135,    0,
-        0,  129,  136,  136,  136,  132,    0,  136,  131,  130,
-        0,  133,    0,  137,  137,  137,    0,    0,  137,    0,
-        0,  134,  132,  138,  138,  138,    0,  135,  138,  133,
-      134,    0,  139,  139,  139,    0,  136,  139,    0,    0,
-
-      140,  140,  140,  136,    0,  140,  135,  137,    0,  135,
-      141,  141,  141,    0,    0,  141,    0,  138,    0,    0,
-      138,    0,    0,    0,  137,    0,  139,  142,  142,  142,
-        0,    0,  142,  139,  140,  151,  151,  151,    0,    0,
-      151,    0,    0,    0,  141,    0,  140,  152,  152,  152,
-        0,    0,  152,    0,  153,  153,  153,    0,    0,  153,
-        0,  142,  152,  152,    0,    0,    0,  141,    0,  151,
-        0,  152,    0,  155,  155,  155,    0,    0,  155,  142,
-        0,  152,    0,    0,  156,  156,  156,  151,  153,  156,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  153,
-
-      154,  154,  154,  154,    0,    0,    0,  155,  154,  154,
-      154,  154,  154,  154,  155,  157,  157,  157,  156,    0,
-      157,    0,    0,    0,  154,  154,  154,  154,  154,  154,
-      158,  158,  158,    0,    0,  158,  156,  159,  159,  159,
-        0,    0,  159,    0,    0,  158,  158,    0,    0,  157,
-      160,  160,  160,    0,    0,  160,    0,    0,  157,    0,
-      161,  161,  161,    0,  158,  161,    0,  162,  162,  162,
-      161,  159,  162,  163,  163,  163,    0,    0,  163,    0,
-        0,  159,    0,    0,  160,  164,  164,  164,    0,    0,
-      164,  165,  165,  165,  161,    0,  165,  166,  166,  166,
-
-        0,  162,  166,  160,  162,    0,    0,  163,  167,  167,
-      167,    0,    0,  167,  163,    0,  168,  168,  168,  164,
-        0,  168,  169,  169,  169,  165,    0,  169,    0,    0,
-      164,  166,  165,    0,  170,  170,  170,    0,    0,  170,
-        0,    0,  167,  171,  171,  171,    0,    0,  171,    0,
-      168,    0,  172,  172,  172,    0,  169,  172,    0,    0,
-        0,    0,  172,  167,  168,  177,  177,  177,  170,    0,
-      177,  178,  178,  178,  169,  170,  178,  171,  179,  179,
-      179,    0,    0,  179,    0,    0,  172,  180,  180,  180,
-        0,    0,  180,    0,    0,  181,  181,  181,    0,  177,
-
-      181,  183,  183,  183,    0,  178,  183,    0,    0,  184,
-      184,  184,  179,    0,  184,  177,    0,  185,  185,  185,
-        0,  180,  185,    0,    0,    0,    0,  180,    0,  181,
-        0,  186,  186,  186,    0,  183,  186,    0,    0,    0,
-        0,    0,    0,  184,  181,  182,  182,  182,  182,    0,
-      183,  185,    0,  182,  182,  182,  182,  182,  182,  184,
-        0,  187,  187,  187,  185,  186,  187,    0,    0,  182,
-      182,  182,  182,  182,  182,  188,  188,  188,    0,    0,
-      188,  189,  189,  189,    0,    0,  189,  190,  190,  190,
-        0,  189,  190,    0,    0,  187,  191,  191,  191,    0,
-
-        0,  191,  192,  192,  192,    0,    0,  192,    0,  188,
-        0,  193,  193,  193,    0,  189,  193,  194,  194,  194,
-        0,  190,  194,  196,  196,  196,    0,    0,  196,    0,
-      191,  190,  197,  197,  197,    0,  192,  197,  190,    0,
-        0,  198,  198,  198,    0,  193,  198,    0,  191,    0,
-        0,  194,    0,    0,  192,    0,    0,  196,  199,  199,
-      199,    0,    0,  199,    0,    0,  197,    0,    0,  194,
-      193,    0,    0,  197,    0,  198,    0,  196,    0,  201,
-      201,  201,    0,    0,  201,    0,  198,    0,  204,  204,
-      204,    0,  199,  204,  207,  207,  207,    0,    0,  207,
-
-        0,    0,  208,  208,  208,    0,    0,  208,    0,    0,
-        0,    0,  199,  201,  209,  209,  209,    0,  201,  209,
-        0,    0,  204,    0,  210,  210,  210,    0,  207,  210,
-        0,    0,  211,  211,  211,  204,  208,  211,    0,    0,
-        0,    0,    0,  207,    0,  208,    0,    0,  209,  215,
-      215,  215,    0,    0,  215,  216,  216,  216,  210,    0,
-      216,    0,    0,    0,    0,    0,  211,    0,  209,    0,
-        0,  210,    0,  211,  217,  217,  217,    0,    0,  217,
-      218,  218,  218,  215,    0,  218,  219,  219,  219,  216,
-        0,  219,  220,  220,  220,    0,  215,  220,  221,  221,
-
-      221,    0,    0,  221,    0,  216,    0,    0,  217,    0,
-      222,  222,  222,    0,  218,  222,  223,  223,  223,    0,
-      219,  223,    0,    0,  217,    0,  220,    0,    0,  224,
-      224,  224,  221,  220,  224,  225,  225,  225,  218,  219,
-      225,    0,    0,    0,  222,  225,  222,  226,  226,  226,
-      223,    0,  226,    0,  228,  228,  228,    0,    0,  228,
-      229,  229,  229,  224,  228,  229,  230,  230,  230,  225,
-      223,  230,  231,  231,  231,    0,    0,  231,    0,    0,
-        0,  226,    0,  224,    0,  232,  232,  232,  228,    0,
-      232,  233,  233,  233,  229,  232,  233,  226,    0,    0,
-
-      230,    0,    0,  234,  234,  234,  231,    0,  234,  235,
-      235,  235,    0,  229,  235,  236,  236,  236,    0,  232,
-      236,  237,  237,  237,    0,  233,  237,  238,  238,  238,
-        0,    0,  238,    0,  239,  239,  239,  234,    0,  239,
-      242,  242,  242,  235,    0,  242,    0,  233,  234,  236,
-        0,  243,  243,  243,    0,  237,  243,    0,    0,    0,
-        0,  238,  235,    0,  244,  244,  244,  236,  239,  244,
-      245,  245,  245,    0,  242,  245,  246,  246,  246,    0,
-        0,  246,    0,    0,    0,  243,  247,  247,  247,    0,
-      242,  247,  243,    0,  248,  248,  248,    0,  244,  248,
-
-      251,  251,  251,    0,  245,  251,  252,  252,  252,    0,
-      246,  252,  253,  253,  253,    0,    0,  253,    0,  245,
-      247,    0,  244,  247,  245,  246,    0,    0,  248,    0,
-      254,  254,  254,    0,  251,  254,  255,  255,  255,    0,
-      252,  255,    0,  259,  259,  259,  253,  252,  259,    0,
-      253,    0,    0,  251,  260,  260,  260,    0,    0,  260,
-        0,  261,  261,  261,  254,    0,  261,  262,  262,  262,
-      255,    0,  262,  263,  263,  263,    0,  259,  263,    0,
-      264,  264,  264,    0,  254,  264,    0,    0,  260,    0,
-      255,  268,  268,  268,  259,  261,  268,    0,  265,  265,
-
-      265,  262,    0,  265,  262,    0,  260,  263,  267,  267,
-      267,    0,    0,  267,  264,  269,  269,  269,    0,    0,
-      269,  270,  270,  270,    0,  268,  270,    0,  271,  271,
-      271,  263,  265,  271,  264,  272,  272,  272,  268,    0,
-      272,  265,  267,  273,  273,  273,    0,    0,  273,  269,
-        0,  275,  275,  275,    0,  270,  275,    0,  267,  276,
-      276,  276,  271,    0,  276,    0,    0,  269,    0,  272,
-      277,  277,  277,    0,    0,  277,    0,  273,  278,  278,
-      278,    0,    0,  278,    0,  275,  279,  279,  279,  272,
-        0,  279,    0,  276,    0,    0,  273,    0,    0,  275,
-
-      280,  280,  280,    0,  277,  280,    0,    0,    0,    0,
-      276,  277,  278,  281,  281,  281,    0,    0,  281,  278,
-      279,  284,  284,  284,    0,  279,  284,  285,  285,  285,
-        0,    0,  285,    0,  280,  286,  286,  286,    0,    0,
-      286,  287,  287,  287,    0,    0,  287,  281,    0,    0,
-      281,  288,  288,  288,    0,  284,  288,  289,  289,  289,
-        0,  285,  289,  290,  290,  290,  284,    0,  290,  286,
-        0,    0,    0,    0,    0,  287,  286,    0,  292,  292,
-      292,    0,  287,  292,    0,  288,    0,  293,  293,  293,
-        0,  289,  293,  295,  295,  295,    0,  290,  295,  296,
-
-      296,  296,    0,    0,  296,    0,  289,    0,  288,  290,
-        0,    0,  292,  297,  297,  297,    0,    0,  297,    0,
-        0,  293,    0,  298,  298,  298,    0,  295,  298,    0,
-      292,    0,    0,  296,  299,  299,  299,  293,    0,  299,
-      300,  300,  300,    0,    0,  300,    0,  297,  301,  301,
-      301,    0,    0,  301,  304,  304,  304,  298,    0,  304,
-      305,  305,  305,    0,    0,  305,    0,  297,  299,    0,
-        0,  306,  306,  306,  300,  299,  306,  298,  307,  307,
-      307,    0,  301,  307,    0,  300,    0,    0,  304,    0,
-      308,  308,  308,    0,  305,  308,    0,  301,  311,  311,
-
-      311,    0,    0,  311,    0,  306,  312,  312,  312,    0,
-        0,  312,  307,  313,  313,  313,    0,    0,  313,  307,
-        0,  314,  314,  314,  308,  306,  314,    0,  315,  315,
-      315,    0,  311,  315,    0,    0,    0,    0,    0,    0,
-      312,    0,    0,  308,    0,    0,    0,  313,    0,    0,
-        0,  311,    0,    0,    0,  314,    0,    0,    0,  312,
-        0,    0,  315,  320,  320,  320,  320,  320,  321,  321,
-      321,  321,  321,  322,    0,  322,  322,  322,  323,    0,
-      323,    0,  323,  324,  324,  324,  324,  324,  325,  325,
-      325,  325,  325,  326,    0,  326,  326,  326,  327,  327,
-
-      327,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319,  319,  319,  319,  319,  319,  319,
-      319,  319,  319,  319
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    5,    5,    7,    5,    5,    5,    5,
+
+        5,    5,    5,    5,    5,    5,    5,    9,   11,   15,
+       13,   17,   30,    5,    5,   13,    5,   32,   16,    5,
+       16,    5,   29,    5,   26,   26,   26,   26,   30,    5,
+        5,   33,    9,    5,   34,    7,   27,    5,   27,   27,
+       27,   27,   37,    5,   39,   41,   29,   49,   50,   51,
+        5,    5,   12,   12,   52,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+       24,   31,   24,   24,   24,   24,   48,   47,   53,   55,
+       28,   47,   28,   58,   24,   28,   28,   28,   28,   56,
+
+       47,   57,   60,   48,   56,   31,   57,   61,   40,   40,
+       24,   40,   40,   62,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   44,   44,   77,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       46,   46,   59,   59,   46,   54,   63,   74,   79,   74,
+       76,   63,   81,   83,   46,   84,   46,   46,   90,   46,
+       91,   46,   92,   93,   46,   46,   46,   46,   46,   46,
+       46,   46,   54,   46,   76,   54,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       78,   80,   88,   94,   95,   96,   97,   97,   98,   88,
+       99,  100,  101,  102,  103,  104,  105,  106,  107,  108,
+       78,   80,  109,  110,  111,  112,  113,  118,  119,  121,
+      123,   88,  124,  128,  129,   88,  128,  130,  131,   88,
+      132,  133,  134,  118,  135,  136,   88,  138,  139,  140,
+       88,  141,   88,   88,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  117,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  117,
+      117,  117,  117,  117,  117,  117,  117,  117,  117,  120,
+      122,  127,  127,  127,  127,  142,  143,  144,  145,  127,
+      127,  127,  127,  127,  127,  146,  147,  148,  149,  150,
+
+      122,  151,  152,  120,  160,  127,  127,  127,  127,  127,
+      127,  153,  153,  153,  153,  159,  163,  165,  166,  153,
+      153,  153,  153,  153,  153,  167,  168,  169,  170,  172,
+      173,  159,  174,  175,  177,  153,  153,  153,  153,  153,
+      153,  164,  164,  164,  164,  178,  171,  171,  179,  164,
+      164,  164,  164,  164,  164,  171,  176,  176,  180,  181,
+      182,  183,  184,  185,  186,  164,  164,  164,  164,  164,
+      164,  187,  188,  189,  190,  190,  190,  190,  193,  195,
+      196,  197,  190,  190,  190,  190,  190,  190,  198,  199,
+      200,  201,  202,  203,  204,  205,  206,  207,  190,  190,
+
+      190,  190,  190,  190,  194,  194,  194,  194,  208,  209,
+      210,  211,  194,  194,  194,  194,  194,  194,  212,  213,
+      214,  216,  217,  218,  219,  212,  220,  221,  194,  194,
+      194,  194,  194,  194,  223,  223,  223,  223,  224,  226,
+      227,  228,  223,  223,  223,  223,  223,  223,  229,  231,
+      234,  235,  236,  237,  238,  242,  243,  244,  223,  223,
+      223,  223,  223,  223,  225,  225,  225,  225,  245,  246,
+      247,  248,  225,  225,  225,  225,  225,  225,  249,  250,
+      251,  252,  257,  259,  260,  261,  262,  263,  225,  225,
+      225,  225,  225,  225,  258,  264,  265,  266,  267,  268,
+
+      258,  247,  269,  270,  271,  273,  274,  275,  276,  277,
+      279,  280,  281,  282,  283,  286,  287,  288,  289,  290,
+      293,  294,  295,  296,  297,  298,  299,  300,  302,  304,
+      305,  306,  307,  308,  309,  310,  311,  312,  313,  314,
+      315,  316,  317,  318,  319,  320,  323,  324,  325,  326,
+      327,  328,  329,  330,  331,  332,  334,  335,  336,  340,
+      343,  344,  345,  346,  347,  348,  349,  350,  351,  352,
+      353,  356,  357,  358,  359,  360,  361,  363,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1354,14 +1161,15 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[58] =
+static const flex_int16_t yy_rule_linenum[62] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  177,  186,  195,  204,  215,  226,  235,  244,  253,
       262,  271,  280,  289,  298,  307,  316,  325,  334,  343,
       352,  361,  370,  379,  388,  397,  406,  415,  424,  433,
-      532,  537,  542,  547,  548,  549,  550,  551,  552,  554,
-      572,  585,  590,  594,  596,  598,  600
+      442,  451,  460,  469,  568,  573,  578,  583,  584,  585,
+      586,  587,  588,  590,  608,  621,  626,  630,  632,  634,
+      636
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1373,7 +1181,7 @@ static const flex_int16_t yy_rule_linenum[58] =
 #define YY_RESTORE_YY_MORE_OFFSET
 char *yytext;
 #line 1 "agent_lexer.ll"
-/* Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -1416,7 +1224,7 @@ using isc::agent::AgentParser;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::agent::ParserContext::fatal(msg)
-#line 1419 "agent_lexer.cc"
+#line 1227 "agent_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1442,8 +1250,8 @@ using isc::agent::AgentParser;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1445 "agent_lexer.cc"
-#line 1446 "agent_lexer.cc"
+#line 1253 "agent_lexer.cc"
+#line 1254 "agent_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1757,7 +1565,7 @@ YY_DECL
     }
 
 
-#line 1760 "agent_lexer.cc"
+#line 1568 "agent_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1786,13 +1594,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 320 )
+				if ( yy_current_state >= 368 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 319 );
+		while ( yy_current_state != 367 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2204,6 +2012,42 @@ YY_RULE_SETUP
 case 35:
 YY_RULE_SETUP
 #line 388 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_ASYNC(driver.loc_);
+    default:
+        return AgentParser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 36:
+YY_RULE_SETUP
+#line 397 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return AgentParser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 37:
+YY_RULE_SETUP
+#line 406 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return AgentParser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return AgentParser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 38:
+YY_RULE_SETUP
+#line 415 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2213,9 +2057,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 39:
 YY_RULE_SETUP
-#line 397 "agent_lexer.ll"
+#line 424 "agent_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return AgentParser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return AgentParser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 40:
+YY_RULE_SETUP
+#line 433 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2225,9 +2081,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 41:
 YY_RULE_SETUP
-#line 406 "agent_lexer.ll"
+#line 442 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2237,9 +2093,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 42:
 YY_RULE_SETUP
-#line 415 "agent_lexer.ll"
+#line 451 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2249,9 +2105,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 43:
 YY_RULE_SETUP
-#line 424 "agent_lexer.ll"
+#line 460 "agent_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::CONFIG:
@@ -2261,9 +2117,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 44:
 YY_RULE_SETUP
-#line 433 "agent_lexer.ll"
+#line 469 "agent_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2363,65 +2219,65 @@ YY_RULE_SETUP
     return AgentParser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 41:
-/* rule 41 can match eol */
+case 45:
+/* rule 45 can match eol */
 YY_RULE_SETUP
-#line 532 "agent_lexer.ll"
+#line 568 "agent_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 42:
-/* rule 42 can match eol */
+case 46:
+/* rule 46 can match eol */
 YY_RULE_SETUP
-#line 537 "agent_lexer.ll"
+#line 573 "agent_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 43:
+case 47:
 YY_RULE_SETUP
-#line 542 "agent_lexer.ll"
+#line 578 "agent_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 44:
+case 48:
 YY_RULE_SETUP
-#line 547 "agent_lexer.ll"
+#line 583 "agent_lexer.ll"
 { return AgentParser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 45:
+case 49:
 YY_RULE_SETUP
-#line 548 "agent_lexer.ll"
+#line 584 "agent_lexer.ll"
 { return AgentParser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 46:
+case 50:
 YY_RULE_SETUP
-#line 549 "agent_lexer.ll"
+#line 585 "agent_lexer.ll"
 { return AgentParser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 47:
+case 51:
 YY_RULE_SETUP
-#line 550 "agent_lexer.ll"
+#line 586 "agent_lexer.ll"
 { return AgentParser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 48:
+case 52:
 YY_RULE_SETUP
-#line 551 "agent_lexer.ll"
+#line 587 "agent_lexer.ll"
 { return AgentParser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 49:
+case 53:
 YY_RULE_SETUP
-#line 552 "agent_lexer.ll"
+#line 588 "agent_lexer.ll"
 { return AgentParser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 50:
+case 54:
 YY_RULE_SETUP
-#line 554 "agent_lexer.ll"
+#line 590 "agent_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2440,9 +2296,9 @@ YY_RULE_SETUP
     return AgentParser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 51:
+case 55:
 YY_RULE_SETUP
-#line 572 "agent_lexer.ll"
+#line 608 "agent_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2456,43 +2312,43 @@ YY_RULE_SETUP
     return AgentParser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 52:
+case 56:
 YY_RULE_SETUP
-#line 585 "agent_lexer.ll"
+#line 621 "agent_lexer.ll"
 {
     string tmp(yytext);
     return AgentParser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 53:
+case 57:
 YY_RULE_SETUP
-#line 590 "agent_lexer.ll"
+#line 626 "agent_lexer.ll"
 {
    return AgentParser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 594 "agent_lexer.ll"
+#line 630 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 596 "agent_lexer.ll"
+#line 632 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 598 "agent_lexer.ll"
+#line 634 "agent_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 600 "agent_lexer.ll"
+#line 636 "agent_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 602 "agent_lexer.ll"
+#line 638 "agent_lexer.ll"
 {
     if (driver.states_.empty()) {
         return AgentParser::make_END(driver.loc_);
@@ -2516,12 +2372,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 625 "agent_lexer.ll"
+#line 661 "agent_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2524 "agent_lexer.cc"
+#line 2380 "agent_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2840,7 +2696,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 320 )
+			if ( yy_current_state >= 368 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2873,11 +2729,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 320 )
+		if ( yy_current_state >= 368 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 319);
+	yy_is_jam = (yy_current_state == 367);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3626,7 +3482,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 625 "agent_lexer.ll"
+#line 661 "agent_lexer.ll"
 
 
 using namespace isc::dhcp;
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 33 "agent_parser.yy" // lalr1.cc:438
+#line 33 "agent_parser.yy"
 
 #include <agent/parser_context.h>
 
-#line 51 "agent_parser.cc" // lalr1.cc:438
+#line 52 "agent_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -88,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if AGENT_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !AGENT_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "agent_parser.yy" // lalr1.cc:513
+#line 14 "agent_parser.yy"
 namespace isc { namespace agent {
-#line 146 "agent_parser.cc" // lalr1.cc:513
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  AgentParser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "agent_parser.cc"
 
   /// Build a parser object.
   AgentParser::AgentParser (isc::agent::ParserContext& ctx_yyarg)
-    :
 #if AGENT_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -195,24 +157,26 @@ namespace isc { namespace agent {
   AgentParser::~AgentParser ()
   {}
 
+  AgentParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  AgentParser::by_state::by_state ()
+  AgentParser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  AgentParser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  AgentParser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
   void
-  AgentParser::by_state::clear ()
+  AgentParser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
@@ -224,17 +188,17 @@ namespace isc { namespace agent {
     that.clear ();
   }
 
-  AgentParser::by_state::by_state (state_type s)
+  AgentParser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  AgentParser::symbol_number_type
-  AgentParser::by_state::type_get () const
+  AgentParser::symbol_kind_type
+  AgentParser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   AgentParser::stack_symbol_type::stack_symbol_type ()
@@ -243,27 +207,27 @@ namespace isc { namespace agent {
   AgentParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -280,27 +244,27 @@ namespace isc { namespace agent {
   AgentParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -309,35 +273,71 @@ namespace isc { namespace agent {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  AgentParser::stack_symbol_type&
+  AgentParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   AgentParser::stack_symbol_type&
   AgentParser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -363,75 +363,67 @@ namespace isc { namespace agent {
 #if AGENT_DEBUG
   template <typename Base>
   void
-  AgentParser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  AgentParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 41: // "constant string"
-
-#line 103 "agent_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 386 "agent_parser.cc" // lalr1.cc:672
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 107 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "agent_parser.cc"
         break;
 
-      case 42: // "integer"
-
-#line 103 "agent_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 393 "agent_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_INTEGER: // "integer"
+#line 107 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "agent_parser.cc"
         break;
 
-      case 43: // "floating point"
-
-#line 103 "agent_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< double > (); }
-#line 400 "agent_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 107 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "agent_parser.cc"
         break;
 
-      case 44: // "boolean"
-
-#line 103 "agent_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 407 "agent_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 107 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "agent_parser.cc"
         break;
 
-      case 53: // value
-
-#line 103 "agent_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 414 "agent_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_value: // value
+#line 107 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "agent_parser.cc"
         break;
 
-      case 56: // map_value
-
-#line 103 "agent_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 421 "agent_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_map_value: // map_value
+#line 107 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "agent_parser.cc"
         break;
 
-      case 107: // socket_type_value
-
-#line 103 "agent_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 428 "agent_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_socket_type_value: // socket_type_value
+#line 107 "agent_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "agent_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -455,7 +447,7 @@ namespace isc { namespace agent {
   }
 
   void
-  AgentParser::yypop_ (int n)
+  AgentParser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -490,21 +482,21 @@ namespace isc { namespace agent {
   AgentParser::state_type
   AgentParser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  AgentParser::yy_pact_value_is_default_ (int yyvalue)
+  AgentParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  AgentParser::yy_table_value_is_error_ (int yyvalue)
+  AgentParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -518,7 +510,6 @@ namespace isc { namespace agent {
   int
   AgentParser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -550,27 +541,33 @@ namespace isc { namespace agent {
     yystack_.clear ();
     yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -581,6 +578,7 @@ namespace isc { namespace agent {
 #if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
@@ -588,11 +586,23 @@ namespace isc { namespace agent {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -609,20 +619,22 @@ namespace isc { namespace agent {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
@@ -634,25 +646,25 @@ namespace isc { namespace agent {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 53: // value
-      case 56: // map_value
-      case 107: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 44: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 43: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 42: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 41: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -663,8 +675,8 @@ namespace isc { namespace agent {
 
       // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
         yyerror_range[1].location = yylhs.location;
       }
 
@@ -676,208 +688,208 @@ namespace isc { namespace agent {
         {
           switch (yyn)
             {
-  case 2:
-#line 114 "agent_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.NO_KEYWORDS; }
-#line 683 "agent_parser.cc" // lalr1.cc:907
+  case 2: // $@1: %empty
+#line 118 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.NO_KEYWORDS; }
+#line 695 "agent_parser.cc"
     break;
 
-  case 4:
-#line 115 "agent_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 689 "agent_parser.cc" // lalr1.cc:907
+  case 4: // $@2: %empty
+#line 119 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "agent_parser.cc"
     break;
 
-  case 6:
-#line 116 "agent_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.AGENT; }
-#line 695 "agent_parser.cc" // lalr1.cc:907
+  case 6: // $@3: %empty
+#line 120 "agent_parser.yy"
+                       { ctx.ctx_ = ctx.AGENT; }
+#line 707 "agent_parser.cc"
     break;
 
-  case 8:
-#line 124 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 8: // $@4: %empty
+#line 128 "agent_parser.yy"
+                          {
     // Parse the Control-agent map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 705 "agent_parser.cc" // lalr1.cc:907
+#line 717 "agent_parser.cc"
     break;
 
-  case 9:
-#line 128 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 9: // sub_agent: "{" $@4 global_params "}"
+#line 132 "agent_parser.yy"
+                               {
     // parsing completed
 }
-#line 713 "agent_parser.cc" // lalr1.cc:907
+#line 725 "agent_parser.cc"
     break;
 
-  case 10:
-#line 135 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 10: // json: value
+#line 139 "agent_parser.yy"
+            {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 722 "agent_parser.cc" // lalr1.cc:907
+#line 734 "agent_parser.cc"
     break;
 
-  case 11:
-#line 141 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 728 "agent_parser.cc" // lalr1.cc:907
+  case 11: // value: "integer"
+#line 145 "agent_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 740 "agent_parser.cc"
     break;
 
-  case 12:
-#line 142 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 734 "agent_parser.cc" // lalr1.cc:907
+  case 12: // value: "floating point"
+#line 146 "agent_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 746 "agent_parser.cc"
     break;
 
-  case 13:
-#line 143 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 740 "agent_parser.cc" // lalr1.cc:907
+  case 13: // value: "boolean"
+#line 147 "agent_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 752 "agent_parser.cc"
     break;
 
-  case 14:
-#line 144 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 746 "agent_parser.cc" // lalr1.cc:907
+  case 14: // value: "constant string"
+#line 148 "agent_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 758 "agent_parser.cc"
     break;
 
-  case 15:
-#line 145 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 752 "agent_parser.cc" // lalr1.cc:907
+  case 15: // value: "null"
+#line 149 "agent_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 764 "agent_parser.cc"
     break;
 
-  case 16:
-#line 146 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 758 "agent_parser.cc" // lalr1.cc:907
+  case 16: // value: map
+#line 150 "agent_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 770 "agent_parser.cc"
     break;
 
-  case 17:
-#line 147 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 764 "agent_parser.cc" // lalr1.cc:907
+  case 17: // value: list_generic
+#line 151 "agent_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 776 "agent_parser.cc"
     break;
 
-  case 18:
-#line 151 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 18: // $@5: %empty
+#line 155 "agent_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 775 "agent_parser.cc" // lalr1.cc:907
+#line 787 "agent_parser.cc"
     break;
 
-  case 19:
-#line 156 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 19: // map: "{" $@5 map_content "}"
+#line 160 "agent_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 785 "agent_parser.cc" // lalr1.cc:907
+#line 797 "agent_parser.cc"
     break;
 
-  case 20:
-#line 162 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 791 "agent_parser.cc" // lalr1.cc:907
+  case 20: // map_value: map
+#line 166 "agent_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 803 "agent_parser.cc"
     break;
 
-  case 23:
-#line 176 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 23: // not_empty_map: "constant string" ":" value
+#line 180 "agent_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 800 "agent_parser.cc" // lalr1.cc:907
+#line 812 "agent_parser.cc"
     break;
 
-  case 24:
-#line 180 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 24: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 184 "agent_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 810 "agent_parser.cc" // lalr1.cc:907
+#line 822 "agent_parser.cc"
     break;
 
-  case 25:
-#line 187 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 25: // $@6: %empty
+#line 191 "agent_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 819 "agent_parser.cc" // lalr1.cc:907
+#line 831 "agent_parser.cc"
     break;
 
-  case 26:
-#line 190 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 26: // list_generic: "[" $@6 list_content "]"
+#line 194 "agent_parser.yy"
+                               {
 }
-#line 826 "agent_parser.cc" // lalr1.cc:907
+#line 838 "agent_parser.cc"
     break;
 
-  case 29:
-#line 197 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 29: // not_empty_list: value
+#line 201 "agent_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 835 "agent_parser.cc" // lalr1.cc:907
+#line 847 "agent_parser.cc"
     break;
 
-  case 30:
-#line 201 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 30: // not_empty_list: not_empty_list "," value
+#line 205 "agent_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 844 "agent_parser.cc" // lalr1.cc:907
+#line 856 "agent_parser.cc"
     break;
 
-  case 31:
-#line 214 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 31: // unknown_map_entry: "constant string" ":"
+#line 218 "agent_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 855 "agent_parser.cc" // lalr1.cc:907
+#line 867 "agent_parser.cc"
     break;
 
-  case 32:
-#line 223 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 32: // $@7: %empty
+#line 227 "agent_parser.yy"
+                                 {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 866 "agent_parser.cc" // lalr1.cc:907
+#line 878 "agent_parser.cc"
     break;
 
-  case 33:
-#line 228 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 33: // agent_syntax_map: "{" $@7 global_objects "}"
+#line 232 "agent_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 876 "agent_parser.cc" // lalr1.cc:907
+#line 888 "agent_parser.cc"
     break;
 
-  case 42:
-#line 249 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 42: // $@8: %empty
+#line 253 "agent_parser.yy"
+                            {
 
     // Let's create a MapElement that will represent it, add it to the
     // top level map (that's already on the stack) and put the new map
@@ -888,60 +900,60 @@ namespace isc { namespace agent {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.AGENT);
 }
-#line 892 "agent_parser.cc" // lalr1.cc:907
+#line 904 "agent_parser.cc"
     break;
 
-  case 43:
-#line 259 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 43: // agent_object: "Control-agent" $@8 ":" "{" global_params "}"
+#line 263 "agent_parser.yy"
+                                                    {
     // Ok, we're done with parsing control-agent. Let's take the map
     // off the stack.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 903 "agent_parser.cc" // lalr1.cc:907
+#line 915 "agent_parser.cc"
     break;
 
-  case 53:
-#line 281 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 53: // $@9: %empty
+#line 285 "agent_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 911 "agent_parser.cc" // lalr1.cc:907
+#line 923 "agent_parser.cc"
     break;
 
-  case 54:
-#line 283 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 54: // http_host: "http-host" $@9 ":" "constant string"
+#line 287 "agent_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-host", host);
     ctx.leave();
 }
-#line 921 "agent_parser.cc" // lalr1.cc:907
+#line 933 "agent_parser.cc"
     break;
 
-  case 55:
-#line 289 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 55: // http_port: "http-port" ":" "integer"
+#line 293 "agent_parser.yy"
+                                   {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("http-port", prf);
 }
-#line 930 "agent_parser.cc" // lalr1.cc:907
+#line 942 "agent_parser.cc"
     break;
 
-  case 56:
-#line 294 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 56: // $@10: %empty
+#line 298 "agent_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 938 "agent_parser.cc" // lalr1.cc:907
+#line 950 "agent_parser.cc"
     break;
 
-  case 57:
-#line 296 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 57: // user_context: "user-context" $@10 ":" map_value
+#line 300 "agent_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
-    ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
+    ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
 
     // Handle already existing user context
@@ -961,23 +973,23 @@ namespace isc { namespace agent {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 965 "agent_parser.cc" // lalr1.cc:907
+#line 977 "agent_parser.cc"
     break;
 
-  case 58:
-#line 319 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 58: // $@11: %empty
+#line 323 "agent_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 973 "agent_parser.cc" // lalr1.cc:907
+#line 985 "agent_parser.cc"
     break;
 
-  case 59:
-#line 321 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 59: // comment: "comment" $@11 ":" "constant string"
+#line 325 "agent_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
-    ElementPtr comment(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     user_context->set("comment", comment);
 
     // Handle already existing user context
@@ -998,442 +1010,497 @@ namespace isc { namespace agent {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1002 "agent_parser.cc" // lalr1.cc:907
+#line 1014 "agent_parser.cc"
     break;
 
-  case 60:
-#line 347 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 60: // $@12: %empty
+#line 351 "agent_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1013 "agent_parser.cc" // lalr1.cc:907
+#line 1025 "agent_parser.cc"
     break;
 
-  case 61:
-#line 352 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 61: // hooks_libraries: "hooks-libraries" $@12 ":" "[" hooks_libraries_list "]"
+#line 356 "agent_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1022 "agent_parser.cc" // lalr1.cc:907
+#line 1034 "agent_parser.cc"
     break;
 
-  case 66:
-#line 365 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 66: // $@13: %empty
+#line 369 "agent_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1032 "agent_parser.cc" // lalr1.cc:907
+#line 1044 "agent_parser.cc"
     break;
 
-  case 67:
-#line 369 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 67: // hooks_library: "{" $@13 hooks_params "}"
+#line 373 "agent_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1040 "agent_parser.cc" // lalr1.cc:907
+#line 1052 "agent_parser.cc"
     break;
 
-  case 73:
-#line 382 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 73: // $@14: %empty
+#line 386 "agent_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1048 "agent_parser.cc" // lalr1.cc:907
+#line 1060 "agent_parser.cc"
     break;
 
-  case 74:
-#line 384 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 74: // library: "library" $@14 ":" "constant string"
+#line 388 "agent_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1058 "agent_parser.cc" // lalr1.cc:907
+#line 1070 "agent_parser.cc"
     break;
 
-  case 75:
-#line 390 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 75: // $@15: %empty
+#line 394 "agent_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1066 "agent_parser.cc" // lalr1.cc:907
+#line 1078 "agent_parser.cc"
     break;
 
-  case 76:
-#line 392 "agent_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 76: // parameters: "parameters" $@15 ":" value
+#line 396 "agent_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1075 "agent_parser.cc" // lalr1.cc:907
+#line 1087 "agent_parser.cc"
     break;
 
-  case 77:
-#line 400 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 77: // $@16: %empty
+#line 404 "agent_parser.yy"
+                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("control-sockets", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKETS);
 }
-#line 1086 "agent_parser.cc" // lalr1.cc:907
+#line 1098 "agent_parser.cc"
     break;
 
-  case 78:
-#line 405 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 78: // control_sockets: "control-sockets" ":" "{" $@16 control_sockets_params "}"
+#line 409 "agent_parser.yy"
+                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1095 "agent_parser.cc" // lalr1.cc:907
+#line 1107 "agent_parser.cc"
     break;
 
-  case 85:
-#line 426 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 85: // $@17: %empty
+#line 430 "agent_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1106 "agent_parser.cc" // lalr1.cc:907
+#line 1118 "agent_parser.cc"
     break;
 
-  case 86:
-#line 431 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 86: // dhcp4_server_socket: "dhcp4" $@17 ":" "{" control_socket_params "}"
+#line 435 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1115 "agent_parser.cc" // lalr1.cc:907
+#line 1127 "agent_parser.cc"
     break;
 
-  case 87:
-#line 437 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 87: // $@18: %empty
+#line 441 "agent_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1126 "agent_parser.cc" // lalr1.cc:907
+#line 1138 "agent_parser.cc"
     break;
 
-  case 88:
-#line 442 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 88: // dhcp6_server_socket: "dhcp6" $@18 ":" "{" control_socket_params "}"
+#line 446 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1135 "agent_parser.cc" // lalr1.cc:907
+#line 1147 "agent_parser.cc"
     break;
 
-  case 89:
-#line 448 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 89: // $@19: %empty
+#line 452 "agent_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1146 "agent_parser.cc" // lalr1.cc:907
+#line 1158 "agent_parser.cc"
     break;
 
-  case 90:
-#line 453 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 90: // d2_server_socket: "d2" $@19 ":" "{" control_socket_params "}"
+#line 457 "agent_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1155 "agent_parser.cc" // lalr1.cc:907
+#line 1167 "agent_parser.cc"
     break;
 
-  case 98:
-#line 472 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 98: // $@20: %empty
+#line 476 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1163 "agent_parser.cc" // lalr1.cc:907
+#line 1175 "agent_parser.cc"
     break;
 
-  case 99:
-#line 474 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 99: // socket_name: "socket-name" $@20 ":" "constant string"
+#line 478 "agent_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1173 "agent_parser.cc" // lalr1.cc:907
+#line 1185 "agent_parser.cc"
     break;
 
-  case 100:
-#line 481 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 100: // $@21: %empty
+#line 485 "agent_parser.yy"
+                         {
     ctx.enter(ctx.SOCKET_TYPE);
 }
-#line 1181 "agent_parser.cc" // lalr1.cc:907
+#line 1193 "agent_parser.cc"
     break;
 
-  case 101:
-#line 483 "agent_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("socket-type", yystack_[0].value.as< ElementPtr > ());
+  case 101: // socket_type: "socket-type" $@21 ":" socket_type_value
+#line 487 "agent_parser.yy"
+                          {
+    ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1190 "agent_parser.cc" // lalr1.cc:907
+#line 1202 "agent_parser.cc"
     break;
 
-  case 102:
-#line 489 "agent_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
-#line 1196 "agent_parser.cc" // lalr1.cc:907
+  case 102: // socket_type_value: "unix"
+#line 493 "agent_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
+#line 1208 "agent_parser.cc"
     break;
 
-  case 103:
-#line 495 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 103: // $@22: %empty
+#line 499 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1204 "agent_parser.cc" // lalr1.cc:907
+#line 1216 "agent_parser.cc"
     break;
 
-  case 104:
-#line 497 "agent_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 104: // dhcp4_json_object: "Dhcp4" $@22 ":" value
+#line 501 "agent_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1213 "agent_parser.cc" // lalr1.cc:907
+#line 1225 "agent_parser.cc"
     break;
 
-  case 105:
-#line 502 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 105: // $@23: %empty
+#line 506 "agent_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1221 "agent_parser.cc" // lalr1.cc:907
+#line 1233 "agent_parser.cc"
     break;
 
-  case 106:
-#line 504 "agent_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 106: // dhcp6_json_object: "Dhcp6" $@23 ":" value
+#line 508 "agent_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1230 "agent_parser.cc" // lalr1.cc:907
+#line 1242 "agent_parser.cc"
     break;
 
-  case 107:
-#line 509 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 107: // $@24: %empty
+#line 513 "agent_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1238 "agent_parser.cc" // lalr1.cc:907
+#line 1250 "agent_parser.cc"
     break;
 
-  case 108:
-#line 511 "agent_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 108: // dhcpddns_json_object: "DhcpDdns" $@24 ":" value
+#line 515 "agent_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1247 "agent_parser.cc" // lalr1.cc:907
+#line 1259 "agent_parser.cc"
     break;
 
-  case 109:
-#line 521 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 109: // $@25: %empty
+#line 525 "agent_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1258 "agent_parser.cc" // lalr1.cc:907
+#line 1270 "agent_parser.cc"
     break;
 
-  case 110:
-#line 526 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 110: // logging_object: "Logging" $@25 ":" "{" logging_params "}"
+#line 530 "agent_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1267 "agent_parser.cc" // lalr1.cc:907
+#line 1279 "agent_parser.cc"
     break;
 
-  case 114:
-#line 543 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 114: // $@26: %empty
+#line 547 "agent_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1278 "agent_parser.cc" // lalr1.cc:907
+#line 1290 "agent_parser.cc"
     break;
 
-  case 115:
-#line 548 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 115: // loggers: "loggers" $@26 ":" "[" loggers_entries "]"
+#line 552 "agent_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1287 "agent_parser.cc" // lalr1.cc:907
+#line 1299 "agent_parser.cc"
     break;
 
-  case 118:
-#line 560 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 118: // $@27: %empty
+#line 564 "agent_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1297 "agent_parser.cc" // lalr1.cc:907
+#line 1309 "agent_parser.cc"
     break;
 
-  case 119:
-#line 564 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 119: // logger_entry: "{" $@27 logger_params "}"
+#line 568 "agent_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1305 "agent_parser.cc" // lalr1.cc:907
+#line 1317 "agent_parser.cc"
     break;
 
-  case 129:
-#line 581 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 130: // $@28: %empty
+#line 586 "agent_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1313 "agent_parser.cc" // lalr1.cc:907
+#line 1325 "agent_parser.cc"
     break;
 
-  case 130:
-#line 583 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 131: // name: "name" $@28 ":" "constant string"
+#line 588 "agent_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1323 "agent_parser.cc" // lalr1.cc:907
+#line 1335 "agent_parser.cc"
     break;
 
-  case 131:
-#line 589 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 132: // debuglevel: "debuglevel" ":" "integer"
+#line 594 "agent_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1332 "agent_parser.cc" // lalr1.cc:907
+#line 1344 "agent_parser.cc"
     break;
 
-  case 132:
-#line 594 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 133: // $@29: %empty
+#line 599 "agent_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1340 "agent_parser.cc" // lalr1.cc:907
+#line 1352 "agent_parser.cc"
     break;
 
-  case 133:
-#line 596 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 134: // severity: "severity" $@29 ":" "constant string"
+#line 601 "agent_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1350 "agent_parser.cc" // lalr1.cc:907
+#line 1362 "agent_parser.cc"
     break;
 
-  case 134:
-#line 602 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 135: // $@30: %empty
+#line 607 "agent_parser.yy"
+                       {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1370 "agent_parser.cc"
+    break;
+
+  case 136: // rate_limit: "rate-limit" $@30 ":" "constant string"
+#line 609 "agent_parser.yy"
+               {
+    ElementPtr rl(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+}
+#line 1380 "agent_parser.cc"
+    break;
+
+  case 137: // $@31: %empty
+#line 615 "agent_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1361 "agent_parser.cc" // lalr1.cc:907
+#line 1391 "agent_parser.cc"
     break;
 
-  case 135:
-#line 607 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 138: // output_options_list: "output_options" $@31 ":" "[" output_options_list_content "]"
+#line 620 "agent_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1370 "agent_parser.cc" // lalr1.cc:907
+#line 1400 "agent_parser.cc"
     break;
 
-  case 138:
-#line 616 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 141: // $@32: %empty
+#line 629 "agent_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1380 "agent_parser.cc" // lalr1.cc:907
+#line 1410 "agent_parser.cc"
     break;
 
-  case 139:
-#line 620 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 142: // output_entry: "{" $@32 output_params_list "}"
+#line 633 "agent_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1388 "agent_parser.cc" // lalr1.cc:907
+#line 1418 "agent_parser.cc"
     break;
 
-  case 146:
-#line 634 "agent_parser.yy" // lalr1.cc:907
-    {
+  case 152: // $@33: %empty
+#line 650 "agent_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1396 "agent_parser.cc" // lalr1.cc:907
+#line 1426 "agent_parser.cc"
     break;
 
-  case 147:
-#line 636 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 153: // output: "output" $@33 ":" "constant string"
+#line 652 "agent_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1406 "agent_parser.cc" // lalr1.cc:907
+#line 1436 "agent_parser.cc"
     break;
 
-  case 148:
-#line 642 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 154: // flush: "flush" ":" "boolean"
+#line 658 "agent_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1415 "agent_parser.cc" // lalr1.cc:907
+#line 1445 "agent_parser.cc"
     break;
 
-  case 149:
-#line 647 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 155: // maxsize: "maxsize" ":" "integer"
+#line 663 "agent_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1424 "agent_parser.cc" // lalr1.cc:907
+#line 1454 "agent_parser.cc"
     break;
 
-  case 150:
-#line 652 "agent_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 156: // maxver: "maxver" ":" "integer"
+#line 668 "agent_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1433 "agent_parser.cc" // lalr1.cc:907
+#line 1463 "agent_parser.cc"
+    break;
+
+  case 157: // async: "async" ":" "boolean"
+#line 673 "agent_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1472 "agent_parser.cc"
+    break;
+
+  case 158: // queue_size: "queue-size" ":" "integer"
+#line 678 "agent_parser.yy"
+                                     {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", size);
+}
+#line 1481 "agent_parser.cc"
     break;
 
+  case 159: // $@34: %empty
+#line 683 "agent_parser.yy"
+                                 {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1489 "agent_parser.cc"
+    break;
+
+  case 160: // overflow_policy: "overflow-policy" $@34 ":" "constant string"
+#line 685 "agent_parser.yy"
+               {
+    ElementPtr policy(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 1499 "agent_parser.cc"
+    break;
+
+
+#line 1503 "agent_parser.cc"
 
-#line 1437 "agent_parser.cc" // lalr1.cc:907
             default:
               break;
             }
@@ -1441,6 +1508,7 @@ namespace isc { namespace agent {
 #if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
@@ -1448,13 +1516,13 @@ namespace isc { namespace agent {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1463,7 +1531,9 @@ namespace isc { namespace agent {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1474,7 +1544,7 @@ namespace isc { namespace agent {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1491,68 +1561,81 @@ namespace isc { namespace agent {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1560,6 +1643,7 @@ namespace isc { namespace agent {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1593,18 +1677,103 @@ namespace isc { namespace agent {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  AgentParser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  AgentParser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
 
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  AgentParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // AgentParser::context.
+  AgentParser::context::context (const AgentParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  AgentParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  AgentParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1623,41 +1792,32 @@ namespace isc { namespace agent {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  AgentParser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1678,11 +1838,11 @@ namespace isc { namespace agent {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1691,39 +1851,41 @@ namespace isc { namespace agent {
   }
 
 
-  const signed char AgentParser::yypact_ninf_ = -68;
+  const short AgentParser::yypact_ninf_ = -142;
 
   const signed char AgentParser::yytable_ninf_ = -1;
 
   const short
   AgentParser::yypact_[] =
   {
-      59,   -68,   -68,   -68,     6,     8,     9,    34,   -68,   -68,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
-     -68,   -68,   -68,   -68,     8,   -29,    -5,    -4,   -68,    41,
-      51,    98,    85,   100,   -68,   -68,   -68,   -68,   -68,   101,
-     -68,    11,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   102,
-     -68,   -68,   103,   -68,   -68,    21,   -68,   -68,   -68,   -68,
-     -68,   -68,   -68,   -68,     8,     8,   -68,    63,   104,   105,
-     106,   107,   109,   -68,    -5,   -68,   111,    74,   113,   114,
-     112,   116,    -4,   -68,   -68,   -68,   117,   115,   118,     8,
-       8,     8,   -68,    83,   -68,   119,    87,   -68,   122,   -68,
-       8,    -4,    97,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
-       5,   123,   -68,    64,   -68,    65,   -68,   -68,   -68,   -68,
-     -68,   -68,    71,   -68,   -68,   -68,   -68,   -68,   125,   126,
-     -68,   -68,   128,    97,   -68,   129,   130,   131,     5,   -68,
-      37,   -68,   123,   132,   -68,   133,   134,   135,   -68,   -68,
-     -68,   -68,    78,   -68,   -68,   -68,   -68,   136,    14,    14,
-      14,   140,   141,    42,   -68,   -68,    32,   -68,   -68,   -68,
-     -68,   -68,   -68,    79,   -68,   -68,   -68,    80,    82,    95,
-       8,   -68,    12,   136,   -68,   142,   143,    14,   -68,   -68,
-     -68,   -68,   -68,   -68,   -68,   144,   -68,   -68,   -68,   -68,
-      86,   -68,   -68,   -68,   -68,   -68,   -68,   108,   138,   -68,
-     146,   147,    96,   148,    12,   -68,   -68,   -68,   -68,   120,
-     149,   -68,   121,   -68,   -68,   156,   -68,   -68,    89,   -68,
-      30,   156,   -68,   -68,   151,   160,   161,    88,   -68,   -68,
-     -68,   -68,   -68,   -68,   162,   124,   127,   137,    30,   -68,
-     139,   -68,   -68,   -68,   -68,   -68
+      65,  -142,  -142,  -142,     8,     4,     3,    22,  -142,  -142,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+    -142,  -142,  -142,  -142,     4,    -6,    -5,    10,  -142,    35,
+      50,    58,    60,    90,  -142,  -142,  -142,  -142,  -142,   100,
+    -142,     9,  -142,  -142,  -142,  -142,  -142,  -142,  -142,   106,
+    -142,  -142,   107,  -142,  -142,    23,  -142,  -142,  -142,  -142,
+    -142,  -142,  -142,  -142,     4,     4,  -142,    68,   111,   112,
+     113,   114,   115,  -142,    -5,  -142,   116,    57,   117,   118,
+     119,   120,    10,  -142,  -142,  -142,   121,   122,   123,     4,
+       4,     4,  -142,    78,  -142,   124,    82,  -142,   127,  -142,
+       4,    10,   102,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+      -2,   126,  -142,    30,  -142,    34,  -142,  -142,  -142,  -142,
+    -142,  -142,    51,  -142,  -142,  -142,  -142,  -142,   128,   132,
+    -142,  -142,   133,   102,  -142,   134,   135,   136,    -2,  -142,
+     -17,  -142,   126,   131,  -142,   137,   138,   139,  -142,  -142,
+    -142,  -142,    71,  -142,  -142,  -142,  -142,   140,    53,    53,
+      53,   144,   145,    59,  -142,  -142,    24,  -142,  -142,  -142,
+    -142,  -142,  -142,    88,  -142,  -142,  -142,    89,    91,    96,
+       4,  -142,    33,   140,  -142,   146,   147,    53,  -142,  -142,
+    -142,  -142,  -142,  -142,  -142,   148,  -142,  -142,  -142,  -142,
+    -142,    92,  -142,  -142,  -142,  -142,  -142,  -142,  -142,    97,
+     141,  -142,   149,   150,   109,   155,   157,    33,  -142,  -142,
+    -142,  -142,   125,   158,  -142,   129,   130,  -142,  -142,   159,
+    -142,  -142,  -142,    99,  -142,    52,   159,  -142,  -142,   160,
+     161,   163,   164,   165,  -142,    98,  -142,  -142,  -142,  -142,
+    -142,  -142,  -142,  -142,  -142,   167,    95,   142,   143,   151,
+     152,   168,    52,  -142,   156,  -142,  -142,  -142,  -142,  -142,
+     162,  -142,  -142,  -142
   };
 
   const unsigned char
@@ -1748,148 +1910,157 @@ namespace isc { namespace agent {
        0,     0,     0,     0,    67,   118,     0,   116,    98,   100,
       97,    95,    96,     0,    91,    93,    94,     0,     0,     0,
        0,    69,     0,     0,   115,     0,     0,     0,    86,    88,
-      90,    74,    76,   129,   134,     0,   132,   128,   126,   127,
-       0,   120,   122,   124,   125,   123,   117,     0,     0,    92,
-       0,     0,     0,     0,     0,   119,    99,   102,   101,     0,
-       0,   131,     0,   121,   130,     0,   133,   138,     0,   136,
-       0,     0,   135,   146,     0,     0,     0,     0,   140,   142,
-     143,   144,   145,   137,     0,     0,     0,     0,     0,   139,
-       0,   148,   149,   150,   141,   147
+      90,    74,    76,   130,   137,     0,   135,   133,   129,   127,
+     128,     0,   120,   122,   124,   126,   125,   123,   117,     0,
+       0,    92,     0,     0,     0,     0,     0,     0,   119,    99,
+     102,   101,     0,     0,   132,     0,     0,   121,   131,     0,
+     136,   134,   141,     0,   139,     0,     0,   138,   152,     0,
+       0,     0,     0,     0,   159,     0,   143,   145,   146,   147,
+     148,   149,   150,   151,   140,     0,     0,     0,     0,     0,
+       0,     0,     0,   142,     0,   154,   155,   156,   157,   158,
+       0,   144,   153,   160
   };
 
-  const signed char
+  const short
   AgentParser::yypgoto_[] =
   {
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -20,    44,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -26,   -68,
-     -68,   -68,    93,   -68,   -68,    52,    90,   -68,   -68,   -68,
-     -25,   -68,   -24,   -68,   -68,   -68,   -68,   -68,    28,   -68,
-     -68,    10,   -68,   -68,   -68,   -68,   -68,   -68,   -68,    33,
-     -68,   -68,   -68,   -68,   -68,   -68,   -59,   -13,   -68,   -68,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,
-     -68,   -68,    43,   -68,   -68,   -68,    -8,   -68,   -68,   -37,
-     -68,   -68,   -68,   -68,   -68,   -68,   -68,   -68,   -53,   -68,
-     -68,   -67,   -68,   -68,   -68,   -68,   -68
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,   -20,    81,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,   -26,  -142,
+    -142,  -142,   103,  -142,  -142,    72,   101,  -142,  -142,  -142,
+     -25,  -142,   -24,  -142,  -142,  -142,  -142,  -142,    36,  -142,
+    -142,    16,  -142,  -142,  -142,  -142,  -142,  -142,  -142,    42,
+    -142,  -142,  -142,  -142,  -142,  -142,  -141,    -3,  -142,  -142,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+    -142,  -142,    48,  -142,  -142,  -142,    -1,  -142,  -142,   -32,
+    -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,  -142,
+     -50,  -142,  -142,   -75,  -142,  -142,  -142,  -142,  -142,  -142,
+    -142,  -142,  -142
   };
 
   const short
   AgentParser::yydefgoto_[] =
   {
-      -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
+       0,     4,     5,     6,     7,    23,    27,    16,    17,    18,
       25,   108,    32,    33,    19,    24,    29,    30,   170,    21,
       26,    41,    42,    43,    68,    55,    56,    57,    76,    58,
      171,    78,   172,    79,    61,    81,   128,   129,   130,   140,
      152,   153,   154,   161,   155,   162,    62,   110,   122,   123,
      124,   135,   125,   136,   126,   137,   173,   174,   175,   185,
-     176,   186,   218,    44,    70,    45,    71,    46,    72,    47,
-      69,   115,   116,   117,   132,   166,   167,   182,   200,   201,
-     202,   210,   203,   204,   213,   205,   211,   228,   229,   230,
-     237,   238,   239,   244,   240,   241,   242
+     176,   186,   221,    44,    70,    45,    71,    46,    72,    47,
+      69,   115,   116,   117,   132,   166,   167,   182,   201,   202,
+     203,   212,   204,   205,   216,   206,   215,   207,   213,   233,
+     234,   235,   245,   246,   247,   255,   248,   249,   250,   251,
+     252,   253,   261
   };
 
-  const unsigned char
+  const short
   AgentParser::yytable_[] =
   {
-      40,    54,    59,    60,    28,    34,     8,    48,    49,    50,
-      51,    52,    31,     9,    74,    10,    20,    11,    53,    75,
-      35,   118,   119,   120,    82,    50,    51,    50,    51,    83,
-      36,    37,    38,   168,   169,   183,    39,    39,   184,   193,
-     194,    22,   195,   196,    84,    85,    39,    63,    40,    12,
-      13,    14,    15,    39,    64,    39,    54,    59,    60,   233,
-     149,   150,   234,   235,   236,   149,   150,    82,   133,   103,
-     104,   105,   131,   134,   138,    54,    59,    60,    39,   139,
-     112,   163,   187,   187,   121,   187,   164,   188,   189,   214,
-     190,   248,   231,    66,   215,   232,   249,     1,     2,     3,
-     177,   178,    65,    67,    86,    73,    77,    80,    87,    88,
-      89,    90,   121,    91,   151,    93,    94,    95,    96,    97,
-      98,   100,   101,   114,   106,   102,    10,   111,   109,   142,
-     127,   141,   143,   145,   146,   147,   191,   157,   221,   107,
-     158,   159,   160,   165,   179,   180,   207,   208,   212,   216,
-     219,   220,   222,   113,   225,   245,   197,   198,   199,   217,
-     192,   224,   226,   227,   246,   247,   250,    92,   251,   252,
-     156,   148,    99,   181,   209,   206,   144,   223,   243,   253,
-     255,   254,     0,     0,     0,     0,     0,     0,   197,   198,
-     199
+      40,    54,    59,    60,    28,    34,   149,   150,     8,     9,
+      20,    10,    74,    11,   118,   119,   120,    75,   177,   178,
+      35,    48,    49,    50,    51,    52,    82,   183,    39,    22,
+     184,    83,    53,    82,    36,    37,    38,   133,   131,    31,
+      39,    63,   134,    39,    84,    85,    50,    51,    40,    12,
+      13,    14,    15,    64,   138,    39,    54,    59,    60,   139,
+     193,   194,    65,   195,   196,   197,    50,    51,    66,   103,
+     104,   105,   168,   169,   163,    54,    59,    60,    39,   164,
+     112,   238,   149,   150,   121,   239,   240,   241,   242,   243,
+     244,   187,   187,    67,   187,   217,   188,   189,    39,   190,
+     218,   262,   236,    94,    73,   237,   263,     1,     2,     3,
+      77,    80,   121,    86,   151,    87,    88,    89,    90,    91,
+      93,    95,    96,   106,    98,   100,    97,   109,   114,   101,
+     102,    10,   111,   127,   141,   142,   157,   143,   145,   146,
+     147,   191,   219,   265,   158,   159,   160,   165,   179,   180,
+     209,   210,   214,   222,   223,   224,   198,   199,   200,   225,
+     192,   226,   220,   229,   256,   257,   232,   258,   259,   260,
+     228,   264,   270,   113,   230,   231,   107,    92,   156,   181,
+     148,   144,   208,    99,   211,   227,   254,   271,   266,   267,
+       0,   198,   199,   200,     0,     0,     0,     0,   269,   268,
+       0,   272,     0,     0,     0,     0,     0,   273
   };
 
   const short
   AgentParser::yycheck_[] =
   {
-      26,    27,    27,    27,    24,    10,     0,    11,    12,    13,
-      14,    15,    41,     5,     3,     7,     7,     9,    22,     8,
-      25,    16,    17,    18,     3,    13,    14,    13,    14,     8,
-      35,    36,    37,    19,    20,     3,    41,    41,     6,    27,
-      28,     7,    30,    31,    64,    65,    41,     6,    74,    41,
-      42,    43,    44,    41,     3,    41,    82,    82,    82,    29,
-      23,    24,    32,    33,    34,    23,    24,     3,     3,    89,
-      90,    91,     8,     8,     3,   101,   101,   101,    41,     8,
-     100,     3,     3,     3,   110,     3,     8,     8,     8,     3,
-       8,     3,     3,     8,     8,     6,     8,    38,    39,    40,
-     159,   160,     4,     3,    41,     4,     4,     4,     4,     4,
-       4,     4,   138,     4,   140,     4,    42,     4,     4,     7,
-       4,     4,     7,    26,    41,     7,     7,     5,    41,     3,
-       7,     6,     4,     4,     4,     4,    41,     5,    42,    95,
-       7,     7,     7,     7,     4,     4,     4,     4,     4,    41,
-       4,     4,     4,   101,     5,     4,   182,   182,   182,    21,
-     180,    41,    41,     7,     4,     4,     4,    74,    44,    42,
-     142,   138,    82,   163,   187,   183,   133,   214,   231,    42,
-      41,   248,    -1,    -1,    -1,    -1,    -1,    -1,   214,   214,
-     214
+      26,    27,    27,    27,    24,    10,    23,    24,     0,     5,
+       7,     7,     3,     9,    16,    17,    18,     8,   159,   160,
+      25,    11,    12,    13,    14,    15,     3,     3,    45,     7,
+       6,     8,    22,     3,    39,    40,    41,     3,     8,    45,
+      45,     6,     8,    45,    64,    65,    13,    14,    74,    45,
+      46,    47,    48,     3,     3,    45,    82,    82,    82,     8,
+      27,    28,     4,    30,    31,    32,    13,    14,     8,    89,
+      90,    91,    19,    20,     3,   101,   101,   101,    45,     8,
+     100,    29,    23,    24,   110,    33,    34,    35,    36,    37,
+      38,     3,     3,     3,     3,     3,     8,     8,    45,     8,
+       8,     3,     3,    46,     4,     6,     8,    42,    43,    44,
+       4,     4,   138,    45,   140,     4,     4,     4,     4,     4,
+       4,     4,     4,    45,     4,     4,     7,    45,    26,     7,
+       7,     7,     5,     7,     6,     3,     5,     4,     4,     4,
+       4,    45,    45,    48,     7,     7,     7,     7,     4,     4,
+       4,     4,     4,     4,     4,    46,   182,   182,   182,     4,
+     180,     4,    21,     5,     4,     4,     7,     4,     4,     4,
+      45,     4,     4,   101,    45,    45,    95,    74,   142,   163,
+     138,   133,   183,    82,   187,   217,   236,   262,    46,    46,
+      -1,   217,   217,   217,    -1,    -1,    -1,    -1,    46,    48,
+      -1,    45,    -1,    -1,    -1,    -1,    -1,    45
   };
 
   const unsigned char
   AgentParser::yystos_[] =
   {
-       0,    38,    39,    40,    46,    47,    48,    49,     0,     5,
-       7,     9,    41,    42,    43,    44,    52,    53,    54,    59,
-       7,    64,     7,    50,    60,    55,    65,    51,    53,    61,
-      62,    41,    57,    58,    10,    25,    35,    36,    37,    41,
-      63,    66,    67,    68,   108,   110,   112,   114,    11,    12,
-      13,    14,    15,    22,    63,    70,    71,    72,    74,    75,
-      77,    79,    91,     6,     3,     4,     8,     3,    69,   115,
-     109,   111,   113,     4,     3,     8,    73,     4,    76,    78,
-       4,    80,     3,     8,    53,    53,    41,     4,     4,     4,
-       4,     4,    67,     4,    42,     4,     4,     7,     4,    71,
-       4,     7,     7,    53,    53,    53,    41,    54,    56,    41,
-      92,     5,    53,    70,    26,   116,   117,   118,    16,    17,
-      18,    63,    93,    94,    95,    97,    99,     7,    81,    82,
-      83,     8,   119,     3,     8,    96,    98,   100,     3,     8,
-      84,     6,     3,     4,   117,     4,     4,     4,    94,    23,
-      24,    63,    85,    86,    87,    89,    83,     5,     7,     7,
-       7,    88,    90,     3,     8,     7,   120,   121,    19,    20,
-      63,    75,    77,   101,   102,   103,   105,   101,   101,     4,
-       4,    86,   122,     3,     6,   104,   106,     3,     8,     8,
-       8,    41,    53,    27,    28,    30,    31,    63,    75,    77,
-     123,   124,   125,   127,   128,   130,   121,     4,     4,   102,
-     126,   131,     4,   129,     3,     8,    41,    21,   107,     4,
-       4,    42,     4,   124,    41,     5,    41,     7,   132,   133,
-     134,     3,     6,    29,    32,    33,    34,   135,   136,   137,
-     139,   140,   141,   133,   138,     4,     4,     4,     3,     8,
-       4,    44,    42,    42,   136,    41
+       0,    42,    43,    44,    50,    51,    52,    53,     0,     5,
+       7,     9,    45,    46,    47,    48,    56,    57,    58,    63,
+       7,    68,     7,    54,    64,    59,    69,    55,    57,    65,
+      66,    45,    61,    62,    10,    25,    39,    40,    41,    45,
+      67,    70,    71,    72,   112,   114,   116,   118,    11,    12,
+      13,    14,    15,    22,    67,    74,    75,    76,    78,    79,
+      81,    83,    95,     6,     3,     4,     8,     3,    73,   119,
+     113,   115,   117,     4,     3,     8,    77,     4,    80,    82,
+       4,    84,     3,     8,    57,    57,    45,     4,     4,     4,
+       4,     4,    71,     4,    46,     4,     4,     7,     4,    75,
+       4,     7,     7,    57,    57,    57,    45,    58,    60,    45,
+      96,     5,    57,    74,    26,   120,   121,   122,    16,    17,
+      18,    67,    97,    98,    99,   101,   103,     7,    85,    86,
+      87,     8,   123,     3,     8,   100,   102,   104,     3,     8,
+      88,     6,     3,     4,   121,     4,     4,     4,    98,    23,
+      24,    67,    89,    90,    91,    93,    87,     5,     7,     7,
+       7,    92,    94,     3,     8,     7,   124,   125,    19,    20,
+      67,    79,    81,   105,   106,   107,   109,   105,   105,     4,
+       4,    90,   126,     3,     6,   108,   110,     3,     8,     8,
+       8,    45,    57,    27,    28,    30,    31,    32,    67,    79,
+      81,   127,   128,   129,   131,   132,   134,   136,   125,     4,
+       4,   106,   130,   137,     4,   135,   133,     3,     8,    45,
+      21,   111,     4,     4,    46,     4,     4,   128,    45,     5,
+      45,    45,     7,   138,   139,   140,     3,     6,    29,    33,
+      34,    35,    36,    37,    38,   141,   142,   143,   145,   146,
+     147,   148,   149,   150,   139,   144,     4,     4,     4,     4,
+       4,   151,     3,     8,     4,    48,    46,    46,    48,    46,
+       4,   142,    45,    45
   };
 
   const unsigned char
   AgentParser::yyr1_[] =
   {
-       0,    45,    47,    46,    48,    46,    49,    46,    51,    50,
-      52,    53,    53,    53,    53,    53,    53,    53,    55,    54,
-      56,    57,    57,    58,    58,    60,    59,    61,    61,    62,
-      62,    63,    65,    64,    66,    66,    67,    67,    67,    67,
-      67,    67,    69,    68,    70,    70,    71,    71,    71,    71,
-      71,    71,    71,    73,    72,    74,    76,    75,    78,    77,
-      80,    79,    81,    81,    82,    82,    84,    83,    85,    85,
-      85,    86,    86,    88,    87,    90,    89,    92,    91,    93,
-      93,    94,    94,    94,    94,    96,    95,    98,    97,   100,
-      99,   101,   101,   102,   102,   102,   102,   102,   104,   103,
-     106,   105,   107,   109,   108,   111,   110,   113,   112,   115,
-     114,   116,   116,   117,   119,   118,   120,   120,   122,   121,
-     123,   123,   124,   124,   124,   124,   124,   124,   124,   126,
-     125,   127,   129,   128,   131,   130,   132,   132,   134,   133,
-     135,   135,   136,   136,   136,   136,   138,   137,   139,   140,
-     141
+       0,    49,    51,    50,    52,    50,    53,    50,    55,    54,
+      56,    57,    57,    57,    57,    57,    57,    57,    59,    58,
+      60,    61,    61,    62,    62,    64,    63,    65,    65,    66,
+      66,    67,    69,    68,    70,    70,    71,    71,    71,    71,
+      71,    71,    73,    72,    74,    74,    75,    75,    75,    75,
+      75,    75,    75,    77,    76,    78,    80,    79,    82,    81,
+      84,    83,    85,    85,    86,    86,    88,    87,    89,    89,
+      89,    90,    90,    92,    91,    94,    93,    96,    95,    97,
+      97,    98,    98,    98,    98,   100,    99,   102,   101,   104,
+     103,   105,   105,   106,   106,   106,   106,   106,   108,   107,
+     110,   109,   111,   113,   112,   115,   114,   117,   116,   119,
+     118,   120,   120,   121,   123,   122,   124,   124,   126,   125,
+     127,   127,   128,   128,   128,   128,   128,   128,   128,   128,
+     130,   129,   131,   133,   132,   135,   134,   137,   136,   138,
+     138,   140,   139,   141,   141,   142,   142,   142,   142,   142,
+     142,   142,   144,   143,   145,   146,   147,   148,   149,   151,
+     150
   };
 
-  const unsigned char
+  const signed char
   AgentParser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     4,
@@ -1904,28 +2075,30 @@ namespace isc { namespace agent {
        6,     1,     3,     1,     1,     1,     1,     1,     0,     4,
        0,     4,     1,     0,     4,     0,     4,     0,     4,     0,
        6,     1,     3,     1,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     3,     3,
-       3
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     3,     0,     4,     0,     4,     0,     6,     1,
+       3,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     3,     3,     3,     3,     3,     0,
+       4
   };
 
 
-
+#if AGENT_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const AgentParser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Control-agent\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Control-agent\"",
   "\"http-host\"", "\"http-port\"", "\"user-context\"", "\"comment\"",
   "\"control-sockets\"", "\"dhcp4\"", "\"dhcp6\"", "\"d2\"",
   "\"socket-name\"", "\"socket-type\"", "\"unix\"", "\"hooks-libraries\"",
   "\"library\"", "\"parameters\"", "\"Logging\"", "\"loggers\"",
   "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp4\"",
-  "\"Dhcp6\"", "\"DhcpDdns\"", "START_JSON", "START_AGENT",
+  "\"rate-limit\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
+  "\"maxver\"", "\"async\"", "\"queue-size\"", "\"overflow-policy\"",
+  "\"Dhcp4\"", "\"Dhcp6\"", "\"DhcpDdns\"", "START_JSON", "START_AGENT",
   "START_SUB_AGENT", "\"constant string\"", "\"integer\"",
   "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
   "$@3", "sub_agent", "$@4", "json", "value", "map", "$@5", "map_value",
@@ -1945,51 +2118,53 @@ namespace isc { namespace agent {
   "logging_object", "$@25", "logging_params", "logging_param", "loggers",
   "$@26", "loggers_entries", "logger_entry", "$@27", "logger_params",
   "logger_param", "name", "$@28", "debuglevel", "severity", "$@29",
-  "output_options_list", "$@30", "output_options_list_content",
-  "output_entry", "$@31", "output_params_list", "output_params", "output",
-  "$@32", "flush", "maxsize", "maxver", YY_NULLPTR
+  "rate_limit", "$@30", "output_options_list", "$@31",
+  "output_options_list_content", "output_entry", "$@32",
+  "output_params_list", "output_params", "output", "$@33", "flush",
+  "maxsize", "maxver", "async", "queue_size", "overflow_policy", "$@34", YY_NULLPTR
   };
+#endif
+
 
 #if AGENT_DEBUG
-  const unsigned short
+  const short
   AgentParser::yyrline_[] =
   {
-       0,   114,   114,   114,   115,   115,   116,   116,   124,   124,
-     135,   141,   142,   143,   144,   145,   146,   147,   151,   151,
-     162,   167,   168,   176,   180,   187,   187,   193,   194,   197,
-     201,   214,   223,   223,   235,   236,   240,   241,   242,   243,
-     244,   245,   249,   249,   266,   267,   272,   273,   274,   275,
-     276,   277,   278,   281,   281,   289,   294,   294,   319,   319,
-     347,   347,   357,   358,   361,   362,   365,   365,   373,   374,
-     375,   378,   379,   382,   382,   390,   390,   400,   400,   413,
-     414,   419,   420,   421,   422,   426,   426,   437,   437,   448,
-     448,   459,   460,   464,   465,   466,   467,   468,   472,   472,
-     481,   481,   489,   495,   495,   502,   502,   509,   509,   521,
-     521,   534,   535,   539,   543,   543,   555,   556,   560,   560,
-     568,   569,   572,   573,   574,   575,   576,   577,   578,   581,
-     581,   589,   594,   594,   602,   602,   612,   613,   616,   616,
-     624,   625,   628,   629,   630,   631,   634,   634,   642,   647,
-     652
+       0,   118,   118,   118,   119,   119,   120,   120,   128,   128,
+     139,   145,   146,   147,   148,   149,   150,   151,   155,   155,
+     166,   171,   172,   180,   184,   191,   191,   197,   198,   201,
+     205,   218,   227,   227,   239,   240,   244,   245,   246,   247,
+     248,   249,   253,   253,   270,   271,   276,   277,   278,   279,
+     280,   281,   282,   285,   285,   293,   298,   298,   323,   323,
+     351,   351,   361,   362,   365,   366,   369,   369,   377,   378,
+     379,   382,   383,   386,   386,   394,   394,   404,   404,   417,
+     418,   423,   424,   425,   426,   430,   430,   441,   441,   452,
+     452,   463,   464,   468,   469,   470,   471,   472,   476,   476,
+     485,   485,   493,   499,   499,   506,   506,   513,   513,   525,
+     525,   538,   539,   543,   547,   547,   559,   560,   564,   564,
+     572,   573,   576,   577,   578,   579,   580,   581,   582,   583,
+     586,   586,   594,   599,   599,   607,   607,   615,   615,   625,
+     626,   629,   629,   637,   638,   641,   642,   643,   644,   645,
+     646,   647,   650,   650,   658,   663,   668,   673,   678,   683,
+     683
   };
 
-  // Print the state stack on the debug stream.
   void
-  AgentParser::yystack_print_ ()
+  AgentParser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  AgentParser::yy_reduce_print_ (int yyrule)
+  AgentParser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2002,10 +2177,11 @@ namespace isc { namespace agent {
 #endif // AGENT_DEBUG
 
 
-#line 14 "agent_parser.yy" // lalr1.cc:1218
+#line 14 "agent_parser.yy"
 } } // isc::agent
-#line 2008 "agent_parser.cc" // lalr1.cc:1218
-#line 657 "agent_parser.yy" // lalr1.cc:1219
+#line 2183 "agent_parser.cc"
+
+#line 691 "agent_parser.yy"
 
 
 void
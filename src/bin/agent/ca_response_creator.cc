@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,21 +8,126 @@
 
 #include <agent/ca_command_mgr.h>
 #include <agent/ca_response_creator.h>
+#include <cc/command_interpreter.h>
 #include <cc/data.h>
 #include <http/post_request_json.h>
 #include <http/response_json.h>
+#include <boost/algorithm/string.hpp>
 #include <boost/pointer_cast.hpp>
+#include <cctype>
 #include <iostream>
+#include <vector>
 
+using namespace isc::config;
 using namespace isc::data;
 using namespace isc::http;
 
+namespace {
+
+/// @brief Decodes a query parameter name or value.
+///
+/// @param text Percent-encoded text.
+/// @return Decoded text. Invalid escapes are left as they are.
+std::string
+decodeQueryText(const std::string& text) {
+    std::string decoded;
+    decoded.reserve(text.size());
+    for (size_t i = 0; i < text.size(); ++i) {
+        if (text[i] == '+') {
+            decoded.push_back(' ');
+        } else if ((text[i] == '%') && (i + 2 < text.size()) &&
+                   isxdigit(static_cast<unsigned char>(text[i + 1])) &&
+                   isxdigit(static_cast<unsigned char>(text[i + 2]))) {
+            decoded.push_back(static_cast<char>(
+                std::stoi(text.substr(i + 1, 2), 0, 16)));
+            i += 2;
+        } else {
+            decoded.push_back(text[i]);
+        }
+    }
+    return (decoded);
+}
+
+/// @brief Returns the HTTP version of the response to a request.
+///
+/// @param request Pointer to an object representing HTTP request.
+/// @return Version of the request if it is 1.0 or 1.1, 1.0 otherwise.
+HttpVersion
+getResponseVersion(const ConstHttpRequestPtr& request) {
+    // The request may not have been finalized so the request object
+    // doesn't contain any information about the HTTP version number
+    // used. But, the context should have this data (assuming the
+    // HTTP version is parsed ok).
+    HttpVersion http_version(request->context()->http_version_major_,
+                             request->context()->http_version_minor_);
+    // We only accept HTTP version 1.0 or 1.1. If other version number is found
+    // we fall back to HTTP/1.0.
+    if ((http_version < HttpVersion(1, 0)) || (HttpVersion(1, 1) < http_version)) {
+        http_version.major_ = 1;
+        http_version.minor_ = 0;
+    }
+    return (http_version);
+}
+
+}
+
 namespace isc {
 namespace agent {
 
+CtrlAgentHttpRequest::CtrlAgentHttpRequest()
+    : PostHttpRequestJson() {
+    requireHttpMethod(Method::HTTP_GET);
+    // The body and its headers are checked in create() as they are
+    // required only for POST.
+    required_headers_.erase("content-length");
+    required_headers_.erase("content-type");
+}
+
+void
+CtrlAgentHttpRequest::create() {
+    PostHttpRequestJson::create();
+
+    if (method_ != Method::HTTP_POST) {
+        return;
+    }
+    try {
+        if (headers_.find("content-length") == headers_.end()) {
+            isc_throw(BadValue, "required header content-length not found"
+                      " in the HTTP request");
+        }
+        auto content_type = headers_.find("content-type");
+        if (content_type == headers_.end()) {
+            isc_throw(BadValue, "required header content-type not found"
+                      " in the HTTP request");
+        }
+        if (!content_type->second->isValueEqual("application/json")) {
+            isc_throw(BadValue, "required header's content-type value is"
+                      " application/json, but "
+                      << content_type->second->getValue() << " was found");
+        }
+    } catch (const std::exception& ex) {
+        reset();
+        isc_throw(HttpRequestError, ex.what());
+    }
+}
+
+void
+CtrlAgentHttpRequest::finalize() {
+    if (!created_) {
+        create();
+    }
+
+    if (method_ == Method::HTTP_GET) {
+        // There is no JSON body to parse.
+        finalized_ = true;
+        return;
+    }
+    PostHttpRequestJson::finalize();
+}
+
 HttpRequestPtr
 CtrlAgentResponseCreator::createNewHttpRequest() const {
-    return (HttpRequestPtr(new PostHttpRequestJson()));
+    return (HttpRequestPtr(new CtrlAgentHttpRequest()));
 }
 
 HttpResponsePtr
@@ -38,20 +143,9 @@ HttpResponsePtr
 CtrlAgentResponseCreator::
 createStockHttpResponseInternal(const ConstHttpRequestPtr& request,
                                 const HttpStatusCode& status_code) const {
-    // The request hasn't been finalized so the request object
-    // doesn't contain any information about the HTTP version number
-    // used. But, the context should have this data (assuming the
-    // HTTP version is parsed ok).
-    HttpVersion http_version(request->context()->http_version_major_,
-                             request->context()->http_version_minor_);
-    // We only accept HTTP version 1.0 or 1.1. If other version number is found
-    // we fall back to HTTP/1.0.
-    if ((http_version < HttpVersion(1, 0)) || (HttpVersion(1, 1) < http_version)) {
-        http_version.major_ = 1;
-        http_version.minor_ = 0;
-    }
     // This will generate the response holding JSON content.
-    HttpResponsePtr response(new HttpResponseJson(http_version, status_code));
+    HttpResponsePtr response(new HttpResponseJson(getResponseVersion(request),
+                                                  status_code));
     return (response);
 }
 
@@ -71,6 +165,11 @@ createDynamicHttpResponse(const ConstHttpRequestPtr& request) {
         return (createStockHttpResponse(request, HttpStatusCode::INTERNAL_SERVER_ERROR));
     }
 
+    // The statistics are requested with GET.
+    if (request->getMethod() == HttpRequest::Method::HTTP_GET) {
+        return (createMetricsHttpResponse(request));
+    }
+
     // We have already checked that the request is finalized so the call
     // to getBodyAsJson must not trigger an exception.
     ConstElementPtr command = request_json->getBodyAsJson();
@@ -92,7 +191,77 @@ createDynamicHttpResponse(const ConstHttpRequestPtr& request) {
     return (http_response);
 }
 
+HttpResponsePtr
+CtrlAgentResponseCreator::
+createMetricsHttpResponse(const ConstHttpRequestPtr& request) const {
+    // Split the URI into the path and the query.
+    const std::string uri = request->getUri();
+    const size_t question = uri.find('?');
+    if (uri.substr(0, question) != "/metrics") {
+        return (createStockHttpResponse(request, HttpStatusCode::NOT_FOUND));
+    }
+
+    std::string service;
+    ElementPtr arguments = Element::createMap();
+    if (question != std::string::npos) {
+        std::vector<std::string> params;
+        const std::string query = uri.substr(question + 1);
+        boost::split(params, query, boost::is_any_of("&"));
+        for (auto param = params.begin(); param != params.end(); ++param) {
+            const size_t equal = param->find('=');
+            const std::string name = decodeQueryText(param->substr(0, equal));
+            const std::string value = (equal == std::string::npos ? "" :
+                decodeQueryText(param->substr(equal + 1)));
+            if (name == "service") {
+                service = value;
+            } else if (name == "prefix") {
+                arguments->set("prefix", Element::create(value));
+            }
+        }
+    }
+    if (service.empty()) {
+        return (createStockHttpResponse(request, HttpStatusCode::BAD_REQUEST));
+    }
+
+    // Forward the statistic-export command to the server.
+    ConstElementPtr answers = CtrlAgentCommandMgr::instance().
+        processCommand(createCommand("statistic-export", arguments, service));
+    if (!answers || (answers->getType() != Element::list) ||
+        answers->empty()) {
+        return (createStockHttpResponse(request,
+                                        HttpStatusCode::INTERNAL_SERVER_ERROR));
+    }
 
+    // The server is not available or doesn't support the command.
+    int rcode = CONTROL_RESULT_ERROR;
+    ConstElementPtr args;
+    try {
+        args = parseAnswer(rcode, answers->get(0));
+    } catch (const std::exception&) {
+        return (createStockHttpResponse(request,
+                                        HttpStatusCode::INTERNAL_SERVER_ERROR));
+    }
+    if (rcode != CONTROL_RESULT_SUCCESS) {
+        return (createStockHttpResponse(request,
+                                        HttpStatusCode::SERVICE_UNAVAILABLE));
+    }
+    ConstElementPtr text = (args && (args->getType() == Element::map) ?
+                            args->get("prometheus") : ConstElementPtr());
+    if (!text || (text->getType() != Element::string)) {
+        return (createStockHttpResponse(request,
+                                        HttpStatusCode::INTERNAL_SERVER_ERROR));
+    }
+
+    // The exposition text is passed through as the body, with the content
+    // type expected by Prometheus.
+    HttpResponsePtr response(new HttpResponse(getResponseVersion(request),
+                                              HttpStatusCode::OK));
+    response->context()->headers_.push_back(
+        HttpHeaderContext("Content-Type", "text/plain; version=0.0.4"));
+    response->context()->body_ = text->stringValue();
+    response->finalize();
+    return (response);
+}
 
 } // end of namespace isc::agent
 } // end of namespace isc
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,12 +8,43 @@
 #define CTRL_AGENT_RESPONSE_CREATOR_H
 
 #include <agent/ca_command_mgr.h>
+#include <http/post_request_json.h>
 #include <http/response_creator.h>
 #include <boost/shared_ptr.hpp>
+#include <string>
 
 namespace isc {
 namespace agent {
 
+/// @brief HTTP request received by the Control Agent.
+///
+/// The commands are sent in the body of POST requests in JSON format.
+/// The Control Agent also accepts GET requests, which have no body, for
+/// the statistics to be scraped by Prometheus (see
+/// @ref CtrlAgentResponseCreator). The Content-Length and Content-Type
+/// headers are thus required for the POST requests only.
+class CtrlAgentHttpRequest : public http::PostHttpRequestJson {
+public:
+
+    /// @brief Constructor for inbound HTTP request.
+    CtrlAgentHttpRequest();
+
+    /// @brief Commits information held in the context into the request.
+    ///
+    /// In addition to the checks made by @ref isc::http::HttpRequest::create
+    /// it verifies that a POST request holds JSON content.
+    ///
+    /// @throw HttpRequestError if the parsed request doesn't meet the
+    /// specified requirements for it.
+    virtual void create();
+
+    /// @brief Completes parsing of the HTTP request.
+    ///
+    /// The body of a POST request is parsed as JSON, the body of a GET
+    /// request is ignored.
+    virtual void finalize();
+};
+
 class CtrlAgentResponseCreator;
 
 /// @brief Pointer to the @ref CtrlAgentResponseCreator.
@@ -27,22 +58,29 @@ typedef boost::shared_ptr<CtrlAgentResponseCreator> CtrlAgentResponseCreatorPtr;
 /// the libkea-http library to generate HTTP responses.
 ///
 /// This creator expects that received requests are encapsulated in the
-/// @ref isc::http::PostHttpRequestJson objects. The generated responses
-/// are encapsulated in the HttpResponseJson objects.
+/// @ref CtrlAgentHttpRequest objects. The generated responses are
+/// encapsulated in the HttpResponseJson objects.
 ///
 /// This class uses @ref CtrlAgentCommandMgr singleton to process commands
 /// conveyed in the HTTP body. The JSON responses returned by the manager
 /// are placed in the body of the generated HTTP responses.
+///
+/// A GET request for "/metrics?service=<server>" is converted to the
+/// statistic-export command forwarded to the server, an optional
+/// "prefix" query parameter being passed as the command argument. The
+/// statistics exported by the server are returned as the body of the
+/// HTTP response with the "text/plain; version=0.0.4" content type, as
+/// expected by Prometheus.
 class CtrlAgentResponseCreator : public http::HttpResponseCreator {
 public:
 
     /// @brief Create a new request.
     ///
     /// This method creates a bare instance of the @ref
-    /// isc::http::PostHttpRequestJson.
+    /// CtrlAgentHttpRequest.
     ///
     /// @return Pointer to the new instance of the @ref
-    /// isc::http::PostHttpRequestJson.
+    /// CtrlAgentHttpRequest.
     virtual http::HttpRequestPtr createNewHttpRequest() const;
 
     /// @brief Creates stock HTTP response.
@@ -77,6 +115,14 @@ private:
     /// @return Pointer to an object representing HTTP response.
     virtual http::HttpResponsePtr
     createDynamicHttpResponse(const http::ConstHttpRequestPtr& request);
+
+    /// @brief Creates the response to a request for the statistics.
+    ///
+    /// @param request Pointer to the GET request.
+    /// @return Pointer to the response holding the statistics in the
+    /// Prometheus text format, or to a stock response in case of error.
+    http::HttpResponsePtr
+    createMetricsHttpResponse(const http::ConstHttpRequestPtr& request) const;
 };
 
 } // end of namespace isc::agent
@@ -1,4 +1,4 @@
-// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <agent/ca_command_mgr.h>
 #include <agent/ca_controller.h>
 #include <agent/ca_process.h>
+#include <agent/ca_response_creator.h>
 #include <asiolink/asio_wrapper.h>
 #include <asiolink/interval_timer.h>
 #include <asiolink/io_service.h>
@@ -417,4 +418,52 @@ TEST_F(CtrlAgentCommandMgrTest, forwardListCommands) {
     checkAnswer(answer, 3);
 }
 
+/// Check that a GET request for the metrics is forwarded to the server as
+/// the statistic-export command and that the exported text is returned as
+/// the body of the HTTP response.
+TEST_F(CtrlAgentCommandMgrTest, forwardMetrics) {
+    configureControlSocket("dhcp4");
+    bindServerSocket("{ \"result\": 0, \"arguments\": { \"prometheus\":"
+                     " \"# TYPE kea_alpha untyped\\nkea_alpha 1\\n\" } }",
+                     true);
+    isc::util::thread::Thread th(boost::bind(&IOService::run, getIOService().get()));
+
+    // Wait for the IO service in thread to actually run.
+    server_socket_->waitForRunning();
+
+    CtrlAgentResponseCreator response_creator;
+    isc::http::HttpRequestPtr request = response_creator.createNewHttpRequest();
+    request->context()->method_ = "GET";
+    request->context()->http_version_major_ = 1;
+    request->context()->http_version_minor_ = 1;
+    request->context()->uri_ = "/metrics?service=dhcp4&prefix=subnet%5B1%5D.";
+    ASSERT_NO_THROW(request->finalize());
+    isc::http::HttpResponsePtr response =
+        response_creator.createHttpResponse(request);
+
+    // Stop IO service immediatelly and let the thread die.
+    getIOService()->stop();
+
+    // Wait for the thread to finish.
+    th.wait();
+
+    // Cancel all asynchronous operations on the server.
+    server_socket_->stopServer();
+
+    // We have some cancelled operations for which we need to invoke the
+    // handlers with the operation_aborted error code.
+    getIOService()->get_io_service().reset();
+    getIOService()->poll();
+
+    EXPECT_EQ(1, server_socket_->getResponseNum());
+    ASSERT_TRUE(response);
+    const std::string text = response->toString();
+    EXPECT_EQ(0, text.find("HTTP/1.1 200 OK\r\n")) << text;
+    EXPECT_NE(std::string::npos,
+              text.find("Content-Type: text/plain; version=0.0.4\r\n")) << text;
+    EXPECT_NE(std::string::npos,
+              text.find("\r\n\r\n# TYPE kea_alpha untyped\nkea_alpha 1\n"))
+        << text;
+}
+
 }
@@ -1,4 +1,4 @@
-// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -77,6 +77,34 @@ public:
         request->context()->headers_.push_back(content_length);
     }
 
+    /// @brief Fills request context with the data of a GET request.
+    ///
+    /// @param request Request which context should be configured.
+    /// @param uri URI of the request.
+    void setGetContext(const HttpRequestPtr& request, const std::string& uri) {
+        request->context()->method_ = "GET";
+        request->context()->http_version_major_ = 1;
+        request->context()->http_version_minor_ = 1;
+        request->context()->uri_ = uri;
+    }
+
+    /// @brief Test response to a GET request.
+    ///
+    /// @param uri URI of the request.
+    /// @param must_contain Text that must be present in the textual
+    /// representation of the generated response.
+    void testGetResponse(const std::string& uri,
+                         const std::string& must_contain) {
+        setGetContext(request_, uri);
+        ASSERT_NO_THROW(request_->finalize());
+
+        HttpResponsePtr response;
+        ASSERT_NO_THROW(response = response_creator_.createHttpResponse(request_));
+        ASSERT_TRUE(response);
+        EXPECT_TRUE(response->toString().find(must_contain) != std::string::npos)
+            << response->toString();
+    }
+
     /// @brief Test creation of stock response.
     ///
     /// @param status_code Status code to be included in the response.
@@ -130,6 +158,36 @@ TEST_F(CtrlAgentResponseCreatorTest, createNewHttpRequest) {
     ASSERT_TRUE(request_json);
 }
 
+// This test verifies that the request requires the JSON body for POST only.
+TEST_F(CtrlAgentResponseCreatorTest, createNewHttpRequestGet) {
+    ASSERT_TRUE(boost::dynamic_pointer_cast<CtrlAgentHttpRequest>(request_));
+
+    // GET has no body.
+    setGetContext(request_, "/metrics");
+    EXPECT_NO_THROW(request_->finalize());
+
+    // POST without Content-Type is rejected.
+    HttpRequestPtr request = response_creator_.createNewHttpRequest();
+    request->context()->method_ = "POST";
+    request->context()->http_version_major_ = 1;
+    request->context()->http_version_minor_ = 1;
+    request->context()->uri_ = "/";
+    request->context()->headers_.push_back(HttpHeaderContext("Content-Length",
+                                                             "0"));
+    EXPECT_THROW(request->finalize(), HttpRequestError);
+
+    // POST with non JSON content is rejected.
+    request->context()->headers_.push_back(HttpHeaderContext("Content-Type",
+                                                             "text/plain"));
+    EXPECT_THROW(request->finalize(), HttpRequestError);
+
+    // Other methods are rejected.
+    request = response_creator_.createNewHttpRequest();
+    setGetContext(request, "/metrics");
+    request->context()->method_ = "PUT";
+    EXPECT_THROW(request->finalize(), HttpRequestError);
+}
+
 // Test that HTTP version of stock response is set to 1.0 if the request
 // context doesn't specify any version.
 TEST_F(CtrlAgentResponseCreatorTest, createStockHttpResponseNoVersion) {
@@ -206,4 +264,20 @@ TEST_F(CtrlAgentResponseCreatorTest, createDynamicHttpResponseInvalidType) {
 
 }
 
+// Test that GET is accepted for the metrics only.
+TEST_F(CtrlAgentResponseCreatorTest, createMetricsHttpResponseNotFound) {
+    testGetResponse("/foo?service=dhcp4", "HTTP/1.1 404 Not Found");
+}
+
+// Test that the service must be specified in the metrics query.
+TEST_F(CtrlAgentResponseCreatorTest, createMetricsHttpResponseNoService) {
+    testGetResponse("/metrics?prefix=subnet%5B1%5D.", "HTTP/1.1 400 Bad Request");
+}
+
+// Test that an unavailable server is reported as a service unavailable.
+TEST_F(CtrlAgentResponseCreatorTest, createMetricsHttpResponseUnavailable) {
+    testGetResponse("/metrics?service=dhcp4",
+                    "HTTP/1.1 503 Service Unavailable");
+}
+
 }
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 67
-#define YY_END_OF_BUFFER 68
+#define YY_NUM_RULES 71
+#define YY_END_OF_BUFFER 72
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,54 +700,59 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[417] =
+static const flex_int16_t yy_accept[463] =
     {   0,
-       60,   60,    0,    0,    0,    0,    0,    0,    0,    0,
-       68,   66,   10,   11,   66,    1,   60,   57,   60,   60,
-       66,   59,   58,   66,   66,   66,   66,   66,   53,   54,
-       66,   66,   66,   55,   56,    5,    5,    5,   66,   66,
-       66,   10,   11,    0,    0,   49,    0,    0,    0,    0,
+       64,   64,    0,    0,    0,    0,    0,    0,    0,    0,
+       72,    1,   70,   70,   70,   10,   11,   57,   58,   59,
+       60,   61,   62,   64,   63,   64,   64,   70,   70,   70,
+       70,   70,   70,   70,   70,    5,    5,    5,   70,   70,
+       70,    1,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-       60,   60,    0,   59,   60,    3,    2,    6,    0,   60,
-        0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
-        0,   50,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   53,    0,    3,
+        2,    6,   10,   11,   63,   64,    0,   64,   64,   64,
+        0,    0,    0,    0,    0,    0,    0,    4,    0,    0,
+        9,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-       52,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
-        0,   51,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   65,   63,
-        0,   62,   61,    0,    0,    0,    0,    0,    0,   19,
-       18,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   56,    0,    0,   54,    0,    0,
+        2,    0,    0,    0,    0,    0,    0,    0,    8,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   55,    0,    0,   65,
+       67,    0,    0,   66,   69,    0,    0,    0,    0,    0,
+       19,   18,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   64,   61,    0,
-        0,    0,    0,    0,    0,   20,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   43,    0,    0,    0,   14,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   46,   47,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   40,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    7,    0,    0,    0,    0,
+        0,    0,    0,   65,   68,    0,    0,    0,    0,    0,
+       20,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   46,    0,
+        0,    0,    0,   14,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   50,   51,    0,    0,
+        0,   43,    0,    0,    0,    0,    0,    0,   40,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        7,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   42,    0,    0,
+        0,   39,    0,    0,    0,    0,   32,    0,    0,    0,
+        0,    0,    0,    0,   36,    0,   22,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   37,   41,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   12,    0,    0,    0,    0,    0,    0,    0,   28,
+        0,   26,    0,    0,    0,    0,    0,    0,    0,   49,
+        0,    0,    0,    0,    0,   30,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   42,    0,    0,   39,    0,    0,   32,    0,
-
-        0,    0,    0,    0,    0,   36,    0,   22,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   37,   41,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   12,
-        0,    0,    0,    0,    0,    0,    0,   28,    0,   26,
-        0,    0,    0,    0,   45,    0,    0,    0,    0,    0,
-       30,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,    0,    0,   44,
-        0,    0,    0,    0,   13,   17,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   31,    0,   27,    0,    0,
-        0,    0,   35,   34,    0,    0,    0,   25,    0,   23,
-
-       16,    0,   24,   21,   48,    0,    0,    0,   33,    0,
-       38,    0,    0,    0,   15,    0
+
+        0,    0,   29,    0,    0,    0,    0,   47,    0,    0,
+        0,    0,   13,   17,    0,    0,    0,   44,   48,    0,
+        0,    0,    0,    0,    0,    0,   31,    0,   27,    0,
+        0,    0,    0,    0,   35,   34,    0,    0,    0,   25,
+        0,   23,   16,    0,    0,   24,   21,   52,    0,    0,
+        0,    0,   33,    0,   38,    0,    0,   45,    0,    0,
+       15,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -763,8 +768,8 @@ static const YY_CHAR yy_ec[256] =
         5,   32,   33,   34,   35,    5,    5,    5,    5,    5,
        36,   37,   38,    5,   39,    5,   40,   41,   42,   43,
 
-       44,   45,   46,   47,   48,   49,   50,   51,   52,   53,
-       54,   55,    5,   56,   57,   58,   59,   60,   61,   62,
+       44,   45,   46,   47,   48,   27,   49,   50,   51,   52,
+       53,   54,   55,   56,   57,   58,   59,   60,   61,   62,
        63,   64,   65,    5,   66,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -784,301 +789,427 @@ static const YY_CHAR yy_ec[256] =
 
 static const YY_CHAR yy_meta[67] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
-        5,    5,    5,    5,    5,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[428] =
+static const flex_int16_t yy_base[463] =
     {   0,
-        0,    0,   65,   68,   71,    0,   69,   73,   54,   70,
-      735,  736,   89,  731,  137,    0,  192,  736,  197,  200,
-       86,  212,  736,  713,   97,   74,   63,   69,  736,  736,
-       83,   68,   78,  736,  736,  736,  124,  719,  678,    0,
-      711,  128,  726,  212,  234,  736,  674,  680,  172,  672,
-      196,  196,  257,  674,  670,  187,  191,  669,  667,  677,
-      666,  679,   91,  659,  663,  672,  179,  209,  210,    0,
-      281,  289,  308,  314,  293,  736,    0,  736,  232,  257,
-      224,  227,  276,  292,  293,  277,  736,  673,  708,  736,
-      294,  736,  328,  660,  670,  297,  665,  301,  307,  704,
-
-        0,  374,  663,  207,  655,  666,  660,  648,  645,  647,
-      645,  690,  637,  653,  636,  645,  640,  637,  638,  633,
-      300,  650,  643,  646,    0,  307,  317,  255,  313,  320,
-      322,  638,  736,    0,  630,  632,  321,  640,  679,  678,
-      677,  736,  406,  628,  629,  622,  622,  619,  633,  665,
-      618,  613,  615,  632,  660,  624,  292,  625,  657,  612,
-      608,  621,  608,  619,  612,  615,  604,  328,  736,  736,
-      332,  736,  736,  600,    0,  602,  339,  651,  608,  736,
-      736,  438,  599,  610,  597,  641,  605,  593,  592,  601,
-      607,  593,  602,  591,  599,  594,  597,  634,  209,  580,
-
-      632,  581,  592,  579,  590,  622,  621,  736,  736,  588,
-        0,  576,  623,  622,  584,  736,  573,  470,  577,  571,
-      569,  579,  570,  562,  575,  612,  561,  576,  572,  574,
-      557,  548,  555,  736,  556,  553,  550,  736,  550,  548,
-      557,  546,  553,  560,  557,    0,  549,  736,  736,  546,
-      552,  539,  538,  544,  540,  549,  581,  535,  736,  547,
-      537,  532,  535,  529,  541,  578,  527,  528,  204,  537,
-      574,  521,  567,  533,  522,  736,  564,  517,  567,  525,
-      565,  559,  517,  508,  526,  506,  554,  520,  519,  518,
-      555,  554,  736,  507,  500,  736,  503,  545,  736,  492,
-
-      322,  491,  500,  512,  545,  736,  498,  736,  492,  502,
-      485,  479,  478,  466,  502,  450,  500,  736,  736,  465,
-      450,  448,  459,  495,  460,  436,  441,  439,  444,  736,
-      483,  434,  439,  426,  418,  419,  431,  736,  416,  736,
-      414,  429,  412,  426,  736,  416,  412,  460,  421,  414,
-      736,  415,  403,  449,  388,  348,  391,  437,  436,  387,
-      392,  386,  394,  393,  736,  374,  382,  384,  376,  736,
-      420,  367,  418,  366,  736,  736,  362,  358,  354,  404,
-      403,  350,  349,  362,  398,  736,  355,  736,  396,  395,
-      341,  387,  736,  736,  386,  385,  327,  736,  331,  736,
-
-      736,  325,  736,  736,  736,  373,  334,  371,  736,  313,
-      736,  302,  207,  244,  736,  736,  515,  520,  525,  530,
-      535,  540,  543,  216,  130,  115,   87
+       67,    0,  133,    0,  194,    0,  196,    0,  193,    0,
+      214,  260,  326,  208,  195,  220,  214,    0,    0,    0,
+        0,    0,    0,  381,    0,  211,  219,  234,  197,  197,
+      359,  180,  200,  188,    0,    0,    0,  238,  202,  419,
+      236,    0,  463,  203,  210,  365,  205,  377,  464,  351,
+      210,  359,  359,  346,  350,  361,  357,  373,  374,  433,
+      362,  358,  455,  456,  432,  437,  522,    0,  588,    0,
+      654,    0,    0,    0,    0,    0,    0,    0,    0,  493,
+        0,  686,  437,  694,  451,  696,  607,    0,  681,  719,
+        0,  674,  685,  698,  683,  699,  700,  686,  670,  683,
+
+      684,  696,  692,  682,  681,  685,  685,  732,  684,  702,
+      687,  699,  696,  697,  712,  701,  714,  701,  700,  719,
+      720,  715,  720,    0,    0,  779,  842,    0,  903,    0,
+        0,  885,  721,  878,  709,  884,  717,  718,    0,  711,
+      716,  884,  725,  766,  767,  721,  723,  725,  719,  721,
+      855,  871,  906,  861,  858,  862,  881,  911,  877,  867,
+      881,  915,  874,  874,  873,  873,  889,  893,  882,  895,
+      892,  896,  887,  942,    0,    0,    0,    0,  955,    0,
+        0,  928,  901,    0,    0,  887,  891,  936,  943,  902,
+        0,    0,  898,  931,  930,  919,  977,  943,  933,  934,
+
+      945,  953,  942,  958,  950,  959,  956,  961, 1000,  962,
+      949,  964, 1004,  967, 1001,  957,  970,  959,  973, 1007,
+     1008, 1006, 1019,    0,    0,  980,  971, 1019, 1020,  993,
+        0,  985,  990, 1033, 1000, 1000, 1011, 1005,  998, 1013,
+     1052, 1009, 1026, 1024, 1028, 1013, 1006, 1015,    0, 1019,
+     1017, 1016, 1025,    0, 1065, 1027, 1021, 1021, 1032, 1023,
+     1033, 1041, 1070, 1083, 1043, 1038,    0,    0, 1037, 1044,
+     1042,    0, 1043, 1052, 1050, 1072, 1106, 1062,    0, 1076,
+     1069, 1065, 1071, 1072, 1086, 1125, 1076, 1080, 1128, 1082,
+     1079, 1089, 1094, 1133, 1082, 1130, 1098, 1090,    0, 1130,
+
+        0, 1136, 1091, 1143, 1103, 1151, 1147, 1108, 1100, 1120,
+     1102, 1152, 1120, 1121, 1122, 1162, 1163,    0, 1125, 1119,
+     1125,    0, 1118, 1132, 1130, 1171,    0, 1120, 1132, 1122,
+     1134,    0, 1147, 1182,    0, 1138,    0, 1134, 1152, 1149,
+     1146, 1151, 1153, 1191, 1141, 1193,    0,    0, 1160, 1148,
+     1148, 1192, 1140, 1157, 1163, 1201, 1168, 1146, 1153, 1153,
+     1166,    0, 1207, 1161, 1167, 1166, 1159, 1162, 1176,    0,
+     1163,    0, 1163, 1180, 1165, 1170, 1181, 1168, 1184,    0,
+     1177, 1175, 1224, 1187, 1188,    0, 1191, 1182, 1229, 1179,
+     1226, 1186, 1233, 1234, 1188, 1194, 1190, 1238, 1239, 1194,
+
+     1203, 1204,    0, 1187, 1198, 1202, 1195,    0, 1247, 1196,
+     1249, 1199,    0,    0, 1207, 1205, 1209,    0,    0, 1203,
+     1255, 1256, 1205, 1206, 1221, 1260,    0, 1219,    0, 1262,
+     1263, 1218, 1223, 1266,    0,    0, 1267, 1268, 1217,    0,
+     1225,    0,    0, 1220, 1236,    0,    0,    0, 1273, 1236,
+     1275, 1219,    0, 1231,    0, 1279, 1227,    0, 1229, 1282,
+        0,    1
     } ;
 
-static const flex_int16_t yy_def[428] =
+static const flex_int16_t yy_def[463] =
     {   0,
-      416,    1,  417,  417,    1,    5,    5,    5,    5,    5,
-      416,  416,  416,  416,  416,  418,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  419,
-      416,  416,  416,  420,   15,  416,   45,   45,   45,   45,
-       45,   45,  421,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  418,
-      416,  416,  416,  416,  416,  416,  422,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  419,  416,
-      420,  416,  416,   45,   45,   45,   45,   45,   45,  423,
-
-       45,  421,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  422,  416,  416,  416,  416,  416,
-      416,  416,  416,  424,   45,   45,   45,   45,   45,   45,
-      423,  416,  421,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  416,  416,  416,
-      416,  416,  416,  416,  425,   45,   45,   45,   45,  416,
-      416,  421,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,  416,  416,  416,
-      426,   45,   45,   45,   45,  416,   45,  421,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,  416,   45,   45,   45,  416,   45,   45,
-       45,   45,   45,   45,  416,  427,   45,  416,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  416,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,  416,   45,   45,  416,   45,   45,  416,   45,
-
-       45,   45,   45,   45,   45,  416,   45,  416,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  416,  416,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  416,
-       45,   45,   45,   45,   45,   45,   45,  416,   45,  416,
-       45,   45,   45,   45,  416,   45,   45,   45,   45,   45,
-      416,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  416,   45,   45,   45,   45,  416,
-       45,   45,   45,   45,  416,  416,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,  416,   45,  416,   45,   45,
-       45,   45,  416,  416,   45,   45,   45,  416,   45,  416,
-
-      416,   45,  416,  416,  416,   45,   45,   45,  416,   45,
-      416,   45,   45,   45,  416,    0,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416
+      462,    1,  462,    3,    1,    5,    5,    7,    5,    9,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,   24,   24,   24,  462,  462,  462,
+      462,   29,   30,   31,  462,   16,  462,  462,  462,  462,
+      462,   12,   13,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   48,   49,  462,  462,  462,  462,
+      462,  462,   16,   17,   24,   27,   28,   26,   27,   28,
+       80,  462,   82,  462,   84,  462,   86,  462,  462,   40,
+      462,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,  462,  462,  462,  462,   69,
+       71,  462,  132,  462,  134,  462,  136,  462,  462,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,  126,  127,  127,  462,   69,  462,  462,
+      462,  462,  182,  462,  462,  462,   43,   43,   43,   43,
+      462,  462,   43,   43,   43,   43,   43,   43,   43,   43,
+
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,  126,  462,  462,  462,  462,   43,   43,   43,   43,
+      462,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,  462,   43,
+       43,   43,   43,  462,   43,   43,   43,   43,   43,   43,
+       43,   43,  126,  462,  462,   43,  462,  462,   43,   43,
+       43,  462,   43,   43,   43,   43,   43,   43,  462,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,  462,
+
+      462,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,  462,   43,   43,
+       43,  462,   43,   43,   43,   43,  462,   43,   43,   43,
+       43,   69,   43,   43,  462,   43,  462,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,  462,  462,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,  462,   43,   43,   43,   43,   43,   43,   43,  462,
+       43,  462,   43,   43,   43,   43,   43,   43,   43,  462,
+       43,   43,   43,   43,   43,  462,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+
+       43,   43,  462,   43,   43,   43,   43,  462,   43,   43,
+       43,   43,  462,  462,   43,   43,   43,  462,  462,   43,
+       43,   43,   43,   43,   43,   43,  462,   43,  462,   43,
+       43,   43,   43,   43,  462,  462,   43,   43,   43,  462,
+       43,  462,  462,   43,   43,  462,  462,  462,   43,   43,
+       43,   43,  462,   43,  462,   43,   43,  462,   43,   43,
+      462,    0
     } ;
 
-static const flex_int16_t yy_nxt[803] =
+static const flex_int16_t yy_nxt[1349] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
-       12,   12,   12,   12,   25,   26,   12,   12,   27,   12,
-       12,   12,   12,   28,   12,   29,   12,   30,   12,   12,
-       12,   12,   12,   25,   31,   12,   12,   12,   12,   12,
-       12,   12,   32,   12,   12,   12,   12,   33,   12,   12,
-       12,   12,   12,   12,   34,   35,   37,   14,   37,   37,
-       14,   37,   38,   41,   40,   38,   12,   12,   40,   12,
-       12,   12,   12,   12,   12,   12,   12,   12,   12,   41,
-       42,   91,   42,   76,   81,   12,   12,   82,   77,   12,
-
-       83,   12,   82,   81,   12,   79,   12,   79,   12,   83,
-       80,   80,   80,   81,   12,   12,   12,   12,   39,  246,
-       12,   82,   84,   12,   83,   42,   85,   42,   12,   42,
-      116,   42,  117,   86,  211,   12,   12,   44,   44,   44,
-       45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
-       48,   45,   45,   49,   50,   45,   45,   45,   45,   45,
-       51,   52,   45,   53,   45,   45,   54,   45,   55,   56,
-       45,   57,   45,   58,   59,   49,   60,   61,   62,   63,
-       64,   65,   66,   67,   68,   69,   45,   45,   45,   45,
-
-       45,   45,   45,   71,   96,   72,   72,   72,   71,  296,
-       74,   74,   74,   75,   75,   75,   73,   92,   98,   99,
-      175,   73,  121,   71,   73,   74,   74,   74,   96,  105,
-      106,   98,  122,   99,  107,   73,   73,   98,   99,  108,
-       73,  109,  297,   73,  110,   80,   80,   80,   93,  415,
-       98,  126,   99,  235,  127,   73,   45,   45,  145,  146,
-       45,   45,  101,  236,  414,  123,  124,   45,   45,   45,
-       80,   80,   80,   45,  126,   45,   45,  127,   45,  170,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   75,   75,   75,   45,  170,   92,
-
-       71,   45,   72,   72,   72,   73,   75,   75,   75,   45,
-      128,  128,   45,   73,   45,  102,   79,   73,   79,  126,
-      127,   80,   80,   80,   73,   71,  137,   74,   74,   74,
-       93,  139,   73,   91,  128,  131,   73,  140,   73,  168,
-       91,  163,  129,  130,  169,  168,  170,  169,  196,  178,
-      137,  197,  208,  213,  214,  139,  208,   73,  372,  164,
-      413,  140,  215,  168,   91,  173,  412,  169,   91,  171,
-      172,  208,   91,  178,  325,  209,  411,  410,  409,  326,
-       91,  408,  407,   91,  406,   91,  134,  143,  143,  143,
-      405,  404,  403,  402,  143,  143,  143,  143,  143,  143,
-
-      401,  400,  399,  398,  373,  397,  396,  395,  394,  393,
-      392,  391,  390,  143,  143,  143,  143,  143,  143,  182,
-      182,  182,  389,  388,  387,  386,  182,  182,  182,  182,
-      182,  182,  385,  384,  383,  382,  381,  380,  379,  378,
-      377,  376,  375,  374,  371,  182,  182,  182,  182,  182,
-      182,  218,  218,  218,  370,  369,  368,  367,  218,  218,
-      218,  218,  218,  218,  366,  365,  364,  363,  362,  361,
-      360,  359,  358,  357,  356,  355,  354,  218,  218,  218,
-      218,  218,  218,   45,   45,   45,  353,  352,  351,  350,
-       45,   45,   45,   45,   45,   45,  349,  348,  347,  346,
-
-      345,  344,  343,  342,  341,  340,  339,  338,  337,   45,
-       45,   45,   45,   45,   45,   36,   36,   36,   36,   36,
-       70,  336,   70,   70,   70,   89,  335,   89,  334,   89,
-       91,   91,   91,   91,   91,  100,  100,  100,  100,  100,
-      125,  333,  125,  125,  125,  141,  141,  141,  332,  331,
-      330,  329,  328,  327,  324,  323,  322,  321,  320,  319,
-      318,  317,  316,  315,  314,  313,  312,  311,  310,  309,
-      308,  307,  306,  305,  304,  303,  302,  301,  300,  299,
-      298,  295,  294,  293,  292,  291,  290,  289,  288,  287,
-      286,  285,  284,  283,  282,  281,  280,  279,  278,  277,
-
-      276,  275,  274,  273,  272,  271,  270,  269,  268,  267,
-      266,  265,  264,  263,  262,  261,  260,  259,  258,  257,
-      256,  255,  254,  253,  252,  251,  250,  249,  248,  247,
-      245,  244,  243,  242,  241,  240,  239,  238,  237,  234,
-      233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
-      223,  222,  221,  220,  219,  217,  216,  212,  210,  207,
-      206,  205,  204,  203,  202,  201,  200,  199,  198,  195,
-      194,  193,  192,  191,  190,  189,  188,  187,  186,  185,
-      184,  183,  142,  181,  180,  179,  177,  176,  174,  167,
-      166,  165,  162,  161,  160,  159,  158,  157,  156,  155,
-
-      154,  153,  152,  151,  150,  149,  148,  147,  144,  142,
-      138,  136,  135,  133,  132,  120,  119,  118,  115,  114,
-      113,  112,  111,  104,  103,   97,   95,   94,   43,   90,
-       88,   87,   78,   43,  416,   11,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-
-      416,  416
+       11,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,   35,   16,   17,
+       16,   35,   13,   12,   35,   26,   22,   24,   27,   14,
+       25,   25,   25,   23,   15,   35,   35,   35,   35,   35,
+       35,   28,   33,   35,   35,   34,   35,   35,   35,   35,
+
+       32,   35,   18,   35,   19,   35,   35,   35,   35,   35,
+       28,   30,   35,   35,   35,   35,   35,   35,   31,   35,
+       35,   35,   35,   35,   29,   35,   35,   35,   35,   35,
+       35,   20,   21,   37,   36,   17,   36,   37,   37,   37,
+       38,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   35,
+
+       35,   40,   35,   35,   35,   35,   35,   35,   35,   35,
+       35,   35,   41,  462,   72,   70,   74,   85,   35,   35,
+       71,   73,   35,   73,   78,   78,   78,   35,   83,   35,
+      462,   35,   79,   79,   79,   83,   84,   35,   35,   85,
+       35,   39,   81,   35,   81,   35,   87,   80,   80,   80,
+       88,   35,   82,   89,   91,   92,   93,   95,   35,   35,
+       42,   42,  100,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   69,   69,   69,   43,
+       43,   68,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   44,   45,
+       43,   43,   46,   47,   43,   43,   43,   43,   43,   48,
+       49,   43,   67,   43,   43,   50,   43,   51,   52,   43,
+       53,   43,   54,   55,   56,   57,   58,   59,   60,   61,
+       62,   63,   64,   65,   66,   43,   43,   43,   43,   43,
+       43,   43,   76,   87,   75,   75,   75,   94,  107,   96,
+
+       98,  101,  102,  108,  109,   77,  103,   99,  105,  110,
+      104,  106,  111,  112,  116,  113,  117,   86,   96,   90,
+       90,   94,   90,   90,   77,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   90,   90,   90,   90,   90,
+       90,   90,   90,   90,   90,   43,   43,   97,  122,   43,
+       43,  114,  115,  123,  118,  133,   43,   43,  119,  120,
+
+      135,  462,   43,  462,   43,   43,   97,   43,  121,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,  127,  127,  127,  127,  127,  125,  127,  127,
+      127,  127,  127,  127,  124,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  124,  127,
+      127,  127,  124,  127,  127,  127,  124,  127,  127,  127,
+      127,  127,  127,  124,  127,  127,  127,  124,  127,  124,
+      126,  127,  127,  127,  127,  127,  127,  127,  130,  130,
+      130,  130,  130,  128,  130,  130,  130,  130,  130,  130,
+
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  129,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  131,  131,  137,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      131,  131,  131,  131,  131,  131,  131,  131,  131,  131,
+      133,  135,  138,  137,  139,  140,  141,  142,  143,  144,
+      145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+      155,  156,  157,  134,  132,  136,  158,  159,  160,  161,
+      142,  162,  144,  145,  163,  164,  165,  166,  167,  168,
+      169,  171,  172,  173,  181,  183,  185,  186,  187,  188,
+      190,  191,  192,  193,  194,  195,  196,  197,  170,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  174,  174,  174,  175,  175,  175,  175,  174,
+
+      174,  174,  174,  174,  174,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  174,  174,
+      174,  174,  174,  174,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  176,  176,  177,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+
+      176,  176,  176,  176,  176,  176,  176,  176,  178,  181,
+      183,  185,  189,  198,  199,  178,  200,  201,  202,  203,
+      204,  205,  206,  207,  209,  210,  208,  211,  180,  212,
+      213,  214,  215,  184,  182,  189,  216,  217,  218,  178,
+      219,  220,  221,  178,  225,  226,  227,  178,  231,  232,
+      228,  229,  225,  233,  178,  222,  222,  222,  178,  230,
+      178,  179,  222,  222,  222,  222,  222,  222,  223,  223,
+      223,  224,  234,  235,  236,  223,  223,  223,  223,  223,
+      223,  222,  222,  222,  222,  222,  222,  237,  238,  239,
+      240,  241,  242,  243,  223,  223,  223,  223,  223,  223,
+
+      244,  245,  246,  247,  248,  249,  250,  252,  253,  254,
+      255,  256,  257,  258,  259,  251,  260,  261,  262,  263,
+      263,  263,  265,  266,  267,  268,  263,  263,  263,  263,
+      263,  263,  264,  264,  264,  269,  270,  271,  272,  264,
+      264,  264,  264,  264,  264,  263,  263,  263,  263,  263,
+      263,  273,  274,  275,  276,  277,  278,  279,  264,  264,
+      264,  264,  264,  264,  280,  281,  282,  283,  284,  285,
+      286,  287,  288,  289,  290,  291,  292,  293,  294,  295,
+      296,  297,  298,  299,  299,  299,  301,  302,  303,  304,
+      299,  299,  299,  299,  299,  299,  300,  300,  300,  305,
+
+      306,  307,  308,  300,  300,  300,  300,  300,  300,  299,
+      299,  299,  299,  299,  299,  309,  310,  311,  312,  313,
+      314,  315,  300,  300,  300,  300,  300,  300,  316,  317,
+      318,  319,  320,  322,  323,  324,  325,  326,  327,  328,
+      329,  330,  331,  332,  332,  332,  333,  334,  335,  336,
+      332,  332,  332,  332,  332,  332,  337,  338,  339,  340,
+      341,  342,  343,  344,  345,  346,  321,  347,  348,  332,
+      332,  332,  332,  332,  332,  349,  350,  351,  352,  353,
+      354,  355,  356,  357,  359,  360,  361,  362,  363,  358,
+      364,  365,  366,  367,  368,  369,  370,  371,  372,  373,
+
+      374,  375,  376,  377,  378,  379,  380,  381,  382,  383,
+      384,  385,  386,  387,  388,  389,  390,  391,  392,  393,
+      394,  395,  396,  397,  398,  399,  400,  401,  402,  403,
+      404,  405,  406,  407,  408,  409,  410,  412,  413,  414,
+      415,  416,  417,  418,  419,  420,  421,  422,  423,  424,
+      425,  426,  427,  428,  429,  430,  431,  432,  433,  434,
+      435,  436,  437,  438,  439,  440,  441,  442,  443,  444,
+      445,  446,  447,  448,  449,  450,  451,  452,  453,  454,
+      455,  456,  411,  457,  458,  459,  460,  461,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[803] =
+static const flex_int16_t yy_chk[1349] =
     {   0,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,  462,  462,  462,
+      462,  462,  462,  462,  462,  462,  462,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    3,    3,    3,    4,
-        4,    4,    3,    9,    7,    4,    5,    5,    8,    5,
-        5,    5,    5,    5,    5,    5,    5,    5,    5,   10,
-       13,  427,   13,   21,   26,    5,    5,   27,   21,    5,
-
-       28,    9,   32,   31,    5,   25,    5,   25,    5,   33,
-       25,   25,   25,   26,    5,    5,    7,   10,    5,  426,
-        8,   27,   31,    5,   28,   37,   32,   37,    5,   42,
-       63,   42,   63,   33,  425,    5,    5,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
-       15,   15,   15,   17,   49,   17,   17,   17,   19,  269,
-       19,   19,   19,   20,   20,   20,   17,   44,   51,   52,
-      424,   19,   67,   22,   20,   22,   22,   22,   49,   56,
-       56,   68,   67,   69,   56,   17,   22,   51,   52,   56,
-       19,   57,  269,   20,   57,   79,   79,   79,   44,  414,
-       68,   81,   69,  199,   82,   22,   45,   45,  104,  104,
-       45,   45,   53,  199,  413,   68,   69,   45,   45,   53,
-       80,   80,   80,   45,   81,   45,   45,   82,   45,  128,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   53,   71,   71,   71,   53,  128,   91,
-
-       72,   53,   72,   72,   72,   71,   75,   75,   75,   53,
-       83,   86,   53,   72,   53,   53,   73,   75,   73,   84,
-       85,   73,   73,   73,   71,   74,   96,   74,   74,   74,
-       91,   98,   72,   93,   83,   86,   75,   99,   74,  126,
-       93,  121,   84,   85,  127,  129,  131,  130,  157,  137,
-       96,  157,  168,  177,  177,   98,  171,   74,  356,  121,
-      412,   99,  177,  126,   93,  131,  410,  127,   93,  129,
-      130,  168,   93,  137,  301,  171,  408,  407,  406,  301,
-       93,  402,  399,   93,  397,   93,   93,  102,  102,  102,
-      396,  395,  392,  391,  102,  102,  102,  102,  102,  102,
-
-      390,  389,  387,  385,  356,  384,  383,  382,  381,  380,
-      379,  378,  377,  102,  102,  102,  102,  102,  102,  143,
-      143,  143,  374,  373,  372,  371,  143,  143,  143,  143,
-      143,  143,  369,  368,  367,  366,  364,  363,  362,  361,
-      360,  359,  358,  357,  355,  143,  143,  143,  143,  143,
-      143,  182,  182,  182,  354,  353,  352,  350,  182,  182,
-      182,  182,  182,  182,  349,  348,  347,  346,  344,  343,
-      342,  341,  339,  337,  336,  335,  334,  182,  182,  182,
-      182,  182,  182,  218,  218,  218,  333,  332,  331,  329,
-      218,  218,  218,  218,  218,  218,  328,  327,  326,  325,
-
-      324,  323,  322,  321,  320,  317,  316,  315,  314,  218,
-      218,  218,  218,  218,  218,  417,  417,  417,  417,  417,
-      418,  313,  418,  418,  418,  419,  312,  419,  311,  419,
-      420,  420,  420,  420,  420,  421,  421,  421,  421,  421,
-      422,  310,  422,  422,  422,  423,  423,  423,  309,  307,
-      305,  304,  303,  302,  300,  298,  297,  295,  294,  292,
-      291,  290,  289,  288,  287,  286,  285,  284,  283,  282,
-      281,  280,  279,  278,  277,  275,  274,  273,  272,  271,
-      270,  268,  267,  266,  265,  264,  263,  262,  261,  260,
-      258,  257,  256,  255,  254,  253,  252,  251,  250,  247,
-
-      245,  244,  243,  242,  241,  240,  239,  237,  236,  235,
-      233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
-      223,  222,  221,  220,  219,  217,  215,  214,  213,  212,
-      210,  207,  206,  205,  204,  203,  202,  201,  200,  198,
-      197,  196,  195,  194,  193,  192,  191,  190,  189,  188,
-      187,  186,  185,  184,  183,  179,  178,  176,  174,  167,
-      166,  165,  164,  163,  162,  161,  160,  159,  158,  156,
-      155,  154,  153,  152,  151,  150,  149,  148,  147,  146,
-      145,  144,  141,  140,  139,  138,  136,  135,  132,  124,
-      123,  122,  120,  119,  118,  117,  116,  115,  114,  113,
-
-      112,  111,  110,  109,  108,  107,  106,  105,  103,  100,
-       97,   95,   94,   89,   88,   66,   65,   64,   62,   61,
-       60,   59,   58,   55,   54,   50,   48,   47,   43,   41,
-       39,   38,   24,   14,   11,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-      416,  416,  416,  416,  416,  416,  416,  416,  416,  416,
-
-      416,  416
+        1,    1,    1,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    5,
+
+        5,    7,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    9,   11,   15,   14,   17,   30,    5,    5,
+       14,   16,    5,   16,   26,   26,   26,    5,   29,    5,
+       27,    5,   27,   27,   27,   32,   30,    5,    5,   33,
+        9,    5,   28,    7,   28,    5,   34,   28,   28,   28,
+       38,    5,   29,   39,   41,   44,   45,   47,    5,    5,
+       12,   12,   51,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   24,   31,   24,   24,   24,   46,   54,   48,
+
+       50,   52,   52,   55,   56,   24,   52,   50,   53,   57,
+       52,   53,   58,   59,   61,   59,   62,   31,   48,   40,
+       40,   46,   40,   40,   24,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   43,   43,   49,   65,   43,
+       43,   60,   60,   66,   63,   83,   43,   43,   63,   64,
+
+       85,   80,   43,   80,   43,   43,   49,   43,   64,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+       69,   69,   69,   69,   71,   71,   87,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+       82,   84,   89,   86,   90,   92,   93,   94,   95,   96,
+       97,   98,   99,  100,  100,  101,  102,  103,  104,  105,
+      106,  107,  108,   84,   82,   86,  109,  110,  111,  112,
+       94,  113,   96,   97,  114,  115,  116,  117,  118,  119,
+      120,  121,  122,  123,  133,  135,  137,  138,  140,  141,
+      143,  144,  145,  146,  147,  148,  149,  150,  120,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  126,  126,  126,  126,  126,
+      126,  126,  126,  126,  126,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+      127,  127,  127,  127,  127,  127,  127,  127,  127,  127,
+
+      127,  127,  127,  127,  127,  127,  127,  127,  129,  132,
+      134,  136,  142,  151,  152,  129,  153,  154,  155,  156,
+      157,  158,  159,  160,  161,  162,  160,  163,  132,  164,
+      165,  166,  167,  136,  134,  142,  168,  169,  170,  129,
+      171,  172,  173,  129,  183,  186,  187,  129,  189,  190,
+      188,  188,  182,  193,  129,  174,  174,  174,  129,  188,
+      129,  129,  174,  174,  174,  174,  174,  174,  179,  179,
+      179,  182,  194,  195,  196,  179,  179,  179,  179,  179,
+      179,  174,  174,  174,  174,  174,  174,  197,  198,  199,
+      200,  201,  202,  203,  179,  179,  179,  179,  179,  179,
+
+      204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+      214,  215,  216,  217,  218,  210,  219,  220,  221,  222,
+      222,  222,  226,  227,  228,  229,  222,  222,  222,  222,
+      222,  222,  223,  223,  223,  230,  232,  233,  234,  223,
+      223,  223,  223,  223,  223,  222,  222,  222,  222,  222,
+      222,  235,  236,  237,  238,  239,  240,  241,  223,  223,
+      223,  223,  223,  223,  242,  243,  244,  245,  246,  247,
+      248,  250,  251,  252,  253,  255,  256,  257,  258,  259,
+      260,  261,  262,  263,  263,  263,  265,  266,  269,  270,
+      263,  263,  263,  263,  263,  263,  264,  264,  264,  271,
+
+      273,  274,  275,  264,  264,  264,  264,  264,  264,  263,
+      263,  263,  263,  263,  263,  276,  277,  278,  280,  281,
+      282,  283,  264,  264,  264,  264,  264,  264,  284,  285,
+      286,  287,  288,  289,  290,  291,  292,  293,  294,  295,
+      296,  297,  298,  300,  300,  300,  302,  303,  304,  305,
+      300,  300,  300,  300,  300,  300,  306,  307,  308,  309,
+      310,  311,  312,  313,  314,  315,  289,  316,  317,  300,
+      300,  300,  300,  300,  300,  319,  320,  321,  323,  324,
+      325,  326,  328,  329,  330,  331,  333,  334,  336,  329,
+      338,  339,  340,  341,  342,  343,  344,  345,  346,  349,
+
+      350,  351,  352,  353,  354,  355,  356,  357,  358,  359,
+      360,  361,  363,  364,  365,  366,  367,  368,  369,  371,
+      373,  374,  375,  376,  377,  378,  379,  381,  382,  383,
+      384,  385,  387,  388,  389,  390,  391,  392,  393,  394,
+      395,  396,  397,  398,  399,  400,  401,  402,  404,  405,
+      406,  407,  409,  410,  411,  412,  415,  416,  417,  420,
+      421,  422,  423,  424,  425,  426,  428,  430,  431,  432,
+      433,  434,  437,  438,  439,  441,  444,  445,  449,  450,
+      451,  452,  391,  454,  456,  457,  459,  460,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1087,15 +1218,15 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[67] =
+static const flex_int16_t yy_rule_linenum[71] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  176,  185,  196,  207,  216,  225,  234,  244,  254,
       264,  281,  298,  307,  316,  326,  336,  346,  357,  366,
       376,  386,  396,  405,  414,  424,  433,  442,  451,  460,
-      469,  478,  487,  500,  509,  518,  527,  536,  546,  645,
-      650,  655,  660,  661,  662,  663,  664,  665,  667,  685,
-      698,  703,  707,  709,  711,  713
+      469,  478,  487,  496,  505,  514,  527,  536,  545,  554,
+      563,  572,  582,  681,  686,  691,  696,  697,  698,  699,
+      700,  701,  703,  721,  734,  739,  743,  745,  747,  749
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1107,7 +1238,7 @@ static const flex_int16_t yy_rule_linenum[67] =
 #define YY_RESTORE_YY_MORE_OFFSET
 char *yytext;
 #line 1 "d2_lexer.ll"
-/* Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -1146,7 +1277,7 @@ unsigned int comment_start_line = 0;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::d2::D2ParserContext::fatal(msg)
-#line 1149 "d2_lexer.cc"
+#line 1280 "d2_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1172,8 +1303,8 @@ unsigned int comment_start_line = 0;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1175 "d2_lexer.cc"
-#line 1176 "d2_lexer.cc"
+#line 1306 "d2_lexer.cc"
+#line 1307 "d2_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1491,7 +1622,7 @@ YY_DECL
     }
 
 
-#line 1494 "d2_lexer.cc"
+#line 1625 "d2_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1520,13 +1651,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 417 )
+				if ( yy_current_state >= 463 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 416 );
+		while ( yy_current_state != 462 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2060,6 +2191,42 @@ YY_RULE_SETUP
 case 43:
 YY_RULE_SETUP
 #line 487 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 496 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 505 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 46:
+YY_RULE_SETUP
+#line 514 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2073,9 +2240,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 47:
 YY_RULE_SETUP
-#line 500 "d2_lexer.ll"
+#line 527 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2085,9 +2252,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 48:
+YY_RULE_SETUP
+#line 536 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::LOGGERS:
+        return isc::d2::D2Parser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 49:
 YY_RULE_SETUP
-#line 509 "d2_lexer.ll"
+#line 545 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -2097,9 +2276,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 50:
 YY_RULE_SETUP
-#line 518 "d2_lexer.ll"
+#line 554 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2109,9 +2288,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 51:
 YY_RULE_SETUP
-#line 527 "d2_lexer.ll"
+#line 563 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2121,9 +2300,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 52:
 YY_RULE_SETUP
-#line 536 "d2_lexer.ll"
+#line 572 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -2133,9 +2312,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 53:
 YY_RULE_SETUP
-#line 546 "d2_lexer.ll"
+#line 582 "d2_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2235,65 +2414,65 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 50:
-/* rule 50 can match eol */
+case 54:
+/* rule 54 can match eol */
 YY_RULE_SETUP
-#line 645 "d2_lexer.ll"
+#line 681 "d2_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 51:
-/* rule 51 can match eol */
+case 55:
+/* rule 55 can match eol */
 YY_RULE_SETUP
-#line 650 "d2_lexer.ll"
+#line 686 "d2_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 52:
+case 56:
 YY_RULE_SETUP
-#line 655 "d2_lexer.ll"
+#line 691 "d2_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 53:
+case 57:
 YY_RULE_SETUP
-#line 660 "d2_lexer.ll"
+#line 696 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 661 "d2_lexer.ll"
+#line 697 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 662 "d2_lexer.ll"
+#line 698 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 663 "d2_lexer.ll"
+#line 699 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 664 "d2_lexer.ll"
+#line 700 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 665 "d2_lexer.ll"
+#line 701 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 59:
+case 63:
 YY_RULE_SETUP
-#line 667 "d2_lexer.ll"
+#line 703 "d2_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2312,9 +2491,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 60:
+case 64:
 YY_RULE_SETUP
-#line 685 "d2_lexer.ll"
+#line 721 "d2_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2328,43 +2507,43 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 61:
+case 65:
 YY_RULE_SETUP
-#line 698 "d2_lexer.ll"
+#line 734 "d2_lexer.ll"
 {
     string tmp(yytext);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 62:
+case 66:
 YY_RULE_SETUP
-#line 703 "d2_lexer.ll"
+#line 739 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 63:
+case 67:
 YY_RULE_SETUP
-#line 707 "d2_lexer.ll"
+#line 743 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 64:
+case 68:
 YY_RULE_SETUP
-#line 709 "d2_lexer.ll"
+#line 745 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 65:
+case 69:
 YY_RULE_SETUP
-#line 711 "d2_lexer.ll"
+#line 747 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 66:
+case 70:
 YY_RULE_SETUP
-#line 713 "d2_lexer.ll"
+#line 749 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 715 "d2_lexer.ll"
+#line 751 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2388,12 +2567,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 67:
+case 71:
 YY_RULE_SETUP
-#line 738 "d2_lexer.ll"
+#line 774 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2396 "d2_lexer.cc"
+#line 2575 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2712,7 +2891,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 417 )
+			if ( yy_current_state >= 463 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -2745,11 +2924,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 417 )
+		if ( yy_current_state >= 463 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 416);
+	yy_is_jam = (yy_current_state == 462);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3498,7 +3677,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 738 "d2_lexer.ll"
+#line 774 "d2_lexer.ll"
 
 
 using namespace isc::dhcp;
@@ -1,4 +1,4 @@
-/* Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2017-2019 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -483,6 +483,33 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"async\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("async", driver.loc_);
+    }
+}
+
+\"queue-size\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+
+\"overflow-policy\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
+        return isc::d2::D2Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+
 \"name\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -505,6 +532,15 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"rate-limit\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::LOGGERS:
+        return isc::d2::D2Parser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+
 \"severity\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 34 "d2_parser.yy" // lalr1.cc:438
+#line 34 "d2_parser.yy"
 
 #include <d2/parser_context.h>
 
-#line 51 "d2_parser.cc" // lalr1.cc:438
+#line 52 "d2_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -88,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if D2_PARSER_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !D2_PARSER_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "d2_parser.yy" // lalr1.cc:513
+#line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 146 "d2_parser.cc" // lalr1.cc:513
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  D2Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "d2_parser.cc"
 
   /// Build a parser object.
   D2Parser::D2Parser (isc::d2::D2ParserContext& ctx_yyarg)
-    :
 #if D2_PARSER_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -195,24 +157,26 @@ namespace isc { namespace d2 {
   D2Parser::~D2Parser ()
   {}
 
+  D2Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  D2Parser::by_state::by_state ()
+  D2Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  D2Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  D2Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
   void
-  D2Parser::by_state::clear ()
+  D2Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
@@ -224,17 +188,17 @@ namespace isc { namespace d2 {
     that.clear ();
   }
 
-  D2Parser::by_state::by_state (state_type s)
+  D2Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  D2Parser::symbol_number_type
-  D2Parser::by_state::type_get () const
+  D2Parser::symbol_kind_type
+  D2Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   D2Parser::stack_symbol_type::stack_symbol_type ()
@@ -243,27 +207,27 @@ namespace isc { namespace d2 {
   D2Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -280,27 +244,27 @@ namespace isc { namespace d2 {
   D2Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -309,35 +273,71 @@ namespace isc { namespace d2 {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  D2Parser::stack_symbol_type&
+  D2Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   D2Parser::stack_symbol_type&
   D2Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -363,75 +363,67 @@ namespace isc { namespace d2 {
 #if D2_PARSER_DEBUG
   template <typename Base>
   void
-  D2Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  D2Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 56: // "constant string"
-
-#line 115 "d2_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 386 "d2_parser.cc" // lalr1.cc:672
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 119 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "d2_parser.cc"
         break;
 
-      case 57: // "integer"
-
-#line 115 "d2_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 393 "d2_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_INTEGER: // "integer"
+#line 119 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "d2_parser.cc"
         break;
 
-      case 58: // "floating point"
-
-#line 115 "d2_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< double > (); }
-#line 400 "d2_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 119 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "d2_parser.cc"
         break;
 
-      case 59: // "boolean"
-
-#line 115 "d2_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 407 "d2_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 119 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "d2_parser.cc"
         break;
 
-      case 71: // value
-
-#line 115 "d2_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 414 "d2_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_value: // value
+#line 119 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "d2_parser.cc"
         break;
 
-      case 75: // map_value
-
-#line 115 "d2_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 421 "d2_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_map_value: // map_value
+#line 119 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "d2_parser.cc"
         break;
 
-      case 99: // ncr_protocol_value
-
-#line 115 "d2_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 428 "d2_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 119 "d2_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "d2_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -455,7 +447,7 @@ namespace isc { namespace d2 {
   }
 
   void
-  D2Parser::yypop_ (int n)
+  D2Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -490,21 +482,21 @@ namespace isc { namespace d2 {
   D2Parser::state_type
   D2Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  D2Parser::yy_pact_value_is_default_ (int yyvalue)
+  D2Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  D2Parser::yy_table_value_is_error_ (int yyvalue)
+  D2Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -518,7 +510,6 @@ namespace isc { namespace d2 {
   int
   D2Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -550,27 +541,33 @@ namespace isc { namespace d2 {
     yystack_.clear ();
     yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -581,6 +578,7 @@ namespace isc { namespace d2 {
 #if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
@@ -588,11 +586,23 @@ namespace isc { namespace d2 {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -609,20 +619,22 @@ namespace isc { namespace d2 {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
@@ -634,25 +646,25 @@ namespace isc { namespace d2 {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -663,8 +675,8 @@ namespace isc { namespace d2 {
 
       // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
         yyerror_range[1].location = yylhs.location;
       }
 
@@ -676,365 +688,365 @@ namespace isc { namespace d2 {
         {
           switch (yyn)
             {
-  case 2:
-#line 124 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 683 "d2_parser.cc" // lalr1.cc:907
+  case 2: // $@1: %empty
+#line 128 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 695 "d2_parser.cc"
     break;
 
-  case 4:
-#line 125 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 689 "d2_parser.cc" // lalr1.cc:907
+  case 4: // $@2: %empty
+#line 129 "d2_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "d2_parser.cc"
     break;
 
-  case 6:
-#line 126 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCPDDNS; }
-#line 695 "d2_parser.cc" // lalr1.cc:907
+  case 6: // $@3: %empty
+#line 130 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.DHCPDDNS; }
+#line 707 "d2_parser.cc"
     break;
 
-  case 8:
-#line 127 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.TSIG_KEY; }
-#line 701 "d2_parser.cc" // lalr1.cc:907
+  case 8: // $@4: %empty
+#line 131 "d2_parser.yy"
+                    { ctx.ctx_ = ctx.TSIG_KEY; }
+#line 713 "d2_parser.cc"
     break;
 
-  case 10:
-#line 128 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.TSIG_KEYS; }
-#line 707 "d2_parser.cc" // lalr1.cc:907
+  case 10: // $@5: %empty
+#line 132 "d2_parser.yy"
+                     { ctx.ctx_ = ctx.TSIG_KEYS; }
+#line 719 "d2_parser.cc"
     break;
 
-  case 12:
-#line 129 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DDNS_DOMAIN; }
-#line 713 "d2_parser.cc" // lalr1.cc:907
+  case 12: // $@6: %empty
+#line 133 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DDNS_DOMAIN; }
+#line 725 "d2_parser.cc"
     break;
 
-  case 14:
-#line 130 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DDNS_DOMAINS; }
-#line 719 "d2_parser.cc" // lalr1.cc:907
+  case 14: // $@7: %empty
+#line 134 "d2_parser.yy"
+                        { ctx.ctx_ = ctx.DDNS_DOMAINS; }
+#line 731 "d2_parser.cc"
     break;
 
-  case 16:
-#line 131 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 725 "d2_parser.cc" // lalr1.cc:907
+  case 16: // $@8: %empty
+#line 135 "d2_parser.yy"
+                      { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 737 "d2_parser.cc"
     break;
 
-  case 18:
-#line 132 "d2_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DNS_SERVERS; }
-#line 731 "d2_parser.cc" // lalr1.cc:907
+  case 18: // $@9: %empty
+#line 136 "d2_parser.yy"
+                       { ctx.ctx_ = ctx.DNS_SERVERS; }
+#line 743 "d2_parser.cc"
     break;
 
-  case 20:
-#line 140 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 737 "d2_parser.cc" // lalr1.cc:907
+  case 20: // value: "integer"
+#line 144 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 749 "d2_parser.cc"
     break;
 
-  case 21:
-#line 141 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 743 "d2_parser.cc" // lalr1.cc:907
+  case 21: // value: "floating point"
+#line 145 "d2_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 755 "d2_parser.cc"
     break;
 
-  case 22:
-#line 142 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 749 "d2_parser.cc" // lalr1.cc:907
+  case 22: // value: "boolean"
+#line 146 "d2_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 761 "d2_parser.cc"
     break;
 
-  case 23:
-#line 143 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 755 "d2_parser.cc" // lalr1.cc:907
+  case 23: // value: "constant string"
+#line 147 "d2_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 767 "d2_parser.cc"
     break;
 
-  case 24:
-#line 144 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 761 "d2_parser.cc" // lalr1.cc:907
+  case 24: // value: "null"
+#line 148 "d2_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 773 "d2_parser.cc"
     break;
 
-  case 25:
-#line 145 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 767 "d2_parser.cc" // lalr1.cc:907
+  case 25: // value: map2
+#line 149 "d2_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 779 "d2_parser.cc"
     break;
 
-  case 26:
-#line 146 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 773 "d2_parser.cc" // lalr1.cc:907
+  case 26: // value: list_generic
+#line 150 "d2_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 785 "d2_parser.cc"
     break;
 
-  case 27:
-#line 149 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 27: // sub_json: value
+#line 153 "d2_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 782 "d2_parser.cc" // lalr1.cc:907
+#line 794 "d2_parser.cc"
     break;
 
-  case 28:
-#line 154 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 28: // $@10: %empty
+#line 158 "d2_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 793 "d2_parser.cc" // lalr1.cc:907
+#line 805 "d2_parser.cc"
     break;
 
-  case 29:
-#line 159 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 29: // map2: "{" $@10 map_content "}"
+#line 163 "d2_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 803 "d2_parser.cc" // lalr1.cc:907
+#line 815 "d2_parser.cc"
     break;
 
-  case 30:
-#line 165 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 809 "d2_parser.cc" // lalr1.cc:907
+  case 30: // map_value: map2
+#line 169 "d2_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 821 "d2_parser.cc"
     break;
 
-  case 33:
-#line 172 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 33: // not_empty_map: "constant string" ":" value
+#line 176 "d2_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 818 "d2_parser.cc" // lalr1.cc:907
+#line 830 "d2_parser.cc"
     break;
 
-  case 34:
-#line 176 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 34: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 180 "d2_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 828 "d2_parser.cc" // lalr1.cc:907
+#line 840 "d2_parser.cc"
     break;
 
-  case 35:
-#line 183 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 35: // $@11: %empty
+#line 187 "d2_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 837 "d2_parser.cc" // lalr1.cc:907
+#line 849 "d2_parser.cc"
     break;
 
-  case 36:
-#line 186 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 36: // list_generic: "[" $@11 list_content "]"
+#line 190 "d2_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 845 "d2_parser.cc" // lalr1.cc:907
+#line 857 "d2_parser.cc"
     break;
 
-  case 39:
-#line 194 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 39: // not_empty_list: value
+#line 198 "d2_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 854 "d2_parser.cc" // lalr1.cc:907
+#line 866 "d2_parser.cc"
     break;
 
-  case 40:
-#line 198 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 40: // not_empty_list: not_empty_list "," value
+#line 202 "d2_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 863 "d2_parser.cc" // lalr1.cc:907
+#line 875 "d2_parser.cc"
     break;
 
-  case 41:
-#line 209 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 41: // unknown_map_entry: "constant string" ":"
+#line 213 "d2_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 874 "d2_parser.cc" // lalr1.cc:907
+#line 886 "d2_parser.cc"
     break;
 
-  case 42:
-#line 219 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 42: // $@12: %empty
+#line 223 "d2_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 885 "d2_parser.cc" // lalr1.cc:907
+#line 897 "d2_parser.cc"
     break;
 
-  case 43:
-#line 224 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 43: // syntax_map: "{" $@12 global_objects "}"
+#line 228 "d2_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 895 "d2_parser.cc" // lalr1.cc:907
+#line 907 "d2_parser.cc"
     break;
 
-  case 52:
-#line 246 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 52: // $@13: %empty
+#line 250 "d2_parser.yy"
+                          {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCPDDNS);
 }
-#line 906 "d2_parser.cc" // lalr1.cc:907
+#line 918 "d2_parser.cc"
     break;
 
-  case 53:
-#line 251 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 53: // dhcpddns_object: "DhcpDdns" $@13 ":" "{" dhcpddns_params "}"
+#line 255 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 915 "d2_parser.cc" // lalr1.cc:907
+#line 927 "d2_parser.cc"
     break;
 
-  case 54:
-#line 256 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 54: // $@14: %empty
+#line 260 "d2_parser.yy"
+                             {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 925 "d2_parser.cc" // lalr1.cc:907
+#line 937 "d2_parser.cc"
     break;
 
-  case 55:
-#line 260 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 55: // sub_dhcpddns: "{" $@14 dhcpddns_params "}"
+#line 264 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 933 "d2_parser.cc" // lalr1.cc:907
+#line 945 "d2_parser.cc"
     break;
 
-  case 70:
-#line 283 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 70: // $@15: %empty
+#line 287 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 941 "d2_parser.cc" // lalr1.cc:907
+#line 953 "d2_parser.cc"
     break;
 
-  case 71:
-#line 285 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 71: // ip_address: "ip-address" $@15 ":" "constant string"
+#line 289 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 951 "d2_parser.cc" // lalr1.cc:907
+#line 963 "d2_parser.cc"
     break;
 
-  case 72:
-#line 291 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 72: // port: "port" ":" "integer"
+#line 295 "d2_parser.yy"
+                         {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 963 "d2_parser.cc" // lalr1.cc:907
+#line 975 "d2_parser.cc"
     break;
 
-  case 73:
-#line 299 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0) {
+  case 73: // dns_server_timeout: "dns-server-timeout" ":" "integer"
+#line 303 "d2_parser.yy"
+                                                     {
+    if (yystack_[0].value.as < int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
     } else {
-        ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+        ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
         ctx.stack_.back()->set("dns-server-timeout", i);
     }
 }
-#line 976 "d2_parser.cc" // lalr1.cc:907
+#line 988 "d2_parser.cc"
     break;
 
-  case 74:
-#line 308 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 74: // $@16: %empty
+#line 312 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 984 "d2_parser.cc" // lalr1.cc:907
+#line 996 "d2_parser.cc"
     break;
 
-  case 75:
-#line 310 "d2_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 75: // ncr_protocol: "ncr-protocol" $@16 ":" ncr_protocol_value
+#line 314 "d2_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 993 "d2_parser.cc" // lalr1.cc:907
+#line 1005 "d2_parser.cc"
     break;
 
-  case 76:
-#line 316 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 999 "d2_parser.cc" // lalr1.cc:907
+  case 76: // ncr_protocol_value: "UDP"
+#line 320 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 1011 "d2_parser.cc"
     break;
 
-  case 77:
-#line 317 "d2_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 1005 "d2_parser.cc" // lalr1.cc:907
+  case 77: // ncr_protocol_value: "TCP"
+#line 321 "d2_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 1017 "d2_parser.cc"
     break;
 
-  case 78:
-#line 320 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 78: // $@17: %empty
+#line 324 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 1013 "d2_parser.cc" // lalr1.cc:907
+#line 1025 "d2_parser.cc"
     break;
 
-  case 79:
-#line 322 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 79: // ncr_format: "ncr-format" $@17 ":" "JSON"
+#line 326 "d2_parser.yy"
+             {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 1023 "d2_parser.cc" // lalr1.cc:907
+#line 1035 "d2_parser.cc"
     break;
 
-  case 80:
-#line 328 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 80: // $@18: %empty
+#line 332 "d2_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1031 "d2_parser.cc" // lalr1.cc:907
+#line 1043 "d2_parser.cc"
     break;
 
-  case 81:
-#line 330 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 81: // user_context: "user-context" $@18 ":" map_value
+#line 334 "d2_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
-    ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
+    ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
 
     // Handle already existing user context
@@ -1054,23 +1066,23 @@ namespace isc { namespace d2 {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1058 "d2_parser.cc" // lalr1.cc:907
+#line 1070 "d2_parser.cc"
     break;
 
-  case 82:
-#line 353 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 82: // $@19: %empty
+#line 357 "d2_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1066 "d2_parser.cc" // lalr1.cc:907
+#line 1078 "d2_parser.cc"
     break;
 
-  case 83:
-#line 355 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 83: // comment: "comment" $@19 ":" "constant string"
+#line 359 "d2_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
-    ElementPtr comment(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     user_context->set("comment", comment);
 
     // Handle already existing user context
@@ -1091,730 +1103,785 @@ namespace isc { namespace d2 {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1095 "d2_parser.cc" // lalr1.cc:907
+#line 1107 "d2_parser.cc"
     break;
 
-  case 84:
-#line 380 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 84: // $@20: %empty
+#line 384 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.FORWARD_DDNS);
 }
-#line 1106 "d2_parser.cc" // lalr1.cc:907
+#line 1118 "d2_parser.cc"
     break;
 
-  case 85:
-#line 385 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 85: // forward_ddns: "forward-ddns" $@20 ":" "{" ddns_mgr_params "}"
+#line 389 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1115 "d2_parser.cc" // lalr1.cc:907
+#line 1127 "d2_parser.cc"
     break;
 
-  case 86:
-#line 390 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 86: // $@21: %empty
+#line 394 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.REVERSE_DDNS);
 }
-#line 1126 "d2_parser.cc" // lalr1.cc:907
+#line 1138 "d2_parser.cc"
     break;
 
-  case 87:
-#line 395 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 87: // reverse_ddns: "reverse-ddns" $@21 ":" "{" ddns_mgr_params "}"
+#line 399 "d2_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1135 "d2_parser.cc" // lalr1.cc:907
+#line 1147 "d2_parser.cc"
     break;
 
-  case 94:
-#line 414 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 94: // $@22: %empty
+#line 418 "d2_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DDNS_DOMAINS);
 }
-#line 1146 "d2_parser.cc" // lalr1.cc:907
+#line 1158 "d2_parser.cc"
     break;
 
-  case 95:
-#line 419 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 95: // ddns_domains: "ddns-domains" $@22 ":" "[" ddns_domain_list "]"
+#line 423 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1155 "d2_parser.cc" // lalr1.cc:907
+#line 1167 "d2_parser.cc"
     break;
 
-  case 96:
-#line 424 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 96: // $@23: %empty
+#line 428 "d2_parser.yy"
+                                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1164 "d2_parser.cc" // lalr1.cc:907
+#line 1176 "d2_parser.cc"
     break;
 
-  case 97:
-#line 427 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 97: // sub_ddns_domains: "[" $@23 ddns_domain_list "]"
+#line 431 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1172 "d2_parser.cc" // lalr1.cc:907
+#line 1184 "d2_parser.cc"
     break;
 
-  case 102:
-#line 439 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 102: // $@24: %empty
+#line 443 "d2_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1182 "d2_parser.cc" // lalr1.cc:907
+#line 1194 "d2_parser.cc"
     break;
 
-  case 103:
-#line 443 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 103: // ddns_domain: "{" $@24 ddns_domain_params "}"
+#line 447 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1190 "d2_parser.cc" // lalr1.cc:907
+#line 1202 "d2_parser.cc"
     break;
 
-  case 104:
-#line 447 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 104: // $@25: %empty
+#line 451 "d2_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1199 "d2_parser.cc" // lalr1.cc:907
+#line 1211 "d2_parser.cc"
     break;
 
-  case 105:
-#line 450 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 105: // sub_ddns_domain: "{" $@25 ddns_domain_params "}"
+#line 454 "d2_parser.yy"
+                                    {
     // parsing completed
 }
-#line 1207 "d2_parser.cc" // lalr1.cc:907
+#line 1219 "d2_parser.cc"
     break;
 
-  case 114:
-#line 467 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 114: // $@26: %empty
+#line 471 "d2_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1215 "d2_parser.cc" // lalr1.cc:907
+#line 1227 "d2_parser.cc"
     break;
 
-  case 115:
-#line 469 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 115: // ddns_domain_name: "name" $@26 ":" "constant string"
+#line 473 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1229 "d2_parser.cc" // lalr1.cc:907
+#line 1241 "d2_parser.cc"
     break;
 
-  case 116:
-#line 479 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 116: // $@27: %empty
+#line 483 "d2_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1237 "d2_parser.cc" // lalr1.cc:907
+#line 1249 "d2_parser.cc"
     break;
 
-  case 117:
-#line 481 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 117: // ddns_domain_key_name: "key-name" $@27 ":" "constant string"
+#line 485 "d2_parser.yy"
+               {
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("key-name", name);
     ctx.leave();
 }
-#line 1248 "d2_parser.cc" // lalr1.cc:907
+#line 1260 "d2_parser.cc"
     break;
 
-  case 118:
-#line 491 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 118: // $@28: %empty
+#line 495 "d2_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.DNS_SERVERS);
 }
-#line 1259 "d2_parser.cc" // lalr1.cc:907
+#line 1271 "d2_parser.cc"
     break;
 
-  case 119:
-#line 496 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 119: // dns_servers: "dns-servers" $@28 ":" "[" dns_server_list "]"
+#line 500 "d2_parser.yy"
+                                                        {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1268 "d2_parser.cc" // lalr1.cc:907
+#line 1280 "d2_parser.cc"
     break;
 
-  case 120:
-#line 501 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 120: // $@29: %empty
+#line 505 "d2_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1277 "d2_parser.cc" // lalr1.cc:907
+#line 1289 "d2_parser.cc"
     break;
 
-  case 121:
-#line 504 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 121: // sub_dns_servers: "[" $@29 dns_server_list "]"
+#line 508 "d2_parser.yy"
+                                  {
     // parsing completed
 }
-#line 1285 "d2_parser.cc" // lalr1.cc:907
+#line 1297 "d2_parser.cc"
     break;
 
-  case 124:
-#line 512 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 124: // $@30: %empty
+#line 516 "d2_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1295 "d2_parser.cc" // lalr1.cc:907
+#line 1307 "d2_parser.cc"
     break;
 
-  case 125:
-#line 516 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 125: // dns_server: "{" $@30 dns_server_params "}"
+#line 520 "d2_parser.yy"
+                                   {
     ctx.stack_.pop_back();
 }
-#line 1303 "d2_parser.cc" // lalr1.cc:907
+#line 1315 "d2_parser.cc"
     break;
 
-  case 126:
-#line 520 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 126: // $@31: %empty
+#line 524 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1312 "d2_parser.cc" // lalr1.cc:907
+#line 1324 "d2_parser.cc"
     break;
 
-  case 127:
-#line 523 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 127: // sub_dns_server: "{" $@31 dns_server_params "}"
+#line 527 "d2_parser.yy"
+                                   {
     // parsing completed
 }
-#line 1320 "d2_parser.cc" // lalr1.cc:907
+#line 1332 "d2_parser.cc"
     break;
 
-  case 136:
-#line 539 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 136: // $@32: %empty
+#line 543 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1328 "d2_parser.cc" // lalr1.cc:907
+#line 1340 "d2_parser.cc"
     break;
 
-  case 137:
-#line 541 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< std::string > () != "") {
+  case 137: // dns_server_hostname: "hostname" $@32 ":" "constant string"
+#line 545 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", name);
     ctx.leave();
 }
-#line 1342 "d2_parser.cc" // lalr1.cc:907
+#line 1354 "d2_parser.cc"
     break;
 
-  case 138:
-#line 551 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 138: // $@33: %empty
+#line 555 "d2_parser.yy"
+                                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1350 "d2_parser.cc" // lalr1.cc:907
+#line 1362 "d2_parser.cc"
     break;
 
-  case 139:
-#line 553 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 139: // dns_server_ip_address: "ip-address" $@33 ":" "constant string"
+#line 557 "d2_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
     ctx.leave();
 }
-#line 1360 "d2_parser.cc" // lalr1.cc:907
+#line 1372 "d2_parser.cc"
     break;
 
-  case 140:
-#line 559 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
+  case 140: // dns_server_port: "port" ":" "integer"
+#line 563 "d2_parser.yy"
+                                    {
+    if (yystack_[0].value.as < int64_t > () <= 0 || yystack_[0].value.as < int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
     }
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", i);
 }
-#line 1372 "d2_parser.cc" // lalr1.cc:907
+#line 1384 "d2_parser.cc"
     break;
 
-  case 141:
-#line 573 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 141: // $@34: %empty
+#line 577 "d2_parser.yy"
+                     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.TSIG_KEYS);
 }
-#line 1383 "d2_parser.cc" // lalr1.cc:907
+#line 1395 "d2_parser.cc"
     break;
 
-  case 142:
-#line 578 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 142: // tsig_keys: "tsig-keys" $@34 ":" "[" tsig_keys_list "]"
+#line 582 "d2_parser.yy"
+                                                       {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1392 "d2_parser.cc" // lalr1.cc:907
+#line 1404 "d2_parser.cc"
     break;
 
-  case 143:
-#line 583 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 143: // $@35: %empty
+#line 587 "d2_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1401 "d2_parser.cc" // lalr1.cc:907
+#line 1413 "d2_parser.cc"
     break;
 
-  case 144:
-#line 586 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 144: // sub_tsig_keys: "[" $@35 tsig_keys_list "]"
+#line 590 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1409 "d2_parser.cc" // lalr1.cc:907
+#line 1421 "d2_parser.cc"
     break;
 
-  case 149:
-#line 598 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 149: // $@36: %empty
+#line 602 "d2_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1419 "d2_parser.cc" // lalr1.cc:907
+#line 1431 "d2_parser.cc"
     break;
 
-  case 150:
-#line 602 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 150: // tsig_key: "{" $@36 tsig_key_params "}"
+#line 606 "d2_parser.yy"
+                                 {
     ctx.stack_.pop_back();
 }
-#line 1427 "d2_parser.cc" // lalr1.cc:907
+#line 1439 "d2_parser.cc"
     break;
 
-  case 151:
-#line 606 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 151: // $@37: %empty
+#line 610 "d2_parser.yy"
+                             {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1437 "d2_parser.cc" // lalr1.cc:907
+#line 1449 "d2_parser.cc"
     break;
 
-  case 152:
-#line 610 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 152: // sub_tsig_key: "{" $@37 tsig_key_params "}"
+#line 614 "d2_parser.yy"
+                                 {
     // parsing completed
 }
-#line 1445 "d2_parser.cc" // lalr1.cc:907
+#line 1457 "d2_parser.cc"
     break;
 
-  case 162:
-#line 628 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 162: // $@38: %empty
+#line 632 "d2_parser.yy"
+                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1453 "d2_parser.cc" // lalr1.cc:907
+#line 1465 "d2_parser.cc"
     break;
 
-  case 163:
-#line 630 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 163: // tsig_key_name: "name" $@38 ":" "constant string"
+#line 634 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1467 "d2_parser.cc" // lalr1.cc:907
+#line 1479 "d2_parser.cc"
     break;
 
-  case 164:
-#line 640 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 164: // $@39: %empty
+#line 644 "d2_parser.yy"
+                              {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1475 "d2_parser.cc" // lalr1.cc:907
+#line 1487 "d2_parser.cc"
     break;
 
-  case 165:
-#line 642 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 165: // tsig_key_algorithm: "algorithm" $@39 ":" "constant string"
+#line 646 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("algorithm", elem);
     ctx.leave();
 }
-#line 1488 "d2_parser.cc" // lalr1.cc:907
+#line 1500 "d2_parser.cc"
     break;
 
-  case 166:
-#line 651 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< int64_t > () < 0 || (yystack_[0].value.as< int64_t > () > 0  && (yystack_[0].value.as< int64_t > () % 8 != 0))) {
+  case 166: // tsig_key_digest_bits: "digest-bits" ":" "integer"
+#line 655 "d2_parser.yy"
+                                                {
+    if (yystack_[0].value.as < int64_t > () < 0 || (yystack_[0].value.as < int64_t > () > 0  && (yystack_[0].value.as < int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
     }
-    ElementPtr elem(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("digest-bits", elem);
 }
-#line 1500 "d2_parser.cc" // lalr1.cc:907
+#line 1512 "d2_parser.cc"
     break;
 
-  case 167:
-#line 659 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 167: // $@40: %empty
+#line 663 "d2_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1508 "d2_parser.cc" // lalr1.cc:907
+#line 1520 "d2_parser.cc"
     break;
 
-  case 168:
-#line 661 "d2_parser.yy" // lalr1.cc:907
-    {
-    if (yystack_[0].value.as< std::string > () == "") {
+  case 168: // tsig_key_secret: "secret" $@40 ":" "constant string"
+#line 665 "d2_parser.yy"
+               {
+    if (yystack_[0].value.as < std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
     }
-    ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr elem(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("secret", elem);
     ctx.leave();
 }
-#line 1521 "d2_parser.cc" // lalr1.cc:907
+#line 1533 "d2_parser.cc"
     break;
 
-  case 169:
-#line 675 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 169: // $@41: %empty
+#line 679 "d2_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 1532 "d2_parser.cc" // lalr1.cc:907
+#line 1544 "d2_parser.cc"
     break;
 
-  case 170:
-#line 680 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 170: // control_socket: "control-socket" $@41 ":" "{" control_socket_params "}"
+#line 684 "d2_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1541 "d2_parser.cc" // lalr1.cc:907
+#line 1553 "d2_parser.cc"
     break;
 
-  case 178:
-#line 696 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 178: // $@42: %empty
+#line 700 "d2_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1549 "d2_parser.cc" // lalr1.cc:907
+#line 1561 "d2_parser.cc"
     break;
 
-  case 179:
-#line 698 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 179: // control_socket_type: "socket-type" $@42 ":" "constant string"
+#line 702 "d2_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 1559 "d2_parser.cc" // lalr1.cc:907
+#line 1571 "d2_parser.cc"
     break;
 
-  case 180:
-#line 704 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 180: // $@43: %empty
+#line 708 "d2_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1567 "d2_parser.cc" // lalr1.cc:907
+#line 1579 "d2_parser.cc"
     break;
 
-  case 181:
-#line 706 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 181: // control_socket_name: "socket-name" $@43 ":" "constant string"
+#line 710 "d2_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1577 "d2_parser.cc" // lalr1.cc:907
+#line 1589 "d2_parser.cc"
     break;
 
-  case 182:
-#line 714 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 182: // $@44: %empty
+#line 718 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1585 "d2_parser.cc" // lalr1.cc:907
+#line 1597 "d2_parser.cc"
     break;
 
-  case 183:
-#line 716 "d2_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 183: // dhcp6_json_object: "Dhcp6" $@44 ":" value
+#line 720 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1594 "d2_parser.cc" // lalr1.cc:907
+#line 1606 "d2_parser.cc"
     break;
 
-  case 184:
-#line 721 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 184: // $@45: %empty
+#line 725 "d2_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1602 "d2_parser.cc" // lalr1.cc:907
+#line 1614 "d2_parser.cc"
     break;
 
-  case 185:
-#line 723 "d2_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 185: // dhcp4_json_object: "Dhcp4" $@45 ":" value
+#line 727 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1611 "d2_parser.cc" // lalr1.cc:907
+#line 1623 "d2_parser.cc"
     break;
 
-  case 186:
-#line 728 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 186: // $@46: %empty
+#line 732 "d2_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1619 "d2_parser.cc" // lalr1.cc:907
+#line 1631 "d2_parser.cc"
     break;
 
-  case 187:
-#line 730 "d2_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
+  case 187: // control_agent_json_object: "Control-agent" $@46 ":" value
+#line 734 "d2_parser.yy"
+              {
+    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1628 "d2_parser.cc" // lalr1.cc:907
+#line 1640 "d2_parser.cc"
     break;
 
-  case 188:
-#line 740 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 188: // $@47: %empty
+#line 744 "d2_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1639 "d2_parser.cc" // lalr1.cc:907
+#line 1651 "d2_parser.cc"
     break;
 
-  case 189:
-#line 745 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 189: // logging_object: "Logging" $@47 ":" "{" logging_params "}"
+#line 749 "d2_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1648 "d2_parser.cc" // lalr1.cc:907
+#line 1660 "d2_parser.cc"
     break;
 
-  case 193:
-#line 762 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 193: // $@48: %empty
+#line 766 "d2_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1659 "d2_parser.cc" // lalr1.cc:907
+#line 1671 "d2_parser.cc"
     break;
 
-  case 194:
-#line 767 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 194: // loggers: "loggers" $@48 ":" "[" loggers_entries "]"
+#line 771 "d2_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1668 "d2_parser.cc" // lalr1.cc:907
+#line 1680 "d2_parser.cc"
     break;
 
-  case 197:
-#line 779 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 197: // $@49: %empty
+#line 783 "d2_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1678 "d2_parser.cc" // lalr1.cc:907
+#line 1690 "d2_parser.cc"
     break;
 
-  case 198:
-#line 783 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 198: // logger_entry: "{" $@49 logger_params "}"
+#line 787 "d2_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1686 "d2_parser.cc" // lalr1.cc:907
+#line 1698 "d2_parser.cc"
     break;
 
-  case 208:
-#line 800 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 209: // $@50: %empty
+#line 805 "d2_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1694 "d2_parser.cc" // lalr1.cc:907
+#line 1706 "d2_parser.cc"
     break;
 
-  case 209:
-#line 802 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 210: // name: "name" $@50 ":" "constant string"
+#line 807 "d2_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1704 "d2_parser.cc" // lalr1.cc:907
+#line 1716 "d2_parser.cc"
     break;
 
-  case 210:
-#line 808 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 211: // debuglevel: "debuglevel" ":" "integer"
+#line 813 "d2_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1713 "d2_parser.cc" // lalr1.cc:907
+#line 1725 "d2_parser.cc"
     break;
 
-  case 211:
-#line 812 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 212: // $@51: %empty
+#line 817 "d2_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1721 "d2_parser.cc" // lalr1.cc:907
+#line 1733 "d2_parser.cc"
     break;
 
-  case 212:
-#line 814 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 213: // severity: "severity" $@51 ":" "constant string"
+#line 819 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1731 "d2_parser.cc" // lalr1.cc:907
+#line 1743 "d2_parser.cc"
     break;
 
-  case 213:
-#line 820 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 214: // $@52: %empty
+#line 825 "d2_parser.yy"
+                       {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1751 "d2_parser.cc"
+    break;
+
+  case 215: // rate_limit: "rate-limit" $@52 ":" "constant string"
+#line 827 "d2_parser.yy"
+               {
+    ElementPtr rl(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+}
+#line 1761 "d2_parser.cc"
+    break;
+
+  case 216: // $@53: %empty
+#line 833 "d2_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1742 "d2_parser.cc" // lalr1.cc:907
+#line 1772 "d2_parser.cc"
     break;
 
-  case 214:
-#line 825 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 217: // output_options_list: "output_options" $@53 ":" "[" output_options_list_content "]"
+#line 838 "d2_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1751 "d2_parser.cc" // lalr1.cc:907
+#line 1781 "d2_parser.cc"
     break;
 
-  case 217:
-#line 834 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 220: // $@54: %empty
+#line 847 "d2_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1761 "d2_parser.cc" // lalr1.cc:907
+#line 1791 "d2_parser.cc"
     break;
 
-  case 218:
-#line 838 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 221: // output_entry: "{" $@54 output_params_list "}"
+#line 851 "d2_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1769 "d2_parser.cc" // lalr1.cc:907
+#line 1799 "d2_parser.cc"
     break;
 
-  case 225:
-#line 852 "d2_parser.yy" // lalr1.cc:907
-    {
+  case 231: // $@55: %empty
+#line 868 "d2_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1777 "d2_parser.cc" // lalr1.cc:907
+#line 1807 "d2_parser.cc"
     break;
 
-  case 226:
-#line 854 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 232: // output: "output" $@55 ":" "constant string"
+#line 870 "d2_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1787 "d2_parser.cc" // lalr1.cc:907
+#line 1817 "d2_parser.cc"
     break;
 
-  case 227:
-#line 860 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 233: // flush: "flush" ":" "boolean"
+#line 876 "d2_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1796 "d2_parser.cc" // lalr1.cc:907
+#line 1826 "d2_parser.cc"
     break;
 
-  case 228:
-#line 865 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 234: // maxsize: "maxsize" ":" "integer"
+#line 881 "d2_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1805 "d2_parser.cc" // lalr1.cc:907
+#line 1835 "d2_parser.cc"
     break;
 
-  case 229:
-#line 870 "d2_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 235: // maxver: "maxver" ":" "integer"
+#line 886 "d2_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1814 "d2_parser.cc" // lalr1.cc:907
+#line 1844 "d2_parser.cc"
+    break;
+
+  case 236: // async: "async" ":" "boolean"
+#line 891 "d2_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1853 "d2_parser.cc"
+    break;
+
+  case 237: // queue_size: "queue-size" ":" "integer"
+#line 896 "d2_parser.yy"
+                                     {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", size);
+}
+#line 1862 "d2_parser.cc"
+    break;
+
+  case 238: // $@56: %empty
+#line 901 "d2_parser.yy"
+                                 {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1870 "d2_parser.cc"
+    break;
+
+  case 239: // overflow_policy: "overflow-policy" $@56 ":" "constant string"
+#line 903 "d2_parser.yy"
+               {
+    ElementPtr policy(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 1880 "d2_parser.cc"
     break;
 
 
-#line 1818 "d2_parser.cc" // lalr1.cc:907
+#line 1884 "d2_parser.cc"
+
             default:
               break;
             }
@@ -1822,6 +1889,7 @@ namespace isc { namespace d2 {
 #if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
@@ -1829,13 +1897,13 @@ namespace isc { namespace d2 {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1844,7 +1912,9 @@ namespace isc { namespace d2 {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1855,7 +1925,7 @@ namespace isc { namespace d2 {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1872,68 +1942,81 @@ namespace isc { namespace d2 {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1941,6 +2024,7 @@ namespace isc { namespace d2 {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1974,18 +2058,103 @@ namespace isc { namespace d2 {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  D2Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  D2Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  D2Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // D2Parser::context.
+  D2Parser::context::context (const D2Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  D2Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
 
+
+  int
+  D2Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -2004,41 +2173,32 @@ namespace isc { namespace d2 {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  D2Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -2059,11 +2219,11 @@ namespace isc { namespace d2 {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -2079,45 +2239,47 @@ namespace isc { namespace d2 {
   const short
   D2Parser::yypact_[] =
   {
-      50,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-      12,     2,     1,    23,    42,    11,    44,    17,    59,    65,
+      44,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
+      14,     2,     1,    23,    45,    11,    49,    17,    59,    46,
      -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
      -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,     2,    18,
-       8,     9,    15,    87,    40,    99,    13,   100,   -92,   102,
-     122,   129,   118,   131,   -92,   -92,   -92,   -92,   -92,   137,
-     -92,    49,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   139,
+     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,     2,    16,
+       8,     9,    48,    67,    55,    79,    13,    98,   -92,   118,
+     104,   122,   125,   131,   -92,   -92,   -92,   -92,   -92,   137,
+     -92,    41,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   139,
      147,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-      78,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
+      64,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
      -92,   -92,   -92,   -92,   157,   -92,   -92,   -92,   -92,   -92,
-      79,   -92,   -92,   -92,   -92,   -92,   -92,   164,   132,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,    85,   -92,   -92,   -92,
-     -92,   -92,   167,   150,   -92,   -92,   158,   -92,   -92,   -92,
-     -92,   106,   -92,   -92,   -92,   -92,   -92,    47,   -92,   -92,
-       2,     2,   -92,   107,   170,   171,   172,   173,   174,   -92,
-       8,   -92,   175,   123,   125,   177,   179,   180,   181,   182,
-     183,   184,   185,     9,   -92,   186,   134,   188,   189,    15,
-     -92,    15,   -92,    87,   190,   191,   192,    40,   -92,    40,
-     -92,    99,   193,   141,   195,    13,   -92,    13,   100,   -92,
-     -92,   -92,   196,     2,     2,     2,   194,   201,   -92,   153,
-     -92,   -92,    22,   198,   203,   155,   205,   206,   209,   208,
-     -92,   160,   -92,   161,   168,   -92,   112,   -92,   169,   215,
-     176,   -92,   113,   -92,   178,   -92,   187,   -92,   114,   -92,
-       2,   -92,   -92,   -92,     9,   197,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -12,   -12,    87,    55,   -92,   -92,
-     -92,   -92,   -92,   100,   -92,   -92,   -92,   -92,   -92,   -92,
-     115,   -92,   116,   -92,   -92,   -92,   -92,   124,   -92,   -92,
-     -92,   146,   216,   -92,   -92,   -92,   -92,   -92,   149,   -92,
-     -92,   -92,    89,   -92,   199,   197,   -92,   217,   -12,   -92,
-     -92,   -92,   219,   222,    55,   -92,   -92,   223,   -92,   224,
-     -92,   200,   202,   -92,   220,    99,   -92,   -92,   -92,   165,
-     -92,   225,    33,   220,   -92,   -92,   -92,   -92,   226,   -92,
-     -92,   -92,   -92,   152,   -92,   -92,   -92,   -92,   -92,   -92,
-     229,   232,   204,   233,    33,   -92,   207,   234,   -92,   210,
-     -92,   -92,   231,   -92,   -92,   166,   -92,    39,   231,   -92,
-     -92,   236,   237,   238,   156,   -92,   -92,   -92,   -92,   -92,
-     -92,   240,   211,   212,   218,    39,   -92,   221,   -92,   -92,
-     -92,   -92,   -92
+     101,   -92,   -92,   -92,   -92,   -92,   -92,   129,   150,   -92,
+     -92,   -92,   -92,   -92,   -92,   -92,   103,   -92,   -92,   -92,
+     -92,   -92,   169,   159,   -92,   -92,   172,   -92,   -92,   -92,
+     -92,   111,   -92,   -92,   -92,   -92,   -92,    47,   -92,   -92,
+       2,     2,   -92,   119,   173,   174,   176,   177,   178,   -92,
+       8,   -92,   179,   123,   126,   181,   182,   184,   185,   186,
+     187,   188,   189,     9,   -92,   190,   134,   192,   193,    48,
+     -92,    48,   -92,    67,   194,   195,   196,    55,   -92,    55,
+     -92,    79,   197,   142,   204,    13,   -92,    13,    98,   -92,
+     -92,   -92,   205,     2,     2,     2,   203,   206,   -92,   151,
+     -92,   -92,    22,   191,   207,   155,   209,   210,   214,   213,
+     -92,   161,   -92,   162,   163,   -92,   113,   -92,   164,   220,
+     170,   -92,   114,   -92,   171,   -92,   175,   -92,   115,   -92,
+       2,   -92,   -92,   -92,     9,   198,   -92,   -92,   -92,   -92,
+     -92,   -92,   -92,   -92,   -14,   -14,    67,    25,   -92,   -92,
+     -92,   -92,   -92,    98,   -92,   -92,   -92,   -92,   -92,   -92,
+     117,   -92,   124,   -92,   -92,   -92,   -92,   146,   -92,   -92,
+     -92,   149,   221,   -92,   -92,   -92,   -92,   -92,   152,   -92,
+     -92,   -92,   166,   -92,   222,   198,   -92,   224,   -14,   -92,
+     -92,   -92,   225,   228,    25,   -92,   -92,   229,   -92,   232,
+     -92,   180,   183,   -92,   226,    79,   -92,   -92,   -92,   167,
+     -92,   233,    15,   226,   -92,   -92,   -92,   -92,   234,   -92,
+     -92,   -92,   -92,   -92,   156,   -92,   -92,   -92,   -92,   -92,
+     -92,   -92,   237,   238,   199,   240,   241,    15,   -92,   201,
+     242,   -92,   202,   208,   -92,   -92,   239,   -92,   -92,   -92,
+     168,   -92,    43,   239,   -92,   -92,   245,   246,   247,   248,
+     251,   -92,   160,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
+     -92,   -92,   252,   200,   212,   215,   211,   216,   253,    43,
+     -92,   218,   -92,   -92,   -92,   -92,   -92,   219,   -92,   -92,
+     -92
   };
 
   const unsigned char
@@ -2155,39 +2317,42 @@ namespace isc { namespace d2 {
      173,   174,     0,    53,     0,     0,   189,     0,     0,    85,
       87,   142,     0,     0,     0,   170,   119,     0,   191,     0,
       91,     0,     0,   172,     0,    98,   179,   181,   197,     0,
-     195,     0,     0,     0,   194,    95,   208,   213,     0,   211,
-     207,   205,   206,     0,   199,   201,   203,   204,   202,   196,
-       0,     0,     0,     0,     0,   198,     0,     0,   210,     0,
-     200,   209,     0,   212,   217,     0,   215,     0,     0,   214,
-     225,     0,     0,     0,     0,   219,   221,   222,   223,   224,
-     216,     0,     0,     0,     0,     0,   218,     0,   227,   228,
-     229,   220,   226
+     195,     0,     0,     0,   194,    95,   209,   216,     0,   214,
+     212,   208,   206,   207,     0,   199,   201,   203,   205,   204,
+     202,   196,     0,     0,     0,     0,     0,     0,   198,     0,
+       0,   211,     0,     0,   200,   210,     0,   215,   213,   220,
+       0,   218,     0,     0,   217,   231,     0,     0,     0,     0,
+       0,   238,     0,   222,   224,   225,   226,   227,   228,   229,
+     230,   219,     0,     0,     0,     0,     0,     0,     0,     0,
+     221,     0,   233,   234,   235,   236,   237,     0,   223,   232,
+     239
   };
 
   const signed char
   D2Parser::yypgoto_[] =
   {
      -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -38,   -92,    31,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -50,   -92,   -92,   -92,    86,   -92,   -92,   -92,
-     -92,     3,    76,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
+     -92,   -38,   -92,    50,   -92,   -92,   -92,   -92,   -92,   -92,
+     -92,   -92,   -50,   -92,   -92,   -92,    99,   -92,   -92,   -92,
+     -92,    26,    85,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
      -92,   -92,   -51,   -92,   -39,   -92,   -92,   -92,   -92,   -92,
-      -5,   -92,   -47,   -92,   -92,   -92,   -92,   -63,   -92,    64,
-     -92,   -92,   -92,    68,    72,   -92,   -92,   -92,   -92,   -92,
-     -92,   -92,   -92,    -3,    66,   -92,   -92,   -92,    70,    67,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,    20,
-     -92,    90,   -92,   -92,   -92,    93,   101,   -92,   -92,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -36,   -92,   -92,
+      12,   -92,   -32,   -92,   -92,   -92,   -92,   -46,   -92,    84,
+     -92,   -92,   -92,    91,    94,   -92,   -92,   -92,   -92,   -92,
+     -92,   -92,   -92,    19,    86,   -92,   -92,   -92,    88,    92,
+     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,    30,
+     -92,   105,   -92,   -92,   -92,   108,   112,   -92,   -92,   -92,
+     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -12,   -92,   -92,
      -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
-     -92,   -17,   -92,   -92,   -92,   -44,   -92,   -92,   -62,   -92,
-     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -77,   -92,   -92,
-     -91,   -92,   -92,   -92,   -92,   -92
+     -92,    -5,   -92,   -92,   -92,   -30,   -92,   -92,   -53,   -92,
+     -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -92,   -68,
+     -92,   -92,   -91,   -92,   -92,   -92,   -92,   -92,   -92,   -92,
+     -92,   -92
   };
 
   const short
   D2Parser::yydefgoto_[] =
   {
-      -1,    10,    11,    12,    13,    14,    15,    16,    17,    18,
+       0,    10,    11,    12,    13,    14,    15,    16,    17,    18,
       19,    28,    29,    30,    49,   252,    62,    63,    31,    48,
       59,    60,    89,    33,    50,    71,    72,    73,   157,    35,
       51,    90,    91,    92,   162,    93,    94,    95,   165,   249,
@@ -2199,156 +2364,160 @@ namespace isc { namespace d2 {
      118,   119,   181,    37,    52,   110,   111,   112,   178,   113,
      175,   114,   115,   177,   102,   172,   288,   289,   290,   302,
      291,   303,    74,   154,    75,   155,    76,   156,    77,   158,
-     272,   273,   274,   294,   319,   320,   322,   333,   334,   335,
-     340,   336,   337,   343,   338,   341,   355,   356,   357,   364,
-     365,   366,   371,   367,   368,   369
+     272,   273,   274,   294,   319,   320,   322,   334,   335,   336,
+     342,   337,   338,   346,   339,   345,   340,   343,   360,   361,
+     362,   372,   373,   374,   382,   375,   376,   377,   378,   379,
+     380,   388
   };
 
-  const unsigned short
+  const short
   D2Parser::yytable_[] =
   {
       70,   108,   107,   124,   123,   139,   138,    21,    32,    22,
-      58,    23,    20,   109,   275,   125,    38,   140,    64,    65,
+      58,    23,   275,   109,    20,   125,    38,   140,    64,    65,
       66,    67,    42,    78,    79,    80,    81,   135,   136,    82,
       34,    83,    84,    85,    86,    83,    84,    83,    84,    87,
-     247,   248,   137,    88,    69,    68,   103,   104,   105,    36,
-     198,    40,   160,   199,   106,    83,    84,   161,    24,    25,
-      26,    27,    83,    84,    69,    69,    44,   120,   121,    69,
-      46,    69,   326,   327,    61,   328,   329,    83,    84,   122,
-     360,   173,   179,   361,   362,   363,   174,   180,   187,    69,
-     283,   284,   198,   188,   116,   306,    69,     1,     2,     3,
-       4,     5,     6,     7,     8,     9,   131,   146,   149,   195,
-      70,    69,   200,   201,   196,   179,   187,   195,   173,   295,
-     261,   265,   268,   293,   296,   150,   152,   298,   108,   107,
-     108,   107,   299,   151,   153,   183,   124,   123,   124,   123,
+     247,   248,   137,    88,   160,    68,    69,    83,    84,   161,
+     198,    46,    36,   199,   326,   327,    40,   328,   329,   330,
+     283,   284,    24,    25,    26,    27,    44,   173,    69,    69,
+      83,    84,   174,    69,   116,    69,    61,    83,    84,   103,
+     104,   105,   120,   121,   365,    69,   131,   106,   366,   367,
+     368,   369,   370,   371,   122,     1,     2,     3,     4,     5,
+       6,     7,     8,     9,   179,   146,   187,   150,    69,   180,
+      70,   188,   200,   201,   195,    69,   179,   187,   195,   196,
+     173,   261,   265,   268,   149,   293,   151,   295,   108,   107,
+     108,   107,   296,   152,   153,   182,   124,   123,   124,   123,
      109,   159,   109,   163,   139,   138,   139,   138,   125,   298,
-     125,   164,   304,   191,   300,   344,   140,   305,   140,   375,
-     345,   176,   193,   202,   376,   241,   242,   243,   323,   358,
-     182,   324,   359,   190,   203,   204,   205,   206,   207,   209,
-     210,   212,   211,   213,   214,   215,   216,   217,   218,   219,
-     221,   222,   223,   224,   228,   229,   230,   234,   235,   236,
-     240,   244,   269,   307,   276,   276,   286,   285,   245,   246,
-      22,   253,   254,   255,   256,   257,   258,   259,   287,   250,
-     263,   309,   301,   311,   260,   262,   312,   318,   314,   315,
-     342,   325,   264,   346,   266,   271,   347,   349,   354,   352,
-     372,   373,   374,   267,   377,   251,   208,   270,   276,   220,
-     281,   310,   321,   286,   285,   233,   316,   232,   317,   231,
-     292,   348,   237,   351,   239,   287,   353,   238,   313,   379,
-     378,   331,   330,   227,   226,   380,   282,   382,   308,   339,
-     225,   370,   350,   332,   381,     0,     0,     0,     0,     0,
-       0,     0,     0,   331,   330,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   332
+     125,   164,   298,   183,   299,   304,   140,   300,   140,   347,
+     305,   176,   191,   389,   348,   241,   242,   243,   390,   198,
+     323,   363,   306,   324,   364,   190,   193,   203,   204,   202,
+     205,   206,   207,   209,   210,   212,   213,   211,   214,   215,
+     216,   217,   218,   219,   221,   222,   223,   224,   228,   229,
+     230,   234,   269,   235,   276,   276,   286,   285,   236,   240,
+     244,   246,   250,   245,    22,   253,   254,   255,   287,   256,
+     257,   258,   259,   260,   262,   263,   307,   301,   309,   311,
+     264,   266,   312,   318,   314,   267,   271,   315,   344,   325,
+     316,   349,   350,   317,   352,   353,   359,   356,   276,   383,
+     384,   385,   386,   286,   285,   387,   391,   397,   220,   208,
+     351,   355,   357,   392,   251,   287,   310,   281,   358,   321,
+     270,   332,   331,   393,   395,   233,   394,   396,   399,   400,
+     232,   231,   292,   333,   239,   238,   282,   237,   227,   226,
+     308,   225,   313,   341,   354,   381,   332,   331,   398,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,   333
   };
 
   const short
   D2Parser::yycheck_[] =
   {
       50,    52,    52,    54,    54,    56,    56,     5,     7,     7,
-      48,     9,     0,    52,    26,    54,     5,    56,    10,    11,
+      48,     9,    26,    52,     0,    54,     5,    56,    10,    11,
       12,    13,     5,    14,    15,    16,    17,    14,    15,    20,
        7,    22,    23,    24,    25,    22,    23,    22,    23,    30,
-      18,    19,    29,    34,    56,    37,    31,    32,    33,     7,
-       3,     7,     3,     6,    39,    22,    23,     8,    56,    57,
-      58,    59,    22,    23,    56,    56,     7,    27,    28,    56,
-       5,    56,    39,    40,    56,    42,    43,    22,    23,    39,
-      41,     3,     3,    44,    45,    46,     8,     8,     3,    56,
-      35,    36,     3,     8,     7,     6,    56,    47,    48,    49,
-      50,    51,    52,    53,    54,    55,     7,     7,     6,     3,
-     160,    56,   150,   151,     8,     3,     3,     3,     3,     3,
-       8,     8,     8,     8,     8,     3,     8,     3,   179,   179,
-     181,   181,     8,     4,     3,     3,   187,   187,   189,   189,
+      18,    19,    29,    34,     3,    37,    60,    22,    23,     8,
+       3,     5,     7,     6,    39,    40,     7,    42,    43,    44,
+      35,    36,    60,    61,    62,    63,     7,     3,    60,    60,
+      22,    23,     8,    60,     7,    60,    60,    22,    23,    31,
+      32,    33,    27,    28,    41,    60,     7,    39,    45,    46,
+      47,    48,    49,    50,    39,    51,    52,    53,    54,    55,
+      56,    57,    58,    59,     3,     7,     3,     3,    60,     8,
+     160,     8,   150,   151,     3,    60,     3,     3,     3,     8,
+       3,     8,     8,     8,     6,     8,     4,     3,   179,   179,
+     181,   181,     8,     8,     3,     6,   187,   187,   189,   189,
      179,     4,   181,     4,   195,   195,   197,   197,   187,     3,
      189,     4,     3,     3,     8,     3,   195,     8,   197,     3,
-       8,     4,     4,    56,     8,   203,   204,   205,     3,     3,
-       6,     6,     6,     6,     4,     4,     4,     4,     4,     4,
-      57,     4,    57,     4,     4,     4,     4,     4,     4,     4,
-       4,    57,     4,     4,     4,     4,     4,     4,    57,     4,
-       4,     7,   240,     4,   254,   255,   257,   257,     7,    56,
-       7,    56,     7,     7,     5,     7,    56,    56,   257,    21,
-       5,     4,     6,     4,    56,    56,     4,     7,     5,     5,
-       4,     6,    56,     4,    56,    38,     4,     4,     7,     5,
-       4,     4,     4,    56,     4,   214,   160,   244,   298,   173,
-     255,   298,   315,   304,   304,   191,    56,   189,    56,   187,
-     263,    57,   195,    56,   198,   304,    56,   197,   304,    57,
-      59,   322,   322,   183,   181,    57,   256,    56,   295,   323,
-     179,   358,   344,   322,   375,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   344,   344,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   344
+       8,     4,     3,     3,     8,   203,   204,   205,     8,     3,
+       3,     3,     6,     6,     6,     6,     4,     4,     4,    60,
+       4,     4,     4,     4,    61,     4,     4,    61,     4,     4,
+       4,     4,     4,     4,     4,    61,     4,     4,     4,     4,
+       4,     4,   240,    61,   254,   255,   257,   257,     4,     4,
+       7,    60,    21,     7,     7,    60,     7,     7,   257,     5,
+       7,    60,    60,    60,    60,     5,     4,     6,     4,     4,
+      60,    60,     4,     7,     5,    60,    38,     5,     4,     6,
+      60,     4,     4,    60,     4,     4,     7,     5,   298,     4,
+       4,     4,     4,   304,   304,     4,     4,     4,   173,   160,
+      61,    60,    60,    63,   214,   304,   298,   255,    60,   315,
+     244,   322,   322,    61,    63,   191,    61,    61,    60,    60,
+     189,   187,   263,   322,   198,   197,   256,   195,   183,   181,
+     295,   179,   304,   323,   347,   363,   347,   347,   389,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   347
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    47,    48,    49,    50,    51,    52,    53,    54,    55,
-      61,    62,    63,    64,    65,    66,    67,    68,    69,    70,
-       0,     5,     7,     9,    56,    57,    58,    59,    71,    72,
-      73,    78,     7,    83,     7,    89,     7,   153,     5,   147,
-       7,   121,     5,   115,     7,   136,     5,   131,    79,    74,
-      84,    90,   154,   148,   122,   116,   137,   132,    71,    80,
-      81,    56,    76,    77,    10,    11,    12,    13,    37,    56,
-      82,    85,    86,    87,   172,   174,   176,   178,    14,    15,
-      16,    17,    20,    22,    23,    24,    25,    30,    34,    82,
-      91,    92,    93,    95,    96,    97,   100,   102,   104,   106,
-     108,   145,   164,    31,    32,    33,    39,    82,   102,   104,
-     155,   156,   157,   159,   161,   162,     7,   149,   150,   151,
-      27,    28,    39,    82,   102,   104,   123,   124,   125,   127,
-     129,     7,   117,   118,   119,    14,    15,    29,    82,   102,
-     104,   138,   139,   140,   142,   144,     7,   133,   134,     6,
-       3,     4,     8,     3,   173,   175,   177,    88,   179,     4,
-       3,     8,    94,     4,     4,    98,   101,   103,   105,   107,
-     109,   146,   165,     3,     8,   160,     4,   163,   158,     3,
-       8,   152,     6,     3,   128,   130,   126,     3,     8,   120,
-       6,     3,   143,     4,   141,     3,     8,   135,     3,     6,
-      71,    71,    56,     4,     4,     4,     4,     4,    86,     4,
-      57,    57,     4,     4,     4,     4,     4,     4,     4,     4,
-      92,     4,    57,     4,     4,   156,   155,   151,     4,     4,
-       4,   124,   123,   119,     4,    57,     4,   139,   138,   134,
-       4,    71,    71,    71,     7,     7,    56,    18,    19,    99,
-      21,    73,    75,    56,     7,     7,     5,     7,    56,    56,
-      56,     8,    56,     5,    56,     8,    56,    56,     8,    71,
-      91,    38,   180,   181,   182,    26,    82,   110,   111,   112,
-     113,   110,   149,    35,    36,    82,   102,   104,   166,   167,
-     168,   170,   133,     8,   183,     3,     8,   114,     3,     8,
-       8,     6,   169,   171,     3,     8,     6,     4,   181,     4,
-     112,     4,     4,   167,     5,     5,    56,    56,     7,   184,
-     185,   117,   186,     3,     6,     6,    39,    40,    42,    43,
-      82,   102,   104,   187,   188,   189,   191,   192,   194,   185,
-     190,   195,     4,   193,     3,     8,     4,     4,    57,     4,
-     188,    56,     5,    56,     7,   196,   197,   198,     3,     6,
-      41,    44,    45,    46,   199,   200,   201,   203,   204,   205,
-     197,   202,     4,     4,     4,     3,     8,     4,    59,    57,
-      57,   200,    56
+       0,    51,    52,    53,    54,    55,    56,    57,    58,    59,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+       0,     5,     7,     9,    60,    61,    62,    63,    75,    76,
+      77,    82,     7,    87,     7,    93,     7,   157,     5,   151,
+       7,   125,     5,   119,     7,   140,     5,   135,    83,    78,
+      88,    94,   158,   152,   126,   120,   141,   136,    75,    84,
+      85,    60,    80,    81,    10,    11,    12,    13,    37,    60,
+      86,    89,    90,    91,   176,   178,   180,   182,    14,    15,
+      16,    17,    20,    22,    23,    24,    25,    30,    34,    86,
+      95,    96,    97,    99,   100,   101,   104,   106,   108,   110,
+     112,   149,   168,    31,    32,    33,    39,    86,   106,   108,
+     159,   160,   161,   163,   165,   166,     7,   153,   154,   155,
+      27,    28,    39,    86,   106,   108,   127,   128,   129,   131,
+     133,     7,   121,   122,   123,    14,    15,    29,    86,   106,
+     108,   142,   143,   144,   146,   148,     7,   137,   138,     6,
+       3,     4,     8,     3,   177,   179,   181,    92,   183,     4,
+       3,     8,    98,     4,     4,   102,   105,   107,   109,   111,
+     113,   150,   169,     3,     8,   164,     4,   167,   162,     3,
+       8,   156,     6,     3,   132,   134,   130,     3,     8,   124,
+       6,     3,   147,     4,   145,     3,     8,   139,     3,     6,
+      75,    75,    60,     4,     4,     4,     4,     4,    90,     4,
+      61,    61,     4,     4,     4,     4,     4,     4,     4,     4,
+      96,     4,    61,     4,     4,   160,   159,   155,     4,     4,
+       4,   128,   127,   123,     4,    61,     4,   143,   142,   138,
+       4,    75,    75,    75,     7,     7,    60,    18,    19,   103,
+      21,    77,    79,    60,     7,     7,     5,     7,    60,    60,
+      60,     8,    60,     5,    60,     8,    60,    60,     8,    75,
+      95,    38,   184,   185,   186,    26,    86,   114,   115,   116,
+     117,   114,   153,    35,    36,    86,   106,   108,   170,   171,
+     172,   174,   137,     8,   187,     3,     8,   118,     3,     8,
+       8,     6,   173,   175,     3,     8,     6,     4,   185,     4,
+     116,     4,     4,   171,     5,     5,    60,    60,     7,   188,
+     189,   121,   190,     3,     6,     6,    39,    40,    42,    43,
+      44,    86,   106,   108,   191,   192,   193,   195,   196,   198,
+     200,   189,   194,   201,     4,   199,   197,     3,     8,     4,
+       4,    61,     4,     4,   192,    60,     5,    60,    60,     7,
+     202,   203,   204,     3,     6,    41,    45,    46,    47,    48,
+      49,    50,   205,   206,   207,   209,   210,   211,   212,   213,
+     214,   203,   208,     4,     4,     4,     4,     4,   215,     3,
+       8,     4,    63,    61,    61,    63,    61,     4,   206,    60,
+      60
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    60,    62,    61,    63,    61,    64,    61,    65,    61,
-      66,    61,    67,    61,    68,    61,    69,    61,    70,    61,
-      71,    71,    71,    71,    71,    71,    71,    72,    74,    73,
-      75,    76,    76,    77,    77,    79,    78,    80,    80,    81,
-      81,    82,    84,    83,    85,    85,    86,    86,    86,    86,
-      86,    86,    88,    87,    90,    89,    91,    91,    92,    92,
-      92,    92,    92,    92,    92,    92,    92,    92,    92,    92,
-      94,    93,    95,    96,    98,    97,    99,    99,   101,   100,
-     103,   102,   105,   104,   107,   106,   109,   108,   110,   110,
-     111,   111,   112,   112,   114,   113,   116,   115,   117,   117,
-     118,   118,   120,   119,   122,   121,   123,   123,   124,   124,
-     124,   124,   124,   124,   126,   125,   128,   127,   130,   129,
-     132,   131,   133,   133,   135,   134,   137,   136,   138,   138,
-     139,   139,   139,   139,   139,   139,   141,   140,   143,   142,
-     144,   146,   145,   148,   147,   149,   149,   150,   150,   152,
-     151,   154,   153,   155,   155,   156,   156,   156,   156,   156,
-     156,   156,   158,   157,   160,   159,   161,   163,   162,   165,
-     164,   166,   166,   167,   167,   167,   167,   167,   169,   168,
-     171,   170,   173,   172,   175,   174,   177,   176,   179,   178,
-     180,   180,   181,   183,   182,   184,   184,   186,   185,   187,
-     187,   188,   188,   188,   188,   188,   188,   188,   190,   189,
-     191,   193,   192,   195,   194,   196,   196,   198,   197,   199,
-     199,   200,   200,   200,   200,   202,   201,   203,   204,   205
+       0,    64,    66,    65,    67,    65,    68,    65,    69,    65,
+      70,    65,    71,    65,    72,    65,    73,    65,    74,    65,
+      75,    75,    75,    75,    75,    75,    75,    76,    78,    77,
+      79,    80,    80,    81,    81,    83,    82,    84,    84,    85,
+      85,    86,    88,    87,    89,    89,    90,    90,    90,    90,
+      90,    90,    92,    91,    94,    93,    95,    95,    96,    96,
+      96,    96,    96,    96,    96,    96,    96,    96,    96,    96,
+      98,    97,    99,   100,   102,   101,   103,   103,   105,   104,
+     107,   106,   109,   108,   111,   110,   113,   112,   114,   114,
+     115,   115,   116,   116,   118,   117,   120,   119,   121,   121,
+     122,   122,   124,   123,   126,   125,   127,   127,   128,   128,
+     128,   128,   128,   128,   130,   129,   132,   131,   134,   133,
+     136,   135,   137,   137,   139,   138,   141,   140,   142,   142,
+     143,   143,   143,   143,   143,   143,   145,   144,   147,   146,
+     148,   150,   149,   152,   151,   153,   153,   154,   154,   156,
+     155,   158,   157,   159,   159,   160,   160,   160,   160,   160,
+     160,   160,   162,   161,   164,   163,   165,   167,   166,   169,
+     168,   170,   170,   171,   171,   171,   171,   171,   173,   172,
+     175,   174,   177,   176,   179,   178,   181,   180,   183,   182,
+     184,   184,   185,   187,   186,   188,   188,   190,   189,   191,
+     191,   192,   192,   192,   192,   192,   192,   192,   192,   194,
+     193,   195,   197,   196,   199,   198,   201,   200,   202,   202,
+     204,   203,   205,   205,   206,   206,   206,   206,   206,   206,
+     206,   208,   207,   209,   210,   211,   212,   213,   215,   214
   };
 
-  const unsigned char
+  const signed char
   D2Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -2371,20 +2540,21 @@ namespace isc { namespace d2 {
        6,     1,     3,     1,     1,     1,     1,     1,     0,     4,
        0,     4,     0,     4,     0,     4,     0,     4,     0,     6,
        1,     3,     1,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     0,     4,     0,     4,     0,     6,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     3,     3,     3,     3,     3,     0,     4
   };
 
 
-
+#if D2_PARSER_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const D2Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"Dhcp4\"",
   "\"Control-agent\"", "\"DhcpDdns\"", "\"ip-address\"", "\"port\"",
   "\"dns-server-timeout\"", "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"",
   "\"ncr-format\"", "\"JSON\"", "\"user-context\"", "\"comment\"",
@@ -2393,7 +2563,8 @@ namespace isc { namespace d2 {
   "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"control-socket\"",
   "\"socket-type\"", "\"socket-name\"", "\"Logging\"", "\"loggers\"",
   "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"",
+  "\"rate-limit\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
+  "\"maxver\"", "\"async\"", "\"queue-size\"", "\"overflow-policy\"",
   "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS", "SUB_TSIG_KEY",
   "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER",
   "SUB_DNS_SERVERS", "\"constant string\"", "\"integer\"",
@@ -2426,59 +2597,61 @@ namespace isc { namespace d2 {
   "control_agent_json_object", "$@46", "logging_object", "$@47",
   "logging_params", "logging_param", "loggers", "$@48", "loggers_entries",
   "logger_entry", "$@49", "logger_params", "logger_param", "name", "$@50",
-  "debuglevel", "severity", "$@51", "output_options_list", "$@52",
-  "output_options_list_content", "output_entry", "$@53",
-  "output_params_list", "output_params", "output", "$@54", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "debuglevel", "severity", "$@51", "rate_limit", "$@52",
+  "output_options_list", "$@53", "output_options_list_content",
+  "output_entry", "$@54", "output_params_list", "output_params", "output",
+  "$@55", "flush", "maxsize", "maxver", "async", "queue_size",
+  "overflow_policy", "$@56", YY_NULLPTR
   };
+#endif
+
 
 #if D2_PARSER_DEBUG
-  const unsigned short
+  const short
   D2Parser::yyrline_[] =
   {
-       0,   124,   124,   124,   125,   125,   126,   126,   127,   127,
-     128,   128,   129,   129,   130,   130,   131,   131,   132,   132,
-     140,   141,   142,   143,   144,   145,   146,   149,   154,   154,
-     165,   168,   169,   172,   176,   183,   183,   190,   191,   194,
-     198,   209,   219,   219,   231,   232,   236,   237,   238,   239,
-     240,   241,   246,   246,   256,   256,   264,   265,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     283,   283,   291,   299,   308,   308,   316,   317,   320,   320,
-     328,   328,   353,   353,   380,   380,   390,   390,   400,   401,
-     404,   405,   408,   409,   414,   414,   424,   424,   431,   432,
-     435,   436,   439,   439,   447,   447,   454,   455,   458,   459,
-     460,   461,   462,   463,   467,   467,   479,   479,   491,   491,
-     501,   501,   508,   509,   512,   512,   520,   520,   527,   528,
-     531,   532,   533,   534,   535,   536,   539,   539,   551,   551,
-     559,   573,   573,   583,   583,   590,   591,   594,   595,   598,
-     598,   606,   606,   615,   616,   619,   620,   621,   622,   623,
-     624,   625,   628,   628,   640,   640,   651,   659,   659,   675,
-     675,   685,   686,   689,   690,   691,   692,   693,   696,   696,
-     704,   704,   714,   714,   721,   721,   728,   728,   740,   740,
-     753,   754,   758,   762,   762,   774,   775,   779,   779,   787,
-     788,   791,   792,   793,   794,   795,   796,   797,   800,   800,
-     808,   812,   812,   820,   820,   830,   831,   834,   834,   842,
-     843,   846,   847,   848,   849,   852,   852,   860,   865,   870
+       0,   128,   128,   128,   129,   129,   130,   130,   131,   131,
+     132,   132,   133,   133,   134,   134,   135,   135,   136,   136,
+     144,   145,   146,   147,   148,   149,   150,   153,   158,   158,
+     169,   172,   173,   176,   180,   187,   187,   194,   195,   198,
+     202,   213,   223,   223,   235,   236,   240,   241,   242,   243,
+     244,   245,   250,   250,   260,   260,   268,   269,   273,   274,
+     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
+     287,   287,   295,   303,   312,   312,   320,   321,   324,   324,
+     332,   332,   357,   357,   384,   384,   394,   394,   404,   405,
+     408,   409,   412,   413,   418,   418,   428,   428,   435,   436,
+     439,   440,   443,   443,   451,   451,   458,   459,   462,   463,
+     464,   465,   466,   467,   471,   471,   483,   483,   495,   495,
+     505,   505,   512,   513,   516,   516,   524,   524,   531,   532,
+     535,   536,   537,   538,   539,   540,   543,   543,   555,   555,
+     563,   577,   577,   587,   587,   594,   595,   598,   599,   602,
+     602,   610,   610,   619,   620,   623,   624,   625,   626,   627,
+     628,   629,   632,   632,   644,   644,   655,   663,   663,   679,
+     679,   689,   690,   693,   694,   695,   696,   697,   700,   700,
+     708,   708,   718,   718,   725,   725,   732,   732,   744,   744,
+     757,   758,   762,   766,   766,   778,   779,   783,   783,   791,
+     792,   795,   796,   797,   798,   799,   800,   801,   802,   805,
+     805,   813,   817,   817,   825,   825,   833,   833,   843,   844,
+     847,   847,   855,   856,   859,   860,   861,   862,   863,   864,
+     865,   868,   868,   876,   881,   886,   891,   896,   901,   901
   };
 
-  // Print the state stack on the debug stream.
   void
-  D2Parser::yystack_print_ ()
+  D2Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  D2Parser::yy_reduce_print_ (int yyrule)
+  D2Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2491,10 +2664,11 @@ namespace isc { namespace d2 {
 #endif // D2_PARSER_DEBUG
 
 
-#line 14 "d2_parser.yy" // lalr1.cc:1218
+#line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2497 "d2_parser.cc" // lalr1.cc:1218
-#line 875 "d2_parser.yy" // lalr1.cc:1219
+#line 2670 "d2_parser.cc"
+
+#line 909 "d2_parser.yy"
 
 
 void
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.4.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,13 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_D2_PARSER_D2_PARSER_H_INCLUDED
 # define YY_D2_PARSER_D2_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "d2_parser.yy" // lalr1.cc:404
+// "%code requires" blocks.
+#line 17 "d2_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -56,7 +57,7 @@ using namespace isc::d2;
 using namespace isc::data;
 using namespace std;
 
-#line 60 "d2_parser.h" // lalr1.cc:404
+#line 61 "d2_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -85,46 +86,66 @@ using namespace std;
 # define YY_RVREF(Type)    const Type&
 # define YY_COPY(Type)     const Type&
 #endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef D2_PARSER__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define D2_PARSER__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -137,6 +158,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -162,193 +204,92 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined D2_PARSER_DEBUG */
 
-#line 14 "d2_parser.yy" // lalr1.cc:404
+#line 14 "d2_parser.yy"
 namespace isc { namespace d2 {
-#line 168 "d2_parser.h" // lalr1.cc:404
-
-  /// A stack with random access from its top.
-  template <typename T, typename S = std::vector<T> >
-  class stack
-  {
-  public:
-    // Hide our reversed order.
-    typedef typename S::reverse_iterator iterator;
-    typedef typename S::const_reverse_iterator const_iterator;
-    typedef typename S::size_type size_type;
-
-    stack (size_type n = 200)
-      : seq_ (n)
-    {}
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (size_type i)
-    {
-      return seq_[size () - 1 - i];
-    }
+#line 210 "d2_parser.h"
 
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (int i)
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (size_type i) const
-    {
-      return seq_[size () - 1 - i];
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (int i) const
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Steal the contents of \a t.
-    ///
-    /// Close to move-semantics.
-    void
-    push (YY_MOVE_REF (T) t)
-    {
-      seq_.push_back (T ());
-      operator[](0).move (t);
-    }
-
-    void
-    pop (int n = 1)
-    {
-      for (; 0 < n; --n)
-        seq_.pop_back ();
-    }
-
-    void
-    clear ()
-    {
-      seq_.clear ();
-    }
-
-    size_type
-    size () const
-    {
-      return seq_.size ();
-    }
-
-    const_iterator
-    begin () const
-    {
-      return seq_.rbegin ();
-    }
 
-    const_iterator
-    end () const
-    {
-      return seq_.rend ();
-    }
 
-  private:
-    stack (const stack&);
-    stack& operator= (const stack&);
-    /// The wrapped container.
-    S seq_;
-  };
 
-  /// Present a slice of the top of a stack.
-  template <typename T, typename S = stack<T> >
-  class slice
+  /// A Bison parser.
+  class D2Parser
   {
   public:
-    slice (const S& stack, int range)
-      : stack_ (stack)
-      , range_ (range)
-    {}
-
-    const T&
-    operator[] (int i) const
-    {
-      return stack_[range_ - i];
-    }
-
-  private:
-    const S& stack_;
-    int range_;
-  };
-
-
-
-  /// A char[S] buffer to store and retrieve objects.
+#ifdef D2_PARSER_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define D2_PARSER_STYPE in C++, use %define api.value.type"
+# endif
+    typedef D2_PARSER_STYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
 
-# if 201103L <= YY_CPLUSPLUS
-    /// Instantiate a \a T in here from \a t.
-    template <typename T, typename U>
-    T&
-    emplace (U&& u)
-    {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
-      yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T (std::forward <U>(u));
-    }
-# else
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (!yytypeid_);
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -375,75 +316,75 @@ namespace isc { namespace d2 {
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == typeid (T));
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == typeid (T));
+      D2_PARSER__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
     /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      D2_PARSER__ASSERT (yytypeid_);
+      D2_PARSER__ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type& that)
     {
 # if 201103L <= YY_CPLUSPLUS
-      emplace<T> (std::move (other.as<T> ()));
+      emplace<T> (std::move (that.as<T> ()));
 # else
       emplace<T> ();
-      swap<T> (other);
+      swap<T> (that);
 # endif
-      other.destroy<T> ();
+      that.destroy<T> ();
     }
 
 # if 201103L <= YY_CPLUSPLUS
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type&& other)
+    move (self_type&& that)
     {
-      emplace<T> (std::move (other.as<T> ()));
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
 #endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      emplace<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -456,46 +397,31 @@ namespace isc { namespace d2 {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    variant (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class D2Parser
-  {
-  public:
-#ifndef D2_PARSER_STYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
@@ -515,105 +441,366 @@ namespace isc { namespace d2 {
 
       // "constant string"
       char dummy5[sizeof (std::string)];
-};
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof (union_type)> semantic_type;
-#else
-    typedef D2_PARSER_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP6 = 265,
-        TOKEN_DHCP4 = 266,
-        TOKEN_CONTROL_AGENT = 267,
-        TOKEN_DHCPDDNS = 268,
-        TOKEN_IP_ADDRESS = 269,
-        TOKEN_PORT = 270,
-        TOKEN_DNS_SERVER_TIMEOUT = 271,
-        TOKEN_NCR_PROTOCOL = 272,
-        TOKEN_UDP = 273,
-        TOKEN_TCP = 274,
-        TOKEN_NCR_FORMAT = 275,
-        TOKEN_JSON = 276,
-        TOKEN_USER_CONTEXT = 277,
-        TOKEN_COMMENT = 278,
-        TOKEN_FORWARD_DDNS = 279,
-        TOKEN_REVERSE_DDNS = 280,
-        TOKEN_DDNS_DOMAINS = 281,
-        TOKEN_KEY_NAME = 282,
-        TOKEN_DNS_SERVERS = 283,
-        TOKEN_HOSTNAME = 284,
-        TOKEN_TSIG_KEYS = 285,
-        TOKEN_ALGORITHM = 286,
-        TOKEN_DIGEST_BITS = 287,
-        TOKEN_SECRET = 288,
-        TOKEN_CONTROL_SOCKET = 289,
-        TOKEN_SOCKET_TYPE = 290,
-        TOKEN_SOCKET_NAME = 291,
-        TOKEN_LOGGING = 292,
-        TOKEN_LOGGERS = 293,
-        TOKEN_NAME = 294,
-        TOKEN_OUTPUT_OPTIONS = 295,
-        TOKEN_OUTPUT = 296,
-        TOKEN_DEBUGLEVEL = 297,
-        TOKEN_SEVERITY = 298,
-        TOKEN_FLUSH = 299,
-        TOKEN_MAXSIZE = 300,
-        TOKEN_MAXVER = 301,
-        TOKEN_TOPLEVEL_JSON = 302,
-        TOKEN_TOPLEVEL_DHCPDDNS = 303,
-        TOKEN_SUB_DHCPDDNS = 304,
-        TOKEN_SUB_TSIG_KEY = 305,
-        TOKEN_SUB_TSIG_KEYS = 306,
-        TOKEN_SUB_DDNS_DOMAIN = 307,
-        TOKEN_SUB_DDNS_DOMAINS = 308,
-        TOKEN_SUB_DNS_SERVER = 309,
-        TOKEN_SUB_DNS_SERVERS = 310,
-        TOKEN_STRING = 311,
-        TOKEN_INTEGER = 312,
-        TOKEN_FLOAT = 313,
-        TOKEN_BOOLEAN = 314
+      enum token_kind_type
+      {
+        TOKEN_D2_PARSER_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_D2_PARSER_error = 256,   // error
+    TOKEN_D2_PARSER_UNDEF = 257,   // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP6 = 265,             // "Dhcp6"
+    TOKEN_DHCP4 = 266,             // "Dhcp4"
+    TOKEN_CONTROL_AGENT = 267,     // "Control-agent"
+    TOKEN_DHCPDDNS = 268,          // "DhcpDdns"
+    TOKEN_IP_ADDRESS = 269,        // "ip-address"
+    TOKEN_PORT = 270,              // "port"
+    TOKEN_DNS_SERVER_TIMEOUT = 271, // "dns-server-timeout"
+    TOKEN_NCR_PROTOCOL = 272,      // "ncr-protocol"
+    TOKEN_UDP = 273,               // "UDP"
+    TOKEN_TCP = 274,               // "TCP"
+    TOKEN_NCR_FORMAT = 275,        // "ncr-format"
+    TOKEN_JSON = 276,              // "JSON"
+    TOKEN_USER_CONTEXT = 277,      // "user-context"
+    TOKEN_COMMENT = 278,           // "comment"
+    TOKEN_FORWARD_DDNS = 279,      // "forward-ddns"
+    TOKEN_REVERSE_DDNS = 280,      // "reverse-ddns"
+    TOKEN_DDNS_DOMAINS = 281,      // "ddns-domains"
+    TOKEN_KEY_NAME = 282,          // "key-name"
+    TOKEN_DNS_SERVERS = 283,       // "dns-servers"
+    TOKEN_HOSTNAME = 284,          // "hostname"
+    TOKEN_TSIG_KEYS = 285,         // "tsig-keys"
+    TOKEN_ALGORITHM = 286,         // "algorithm"
+    TOKEN_DIGEST_BITS = 287,       // "digest-bits"
+    TOKEN_SECRET = 288,            // "secret"
+    TOKEN_CONTROL_SOCKET = 289,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 290,       // "socket-type"
+    TOKEN_SOCKET_NAME = 291,       // "socket-name"
+    TOKEN_LOGGING = 292,           // "Logging"
+    TOKEN_LOGGERS = 293,           // "loggers"
+    TOKEN_NAME = 294,              // "name"
+    TOKEN_OUTPUT_OPTIONS = 295,    // "output_options"
+    TOKEN_OUTPUT = 296,            // "output"
+    TOKEN_DEBUGLEVEL = 297,        // "debuglevel"
+    TOKEN_RATE_LIMIT = 298,        // "rate-limit"
+    TOKEN_SEVERITY = 299,          // "severity"
+    TOKEN_FLUSH = 300,             // "flush"
+    TOKEN_MAXSIZE = 301,           // "maxsize"
+    TOKEN_MAXVER = 302,            // "maxver"
+    TOKEN_ASYNC = 303,             // "async"
+    TOKEN_QUEUE_SIZE = 304,        // "queue-size"
+    TOKEN_OVERFLOW_POLICY = 305,   // "overflow-policy"
+    TOKEN_TOPLEVEL_JSON = 306,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCPDDNS = 307, // TOPLEVEL_DHCPDDNS
+    TOKEN_SUB_DHCPDDNS = 308,      // SUB_DHCPDDNS
+    TOKEN_SUB_TSIG_KEY = 309,      // SUB_TSIG_KEY
+    TOKEN_SUB_TSIG_KEYS = 310,     // SUB_TSIG_KEYS
+    TOKEN_SUB_DDNS_DOMAIN = 311,   // SUB_DDNS_DOMAIN
+    TOKEN_SUB_DDNS_DOMAINS = 312,  // SUB_DDNS_DOMAINS
+    TOKEN_SUB_DNS_SERVER = 313,    // SUB_DNS_SERVER
+    TOKEN_SUB_DNS_SERVERS = 314,   // SUB_DNS_SERVERS
+    TOKEN_STRING = 315,            // "constant string"
+    TOKEN_INTEGER = 316,           // "integer"
+    TOKEN_FLOAT = 317,             // "floating point"
+    TOKEN_BOOLEAN = 318            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 64, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP6 = 10,                            // "Dhcp6"
+        S_DHCP4 = 11,                            // "Dhcp4"
+        S_CONTROL_AGENT = 12,                    // "Control-agent"
+        S_DHCPDDNS = 13,                         // "DhcpDdns"
+        S_IP_ADDRESS = 14,                       // "ip-address"
+        S_PORT = 15,                             // "port"
+        S_DNS_SERVER_TIMEOUT = 16,               // "dns-server-timeout"
+        S_NCR_PROTOCOL = 17,                     // "ncr-protocol"
+        S_UDP = 18,                              // "UDP"
+        S_TCP = 19,                              // "TCP"
+        S_NCR_FORMAT = 20,                       // "ncr-format"
+        S_JSON = 21,                             // "JSON"
+        S_USER_CONTEXT = 22,                     // "user-context"
+        S_COMMENT = 23,                          // "comment"
+        S_FORWARD_DDNS = 24,                     // "forward-ddns"
+        S_REVERSE_DDNS = 25,                     // "reverse-ddns"
+        S_DDNS_DOMAINS = 26,                     // "ddns-domains"
+        S_KEY_NAME = 27,                         // "key-name"
+        S_DNS_SERVERS = 28,                      // "dns-servers"
+        S_HOSTNAME = 29,                         // "hostname"
+        S_TSIG_KEYS = 30,                        // "tsig-keys"
+        S_ALGORITHM = 31,                        // "algorithm"
+        S_DIGEST_BITS = 32,                      // "digest-bits"
+        S_SECRET = 33,                           // "secret"
+        S_CONTROL_SOCKET = 34,                   // "control-socket"
+        S_SOCKET_TYPE = 35,                      // "socket-type"
+        S_SOCKET_NAME = 36,                      // "socket-name"
+        S_LOGGING = 37,                          // "Logging"
+        S_LOGGERS = 38,                          // "loggers"
+        S_NAME = 39,                             // "name"
+        S_OUTPUT_OPTIONS = 40,                   // "output_options"
+        S_OUTPUT = 41,                           // "output"
+        S_DEBUGLEVEL = 42,                       // "debuglevel"
+        S_RATE_LIMIT = 43,                       // "rate-limit"
+        S_SEVERITY = 44,                         // "severity"
+        S_FLUSH = 45,                            // "flush"
+        S_MAXSIZE = 46,                          // "maxsize"
+        S_MAXVER = 47,                           // "maxver"
+        S_ASYNC = 48,                            // "async"
+        S_QUEUE_SIZE = 49,                       // "queue-size"
+        S_OVERFLOW_POLICY = 50,                  // "overflow-policy"
+        S_TOPLEVEL_JSON = 51,                    // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCPDDNS = 52,                // TOPLEVEL_DHCPDDNS
+        S_SUB_DHCPDDNS = 53,                     // SUB_DHCPDDNS
+        S_SUB_TSIG_KEY = 54,                     // SUB_TSIG_KEY
+        S_SUB_TSIG_KEYS = 55,                    // SUB_TSIG_KEYS
+        S_SUB_DDNS_DOMAIN = 56,                  // SUB_DDNS_DOMAIN
+        S_SUB_DDNS_DOMAINS = 57,                 // SUB_DDNS_DOMAINS
+        S_SUB_DNS_SERVER = 58,                   // SUB_DNS_SERVER
+        S_SUB_DNS_SERVERS = 59,                  // SUB_DNS_SERVERS
+        S_STRING = 60,                           // "constant string"
+        S_INTEGER = 61,                          // "integer"
+        S_FLOAT = 62,                            // "floating point"
+        S_BOOLEAN = 63,                          // "boolean"
+        S_YYACCEPT = 64,                         // $accept
+        S_start = 65,                            // start
+        S_66_1 = 66,                             // $@1
+        S_67_2 = 67,                             // $@2
+        S_68_3 = 68,                             // $@3
+        S_69_4 = 69,                             // $@4
+        S_70_5 = 70,                             // $@5
+        S_71_6 = 71,                             // $@6
+        S_72_7 = 72,                             // $@7
+        S_73_8 = 73,                             // $@8
+        S_74_9 = 74,                             // $@9
+        S_value = 75,                            // value
+        S_sub_json = 76,                         // sub_json
+        S_map2 = 77,                             // map2
+        S_78_10 = 78,                            // $@10
+        S_map_value = 79,                        // map_value
+        S_map_content = 80,                      // map_content
+        S_not_empty_map = 81,                    // not_empty_map
+        S_list_generic = 82,                     // list_generic
+        S_83_11 = 83,                            // $@11
+        S_list_content = 84,                     // list_content
+        S_not_empty_list = 85,                   // not_empty_list
+        S_unknown_map_entry = 86,                // unknown_map_entry
+        S_syntax_map = 87,                       // syntax_map
+        S_88_12 = 88,                            // $@12
+        S_global_objects = 89,                   // global_objects
+        S_global_object = 90,                    // global_object
+        S_dhcpddns_object = 91,                  // dhcpddns_object
+        S_92_13 = 92,                            // $@13
+        S_sub_dhcpddns = 93,                     // sub_dhcpddns
+        S_94_14 = 94,                            // $@14
+        S_dhcpddns_params = 95,                  // dhcpddns_params
+        S_dhcpddns_param = 96,                   // dhcpddns_param
+        S_ip_address = 97,                       // ip_address
+        S_98_15 = 98,                            // $@15
+        S_port = 99,                             // port
+        S_dns_server_timeout = 100,              // dns_server_timeout
+        S_ncr_protocol = 101,                    // ncr_protocol
+        S_102_16 = 102,                          // $@16
+        S_ncr_protocol_value = 103,              // ncr_protocol_value
+        S_ncr_format = 104,                      // ncr_format
+        S_105_17 = 105,                          // $@17
+        S_user_context = 106,                    // user_context
+        S_107_18 = 107,                          // $@18
+        S_comment = 108,                         // comment
+        S_109_19 = 109,                          // $@19
+        S_forward_ddns = 110,                    // forward_ddns
+        S_111_20 = 111,                          // $@20
+        S_reverse_ddns = 112,                    // reverse_ddns
+        S_113_21 = 113,                          // $@21
+        S_ddns_mgr_params = 114,                 // ddns_mgr_params
+        S_not_empty_ddns_mgr_params = 115,       // not_empty_ddns_mgr_params
+        S_ddns_mgr_param = 116,                  // ddns_mgr_param
+        S_ddns_domains = 117,                    // ddns_domains
+        S_118_22 = 118,                          // $@22
+        S_sub_ddns_domains = 119,                // sub_ddns_domains
+        S_120_23 = 120,                          // $@23
+        S_ddns_domain_list = 121,                // ddns_domain_list
+        S_not_empty_ddns_domain_list = 122,      // not_empty_ddns_domain_list
+        S_ddns_domain = 123,                     // ddns_domain
+        S_124_24 = 124,                          // $@24
+        S_sub_ddns_domain = 125,                 // sub_ddns_domain
+        S_126_25 = 126,                          // $@25
+        S_ddns_domain_params = 127,              // ddns_domain_params
+        S_ddns_domain_param = 128,               // ddns_domain_param
+        S_ddns_domain_name = 129,                // ddns_domain_name
+        S_130_26 = 130,                          // $@26
+        S_ddns_domain_key_name = 131,            // ddns_domain_key_name
+        S_132_27 = 132,                          // $@27
+        S_dns_servers = 133,                     // dns_servers
+        S_134_28 = 134,                          // $@28
+        S_sub_dns_servers = 135,                 // sub_dns_servers
+        S_136_29 = 136,                          // $@29
+        S_dns_server_list = 137,                 // dns_server_list
+        S_dns_server = 138,                      // dns_server
+        S_139_30 = 139,                          // $@30
+        S_sub_dns_server = 140,                  // sub_dns_server
+        S_141_31 = 141,                          // $@31
+        S_dns_server_params = 142,               // dns_server_params
+        S_dns_server_param = 143,                // dns_server_param
+        S_dns_server_hostname = 144,             // dns_server_hostname
+        S_145_32 = 145,                          // $@32
+        S_dns_server_ip_address = 146,           // dns_server_ip_address
+        S_147_33 = 147,                          // $@33
+        S_dns_server_port = 148,                 // dns_server_port
+        S_tsig_keys = 149,                       // tsig_keys
+        S_150_34 = 150,                          // $@34
+        S_sub_tsig_keys = 151,                   // sub_tsig_keys
+        S_152_35 = 152,                          // $@35
+        S_tsig_keys_list = 153,                  // tsig_keys_list
+        S_not_empty_tsig_keys_list = 154,        // not_empty_tsig_keys_list
+        S_tsig_key = 155,                        // tsig_key
+        S_156_36 = 156,                          // $@36
+        S_sub_tsig_key = 157,                    // sub_tsig_key
+        S_158_37 = 158,                          // $@37
+        S_tsig_key_params = 159,                 // tsig_key_params
+        S_tsig_key_param = 160,                  // tsig_key_param
+        S_tsig_key_name = 161,                   // tsig_key_name
+        S_162_38 = 162,                          // $@38
+        S_tsig_key_algorithm = 163,              // tsig_key_algorithm
+        S_164_39 = 164,                          // $@39
+        S_tsig_key_digest_bits = 165,            // tsig_key_digest_bits
+        S_tsig_key_secret = 166,                 // tsig_key_secret
+        S_167_40 = 167,                          // $@40
+        S_control_socket = 168,                  // control_socket
+        S_169_41 = 169,                          // $@41
+        S_control_socket_params = 170,           // control_socket_params
+        S_control_socket_param = 171,            // control_socket_param
+        S_control_socket_type = 172,             // control_socket_type
+        S_173_42 = 173,                          // $@42
+        S_control_socket_name = 174,             // control_socket_name
+        S_175_43 = 175,                          // $@43
+        S_dhcp6_json_object = 176,               // dhcp6_json_object
+        S_177_44 = 177,                          // $@44
+        S_dhcp4_json_object = 178,               // dhcp4_json_object
+        S_179_45 = 179,                          // $@45
+        S_control_agent_json_object = 180,       // control_agent_json_object
+        S_181_46 = 181,                          // $@46
+        S_logging_object = 182,                  // logging_object
+        S_183_47 = 183,                          // $@47
+        S_logging_params = 184,                  // logging_params
+        S_logging_param = 185,                   // logging_param
+        S_loggers = 186,                         // loggers
+        S_187_48 = 187,                          // $@48
+        S_loggers_entries = 188,                 // loggers_entries
+        S_logger_entry = 189,                    // logger_entry
+        S_190_49 = 190,                          // $@49
+        S_logger_params = 191,                   // logger_params
+        S_logger_param = 192,                    // logger_param
+        S_name = 193,                            // name
+        S_194_50 = 194,                          // $@50
+        S_debuglevel = 195,                      // debuglevel
+        S_severity = 196,                        // severity
+        S_197_51 = 197,                          // $@51
+        S_rate_limit = 198,                      // rate_limit
+        S_199_52 = 199,                          // $@52
+        S_output_options_list = 200,             // output_options_list
+        S_201_53 = 201,                          // $@53
+        S_output_options_list_content = 202,     // output_options_list_content
+        S_output_entry = 203,                    // output_entry
+        S_204_54 = 204,                          // $@54
+        S_output_params_list = 205,              // output_params_list
+        S_output_params = 206,                   // output_params
+        S_output = 207,                          // output
+        S_208_55 = 208,                          // $@55
+        S_flush = 209,                           // flush
+        S_maxsize = 210,                         // maxsize
+        S_maxver = 211,                          // maxver
+        S_async = 212,                           // async
+        S_queue_size = 213,                      // queue_size
+        S_overflow_policy = 214,                 // overflow_policy
+        S_215_56 = 215                           // $@56
+      };
+    };
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -623,64 +810,205 @@ namespace isc { namespace d2 {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      basic_symbol (basic_symbol&& that);
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
 
       /// Copy constructor.
       basic_symbol (const basic_symbol& that);
 
-
-      /// Constructor for valueless symbols, and symbols from each type.
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, location_type&& l);
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
 
-
       /// Destroy the symbol.
-      ~basic_symbol ();
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
 
       /// Destroy contents, and record that is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        value.template destroy< ElementPtr > ();
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.template destroy< bool > ();
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.template destroy< double > ();
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.template destroy< int64_t > ();
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return D2Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
       /// Whether empty.
-      bool empty () const;
+      bool empty () const YY_NOEXCEPT;
 
       /// Destructive move, \a s is emptied into this.
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -693,51 +1021,132 @@ namespace isc { namespace d2 {
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
 #if 201103L <= YY_CPLUSPLUS
       /// Move constructor.
-      by_type (by_type&& that);
+      by_kind (by_kind&& that) YY_NOEXCEPT;
 #endif
 
       /// Copy constructor.
-      by_type (const by_type& that);
-
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_D2_PARSER_error <= tok && tok <= token::TOKEN_SUB_DNS_SERVERS));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, bool v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const bool& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_BOOLEAN);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, double v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const double& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_FLOAT);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_INTEGER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        D2_PARSER__ASSERT (tok == token::TOKEN_STRING);
+#endif
+      }
+    };
 
     /// Build a parser object.
     D2Parser (isc::d2::D2ParserContext& ctx_yyarg);
     virtual ~D2Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    D2Parser (const D2Parser&) = delete;
+    /// Non copyable.
+    D2Parser& operator= (const D2Parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -768,618 +1177,1086 @@ namespace isc { namespace d2 {
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Symbol constructors declarations.
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
+
+    // Implementation of make_symbol for each token kind.
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_END (location_type l);
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_END (const location_type& l);
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_COMMA (location_type l);
+      static
+      symbol_type
+      make_D2_PARSER_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_error, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_COMMA (const location_type& l);
+      static
+      symbol_type
+      make_D2_PARSER_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_error, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_COLON (location_type l);
+      static
+      symbol_type
+      make_D2_PARSER_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_UNDEF, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_COLON (const location_type& l);
+      static
+      symbol_type
+      make_D2_PARSER_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_D2_PARSER_UNDEF, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_LSQUARE_BRACKET (location_type l);
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_LSQUARE_BRACKET (const location_type& l);
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_RSQUARE_BRACKET (location_type l);
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_COLON, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_RSQUARE_BRACKET (const location_type& l);
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COLON, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_LCURLY_BRACKET (location_type l);
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_LCURLY_BRACKET (const location_type& l);
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_RCURLY_BRACKET (location_type l);
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_RCURLY_BRACKET (const location_type& l);
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_NULL_TYPE (location_type l);
+      static
+      symbol_type
+      make_LCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_NULL_TYPE (const location_type& l);
+      static
+      symbol_type
+      make_LCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DHCP6 (location_type l);
+      static
+      symbol_type
+      make_RCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DHCP6 (const location_type& l);
+      static
+      symbol_type
+      make_RCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DHCP4 (location_type l);
+      static
+      symbol_type
+      make_NULL_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DHCP4 (const location_type& l);
+      static
+      symbol_type
+      make_NULL_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_CONTROL_AGENT (location_type l);
+      static
+      symbol_type
+      make_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_CONTROL_AGENT (const location_type& l);
+      static
+      symbol_type
+      make_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DHCPDDNS (location_type l);
+      static
+      symbol_type
+      make_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DHCPDDNS (const location_type& l);
+      static
+      symbol_type
+      make_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_IP_ADDRESS (location_type l);
+      static
+      symbol_type
+      make_CONTROL_AGENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_AGENT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_IP_ADDRESS (const location_type& l);
+      static
+      symbol_type
+      make_CONTROL_AGENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_AGENT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_PORT (location_type l);
+      static
+      symbol_type
+      make_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_PORT (const location_type& l);
+      static
+      symbol_type
+      make_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DNS_SERVER_TIMEOUT (location_type l);
+      static
+      symbol_type
+      make_IP_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DNS_SERVER_TIMEOUT (const location_type& l);
+      static
+      symbol_type
+      make_IP_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_NCR_PROTOCOL (location_type l);
+      static
+      symbol_type
+      make_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_PORT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_NCR_PROTOCOL (const location_type& l);
+      static
+      symbol_type
+      make_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PORT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_UDP (location_type l);
+      static
+      symbol_type
+      make_DNS_SERVER_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVER_TIMEOUT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_UDP (const location_type& l);
+      static
+      symbol_type
+      make_DNS_SERVER_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVER_TIMEOUT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_TCP (location_type l);
+      static
+      symbol_type
+      make_NCR_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_TCP (const location_type& l);
+      static
+      symbol_type
+      make_NCR_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_NCR_FORMAT (location_type l);
+      static
+      symbol_type
+      make_UDP (location_type l)
+      {
+        return symbol_type (token::TOKEN_UDP, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_NCR_FORMAT (const location_type& l);
+      static
+      symbol_type
+      make_UDP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UDP, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_JSON (location_type l);
+      static
+      symbol_type
+      make_TCP (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_JSON (const location_type& l);
+      static
+      symbol_type
+      make_TCP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_USER_CONTEXT (location_type l);
+      static
+      symbol_type
+      make_NCR_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_USER_CONTEXT (const location_type& l);
+      static
+      symbol_type
+      make_NCR_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_COMMENT (location_type l);
+      static
+      symbol_type
+      make_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_JSON, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_COMMENT (const location_type& l);
+      static
+      symbol_type
+      make_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_JSON, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_FORWARD_DDNS (location_type l);
+      static
+      symbol_type
+      make_USER_CONTEXT (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_FORWARD_DDNS (const location_type& l);
+      static
+      symbol_type
+      make_USER_CONTEXT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_REVERSE_DDNS (location_type l);
+      static
+      symbol_type
+      make_COMMENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_REVERSE_DDNS (const location_type& l);
+      static
+      symbol_type
+      make_COMMENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DDNS_DOMAINS (location_type l);
+      static
+      symbol_type
+      make_FORWARD_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_FORWARD_DDNS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DDNS_DOMAINS (const location_type& l);
+      static
+      symbol_type
+      make_FORWARD_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FORWARD_DDNS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_KEY_NAME (location_type l);
+      static
+      symbol_type
+      make_REVERSE_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_REVERSE_DDNS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_KEY_NAME (const location_type& l);
+      static
+      symbol_type
+      make_REVERSE_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REVERSE_DDNS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DNS_SERVERS (location_type l);
+      static
+      symbol_type
+      make_DDNS_DOMAINS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DDNS_DOMAINS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DNS_SERVERS (const location_type& l);
+      static
+      symbol_type
+      make_DDNS_DOMAINS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DDNS_DOMAINS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_HOSTNAME (location_type l);
+      static
+      symbol_type
+      make_KEY_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_KEY_NAME, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_HOSTNAME (const location_type& l);
+      static
+      symbol_type
+      make_KEY_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_KEY_NAME, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_TSIG_KEYS (location_type l);
+      static
+      symbol_type
+      make_DNS_SERVERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVERS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_TSIG_KEYS (const location_type& l);
+      static
+      symbol_type
+      make_DNS_SERVERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DNS_SERVERS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_ALGORITHM (location_type l);
+      static
+      symbol_type
+      make_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_ALGORITHM (const location_type& l);
+      static
+      symbol_type
+      make_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DIGEST_BITS (location_type l);
+      static
+      symbol_type
+      make_TSIG_KEYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_TSIG_KEYS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DIGEST_BITS (const location_type& l);
+      static
+      symbol_type
+      make_TSIG_KEYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TSIG_KEYS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SECRET (location_type l);
+      static
+      symbol_type
+      make_ALGORITHM (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALGORITHM, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SECRET (const location_type& l);
+      static
+      symbol_type
+      make_ALGORITHM (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALGORITHM, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_CONTROL_SOCKET (location_type l);
+      static
+      symbol_type
+      make_DIGEST_BITS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DIGEST_BITS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_CONTROL_SOCKET (const location_type& l);
+      static
+      symbol_type
+      make_DIGEST_BITS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DIGEST_BITS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SOCKET_TYPE (location_type l);
+      static
+      symbol_type
+      make_SECRET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SECRET, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SOCKET_TYPE (const location_type& l);
+      static
+      symbol_type
+      make_SECRET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SECRET, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SOCKET_NAME (location_type l);
+      static
+      symbol_type
+      make_CONTROL_SOCKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SOCKET_NAME (const location_type& l);
+      static
+      symbol_type
+      make_CONTROL_SOCKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_LOGGING (location_type l);
+      static
+      symbol_type
+      make_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_LOGGING (const location_type& l);
+      static
+      symbol_type
+      make_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_LOGGERS (location_type l);
+      static
+      symbol_type
+      make_SOCKET_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_LOGGERS (const location_type& l);
+      static
+      symbol_type
+      make_SOCKET_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_NAME (location_type l);
+      static
+      symbol_type
+      make_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_NAME (const location_type& l);
+      static
+      symbol_type
+      make_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_OUTPUT_OPTIONS (location_type l);
+      static
+      symbol_type
+      make_LOGGERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_OUTPUT_OPTIONS (const location_type& l);
+      static
+      symbol_type
+      make_LOGGERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_OUTPUT (location_type l);
+      static
+      symbol_type
+      make_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_NAME, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_OUTPUT (const location_type& l);
+      static
+      symbol_type
+      make_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NAME, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_DEBUGLEVEL (location_type l);
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_DEBUGLEVEL (const location_type& l);
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SEVERITY (location_type l);
+      static
+      symbol_type
+      make_OUTPUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SEVERITY (const location_type& l);
+      static
+      symbol_type
+      make_OUTPUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_FLUSH (location_type l);
+      static
+      symbol_type
+      make_DEBUGLEVEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_FLUSH (const location_type& l);
+      static
+      symbol_type
+      make_DEBUGLEVEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_MAXSIZE (location_type l);
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_MAXSIZE (const location_type& l);
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_MAXVER (location_type l);
+      static
+      symbol_type
+      make_SEVERITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_MAXVER (const location_type& l);
+      static
+      symbol_type
+      make_SEVERITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_TOPLEVEL_JSON (location_type l);
+      static
+      symbol_type
+      make_FLUSH (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_TOPLEVEL_JSON (const location_type& l);
+      static
+      symbol_type
+      make_FLUSH (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_TOPLEVEL_DHCPDDNS (location_type l);
+      static
+      symbol_type
+      make_MAXSIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_TOPLEVEL_DHCPDDNS (const location_type& l);
+      static
+      symbol_type
+      make_MAXSIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SUB_DHCPDDNS (location_type l);
+      static
+      symbol_type
+      make_MAXVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SUB_DHCPDDNS (const location_type& l);
+      static
+      symbol_type
+      make_MAXVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SUB_TSIG_KEY (location_type l);
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SUB_TSIG_KEY (const location_type& l);
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SUB_TSIG_KEYS (location_type l);
+      static
+      symbol_type
+      make_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SUB_TSIG_KEYS (const location_type& l);
+      static
+      symbol_type
+      make_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SUB_DDNS_DOMAIN (location_type l);
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SUB_DDNS_DOMAIN (const location_type& l);
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SUB_DDNS_DOMAINS (location_type l);
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SUB_DDNS_DOMAINS (const location_type& l);
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SUB_DNS_SERVER (location_type l);
+      static
+      symbol_type
+      make_TOPLEVEL_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCPDDNS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SUB_DNS_SERVER (const location_type& l);
+      static
+      symbol_type
+      make_TOPLEVEL_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCPDDNS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_SUB_DNS_SERVERS (location_type l);
+      static
+      symbol_type
+      make_SUB_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCPDDNS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_SUB_DNS_SERVERS (const location_type& l);
+      static
+      symbol_type
+      make_SUB_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCPDDNS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_STRING (std::string v, location_type l);
+      static
+      symbol_type
+      make_SUB_TSIG_KEY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEY, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_STRING (const std::string& v, const location_type& l);
+      static
+      symbol_type
+      make_SUB_TSIG_KEY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEY, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_INTEGER (int64_t v, location_type l);
+      static
+      symbol_type
+      make_SUB_TSIG_KEYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEYS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_INTEGER (const int64_t& v, const location_type& l);
+      static
+      symbol_type
+      make_SUB_TSIG_KEYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_TSIG_KEYS, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_FLOAT (double v, location_type l);
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAIN (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAIN, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_FLOAT (const double& v, const location_type& l);
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAIN (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAIN, l);
+      }
 #endif
 #if 201103L <= YY_CPLUSPLUS
-    static
-    symbol_type
-    make_BOOLEAN (bool v, location_type l);
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAINS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAINS, std::move (l));
+      }
 #else
-    static
-    symbol_type
-    make_BOOLEAN (const bool& v, const location_type& l);
+      static
+      symbol_type
+      make_SUB_DDNS_DOMAINS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DDNS_DOMAINS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DNS_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DNS_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DNS_SERVERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DNS_SERVERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DNS_SERVERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STRING, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER (int64_t v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER (const int64_t& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (double v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const double& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOLEAN (bool v, location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOLEAN (const bool& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, v, l);
+      }
 #endif
 
 
-  private:
-    /// This class is not copyable.
+    class context
+    {
+    public:
+      context (const D2Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
+
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
+
+    private:
+      const D2Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
+
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     D2Parser (const D2Parser&);
+    /// Non copyable.
     D2Parser& operator= (const D2Parser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const signed char yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
+
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned char yydefact_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const signed char yypgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const unsigned char yydefact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
+    // YYPGOTO[NTERM-NUM].
+    static const signed char yypgoto_[];
 
-  static const short yycheck_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned char yystos_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned char yyr1_[];
+    static const short yycheck_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const unsigned char yystos_[];
 
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const unsigned char yyr1_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if D2_PARSER_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
     /// Debugging level.
     int yydebug_;
     /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -1398,29 +2275,30 @@ namespace isc { namespace d2 {
     struct by_state
     {
       /// Default constructor.
-      by_state ();
+      by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
-      by_state (kind_type s);
+      by_state (kind_type s) YY_NOEXCEPT;
 
       /// Copy constructor.
-      by_state (const by_state& other);
+      by_state (const by_state& that) YY_NOEXCEPT;
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -1442,9 +2320,131 @@ namespace isc { namespace d2 {
       /// Assignment, needed by push_back by some old implementations.
       /// Moves the contents of that.
       stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
+
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
 #endif
+      /// The wrapped container.
+      S seq_;
     };
 
+
     /// Stack type.
     typedef stack<stack_symbol_type> stack_type;
 
@@ -1467,35 +2467,33 @@ namespace isc { namespace d2 {
     void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
     /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
-      yylast_ = 305,     ///< Last index in yytable_.
-      yynnts_ = 146,  ///< Number of nonterminal symbols.
-      yyfinal_ = 20, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 60  ///< Number of tokens.
+      yylast_ = 308,     ///< Last index in yytable_.
+      yynnts_ = 152,  ///< Number of nonterminal symbols.
+      yyfinal_ = 20 ///< Termination state number.
     };
 
 
     // User arguments.
     isc::d2::D2ParserContext& ctx;
+
   };
 
-  // Symbol number corresponding to token number t.
   inline
-  D2Parser::token_number_type
-  D2Parser::yytranslate_ (token_type t)
+  D2Parser::symbol_kind_type
+  D2Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
     static
-    const token_number_type
+    const signed char
     translate_table[] =
     {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1526,98 +2524,48 @@ namespace isc { namespace d2 {
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59
+      55,    56,    57,    58,    59,    60,    61,    62,    63
     };
-    const unsigned user_token_number_max_ = 314;
-    const token_number_type undef_token_ = 2;
+    // Last valid token kind.
+    const int code_max = 318;
 
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
     else
-      return undef_token_;
+      return symbol_kind::S_YYUNDEF;
   }
 
-  inline
-  D2Parser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
   // basic_symbol.
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-    , location ()
-  {}
-
-#if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (basic_symbol&& that)
-    : Base (std::move (that))
-    , value ()
-    , location (std::move (that.location))
-  {
-    switch (this->type_get ())
-    {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
-        value.move< ElementPtr > (std::move (that.value));
-        break;
-
-      case 59: // "boolean"
-        value.move< bool > (std::move (that.value));
-        break;
-
-      case 58: // "floating point"
-        value.move< double > (std::move (that.value));
-        break;
-
-      case 57: // "integer"
-        value.move< int64_t > (std::move (that.value));
-        break;
-
-      case 56: // "constant string"
-        value.move< std::string > (std::move (that.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-#endif
-
   template <typename Base>
   D2Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
     : Base (that)
     , value ()
     , location (that.location)
   {
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
-        value.copy< ElementPtr > (that.value);
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+        value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 59: // "boolean"
-        value.copy< bool > (that.value);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 58: // "floating point"
-        value.copy< double > (that.value);
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 57: // "integer"
-        value.copy< int64_t > (that.value);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 56: // "constant string"
-        value.copy< std::string > (that.value);
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (YY_MOVE (that.value));
         break;
 
       default:
@@ -1627,154 +2575,21 @@ namespace isc { namespace d2 {
   }
 
 
-  // Implementation of basic_symbol constructor for each type.
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, location_type&& l)
-    : Base (t)
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const location_type& l)
-    : Base (t)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  D2Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
 
 
   template <typename Base>
-  D2Parser::basic_symbol<Base>::~basic_symbol ()
+  D2Parser::symbol_kind_type
+  D2Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
   {
-    clear ();
+    return this->kind ();
   }
 
-  template <typename Base>
-  void
-  D2Parser::basic_symbol<Base>::clear ()
-  {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
-    {
-   default:
-      break;
-    }
-
-    // Type destructor.
-  switch (yytype)
-    {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
-        value.template destroy< ElementPtr > ();
-        break;
-
-      case 59: // "boolean"
-        value.template destroy< bool > ();
-        break;
-
-      case 58: // "floating point"
-        value.template destroy< double > ();
-        break;
-
-      case 57: // "integer"
-        value.template destroy< int64_t > ();
-        break;
-
-      case 56: // "constant string"
-        value.template destroy< std::string > ();
-        break;
-
-      default:
-        break;
-    }
-
-    Base::clear ();
-  }
 
   template <typename Base>
   bool
-  D2Parser::basic_symbol<Base>::empty () const
+  D2Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
@@ -1782,27 +2597,27 @@ namespace isc { namespace d2 {
   D2Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
     super_type::move (s);
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 71: // value
-      case 75: // map_value
-      case 99: // ncr_protocol_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 59: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 58: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 57: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 56: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -1813,948 +2628,67 @@ namespace isc { namespace d2 {
     location = YY_MOVE (s.location);
   }
 
-  // by_type.
+  // by_kind.
   inline
-  D2Parser::by_type::by_type ()
-    : type (empty_symbol)
+  D2Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
 #if 201103L <= YY_CPLUSPLUS
   inline
-  D2Parser::by_type::by_type (by_type&& that)
-    : type (that.type)
+  D2Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
     that.clear ();
   }
 #endif
 
   inline
-  D2Parser::by_type::by_type (const by_type& that)
-    : type (that.type)
+  D2Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {}
 
   inline
-  D2Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
+  D2Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
   {}
 
+
+
   inline
   void
-  D2Parser::by_type::clear ()
+  D2Parser::by_kind::clear () YY_NOEXCEPT
   {
-    type = empty_symbol;
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
   void
-  D2Parser::by_type::move (by_type& that)
+  D2Parser::by_kind::move (by_kind& that)
   {
-    type = that.type;
+    kind_ = that.kind_;
     that.clear ();
   }
 
   inline
-  int
-  D2Parser::by_type::type_get () const
+  D2Parser::symbol_kind_type
+  D2Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return type;
+    return kind_;
   }
 
-  inline
-  D2Parser::token_type
-  D2Parser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
 
-  // Implementation of make_symbol for each symbol type.
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_END (location_type l)
-  {
-    return symbol_type (token::TOKEN_END, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_END (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_END, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_COMMA (location_type l)
-  {
-    return symbol_type (token::TOKEN_COMMA, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_COMMA (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COMMA, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_COLON (location_type l)
-  {
-    return symbol_type (token::TOKEN_COLON, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_COLON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COLON, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LSQUARE_BRACKET (location_type l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_RSQUARE_BRACKET (location_type l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_RSQUARE_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LCURLY_BRACKET (location_type l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_RCURLY_BRACKET (location_type l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_RCURLY_BRACKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NULL_TYPE (location_type l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NULL_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DHCP6 (location_type l)
-  {
-    return symbol_type (token::TOKEN_DHCP6, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DHCP6 (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCP6, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DHCP4 (location_type l)
-  {
-    return symbol_type (token::TOKEN_DHCP4, std::move (l));
-  }
-#else
   inline
-  D2Parser::symbol_type
-  D2Parser::make_DHCP4 (const location_type& l)
+  D2Parser::symbol_kind_type
+  D2Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_DHCP4, l);
+    return this->kind ();
   }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_CONTROL_AGENT (location_type l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_AGENT, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_CONTROL_AGENT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_AGENT, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DHCPDDNS (location_type l)
-  {
-    return symbol_type (token::TOKEN_DHCPDDNS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DHCPDDNS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_IP_ADDRESS (location_type l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_IP_ADDRESS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_PORT (location_type l)
-  {
-    return symbol_type (token::TOKEN_PORT, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_PORT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_PORT, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DNS_SERVER_TIMEOUT (location_type l)
-  {
-    return symbol_type (token::TOKEN_DNS_SERVER_TIMEOUT, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DNS_SERVER_TIMEOUT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DNS_SERVER_TIMEOUT, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NCR_PROTOCOL (location_type l)
-  {
-    return symbol_type (token::TOKEN_NCR_PROTOCOL, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NCR_PROTOCOL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_UDP (location_type l)
-  {
-    return symbol_type (token::TOKEN_UDP, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_UDP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_UDP, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TCP (location_type l)
-  {
-    return symbol_type (token::TOKEN_TCP, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TCP (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TCP, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NCR_FORMAT (location_type l)
-  {
-    return symbol_type (token::TOKEN_NCR_FORMAT, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NCR_FORMAT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NCR_FORMAT, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_JSON (location_type l)
-  {
-    return symbol_type (token::TOKEN_JSON, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_JSON, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_USER_CONTEXT (location_type l)
-  {
-    return symbol_type (token::TOKEN_USER_CONTEXT, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_USER_CONTEXT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_USER_CONTEXT, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_COMMENT (location_type l)
-  {
-    return symbol_type (token::TOKEN_COMMENT, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_COMMENT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_COMMENT, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_FORWARD_DDNS (location_type l)
-  {
-    return symbol_type (token::TOKEN_FORWARD_DDNS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_FORWARD_DDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FORWARD_DDNS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_REVERSE_DDNS (location_type l)
-  {
-    return symbol_type (token::TOKEN_REVERSE_DDNS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_REVERSE_DDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_REVERSE_DDNS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DDNS_DOMAINS (location_type l)
-  {
-    return symbol_type (token::TOKEN_DDNS_DOMAINS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DDNS_DOMAINS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DDNS_DOMAINS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_KEY_NAME (location_type l)
-  {
-    return symbol_type (token::TOKEN_KEY_NAME, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_KEY_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_KEY_NAME, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DNS_SERVERS (location_type l)
-  {
-    return symbol_type (token::TOKEN_DNS_SERVERS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DNS_SERVERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DNS_SERVERS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_HOSTNAME (location_type l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_HOSTNAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TSIG_KEYS (location_type l)
-  {
-    return symbol_type (token::TOKEN_TSIG_KEYS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TSIG_KEYS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TSIG_KEYS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_ALGORITHM (location_type l)
-  {
-    return symbol_type (token::TOKEN_ALGORITHM, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_ALGORITHM (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_ALGORITHM, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DIGEST_BITS (location_type l)
-  {
-    return symbol_type (token::TOKEN_DIGEST_BITS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DIGEST_BITS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DIGEST_BITS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SECRET (location_type l)
-  {
-    return symbol_type (token::TOKEN_SECRET, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SECRET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SECRET, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_CONTROL_SOCKET (location_type l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_SOCKET, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_CONTROL_SOCKET (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SOCKET_TYPE (location_type l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_TYPE, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SOCKET_TYPE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_TYPE, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SOCKET_NAME (location_type l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_NAME, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SOCKET_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_NAME, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LOGGING (location_type l)
-  {
-    return symbol_type (token::TOKEN_LOGGING, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LOGGING (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGING, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LOGGERS (location_type l)
-  {
-    return symbol_type (token::TOKEN_LOGGERS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_LOGGERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_LOGGERS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NAME (location_type l)
-  {
-    return symbol_type (token::TOKEN_NAME, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_NAME (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_NAME, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_OUTPUT_OPTIONS (location_type l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_OUTPUT_OPTIONS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_OUTPUT (location_type l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_OUTPUT (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DEBUGLEVEL (location_type l)
-  {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_DEBUGLEVEL (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SEVERITY (location_type l)
-  {
-    return symbol_type (token::TOKEN_SEVERITY, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SEVERITY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SEVERITY, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_FLUSH (location_type l)
-  {
-    return symbol_type (token::TOKEN_FLUSH, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_FLUSH (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FLUSH, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_MAXSIZE (location_type l)
-  {
-    return symbol_type (token::TOKEN_MAXSIZE, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_MAXSIZE (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAXSIZE, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_MAXVER (location_type l)
-  {
-    return symbol_type (token::TOKEN_MAXVER, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_MAXVER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_MAXVER, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TOPLEVEL_JSON (location_type l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_JSON, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TOPLEVEL_JSON (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TOPLEVEL_DHCPDDNS (location_type l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_DHCPDDNS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_TOPLEVEL_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_DHCPDDNS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DHCPDDNS (location_type l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCPDDNS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DHCPDDNS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCPDDNS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_TSIG_KEY (location_type l)
-  {
-    return symbol_type (token::TOKEN_SUB_TSIG_KEY, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_TSIG_KEY (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_TSIG_KEY, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_TSIG_KEYS (location_type l)
-  {
-    return symbol_type (token::TOKEN_SUB_TSIG_KEYS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_TSIG_KEYS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_TSIG_KEYS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DDNS_DOMAIN (location_type l)
-  {
-    return symbol_type (token::TOKEN_SUB_DDNS_DOMAIN, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DDNS_DOMAIN (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DDNS_DOMAIN, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DDNS_DOMAINS (location_type l)
-  {
-    return symbol_type (token::TOKEN_SUB_DDNS_DOMAINS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DDNS_DOMAINS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DDNS_DOMAINS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DNS_SERVER (location_type l)
-  {
-    return symbol_type (token::TOKEN_SUB_DNS_SERVER, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DNS_SERVER (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DNS_SERVER, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DNS_SERVERS (location_type l)
-  {
-    return symbol_type (token::TOKEN_SUB_DNS_SERVERS, std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_SUB_DNS_SERVERS (const location_type& l)
-  {
-    return symbol_type (token::TOKEN_SUB_DNS_SERVERS, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_STRING (std::string v, location_type l)
-  {
-    return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_STRING (const std::string& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_STRING, v, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_INTEGER (int64_t v, location_type l)
-  {
-    return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_INTEGER (const int64_t& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_INTEGER, v, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_FLOAT (double v, location_type l)
-  {
-    return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_FLOAT (const double& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_FLOAT, v, l);
-  }
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_BOOLEAN (bool v, location_type l)
-  {
-    return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
-  }
-#else
-  inline
-  D2Parser::symbol_type
-  D2Parser::make_BOOLEAN (const bool& v, const location_type& l)
-  {
-    return symbol_type (token::TOKEN_BOOLEAN, v, l);
-  }
-#endif
 
-#line 14 "d2_parser.yy" // lalr1.cc:404
+
+#line 14 "d2_parser.yy"
 } } // isc::d2
-#line 2758 "d2_parser.h" // lalr1.cc:404
+#line 2692 "d2_parser.h"
 
 
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,7 +8,19 @@
 #include <d2/dns_client.h>
 #include <d2/d2_log.h>
 #include <dns/messagerenderer.h>
+#include <util/random/qid_gen.h>
+
+#include <boost/asio/deadline_timer.hpp>
+#include <boost/asio/ip/udp.hpp>
+#include <boost/bind.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/weak_ptr.hpp>
+
+#include <algorithm>
 #include <limits>
+#include <map>
+#include <utility>
+#include <vector>
 
 namespace isc {
 namespace d2 {
@@ -20,12 +32,164 @@ namespace {
 // DNSClient class.
 const size_t DEFAULT_BUFFER_SIZE = 128;
 
+// Size of the buffer into which responses are received by the shared UDP
+// sockets. It is the maximum size of the UDP datagram.
+const size_t MAX_UDP_RESPONSE_SIZE = 65535;
+
 }
 
 using namespace isc::util;
 using namespace isc::asiolink;
 using namespace isc::asiodns;
 using namespace isc::dns;
+using namespace isc::util::random;
+
+class DNSClientImpl;
+class UDPChannel;
+
+typedef boost::shared_ptr<UDPChannel> UDPChannelPtr;
+
+// This class represents the UDP sockets shared by all DNSClient instances
+// which exchange messages with the same DNS server using the same IO
+// service. Opening a new socket for each DNS Update consumes an ephemeral
+// port and several system calls per update, which becomes significant when
+// many updates are sent. Multiple exchanges may be in progress on the
+// sockets at the same time. Responses are matched with the exchanges using
+// the DNS message ID and the socket over which the request was sent.
+//
+// Sending all updates from a single port would leave only the message ID
+// to be guessed by an attacker spoofing responses. The channel therefore
+// sends each update over one of several sockets picked at random, each
+// bound to an ephemeral port chosen by the system, and replaces a socket
+// with a new one, on a new port, after a few updates.
+//
+// The channels are owned by the UDPChannelService of their IO service, so
+// as the sockets are closed before the IO service is destroyed.
+class UDPChannel : public boost::enable_shared_from_this<UDPChannel> {
+public:
+    // Constructor. The sockets are opened when they are first used.
+    UDPChannel(boost::asio::io_service& io_service,
+               const asiolink::IOAddress& ns_addr,
+               const uint16_t ns_port);
+
+    // Sends the message and waits for the response with the same message
+    // ID. The client is notified when the response is received or the
+    // timeout occurs. Returns false if another exchange with the same
+    // message ID is in progress or the channel is closed, in which case
+    // nothing is sent.
+    bool startExchange(DNSClientImpl* client, const util::OutputBufferPtr& msg_buf,
+                       const unsigned int wait);
+
+    // Cancels exchanges of the client without invoking its callback.
+    void cancelExchanges(DNSClientImpl* client);
+
+    // Cancels all exchanges without invoking the callbacks and closes the
+    // sockets. Called when the IO service is destroyed.
+    void close();
+
+private:
+    typedef boost::shared_ptr<boost::asio::deadline_timer> TimerPtr;
+
+    // A socket of the channel.
+    struct Port {
+        // Constructor. Opens the socket.
+        Port(boost::asio::io_service& io_service,
+             const boost::asio::ip::udp& protocol);
+
+        boost::asio::ip::udp::socket socket_;
+        boost::asio::ip::udp::endpoint sender_;
+        std::vector<uint8_t> receive_buf_;
+        bool receiving_;
+        // Number of exchanges in progress on the socket.
+        size_t exchanges_;
+        // Number of exchanges started on the socket.
+        size_t uses_;
+    };
+
+    typedef boost::shared_ptr<Port> PortPtr;
+
+    // A single message exchange in progress.
+    struct Exchange {
+        DNSClientImpl* client_;
+        TimerPtr timer_;
+        PortPtr port_;
+    };
+
+    typedef std::map<uint16_t, Exchange> ExchangeMap;
+
+    // Returns the socket for a new exchange, picked at random. A socket
+    // which has been used for DNSClient::SHARED_SOCKET_USES exchanges is
+    // first replaced with a new one.
+    PortPtr getPort();
+
+    // Starts the asynchronous receive on the socket if there are exchanges
+    // in progress on it and the receive is not outstanding yet.
+    void receive(const PortPtr& port);
+
+    // Completion handler of the asynchronous send. Holds the sent buffer
+    // until the send completes.
+    void sendHandler(const util::OutputBufferPtr& msg_buf,
+                     const boost::system::error_code& ec);
+
+    // Completion handler of the asynchronous receive.
+    void receiveHandler(const PortPtr& port,
+                        const boost::system::error_code& ec,
+                        const size_t length);
+
+    // Completion handler of the exchange timer.
+    void timeoutHandler(const uint16_t qid, const TimerPtr& timer,
+                        const boost::system::error_code& ec);
+
+    // Removes the exchange and notifies the client.
+    void finishExchange(ExchangeMap::iterator exchange,
+                        const asiodns::IOFetch::Result result,
+                        const uint8_t* data, const size_t length);
+
+    // Removes the exchange. When there are no more exchanges on its socket,
+    // cancels the outstanding receive, so as the socket can be closed when
+    // it is no longer used, or closes the socket if it has been replaced.
+    void removeExchange(ExchangeMap::iterator exchange);
+
+    boost::asio::io_service& io_service_;
+    boost::asio::ip::udp::endpoint server_;
+    std::vector<PortPtr> ports_;
+    ExchangeMap exchanges_;
+    bool closed_;
+};
+
+// This service of the IO service owns the UDP channels created for it. It
+// is shut down when the IO service is destroyed and closes the channels,
+// so as no socket outlives the IO service, even if the DNSClient instances
+// which used it still exist.
+class UDPChannelService : public boost::asio::io_service::service {
+public:
+    // Identifier of the service.
+    static boost::asio::io_service::id id;
+
+    // Constructor.
+    explicit UDPChannelService(boost::asio::io_service& io_service);
+
+    // Returns the channel for the server, creating it if necessary.
+    UDPChannelPtr getChannel(const asiolink::IOAddress& ns_addr,
+                             const uint16_t ns_port);
+
+private:
+#if BOOST_VERSION < 106600
+    // Called by the IO service when it is destroyed.
+    virtual void shutdown_service() {
+        shutdown();
+    }
+#endif
+
+    // Closes the channels.
+    virtual void shutdown();
+
+    typedef std::map<std::pair<asiolink::IOAddress, uint16_t>,
+                     UDPChannelPtr> ChannelMap;
+
+    boost::asio::io_service& io_service_;
+    ChannelMap channels_;
+};
 
 // This class provides the implementation for the DNSClient. This allows for
 // the separation of the DNSClient interface from the implementation details.
@@ -55,6 +219,9 @@ public:
     DNSClient::Protocol proto_;
     // TSIG context used to sign outbound and verify inbound messages.
     dns::TSIGContextPtr tsig_context_;
+    // Shared UDP sockets used for the most recent exchange. They are owned
+    // by the IO service.
+    boost::weak_ptr<UDPChannel> channel_;
 
     // Constructor and Destructor
     DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
@@ -68,6 +235,12 @@ public:
     // type, representing a response from the server is set.
     virtual void operator()(asiodns::IOFetch::Result result);
 
+    // This internal callback is called by the shared UDP socket when the
+    // exchange is complete. It copies the response into the input buffer
+    // and calls the callback above.
+    void exchangeCompleted(asiodns::IOFetch::Result result,
+                           const uint8_t* data, const size_t length);
+
     // Starts asynchronous DNS Update using TSIG.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
@@ -118,6 +291,21 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
 }
 
 DNSClientImpl::~DNSClientImpl() {
+    // Make sure that the shared sockets don't call back this object.
+    UDPChannelPtr channel = channel_.lock();
+    if (channel) {
+        channel->cancelExchanges(this);
+    }
+}
+
+void
+DNSClientImpl::exchangeCompleted(asiodns::IOFetch::Result result,
+                                 const uint8_t* data, const size_t length) {
+    in_buf_->clear();
+    if (result == IOFetch::SUCCESS) {
+        in_buf_->writeData(data, length);
+    }
+    (*this)(result);
 }
 
 void
@@ -213,6 +401,25 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     // invalid message object is given.
     update.toWire(renderer, tsig_context_.get());
 
+    // Send the message over the sockets shared with other clients talking
+    // to this server. If they can't be opened or another exchange with the
+    // same message ID is in progress, fall back to a dedicated socket.
+    UDPChannelPtr previous = channel_.lock();
+    channel_.reset();
+    try {
+        UDPChannelPtr channel = boost::asio::use_service<UDPChannelService>(
+            io_service.get_io_service()).getChannel(ns_addr, ns_port);
+        if (previous && (previous != channel)) {
+            previous->cancelExchanges(this);
+        }
+        if (channel->startExchange(this, msg_buf, wait)) {
+            channel_ = channel;
+            return;
+        }
+    } catch (const std::exception&) {
+        // Use the dedicated socket.
+    }
+
     // IOFetch has all the mechanisms that we need to perform asynchronous
     // communication with the DNS server. The last but one argument points to
     // this object as a completion callback for the message exchange. As a
@@ -229,6 +436,230 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     io_service.post(io_fetch);
 }
 
+boost::asio::io_service::id UDPChannelService::id;
+
+UDPChannelService::UDPChannelService(boost::asio::io_service& io_service)
+    : boost::asio::io_service::service(io_service), io_service_(io_service),
+      channels_() {
+    // The services are shut down in the reverse order of their creation.
+    // Make sure that the services used by the sockets and the timers of
+    // the channels are created first, so as they are still running when
+    // the channels are closed.
+    boost::asio::ip::udp::socket socket(io_service);
+    boost::asio::deadline_timer timer(io_service);
+}
+
+UDPChannelPtr
+UDPChannelService::getChannel(const asiolink::IOAddress& ns_addr,
+                              const uint16_t ns_port) {
+    UDPChannelPtr& channel = channels_[std::make_pair(ns_addr, ns_port)];
+    if (!channel) {
+        channel.reset(new UDPChannel(io_service_, ns_addr, ns_port));
+    }
+    return (channel);
+}
+
+void
+UDPChannelService::shutdown() {
+    for (ChannelMap::iterator it = channels_.begin(); it != channels_.end();
+         ++it) {
+        it->second->close();
+    }
+    channels_.clear();
+}
+
+UDPChannel::Port::Port(boost::asio::io_service& io_service,
+                       const boost::asio::ip::udp& protocol)
+    : socket_(io_service, protocol), sender_(),
+      receive_buf_(MAX_UDP_RESPONSE_SIZE), receiving_(false), exchanges_(0),
+      uses_(0) {
+}
+
+UDPChannel::UDPChannel(boost::asio::io_service& io_service,
+                       const asiolink::IOAddress& ns_addr,
+                       const uint16_t ns_port)
+    : io_service_(io_service),
+      server_(boost::asio::ip::address::from_string(ns_addr.toText()), ns_port),
+      ports_(DNSClient::SHARED_SOCKETS), exchanges_(), closed_(false) {
+}
+
+UDPChannel::PortPtr
+UDPChannel::getPort() {
+    PortPtr& port = ports_[QidGenerator::getInstance().generateQid() %
+                           ports_.size()];
+    if (!port || (port->uses_ >= DNSClient::SHARED_SOCKET_USES)) {
+        // The replaced socket is closed when its last exchange is removed.
+        PortPtr replaced = port;
+        port.reset(new Port(io_service_, server_.protocol()));
+        if (replaced && (replaced->exchanges_ == 0)) {
+            boost::system::error_code ec;
+            replaced->socket_.close(ec);
+        }
+    }
+    ++port->uses_;
+    return (port);
+}
+
+bool
+UDPChannel::startExchange(DNSClientImpl* client, const OutputBufferPtr& msg_buf,
+                          const unsigned int wait) {
+    if (closed_ || (msg_buf->getLength() < sizeof(uint16_t))) {
+        return (false);
+    }
+
+    // The message ID is held in the first two bytes of the message.
+    const uint8_t* data = static_cast<const uint8_t*>(msg_buf->getData());
+    const uint16_t qid = (static_cast<uint16_t>(data[0]) << 8) | data[1];
+    if (exchanges_.count(qid) > 0) {
+        return (false);
+    }
+
+    Exchange exchange;
+    exchange.client_ = client;
+    exchange.port_ = getPort();
+    exchange.timer_.reset(new boost::asio::deadline_timer(io_service_));
+    exchange.timer_->expires_from_now(boost::posix_time::milliseconds(wait));
+    exchange.timer_->async_wait(boost::bind(&UDPChannel::timeoutHandler,
+                                            shared_from_this(), qid,
+                                            exchange.timer_, _1));
+    exchanges_[qid] = exchange;
+    ++exchange.port_->exchanges_;
+
+    exchange.port_->socket_.async_send_to(
+        boost::asio::buffer(msg_buf->getData(), msg_buf->getLength()),
+        server_,
+        boost::bind(&UDPChannel::sendHandler, shared_from_this(), msg_buf, _1));
+    receive(exchange.port_);
+    return (true);
+}
+
+void
+UDPChannel::cancelExchanges(DNSClientImpl* client) {
+    for (ExchangeMap::iterator it = exchanges_.begin(); it != exchanges_.end(); ) {
+        if (it->second.client_ == client) {
+            removeExchange(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+UDPChannel::close() {
+    closed_ = true;
+    boost::system::error_code ec;
+    for (ExchangeMap::iterator it = exchanges_.begin(); it != exchanges_.end();
+         ++it) {
+        it->second.timer_->cancel(ec);
+        it->second.port_->socket_.close(ec);
+    }
+    exchanges_.clear();
+    for (std::vector<PortPtr>::iterator port = ports_.begin();
+         port != ports_.end(); ++port) {
+        if (*port) {
+            (*port)->socket_.close(ec);
+        }
+    }
+    ports_.clear();
+}
+
+void
+UDPChannel::receive(const PortPtr& port) {
+    if (!port->receiving_ && (port->exchanges_ > 0) && port->socket_.is_open()) {
+        port->receiving_ = true;
+        port->socket_.async_receive_from(boost::asio::buffer(port->receive_buf_),
+                                         port->sender_,
+                                         boost::bind(&UDPChannel::receiveHandler,
+                                                     shared_from_this(), port,
+                                                     _1, _2));
+    }
+}
+
+void
+UDPChannel::sendHandler(const OutputBufferPtr&,
+                        const boost::system::error_code& ec) {
+    // If the send failed the exchange will time out, the same as when
+    // the response is lost.
+    if (ec && (ec != boost::asio::error::operation_aborted)) {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_UDP_SEND_FAILED)
+            .arg(server_.address().to_string())
+            .arg(server_.port())
+            .arg(ec.message());
+    }
+}
+
+void
+UDPChannel::receiveHandler(const PortPtr& port,
+                           const boost::system::error_code& ec,
+                           const size_t length) {
+    port->receiving_ = false;
+
+    // Ignore datagrams which are too short or not sent by the server, as
+    // well as responses to the exchanges which have already completed or
+    // which were sent over another socket.
+    if (!ec && (length >= sizeof(uint16_t)) && (port->sender_ == server_)) {
+        const uint16_t qid = (static_cast<uint16_t>(port->receive_buf_[0]) << 8) |
+            port->receive_buf_[1];
+        ExchangeMap::iterator exchange = exchanges_.find(qid);
+        if ((exchange != exchanges_.end()) && (exchange->second.port_ == port)) {
+            finishExchange(exchange, IOFetch::SUCCESS, &port->receive_buf_[0],
+                           length);
+        }
+    }
+
+    // Continue receiving if there are other exchanges in progress.
+    receive(port);
+}
+
+void
+UDPChannel::timeoutHandler(const uint16_t qid, const TimerPtr& timer,
+                           const boost::system::error_code& ec) {
+    if (ec == boost::asio::error::operation_aborted) {
+        return;
+    }
+
+    // Make sure that the exchange hasn't been replaced by a new exchange
+    // with the same message ID.
+    ExchangeMap::iterator exchange = exchanges_.find(qid);
+    if ((exchange != exchanges_.end()) && (exchange->second.timer_ == timer)) {
+        finishExchange(exchange, IOFetch::TIME_OUT, NULL, 0);
+    }
+}
+
+void
+UDPChannel::finishExchange(ExchangeMap::iterator exchange,
+                           const asiodns::IOFetch::Result result,
+                           const uint8_t* data, const size_t length) {
+    // The exchange is removed before the client is notified because the
+    // client may start a new exchange or be destroyed in its callback.
+    // The channel must survive until this function returns.
+    UDPChannelPtr self = shared_from_this();
+    DNSClientImpl* client = exchange->second.client_;
+    removeExchange(exchange);
+
+    client->exchangeCompleted(result, data, length);
+}
+
+void
+UDPChannel::removeExchange(ExchangeMap::iterator exchange) {
+    PortPtr port = exchange->second.port_;
+    boost::system::error_code ec;
+    exchange->second.timer_->cancel(ec);
+    exchanges_.erase(exchange);
+
+    if (--port->exchanges_ == 0) {
+        if (std::find(ports_.begin(), ports_.end(), port) == ports_.end()) {
+            port->socket_.close(ec);
+        } else if (port->receiving_) {
+            port->socket_.cancel(ec);
+        }
+    }
+}
+
+const size_t DNSClient::SHARED_SOCKETS;
+const size_t DNSClient::SHARED_SOCKET_USES;
+
 DNSClient::DNSClient(D2UpdateMessagePtr& response_placeholder,
                      Callback* callback, const DNSClient::Protocol proto)
     : impl_(new DNSClientImpl(response_placeholder, callback, proto)) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017,2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -39,6 +39,18 @@ class DNSClientImpl;
 /// encapsulate DNS response, through class constructor. An exception will be
 /// thrown if the pointer is not initialized by the caller.
 ///
+/// The UDP messages sent to the same DNS server are sent over a pool of
+/// @c SHARED_SOCKETS sockets shared by all @c DNSClient instances using the
+/// same IO service, which avoids opening a new socket and consuming a new
+/// ephemeral port for each update. Each update is sent over a socket of the
+/// pool picked at random, and a socket is replaced with a new one, bound to
+/// a new ephemeral port, after @c SHARED_SOCKET_USES updates, so as the
+/// source port of the updates remains hard to guess. Responses are matched
+/// with the requests using the DNS message ID and the socket over which the
+/// request was sent. The sockets are owned by the IO service and are closed
+/// when it is destroyed. If another update with the same message ID is in
+/// progress towards the server, the update is sent over a dedicated socket.
+///
 /// @todo Ultimately, this class will support both TCP and UDP Transport.
 /// Currently only UDP is supported and can be specified as a preferred
 /// protocol. @c DNSClient constructor will throw an exception if TCP is
@@ -56,6 +68,13 @@ public:
         TCP
     };
 
+    /// @brief Number of sockets shared by the updates sent to a DNS server.
+    static const size_t SHARED_SOCKETS = 8;
+
+    /// @brief Number of updates sent over a shared socket before it is
+    /// replaced with a socket bound to a new ephemeral port.
+    static const size_t SHARED_SOCKET_USES = 16;
+
     /// @brief A status code of the DNSClient.
     enum Status {
         SUCCESS,           ///< Response received and is ok.
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,6 +18,9 @@
 #include <gtest/gtest.h>
 #include <nc_test_utils.h>
 
+#include <map>
+#include <vector>
+
 using namespace std;
 using namespace isc;
 using namespace isc::asiolink;
@@ -404,6 +407,119 @@ public:
         service_.get_io_service().reset();
     }
 
+    /// @brief Handler invoked when one of the concurrent requests is received
+    //
+    // This handler records the address and port from which the request has
+    // come and sends a valid response to it. It then schedules reception of
+    // the next request until the specified number of requests is received.
+    //
+    // @param socket A pointer to a socket used to receive a query and send a
+    // response.
+    // @param remote A pointer to an object which specifies the host (address
+    // and port) from which a request has come.
+    // @param remotes A pointer to the vector holding the recorded endpoints.
+    // @param requests Number of requests to be received.
+    // @param receive_length A length (in bytes) of the received data.
+    void sharedReceiveHandler(udp::socket* socket, udp::endpoint* remote,
+                              std::vector<udp::endpoint>* remotes,
+                              const size_t requests, size_t receive_length) {
+        remotes->push_back(*remote);
+        udpReceiveHandler(socket, remote, receive_length, false);
+        if (remotes->size() < requests) {
+            socket->async_receive_from(boost::asio::buffer(receive_buffer_,
+                                                           sizeof(receive_buffer_)),
+                                       *remote,
+                                       boost::bind(&DNSClientTest::sharedReceiveHandler,
+                                                   this, socket, remote, remotes,
+                                                   requests, _2));
+        }
+    }
+
+    // This test verifies that concurrent DNS Updates sent by different
+    // DNSClient instances to the same server are sent over the shared
+    // sockets and that the responses are delivered to the right instances.
+    //
+    // @param clients Number of DNSClient instances sending an update.
+    // @param ports Set to the number of updates sent from each source port.
+    void runSharedSocketTest(const size_t clients,
+                             std::map<uint16_t, size_t>& ports) {
+        // Create the clients, each with its own response placeholder and
+        // a request with its own message ID. The first client is the one
+        // created by the fixture.
+        std::vector<D2UpdateMessagePtr> responses(clients);
+        std::vector<DNSClientPtr> dns_clients;
+        for (size_t i = 0; i < clients; ++i) {
+            dns_clients.push_back(i == 0 ? dns_client_ :
+                                  DNSClientPtr(new DNSClient(responses[i], this)));
+        }
+
+        // Emulate the server which expects all requests.
+        udp::socket udp_socket(service_.get_io_service(), boost::asio::ip::udp::v4());
+        udp_socket.set_option(socket_base::reuse_address(true));
+        udp_socket.bind(udp::endpoint(address::from_string(TEST_ADDRESS),
+                                      TEST_PORT));
+        udp::endpoint remote;
+        std::vector<udp::endpoint> remotes;
+        udp_socket.async_receive_from(boost::asio::buffer(receive_buffer_,
+                                                          sizeof(receive_buffer_)),
+                                      remote,
+                                      boost::bind(&DNSClientTest::sharedReceiveHandler,
+                                                  this, &udp_socket, &remote,
+                                                  &remotes, clients, _2));
+
+        // Send all requests before any response is received.
+        const int timeout = 500;
+        expected_ = clients;
+        for (size_t i = 0; i < clients; ++i) {
+            D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+            ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+            message.setId(0x1000 + i);
+            dns_clients[i]->doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                     TEST_PORT, message, timeout);
+        }
+        service_.run();
+
+        udp_socket.close();
+        service_.get_io_service().reset();
+
+        // All clients should have received their own responses.
+        EXPECT_EQ(clients, received_);
+        responses[0] = response_;
+        for (size_t i = 0; i < clients; ++i) {
+            ASSERT_TRUE(responses[i]) << "client " << i;
+            EXPECT_EQ(0x1000 + i, responses[i]->getId());
+        }
+
+        ASSERT_EQ(clients, remotes.size());
+        ports.clear();
+        for (size_t i = 0; i < remotes.size(); ++i) {
+            ++ports[remotes[i].port()];
+        }
+    }
+
+    // This test verifies that the shared sockets are closed when the IO
+    // service is destroyed before the DNSClient and that the client is not
+    // called back.
+    void runServiceDestroyedTest() {
+        D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+        ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+
+        D2UpdateMessagePtr response;
+        DNSClientPtr dns_client(new DNSClient(response, this));
+        {
+            IOService service;
+            dns_client->doUpdate(service, IOAddress(TEST_ADDRESS), TEST_PORT,
+                                 message, 100);
+            service.get_io_service().poll();
+        }
+
+        // The exchange has been dropped with the sockets. Destroying the
+        // client must not touch them.
+        EXPECT_NO_THROW(dns_client.reset());
+        EXPECT_EQ(0, received_);
+        EXPECT_FALSE(response);
+    }
+
     // Performs a single request-response exchange with or without TSIG
     //
     // @param client_key TSIG passed to dns_client and also used by the
@@ -541,6 +657,35 @@ TEST_F(DNSClientTest, sendReceiveTwice) {
     EXPECT_EQ(2, received_);
 }
 
+// Verify that concurrent updates sent by different DNSClient instances to
+// the same server share the sockets and receive their own responses.
+TEST_F(DNSClientTest, sharedSocket) {
+    std::map<uint16_t, size_t> ports;
+    runSharedSocketTest(2, ports);
+}
+
+// Verify that the updates sent over the shared sockets come from several
+// source ports and that no port is used for more than the allowed number
+// of updates.
+TEST_F(DNSClientTest, sharedSocketPorts) {
+    const size_t clients = 4 * DNSClient::SHARED_SOCKETS;
+    std::map<uint16_t, size_t> ports;
+    runSharedSocketTest(clients, ports);
+    EXPECT_LE(clients / DNSClient::SHARED_SOCKET_USES, ports.size());
+    EXPECT_LT(1, ports.size());
+    for (std::map<uint16_t, size_t>::const_iterator port = ports.begin();
+         port != ports.end(); ++port) {
+        EXPECT_GE(DNSClient::SHARED_SOCKET_USES, port->second)
+            << "port " << port->first;
+    }
+}
+
+// Verify that the shared sockets are closed when the IO service is
+// destroyed before the DNSClient and that the client is not called back.
+TEST_F(DNSClientTest, sharedSocketServiceDestroyed) {
+    runServiceDestroyedTest();
+}
+
 // Verify that it is possible to use the DNSClient instance to perform the
 // following  sequence of message exchanges:
 // 1. send
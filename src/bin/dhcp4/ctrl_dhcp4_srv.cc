@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,14 +18,18 @@
 #include <hooks/hooks.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/stopwatch.h>
 #include <cfgrpt/config_report.h>
 #include <signal.h>
+
+#include <algorithm>
 #include <sstream>
 
 using namespace isc::data;
 using namespace isc::db;
 using namespace isc::dhcp;
 using namespace isc::hooks;
+using namespace isc::process;
 using namespace isc::config;
 using namespace isc::stats;
 using namespace std;
@@ -325,6 +329,9 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
         return (result);
     }
 
+    // Measure the time it takes to apply the new configuration.
+    util::Stopwatch stopwatch;
+
     // We are starting the configuration process so we should remove any
     // staging configuration that has been created during previous
     // configuration attempts.
@@ -356,6 +363,11 @@ ControlledDhcpv4Srv::commandConfigSetHandler(const string&,
 
         // Use new configuration.
         CfgMgr::instance().commit();
+
+        // Report how long the reconfiguration took.
+        stopwatch.stop();
+        StatsMgr::instance().setValue("reconfiguration-duration",
+                                      stopwatch.getTotalDuration());
     } else {
         // Ok, we applied the logging from the upcoming configuration, but
         // there were problems with the config. As such, we need to back off
@@ -673,6 +685,23 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Install the timer for fetching configuration updates from the
+    // configuration backends.
+    ConstConfigControlInfoPtr config_ctl =
+        CfgMgr::instance().getStagingCfg()->getConfigControlInfo();
+    if (config_ctl && !config_ctl->getConfigDatabases().empty() &&
+        (config_ctl->getConfigFetchWaitTime() > 0)) {
+        // The elements fetched during the server configuration are not
+        // tracked, so the first fetch merges all elements held in the
+        // configuration backends.
+        server_->cb_fetch_cursor_ = CBFetchCursor();
+        TimerMgr::instance()->registerTimer("Dhcp4CBFetchTimer",
+            boost::bind(&ControlledDhcpv4Srv::cbFetchUpdates, server_),
+            config_ctl->getConfigFetchWaitTime() * 1000,
+            asiolink::IntervalTimer::ONE_SHOT);
+        TimerMgr::instance()->setup("Dhcp4CBFetchTimer");
+    }
+
     // This hook point notifies hooks libraries that the configuration of the
     // DHCPv4 server has completed. It provides the hook library with the pointer
     // to the common IO service object, new server configuration in the JSON
@@ -767,6 +796,13 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
     CommandMgr::instance().registerCommand("version-get",
         boost::bind(&ControlledDhcpv4Srv::commandVersionGetHandler, this, _1, _2));
 
+    // Register callout statistics commands
+    CommandMgr::instance().registerCommand("callout-statistics-get",
+        boost::bind(&HooksManager::calloutStatisticsGetHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("callout-statistics-reset",
+        boost::bind(&HooksManager::calloutStatisticsResetHandler, _1, _2));
+
     // Register statistic related commands
     CommandMgr::instance().registerCommand("statistic-get",
         boost::bind(&StatsMgr::statisticGetHandler, _1, _2));
@@ -780,6 +816,9 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
     CommandMgr::instance().registerCommand("statistic-get-all",
         boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("statistic-export",
+        boost::bind(&StatsMgr::statisticExportHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("statistic-reset-all",
         boost::bind(&StatsMgr::statisticResetAllHandler, _1, _2));
 
@@ -808,6 +847,8 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
 
         // Deregister any registered commands (please keep in alphabetic order)
         CommandMgr::instance().deregisterCommand("build-report");
+        CommandMgr::instance().deregisterCommand("callout-statistics-get");
+        CommandMgr::instance().deregisterCommand("callout-statistics-reset");
         CommandMgr::instance().deregisterCommand("config-get");
         CommandMgr::instance().deregisterCommand("config-reload");
         CommandMgr::instance().deregisterCommand("config-test");
@@ -818,6 +859,7 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("dhcp-disable");
         CommandMgr::instance().deregisterCommand("dhcp-enable");
         CommandMgr::instance().deregisterCommand("shutdown");
+        CommandMgr::instance().deregisterCommand("statistic-export");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-remove");
@@ -849,11 +891,21 @@ ControlledDhcpv4Srv::reclaimExpiredLeases(const size_t max_leases,
                                           const uint16_t timeout,
                                           const bool remove_lease,
                                           const uint16_t max_unwarned_cycles) {
-    server_->alloc_engine_->reclaimExpiredLeases4(max_leases, timeout,
-                                                  remove_lease,
-                                                  max_unwarned_cycles);
+    const bool incomplete =
+        server_->alloc_engine_->reclaimExpiredLeases4(max_leases, timeout,
+                                                      remove_lease,
+                                                      max_unwarned_cycles);
     // We're using the ONE_SHOT timer so there is a need to re-schedule it.
-    TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+    // If some expired leases are left, the next pass is run after the time
+    // equal to the maximum duration of the pass rather than the configured
+    // timer interval. The server processes the received packets between
+    // the passes, so it isn't starved while the reclamation catches up.
+    if (incomplete) {
+        TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME,
+                                    std::max(static_cast<long>(timeout), 1L));
+    } else {
+        TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+    }
 }
 
 void
@@ -912,6 +964,18 @@ ControlledDhcpv4Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
     }
 }
 
+void
+ControlledDhcpv4Srv::cbFetchUpdates() {
+    try {
+        databaseConfigFetchUpdates(CfgMgr::instance().getCurrentCfg(),
+                                   cb_fetch_cursor_);
+    } catch (const std::exception& ex) {
+        LOG_ERROR(dhcp4_logger, DHCP4_CB_FETCH_UPDATES_FAIL).arg(ex.what());
+    }
+    // We're using the ONE_SHOT timer so there is a need to re-schedule it.
+    TimerMgr::instance()->setup("Dhcp4CBFetchTimer");
+}
+
 bool
 ControlledDhcpv4Srv::dbLostCallback(ReconnectCtlPtr db_reconnect_ctl) {
     // Disable service until we recover
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 #include <database/database_connection.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp4/dhcp4_srv.h>
+#include <dhcp4/json_config_parser.h>
 
 namespace isc {
 namespace dhcp {
@@ -292,7 +293,9 @@ private:
     ///
     /// This is a wrapper method for @c AllocEngine::reclaimExpiredLeases4.
     /// It reschedules the timer for leases reclamation upon completion of
-    /// this method.
+    /// this method. If not all expired leases have been reclaimed, the
+    /// timer is rescheduled to run the next pass after the @c timeout
+    /// rather than after the configured timer interval.
     ///
     /// @param max_leases Maximum number of leases to be reclaimed.
     /// @param timeout Maximum amount of time that the reclamation routine
@@ -358,6 +361,15 @@ private:
     /// @return false if reconnect is not configured, true otherwise
     bool dbLostCallback(db::ReconnectCtlPtr db_reconnect_ctl);
 
+    /// @brief Fetches configuration updates from the configuration backends
+    /// and reschedules the timer.
+    ///
+    /// This is a wrapper method for @c databaseConfigFetchUpdates. It merges
+    /// the configuration elements modified since the previous fetch into
+    /// the current configuration and reschedules the timer upon completion
+    /// of this method.
+    void cbFetchUpdates();
+
     /// @brief Static pointer to the sole instance of the DHCP server.
     ///
     /// This is required for config and command handlers to gain access to
@@ -372,6 +384,10 @@ private:
     /// Shared pointer to the instance of timer @c TimerMgr is held here to
     /// make sure that the @c TimerMgr outlives instance of this class.
     TimerMgrPtr timer_mgr_;
+
+    /// @brief Position of the configuration updates fetched from the
+    /// configuration backends.
+    CBFetchCursor cb_fetch_cursor_;
 };
 
 }; // namespace isc::dhcp
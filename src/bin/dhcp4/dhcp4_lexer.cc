@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 175
-#define YY_END_OF_BUFFER 176
+#define YY_NUM_RULES 180
+#define YY_END_OF_BUFFER 181
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,169 +700,176 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1468] =
+static const flex_int16_t yy_accept[1524] =
     {   0,
-      168,  168,    0,    0,    0,    0,    0,    0,    0,    0,
-      176,  174,   10,   11,  174,    1,  168,  165,  168,  168,
-      174,  167,  166,  174,  174,  174,  174,  174,  161,  162,
-      174,  174,  174,  163,  164,    5,    5,    5,  174,  174,
-      174,   10,   11,    0,    0,  157,    0,    0,    0,    0,
+      173,  173,    0,    0,    0,    0,    0,    0,    0,    0,
+      181,    1,  179,  179,  179,   10,   11,  166,  167,  168,
+      169,  170,  171,  173,  173,  172,  173,  179,  179,  179,
+      179,  179,  179,  179,  179,    5,    5,    5,  179,  179,
+      179,    1,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      168,  168,    0,  167,  168,    3,    2,    6,    0,  168,
+        0,    0,    0,    0,    0,    0,  162,    0,    3,    2,
+        6,   10,   11,  172,  173,    0,  173,  173,    0,  173,
         0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
 
-        0,  158,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  160,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  165,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    2,    0,
-        0,    0,    0,    0,    0,    0,    8,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  163,
+        2,    0,    0,    0,    0,    0,    0,    0,    8,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,  159,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  164,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   67,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   68,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  173,  171,    0,
-      170,  169,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  176,  174,    0,    0,  178,  175,    0,
 
-        0,    0,  137,    0,  136,    0,    0,   73,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   34,
+        0,    0,  142,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   71,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  141,    0,    0,   74,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   35,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   70,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   17,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   18,    0,    0,    0,    0,  172,  169,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  138,
-        0,    0,  140,    0,    0,    0,    0,    0,    0,    0,
-        0,   74,    0,    0,    0,    0,    0,    0,   59,    0,
-        0,    0,    0,    0,   91,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   37,    0,    0,    0,    0,
+        0,   17,   18,    0,    0,    0,    0,  174,  177,    0,
+       93,    0,    0,  145,   31,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   58,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   62,    0,   38,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  143,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   75,    0,    0,    0,    0,
+        0,   60,    0,    0,    0,   96,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   38,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   59,    0,
 
-        0,    0,    0,    0,    0,   88,   30,    0,    0,   35,
-        0,    0,    0,    0,    0,    0,    0,    0,   12,  145,
-        0,  142,    0,  141,    0,    0,    0,  101,    0,    0,
+        0,   63,   39,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   36,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  102,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   12,  150,    0,  147,    0,  146,    0,    0,    0,
+      106,   86,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       81,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   83,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   32,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   61,    0,    0,    0,
-        0,    0,    0,    0,    0,  102,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,   97,    0,
-        0,    0,    0,    0,    0,    0,    7,    0,    0,  143,
+        0,   33,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   62,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  107,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    7,    0,    0,    0,    0,
+        0,    0,    0,   66,    0,    0,    0,    0,    0,    0,
+        0,   80,    0,    0,    0,    0,    0,    0,  148,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   73,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       72,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   83,
-        0,    0,    0,    0,    0,    0,    0,    0,   79,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,   85,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,   65,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   76,    0,    0,    0,
-        0,    0,    0,    0,    0,   64,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   95,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  107,   77,
-        0,    0,    0,    0,   82,   31,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   39,    0,    0,
+        0,    0,    0,    0,    0,    0,   55,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   77,    0,    0,    0,    0,    0,   65,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  100,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,   54,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  146,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   78,    0,  112,    0,    0,    0,
+        0,   84,   32,    0,    0,    0,    0,    0,    0,   40,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   89,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   69,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   96,    0,    0,    0,    0,    0,
-       42,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   36,
-        0,    0,    0,   29,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   84,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  151,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   70,    0,    0,    0,    0,
+        0,    0,    0,  101,    0,    0,    0,    0,    0,    0,
 
+        0,   43,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   37,    0,    0,    0,    0,   30,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  128,    0,    0,    0,  130,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       98,    0,    0,    0,  125,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   93,    0,    0,    0,    0,    0,    0,    0,    0,
-      120,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   66,    0,    0,    0,
+        0,    0,    0,   67,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   23,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   54,    0,    0,    0,
+        0,    0,    0,   57,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  155,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   99,    0,  103,
+        0,    0,    0,   81,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   97,    0,  108,    0,
+       22,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      134,   34,  111,    0,   87,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,   82,    0,    0,    0,    0,   47,
+      129,    0,  131,    0,    0,    0,  123,  122,   58,   72,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       23,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  125,    0,    0,  123,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  150,    0,
-        0,    0,    0,    0,    0,   94,    0,    0,    0,    0,
-
-        0,    0,   98,   80,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   92,
-       22,    0,  103,    0,    0,    0,    0,    0,    0,    0,
-        0,  129,    0,    0,    0,    0,   56,    0,    0,    0,
-        0,    0,  106,   33,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   53,
+        0,   61,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  105,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   60,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  100,    0,
+        0,    0,    0,    0,    0,  159,    0,    0,    0,    0,
+        0,    0,    0,   51,    0,    0,    0,    0,    0,   21,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  144,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,  154,    0,   57,
-       71,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       50,    0,    0,    0,    0,    0,    0,    0,  126,    0,
-      124,    0,  118,  117,    0,   46,    0,   21,    0,    0,
-        0,    0,    0,  139,    0,    0,   87,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  115,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  104,   15,
-        0,   40,    0,    0,    0,    0,    0,  128,    0,    0,
-        0,    0,    0,    0,   51,    0,    0,   99,    0,    0,
-        0,    0,   90,    0,    0,    0,    0,    0,    0,   63,
-
-        0,  148,    0,  147,    0,  153,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   92,    0,    0,    0,  120,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  109,    0,    0,   15,   41,    0,    0,    0,    0,
+        0,  133,    0,    0,   52,    0,    0,  104,    0,    0,
+        0,   95,    0,   64,   46,    0,    0,   14,    0,    0,
+        0,    0,    0,    0,    0,    0,  153,    0,  152,    0,
+      158,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,   79,    0,    0,    0,    0,   50,    0,    0,  161,
+        0,    0,   27,    0,   48,  121,   90,    0,    0,    0,
+      126,  156,    0,    0,    0,    0,    0,    0,   25,    0,
+        0,    0,    0,   24,    0,    0,    0,    0,  132,    0,
+        0,    0,    0,    0,    0,    0,    0,  160,   20,   56,
+        0,    0,   88,    0,    0,    0,    0,    0,    0,   42,
+        0,    0,    0,    0,    0,    0,    0,    0,   26,    0,
+        0,  110,    0,  157,    0,    0,    0,    0,    0,    0,
+        0,   45,    0,    0,    0,    0,   94,    0,    0,  154,
+      149,   28,    0,    0,   16,    0,    0,    0,  138,    0,
+
+        0,    0,    0,    0,    0,  118,    0,    0,    0,    0,
+        0,    0,   69,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  139,    0,    0,   13,    0,    0,  127,
+        0,    0,    0,    0,    0,   19,    0,  135,    0,  124,
+        0,    0,    0,    0,    0,    0,  117,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   14,    0,    0,   45,
-        0,    0,    0,    0,  156,   85,   27,    0,    0,   47,
-      116,    0,    0,    0,  151,  121,    0,    0,    0,    0,
-        0,    0,    0,    0,   25,    0,    0,   24,    0,  127,
-        0,    0,    0,    0,    0,   78,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   49,
-
-        0,    0,    0,   41,    0,    0,    0,    0,    0,    0,
-        0,  105,    0,    0,    0,   26,    0,  152,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   44,
-        0,    0,   20,  155,   55,    0,  149,  144,   28,    0,
-        0,   16,    0,    0,  133,    0,    0,    0,    0,    0,
-        0,  113,    0,   89,    0,    0,    0,    0,    0,    0,
-        0,    0,   68,    0,    0,    0,    0,    0,    0,    0,
-        0,  134,   13,    0,    0,    0,    0,    0,  122,    0,
-        0,    0,    0,    0,    0,  119,    0,    0,    0,    0,
-        0,  112,    0,   19,    0,  130,    0,    0,    0,    0,
-
-        0,    0,    0,    0,  111,    0,    0,   48,    0,    0,
-       43,  132,    0,    0,    0,    0,    0,    0,    0,    0,
+      116,   49,  137,    0,   44,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  131,    0,   86,
-        0,    0,    0,    0,    0,    0,  109,  114,   52,    0,
-        0,    0,    0,  108,    0,    0,  135,    0,    0,    0,
-        0,    0,   75,    0,    0,  110,    0
+        0,    0,    0,    0,    0,    0,    0,  136,   29,    0,
+        0,    0,    0,    0,    0,   91,    0,    0,    0,    0,
+
+        0,    0,  114,  119,   53,    0,    0,    0,    0,  113,
+        0,  140,    0,    0,    0,    0,    0,    0,   76,    0,
+        0,  115,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -878,9 +885,9 @@ static const YY_CHAR yy_ec[256] =
         5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
        40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       48,   49,   50,   51,   52,   28,   53,   54,   55,   56,
+       57,   58,   59,   60,   61,   62,   63,   64,   65,   66,
+       67,   68,   69,    5,   70,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -897,776 +904,919 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[71] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1480] =
+static const flex_int16_t yy_base[1524] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1830, 1831,   32, 1826,  141,    0,  201, 1831,  206,   88,
-       11,  213, 1831, 1808,  114,   25,    2,    6, 1831, 1831,
-       73,   11,   17, 1831, 1831, 1831,  104, 1814, 1769,    0,
-     1806,  107, 1821,  217,  247, 1831, 1765,  185, 1764, 1770,
-       93,   58, 1762,   91,  211,  195,   14,  273,  195, 1761,
-      181,  275,  207,  211,   76,   68,  188, 1770,  232,  219,
-      296,  284,  280, 1753,  204,  302,  322,  305, 1772,    0,
-      349,  357,  370,  377,  362, 1831,    0, 1831,  301,  342,
-      296,  325,  201,  346,  359,  224, 1831, 1769, 1808, 1831,
-
-      353, 1831,  390, 1797,  357, 1755, 1765,  369,  220, 1760,
-      362,  288,  364,  374,  221, 1803,    0,  441,  366, 1747,
-     1744, 1748, 1744, 1752,  360, 1748, 1737, 1738,   76, 1754,
-     1737, 1746, 1746,  365, 1737,  365, 1738, 1736,  357, 1782,
-     1786, 1728, 1779, 1721, 1744, 1741, 1741, 1735,  268, 1728,
-     1721, 1726, 1720,  371, 1731, 1724, 1715, 1714, 1728,  379,
-     1714,  384, 1730, 1707,  415,  387,  419, 1728, 1725, 1726,
-     1724,  390, 1706, 1708,  420, 1700, 1717, 1709,    0,  386,
-      439,  425,  396,  440,  453, 1708, 1831,    0, 1751,  460,
-     1698, 1701,  437,  452, 1709,  458, 1752,  466, 1751,  462,
-
-     1750, 1831,  506, 1749,  472, 1710, 1702, 1689, 1705, 1702,
-     1701, 1692,  448, 1741, 1735, 1701, 1680, 1688, 1683, 1697,
-     1693, 1681, 1693, 1693, 1684, 1668, 1672, 1685, 1687, 1684,
-     1676, 1666, 1684, 1831, 1679, 1682, 1663, 1662, 1712, 1661,
-     1671, 1674,  496, 1670, 1658, 1669, 1705, 1652, 1708, 1645,
-     1660,  489, 1650, 1666, 1647, 1646, 1652, 1643, 1642, 1649,
-     1697, 1655, 1654, 1648,   77, 1655, 1650, 1642, 1632, 1647,
-     1646, 1641, 1645, 1626, 1642, 1628, 1634, 1641, 1629,  492,
-     1622, 1636, 1677, 1638,  485, 1629,  477, 1831, 1831,  485,
-     1831, 1831, 1616,    0,  456,  473, 1618,  520,  490, 1672,
-
-     1625,  484, 1831, 1670, 1831, 1664,  548, 1831,  474, 1606,
-     1615, 1661, 1607, 1613, 1663, 1620, 1615, 1618,  479, 1831,
-     1616, 1658, 1613, 1610,  528, 1616, 1654, 1648, 1603, 1598,
-     1595, 1644, 1603, 1592, 1608, 1640, 1588,  554, 1602, 1587,
-     1600, 1587, 1597, 1592, 1599, 1594, 1590,  496, 1588, 1591,
-     1586, 1582, 1630,  488, 1624, 1831, 1623, 1575, 1574, 1573,
-     1566, 1568, 1572, 1561, 1574,  518, 1619, 1574, 1571, 1831,
-     1574, 1563, 1563, 1575,  518, 1550, 1551, 1572,  529, 1554,
-     1603, 1550, 1564, 1563, 1549, 1561, 1560, 1559, 1558,  380,
-     1599, 1598, 1831, 1542, 1541,  572, 1554, 1831, 1831, 1553,
-
-        0, 1542, 1534,  525, 1539, 1590, 1589, 1547, 1587, 1831,
-     1535, 1585, 1831,  556,  603,  542, 1584, 1528, 1539, 1535,
-     1523, 1831, 1528, 1534, 1537, 1536, 1523, 1522, 1831, 1524,
-     1521,  538, 1519, 1521, 1831, 1529, 1526, 1511, 1524, 1519,
-      578, 1526, 1514, 1507, 1556, 1831, 1505, 1521, 1553, 1516,
-     1513, 1514, 1516, 1548, 1501, 1496, 1495, 1544, 1490, 1505,
-     1483, 1490, 1495, 1543, 1831, 1490, 1486, 1484, 1493, 1487,
-     1494, 1478, 1478, 1488, 1491, 1480, 1475, 1831, 1530, 1831,
-     1474, 1485, 1470, 1475, 1484, 1478, 1472, 1481, 1521, 1515,
-     1479, 1462, 1462, 1457, 1477, 1452, 1458, 1457, 1465, 1469,
-
-     1452, 1508, 1450, 1464, 1453, 1831, 1831, 1453, 1451, 1831,
-     1462, 1496, 1458,    0, 1442, 1459, 1497, 1447, 1831, 1831,
-     1444, 1831, 1450, 1831,  551,  569,  595, 1831, 1447, 1446,
-     1434, 1485, 1432, 1483, 1430, 1429, 1436, 1429, 1441, 1440,
-     1440, 1422, 1427, 1468, 1435, 1427, 1470, 1416, 1432, 1431,
-     1831, 1416, 1413, 1469, 1426, 1418, 1424, 1415, 1423, 1408,
-     1424, 1406, 1420,  520, 1402, 1396, 1401, 1416, 1413, 1414,
-     1411, 1452, 1409, 1831, 1395, 1397, 1406, 1404, 1441, 1440,
-     1393,  562, 1402, 1385, 1386, 1383, 1831, 1397, 1376, 1395,
-     1387, 1430, 1384, 1391, 1427, 1831, 1374, 1388, 1372, 1386,
-
-     1389, 1370, 1420, 1419, 1418, 1365, 1416, 1415, 1831,   14,
-     1377, 1377, 1375, 1358, 1363, 1365, 1831, 1371, 1361, 1831,
-     1406, 1354, 1409,  568,  501, 1352, 1350, 1357, 1400,  562,
-     1404,  544, 1398, 1397, 1396, 1350, 1340, 1393, 1346, 1354,
-     1355, 1389, 1352, 1346, 1333, 1341, 1384, 1388, 1345, 1344,
-     1831, 1345, 1338, 1327, 1340, 1343, 1338, 1339, 1336, 1335,
-     1331, 1337, 1332, 1373, 1372, 1322, 1312,  552, 1369, 1831,
-     1368, 1317, 1309, 1310, 1359, 1322, 1309, 1320, 1831, 1308,
-     1317, 1316, 1316, 1356, 1299, 1308, 1313, 1290, 1294, 1345,
-     1309, 1291, 1301, 1341, 1340, 1339, 1286, 1337, 1301,  580,
-
-      582, 1278, 1288,  579, 1831, 1338, 1284, 1294, 1294, 1277,
-     1282, 1286, 1276, 1288, 1291, 1328, 1831, 1322,  578, 1284,
-       15,   20,   86,  175,  242, 1831,  274,  374,  536,  561,
-      559,  578,  575,  576,  575,  574,  589,  585,  640,  605,
-      595,  611,  601, 1831,  611,  611,  604,  615,  613,  656,
-      600,  602,  617,  604,  662,  621,  607,  610, 1831, 1831,
-      620,  625,  630,  618, 1831, 1831,  632,  619,  613,  618,
-      636,  623,  671,  624,  674,  625,  681, 1831,  628,  632,
-      627,  685,  640,  630,  631,  627,  640,  651,  635,  653,
-      648,  649,  651,  644,  646,  647,  647,  649,  664,  703,
-
-      662,  667,  644, 1831,  669,  659,  704,  664,  654,  669,
-      670,  657,  671, 1831,  690,  698,  667,  662,  715,  680,
-      684,  723,  673,  668,  680,  675,  676,  672,  681,  676,
-      732,  691,  692,  683, 1831,  685,  696,  681,  697,  692,
-      737,  706,  690,  691, 1831,  707,  710,  693,  750,  695,
-     1831,  712,  715,  695,  713,  751,  711,  707,  702,  720,
-      719,  720,  706,  721,  713,  720,  710,  728,  713, 1831,
-      721,  727,  772, 1831,  723,  728,  770,  723,  735,  729,
-      734,  732,  730,  732,  742,  785,  731,  731,  788,  734,
-      746, 1831,  734,  742,  740,  745,  757,  741,  746,  756,
-
-      757,  762,  801,  760,  776,  781,  763,  761,  757,  809,
-      754, 1831,  754,  774,  763,  768,  775,  816,  817,  766,
-     1831,  814,  763,  766,  765,  785,  782,  787,  788,  774,
-      782,  791,  771,  788,  795,  835, 1831,  836,  837,  790,
-      800,  802,  791,  787,  794,  803,  846,  795,  793,  795,
-      812,  851,  803,  802,  808,  806,  804,  857,  858,  854,
-     1831,  818,  811,  802,  821,  809,  819,  816,  821,  817,
-      830,  830, 1831,  814,  815, 1831,  816,  874,  815,  834,
-      835,  832,  818,  839,  838,  822,  827,  845, 1831,  835,
-      868,  859,  889,  831,  853, 1831,  836,  838,  855,  853,
-
-      845,  849, 1831, 1831,  859,  859,  895,  844,  897,  846,
-      904,  849,  860,  852,  858,  854,  873,  874,  875, 1831,
-     1831,  874, 1831,  859,  861,  880,  870,  863,  875,  917,
-      883, 1831,  875,  925,  868,  927, 1831,  928,  872,  878,
-      885,  927, 1831, 1831,  877,  879,  893,  898,  881,  938,
-      897,  898,  899,  937,  891,  896,  945,  895,  947, 1831,
-      896,  949,  950,  892,  952,  913,  954,  898,  910,  915,
-      901,  931,  960, 1831,  919,  912,  963,  912,  927,  914,
-      910,  926,  931,  918,  914,  972,  927,  932, 1831,  933,
-      926,  935,  936,  933,  923,  926,  926,  931,  984,  985,
-
-      930,  988,  984,  927,  942,  935,  994, 1831,  949, 1831,
-     1831,  954,  946,  956,  942,  943, 1002,  948,  958, 1006,
-     1831,  956,  956,  958,  960, 1011,  954,  957, 1831,  976,
-     1831,  960, 1831, 1831,  974, 1831,  968, 1831, 1018,  969,
-     1020, 1021, 1003, 1831, 1023,  982, 1831,  970,  978,  972,
-      971,  974,  974,  975,  982,  972, 1831,  994,  980,  981,
-      996,  996,  999,  999,  996, 1038, 1002,  995, 1831, 1831,
-     1005, 1831, 1002, 1007, 1008, 1005, 1047, 1831,  998,  999,
-      999, 1005, 1004, 1015, 1831, 1054, 1003, 1831, 1004, 1004,
-     1006, 1012, 1831, 1014, 1066, 1017, 1020, 1069, 1032, 1831,
-
-     1029, 1831, 1026, 1831, 1049, 1831, 1074, 1075, 1076, 1035,
-     1021, 1079, 1080, 1035, 1025, 1030, 1084, 1085, 1081, 1046,
-     1042, 1084, 1034, 1039, 1037, 1094, 1052, 1096, 1056, 1098,
-     1061, 1051, 1045, 1061, 1061, 1105, 1049, 1066, 1065, 1049,
-     1105, 1106, 1055, 1108, 1073, 1074, 1831, 1074, 1061, 1831,
-     1072, 1119, 1079, 1092, 1831, 1831, 1831, 1066, 1123, 1831,
-     1831, 1072, 1070, 1084, 1831, 1831, 1074, 1123, 1068, 1073,
-     1131, 1081, 1091, 1092, 1831, 1135, 1090, 1831, 1137, 1831,
-     1082, 1097, 1085, 1100, 1104, 1831, 1138, 1106, 1099, 1108,
-     1090, 1097, 1151, 1112, 1111, 1154, 1155, 1156, 1107, 1831,
-
-     1158, 1159, 1160, 1831, 1110, 1110, 1163, 1109, 1108, 1166,
-     1121, 1831, 1163, 1116, 1113, 1831, 1127, 1831, 1130, 1173,
-     1128, 1175, 1136, 1119, 1121, 1118, 1134, 1135, 1144, 1831,
-     1134, 1184, 1831, 1831, 1831, 1180, 1831, 1831, 1831, 1181,
-     1138, 1831, 1136, 1143, 1831, 1140, 1145, 1143, 1193, 1194,
-     1139, 1831, 1154, 1831, 1155, 1145, 1157, 1200, 1144, 1152,
-     1153, 1166, 1831, 1165, 1153, 1207, 1168, 1159, 1168, 1170,
-     1174, 1831, 1831, 1213, 1158, 1215, 1175, 1217, 1831, 1213,
-     1177, 1178, 1165, 1160, 1181, 1831, 1182, 1183, 1226, 1185,
-     1188, 1831, 1229, 1831, 1192, 1831, 1174, 1232, 1233, 1178,
-
-     1195, 1181, 1181, 1183, 1831, 1188, 1198, 1831, 1184, 1196,
-     1831, 1831, 1201, 1195, 1199, 1190, 1242, 1191, 1199, 1208,
-     1201, 1196, 1211, 1202, 1209, 1196, 1211, 1216, 1259, 1218,
-     1261, 1206, 1222, 1213, 1227, 1223, 1216, 1831, 1268, 1831,
-     1269, 1270, 1227, 1226, 1227, 1217, 1831, 1831, 1831, 1275,
-     1219, 1235, 1278, 1831, 1274, 1225, 1831, 1224, 1226, 1237,
-     1284, 1235, 1831, 1244, 1287, 1831, 1831, 1293, 1298, 1303,
-     1308, 1313, 1318, 1323, 1326, 1300, 1305, 1307, 1320
+       71,    0,  141,    0,  206,    0,  208,    0,  205,    0,
+      226,  276,  346,  220,  207,  233,  226,    0,    0,    0,
+        0,    0,    0,  405,  224,    0,  235,  250,  209,  209,
+      207,  174,  200,  182,    0,    0,    0,  239,  200,  447,
+      244,    0,  503,  546,  613,  378,  380,  223,  214,  396,
+      215,  222,  402,  384,  217,  494,  477,  496,  494,  474,
+      222,  519,  533,  542,  378,  385,  465,  535,  392,  553,
+      640,  641,  642,  381,  539,  539,    0,  707,    0,  777,
+        0,    0,    0,    0,    0,    0,    0,    0,  563,    0,
+      812,  384,  820,  486,  822,  492,    0,  529,  583,    0,
+
+      538,  820,  549,  814,  553,  636,  638,  567,  647,  649,
+      653,    0,    0,  878,  945,  649,  639,  640,  649,  656,
+      651,  690,  978,  724,  807,  988,  987,  804,  982,  989,
+      997,  801,  796,  790,  796,  802,  813,  801,  810,  809,
+      800,  819,  805,  825,  811,  821,  979,  969,  966,  978,
+      970,  972,  975, 1019, 1020, 1027,  972,  968,  993,  988,
+      993,  995,  987,  987,  995,  985,  992,  999,  998,  996,
+     1000, 1017, 1051, 1001, 1006, 1002, 1020,    0, 1070,    0,
+        0, 1044, 1022, 1037, 1011, 1045, 1019, 1021,    0, 1015,
+     1073, 1072, 1055, 1033, 1034, 1021, 1039, 1039, 1036, 1033,
+
+     1030, 1038, 1047, 1113,    0,    0,    0, 1088, 1048, 1095,
+     1034, 1042, 1052, 1097, 1097, 1051, 1056, 1082, 1090, 1067,
+     1096, 1116, 1093, 1080, 1119, 1087, 1086, 1094, 1085, 1093,
+     1107, 1102, 1105, 1104, 1148, 1144, 1106, 1121, 1103, 1113,
+     1124, 1123, 1127, 1127, 1116, 1122, 1114, 1110, 1132, 1130,
+     1117, 1133, 1128, 1138, 1139,    0, 1136, 1124, 1125, 1137,
+     1177, 1129, 1131, 1145, 1181, 1144, 1132, 1184, 1148, 1135,
+     1144, 1137, 1156, 1140, 1141, 1149, 1141, 1151, 1159, 1160,
+     1156, 1155, 1166, 1163, 1150, 1166, 1167, 1210, 1211, 1174,
+     1208, 1206,    0,    0,    0, 1198, 1176,    0,    0, 1162,
+
+     1220, 1180,    0, 1228, 1229, 1177, 1190, 1191, 1229, 1179,
+     1195, 1196, 1199, 1200, 1248,    0, 1192, 1199, 1200, 1195,
+     1248, 1216, 1213, 1214, 1222, 1207, 1262, 1254, 1274, 1229,
+     1249,    0, 1272, 1217,    0, 1218, 1241, 1231, 1279, 1243,
+     1246, 1251, 1256, 1295, 1240, 1248,    0, 1256, 1295, 1301,
+     1258, 1259, 1267, 1307, 1256, 1261, 1306, 1258, 1268, 1309,
+     1277, 1262, 1317, 1313, 1264, 1279, 1280, 1269, 1272, 1283,
+     1284, 1281, 1290, 1281, 1285, 1278, 1287, 1292, 1289, 1331,
+     1294, 1338, 1295, 1340, 1341, 1293, 1284, 1298, 1299, 1305,
+     1310, 1307, 1299, 1301, 1314, 1303, 1293, 1296, 1314, 1304,
+
+     1354,    0,    0, 1307, 1308, 1363, 1361,    0,    0, 1323,
+        0, 1323, 1315,    0,    0, 1327, 1320, 1321, 1344, 1322,
+     1328, 1344, 1330, 1387, 1397, 1338, 1346, 1333, 1335, 1346,
+     1345, 1348, 1391, 1347, 1341, 1390, 1357, 1409, 1410, 1370,
+     1419,    0, 1370, 1421, 1398, 1368, 1425, 1426, 1373, 1385,
+     1379, 1386, 1391, 1392, 1382,    0, 1388, 1385, 1391, 1402,
+     1393,    0, 1398, 1397, 1401,    0, 1396, 1410, 1413, 1412,
+     1456, 1412, 1411, 1422, 1424, 1458, 1410,    0, 1411, 1461,
+     1426, 1427, 1426, 1432, 1466, 1418, 1423, 1420, 1475, 1471,
+     1435, 1421, 1417, 1426, 1433, 1427, 1429, 1433,    0, 1431,
+
+     1486,    0,    0, 1445, 1437, 1434, 1447, 1486, 1452, 1437,
+     1444, 1454, 1450, 1447, 1457, 1499, 1495, 1446, 1448, 1445,
+     1456, 1455, 1455, 1467,    0, 1500, 1469, 1470, 1472, 1458,
+     1516, 1517, 1468, 1519, 1525, 1521, 1522,    0,    0, 1523,
+     1524, 1480, 1531, 1489, 1482, 1494, 1488, 1481, 1505, 1545,
+     1498,    0,    0, 1497,    0, 1504,    0, 1524, 1523, 1546,
+        0,    0, 1506, 1507, 1498, 1550, 1500, 1501, 1510, 1503,
+     1555, 1507, 1505, 1522, 1513, 1555, 1524, 1525, 1527, 1513,
+     1566, 1524, 1532,    0, 1520, 1535, 1578, 1523, 1531, 1540,
+     1540, 1541, 1536, 1531, 1532, 1549, 1548, 1549, 1536, 1536,
+
+     1532,    0, 1554, 1555, 1554, 1555, 1598, 1557, 1558, 1550,
+     1548, 1561,    0, 1548, 1551, 1550, 1546, 1553, 1567, 1568,
+     1563, 1607, 1564, 1572, 1610,    0, 1560, 1561, 1576, 1581,
+     1574, 1579, 1565, 1572, 1616,    0, 1575, 1586, 1568, 1592,
+     1593, 1625, 1600,    0, 1641, 1592, 1593, 1605, 1595, 1609,
+     1600,    0, 1647, 1594, 1618, 1615, 1620, 1613,    0, 1659,
+     1610, 1666, 1638, 1649, 1614, 1614, 1623, 1672, 1633, 1670,
+     1672, 1673, 1674, 1640, 1632, 1640, 1633, 1644, 1680, 1629,
+     1683, 1648, 1642, 1635, 1647, 1690, 1654, 1697,    0, 1656,
+     1657, 1662, 1646, 1662, 1657, 1662, 1663, 1666, 1665, 1670,
+
+     1664, 1710, 1669, 1712, 1665, 1666, 1658, 1716,    0, 1718,
+     1665, 1664, 1672, 1667, 1681, 1683, 1725, 1680, 1681, 1723,
+     1689, 1669, 1675, 1727, 1693, 1678, 1689, 1731, 1732, 1682,
+     1690, 1699, 1685, 1692,    0, 1705, 1696, 1745, 1694, 1696,
+     1697, 1711, 1698, 1700, 1706, 1708,    0, 1712, 1717, 1695,
+     1719, 1707, 1754, 1708, 1708, 1758, 1759, 1722, 1712, 1725,
+     1730, 1769,    0, 1765, 1743, 1730, 1735, 1732,    0, 1737,
+     1734, 1726, 1722, 1727, 1725, 1735, 1741, 1735, 1746, 1728,
+     1731, 1740, 1736, 1747, 1738, 1791, 1754, 1741, 1752, 1747,
+     1756,    0, 1756, 1799, 1744, 1759, 1754, 1764, 1750, 1751,
+
+     1765, 1808, 1753, 1768,    0, 1757,    0, 1766, 1775, 1764,
+     1773,    0,    0, 1758, 1766, 1780, 1766, 1766, 1821,    0,
+     1772, 1761, 1784, 1769, 1826, 1781, 1772, 1773, 1769, 1782,
+     1776, 1793, 1788, 1789, 1831, 1791, 1782, 1791, 1802,    0,
+     1841, 1788, 1788, 1800, 1845, 1792, 1797, 1806, 1793, 1801,
+     1799, 1809, 1797, 1803, 1809, 1800, 1815, 1806, 1819, 1818,
+     1818, 1806, 1819,    0, 1838, 1846, 1816, 1811, 1863, 1814,
+     1815, 1822, 1827, 1823, 1824, 1835, 1877, 1840, 1823, 1838,
+     1881, 1840, 1832, 1836, 1831,    0, 1830, 1846, 1839, 1849,
+     1844, 1888, 1854,    0, 1857, 1842, 1859, 1844, 1844, 1845,
+
+     1901,    0, 1864, 1863, 1846, 1863, 1860, 1857, 1903, 1867,
+     1870, 1855, 1864, 1858,    0, 1870, 1873, 1868, 1917,    0,
+     1869, 1873, 1915, 1869, 1880, 1877, 1876, 1874, 1870, 1873,
+     1878, 1887, 1884, 1870,    0, 1876, 1877, 1934,    0, 1879,
+     1897, 1897, 1879, 1897, 1898, 1941, 1904, 1895, 1894, 1899,
+     1893, 1896, 1900, 1898, 1894, 1913, 1952, 1911, 1927, 1933,
+     1914, 1912, 1909, 1922, 1921, 1906, 1914, 1918, 1925, 1966,
+        0, 1912, 1968, 1964,    0, 1914, 1917, 1972, 1922, 1932,
+     1937, 1920, 1939, 1940, 1927, 1935, 1943, 1926, 1939, 1948,
+     1987, 1988, 1989,    0, 1951, 1944, 1954, 1943, 1946, 1954,
+
+     1942, 1944, 1948, 2000, 2001, 2002, 1998, 2004, 1959,    0,
+     1964, 1958, 1949, 1967, 1956, 1962, 1966, 1963, 2014, 1973,
+     1972, 1968, 1960, 2019, 2020, 1971,    0, 2022, 1972, 1977,
+     1974, 2026, 2027,    0, 2029, 2031, 1976, 1982, 1977, 1987,
+     1990, 2032, 1992, 1999,    0, 1990, 2022, 2013, 2043, 1986,
+     2007, 2007, 2002, 1994, 2007, 2000, 2004,    0, 1997,    0,
+     2013, 2049, 1999,    0, 2017, 2057, 2002, 2054, 2005, 2015,
+     2008, 2025, 2027, 2028, 2018, 2014,    0, 2015,    0, 2031,
+        0, 2034, 2018, 2026, 2019, 2071, 2037, 2032, 2079, 2032,
+        0,    0,    0, 2026,    0, 2040, 2029, 2042, 2047, 2031,
+
+     2087, 2046, 2047, 2085,    0, 2051, 2092, 2037, 2052,    0,
+        0, 2057,    0, 2039, 2042, 2044,    0,    0,    0,    0,
+     2057, 2050, 2055, 2056, 2061, 2047, 2056, 2064, 2051, 2080,
+     2109,    0, 2068, 2062, 2074, 2108, 2063, 2064, 2060, 2075,
+     2118, 2068, 2064, 2121, 2084,    0, 2081, 2078, 2083, 2077,
+     2085, 2074, 2074, 2074, 2089, 2086, 2133, 2083, 2081, 2137,
+     2138, 2134, 2093, 2086, 2081,    0, 2144, 2088, 2096, 2147,
+     2094, 2104, 2151,    0, 2101, 2103, 2105, 2155, 2108,    0,
+     2157, 2158, 2110, 2111, 2162, 2116, 2110, 2110, 2112, 2127,
+     2118, 2117, 2128, 2171, 2172, 2154,    0, 2174, 2133, 2122,
+
+     2119, 2131, 2123, 2126, 2126,    0, 2128, 2134, 2124,    0,
+     2130, 2132, 2147, 2134, 2148, 2148, 2187, 2151, 2148, 2154,
+     2155,    0, 2148, 2157,    0,    0, 2154, 2159, 2156, 2198,
+     2162,    0, 2162, 2150,    0, 2202, 2152,    0, 2152, 2154,
+     2160,    0, 2174,    0,    0, 2171, 2173,    0, 2160, 2173,
+     2217, 2176, 2158, 2164, 2180, 2222,    0, 2177,    0, 2200,
+        0, 2225, 2184, 2189, 2228, 2173, 2230, 2231, 2232, 2177,
+     2182, 2189, 2236, 2237, 2233, 2198, 2194, 2187, 2243, 2193,
+     2240, 2191, 2204, 2248, 2208, 2213, 2203, 2197, 2254, 2212,
+     2251, 2198, 2253, 2203, 2255, 2220, 2216, 2263, 2264, 2265,
+
+     2228,    0, 2226, 2268, 2264, 2232,    0, 2230, 2243,    0,
+     2218, 2228,    0, 2275,    0,    0,    0, 2222, 2235, 2227,
+        0,    0, 2227, 2275, 2221, 2240, 2241, 2284,    0, 2235,
+     2230, 2287, 2242,    0, 2289, 2235, 2249, 2238,    0, 2247,
+     2244, 2257, 2240, 2297, 2260, 2259, 2253,    0,    0,    0,
+     2263, 2304,    0, 2248, 2250, 2307, 2308, 2309, 2254,    0,
+     2260, 2312, 2263, 2260, 2259, 2316, 2265, 2262,    0, 2314,
+     2274,    0, 2277,    0, 2280, 2323, 2278, 2265, 2288, 2281,
+     2282,    0, 2281, 2330, 2326, 2290,    0, 2281, 2292,    0,
+        0,    0, 2330, 2288,    0, 2332, 2287, 2293,    0, 2292,
+
+     2341, 2296, 2294, 2344, 2290,    0, 2304, 2347, 2299, 2293,
+     2301, 2313,    0, 2312, 2353, 2313, 2355, 2300, 2357, 2306,
+     2319, 2311, 2323,    0, 2321, 2321,    0, 2364, 2310,    0,
+     2324, 2362, 2326, 2314, 2309,    0, 2333,    0, 2326,    0,
+     2331, 2332, 2333, 2336, 2335, 2378,    0, 2379, 2380, 2325,
+     2382, 2328, 2344, 2329, 2337, 2333, 2333, 2335, 2348, 2341,
+        0,    0,    0, 2346,    0, 2351, 2346, 2353, 2354, 2351,
+     2343, 2394, 2351, 2345, 2353, 2348, 2362, 2405, 2406, 2356,
+     2362, 2350, 2368, 2365, 2370, 2413, 2359,    0,    0, 2374,
+     2366, 2379, 2368, 2376, 2420,    0, 2421, 2422, 2379, 2378,
+
+     2369, 2380,    0,    0,    0, 2427, 2372, 2429, 2388,    0,
+     2426,    0, 2378, 2377, 2379, 2389, 2436, 2388,    0, 2396,
+     2439,    0,    1
     } ;
 
-static const flex_int16_t yy_def[1480] =
+static const flex_int16_t yy_def[1524] =
     {   0,
-     1468, 1468, 1469, 1469, 1468, 1468, 1468, 1468, 1468, 1468,
-     1467, 1467, 1467, 1467, 1467, 1470, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1471,
-     1467, 1467, 1467, 1472,   15, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1473,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1470,
-     1467, 1467, 1467, 1467, 1467, 1467, 1474, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1471, 1467,
-
-     1472, 1467, 1467,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1475,   45, 1473,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1474, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1476,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1475, 1467, 1473,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1477,   45,   45,   45,   45,   45,   45,
-
-       45,   45, 1467,   45, 1467,   45, 1473, 1467,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1467,   45,   45,   45,   45, 1467, 1467, 1467,
-
-     1478,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-       45,   45, 1467,   45, 1473,   45,   45,   45,   45,   45,
-       45, 1467,   45,   45,   45,   45,   45,   45, 1467,   45,
-       45,   45,   45,   45, 1467,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1467,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1467,   45, 1467,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1467, 1467,   45,   45, 1467,
-       45,   45, 1467, 1479,   45,   45,   45,   45, 1467, 1467,
-       45, 1467,   45, 1467,   45,   45,   45, 1467,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1467,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1467,   45,   45,   45,
-       45,   45,   45,   45,   45, 1467,   45,   45,   45,   45,
+     1523,    1, 1523,    3,    1,    5,    5,    7,    5,    9,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523,   24,   24,   24, 1523, 1523, 1523,
+     1523,   29,   30,   31, 1523, 1523,   16, 1523, 1523, 1523,
+     1523,   12,   13,   43, 1523,   44,   44,   47,   48,   48,
+       48,   48,   47,   48,   48,   48,   43,   48,   48,   50,
+       48,   48,   47,   48,   53,   48,   48,   48,   48,   48,
+       47,   56,   47,   48,   47,   58, 1523, 1523, 1523, 1523,
+     1523,   16,   17,   24,   27,   28,   25,   27,   28,   89,
+     1523,   91, 1523,   93, 1523,   95, 1523, 1523,   40, 1523,
+
+       48,   48,  102,   48,   48,   48,   48,   48,   47,   48,
+       47,   48,   48, 1523, 1523,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,  123,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   47,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   47,   48,
+       48,   48,   48,   48,   48,  129,   48,   48,   48,   48,
+       48,   47,   47,   48,  130,   48,   48,   78, 1523, 1523,
+       80, 1523,  182, 1523,  184, 1523,  186, 1523, 1523,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+       48,   48,   48,  114,  115,  115, 1523,   48,   48,   48,
+       48,   48,   48,   48,   47,   48,   48,   48,   48,   48,
+       48,   48,   48,  215,   48,   47,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   47,   48,   48,
+       47,   48,   47,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   47,   47, 1523,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   47,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   47,   48,   48,   48,   48,   48,   48,   47,
+       48, 1523,   78, 1523, 1523, 1523,  296, 1523, 1523, 1523,
+
+       48,   48, 1523,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,  114, 1523,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48, 1523,   48,  325, 1523,   48,   48,   48,   48,   48,
+       48,   48,   47,   48,   48,   48, 1523,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       47,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   47,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       47,   48,   48,   48,   47,   48,   48,   48,   48,   48,
+
+       48, 1523, 1523,   48,   48,   48, 1523, 1523, 1523, 1523,
+     1523,   48,   48, 1523, 1523,   48,   48,   48,   47,   48,
+       48,   48,   48,   48,  114,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48, 1523,   48,   48,   48,  436,   48,   48,   48,   48,
+       48,   48,   48,   48,   48, 1523,   48,   48,   48,   48,
+       48, 1523,   48,   48,   48, 1523,   48,   48,   48,   48,
+       48,   48,   48,   47,   47,   48,   48, 1523,   48,   48,
+       48,   48,   48,   47,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48, 1523,   48,
+
+       48, 1523, 1523,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48, 1523, 1523, 1523,   69,  112,  112,
+      112,  112,  101,  112,  112,  112,  112, 1523,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  108,  112,
+      112, 1523, 1523,  112, 1523,  112, 1523,  112,  112,  550,
+     1523, 1523,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  113,  122,  120,  120,  120,  239,
+      154,  140,  197, 1523,  133,  197,  156,  135,  165,  197,
+      177,  177,  140,  133,  138,  159,  142,  142,  145,  143,
+
+      158, 1523,  142,  142,  177,  177,  156,  177,  177,  151,
+      167,  177, 1523,  157,  167,  157,  158,  163,  177,  177,
+      240,  214,  165,  177,  214, 1523,  190,  190,  177,  226,
+      199,  177,  239,  245, 1523, 1523,  217,  177,  211,  190,
+      199,  214,  203, 1523,  192,  200,  200,  197,  217,  197,
+      245, 1523,  214,  387,  232,  209,  232,  227, 1523,  214,
+      247,  222,  216,  221,  247,  216,  240,  222,  233,  236,
+      236,  236,  236,  233,  230,  232,  227,  233,  236,  520,
+      236,  242,  240,  239,  246,  236,  234,  235, 1523,  250,
+      250,  238,  247,  264,  246,  250,  250,  264,  250,  254,
+
+      359,  288,  250,  288,  271,  271,  277,  288, 1523,  288,
+      262,  267,  386,  274,  269,  279,  288,  281,  281,  268,
+      337,  336,  270,  309,  337,  272,  281,  309,  309,  310,
+      386,  279,  310,  346,   78,  283,  356,  288,  355,  317,
+      317,  290,  355,  317,  330,  359, 1523,  307,  361,  336,
+      307,  317,  309,  355,  326,  321,  321,  348,  326,  314,
+      361,  329, 1523,  321,  365,  340,  361,  340, 1523,  361,
+      340,  338,  421,  355,  365,  330,  366,  356,  361,  345,
+      365,  539,  355,  340,  355,  344,  361,  355,  370,  356,
+      453, 1523,  366,  350,  421,  370,  356,  539,  365,  365,
+
+      370,  382,  421,  370, 1523,  362, 1523,  372,  373,  394,
+      370, 1523, 1523,  520,  393,  373,  539,  400,  382, 1523,
+      394,  493,  453,  421,  382,  377,  421,  421,  397,  386,
+      421,  453,  388,  388,  401,  388,  421,  431,  391, 1523,
+      424,  400,  467,  452,  424,  400,  426,  412,  421,  539,
+      539,  427,  421,  413,  416,  421,  468,  539,  426,  468,
+      427,  421,  452, 1523,  539,  468,  426,  429,  433,  429,
+      458,  434,  432,  437,  437,  440,  438,  474,  458,  468,
+      441,  468,  455,  463,  449, 1523,  458,  481,  451,  468,
+      463,  476,  453, 1523,  474,  477,  474,  477,  467,  467,
+
+      467, 1523,  474,  469,  520,  468,  472,  487,  476,  470,
+      509,  510,  473,  496, 1523,  539,  491,  495,  489, 1523,
+      539,  513,  485,  539,  491,  513,  495,  498,  510,  494,
+      511,  491,  513,  539, 1523,  510,  510,  501, 1523,  510,
+      539,  509,  539,  504,  528,  516,  539,  521,  511,  513,
+      539,  523,  521,  523,  530,  539,  539,  528,  519,  522,
+      529,  539,  539,  539,  539,  530,  539,  539,  539,  539,
+     1523,  539,  539,  536, 1523,  539,  539,  550,  545,  577,
+      596,  548,  596,  596,  637,  701,  549,  680,  563,  596,
+      587,  577,  560, 1523,  798,  782,  596,  646,  589,  577,
+
+      599,  572,  575,  587,  587,  587,  581,  587,  631, 1523,
+      577,  589,  654,  591,  585,  589,  631,  646,  587,  591,
+      844,  589,  680,  607,  607,  646, 1523,  607,  610,  782,
+      610,  607,  607, 1523,  607,  607,  614,  610,  633,  621,
+      631,  622,  631,  643, 1523,  646,  612,  614,  645,  680,
+      630,  798,  701,  711,  624,  646,  782, 1523,  661, 1523,
+      643,  642,  628, 1523,  798,  645,  666,  642,  661,  656,
+      711,  692,  692,  692,  675,  711, 1523,  661, 1523,  678,
+     1523,  692,  661,  667,  666,  653,  678,  656,  662,  667,
+     1523, 1523, 1523,  661, 1523,  657,  711,  676,  692,  665,
+
+      668,  676,  676,  670, 1523,  678,  668,  712,  676, 1523,
+     1523,  692, 1523,  684,  693,  711, 1523, 1523, 1523, 1523,
+      676,  677,  685,  685,  687,  684,  713,  687,  712,  693,
+      688, 1523,  687,  713,  692,  720,  740,  740,  712,  696,
+      696,  740,  712,  702,  700, 1523,  703,  718,  703,  713,
+      715,  711,  714,  712,  715,  718,  717,  740,  714,  717,
+      717,  720,  723,  723,  822, 1523,  738,  780,  734,  738,
+      755,  727,  738, 1523,  740,  734,  731,  738,  737, 1523,
+      738,  738,  830,  810,  738,  782,  755,  775,  755,  791,
+      810,  754,  748,  753,  762,  760, 1523,  762,  760,  775,
+
+      943,  778,  780,  775,  773, 1523,  775,  810,  829, 1523,
+      773,  775,  777,  775,  766,  852,  835,  771,  776,  777,
+      784, 1523,  810,  784, 1523, 1523,  776,  784,  808,  835,
+      784, 1523,  852,  795, 1523,  835,  795, 1523, 1039,  795,
+      815, 1523,  809, 1523, 1523,  789,  793, 1523,  799,  852,
+      802,  796,  829,  803,  876,  802, 1523,  808, 1523,  810,
+     1523,  802,  804,  809,  819,  824,  819,  819,  819,  824,
+      851,  826,  819,  819,  835,  876,  826,  842,  825,  854,
+      835,  843,  852,  841,  876,  839,  850,  837,  841,  852,
+      869,  943,  869,  849,  869,  876,  855,  845,  845,  877,
+
+      878, 1523,  876,  877,  869,  878, 1523,  876,  853, 1523,
+      899,  855, 1523,  877, 1523, 1523, 1523,  885,  860,  874,
+     1523, 1523,  924,  869, 1022,  880,  880,  877, 1523,  867,
+      868,  877,  873, 1523,  877,  899,  880,  885, 1523,  907,
+      889,  878,  879,  881,  893,  882,  921, 1523, 1523, 1523,
+      893,  919, 1523, 1039,  887,  919,  919,  919,  912, 1523,
+      928,  919,  908,  896,  912,  919,  924,  912, 1523,  909,
+      907, 1523,  916, 1523,  906,  919,  907, 1022,  947,  922,
+      922, 1523,  913,  919,  923,  917, 1523,  924,  925, 1523,
+     1523, 1523,  923,  927, 1523,  923,  928,  926, 1523,  927,
+
+      938,  933,  967,  938,  972, 1523,  932,  938,  967,  936,
+      967,  947, 1523,  942,  946,  961,  946,  955,  946,  985,
+      965,  967,  956, 1523,  961,  958, 1523,  957,  972, 1523,
+      958,  974,  958,  972, 1209, 1523,  964, 1523,  962, 1523,
+      980,  980,  980,  965,  980,  970, 1523,  970,  970,  976,
+      970,  972, 1044,  976,  999,  977, 1001, 1002,  980,  998,
+     1523, 1523, 1523,  989, 1523, 1000, 1040, 1000, 1000,  989,
+     1001, 1007,  999, 1037,  999, 1001, 1000, 1004, 1004, 1003,
+     1009, 1013, 1000, 1009, 1011, 1004, 1059, 1523, 1523, 1213,
+     1018, 1051, 1018, 1216, 1019, 1523, 1019, 1019, 1021, 1017,
+
+     1037, 1017, 1523, 1523, 1523, 1019, 1037, 1024, 1055, 1523,
+     1042, 1523, 1054, 1037, 1059, 1041, 1028, 1075, 1523, 1055,
+     1032, 1523,    0
+    } ;
 
-       45,   45,   45,   45,   45,   45,   45,   45, 1467,   45,
-       45,   45,   45,   45,   45,   45, 1467,   45,   45, 1467,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1467,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-       45,   45,   45,   45,   45,   45,   45,   45, 1467,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+static const flex_int16_t yy_nxt[2510] =
+    {   0,
+       11, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523,   35,   16,   17,   16,   35,   13,   12,   35,   25,
+       22,   24,   27,   14,   26,   26,   26,   23,   15,   35,
+       35,   35,   35,   35,   35,   28,   33,   35,   35,   35,
+
+       34,   35,   35,   35,   35,   32,   35,   35,   35,   35,
+       18,   35,   19,   35,   35,   35,   35,   35,   28,   30,
+       35,   35,   35,   35,   35,   35,   31,   35,   35,   35,
+       35,   35,   29,   35,   35,   35,   35,   35,   35,   20,
+       21,   36,   37,   17,   37,   36,   36,   36,   38,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   35,   35,   40,   35,   35,   35,   35,   35,   35,
+       35,   35,   35,   35,   41, 1523,   81,   79,   83,   94,
+       35,   35,   80,   91,   82,   35,   82,   87,   87,   87,
+       35,   91,   95,   94,   95,   35, 1523,   35,   88,   88,
+       88,   97,   93,   35,   35,   98,   35,   39,   89,   35,
+       89,   35,  100,   90,   90,   90,   48,   35,   92,   96,
+      122,  124,  125,  128,   35,   35,   42,   42,  136,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   78,   78,   78,   48,
+       48,   77,   48,   48,   48,   48,   48,   48,   48,   48,
+       49,   48,   48,   48,   48,   48,   50,   48,   51,   52,
+       48,   53,   48,   54,   55,   56,   48,   48,   48,   48,
+       57,   58,   48,   59,   48,   48,   45,   48,   48,   60,
+       61,   62,   63,   64,   65,   66,   67,   68,   69,   70,
+
+       71,   72,   46,   73,   74,   75,   44,   43,   76,   47,
+       59,   48,   48,   48,   48,   48,   85,  127,   84,   84,
+       84,   48,  126,  121,  123,   48,  116,   48,   48,   86,
+       48,  150,  152,  119,   48,  117,   48,   48,  151,  158,
+      118,  120,   48,  172,  127,  126,  183,   99,   99,  123,
+       99,   99,   86,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+
+       99,   99,   99,   99,   99,   99,   99,   99,   99,   99,
+       99,   99,   99,   99,   99,   99,   99,   48,  129,  130,
+      131,  153,  103,   48,   48,  103,   48,  132,   48,  154,
+       48,   48,   48,  133,  134,  104,  135,   48,   48,  185,
+       48,  129,  130,   48,  131,  187,   48,   48,  102,   48,
+      101,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,  104,   48,   48,   48,   48,   48,   48,  105,
+      138, 1523,  139, 1523,  188,  137,  143,  140,   48,  141,
+      144,  156,  174,  142,  145,  175,  173,  148,  189,  107,
+      157,   48,  155,  106,  176,  146,  109,  147,  190,  177,
+
+      159,  161,  110,  111,  162,   48,  192,  149,  108,  160,
+      194,  200,   48,  115,  115,  115,  115,  115,  112,  115,
+      115,  115,  115,  115,  115,  113,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  113,  115,  115,  115,  113,  115,  115,
+      115,  113,  115,  115,  115,  115,  115,  115,  113,  115,
+      115,  115,  113,  115,  113,  114,  115,  115,  115,  115,
+      115,  115,  115,  164,  168,  170,  167,  165,  166,  171,
+      201,  197,  198,  199,  202,  196,  203,  208,  169,  195,
+
+      209,  210,  211,  212,  213,  214,  163,  178,  178,  178,
+      178,  178,  180,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  179,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  178,  178,  178,
+      178,  178,  178,  178,  178,  178,  178,  181,  181,  216,
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+      181,  181,  181,  181,  181,  181,  181,  181,  181,  181,
+      181,  181,  181,  181,  181,  181,  181,  182,  185,  193,
+      186,  192,  217,  220,  225,  226,  227,  228,  229,  232,
+      233,  234,  235,  236,  237,  224,  238,  230,  231,  239,
+      240,  241,  242,  184,  182,  186,  193,  191,  205,  205,
+      205,  205,  205,  205,  205,  205,  205,  205,  205,  205,
+      205,  204,  204,  204,  205,  205,  205,  205,  204,  204,
+
+      204,  204,  204,  204,  205,  205,  205,  205,  205,  205,
+      205,  205,  205,  205,  205,  205,  205,  205,  205,  205,
+      205,  204,  204,  204,  204,  204,  204,  205,  205,  205,
+      205,  205,  205,  205,  205,  205,  205,  205,  205,  205,
+      205,  205,  205,  205,  205,  205,  205,  205,  206,  206,
+      207,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+
+      206,  206,  206,  206,  206,  206,  206,  206,  206,  206,
+      206,  206,  206,  206,  206,  215,  218,  219,  221,  245,
+      222,  223,  244,  246,  243,  248,  249,  250,  252,  254,
+      255,  253,  256,  257,  258,  251,  259,  260,  261,  262,
+      247,  218,  215,  219,  223,  221,  222,  263,  264,  266,
+      267,  268,  265,  269,  271,  273,  274,  272,  270,  275,
+      276,  279,  287,  289,  277,  288,  290,  291,  294,  295,
+      297,  297,  299,  298,  300,  293,  301,  303,  303,  304,
+      305,  306,  293,  302,  307,  308,  309,  310,  311,  312,
+      313,  294,  314,  316,  280,  281,  282,  296,  298,  317,
+
+      321,  322,  304,  323,  283,  318,  284,  324,  278,  285,
+      293,  286,  326,  327,  293,  328,  330,  325,  293,  329,
+      331,  332,  333,  334,  335,  293,  315,  315,  315,  293,
+      336,  293,  292,  315,  315,  315,  315,  315,  315,  319,
+      325,  337,  328,  331,  338,  329,  339,  340,  333,  344,
+      345,  346,  320,  347,  348,  341,  315,  315,  315,  315,
+      315,  315,  342,  349,  350,  351,  352,  353,  343,  354,
+      355,  356,  357,  358,  359,  360,  361,  362,  363,  364,
+      365,  366,  367,  368,  369,  370,  371,  372,  373,  374,
+      375,  376,  379,  380,  381,  382,  383,  384,  385,  386,
+
+      387,  388,  389,  390,  391,  392,  393,  394,  395,  397,
+      398,  396,  399,  400,  401,  402,  403,  404,  405,  407,
+      407,  407,  409,  409,  410,  411,  407,  407,  407,  407,
+      407,  407,  412,  414,  415,  413,  416,  417,  418,  419,
+      420,  377,  421,  422,  378,  408,  423,  424,  426,  407,
+      407,  407,  407,  407,  407,  427,  428,  429,  430,  433,
+      436,  425,  425,  425,  431,  434,  437,  406,  425,  425,
+      425,  425,  425,  425,  435,  432,  438,  439,  441,  442,
+      443,  444,  445,  446,  447,  440,  448,  449,  436,  450,
+      451,  425,  425,  425,  425,  425,  425,  452,  453,  454,
+
+      456,  441,  457,  458,  459,  460,  462,  463,  444,  461,
+      464,  465,  466,  467,  468,  455,  469,  470,  471,  472,
+      473,  474,  478,  479,  480,  481,  482,  477,  483,  484,
+      485,  486,  487,  488,  489,  490,  492,  491,  493,  494,
+      495,  496,  498,  499,  500,  502,  503,  504,  505,  506,
+      507,  497,  508,  509,  510,  511,  512,  513,  514,  516,
+      517,  518,  515,  520,  521,  519,  522,  523,  525,  527,
+      528,  529,  475,  524,  526,  526,  526,  476,  530,  531,
+      532,  526,  526,  526,  526,  526,  526,  533,  534,  535,
+      536,  537,  538,  540,  541,  542,  543,  544,  545,  546,
+
+      501,  547,  548,  549,  526,  526,  526,  526,  526,  526,
+      539,  539,  539,  551,  552,  553,  554,  539,  539,  539,
+      539,  539,  539,  550,  555,  556,  557,  558,  560,  559,
+      561,  562,  563,  564,  565,  566,  567,  568,  569,  570,
+      539,  539,  539,  539,  539,  539,  571,  572,  574,  576,
+      550,  577,  578,  558,  579,  559,  580,  581,  582,  583,
+      573,  584,  575,  586,  587,  588,  585,  589,  590,  591,
+      592,  593,  594,  595,  596,  597,  598,  599,  600,  601,
+      602,  603,  604,  605,  606,  607,  608,  609,  610,  611,
+      612,  613,  614,  615,  616,  617,  618,  619,  620,  621,
+
+      622,  623,  624,  625,  626,  627,  628,  629,  630,  631,
+      632,  633,  634,  635,  635,  635,  636,  637,  638,  639,
+      635,  635,  635,  635,  635,  635,  640,  641,  642,  643,
+      644,  646,  647,  648,  649,  650,  652,  653,  654,  645,
+      655,  656,  657,  635,  635,  635,  635,  635,  635,  658,
+      659,  660,  661,  662,  663,  664,  665,  666,  667,  668,
+      669,  670,  671,  672,  673,  674,  675,  676,  677,  678,
+      679,  680,  681,  651,  682,  683,  684,  685,  686,  687,
+      663,  688,  664,  689,  690,  691,  692,  693,  694,  695,
+      696,  697,  698,  699,  701,  700,  702,  703,  704,  705,
+
+      706,  707,  708,  709,  710,  711,  712,  713,  714,  715,
+      716,  717,  718,  719,  720,  721,  722,  723,  724,  725,
+      726,  727,  728,  729,  730,  731,  732,  733,  734,  735,
+      735,  735,  736,  737,  738,  745,  735,  735,  735,  735,
+      735,  735,  741,  739,  743,  746,  747,  748,  749,  740,
+      744,  751,  752,  742,  750,  753,  754,  755,  756,  735,
+      735,  735,  735,  735,  735,  757,  758,  759,  760,  761,
+      762,  763,  764,  765,  766,  767,  768,  769,  772,  770,
+      773,  771,  774,  775,  776,  778,  779,  780,  781,  782,
+      783,  777,  784,  785,  786,  787,  765,  788,  789,  764,
+
+      790,  791,  792,  793,  794,  795,  796,  797,  798,  799,
+      800,  801,  802,  803,  804,  805,  806,  807,  808,  809,
+      811,  812,  810,  813,  814,  815,  816,  817,  818,  819,
+      820,  821,  822,  823,  824,  825,  826,  827,  828,  829,
+      830,  831,  832,  833,  834,  835,  836,  837,  838,  839,
+      840,  841,  842,  843,  844,  845,  846,  847,  848,  849,
+      850,  851,  853,  854,  855,  856,  852,  857,  858,  859,
+      860,  861,  862,  863,  864,  865,  866,  867,  868,  869,
+      870,  871,  872,  873,  874,  875,  876,  877,  878,  879,
+      880,  881,  882,  883,  884,  885,  886,  887,  888,  889,
+
+      890,  891,  892,  866,  894,  895,  896,  897,  898,  893,
+      899,  900,  901,  902,  903,  904,  905,  906,  907,  908,
+      909,  910,  911,  912,  913,  914,  915,  916,  917,  918,
+      919,  920,  921,  922,  923,  924,  925,  926,  927,  928,
+      929,  930,  931,  932,  933,  934,  935,  936,  937,  938,
+      939,  940,  941,  942,  943,  944,  945,  946,  947,  948,
+      949,  950,  951,  952,  953,  955,  956,  957,  958,  959,
+      960,  961,  962,  963,  954,  964,  965,  966,  967,  968,
+      969,  970,  971,  972,  973,  974,  975,  976,  977,  978,
+      979,  980,  981,  960,  982,  959,  983,  984,  985,  986,
+
+      987,  988,  989,  990,  991,  992,  994,  995,  996,  997,
+      998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+     1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017,
+     1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
+     1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037,
+     1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+     1049,  993, 1048, 1050, 1051, 1052, 1053, 1054, 1055, 1056,
+     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
+     1067, 1068, 1069, 1070, 1071, 1072, 1047, 1073, 1048, 1074,
+     1075, 1076, 1077, 1079, 1081, 1082, 1083, 1084, 1085, 1080,
+
+     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+     1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+     1106, 1107,   48, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
+     1116, 1117, 1118, 1108, 1119, 1078, 1120, 1121, 1122, 1123,
+     1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
+     1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
+     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1130,
+     1153, 1154, 1155, 1156, 1131, 1157, 1158, 1159, 1160, 1161,
+     1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171,
+     1172, 1173, 1174, 1175, 1176, 1177, 1179, 1180, 1181, 1182,
+
+     1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192,
+     1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202,
+     1203, 1204, 1205, 1206, 1208, 1209, 1210, 1211, 1212, 1213,
+     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+     1196, 1224, 1225, 1226, 1227, 1178, 1228, 1230, 1231, 1232,
+     1233, 1234, 1235, 1236, 1229, 1237, 1238, 1239, 1240, 1241,
+     1242, 1243, 1244, 1245, 1246, 1207, 1247, 1248, 1249, 1250,
+     1251, 1252, 1253, 1254, 1255, 1256, 1257, 1259, 1260, 1261,
+     1262, 1258, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270,
+     1271, 1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280,
+
+     1281, 1260, 1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289,
+     1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
+     1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309,
+     1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319,
+     1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1329, 1330,
+     1331, 1332, 1333, 1334, 1335, 1309, 1336, 1337, 1338, 1339,
+     1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349,
+     1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+     1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369,
+     1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379,
+
+     1380, 1381, 1382, 1328, 1357, 1383, 1384, 1385, 1386, 1387,
+     1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
+     1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407,
+     1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417,
+     1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427,
+     1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437,
+     1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447,
+     1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457,
+     1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467,
+     1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+
+     1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+     1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
+     1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507,
+     1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517,
+     1518, 1519, 1520, 1521, 1522,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-       45,   45,   45,   45, 1467,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1467,   45,   45,   45,
-       45,   45,   45,   45,   45, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1467, 1467,
-       45,   45,   45,   45, 1467, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1467,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+        0,    0,    0,    0,    0,    0,    0,    0,    0
+    } ;
 
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1467,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1467,   45,   45,   45,   45,   45,
-     1467,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1467,   45,   45,   45,   45,   45,   45,   45,   45,
+static const flex_int16_t yy_chk[2510] =
+    {   0,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523, 1523,
+     1523,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1467,   45,   45,   45,   45,   45,   45,   45,   45,
-     1467,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1467,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1467,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1467,   45,   45, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1467,   45,
-       45,   45,   45,   45,   45, 1467,   45,   45,   45,   45,
-
-       45,   45, 1467, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-     1467,   45, 1467,   45,   45,   45,   45,   45,   45,   45,
-       45, 1467,   45,   45,   45,   45, 1467,   45,   45,   45,
-       45,   45, 1467, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1467,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
 
-       45,   45,   45,   45,   45,   45,   45, 1467,   45, 1467,
-     1467,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1467,   45,   45,   45,   45,   45,   45,   45, 1467,   45,
-     1467,   45, 1467, 1467,   45, 1467,   45, 1467,   45,   45,
-       45,   45,   45, 1467,   45,   45, 1467,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1467,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1467, 1467,
-       45, 1467,   45,   45,   45,   45,   45, 1467,   45,   45,
-       45,   45,   45,   45, 1467,   45,   45, 1467,   45,   45,
-       45,   45, 1467,   45,   45,   45,   45,   45,   45, 1467,
-
-       45, 1467,   45, 1467,   45, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    5,    5,    7,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    9,   11,   15,   14,   17,   30,
+        5,    5,   14,   32,   16,    5,   16,   25,   25,   25,
+        5,   29,   31,   33,   34,    5,   27,    5,   27,   27,
+       27,   38,   30,    5,    5,   39,    9,    5,   28,    7,
+       28,    5,   41,   28,   28,   28,   48,    5,   29,   31,
+       49,   51,   52,   55,    5,    5,   12,   12,   61,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   24,   54,   24,   24,
+       24,   46,   53,   47,   50,   46,   46,   47,   46,   24,
+       47,   65,   66,   46,   46,   46,   47,   47,   66,   69,
+       46,   46,   47,   74,   54,   53,   92,   40,   40,   50,
+       40,   40,   24,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   43,   56,   58,
+       59,   67,   57,   43,   57,   43,   43,   60,   43,   67,
+       43,   43,   43,   60,   60,   43,   60,   43,   43,   94,
+       43,   56,   58,   57,   59,   96,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   44,   43,
+       62,   89,   62,   89,   98,   62,   63,   62,   44,   62,
+       63,   68,   75,   63,   63,   76,   75,   64,   99,   44,
+       68,   44,   68,   44,   76,   63,   44,   64,  101,   76,
+
+       70,   70,   44,   44,   70,   44,  103,   64,   44,   70,
+      105,  108,   44,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1467,   45,   45, 1467,
-       45,   45,   45,   45, 1467, 1467, 1467,   45,   45, 1467,
-     1467,   45,   45,   45, 1467, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45, 1467,   45,   45, 1467,   45, 1467,
-       45,   45,   45,   45,   45, 1467,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-
-       45,   45,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45, 1467,   45,   45,   45, 1467,   45, 1467,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1467,
-       45,   45, 1467, 1467, 1467,   45, 1467, 1467, 1467,   45,
-       45, 1467,   45,   45, 1467,   45,   45,   45,   45,   45,
-       45, 1467,   45, 1467,   45,   45,   45,   45,   45,   45,
-       45,   45, 1467,   45,   45,   45,   45,   45,   45,   45,
-       45, 1467, 1467,   45,   45,   45,   45,   45, 1467,   45,
-       45,   45,   45,   45,   45, 1467,   45,   45,   45,   45,
-       45, 1467,   45, 1467,   45, 1467,   45,   45,   45,   45,
-
-       45,   45,   45,   45, 1467,   45,   45, 1467,   45,   45,
-     1467, 1467,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1467,   45, 1467,
-       45,   45,   45,   45,   45,   45, 1467, 1467, 1467,   45,
-       45,   45,   45, 1467,   45,   45, 1467,   45,   45,   45,
-       45,   45, 1467,   45,   45, 1467,    0, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467
-    } ;
-
-static const flex_int16_t yy_nxt[1903] =
-    {   0,
-     1467,   13,   14,   13, 1467,   15,   16, 1467,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   86,  705,
-       37,   14,   37,   87,   25,   26,   38, 1467,  706,   27,
-       37,   14,   37,   42,   28,   42,   38,   92,   93,   29,
-      115,   30,   13,   14,   13,   91,   92,   25,   31,   93,
-       13,   14,   13,   13,   14,   13,   32,   40,  818,   13,
-       14,   13,   33,   40,  115,   92,   93,  819,   91,   34,
-       35,   13,   14,   13,   95,   15,   16,   96,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  109,   39,   91,   25,   26,   13,   14,   13,   27,
-
-       39,   85,   85,   85,   28,   42,   41,   42,   42,   29,
-       42,   30,   83,  108,   41,  111,   94,   25,   31,  109,
-      217,  218,   89,  137,   89,  139,   32,   90,   90,   90,
-      138,  374,   33,  140,  375,   83,  108,  820,  111,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   47,   45,   45,   45,   45,
-       45,   48,   45,   49,   50,   45,   51,   45,   52,   53,
-       54,   45,   45,   45,   45,   55,   56,   45,   57,   45,
-       45,   58,   45,   45,   59,   60,   61,   62,   63,   64,
-       65,   66,   67,   52,   68,   69,   70,   71,   72,   73,
-
-       74,   75,   76,   77,   78,   79,   57,   45,   45,   45,
-       45,   45,   81,  105,   82,   82,   82,   81,  114,   84,
-       84,   84,  102,  105,   81,   83,   84,   84,   84,  821,
-       83,  108,  123,  112,  141,  124,  182,   83,  125,  105,
-      126,  114,  127,  113,  142,  200,  143,  164,   83,  119,
-      194,  165,  133,   83,  108,  120,  112,  103,  121,  182,
-       83,   45,  149,  134,  182,  136,  150,   45,  200,   45,
-       45,  113,   45,  135,   45,   45,   45,  194,  117,  145,
-      146,   45,   45,  147,   45,   45,  151,  185,  822,  148,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   90,   90,   90,   45,  128,  197,
-      111,   45,  129,  160,  180,  130,  131,  161,  114,   45,
-      242,  823,  155,   45,  243,   45,  118,  162,  132,  152,
-      156,  153,  157,  154,  112,  166,  197,  158,  159,  167,
-      180,  175,  168,  181,  113,   90,   90,   90,  102,  169,
-      170,  176,   85,   85,   85,  171,  177,  172,   81,  173,
-       82,   82,   82,   83,  180,   85,   85,   85,   89,  181,
-       89,   83,  113,   90,   90,   90,   83,  181,   81,  174,
-       84,   84,   84,  103,  190,  101,   83,  193,  196,  198,
-
-      183,   83,  101,  190,   83,  199,  211,  196,  223,   83,
-      224,  230,  226,  184,  231,  212,  213,  824,  232,  287,
-      204,  197,  190,  193,   83,  262,  196,  198,  227,  287,
-      101,  205,  199,  504,  101,  196,  505,  248,  101,  254,
-      255,  257,  271,  272,  258,  259,  101,  287,  280,  289,
-      101,  199,  101,  188,  203,  203,  203,  290,  263,  264,
-      265,  203,  203,  203,  203,  203,  203,  288,  288,  266,
-      299,  267,  289,  268,  269,  273,  270,  289,  283,  274,
-      296,  300,  302,  275,  203,  203,  203,  203,  203,  203,
-      304,  306,  296,  288,  291,  395,  317,  303,  299,  359,
-
-      292,  398,  390,  296,  318,  302,  348,  402,  300,  398,
-      319,  404,  404,  304,  409,  309,  412,  403,  306,  307,
-      307,  307,  426,  478,  398,  719,  307,  307,  307,  307,
-      307,  307,  399,  360,  406,  407,  466,  409,  432,  427,
-      404,  416,  433,  408,  412,  396,  467,  361,  719,  307,
-      307,  307,  307,  307,  307,  459,  460,  349,  517,  446,
-      350,  415,  415,  415,  447,  661,  662,  679,  415,  415,
-      415,  415,  415,  415,  487,  517,  492,  510,  488,  479,
-      493,  624,  511,  551,  541,  525,  517,  526,  552,  727,
-      728,  415,  415,  415,  415,  415,  415,  542,  825,  543,
-
-      620,  625,  718,  527,  680,  626,  763,  724,  624,  764,
-      448,  816,  525,  725,  526,  449,   45,   45,   45,  826,
-      827,  828,  829,   45,   45,   45,   45,   45,   45,  625,
-      718,  794,  796,  797,  830,  802,  831,  832,  795,  816,
-      798,  803,  833,  834,  799,  835,   45,   45,   45,   45,
-       45,   45,  836,  837,  838,  839,  840,  841,  842,  843,
-      844,  845,  847,  848,  849,  850,  846,  851,  852,  853,
-      854,  855,  856,  857,  858,  859,  860,  861,  862,  863,
-      865,  866,  867,  864,  868,  869,  870,  871,  872,  873,
-      874,  875,  876,  877,  878,  879,  880,  881,  882,  883,
-
-      884,  885,  886,  887,  888,  889,  890,  891,  892,  893,
-      894,  895,  896,  897,  898,  899,  900,  901,  902,  903,
-      904,  905,  906,  907,  908,  909,  910,  911,  912,  913,
-      914,  915,  916,  917,  918,  919,  920,  921,  922,  923,
-      924,  925,  926,  927,  928,  906,  929,  930,  905,  931,
-      932,  933,  934,  935,  936,  937,  939,  940,  941,  942,
-      943,  944,  945,  946,  947,  948,  949,  950,  951,  952,
-      953,  954,  955,  956,  958,  959,  960,  961,  962,  963,
-      964,  965,  966,  967,  957,  968,  969,  970,  971,  972,
-      973,  974,  975,  976,  977,  978,  979,  980,  981,  982,
-
-      983,  984,  985,  986,  987,  988,  989,  990,  991,  993,
-      992,  938,  994,  995,  996,  997,  998,  999, 1000, 1001,
-     1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011,
-     1012, 1013, 1014, 1015, 1016, 1017,  991,  992, 1018, 1019,
-     1020, 1021, 1023, 1025, 1026, 1027, 1022, 1028, 1029, 1030,
-     1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
-     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050,
-     1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060,
-     1061, 1062, 1063, 1064, 1024, 1065, 1066, 1067, 1068, 1069,
-     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079,
-
-     1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089,
-     1090, 1091, 1092, 1093, 1094, 1072, 1095, 1096, 1097, 1098,
-     1099, 1073, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
-     1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
-     1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1127, 1128,
-     1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138,
-     1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1149,
-     1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159,
-     1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169,
-     1170, 1171, 1143, 1172, 1173, 1174, 1175, 1177, 1126, 1178,
-
-     1179, 1180, 1181, 1182, 1176, 1183, 1184, 1185, 1186, 1187,
-     1148, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
-     1197, 1198, 1199, 1200, 1201, 1202, 1204, 1205, 1206, 1207,
-     1203, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216,
-     1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226,
-     1205, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235,
-     1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
-     1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
-     1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265,
-     1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
-
-     1277, 1278, 1279, 1280, 1281, 1254, 1282, 1283, 1284, 1285,
-     1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
-     1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,
-     1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315,
-     1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325,
-     1326, 1327, 1328, 1329, 1302, 1276, 1330, 1331, 1332, 1333,
-     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
-     1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
-     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
-     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
-
-     1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
-     1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
-     1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
-     1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
-     1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
-     1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433,
-     1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443,
-     1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453,
-     1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463,
-     1464, 1465, 1466,   12,   12,   12,   12,   12,   36,   36,
-
-       36,   36,   36,   80,  294,   80,   80,   80,   99,  401,
-       99,  514,   99,  101,  101,  101,  101,  101,  116,  116,
-      116,  116,  116,  179,  101,  179,  179,  179,  201,  201,
-      201,  817,  815,  814,  813,  812,  811,  810,  809,  808,
-      807,  806,  805,  804,  801,  800,  793,  792,  791,  790,
-      789,  788,  787,  786,  785,  784,  783,  782,  781,  780,
-      779,  778,  777,  776,  775,  774,  773,  772,  771,  770,
-      769,  768,  767,  766,  765,  762,  761,  760,  759,  758,
-      757,  756,  755,  754,  753,  752,  751,  750,  749,  748,
-      747,  746,  745,  744,  743,  742,  741,  740,  739,  738,
-
-      737,  736,  735,  734,  733,  732,  731,  730,  729,  726,
-      723,  722,  721,  720,  717,  716,  715,  714,  713,  712,
-      711,  710,  709,  708,  707,  704,  703,  702,  701,  700,
-      699,  698,  697,  696,  695,  694,  693,  692,  691,  690,
-      689,  688,  687,  686,  685,  684,  683,  682,  681,  678,
-      677,  676,  675,  674,  673,  672,  671,  670,  669,  668,
-      667,  666,  665,  664,  663,  660,  659,  658,  657,  656,
-      655,  654,  653,  652,  651,  650,  649,  648,  647,  646,
-      645,  644,  643,  642,  641,  640,  639,  638,  637,  636,
-      635,  634,  633,  632,  631,  630,  629,  628,  627,  623,
-
-      622,  621,  620,  619,  618,  617,  616,  615,  614,  613,
-      612,  611,  610,  609,  608,  607,  606,  605,  604,  603,
-      602,  601,  600,  599,  598,  597,  596,  595,  594,  593,
-      592,  591,  590,  589,  588,  587,  586,  585,  584,  583,
-      582,  581,  580,  579,  578,  577,  576,  575,  574,  573,
-      572,  571,  570,  569,  568,  567,  566,  565,  564,  563,
-      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-      550,  549,  548,  547,  546,  545,  544,  540,  539,  538,
-      537,  536,  535,  534,  533,  532,  531,  530,  529,  528,
-      524,  523,  522,  521,  520,  519,  518,  516,  515,  513,
-
-      512,  509,  508,  507,  506,  503,  502,  501,  500,  499,
-      498,  497,  496,  495,  494,  491,  490,  489,  486,  485,
-      484,  483,  482,  481,  480,  477,  476,  475,  474,  473,
-      472,  471,  470,  469,  468,  465,  464,  463,  462,  461,
-      458,  457,  456,  455,  454,  453,  452,  451,  450,  445,
-      444,  443,  442,  441,  440,  439,  438,  437,  436,  435,
-      434,  431,  430,  429,  428,  425,  424,  423,  422,  421,
-      420,  419,  418,  417,  414,  413,  411,  410,  405,  400,
-      397,  394,  393,  392,  391,  389,  388,  387,  386,  385,
-      384,  383,  382,  381,  380,  379,  378,  377,  376,  373,
-
-      372,  371,  370,  369,  368,  367,  366,  365,  364,  363,
-      362,  358,  357,  356,  355,  354,  353,  352,  351,  347,
-      346,  345,  344,  343,  342,  341,  340,  339,  338,  337,
-      336,  335,  334,  333,  332,  331,  330,  329,  328,  327,
-      326,  325,  324,  323,  322,  321,  320,  316,  315,  314,
-      313,  312,  311,  310,  308,  202,  305,  303,  301,  298,
-      297,  295,  293,  286,  285,  284,  282,  281,  279,  278,
-      277,  276,  261,  260,  256,  253,  252,  251,  250,  249,
-      247,  246,  245,  244,  241,  240,  239,  238,  237,  236,
-      235,  234,  233,  229,  228,  225,  222,  221,  220,  219,
-
-      216,  215,  214,  210,  209,  208,  207,  206,  202,  195,
-      192,  191,  189,  187,  186,  178,  163,  144,  122,  110,
-      107,  106,  104,   43,  100,   98,   97,   88,   43, 1467,
-       11, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-
-     1467, 1467
-    } ;
-
-static const flex_int16_t yy_chk[1903] =
-    {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  610,
-        3,    3,    3,   21,    1,    1,    3,    0,  610,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  721,    8,
-        8,    8,    1,    8,   57,   27,   28,  722,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-      129,  129,   25,   65,   25,   66,    2,   25,   25,   25,
-       65,  265,    2,   66,  265,   20,   51,  723,   54,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   48,   17,   17,   17,   19,   56,   19,
-       19,   19,   44,   59,   22,   17,   22,   22,   22,  724,
-       19,   64,   61,   55,   67,   61,   93,   22,   61,   48,
-       61,   56,   61,   55,   67,  115,   67,   75,   17,   59,
-      109,   75,   63,   19,   64,   59,   55,   44,   59,   96,
-       22,   45,   70,   63,   93,   64,   70,   45,  115,   45,
-       45,   55,   45,   63,   45,   45,   45,  109,   58,   69,
-       69,   45,   45,   69,   45,   58,   70,   96,  725,   69,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   58,   89,   89,   89,   58,   62,  112,
-       71,   58,   62,   73,   91,   62,   62,   73,   78,   58,
-      149,  727,   72,   58,  149,   58,   58,   73,   62,   71,
-       72,   71,   72,   71,   77,   76,  112,   72,   72,   76,
-       91,   78,   76,   92,   77,   90,   90,   90,  101,   76,
-       76,   78,   81,   81,   81,   76,   78,   77,   82,   77,
-       82,   82,   82,   81,   94,   85,   85,   85,   83,   92,
-       83,   82,   77,   83,   83,   83,   85,   95,   84,   77,
-       84,   84,   84,  101,  105,  103,   81,  108,  111,  113,
-
-       94,   84,  103,  119,   82,  114,  125,  154,  134,   85,
-      134,  139,  136,   95,  139,  125,  125,  728,  139,  180,
-      119,  172,  105,  108,   84,  165,  111,  113,  136,  183,
-      103,  119,  114,  390,  103,  154,  390,  154,  103,  160,
-      160,  162,  166,  166,  162,  162,  103,  180,  172,  182,
-      103,  175,  103,  103,  118,  118,  118,  183,  165,  165,
-      165,  118,  118,  118,  118,  118,  118,  181,  184,  165,
-      193,  165,  182,  165,  165,  167,  165,  185,  175,  167,
-      190,  194,  196,  167,  118,  118,  118,  118,  118,  118,
-      198,  200,  205,  181,  184,  285,  213,  280,  193,  252,
-
-      185,  287,  280,  190,  213,  196,  243,  295,  194,  290,
-      213,  296,  309,  198,  299,  205,  302,  295,  200,  203,
-      203,  203,  319,  366,  287,  625,  203,  203,  203,  203,
-      203,  203,  290,  252,  298,  298,  354,  299,  325,  319,
-      296,  309,  325,  298,  302,  285,  354,  252,  625,  203,
-      203,  203,  203,  203,  203,  348,  348,  243,  404,  338,
-      243,  307,  307,  307,  338,  564,  564,  582,  307,  307,
-      307,  307,  307,  307,  375,  416,  379,  396,  375,  366,
-      379,  525,  396,  441,  432,  414,  404,  414,  441,  632,
-      632,  307,  307,  307,  307,  307,  307,  432,  729,  432,
-
-      527,  526,  624,  416,  582,  527,  668,  630,  525,  668,
-      338,  719,  414,  630,  414,  338,  415,  415,  415,  730,
-      731,  732,  733,  415,  415,  415,  415,  415,  415,  526,
-      624,  700,  701,  701,  734,  704,  735,  736,  700,  719,
-      701,  704,  737,  738,  701,  739,  415,  415,  415,  415,
-      415,  415,  740,  741,  742,  743,  745,  746,  747,  748,
-      749,  750,  751,  752,  753,  754,  750,  755,  756,  757,
-      758,  761,  762,  763,  764,  767,  768,  769,  770,  771,
-      772,  773,  774,  771,  775,  776,  777,  779,  780,  781,
-      782,  783,  784,  785,  786,  787,  788,  789,  790,  791,
-
-      792,  793,  794,  795,  796,  797,  798,  799,  800,  801,
-      802,  803,  805,  806,  807,  808,  809,  810,  811,  812,
-      813,  815,  816,  817,  818,  819,  820,  821,  822,  823,
+       45,   45,   45,   71,   72,   73,   72,   71,   72,   73,
+      109,  106,  107,  107,  110,  106,  111,  116,   73,  106,
+
+      117,  118,  119,  120,  121,  122,   71,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   78,   78,   78,
+       78,   78,   78,   78,   78,   78,   78,   80,   80,  124,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   80,   80,   80,
+       80,   80,   80,   80,   80,   80,   80,   91,   93,  104,
+       95,  102,  125,  128,  132,  133,  134,  135,  136,  137,
+      138,  139,  140,  141,  142,  132,  143,  137,  137,  144,
+      144,  145,  146,   93,   91,   95,  104,  102,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  114,  114,
+      114,  114,  114,  114,  114,  114,  114,  114,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+
+      115,  115,  115,  115,  115,  115,  115,  115,  115,  115,
+      115,  115,  115,  115,  115,  123,  126,  127,  129,  148,
+      130,  131,  147,  149,  147,  150,  151,  152,  153,  154,
+      155,  153,  156,  157,  158,  153,  159,  160,  161,  162,
+      150,  126,  123,  127,  131,  129,  130,  163,  164,  165,
+      166,  167,  164,  168,  169,  170,  170,  169,  169,  171,
+      172,  173,  174,  175,  172,  174,  176,  177,  182,  183,
+      184,  185,  187,  186,  188,  179,  190,  192,  191,  193,
+      194,  195,  179,  191,  196,  197,  198,  199,  200,  201,
+      202,  182,  203,  208,  173,  173,  173,  184,  186,  209,
+
+      211,  212,  193,  213,  173,  210,  173,  214,  173,  173,
+      179,  173,  216,  217,  179,  218,  220,  215,  179,  219,
+      221,  222,  223,  224,  225,  179,  204,  204,  204,  179,
+      226,  179,  179,  204,  204,  204,  204,  204,  204,  210,
+      215,  227,  218,  221,  228,  219,  229,  230,  223,  232,
+      233,  234,  210,  235,  236,  231,  204,  204,  204,  204,
+      204,  204,  231,  237,  238,  239,  240,  241,  231,  242,
+      243,  244,  245,  246,  247,  248,  249,  250,  251,  252,
+      253,  254,  255,  257,  258,  259,  260,  261,  262,  263,
+      264,  265,  266,  267,  268,  269,  270,  271,  272,  273,
+
+      274,  275,  276,  277,  278,  279,  280,  281,  282,  283,
+      284,  282,  285,  286,  287,  288,  289,  290,  291,  292,
+      292,  292,  296,  297,  300,  301,  292,  292,  292,  292,
+      292,  292,  302,  304,  305,  302,  306,  307,  308,  309,
+      310,  265,  311,  312,  265,  296,  313,  314,  317,  292,
+      292,  292,  292,  292,  292,  318,  319,  320,  321,  323,
+      325,  315,  315,  315,  322,  324,  326,  291,  315,  315,
+      315,  315,  315,  315,  324,  322,  327,  327,  328,  329,
+      330,  331,  333,  334,  336,  327,  337,  338,  325,  339,
+      340,  315,  315,  315,  315,  315,  315,  341,  342,  343,
+
+      344,  328,  345,  346,  348,  349,  350,  351,  331,  349,
+      352,  353,  354,  355,  356,  343,  357,  358,  359,  360,
+      361,  362,  363,  364,  365,  366,  367,  363,  368,  369,
+      370,  371,  372,  373,  374,  375,  376,  376,  377,  378,
+      379,  380,  381,  382,  383,  384,  385,  386,  387,  388,
+      389,  381,  390,  391,  392,  393,  394,  395,  396,  397,
+      398,  399,  396,  400,  401,  399,  404,  405,  406,  410,
+      412,  413,  363,  406,  407,  407,  407,  363,  416,  417,
+      418,  407,  407,  407,  407,  407,  407,  419,  420,  421,
+      422,  423,  424,  426,  427,  428,  429,  430,  431,  432,
+
+      384,  433,  434,  435,  407,  407,  407,  407,  407,  407,
+      425,  425,  425,  437,  438,  439,  440,  425,  425,  425,
+      425,  425,  425,  436,  441,  443,  444,  445,  446,  445,
+      447,  448,  449,  450,  451,  452,  453,  454,  455,  457,
+      425,  425,  425,  425,  425,  425,  458,  459,  460,  461,
+      436,  463,  464,  445,  465,  445,  467,  468,  469,  470,
+      460,  471,  460,  472,  473,  474,  471,  475,  476,  477,
+      479,  480,  481,  482,  483,  484,  485,  486,  487,  488,
+      489,  490,  491,  492,  493,  494,  495,  496,  497,  498,
+      500,  501,  504,  505,  506,  507,  508,  509,  510,  511,
+
+      512,  513,  514,  515,  516,  517,  518,  519,  520,  521,
+      522,  523,  524,  526,  526,  526,  527,  528,  529,  530,
+      526,  526,  526,  526,  526,  526,  531,  532,  533,  534,
+      535,  536,  537,  540,  541,  542,  543,  544,  545,  535,
+      546,  547,  548,  526,  526,  526,  526,  526,  526,  549,
+      550,  551,  554,  556,  558,  559,  560,  563,  564,  565,
+      566,  567,  568,  569,  570,  571,  572,  573,  574,  575,
+      576,  577,  578,  543,  579,  580,  581,  582,  583,  585,
+      558,  586,  559,  587,  588,  589,  590,  591,  592,  593,
+      594,  595,  596,  597,  598,  598,  599,  600,  601,  603,
+
+      604,  605,  606,  607,  608,  609,  610,  611,  612,  614,
+      615,  616,  617,  618,  619,  620,  621,  622,  623,  624,
+      625,  627,  628,  629,  630,  631,  632,  633,  634,  635,
+      635,  635,  637,  638,  639,  642,  635,  635,  635,  635,
+      635,  635,  640,  640,  641,  643,  645,  646,  647,  640,
+      641,  648,  649,  640,  647,  650,  651,  653,  654,  635,
+      635,  635,  635,  635,  635,  655,  656,  657,  658,  660,
+      661,  662,  663,  664,  665,  666,  667,  668,  669,  669,
+      670,  669,  671,  672,  673,  674,  675,  676,  677,  678,
+      679,  674,  680,  681,  682,  683,  664,  684,  685,  663,
+
+      686,  687,  688,  690,  691,  692,  693,  694,  695,  696,
+      697,  698,  699,  700,  701,  702,  703,  704,  705,  706,
+      707,  708,  706,  710,  711,  712,  713,  714,  715,  716,
+      717,  718,  719,  720,  721,  722,  723,  724,  725,  726,
+      727,  728,  729,  730,  731,  732,  733,  734,  736,  737,
+      738,  739,  740,  741,  742,  743,  744,  745,  746,  748,
+      749,  750,  751,  752,  753,  754,  751,  755,  756,  757,
+      758,  759,  760,  761,  762,  764,  765,  766,  767,  768,
+      770,  771,  772,  773,  774,  775,  776,  777,  778,  779,
+      780,  781,  782,  783,  784,  785,  786,  787,  788,  789,
+
+      790,  791,  793,  765,  794,  795,  796,  797,  798,  794,
+      799,  800,  801,  802,  803,  804,  806,  808,  809,  810,
+      811,  814,  815,  816,  817,  818,  819,  821,  822,  823,
       824,  825,  826,  827,  828,  829,  830,  831,  832,  833,
-      834,  836,  837,  838,  839,  816,  840,  841,  815,  842,
-      843,  844,  846,  847,  848,  849,  850,  852,  853,  854,
-      855,  856,  857,  858,  859,  860,  861,  862,  863,  864,
-      865,  866,  867,  868,  869,  871,  872,  873,  875,  876,
-      877,  878,  879,  880,  868,  881,  882,  883,  884,  885,
-      886,  887,  888,  889,  890,  891,  893,  894,  895,  896,
-
-      897,  898,  899,  900,  901,  902,  903,  904,  905,  907,
-      906,  849,  908,  909,  910,  911,  913,  914,  915,  916,
-      917,  918,  919,  920,  922,  923,  924,  925,  926,  927,
-      928,  929,  930,  931,  932,  933,  905,  906,  934,  935,
-      936,  938,  939,  940,  941,  942,  938,  943,  944,  945,
-      946,  947,  948,  949,  950,  951,  952,  953,  954,  955,
-      956,  957,  958,  959,  960,  962,  963,  964,  965,  966,
-      967,  968,  969,  970,  971,  972,  974,  975,  977,  978,
-      979,  980,  981,  982,  939,  983,  984,  985,  986,  987,
-      988,  990,  991,  992,  993,  994,  995,  997,  998,  999,
-
-     1000, 1001, 1002, 1005, 1006, 1007, 1008, 1009, 1010, 1011,
-     1012, 1013, 1014, 1015, 1016,  991, 1017, 1018, 1019, 1022,
-     1024,  992, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1033,
-     1034, 1035, 1036, 1038, 1039, 1040, 1041, 1042, 1045, 1046,
-     1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056,
-     1057, 1058, 1059, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
-     1068, 1069, 1070, 1071, 1072, 1073, 1075, 1076, 1077, 1078,
-     1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088,
-     1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099,
-     1100, 1101, 1072, 1102, 1103, 1104, 1105, 1106, 1054, 1107,
-
-     1109, 1112, 1113, 1114, 1105, 1115, 1116, 1117, 1118, 1119,
-     1077, 1120, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1130,
-     1132, 1135, 1137, 1139, 1140, 1141, 1142, 1143, 1145, 1146,
-     1141, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156,
-     1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
-     1143, 1168, 1171, 1173, 1174, 1175, 1176, 1177, 1179, 1180,
-     1181, 1182, 1183, 1184, 1186, 1187, 1189, 1190, 1191, 1192,
-     1194, 1195, 1196, 1197, 1198, 1199, 1201, 1203, 1205, 1207,
-     1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217,
-     1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1225, 1226,
-
-     1227, 1228, 1229, 1230, 1231, 1205, 1232, 1233, 1234, 1235,
-     1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
-     1246, 1248, 1249, 1251, 1252, 1253, 1254, 1258, 1259, 1262,
-     1263, 1264, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
-     1276, 1277, 1279, 1281, 1282, 1283, 1284, 1285, 1287, 1288,
-     1289, 1290, 1291, 1292, 1254, 1226, 1293, 1294, 1295, 1296,
-     1297, 1298, 1299, 1301, 1302, 1303, 1305, 1306, 1307, 1308,
-     1309, 1310, 1311, 1313, 1314, 1315, 1317, 1319, 1320, 1321,
-     1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1331, 1332,
-     1336, 1340, 1341, 1343, 1344, 1346, 1347, 1348, 1349, 1350,
-
-     1351, 1353, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
-     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1374, 1375,
-     1376, 1377, 1378, 1380, 1381, 1382, 1383, 1384, 1385, 1387,
-     1388, 1389, 1390, 1391, 1393, 1395, 1397, 1398, 1399, 1400,
-     1401, 1402, 1403, 1404, 1406, 1407, 1409, 1410, 1413, 1414,
-     1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
-     1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
-     1435, 1436, 1437, 1439, 1441, 1442, 1443, 1444, 1445, 1446,
-     1450, 1451, 1452, 1453, 1455, 1456, 1458, 1459, 1460, 1461,
-     1462, 1464, 1465, 1468, 1468, 1468, 1468, 1468, 1469, 1469,
-
-     1469, 1469, 1469, 1470, 1476, 1470, 1470, 1470, 1471, 1477,
-     1471, 1478, 1471, 1472, 1472, 1472, 1472, 1472, 1473, 1473,
-     1473, 1473, 1473, 1474, 1479, 1474, 1474, 1474, 1475, 1475,
-     1475,  720,  718,  716,  715,  714,  713,  712,  711,  710,
-      709,  708,  707,  706,  703,  702,  699,  698,  697,  696,
-      695,  694,  693,  692,  691,  690,  689,  688,  687,  686,
-      685,  684,  683,  682,  681,  680,  678,  677,  676,  675,
-      674,  673,  672,  671,  669,  667,  666,  665,  664,  663,
-      662,  661,  660,  659,  658,  657,  656,  655,  654,  653,
-      652,  650,  649,  648,  647,  646,  645,  644,  643,  642,
-
-      641,  640,  639,  638,  637,  636,  635,  634,  633,  631,
-      629,  628,  627,  626,  623,  622,  621,  619,  618,  616,
-      615,  614,  613,  612,  611,  608,  607,  606,  605,  604,
-      603,  602,  601,  600,  599,  598,  597,  595,  594,  593,
-      592,  591,  590,  589,  588,  586,  585,  584,  583,  581,
-      580,  579,  578,  577,  576,  575,  573,  572,  571,  570,
-      569,  568,  567,  566,  565,  563,  562,  561,  560,  559,
-      558,  557,  556,  555,  554,  553,  552,  550,  549,  548,
-      547,  546,  545,  544,  543,  542,  541,  540,  539,  538,
-      537,  536,  535,  534,  533,  532,  531,  530,  529,  523,
-
-      521,  518,  517,  516,  515,  513,  512,  511,  509,  508,
-      505,  504,  503,  502,  501,  500,  499,  498,  497,  496,
-      495,  494,  493,  492,  491,  490,  489,  488,  487,  486,
-      485,  484,  483,  482,  481,  479,  477,  476,  475,  474,
-      473,  472,  471,  470,  469,  468,  467,  466,  464,  463,
-      462,  461,  460,  459,  458,  457,  456,  455,  454,  453,
-      452,  451,  450,  449,  448,  447,  445,  444,  443,  442,
-      440,  439,  438,  437,  436,  434,  433,  431,  430,  428,
-      427,  426,  425,  424,  423,  421,  420,  419,  418,  417,
-      412,  411,  409,  408,  407,  406,  405,  403,  402,  400,
-
-      397,  395,  394,  392,  391,  389,  388,  387,  386,  385,
-      384,  383,  382,  381,  380,  378,  377,  376,  374,  373,
-      372,  371,  369,  368,  367,  365,  364,  363,  362,  361,
-      360,  359,  358,  357,  355,  353,  352,  351,  350,  349,
-      347,  346,  345,  344,  343,  342,  341,  340,  339,  337,
-      336,  335,  334,  333,  332,  331,  330,  329,  328,  327,
-      326,  324,  323,  322,  321,  318,  317,  316,  315,  314,
-      313,  312,  311,  310,  306,  304,  301,  300,  297,  293,
-      286,  284,  283,  282,  281,  279,  278,  277,  276,  275,
-      274,  273,  272,  271,  270,  269,  268,  267,  266,  264,
-
-      263,  262,  261,  260,  259,  258,  257,  256,  255,  254,
-      253,  251,  250,  249,  248,  247,  246,  245,  244,  242,
-      241,  240,  239,  238,  237,  236,  235,  233,  232,  231,
-      230,  229,  228,  227,  226,  225,  224,  223,  222,  221,
-      220,  219,  218,  217,  216,  215,  214,  212,  211,  210,
-      209,  208,  207,  206,  204,  201,  199,  197,  195,  192,
-      191,  189,  186,  178,  177,  176,  174,  173,  171,  170,
-      169,  168,  164,  163,  161,  159,  158,  157,  156,  155,
-      153,  152,  151,  150,  148,  147,  146,  145,  144,  143,
-      142,  141,  140,  138,  137,  135,  133,  132,  131,  130,
-
-      128,  127,  126,  124,  123,  122,  121,  120,  116,  110,
-      107,  106,  104,   99,   98,   79,   74,   68,   60,   53,
-       50,   49,   47,   43,   41,   39,   38,   24,   14,   11,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-     1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467, 1467,
-
-     1467, 1467
+      834,  835,  836,  837,  838,  839,  841,  842,  843,  844,
+      845,  846,  847,  848,  849,  850,  851,  852,  853,  854,
+      855,  856,  857,  858,  859,  860,  861,  862,  863,  865,
+      866,  867,  868,  869,  859,  870,  871,  872,  873,  874,
+      875,  876,  877,  878,  879,  880,  881,  882,  883,  884,
+      885,  887,  888,  866,  889,  865,  890,  891,  892,  893,
+
+      895,  896,  897,  898,  899,  900,  901,  903,  904,  905,
+      906,  907,  908,  909,  910,  911,  912,  913,  914,  916,
+      917,  918,  919,  921,  922,  923,  924,  925,  926,  927,
+      928,  929,  930,  931,  932,  933,  934,  936,  937,  938,
+      940,  941,  942,  943,  944,  945,  946,  947,  948,  949,
+      950,  951,  952,  953,  954,  955,  956,  957,  958,  959,
+      961,  901,  960,  962,  963,  964,  965,  966,  967,  968,
+      969,  970,  972,  973,  974,  976,  977,  978,  979,  980,
+      981,  982,  983,  984,  985,  986,  959,  987,  960,  988,
+      989,  990,  991,  992,  993,  995,  996,  997,  998,  993,
+
+      999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008,
+     1009, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019,
+     1020, 1021, 1022, 1023, 1024, 1025, 1026, 1028, 1029, 1030,
+     1031, 1032, 1033, 1022, 1035,  992, 1036, 1037, 1038, 1039,
+     1040, 1041, 1042, 1043, 1044, 1046, 1047, 1048, 1049, 1050,
+     1051, 1052, 1053, 1054, 1055, 1056, 1057, 1059, 1061, 1062,
+     1063, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1047,
+     1073, 1074, 1075, 1076, 1048, 1078, 1080, 1082, 1083, 1084,
+     1085, 1086, 1087, 1088, 1089, 1090, 1094, 1096, 1097, 1098,
+     1099, 1100, 1101, 1102, 1103, 1104, 1106, 1107, 1108, 1109,
+
+     1112, 1114, 1115, 1116, 1121, 1122, 1123, 1124, 1125, 1126,
+     1127, 1128, 1129, 1130, 1131, 1133, 1134, 1135, 1136, 1137,
+     1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1147, 1148,
+     1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157, 1158,
+     1130, 1159, 1160, 1161, 1162, 1104, 1163, 1164, 1165, 1167,
+     1168, 1169, 1170, 1171, 1163, 1172, 1173, 1175, 1176, 1177,
+     1178, 1179, 1181, 1182, 1183, 1141, 1184, 1185, 1186, 1187,
+     1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196, 1198,
+     1199, 1194, 1200, 1201, 1202, 1203, 1204, 1205, 1207, 1208,
+     1209, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219,
+
+     1220, 1196, 1221, 1223, 1224, 1227, 1228, 1229, 1230, 1231,
+     1233, 1234, 1236, 1237, 1239, 1240, 1241, 1243, 1246, 1247,
+     1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1258, 1260,
+     1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
+     1272, 1273, 1274, 1275, 1276, 1277, 1278, 1278, 1279, 1280,
+     1281, 1282, 1283, 1284, 1285, 1260, 1286, 1287, 1288, 1289,
+     1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299,
+     1300, 1301, 1303, 1304, 1305, 1306, 1308, 1309, 1311, 1312,
+     1314, 1318, 1319, 1320, 1323, 1324, 1325, 1326, 1327, 1328,
+     1330, 1331, 1332, 1333, 1335, 1336, 1337, 1338, 1340, 1341,
+
+     1342, 1343, 1344, 1279, 1309, 1345, 1346, 1347, 1351, 1352,
+     1354, 1355, 1356, 1357, 1358, 1359, 1361, 1362, 1363, 1364,
+     1365, 1366, 1367, 1368, 1370, 1371, 1373, 1375, 1376, 1377,
+     1378, 1379, 1380, 1381, 1383, 1384, 1385, 1386, 1388, 1389,
+     1393, 1394, 1396, 1397, 1398, 1400, 1401, 1402, 1403, 1404,
+     1405, 1407, 1408, 1409, 1410, 1411, 1412, 1414, 1415, 1416,
+     1417, 1418, 1419, 1420, 1421, 1422, 1423, 1425, 1426, 1428,
+     1429, 1431, 1432, 1433, 1434, 1435, 1437, 1439, 1441, 1442,
+     1443, 1444, 1445, 1446, 1448, 1449, 1450, 1451, 1452, 1453,
+     1454, 1455, 1456, 1457, 1458, 1459, 1460, 1464, 1466, 1467,
+
+     1468, 1469, 1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477,
+     1478, 1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487,
+     1490, 1491, 1492, 1493, 1494, 1495, 1497, 1498, 1499, 1500,
+     1501, 1502, 1506, 1507, 1508, 1509, 1511, 1513, 1514, 1515,
+     1516, 1517, 1518, 1520, 1521,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1675,27 +1825,27 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[175] =
+static const flex_int16_t yy_rule_linenum[180] =
     {   0,
       147,  149,  151,  156,  157,  162,  163,  164,  176,  179,
       184,  191,  200,  209,  218,  227,  236,  245,  255,  264,
       273,  282,  291,  300,  309,  318,  327,  336,  345,  354,
-      366,  375,  384,  393,  402,  413,  424,  435,  446,  456,
-      466,  477,  488,  499,  510,  521,  532,  543,  554,  565,
-      576,  587,  596,  605,  615,  624,  634,  648,  664,  673,
-      682,  691,  700,  721,  742,  751,  761,  770,  781,  790,
-      799,  808,  817,  826,  836,  845,  854,  863,  872,  881,
-      890,  899,  908,  917,  926,  936,  947,  959,  968,  977,
-      987,  997, 1007, 1017, 1027, 1037, 1046, 1056, 1065, 1074,
-
-     1083, 1092, 1102, 1112, 1121, 1131, 1140, 1149, 1158, 1167,
+      363,  375,  384,  393,  402,  411,  422,  433,  444,  455,
+      465,  475,  486,  497,  508,  519,  530,  541,  552,  563,
+      574,  585,  596,  605,  614,  624,  633,  643,  657,  673,
+      682,  691,  700,  709,  730,  751,  760,  770,  779,  790,
+      799,  808,  817,  826,  835,  845,  854,  863,  872,  881,
+      890,  899,  908,  917,  926,  935,  944,  953,  962,  971,
+      981,  992, 1004, 1013, 1022, 1032, 1042, 1052, 1062, 1072,
+
+     1082, 1091, 1101, 1110, 1119, 1128, 1137, 1147, 1157, 1166,
      1176, 1185, 1194, 1203, 1212, 1221, 1230, 1239, 1248, 1257,
      1266, 1275, 1284, 1293, 1302, 1311, 1320, 1329, 1338, 1347,
-     1356, 1365, 1374, 1383, 1392, 1401, 1411, 1421, 1431, 1441,
-     1451, 1461, 1471, 1481, 1491, 1500, 1509, 1518, 1527, 1536,
-     1545, 1554, 1565, 1576, 1589, 1602, 1617, 1716, 1721, 1726,
-     1731, 1732, 1733, 1734, 1735, 1736, 1738, 1756, 1769, 1774,
-     1778, 1780, 1782, 1784
+     1356, 1365, 1374, 1383, 1392, 1401, 1410, 1419, 1428, 1437,
+     1446, 1456, 1466, 1476, 1486, 1496, 1506, 1516, 1526, 1536,
+     1545, 1554, 1563, 1572, 1581, 1590, 1599, 1610, 1621, 1634,
+     1647, 1662, 1761, 1766, 1771, 1776, 1777, 1778, 1779, 1780,
+     1781, 1783, 1801, 1814, 1819, 1823, 1825, 1827, 1829
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1707,7 +1857,7 @@ static const flex_int16_t yy_rule_linenum[175] =
 #define YY_RESTORE_YY_MORE_OFFSET
 char *yytext;
 #line 1 "dhcp4_lexer.ll"
-/* Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -1748,7 +1898,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1751 "dhcp4_lexer.cc"
+#line 1901 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1774,8 +1924,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1777 "dhcp4_lexer.cc"
-#line 1778 "dhcp4_lexer.cc"
+#line 1927 "dhcp4_lexer.cc"
+#line 1928 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2105,7 +2255,7 @@ YY_DECL
     }
 
 
-#line 2108 "dhcp4_lexer.cc"
+#line 2258 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2134,13 +2284,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1468 )
+				if ( yy_current_state >= 1524 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1467 );
+		while ( yy_current_state != 1523 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2477,6 +2627,18 @@ YY_RULE_SETUP
 case 29:
 YY_RULE_SETUP
 #line 345 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::CONFIG_CONTROL:
+        return isc::dhcp::Dhcp4Parser::make_CONFIG_FETCH_WAIT_TIME(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("config-fetch-wait-time", driver.loc_);
+    }
+}
+	YY_BREAK
+case 30:
+YY_RULE_SETUP
+#line 354 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOSTS_DATABASE:
@@ -2486,9 +2648,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 31:
 YY_RULE_SETUP
-#line 354 "dhcp4_lexer.ll"
+#line 363 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2501,9 +2663,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 32:
 YY_RULE_SETUP
-#line 366 "dhcp4_lexer.ll"
+#line 375 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2513,9 +2675,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 33:
 YY_RULE_SETUP
-#line 375 "dhcp4_lexer.ll"
+#line 384 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2525,9 +2687,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 34:
 YY_RULE_SETUP
-#line 384 "dhcp4_lexer.ll"
+#line 393 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2537,9 +2699,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 35:
 YY_RULE_SETUP
-#line 393 "dhcp4_lexer.ll"
+#line 402 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2549,9 +2711,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 36:
 YY_RULE_SETUP
-#line 402 "dhcp4_lexer.ll"
+#line 411 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2563,9 +2725,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 413 "dhcp4_lexer.ll"
+#line 422 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2577,9 +2739,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 424 "dhcp4_lexer.ll"
+#line 433 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2591,9 +2753,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 435 "dhcp4_lexer.ll"
+#line 444 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2605,9 +2767,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 446 "dhcp4_lexer.ll"
+#line 455 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2618,9 +2780,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 41:
 YY_RULE_SETUP
-#line 456 "dhcp4_lexer.ll"
+#line 465 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2631,9 +2793,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 42:
 YY_RULE_SETUP
-#line 466 "dhcp4_lexer.ll"
+#line 475 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2645,9 +2807,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 43:
 YY_RULE_SETUP
-#line 477 "dhcp4_lexer.ll"
+#line 486 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2659,9 +2821,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 488 "dhcp4_lexer.ll"
+#line 497 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2673,9 +2835,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 499 "dhcp4_lexer.ll"
+#line 508 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2687,9 +2849,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 510 "dhcp4_lexer.ll"
+#line 519 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2701,9 +2863,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 521 "dhcp4_lexer.ll"
+#line 530 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2715,9 +2877,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 532 "dhcp4_lexer.ll"
+#line 541 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2729,9 +2891,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 543 "dhcp4_lexer.ll"
+#line 552 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2743,9 +2905,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 554 "dhcp4_lexer.ll"
+#line 563 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2757,9 +2919,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
 YY_RULE_SETUP
-#line 565 "dhcp4_lexer.ll"
+#line 574 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2771,9 +2933,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 52:
 YY_RULE_SETUP
-#line 576 "dhcp4_lexer.ll"
+#line 585 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2785,9 +2947,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 53:
 YY_RULE_SETUP
-#line 587 "dhcp4_lexer.ll"
+#line 596 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2797,9 +2959,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 54:
 YY_RULE_SETUP
-#line 596 "dhcp4_lexer.ll"
+#line 605 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2809,9 +2971,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 55:
 YY_RULE_SETUP
-#line 605 "dhcp4_lexer.ll"
+#line 614 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2822,9 +2984,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 56:
 YY_RULE_SETUP
-#line 615 "dhcp4_lexer.ll"
+#line 624 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2834,9 +2996,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 57:
 YY_RULE_SETUP
-#line 624 "dhcp4_lexer.ll"
+#line 633 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2847,9 +3009,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 58:
 YY_RULE_SETUP
-#line 634 "dhcp4_lexer.ll"
+#line 643 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2864,9 +3026,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 59:
 YY_RULE_SETUP
-#line 648 "dhcp4_lexer.ll"
+#line 657 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2883,9 +3045,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 60:
 YY_RULE_SETUP
-#line 664 "dhcp4_lexer.ll"
+#line 673 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2895,9 +3057,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 61:
 YY_RULE_SETUP
-#line 673 "dhcp4_lexer.ll"
+#line 682 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2907,9 +3069,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 62:
 YY_RULE_SETUP
-#line 682 "dhcp4_lexer.ll"
+#line 691 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2919,9 +3081,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 63:
 YY_RULE_SETUP
-#line 691 "dhcp4_lexer.ll"
+#line 700 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -2931,9 +3093,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 64:
 YY_RULE_SETUP
-#line 700 "dhcp4_lexer.ll"
+#line 709 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2955,9 +3117,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 65:
 YY_RULE_SETUP
-#line 721 "dhcp4_lexer.ll"
+#line 730 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2979,9 +3141,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 66:
 YY_RULE_SETUP
-#line 742 "dhcp4_lexer.ll"
+#line 751 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2991,9 +3153,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 67:
 YY_RULE_SETUP
-#line 751 "dhcp4_lexer.ll"
+#line 760 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3004,9 +3166,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 68:
 YY_RULE_SETUP
-#line 761 "dhcp4_lexer.ll"
+#line 770 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3016,9 +3178,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 69:
 YY_RULE_SETUP
-#line 770 "dhcp4_lexer.ll"
+#line 779 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3030,9 +3192,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 70:
 YY_RULE_SETUP
-#line 781 "dhcp4_lexer.ll"
+#line 790 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3042,9 +3204,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 71:
 YY_RULE_SETUP
-#line 790 "dhcp4_lexer.ll"
+#line 799 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3054,9 +3216,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 72:
 YY_RULE_SETUP
-#line 799 "dhcp4_lexer.ll"
+#line 808 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3066,9 +3228,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 73:
 YY_RULE_SETUP
-#line 808 "dhcp4_lexer.ll"
+#line 817 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3078,9 +3240,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 74:
 YY_RULE_SETUP
-#line 817 "dhcp4_lexer.ll"
+#line 826 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -3090,9 +3252,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 75:
 YY_RULE_SETUP
-#line 826 "dhcp4_lexer.ll"
+#line 835 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3103,9 +3265,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 76:
 YY_RULE_SETUP
-#line 836 "dhcp4_lexer.ll"
+#line 845 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3115,9 +3277,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 77:
 YY_RULE_SETUP
-#line 845 "dhcp4_lexer.ll"
+#line 854 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3127,9 +3289,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 78:
 YY_RULE_SETUP
-#line 854 "dhcp4_lexer.ll"
+#line 863 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGING:
@@ -3139,9 +3301,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 79:
 YY_RULE_SETUP
-#line 863 "dhcp4_lexer.ll"
+#line 872 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3151,9 +3313,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 80:
 YY_RULE_SETUP
-#line 872 "dhcp4_lexer.ll"
+#line 881 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3163,9 +3325,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 81:
 YY_RULE_SETUP
-#line 881 "dhcp4_lexer.ll"
+#line 890 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3175,9 +3337,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 82:
 YY_RULE_SETUP
-#line 890 "dhcp4_lexer.ll"
+#line 899 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGERS:
+        return isc::dhcp::Dhcp4Parser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 83:
+YY_RULE_SETUP
+#line 908 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3187,9 +3361,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 84:
 YY_RULE_SETUP
-#line 899 "dhcp4_lexer.ll"
+#line 917 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3199,9 +3373,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 85:
 YY_RULE_SETUP
-#line 908 "dhcp4_lexer.ll"
+#line 926 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -3211,9 +3385,45 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 86:
 YY_RULE_SETUP
-#line 917 "dhcp4_lexer.ll"
+#line 935 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+#line 944 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 88:
+YY_RULE_SETUP
+#line 953 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 89:
+YY_RULE_SETUP
+#line 962 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -3223,9 +3433,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 90:
 YY_RULE_SETUP
-#line 926 "dhcp4_lexer.ll"
+#line 971 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3236,9 +3446,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 91:
 YY_RULE_SETUP
-#line 936 "dhcp4_lexer.ll"
+#line 981 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3250,9 +3460,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 92:
 YY_RULE_SETUP
-#line 947 "dhcp4_lexer.ll"
+#line 992 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3265,9 +3475,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 93:
 YY_RULE_SETUP
-#line 959 "dhcp4_lexer.ll"
+#line 1004 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3277,9 +3487,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 94:
 YY_RULE_SETUP
-#line 968 "dhcp4_lexer.ll"
+#line 1013 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3289,9 +3499,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 95:
 YY_RULE_SETUP
-#line 977 "dhcp4_lexer.ll"
+#line 1022 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3302,9 +3512,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 96:
 YY_RULE_SETUP
-#line 987 "dhcp4_lexer.ll"
+#line 1032 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3315,9 +3525,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 97:
 YY_RULE_SETUP
-#line 997 "dhcp4_lexer.ll"
+#line 1042 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3328,9 +3538,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 98:
 YY_RULE_SETUP
-#line 1007 "dhcp4_lexer.ll"
+#line 1052 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3341,9 +3551,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 99:
 YY_RULE_SETUP
-#line 1017 "dhcp4_lexer.ll"
+#line 1062 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3354,9 +3564,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 100:
 YY_RULE_SETUP
-#line 1027 "dhcp4_lexer.ll"
+#line 1072 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3367,9 +3577,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 101:
 YY_RULE_SETUP
-#line 1037 "dhcp4_lexer.ll"
+#line 1082 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3379,9 +3589,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 102:
 YY_RULE_SETUP
-#line 1046 "dhcp4_lexer.ll"
+#line 1091 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3392,9 +3602,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 103:
 YY_RULE_SETUP
-#line 1056 "dhcp4_lexer.ll"
+#line 1101 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3404,9 +3614,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 104:
 YY_RULE_SETUP
-#line 1065 "dhcp4_lexer.ll"
+#line 1110 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3416,9 +3626,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 105:
 YY_RULE_SETUP
-#line 1074 "dhcp4_lexer.ll"
+#line 1119 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3428,9 +3638,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 106:
 YY_RULE_SETUP
-#line 1083 "dhcp4_lexer.ll"
+#line 1128 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3440,9 +3650,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 107:
 YY_RULE_SETUP
-#line 1092 "dhcp4_lexer.ll"
+#line 1137 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3453,9 +3663,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 108:
 YY_RULE_SETUP
-#line 1102 "dhcp4_lexer.ll"
+#line 1147 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3466,9 +3676,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 109:
 YY_RULE_SETUP
-#line 1112 "dhcp4_lexer.ll"
+#line 1157 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3478,9 +3688,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 110:
 YY_RULE_SETUP
-#line 1121 "dhcp4_lexer.ll"
+#line 1166 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3490,9 +3700,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 111:
 YY_RULE_SETUP
-#line 1131 "dhcp4_lexer.ll"
+#line 1176 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3502,9 +3712,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 112:
 YY_RULE_SETUP
-#line 1140 "dhcp4_lexer.ll"
+#line 1185 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3514,9 +3724,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 113:
 YY_RULE_SETUP
-#line 1149 "dhcp4_lexer.ll"
+#line 1194 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3526,9 +3736,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 114:
 YY_RULE_SETUP
-#line 1158 "dhcp4_lexer.ll"
+#line 1203 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3538,9 +3748,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 115:
 YY_RULE_SETUP
-#line 1167 "dhcp4_lexer.ll"
+#line 1212 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3550,9 +3760,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 116:
 YY_RULE_SETUP
-#line 1176 "dhcp4_lexer.ll"
+#line 1221 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3562,9 +3772,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 117:
 YY_RULE_SETUP
-#line 1185 "dhcp4_lexer.ll"
+#line 1230 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3574,9 +3784,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 118:
 YY_RULE_SETUP
-#line 1194 "dhcp4_lexer.ll"
+#line 1239 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3586,9 +3796,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 119:
 YY_RULE_SETUP
-#line 1203 "dhcp4_lexer.ll"
+#line 1248 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3598,9 +3808,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 120:
 YY_RULE_SETUP
-#line 1212 "dhcp4_lexer.ll"
+#line 1257 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3610,9 +3820,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 121:
 YY_RULE_SETUP
-#line 1221 "dhcp4_lexer.ll"
+#line 1266 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3622,9 +3832,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 122:
 YY_RULE_SETUP
-#line 1230 "dhcp4_lexer.ll"
+#line 1275 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3634,9 +3844,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 123:
 YY_RULE_SETUP
-#line 1239 "dhcp4_lexer.ll"
+#line 1284 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3646,9 +3856,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 124:
 YY_RULE_SETUP
-#line 1248 "dhcp4_lexer.ll"
+#line 1293 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3658,9 +3868,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 125:
 YY_RULE_SETUP
-#line 1257 "dhcp4_lexer.ll"
+#line 1302 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3670,9 +3880,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 126:
 YY_RULE_SETUP
-#line 1266 "dhcp4_lexer.ll"
+#line 1311 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3682,9 +3892,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 127:
 YY_RULE_SETUP
-#line 1275 "dhcp4_lexer.ll"
+#line 1320 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3694,9 +3904,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 128:
 YY_RULE_SETUP
-#line 1284 "dhcp4_lexer.ll"
+#line 1329 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3706,9 +3916,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 129:
 YY_RULE_SETUP
-#line 1293 "dhcp4_lexer.ll"
+#line 1338 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3718,9 +3928,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 130:
 YY_RULE_SETUP
-#line 1302 "dhcp4_lexer.ll"
+#line 1347 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3730,9 +3940,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 131:
 YY_RULE_SETUP
-#line 1311 "dhcp4_lexer.ll"
+#line 1356 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3742,9 +3952,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 132:
 YY_RULE_SETUP
-#line 1320 "dhcp4_lexer.ll"
+#line 1365 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3754,9 +3964,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 133:
 YY_RULE_SETUP
-#line 1329 "dhcp4_lexer.ll"
+#line 1374 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3766,9 +3976,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 134:
 YY_RULE_SETUP
-#line 1338 "dhcp4_lexer.ll"
+#line 1383 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3778,9 +3988,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 135:
 YY_RULE_SETUP
-#line 1347 "dhcp4_lexer.ll"
+#line 1392 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3790,9 +4000,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 136:
 YY_RULE_SETUP
-#line 1356 "dhcp4_lexer.ll"
+#line 1401 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3802,9 +4012,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 137:
 YY_RULE_SETUP
-#line 1365 "dhcp4_lexer.ll"
+#line 1410 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3814,9 +4024,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 138:
 YY_RULE_SETUP
-#line 1374 "dhcp4_lexer.ll"
+#line 1419 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3826,9 +4036,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 139:
 YY_RULE_SETUP
-#line 1383 "dhcp4_lexer.ll"
+#line 1428 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3838,9 +4048,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 140:
 YY_RULE_SETUP
-#line 1392 "dhcp4_lexer.ll"
+#line 1437 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3850,9 +4060,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 141:
 YY_RULE_SETUP
-#line 1401 "dhcp4_lexer.ll"
+#line 1446 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3863,9 +4073,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 137:
+case 142:
 YY_RULE_SETUP
-#line 1411 "dhcp4_lexer.ll"
+#line 1456 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3876,9 +4086,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 138:
+case 143:
 YY_RULE_SETUP
-#line 1421 "dhcp4_lexer.ll"
+#line 1466 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -3889,9 +4099,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 139:
+case 144:
 YY_RULE_SETUP
-#line 1431 "dhcp4_lexer.ll"
+#line 1476 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3902,9 +4112,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 140:
+case 145:
 YY_RULE_SETUP
-#line 1441 "dhcp4_lexer.ll"
+#line 1486 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3915,9 +4125,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 141:
+case 146:
 YY_RULE_SETUP
-#line 1451 "dhcp4_lexer.ll"
+#line 1496 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3928,9 +4138,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 142:
+case 147:
 YY_RULE_SETUP
-#line 1461 "dhcp4_lexer.ll"
+#line 1506 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3941,9 +4151,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 143:
+case 148:
 YY_RULE_SETUP
-#line 1471 "dhcp4_lexer.ll"
+#line 1516 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3954,9 +4164,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 144:
+case 149:
 YY_RULE_SETUP
-#line 1481 "dhcp4_lexer.ll"
+#line 1526 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3967,9 +4177,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 145:
+case 150:
 YY_RULE_SETUP
-#line 1491 "dhcp4_lexer.ll"
+#line 1536 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3979,9 +4189,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 151:
 YY_RULE_SETUP
-#line 1500 "dhcp4_lexer.ll"
+#line 1545 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3991,9 +4201,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 152:
 YY_RULE_SETUP
-#line 1509 "dhcp4_lexer.ll"
+#line 1554 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -4003,9 +4213,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 153:
 YY_RULE_SETUP
-#line 1518 "dhcp4_lexer.ll"
+#line 1563 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4015,9 +4225,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 154:
 YY_RULE_SETUP
-#line 1527 "dhcp4_lexer.ll"
+#line 1572 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4027,9 +4237,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 155:
 YY_RULE_SETUP
-#line 1536 "dhcp4_lexer.ll"
+#line 1581 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -4039,9 +4249,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 156:
 YY_RULE_SETUP
-#line 1545 "dhcp4_lexer.ll"
+#line 1590 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4051,9 +4261,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 157:
 YY_RULE_SETUP
-#line 1554 "dhcp4_lexer.ll"
+#line 1599 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4065,9 +4275,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 158:
 YY_RULE_SETUP
-#line 1565 "dhcp4_lexer.ll"
+#line 1610 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4079,9 +4289,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 159:
 YY_RULE_SETUP
-#line 1576 "dhcp4_lexer.ll"
+#line 1621 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4095,9 +4305,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 160:
 YY_RULE_SETUP
-#line 1589 "dhcp4_lexer.ll"
+#line 1634 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4111,9 +4321,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 161:
 YY_RULE_SETUP
-#line 1602 "dhcp4_lexer.ll"
+#line 1647 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -4127,9 +4337,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 162:
 YY_RULE_SETUP
-#line 1617 "dhcp4_lexer.ll"
+#line 1662 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4229,65 +4439,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 158:
-/* rule 158 can match eol */
+case 163:
+/* rule 163 can match eol */
 YY_RULE_SETUP
-#line 1716 "dhcp4_lexer.ll"
+#line 1761 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 159:
-/* rule 159 can match eol */
+case 164:
+/* rule 164 can match eol */
 YY_RULE_SETUP
-#line 1721 "dhcp4_lexer.ll"
+#line 1766 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 160:
+case 165:
 YY_RULE_SETUP
-#line 1726 "dhcp4_lexer.ll"
+#line 1771 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 161:
+case 166:
 YY_RULE_SETUP
-#line 1731 "dhcp4_lexer.ll"
+#line 1776 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 162:
+case 167:
 YY_RULE_SETUP
-#line 1732 "dhcp4_lexer.ll"
+#line 1777 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 163:
+case 168:
 YY_RULE_SETUP
-#line 1733 "dhcp4_lexer.ll"
+#line 1778 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 164:
+case 169:
 YY_RULE_SETUP
-#line 1734 "dhcp4_lexer.ll"
+#line 1779 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 165:
+case 170:
 YY_RULE_SETUP
-#line 1735 "dhcp4_lexer.ll"
+#line 1780 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 166:
+case 171:
 YY_RULE_SETUP
-#line 1736 "dhcp4_lexer.ll"
+#line 1781 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 167:
+case 172:
 YY_RULE_SETUP
-#line 1738 "dhcp4_lexer.ll"
+#line 1783 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4306,9 +4516,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 168:
+case 173:
 YY_RULE_SETUP
-#line 1756 "dhcp4_lexer.ll"
+#line 1801 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4322,43 +4532,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 169:
+case 174:
 YY_RULE_SETUP
-#line 1769 "dhcp4_lexer.ll"
+#line 1814 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 170:
+case 175:
 YY_RULE_SETUP
-#line 1774 "dhcp4_lexer.ll"
+#line 1819 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 171:
+case 176:
 YY_RULE_SETUP
-#line 1778 "dhcp4_lexer.ll"
+#line 1823 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 172:
+case 177:
 YY_RULE_SETUP
-#line 1780 "dhcp4_lexer.ll"
+#line 1825 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 173:
+case 178:
 YY_RULE_SETUP
-#line 1782 "dhcp4_lexer.ll"
+#line 1827 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 174:
+case 179:
 YY_RULE_SETUP
-#line 1784 "dhcp4_lexer.ll"
+#line 1829 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1786 "dhcp4_lexer.ll"
+#line 1831 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -4382,12 +4592,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 175:
+case 180:
 YY_RULE_SETUP
-#line 1809 "dhcp4_lexer.ll"
+#line 1854 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4390 "dhcp4_lexer.cc"
+#line 4600 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4706,7 +4916,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1468 )
+			if ( yy_current_state >= 1524 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4739,11 +4949,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1468 )
+		if ( yy_current_state >= 1524 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1467);
+	yy_is_jam = (yy_current_state == 1523);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5492,7 +5702,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1809 "dhcp4_lexer.ll"
+#line 1854 "dhcp4_lexer.ll"
 
 
 using namespace isc::dhcp;
@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 34 "dhcp4_parser.yy" // lalr1.cc:438
+#line 34 "dhcp4_parser.yy"
 
 #include <dhcp4/parser_context.h>
 
-#line 51 "dhcp4_parser.cc" // lalr1.cc:438
+#line 52 "dhcp4_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -88,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER4_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER4_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:513
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 146 "dhcp4_parser.cc" // lalr1.cc:513
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp4Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp4_parser.cc"
 
   /// Build a parser object.
   Dhcp4Parser::Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg)
-    :
 #if PARSER4_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -195,24 +157,26 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::~Dhcp4Parser ()
   {}
 
+  Dhcp4Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  Dhcp4Parser::by_state::by_state ()
+  Dhcp4Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  Dhcp4Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp4Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
   void
-  Dhcp4Parser::by_state::clear ()
+  Dhcp4Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
@@ -224,17 +188,17 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  Dhcp4Parser::by_state::by_state (state_type s)
+  Dhcp4Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  Dhcp4Parser::symbol_number_type
-  Dhcp4Parser::by_state::type_get () const
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   Dhcp4Parser::stack_symbol_type::stack_symbol_type ()
@@ -243,32 +207,32 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 185: // value
-      case 189: // map_value
-      case 230: // socket_type
-      case 233: // outbound_interface_value
-      case 255: // db_type
-      case 337: // hr_mode
-      case 486: // ncr_protocol_value
-      case 493: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 168: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 167: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 166: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 165: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -285,32 +249,32 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 185: // value
-      case 189: // map_value
-      case 230: // socket_type
-      case 233: // outbound_interface_value
-      case 255: // db_type
-      case 337: // hr_mode
-      case 486: // ncr_protocol_value
-      case 493: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 168: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 167: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 166: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 165: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -319,40 +283,81 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  Dhcp4Parser::stack_symbol_type&
+  Dhcp4Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   Dhcp4Parser::stack_symbol_type&
   Dhcp4Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
-    {
-      case 185: // value
-      case 189: // map_value
-      case 230: // socket_type
-      case 233: // outbound_interface_value
-      case 255: // db_type
-      case 337: // hr_mode
-      case 486: // ncr_protocol_value
-      case 493: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 168: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 167: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 166: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 165: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -378,110 +383,97 @@ namespace isc { namespace dhcp {
 #if PARSER4_DEBUG
   template <typename Base>
   void
-  Dhcp4Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp4Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 165: // "constant string"
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 401 "dhcp4_parser.cc" // lalr1.cc:672
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 404 "dhcp4_parser.cc"
         break;
 
-      case 166: // "integer"
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 408 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_INTEGER: // "integer"
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 410 "dhcp4_parser.cc"
         break;
 
-      case 167: // "floating point"
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< double > (); }
-#line 415 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 416 "dhcp4_parser.cc"
         break;
 
-      case 168: // "boolean"
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 422 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 422 "dhcp4_parser.cc"
         break;
 
-      case 185: // value
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 429 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_value: // value
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 428 "dhcp4_parser.cc"
         break;
 
-      case 189: // map_value
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 436 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_map_value: // map_value
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 434 "dhcp4_parser.cc"
         break;
 
-      case 230: // socket_type
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 443 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_socket_type: // socket_type
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 440 "dhcp4_parser.cc"
         break;
 
-      case 233: // outbound_interface_value
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 450 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 446 "dhcp4_parser.cc"
         break;
 
-      case 255: // db_type
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 457 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_db_type: // db_type
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 452 "dhcp4_parser.cc"
         break;
 
-      case 337: // hr_mode
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 464 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_hr_mode: // hr_mode
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 458 "dhcp4_parser.cc"
         break;
 
-      case 486: // ncr_protocol_value
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 471 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 464 "dhcp4_parser.cc"
         break;
 
-      case 493: // replace_client_name_value
-
-#line 245 "dhcp4_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 478 "dhcp4_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 250 "dhcp4_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 470 "dhcp4_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -505,7 +497,7 @@ namespace isc { namespace dhcp {
   }
 
   void
-  Dhcp4Parser::yypop_ (int n)
+  Dhcp4Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -540,21 +532,21 @@ namespace isc { namespace dhcp {
   Dhcp4Parser::state_type
   Dhcp4Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue)
+  Dhcp4Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue)
+  Dhcp4Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -568,7 +560,6 @@ namespace isc { namespace dhcp {
   int
   Dhcp4Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -600,27 +591,33 @@ namespace isc { namespace dhcp {
     yystack_.clear ();
     yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -631,6 +628,7 @@ namespace isc { namespace dhcp {
 #if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
@@ -638,11 +636,23 @@ namespace isc { namespace dhcp {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -659,20 +669,22 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
@@ -684,30 +696,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 185: // value
-      case 189: // map_value
-      case 230: // socket_type
-      case 233: // outbound_interface_value
-      case 255: // db_type
-      case 337: // hr_mode
-      case 486: // ncr_protocol_value
-      case 493: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 168: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 167: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 166: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 165: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -718,8 +730,8 @@ namespace isc { namespace dhcp {
 
       // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
         yyerror_range[1].location = yylhs.location;
       }
 
@@ -731,282 +743,282 @@ namespace isc { namespace dhcp {
         {
           switch (yyn)
             {
-  case 2:
-#line 254 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 738 "dhcp4_parser.cc" // lalr1.cc:907
+  case 2: // $@1: %empty
+#line 259 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 750 "dhcp4_parser.cc"
     break;
 
-  case 4:
-#line 255 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 744 "dhcp4_parser.cc" // lalr1.cc:907
+  case 4: // $@2: %empty
+#line 260 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 756 "dhcp4_parser.cc"
     break;
 
-  case 6:
-#line 256 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP4; }
-#line 750 "dhcp4_parser.cc" // lalr1.cc:907
+  case 6: // $@3: %empty
+#line 261 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP4; }
+#line 762 "dhcp4_parser.cc"
     break;
 
-  case 8:
-#line 257 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 756 "dhcp4_parser.cc" // lalr1.cc:907
+  case 8: // $@4: %empty
+#line 262 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 768 "dhcp4_parser.cc"
     break;
 
-  case 10:
-#line 258 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.SUBNET4; }
-#line 762 "dhcp4_parser.cc" // lalr1.cc:907
+  case 10: // $@5: %empty
+#line 263 "dhcp4_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET4; }
+#line 774 "dhcp4_parser.cc"
     break;
 
-  case 12:
-#line 259 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.POOLS; }
-#line 768 "dhcp4_parser.cc" // lalr1.cc:907
+  case 12: // $@6: %empty
+#line 264 "dhcp4_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 780 "dhcp4_parser.cc"
     break;
 
-  case 14:
-#line 260 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 774 "dhcp4_parser.cc" // lalr1.cc:907
+  case 14: // $@7: %empty
+#line 265 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 786 "dhcp4_parser.cc"
     break;
 
-  case 16:
-#line 261 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP4; }
-#line 780 "dhcp4_parser.cc" // lalr1.cc:907
+  case 16: // $@8: %empty
+#line 266 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.DHCP4; }
+#line 792 "dhcp4_parser.cc"
     break;
 
-  case 18:
-#line 262 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 786 "dhcp4_parser.cc" // lalr1.cc:907
+  case 18: // $@9: %empty
+#line 267 "dhcp4_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 798 "dhcp4_parser.cc"
     break;
 
-  case 20:
-#line 263 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 792 "dhcp4_parser.cc" // lalr1.cc:907
+  case 20: // $@10: %empty
+#line 268 "dhcp4_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 804 "dhcp4_parser.cc"
     break;
 
-  case 22:
-#line 264 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 798 "dhcp4_parser.cc" // lalr1.cc:907
+  case 22: // $@11: %empty
+#line 269 "dhcp4_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 810 "dhcp4_parser.cc"
     break;
 
-  case 24:
-#line 265 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 804 "dhcp4_parser.cc" // lalr1.cc:907
+  case 24: // $@12: %empty
+#line 270 "dhcp4_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 816 "dhcp4_parser.cc"
     break;
 
-  case 26:
-#line 266 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.LOGGING; }
-#line 810 "dhcp4_parser.cc" // lalr1.cc:907
+  case 26: // $@13: %empty
+#line 271 "dhcp4_parser.yy"
+                   { ctx.ctx_ = ctx.LOGGING; }
+#line 822 "dhcp4_parser.cc"
     break;
 
-  case 28:
-#line 267 "dhcp4_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG_CONTROL; }
-#line 816 "dhcp4_parser.cc" // lalr1.cc:907
+  case 28: // $@14: %empty
+#line 272 "dhcp4_parser.yy"
+                          { ctx.ctx_ = ctx.CONFIG_CONTROL; }
+#line 828 "dhcp4_parser.cc"
     break;
 
-  case 30:
-#line 275 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 822 "dhcp4_parser.cc" // lalr1.cc:907
+  case 30: // value: "integer"
+#line 280 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 834 "dhcp4_parser.cc"
     break;
 
-  case 31:
-#line 276 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 828 "dhcp4_parser.cc" // lalr1.cc:907
+  case 31: // value: "floating point"
+#line 281 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 840 "dhcp4_parser.cc"
     break;
 
-  case 32:
-#line 277 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 834 "dhcp4_parser.cc" // lalr1.cc:907
+  case 32: // value: "boolean"
+#line 282 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 846 "dhcp4_parser.cc"
     break;
 
-  case 33:
-#line 278 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 840 "dhcp4_parser.cc" // lalr1.cc:907
+  case 33: // value: "constant string"
+#line 283 "dhcp4_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 852 "dhcp4_parser.cc"
     break;
 
-  case 34:
-#line 279 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 846 "dhcp4_parser.cc" // lalr1.cc:907
+  case 34: // value: "null"
+#line 284 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 858 "dhcp4_parser.cc"
     break;
 
-  case 35:
-#line 280 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 852 "dhcp4_parser.cc" // lalr1.cc:907
+  case 35: // value: map2
+#line 285 "dhcp4_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 864 "dhcp4_parser.cc"
     break;
 
-  case 36:
-#line 281 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 858 "dhcp4_parser.cc" // lalr1.cc:907
+  case 36: // value: list_generic
+#line 286 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 870 "dhcp4_parser.cc"
     break;
 
-  case 37:
-#line 284 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 37: // sub_json: value
+#line 289 "dhcp4_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 867 "dhcp4_parser.cc" // lalr1.cc:907
+#line 879 "dhcp4_parser.cc"
     break;
 
-  case 38:
-#line 289 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 38: // $@15: %empty
+#line 294 "dhcp4_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 878 "dhcp4_parser.cc" // lalr1.cc:907
+#line 890 "dhcp4_parser.cc"
     break;
 
-  case 39:
-#line 294 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 39: // map2: "{" $@15 map_content "}"
+#line 299 "dhcp4_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 888 "dhcp4_parser.cc" // lalr1.cc:907
+#line 900 "dhcp4_parser.cc"
     break;
 
-  case 40:
-#line 300 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 894 "dhcp4_parser.cc" // lalr1.cc:907
+  case 40: // map_value: map2
+#line 305 "dhcp4_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 906 "dhcp4_parser.cc"
     break;
 
-  case 43:
-#line 307 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 43: // not_empty_map: "constant string" ":" value
+#line 312 "dhcp4_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 903 "dhcp4_parser.cc" // lalr1.cc:907
+#line 915 "dhcp4_parser.cc"
     break;
 
-  case 44:
-#line 311 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 44: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 316 "dhcp4_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 913 "dhcp4_parser.cc" // lalr1.cc:907
+#line 925 "dhcp4_parser.cc"
     break;
 
-  case 45:
-#line 318 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 45: // $@16: %empty
+#line 323 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 922 "dhcp4_parser.cc" // lalr1.cc:907
+#line 934 "dhcp4_parser.cc"
     break;
 
-  case 46:
-#line 321 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 46: // list_generic: "[" $@16 list_content "]"
+#line 326 "dhcp4_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 930 "dhcp4_parser.cc" // lalr1.cc:907
+#line 942 "dhcp4_parser.cc"
     break;
 
-  case 49:
-#line 329 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 49: // not_empty_list: value
+#line 334 "dhcp4_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 939 "dhcp4_parser.cc" // lalr1.cc:907
+#line 951 "dhcp4_parser.cc"
     break;
 
-  case 50:
-#line 333 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 50: // not_empty_list: not_empty_list "," value
+#line 338 "dhcp4_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 948 "dhcp4_parser.cc" // lalr1.cc:907
+#line 960 "dhcp4_parser.cc"
     break;
 
-  case 51:
-#line 340 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 51: // $@17: %empty
+#line 345 "dhcp4_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 956 "dhcp4_parser.cc" // lalr1.cc:907
+#line 968 "dhcp4_parser.cc"
     break;
 
-  case 52:
-#line 342 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 52: // list_strings: "[" $@17 list_strings_content "]"
+#line 347 "dhcp4_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 965 "dhcp4_parser.cc" // lalr1.cc:907
+#line 977 "dhcp4_parser.cc"
     break;
 
-  case 55:
-#line 351 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 55: // not_empty_list_strings: "constant string"
+#line 356 "dhcp4_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 974 "dhcp4_parser.cc" // lalr1.cc:907
+#line 986 "dhcp4_parser.cc"
     break;
 
-  case 56:
-#line 355 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 56: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 360 "dhcp4_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 983 "dhcp4_parser.cc" // lalr1.cc:907
+#line 995 "dhcp4_parser.cc"
     break;
 
-  case 57:
-#line 366 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 57: // unknown_map_entry: "constant string" ":"
+#line 371 "dhcp4_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 994 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1006 "dhcp4_parser.cc"
     break;
 
-  case 58:
-#line 376 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 58: // $@18: %empty
+#line 381 "dhcp4_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1005 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1017 "dhcp4_parser.cc"
     break;
 
-  case 59:
-#line 381 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 59: // syntax_map: "{" $@18 global_objects "}"
+#line 386 "dhcp4_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
@@ -1014,12 +1026,12 @@ namespace isc { namespace dhcp {
     // Dhcp4 is required
     ctx.require("Dhcp4", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 1018 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1030 "dhcp4_parser.cc"
     break;
 
-  case 68:
-#line 405 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 68: // $@19: %empty
+#line 410 "dhcp4_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1027,889 +1039,889 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP4);
 }
-#line 1031 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1043 "dhcp4_parser.cc"
     break;
 
-  case 69:
-#line 412 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 69: // dhcp4_object: "Dhcp4" $@19 ":" "{" global_params "}"
+#line 417 "dhcp4_parser.yy"
+                                                    {
     // No global parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1041 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1053 "dhcp4_parser.cc"
     break;
 
-  case 70:
-#line 420 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 70: // $@20: %empty
+#line 425 "dhcp4_parser.yy"
+                          {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1051 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1063 "dhcp4_parser.cc"
     break;
 
-  case 71:
-#line 424 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 71: // sub_dhcp4: "{" $@20 global_params "}"
+#line 429 "dhcp4_parser.yy"
+                               {
     // No global parameter is required
     // parsing completed
 }
-#line 1060 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1072 "dhcp4_parser.cc"
     break;
 
-  case 108:
-#line 471 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 108: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 476 "dhcp4_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 1069 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1081 "dhcp4_parser.cc"
     break;
 
-  case 109:
-#line 476 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 109: // renew_timer: "renew-timer" ":" "integer"
+#line 481 "dhcp4_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1078 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1090 "dhcp4_parser.cc"
     break;
 
-  case 110:
-#line 481 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 110: // rebind_timer: "rebind-timer" ":" "integer"
+#line 486 "dhcp4_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1087 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1099 "dhcp4_parser.cc"
     break;
 
-  case 111:
-#line 486 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 111: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 491 "dhcp4_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1096 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1108 "dhcp4_parser.cc"
     break;
 
-  case 112:
-#line 491 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 112: // $@21: %empty
+#line 496 "dhcp4_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1104 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1116 "dhcp4_parser.cc"
     break;
 
-  case 113:
-#line 493 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr stag(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 113: // server_tag: "server-tag" $@21 ":" "constant string"
+#line 498 "dhcp4_parser.yy"
+               {
+    ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1114 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1126 "dhcp4_parser.cc"
     break;
 
-  case 114:
-#line 499 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr echo(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 114: // echo_client_id: "echo-client-id" ":" "boolean"
+#line 504 "dhcp4_parser.yy"
+                                             {
+    ElementPtr echo(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
 }
-#line 1123 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1135 "dhcp4_parser.cc"
     break;
 
-  case 115:
-#line 504 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr match(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 115: // match_client_id: "match-client-id" ":" "boolean"
+#line 509 "dhcp4_parser.yy"
+                                               {
+    ElementPtr match(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
 }
-#line 1132 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1144 "dhcp4_parser.cc"
     break;
 
-  case 116:
-#line 509 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 116: // authoritative: "authoritative" ":" "boolean"
+#line 514 "dhcp4_parser.yy"
+                                           {
+    ElementPtr prf(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("authoritative", prf);
 }
-#line 1141 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1153 "dhcp4_parser.cc"
     break;
 
-  case 117:
-#line 515 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 117: // $@22: %empty
+#line 520 "dhcp4_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1152 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1164 "dhcp4_parser.cc"
     break;
 
-  case 118:
-#line 520 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 118: // interfaces_config: "interfaces-config" $@22 ":" "{" interfaces_config_params "}"
+#line 525 "dhcp4_parser.yy"
+                                                               {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1162 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1174 "dhcp4_parser.cc"
     break;
 
-  case 128:
-#line 539 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 128: // $@23: %empty
+#line 544 "dhcp4_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1172 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1184 "dhcp4_parser.cc"
     break;
 
-  case 129:
-#line 543 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 129: // sub_interfaces4: "{" $@23 interfaces_config_params "}"
+#line 548 "dhcp4_parser.yy"
+                                          {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1181 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1193 "dhcp4_parser.cc"
     break;
 
-  case 130:
-#line 548 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 130: // $@24: %empty
+#line 553 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1192 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1204 "dhcp4_parser.cc"
     break;
 
-  case 131:
-#line 553 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 131: // interfaces_list: "interfaces" $@24 ":" list_strings
+#line 558 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1201 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1213 "dhcp4_parser.cc"
     break;
 
-  case 132:
-#line 558 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 132: // $@25: %empty
+#line 563 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
-#line 1209 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1221 "dhcp4_parser.cc"
     break;
 
-  case 133:
-#line 560 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as< ElementPtr > ());
+  case 133: // dhcp_socket_type: "dhcp-socket-type" $@25 ":" socket_type
+#line 565 "dhcp4_parser.yy"
+                    {
+    ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1218 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1230 "dhcp4_parser.cc"
     break;
 
-  case 134:
-#line 565 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
-#line 1224 "dhcp4_parser.cc" // lalr1.cc:907
+  case 134: // socket_type: "raw"
+#line 570 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
+#line 1236 "dhcp4_parser.cc"
     break;
 
-  case 135:
-#line 566 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
-#line 1230 "dhcp4_parser.cc" // lalr1.cc:907
+  case 135: // socket_type: "udp"
+#line 571 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
+#line 1242 "dhcp4_parser.cc"
     break;
 
-  case 136:
-#line 569 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 136: // $@26: %empty
+#line 574 "dhcp4_parser.yy"
+                                       {
     ctx.enter(ctx.OUTBOUND_INTERFACE);
 }
-#line 1238 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1250 "dhcp4_parser.cc"
     break;
 
-  case 137:
-#line 571 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as< ElementPtr > ());
+  case 137: // outbound_interface: "outbound-interface" $@26 ":" outbound_interface_value
+#line 576 "dhcp4_parser.yy"
+                                 {
+    ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1247 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1259 "dhcp4_parser.cc"
     break;
 
-  case 138:
-#line 576 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
+  case 138: // outbound_interface_value: "same-as-inbound"
+#line 581 "dhcp4_parser.yy"
+                                          {
+    yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
 }
-#line 1255 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1267 "dhcp4_parser.cc"
     break;
 
-  case 139:
-#line 578 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
+  case 139: // outbound_interface_value: "use-routing"
+#line 583 "dhcp4_parser.yy"
+                {
+    yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
     }
-#line 1263 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1275 "dhcp4_parser.cc"
     break;
 
-  case 140:
-#line 582 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 140: // re_detect: "re-detect" ":" "boolean"
+#line 587 "dhcp4_parser.yy"
+                                   {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1272 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1284 "dhcp4_parser.cc"
     break;
 
-  case 141:
-#line 588 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 141: // $@27: %empty
+#line 593 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1283 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1295 "dhcp4_parser.cc"
     break;
 
-  case 142:
-#line 593 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 142: // lease_database: "lease-database" $@27 ":" "{" database_map_params "}"
+#line 598 "dhcp4_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1294 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1306 "dhcp4_parser.cc"
     break;
 
-  case 143:
-#line 600 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 143: // $@28: %empty
+#line 605 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1305 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1317 "dhcp4_parser.cc"
     break;
 
-  case 144:
-#line 605 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 144: // sanity_checks: "sanity-checks" $@28 ":" "{" sanity_checks_params "}"
+#line 610 "dhcp4_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1314 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1326 "dhcp4_parser.cc"
     break;
 
-  case 148:
-#line 615 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 148: // $@29: %empty
+#line 620 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1322 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1334 "dhcp4_parser.cc"
     break;
 
-  case 149:
-#line 617 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 149: // lease_checks: "lease-checks" $@29 ":" "constant string"
+#line 622 "dhcp4_parser.yy"
+               {
 
-    if ( (string(yystack_[0].value.as< std::string > ()) == "none") ||
-         (string(yystack_[0].value.as< std::string > ()) == "warn") ||
-         (string(yystack_[0].value.as< std::string > ()) == "fix") ||
-         (string(yystack_[0].value.as< std::string > ()) == "fix-del") ||
-         (string(yystack_[0].value.as< std::string > ()) == "del")) {
-        ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
+         (string(yystack_[0].value.as < std::string > ()) == "warn") ||
+         (string(yystack_[0].value.as < std::string > ()) == "fix") ||
+         (string(yystack_[0].value.as < std::string > ()) == "fix-del") ||
+         (string(yystack_[0].value.as < std::string > ()) == "del")) {
+        ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
         ctx.stack_.back()->set("lease-checks", user);
         ctx.leave();
     } else {
-        error(yystack_[0].location, "Unsupported 'lease-checks value: " + string(yystack_[0].value.as< std::string > ()) +
+        error(yystack_[0].location, "Unsupported 'lease-checks value: " + string(yystack_[0].value.as < std::string > ()) +
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1342 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1354 "dhcp4_parser.cc"
     break;
 
-  case 150:
-#line 633 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 150: // $@30: %empty
+#line 638 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1353 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1365 "dhcp4_parser.cc"
     break;
 
-  case 151:
-#line 638 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 151: // hosts_database: "hosts-database" $@30 ":" "{" database_map_params "}"
+#line 643 "dhcp4_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1364 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1376 "dhcp4_parser.cc"
     break;
 
-  case 152:
-#line 645 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 152: // $@31: %empty
+#line 650 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1375 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1387 "dhcp4_parser.cc"
     break;
 
-  case 153:
-#line 650 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 153: // hosts_databases: "hosts-databases" $@31 ":" "[" database_list "]"
+#line 655 "dhcp4_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1384 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1396 "dhcp4_parser.cc"
     break;
 
-  case 158:
-#line 663 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 158: // $@32: %empty
+#line 668 "dhcp4_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1394 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1406 "dhcp4_parser.cc"
     break;
 
-  case 159:
-#line 667 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 159: // database: "{" $@32 database_map_params "}"
+#line 672 "dhcp4_parser.yy"
+                                     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1404 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1416 "dhcp4_parser.cc"
     break;
 
-  case 180:
-#line 697 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 180: // $@33: %empty
+#line 702 "dhcp4_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1412 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1424 "dhcp4_parser.cc"
     break;
 
-  case 181:
-#line 699 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 181: // database_type: "type" $@33 ":" db_type
+#line 704 "dhcp4_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1421 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1433 "dhcp4_parser.cc"
     break;
 
-  case 182:
-#line 704 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1427 "dhcp4_parser.cc" // lalr1.cc:907
+  case 182: // db_type: "memfile"
+#line 709 "dhcp4_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1439 "dhcp4_parser.cc"
     break;
 
-  case 183:
-#line 705 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1433 "dhcp4_parser.cc" // lalr1.cc:907
+  case 183: // db_type: "mysql"
+#line 710 "dhcp4_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1445 "dhcp4_parser.cc"
     break;
 
-  case 184:
-#line 706 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1439 "dhcp4_parser.cc" // lalr1.cc:907
+  case 184: // db_type: "postgresql"
+#line 711 "dhcp4_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1451 "dhcp4_parser.cc"
     break;
 
-  case 185:
-#line 707 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1445 "dhcp4_parser.cc" // lalr1.cc:907
+  case 185: // db_type: "cql"
+#line 712 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1457 "dhcp4_parser.cc"
     break;
 
-  case 186:
-#line 710 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 186: // $@34: %empty
+#line 715 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1453 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1465 "dhcp4_parser.cc"
     break;
 
-  case 187:
-#line 712 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 187: // user: "user" $@34 ":" "constant string"
+#line 717 "dhcp4_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1463 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1475 "dhcp4_parser.cc"
     break;
 
-  case 188:
-#line 718 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 188: // $@35: %empty
+#line 723 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1471 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1483 "dhcp4_parser.cc"
     break;
 
-  case 189:
-#line 720 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 189: // password: "password" $@35 ":" "constant string"
+#line 725 "dhcp4_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1481 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1493 "dhcp4_parser.cc"
     break;
 
-  case 190:
-#line 726 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 190: // $@36: %empty
+#line 731 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1489 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1501 "dhcp4_parser.cc"
     break;
 
-  case 191:
-#line 728 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 191: // host: "host" $@36 ":" "constant string"
+#line 733 "dhcp4_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1499 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1511 "dhcp4_parser.cc"
     break;
 
-  case 192:
-#line 734 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 192: // port: "port" ":" "integer"
+#line 739 "dhcp4_parser.yy"
+                         {
+    ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1508 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1520 "dhcp4_parser.cc"
     break;
 
-  case 193:
-#line 739 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 193: // $@37: %empty
+#line 744 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1516 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1528 "dhcp4_parser.cc"
     break;
 
-  case 194:
-#line 741 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 194: // name: "name" $@37 ":" "constant string"
+#line 746 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1526 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1538 "dhcp4_parser.cc"
     break;
 
-  case 195:
-#line 747 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 195: // persist: "persist" ":" "boolean"
+#line 752 "dhcp4_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1535 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1547 "dhcp4_parser.cc"
     break;
 
-  case 196:
-#line 752 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 196: // lfc_interval: "lfc-interval" ":" "integer"
+#line 757 "dhcp4_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1544 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1556 "dhcp4_parser.cc"
     break;
 
-  case 197:
-#line 757 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 197: // readonly: "readonly" ":" "boolean"
+#line 762 "dhcp4_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1553 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1565 "dhcp4_parser.cc"
     break;
 
-  case 198:
-#line 762 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 198: // connect_timeout: "connect-timeout" ":" "integer"
+#line 767 "dhcp4_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1562 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1574 "dhcp4_parser.cc"
     break;
 
-  case 199:
-#line 767 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 199: // request_timeout: "request-timeout" ":" "integer"
+#line 772 "dhcp4_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1571 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1583 "dhcp4_parser.cc"
     break;
 
-  case 200:
-#line 772 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 200: // tcp_keepalive: "tcp-keepalive" ":" "integer"
+#line 777 "dhcp4_parser.yy"
+                                           {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1580 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1592 "dhcp4_parser.cc"
     break;
 
-  case 201:
-#line 777 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 201: // tcp_nodelay: "tcp-nodelay" ":" "boolean"
+#line 782 "dhcp4_parser.yy"
+                                       {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1589 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1601 "dhcp4_parser.cc"
     break;
 
-  case 202:
-#line 782 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 202: // $@38: %empty
+#line 787 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1597 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1609 "dhcp4_parser.cc"
     break;
 
-  case 203:
-#line 784 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 203: // contact_points: "contact-points" $@38 ":" "constant string"
+#line 789 "dhcp4_parser.yy"
+               {
+    ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1607 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1619 "dhcp4_parser.cc"
     break;
 
-  case 204:
-#line 790 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 204: // $@39: %empty
+#line 795 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1615 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1627 "dhcp4_parser.cc"
     break;
 
-  case 205:
-#line 792 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 205: // keyspace: "keyspace" $@39 ":" "constant string"
+#line 797 "dhcp4_parser.yy"
+               {
+    ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1625 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1637 "dhcp4_parser.cc"
     break;
 
-  case 206:
-#line 798 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 206: // max_reconnect_tries: "max-reconnect-tries" ":" "integer"
+#line 803 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1634 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1646 "dhcp4_parser.cc"
     break;
 
-  case 207:
-#line 803 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 207: // reconnect_wait_time: "reconnect-wait-time" ":" "integer"
+#line 808 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1643 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1655 "dhcp4_parser.cc"
     break;
 
-  case 208:
-#line 808 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 208: // $@40: %empty
+#line 813 "dhcp4_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1654 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1666 "dhcp4_parser.cc"
     break;
 
-  case 209:
-#line 813 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 209: // host_reservation_identifiers: "host-reservation-identifiers" $@40 ":" "[" host_reservation_identifiers_list "]"
+#line 818 "dhcp4_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1663 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1675 "dhcp4_parser.cc"
     break;
 
-  case 217:
-#line 829 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 217: // duid_id: "duid"
+#line 834 "dhcp4_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1672 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1684 "dhcp4_parser.cc"
     break;
 
-  case 218:
-#line 834 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 218: // hw_address_id: "hw-address"
+#line 839 "dhcp4_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1681 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1693 "dhcp4_parser.cc"
     break;
 
-  case 219:
-#line 839 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 219: // circuit_id: "circuit-id"
+#line 844 "dhcp4_parser.yy"
+                        {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1690 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1702 "dhcp4_parser.cc"
     break;
 
-  case 220:
-#line 844 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 220: // client_id: "client-id"
+#line 849 "dhcp4_parser.yy"
+                      {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1699 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1711 "dhcp4_parser.cc"
     break;
 
-  case 221:
-#line 849 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 221: // flex_id: "flex-id"
+#line 854 "dhcp4_parser.yy"
+                 {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1708 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1720 "dhcp4_parser.cc"
     break;
 
-  case 222:
-#line 854 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 222: // $@41: %empty
+#line 859 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1719 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1731 "dhcp4_parser.cc"
     break;
 
-  case 223:
-#line 859 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 223: // hooks_libraries: "hooks-libraries" $@41 ":" "[" hooks_libraries_list "]"
+#line 864 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1728 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1740 "dhcp4_parser.cc"
     break;
 
-  case 228:
-#line 872 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 228: // $@42: %empty
+#line 877 "dhcp4_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1738 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1750 "dhcp4_parser.cc"
     break;
 
-  case 229:
-#line 876 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 229: // hooks_library: "{" $@42 hooks_params "}"
+#line 881 "dhcp4_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1748 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1760 "dhcp4_parser.cc"
     break;
 
-  case 230:
-#line 882 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 230: // $@43: %empty
+#line 887 "dhcp4_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1758 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1770 "dhcp4_parser.cc"
     break;
 
-  case 231:
-#line 886 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 231: // sub_hooks_library: "{" $@43 hooks_params "}"
+#line 891 "dhcp4_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1768 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1780 "dhcp4_parser.cc"
     break;
 
-  case 237:
-#line 901 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 237: // $@44: %empty
+#line 906 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1776 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1788 "dhcp4_parser.cc"
     break;
 
-  case 238:
-#line 903 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 238: // library: "library" $@44 ":" "constant string"
+#line 908 "dhcp4_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1786 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1798 "dhcp4_parser.cc"
     break;
 
-  case 239:
-#line 909 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 239: // $@45: %empty
+#line 914 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1794 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1806 "dhcp4_parser.cc"
     break;
 
-  case 240:
-#line 911 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 240: // parameters: "parameters" $@45 ":" value
+#line 916 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1803 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1815 "dhcp4_parser.cc"
     break;
 
-  case 241:
-#line 917 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 241: // $@46: %empty
+#line 922 "dhcp4_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1814 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1826 "dhcp4_parser.cc"
     break;
 
-  case 242:
-#line 922 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 242: // expired_leases_processing: "expired-leases-processing" $@46 ":" "{" expired_leases_params "}"
+#line 927 "dhcp4_parser.yy"
+                                                            {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1824 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1836 "dhcp4_parser.cc"
     break;
 
-  case 251:
-#line 940 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 251: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 945 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1833 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1845 "dhcp4_parser.cc"
     break;
 
-  case 252:
-#line 945 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 252: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 950 "dhcp4_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1842 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1854 "dhcp4_parser.cc"
     break;
 
-  case 253:
-#line 950 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 253: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 955 "dhcp4_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1851 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1863 "dhcp4_parser.cc"
     break;
 
-  case 254:
-#line 955 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 254: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 960 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1860 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1872 "dhcp4_parser.cc"
     break;
 
-  case 255:
-#line 960 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 255: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 965 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1869 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1881 "dhcp4_parser.cc"
     break;
 
-  case 256:
-#line 965 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 256: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 970 "dhcp4_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1878 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1890 "dhcp4_parser.cc"
     break;
 
-  case 257:
-#line 973 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 257: // $@47: %empty
+#line 978 "dhcp4_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 1889 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1901 "dhcp4_parser.cc"
     break;
 
-  case 258:
-#line 978 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 258: // subnet4_list: "subnet4" $@47 ":" "[" subnet4_list_content "]"
+#line 983 "dhcp4_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1898 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1910 "dhcp4_parser.cc"
     break;
 
-  case 263:
-#line 998 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 263: // $@48: %empty
+#line 1003 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1908 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1920 "dhcp4_parser.cc"
     break;
 
-  case 264:
-#line 1002 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 264: // subnet4: "{" $@48 subnet4_params "}"
+#line 1007 "dhcp4_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1930,601 +1942,601 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1934 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1946 "dhcp4_parser.cc"
     break;
 
-  case 265:
-#line 1024 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 265: // $@49: %empty
+#line 1029 "dhcp4_parser.yy"
+                            {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1944 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1956 "dhcp4_parser.cc"
     break;
 
-  case 266:
-#line 1028 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 266: // sub_subnet4: "{" $@49 subnet4_params "}"
+#line 1033 "dhcp4_parser.yy"
+                                {
     // The subnet subnet4 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1954 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1966 "dhcp4_parser.cc"
     break;
 
-  case 293:
-#line 1066 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 293: // $@50: %empty
+#line 1071 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1962 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1974 "dhcp4_parser.cc"
     break;
 
-  case 294:
-#line 1068 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 294: // subnet: "subnet" $@50 ":" "constant string"
+#line 1073 "dhcp4_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1972 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1984 "dhcp4_parser.cc"
     break;
 
-  case 295:
-#line 1074 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 295: // $@51: %empty
+#line 1079 "dhcp4_parser.yy"
+                                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1980 "dhcp4_parser.cc" // lalr1.cc:907
+#line 1992 "dhcp4_parser.cc"
     break;
 
-  case 296:
-#line 1076 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 296: // subnet_4o6_interface: "4o6-interface" $@51 ":" "constant string"
+#line 1081 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 1990 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2002 "dhcp4_parser.cc"
     break;
 
-  case 297:
-#line 1082 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 297: // $@52: %empty
+#line 1087 "dhcp4_parser.yy"
+                                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1998 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2010 "dhcp4_parser.cc"
     break;
 
-  case 298:
-#line 1084 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 298: // subnet_4o6_interface_id: "4o6-interface-id" $@52 ":" "constant string"
+#line 1089 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 2008 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2020 "dhcp4_parser.cc"
     break;
 
-  case 299:
-#line 1090 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 299: // $@53: %empty
+#line 1095 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2016 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2028 "dhcp4_parser.cc"
     break;
 
-  case 300:
-#line 1092 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 300: // subnet_4o6_subnet: "4o6-subnet" $@53 ":" "constant string"
+#line 1097 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 2026 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2038 "dhcp4_parser.cc"
     break;
 
-  case 301:
-#line 1098 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 301: // $@54: %empty
+#line 1103 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2034 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2046 "dhcp4_parser.cc"
     break;
 
-  case 302:
-#line 1100 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 302: // interface: "interface" $@54 ":" "constant string"
+#line 1105 "dhcp4_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 2044 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2056 "dhcp4_parser.cc"
     break;
 
-  case 303:
-#line 1106 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 303: // $@55: %empty
+#line 1111 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2052 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2064 "dhcp4_parser.cc"
     break;
 
-  case 304:
-#line 1108 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 304: // client_class: "client-class" $@55 ":" "constant string"
+#line 1113 "dhcp4_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 2062 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2074 "dhcp4_parser.cc"
     break;
 
-  case 305:
-#line 1114 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 305: // $@56: %empty
+#line 1119 "dhcp4_parser.yy"
+                                               {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2073 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2085 "dhcp4_parser.cc"
     break;
 
-  case 306:
-#line 1119 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 306: // require_client_classes: "require-client-classes" $@56 ":" list_strings
+#line 1124 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2082 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2094 "dhcp4_parser.cc"
     break;
 
-  case 307:
-#line 1124 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 307: // $@57: %empty
+#line 1129 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2090 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2102 "dhcp4_parser.cc"
     break;
 
-  case 308:
-#line 1126 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
+  case 308: // reservation_mode: "reservation-mode" $@57 ":" hr_mode
+#line 1131 "dhcp4_parser.yy"
+                {
+    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2099 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2111 "dhcp4_parser.cc"
     break;
 
-  case 309:
-#line 1131 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2105 "dhcp4_parser.cc" // lalr1.cc:907
+  case 309: // hr_mode: "disabled"
+#line 1136 "dhcp4_parser.yy"
+                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
+#line 2117 "dhcp4_parser.cc"
     break;
 
-  case 310:
-#line 1132 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2111 "dhcp4_parser.cc" // lalr1.cc:907
+  case 310: // hr_mode: "out-of-pool"
+#line 1137 "dhcp4_parser.yy"
+                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
+#line 2123 "dhcp4_parser.cc"
     break;
 
-  case 311:
-#line 1133 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2117 "dhcp4_parser.cc" // lalr1.cc:907
+  case 311: // hr_mode: "global"
+#line 1138 "dhcp4_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
+#line 2129 "dhcp4_parser.cc"
     break;
 
-  case 312:
-#line 1134 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2123 "dhcp4_parser.cc" // lalr1.cc:907
+  case 312: // hr_mode: "all"
+#line 1139 "dhcp4_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
+#line 2135 "dhcp4_parser.cc"
     break;
 
-  case 313:
-#line 1137 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 313: // id: "id" ":" "integer"
+#line 1142 "dhcp4_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2132 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2144 "dhcp4_parser.cc"
     break;
 
-  case 314:
-#line 1144 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 314: // $@58: %empty
+#line 1149 "dhcp4_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2143 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2155 "dhcp4_parser.cc"
     break;
 
-  case 315:
-#line 1149 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 315: // shared_networks: "shared-networks" $@58 ":" "[" shared_networks_content "]"
+#line 1154 "dhcp4_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2152 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2164 "dhcp4_parser.cc"
     break;
 
-  case 320:
-#line 1164 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 320: // $@59: %empty
+#line 1169 "dhcp4_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2162 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2174 "dhcp4_parser.cc"
     break;
 
-  case 321:
-#line 1168 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 321: // shared_network: "{" $@59 shared_network_params "}"
+#line 1173 "dhcp4_parser.yy"
+                                       {
     ctx.stack_.pop_back();
 }
-#line 2170 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2182 "dhcp4_parser.cc"
     break;
 
-  case 343:
-#line 1201 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 343: // $@60: %empty
+#line 1206 "dhcp4_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2181 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2193 "dhcp4_parser.cc"
     break;
 
-  case 344:
-#line 1206 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 344: // option_def_list: "option-def" $@60 ":" "[" option_def_list_content "]"
+#line 1211 "dhcp4_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2190 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2202 "dhcp4_parser.cc"
     break;
 
-  case 345:
-#line 1214 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 345: // $@61: %empty
+#line 1219 "dhcp4_parser.yy"
+                                    {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2199 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2211 "dhcp4_parser.cc"
     break;
 
-  case 346:
-#line 1217 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 346: // sub_option_def_list: "{" $@61 option_def_list "}"
+#line 1222 "dhcp4_parser.yy"
+                                 {
     // parsing completed
 }
-#line 2207 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2219 "dhcp4_parser.cc"
     break;
 
-  case 351:
-#line 1233 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 351: // $@62: %empty
+#line 1238 "dhcp4_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2217 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2229 "dhcp4_parser.cc"
     break;
 
-  case 352:
-#line 1237 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 352: // option_def_entry: "{" $@62 option_def_params "}"
+#line 1242 "dhcp4_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2229 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2241 "dhcp4_parser.cc"
     break;
 
-  case 353:
-#line 1248 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 353: // $@63: %empty
+#line 1253 "dhcp4_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2239 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2251 "dhcp4_parser.cc"
     break;
 
-  case 354:
-#line 1252 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 354: // sub_option_def: "{" $@63 option_def_params "}"
+#line 1257 "dhcp4_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2251 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2263 "dhcp4_parser.cc"
     break;
 
-  case 370:
-#line 1284 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 370: // code: "code" ":" "integer"
+#line 1289 "dhcp4_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2260 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2272 "dhcp4_parser.cc"
     break;
 
-  case 372:
-#line 1291 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 372: // $@64: %empty
+#line 1296 "dhcp4_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2268 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2280 "dhcp4_parser.cc"
     break;
 
-  case 373:
-#line 1293 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 373: // option_def_type: "type" $@64 ":" "constant string"
+#line 1298 "dhcp4_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2278 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2290 "dhcp4_parser.cc"
     break;
 
-  case 374:
-#line 1299 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 374: // $@65: %empty
+#line 1304 "dhcp4_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2286 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2298 "dhcp4_parser.cc"
     break;
 
-  case 375:
-#line 1301 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 375: // option_def_record_types: "record-types" $@65 ":" "constant string"
+#line 1306 "dhcp4_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2296 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2308 "dhcp4_parser.cc"
     break;
 
-  case 376:
-#line 1307 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 376: // $@66: %empty
+#line 1312 "dhcp4_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2304 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2316 "dhcp4_parser.cc"
     break;
 
-  case 377:
-#line 1309 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 377: // space: "space" $@66 ":" "constant string"
+#line 1314 "dhcp4_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2314 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2326 "dhcp4_parser.cc"
     break;
 
-  case 379:
-#line 1317 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 379: // $@67: %empty
+#line 1322 "dhcp4_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2322 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2334 "dhcp4_parser.cc"
     break;
 
-  case 380:
-#line 1319 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 380: // option_def_encapsulate: "encapsulate" $@67 ":" "constant string"
+#line 1324 "dhcp4_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2332 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2344 "dhcp4_parser.cc"
     break;
 
-  case 381:
-#line 1325 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 381: // option_def_array: "array" ":" "boolean"
+#line 1330 "dhcp4_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2341 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2353 "dhcp4_parser.cc"
     break;
 
-  case 382:
-#line 1334 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 382: // $@68: %empty
+#line 1339 "dhcp4_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2352 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2364 "dhcp4_parser.cc"
     break;
 
-  case 383:
-#line 1339 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 383: // option_data_list: "option-data" $@68 ":" "[" option_data_list_content "]"
+#line 1344 "dhcp4_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2361 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2373 "dhcp4_parser.cc"
     break;
 
-  case 388:
-#line 1358 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 388: // $@69: %empty
+#line 1363 "dhcp4_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2371 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2383 "dhcp4_parser.cc"
     break;
 
-  case 389:
-#line 1362 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 389: // option_data_entry: "{" $@69 option_data_params "}"
+#line 1367 "dhcp4_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2380 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2392 "dhcp4_parser.cc"
     break;
 
-  case 390:
-#line 1370 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 390: // $@70: %empty
+#line 1375 "dhcp4_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2390 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2402 "dhcp4_parser.cc"
     break;
 
-  case 391:
-#line 1374 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 391: // sub_option_data: "{" $@70 option_data_params "}"
+#line 1379 "dhcp4_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2399 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2411 "dhcp4_parser.cc"
     break;
 
-  case 406:
-#line 1407 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 406: // $@71: %empty
+#line 1412 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2407 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2419 "dhcp4_parser.cc"
     break;
 
-  case 407:
-#line 1409 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 407: // option_data_data: "data" $@71 ":" "constant string"
+#line 1414 "dhcp4_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2417 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2429 "dhcp4_parser.cc"
     break;
 
-  case 410:
-#line 1419 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 410: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1424 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2426 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2438 "dhcp4_parser.cc"
     break;
 
-  case 411:
-#line 1424 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 411: // option_data_always_send: "always-send" ":" "boolean"
+#line 1429 "dhcp4_parser.yy"
+                                                   {
+    ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2435 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2447 "dhcp4_parser.cc"
     break;
 
-  case 412:
-#line 1432 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 412: // $@72: %empty
+#line 1437 "dhcp4_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2446 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2458 "dhcp4_parser.cc"
     break;
 
-  case 413:
-#line 1437 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 413: // pools_list: "pools" $@72 ":" "[" pools_list_content "]"
+#line 1442 "dhcp4_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2455 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2467 "dhcp4_parser.cc"
     break;
 
-  case 418:
-#line 1452 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 418: // $@73: %empty
+#line 1457 "dhcp4_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2465 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2477 "dhcp4_parser.cc"
     break;
 
-  case 419:
-#line 1456 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 419: // pool_list_entry: "{" $@73 pool_params "}"
+#line 1461 "dhcp4_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2475 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2487 "dhcp4_parser.cc"
     break;
 
-  case 420:
-#line 1462 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 420: // $@74: %empty
+#line 1467 "dhcp4_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2485 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2497 "dhcp4_parser.cc"
     break;
 
-  case 421:
-#line 1466 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 421: // sub_pool4: "{" $@74 pool_params "}"
+#line 1471 "dhcp4_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2495 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2507 "dhcp4_parser.cc"
     break;
 
-  case 431:
-#line 1485 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 431: // $@75: %empty
+#line 1490 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2503 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2515 "dhcp4_parser.cc"
     break;
 
-  case 432:
-#line 1487 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 432: // pool_entry: "pool" $@75 ":" "constant string"
+#line 1492 "dhcp4_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2513 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2525 "dhcp4_parser.cc"
     break;
 
-  case 433:
-#line 1493 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 433: // $@76: %empty
+#line 1498 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2521 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2533 "dhcp4_parser.cc"
     break;
 
-  case 434:
-#line 1495 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 434: // user_context: "user-context" $@76 ":" map_value
+#line 1500 "dhcp4_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
-    ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
+    ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
 
     // Handle already existing user context
@@ -2544,23 +2556,23 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2548 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2560 "dhcp4_parser.cc"
     break;
 
-  case 435:
-#line 1518 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 435: // $@77: %empty
+#line 1523 "dhcp4_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2556 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2568 "dhcp4_parser.cc"
     break;
 
-  case 436:
-#line 1520 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 436: // comment: "comment" $@77 ":" "constant string"
+#line 1525 "dhcp4_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
-    ElementPtr comment(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     user_context->set("comment", comment);
 
     // Handle already existing user context
@@ -2581,451 +2593,451 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2585 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2597 "dhcp4_parser.cc"
     break;
 
-  case 437:
-#line 1548 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 437: // $@78: %empty
+#line 1553 "dhcp4_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2596 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2608 "dhcp4_parser.cc"
     break;
 
-  case 438:
-#line 1553 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 438: // reservations: "reservations" $@78 ":" "[" reservations_list "]"
+#line 1558 "dhcp4_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2605 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2617 "dhcp4_parser.cc"
     break;
 
-  case 443:
-#line 1566 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 443: // $@79: %empty
+#line 1571 "dhcp4_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2615 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2627 "dhcp4_parser.cc"
     break;
 
-  case 444:
-#line 1570 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 444: // reservation: "{" $@79 reservation_params "}"
+#line 1575 "dhcp4_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2624 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2636 "dhcp4_parser.cc"
     break;
 
-  case 445:
-#line 1575 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 445: // $@80: %empty
+#line 1580 "dhcp4_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2634 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2646 "dhcp4_parser.cc"
     break;
 
-  case 446:
-#line 1579 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 446: // sub_reservation: "{" $@80 reservation_params "}"
+#line 1584 "dhcp4_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2643 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2655 "dhcp4_parser.cc"
     break;
 
-  case 466:
-#line 1610 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 466: // $@81: %empty
+#line 1615 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2651 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2663 "dhcp4_parser.cc"
     break;
 
-  case 467:
-#line 1612 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr next_server(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 467: // next_server: "next-server" $@81 ":" "constant string"
+#line 1617 "dhcp4_parser.yy"
+               {
+    ElementPtr next_server(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2661 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2673 "dhcp4_parser.cc"
     break;
 
-  case 468:
-#line 1618 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 468: // $@82: %empty
+#line 1623 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2669 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2681 "dhcp4_parser.cc"
     break;
 
-  case 469:
-#line 1620 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr srv(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 469: // server_hostname: "server-hostname" $@82 ":" "constant string"
+#line 1625 "dhcp4_parser.yy"
+               {
+    ElementPtr srv(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2679 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2691 "dhcp4_parser.cc"
     break;
 
-  case 470:
-#line 1626 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 470: // $@83: %empty
+#line 1631 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2687 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2699 "dhcp4_parser.cc"
     break;
 
-  case 471:
-#line 1628 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr bootfile(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 471: // boot_file_name: "boot-file-name" $@83 ":" "constant string"
+#line 1633 "dhcp4_parser.yy"
+               {
+    ElementPtr bootfile(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2697 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2709 "dhcp4_parser.cc"
     break;
 
-  case 472:
-#line 1634 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 472: // $@84: %empty
+#line 1639 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2705 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2717 "dhcp4_parser.cc"
     break;
 
-  case 473:
-#line 1636 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 473: // ip_address: "ip-address" $@84 ":" "constant string"
+#line 1641 "dhcp4_parser.yy"
+               {
+    ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2715 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2727 "dhcp4_parser.cc"
     break;
 
-  case 474:
-#line 1642 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 474: // $@85: %empty
+#line 1647 "dhcp4_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2726 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2738 "dhcp4_parser.cc"
     break;
 
-  case 475:
-#line 1647 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 475: // ip_addresses: "ip-addresses" $@85 ":" list_strings
+#line 1652 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2735 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2747 "dhcp4_parser.cc"
     break;
 
-  case 476:
-#line 1652 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 476: // $@86: %empty
+#line 1657 "dhcp4_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2743 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2755 "dhcp4_parser.cc"
     break;
 
-  case 477:
-#line 1654 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 477: // duid: "duid" $@86 ":" "constant string"
+#line 1659 "dhcp4_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2753 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2765 "dhcp4_parser.cc"
     break;
 
-  case 478:
-#line 1660 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 478: // $@87: %empty
+#line 1665 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2761 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2773 "dhcp4_parser.cc"
     break;
 
-  case 479:
-#line 1662 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 479: // hw_address: "hw-address" $@87 ":" "constant string"
+#line 1667 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2771 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2783 "dhcp4_parser.cc"
     break;
 
-  case 480:
-#line 1668 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 480: // $@88: %empty
+#line 1673 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2779 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2791 "dhcp4_parser.cc"
     break;
 
-  case 481:
-#line 1670 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 481: // client_id_value: "client-id" $@88 ":" "constant string"
+#line 1675 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 2789 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2801 "dhcp4_parser.cc"
     break;
 
-  case 482:
-#line 1676 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 482: // $@89: %empty
+#line 1681 "dhcp4_parser.yy"
+                             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2797 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2809 "dhcp4_parser.cc"
     break;
 
-  case 483:
-#line 1678 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 483: // circuit_id_value: "circuit-id" $@89 ":" "constant string"
+#line 1683 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 2807 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2819 "dhcp4_parser.cc"
     break;
 
-  case 484:
-#line 1684 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 484: // $@90: %empty
+#line 1689 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2815 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2827 "dhcp4_parser.cc"
     break;
 
-  case 485:
-#line 1686 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 485: // flex_id_value: "flex-id" $@90 ":" "constant string"
+#line 1691 "dhcp4_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2825 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2837 "dhcp4_parser.cc"
     break;
 
-  case 486:
-#line 1692 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 486: // $@91: %empty
+#line 1697 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2833 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2845 "dhcp4_parser.cc"
     break;
 
-  case 487:
-#line 1694 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 487: // hostname: "hostname" $@91 ":" "constant string"
+#line 1699 "dhcp4_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2843 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2855 "dhcp4_parser.cc"
     break;
 
-  case 488:
-#line 1700 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 488: // $@92: %empty
+#line 1705 "dhcp4_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2854 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2866 "dhcp4_parser.cc"
     break;
 
-  case 489:
-#line 1705 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 489: // reservation_client_classes: "client-classes" $@92 ":" list_strings
+#line 1710 "dhcp4_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2863 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2875 "dhcp4_parser.cc"
     break;
 
-  case 490:
-#line 1713 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 490: // $@93: %empty
+#line 1718 "dhcp4_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2874 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2886 "dhcp4_parser.cc"
     break;
 
-  case 491:
-#line 1718 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 491: // relay: "relay" $@93 ":" "{" relay_map "}"
+#line 1723 "dhcp4_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2883 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2895 "dhcp4_parser.cc"
     break;
 
-  case 494:
-#line 1730 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 494: // $@94: %empty
+#line 1735 "dhcp4_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2894 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2906 "dhcp4_parser.cc"
     break;
 
-  case 495:
-#line 1735 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 495: // client_classes: "client-classes" $@94 ":" "[" client_classes_list "]"
+#line 1740 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2903 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2915 "dhcp4_parser.cc"
     break;
 
-  case 498:
-#line 1744 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 498: // $@95: %empty
+#line 1749 "dhcp4_parser.yy"
+                                   {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2913 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2925 "dhcp4_parser.cc"
     break;
 
-  case 499:
-#line 1748 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 499: // client_class_entry: "{" $@95 client_class_params "}"
+#line 1753 "dhcp4_parser.yy"
+                                     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2923 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2935 "dhcp4_parser.cc"
     break;
 
-  case 516:
-#line 1777 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 516: // $@96: %empty
+#line 1782 "dhcp4_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2931 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2943 "dhcp4_parser.cc"
     break;
 
-  case 517:
-#line 1779 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 517: // client_class_test: "test" $@96 ":" "constant string"
+#line 1784 "dhcp4_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2941 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2953 "dhcp4_parser.cc"
     break;
 
-  case 518:
-#line 1785 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 518: // only_if_required: "only-if-required" ":" "boolean"
+#line 1790 "dhcp4_parser.yy"
+                                                 {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 2950 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2962 "dhcp4_parser.cc"
     break;
 
-  case 519:
-#line 1794 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 519: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1799 "dhcp4_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2959 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2971 "dhcp4_parser.cc"
     break;
 
-  case 520:
-#line 1801 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 520: // $@97: %empty
+#line 1806 "dhcp4_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2970 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2982 "dhcp4_parser.cc"
     break;
 
-  case 521:
-#line 1806 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 521: // control_socket: "control-socket" $@97 ":" "{" control_socket_params "}"
+#line 1811 "dhcp4_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2979 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2991 "dhcp4_parser.cc"
     break;
 
-  case 529:
-#line 1822 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 529: // $@98: %empty
+#line 1827 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2987 "dhcp4_parser.cc" // lalr1.cc:907
+#line 2999 "dhcp4_parser.cc"
     break;
 
-  case 530:
-#line 1824 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 530: // control_socket_type: "socket-type" $@98 ":" "constant string"
+#line 1829 "dhcp4_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2997 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3009 "dhcp4_parser.cc"
     break;
 
-  case 531:
-#line 1830 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 531: // $@99: %empty
+#line 1835 "dhcp4_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3005 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3017 "dhcp4_parser.cc"
     break;
 
-  case 532:
-#line 1832 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 532: // control_socket_name: "socket-name" $@99 ":" "constant string"
+#line 1837 "dhcp4_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3015 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3027 "dhcp4_parser.cc"
     break;
 
-  case 533:
-#line 1841 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 533: // $@100: %empty
+#line 1846 "dhcp4_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3023 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3035 "dhcp4_parser.cc"
     break;
 
-  case 534:
-#line 1843 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr qc = yystack_[0].value.as< ElementPtr > ();
+  case 534: // dhcp_queue_control: "dhcp-queue-control" $@100 ":" map_value
+#line 1848 "dhcp4_parser.yy"
+                  {
+    ElementPtr qc = yystack_[0].value.as < ElementPtr > ();
     ctx.stack_.back()->set("dhcp-queue-control", qc);
 
     // Doing this manually, because dhcp-queue-control
@@ -3057,617 +3069,681 @@ namespace isc { namespace dhcp {
 
     ctx.leave();
 }
-#line 3061 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3073 "dhcp4_parser.cc"
     break;
 
-  case 535:
-#line 1879 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 535: // $@101: %empty
+#line 1884 "dhcp4_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3072 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3084 "dhcp4_parser.cc"
     break;
 
-  case 536:
-#line 1884 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 536: // dhcp_ddns: "dhcp-ddns" $@101 ":" "{" dhcp_ddns_params "}"
+#line 1889 "dhcp4_parser.yy"
+                                                       {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3083 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3095 "dhcp4_parser.cc"
     break;
 
-  case 537:
-#line 1891 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 537: // $@102: %empty
+#line 1896 "dhcp4_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3093 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3105 "dhcp4_parser.cc"
     break;
 
-  case 538:
-#line 1895 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 538: // sub_dhcp_ddns: "{" $@102 dhcp_ddns_params "}"
+#line 1900 "dhcp4_parser.yy"
+                                  {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3103 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3115 "dhcp4_parser.cc"
     break;
 
-  case 559:
-#line 1925 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 559: // enable_updates: "enable-updates" ":" "boolean"
+#line 1930 "dhcp4_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3112 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3124 "dhcp4_parser.cc"
     break;
 
-  case 560:
-#line 1930 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 560: // $@103: %empty
+#line 1935 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3120 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3132 "dhcp4_parser.cc"
     break;
 
-  case 561:
-#line 1932 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 561: // qualifying_suffix: "qualifying-suffix" $@103 ":" "constant string"
+#line 1937 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3130 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3142 "dhcp4_parser.cc"
     break;
 
-  case 562:
-#line 1938 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 562: // $@104: %empty
+#line 1943 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3138 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3150 "dhcp4_parser.cc"
     break;
 
-  case 563:
-#line 1940 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 563: // server_ip: "server-ip" $@104 ":" "constant string"
+#line 1945 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3148 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3160 "dhcp4_parser.cc"
     break;
 
-  case 564:
-#line 1946 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 564: // server_port: "server-port" ":" "integer"
+#line 1951 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3157 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3169 "dhcp4_parser.cc"
     break;
 
-  case 565:
-#line 1951 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 565: // $@105: %empty
+#line 1956 "dhcp4_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3165 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3177 "dhcp4_parser.cc"
     break;
 
-  case 566:
-#line 1953 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 566: // sender_ip: "sender-ip" $@105 ":" "constant string"
+#line 1958 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3175 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3187 "dhcp4_parser.cc"
     break;
 
-  case 567:
-#line 1959 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 567: // sender_port: "sender-port" ":" "integer"
+#line 1964 "dhcp4_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3184 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3196 "dhcp4_parser.cc"
     break;
 
-  case 568:
-#line 1964 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 568: // max_queue_size: "max-queue-size" ":" "integer"
+#line 1969 "dhcp4_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3193 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3205 "dhcp4_parser.cc"
     break;
 
-  case 569:
-#line 1969 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 569: // $@106: %empty
+#line 1974 "dhcp4_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3201 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3213 "dhcp4_parser.cc"
     break;
 
-  case 570:
-#line 1971 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 570: // ncr_protocol: "ncr-protocol" $@106 ":" ncr_protocol_value
+#line 1976 "dhcp4_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3210 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3222 "dhcp4_parser.cc"
     break;
 
-  case 571:
-#line 1977 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3216 "dhcp4_parser.cc" // lalr1.cc:907
+  case 571: // ncr_protocol_value: "udp"
+#line 1982 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 3228 "dhcp4_parser.cc"
     break;
 
-  case 572:
-#line 1978 "dhcp4_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3222 "dhcp4_parser.cc" // lalr1.cc:907
+  case 572: // ncr_protocol_value: "tcp"
+#line 1983 "dhcp4_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 3234 "dhcp4_parser.cc"
     break;
 
-  case 573:
-#line 1981 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 573: // $@107: %empty
+#line 1986 "dhcp4_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3230 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3242 "dhcp4_parser.cc"
     break;
 
-  case 574:
-#line 1983 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 574: // ncr_format: "ncr-format" $@107 ":" "JSON"
+#line 1988 "dhcp4_parser.yy"
+             {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3240 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3252 "dhcp4_parser.cc"
     break;
 
-  case 575:
-#line 1989 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 575: // override_no_update: "override-no-update" ":" "boolean"
+#line 1994 "dhcp4_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3249 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3261 "dhcp4_parser.cc"
     break;
 
-  case 576:
-#line 1994 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 576: // override_client_update: "override-client-update" ":" "boolean"
+#line 1999 "dhcp4_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3258 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3270 "dhcp4_parser.cc"
     break;
 
-  case 577:
-#line 1999 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 577: // $@108: %empty
+#line 2004 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3266 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3278 "dhcp4_parser.cc"
     break;
 
-  case 578:
-#line 2001 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 578: // replace_client_name: "replace-client-name" $@108 ":" replace_client_name_value
+#line 2006 "dhcp4_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3275 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3287 "dhcp4_parser.cc"
     break;
 
-  case 579:
-#line 2007 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
+  case 579: // replace_client_name_value: "when-present"
+#line 2012 "dhcp4_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3283 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3295 "dhcp4_parser.cc"
     break;
 
-  case 580:
-#line 2010 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 580: // replace_client_name_value: "never"
+#line 2015 "dhcp4_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3291 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3303 "dhcp4_parser.cc"
     break;
 
-  case 581:
-#line 2013 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 581: // replace_client_name_value: "always"
+#line 2018 "dhcp4_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3299 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3311 "dhcp4_parser.cc"
     break;
 
-  case 582:
-#line 2016 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 582: // replace_client_name_value: "when-not-present"
+#line 2021 "dhcp4_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3307 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3319 "dhcp4_parser.cc"
     break;
 
-  case 583:
-#line 2019 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 583: // replace_client_name_value: "boolean"
+#line 2024 "dhcp4_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 3316 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3328 "dhcp4_parser.cc"
     break;
 
-  case 584:
-#line 2025 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 584: // $@109: %empty
+#line 2030 "dhcp4_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3324 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3336 "dhcp4_parser.cc"
     break;
 
-  case 585:
-#line 2027 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 585: // generated_prefix: "generated-prefix" $@109 ":" "constant string"
+#line 2032 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3334 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3346 "dhcp4_parser.cc"
     break;
 
-  case 586:
-#line 2033 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 586: // $@110: %empty
+#line 2038 "dhcp4_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3342 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3354 "dhcp4_parser.cc"
     break;
 
-  case 587:
-#line 2035 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 587: // hostname_char_set: "hostname-char-set" $@110 ":" "constant string"
+#line 2040 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3352 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3364 "dhcp4_parser.cc"
     break;
 
-  case 588:
-#line 2041 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 588: // $@111: %empty
+#line 2046 "dhcp4_parser.yy"
+                                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3360 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3372 "dhcp4_parser.cc"
     break;
 
-  case 589:
-#line 2043 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 589: // hostname_char_replacement: "hostname-char-replacement" $@111 ":" "constant string"
+#line 2048 "dhcp4_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3370 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3382 "dhcp4_parser.cc"
     break;
 
-  case 590:
-#line 2052 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 590: // $@112: %empty
+#line 2057 "dhcp4_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3378 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3390 "dhcp4_parser.cc"
     break;
 
-  case 591:
-#line 2054 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
+  case 591: // dhcp6_json_object: "Dhcp6" $@112 ":" value
+#line 2059 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3387 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3399 "dhcp4_parser.cc"
     break;
 
-  case 592:
-#line 2059 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 592: // $@113: %empty
+#line 2064 "dhcp4_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3395 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3407 "dhcp4_parser.cc"
     break;
 
-  case 593:
-#line 2061 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 593: // dhcpddns_json_object: "DhcpDdns" $@113 ":" value
+#line 2066 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3404 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3416 "dhcp4_parser.cc"
     break;
 
-  case 594:
-#line 2066 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 594: // $@114: %empty
+#line 2071 "dhcp4_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3412 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3424 "dhcp4_parser.cc"
     break;
 
-  case 595:
-#line 2068 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
+  case 595: // control_agent_json_object: "Control-agent" $@114 ":" value
+#line 2073 "dhcp4_parser.yy"
+              {
+    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3421 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3433 "dhcp4_parser.cc"
     break;
 
-  case 596:
-#line 2073 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 596: // $@115: %empty
+#line 2078 "dhcp4_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3432 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3444 "dhcp4_parser.cc"
     break;
 
-  case 597:
-#line 2078 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 597: // config_control: "config-control" $@115 ":" "{" config_control_params "}"
+#line 2083 "dhcp4_parser.yy"
+                                                            {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3442 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3454 "dhcp4_parser.cc"
     break;
 
-  case 598:
-#line 2084 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 598: // $@116: %empty
+#line 2089 "dhcp4_parser.yy"
+                                   {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3452 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3464 "dhcp4_parser.cc"
     break;
 
-  case 599:
-#line 2088 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 599: // sub_config_control: "{" $@116 config_control_params "}"
+#line 2093 "dhcp4_parser.yy"
+                                       {
     // No config_control params are required
     // parsing completed
 }
-#line 3461 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3473 "dhcp4_parser.cc"
     break;
 
-  case 603:
-#line 2102 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 604: // $@117: %empty
+#line 2108 "dhcp4_parser.yy"
+                                   {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3472 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3484 "dhcp4_parser.cc"
     break;
 
-  case 604:
-#line 2107 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 605: // config_databases: "config-databases" $@117 ":" "[" database_list "]"
+#line 2113 "dhcp4_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3481 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3493 "dhcp4_parser.cc"
     break;
 
-  case 605:
-#line 2117 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 606: // config_fetch_wait_time: "config-fetch-wait-time" ":" "integer"
+#line 2118 "dhcp4_parser.yy"
+                                                             {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("config-fetch-wait-time", value);
+}
+#line 3502 "dhcp4_parser.cc"
+    break;
+
+  case 607: // $@118: %empty
+#line 2128 "dhcp4_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3492 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3513 "dhcp4_parser.cc"
     break;
 
-  case 606:
-#line 2122 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 608: // logging_object: "Logging" $@118 ":" "{" logging_params "}"
+#line 2133 "dhcp4_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3501 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3522 "dhcp4_parser.cc"
     break;
 
-  case 607:
-#line 2127 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 609: // $@119: %empty
+#line 2138 "dhcp4_parser.yy"
+                            {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3511 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3532 "dhcp4_parser.cc"
     break;
 
-  case 608:
-#line 2131 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 610: // sub_logging: "{" $@119 logging_params "}"
+#line 2142 "dhcp4_parser.yy"
+                                {
     // parsing completed
 }
-#line 3519 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3540 "dhcp4_parser.cc"
     break;
 
-  case 612:
-#line 2147 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 614: // $@120: %empty
+#line 2158 "dhcp4_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3530 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3551 "dhcp4_parser.cc"
     break;
 
-  case 613:
-#line 2152 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 615: // loggers: "loggers" $@120 ":" "[" loggers_entries "]"
+#line 2163 "dhcp4_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3539 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3560 "dhcp4_parser.cc"
     break;
 
-  case 616:
-#line 2164 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 618: // $@121: %empty
+#line 2175 "dhcp4_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3549 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3570 "dhcp4_parser.cc"
     break;
 
-  case 617:
-#line 2168 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 619: // logger_entry: "{" $@121 logger_params "}"
+#line 2179 "dhcp4_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 3557 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3578 "dhcp4_parser.cc"
     break;
 
-  case 627:
-#line 2185 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 630: // debuglevel: "debuglevel" ":" "integer"
+#line 2197 "dhcp4_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3566 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3587 "dhcp4_parser.cc"
     break;
 
-  case 628:
-#line 2190 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 631: // $@122: %empty
+#line 2202 "dhcp4_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3574 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3595 "dhcp4_parser.cc"
     break;
 
-  case 629:
-#line 2192 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 632: // severity: "severity" $@122 ":" "constant string"
+#line 2204 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3584 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3605 "dhcp4_parser.cc"
     break;
 
-  case 630:
-#line 2198 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 633: // $@123: %empty
+#line 2210 "dhcp4_parser.yy"
+                       {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3613 "dhcp4_parser.cc"
+    break;
+
+  case 634: // rate_limit: "rate-limit" $@123 ":" "constant string"
+#line 2212 "dhcp4_parser.yy"
+               {
+    ElementPtr rl(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+}
+#line 3623 "dhcp4_parser.cc"
+    break;
+
+  case 635: // $@124: %empty
+#line 2218 "dhcp4_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3595 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3634 "dhcp4_parser.cc"
     break;
 
-  case 631:
-#line 2203 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 636: // output_options_list: "output_options" $@124 ":" "[" output_options_list_content "]"
+#line 2223 "dhcp4_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3604 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3643 "dhcp4_parser.cc"
     break;
 
-  case 634:
-#line 2212 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 639: // $@125: %empty
+#line 2232 "dhcp4_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3614 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3653 "dhcp4_parser.cc"
     break;
 
-  case 635:
-#line 2216 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 640: // output_entry: "{" $@125 output_params_list "}"
+#line 2236 "dhcp4_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 3622 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3661 "dhcp4_parser.cc"
     break;
 
-  case 642:
-#line 2230 "dhcp4_parser.yy" // lalr1.cc:907
-    {
+  case 650: // $@126: %empty
+#line 2253 "dhcp4_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3630 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3669 "dhcp4_parser.cc"
     break;
 
-  case 643:
-#line 2232 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 651: // output: "output" $@126 ":" "constant string"
+#line 2255 "dhcp4_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3640 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3679 "dhcp4_parser.cc"
     break;
 
-  case 644:
-#line 2238 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 652: // flush: "flush" ":" "boolean"
+#line 2261 "dhcp4_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3649 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3688 "dhcp4_parser.cc"
     break;
 
-  case 645:
-#line 2243 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 653: // maxsize: "maxsize" ":" "integer"
+#line 2266 "dhcp4_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3658 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3697 "dhcp4_parser.cc"
     break;
 
-  case 646:
-#line 2248 "dhcp4_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 654: // maxver: "maxver" ":" "integer"
+#line 2271 "dhcp4_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3667 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3706 "dhcp4_parser.cc"
+    break;
+
+  case 655: // async: "async" ":" "boolean"
+#line 2276 "dhcp4_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 3715 "dhcp4_parser.cc"
+    break;
+
+  case 656: // queue_size: "queue-size" ":" "integer"
+#line 2281 "dhcp4_parser.yy"
+                                     {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", size);
+}
+#line 3724 "dhcp4_parser.cc"
+    break;
+
+  case 657: // $@127: %empty
+#line 2286 "dhcp4_parser.yy"
+                                 {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3732 "dhcp4_parser.cc"
+    break;
+
+  case 658: // overflow_policy: "overflow-policy" $@127 ":" "constant string"
+#line 2288 "dhcp4_parser.yy"
+               {
+    ElementPtr policy(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 3742 "dhcp4_parser.cc"
     break;
 
 
-#line 3671 "dhcp4_parser.cc" // lalr1.cc:907
+#line 3746 "dhcp4_parser.cc"
+
             default:
               break;
             }
@@ -3675,6 +3751,7 @@ namespace isc { namespace dhcp {
 #if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
@@ -3682,13 +3759,13 @@ namespace isc { namespace dhcp {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -3697,7 +3774,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3708,7 +3787,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3725,68 +3804,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3794,6 +3886,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3827,18 +3920,103 @@ namespace isc { namespace dhcp {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp4Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp4Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp4Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp4Parser::context.
+  Dhcp4Parser::context::context (const Dhcp4Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp4Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
 
+  int
+  Dhcp4Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3857,41 +4035,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp4Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3912,11 +4081,11 @@ namespace isc { namespace dhcp {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -3925,120 +4094,123 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short Dhcp4Parser::yypact_ninf_ = -797;
+  const short Dhcp4Parser::yypact_ninf_ = -807;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
   const short
   Dhcp4Parser::yypact_[] =
   {
-     403,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,    43,    35,    38,    50,    58,
-      60,    64,   103,   110,   142,   148,   161,   163,   185,   189,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,    35,   -20,
-      17,    71,    32,   152,   -15,   239,   146,   242,    54,   -25,
-     361,    76,   206,  -797,   219,   224,   233,   237,   244,  -797,
-    -797,  -797,  -797,  -797,   287,  -797,    55,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,   295,   297,   299,  -797,
-    -797,  -797,  -797,  -797,  -797,   303,   326,   354,   364,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   367,  -797,  -797,  -797,  -797,    61,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,   369,  -797,    72,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,   371,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,    86,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,   135,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,   273,   286,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,   342,  -797,  -797,
-     375,  -797,  -797,  -797,   382,  -797,  -797,   345,   362,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   383,   385,  -797,  -797,  -797,  -797,   387,   388,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   138,  -797,  -797,  -797,   386,  -797,  -797,   389,
-    -797,   392,   396,  -797,  -797,   397,   398,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,   166,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   186,  -797,  -797,  -797,   187,  -797,  -797,  -797,
-      35,    35,  -797,    77,   405,   408,   409,   410,   411,  -797,
-      17,  -797,   415,   418,   422,   250,   259,   265,   430,   432,
-     435,   436,   437,   438,   278,   279,   280,   282,   439,   445,
-     446,   463,   464,   465,   466,   467,   468,   469,   470,   471,
-     472,   311,   488,   489,   490,    71,  -797,   491,   492,   493,
-     332,    32,  -797,   497,   498,   499,   500,   501,   504,   343,
-     506,   507,   509,   152,  -797,   510,   -15,  -797,   511,   512,
-     513,   514,   515,   516,   517,   518,  -797,   239,  -797,   519,
-     520,   365,   523,   524,   526,   366,  -797,   242,   528,   368,
-     373,  -797,    54,   529,   531,   -13,  -797,   374,   533,   535,
-     378,   541,   380,   381,   544,   545,   384,   400,   546,   566,
-     568,   569,   361,  -797,   570,    76,  -797,   571,   206,  -797,
-    -797,  -797,   572,   573,   574,    35,    35,    35,  -797,   575,
-     576,   577,  -797,  -797,  -797,   412,   413,   420,   579,   580,
-     583,  -797,  -797,  -797,  -797,   424,   585,   586,   587,   588,
-     589,   429,   172,   590,   592,   593,   594,   595,  -797,   596,
-     589,   597,  -797,   600,   304,   309,  -797,  -797,   441,   442,
-     443,   604,   447,   448,  -797,   600,   449,   603,  -797,   450,
-    -797,   600,   451,   452,   453,   454,   455,   456,   457,  -797,
-     458,   459,  -797,   460,   461,   462,  -797,  -797,   473,  -797,
-    -797,  -797,   474,    35,  -797,  -797,   475,   476,  -797,   477,
-    -797,  -797,    11,   479,  -797,  -797,   -29,   478,   480,   481,
-    -797,   623,  -797,   624,  -797,    35,    71,    76,  -797,  -797,
-    -797,   206,    32,   578,  -797,  -797,  -797,   414,   414,   625,
-    -797,   626,   627,   628,   629,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,    66,   630,   637,   640,     5,    95,  -797,
-     361,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   641,  -797,  -797,  -797,  -797,   263,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,   642,   625,  -797,   190,   196,   231,   238,  -797,   261,
-    -797,  -797,  -797,  -797,  -797,  -797,   646,   647,   648,   649,
-     650,  -797,  -797,   651,   652,   653,   654,   655,  -797,   262,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,   270,  -797,
-     656,   657,  -797,  -797,   658,   660,  -797,  -797,   659,   663,
-    -797,  -797,   661,   665,  -797,  -797,   664,   666,  -797,  -797,
-    -797,  -797,  -797,  -797,   211,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   232,  -797,  -797,   667,   668,  -797,  -797,   669,
-     671,  -797,   672,   673,   674,   675,   676,   677,   274,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,   276,  -797,  -797,  -797,   277,   496,  -797,   678,   679,
-    -797,  -797,  -797,  -797,   622,  -797,   335,  -797,   680,  -797,
-    -797,  -797,  -797,   681,   578,  -797,   683,   684,   685,   686,
-     434,   525,   530,   527,   532,   687,   688,   534,   536,   537,
-     538,   539,   414,  -797,  -797,   414,  -797,   625,   152,  -797,
-     626,   242,  -797,   627,    54,  -797,   628,   195,  -797,   629,
-      66,  -797,   234,   630,  -797,   239,  -797,   637,   -25,  -797,
-     640,   540,   542,   543,   547,   548,   549,     5,  -797,   690,
-     693,    95,  -797,  -797,  -797,   695,   696,   -15,  -797,   641,
-     701,  -797,    10,   642,  -797,  -797,   551,  -797,   347,   552,
-     553,   554,  -797,  -797,  -797,  -797,  -797,   555,   556,  -797,
-    -797,  -797,  -797,  -797,  -797,   284,  -797,   285,  -797,   702,
-    -797,   703,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,   292,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,   708,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,   714,   720,  -797,
-    -797,  -797,  -797,  -797,   716,  -797,   319,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,   560,   561,  -797,  -797,   562,
-     337,  -797,   600,  -797,   724,  -797,  -797,  -797,  -797,  -797,
-     339,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,   195,  -797,   725,   563,  -797,   234,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,   726,   567,   728,    10,  -797,  -797,
-     581,  -797,  -797,   729,  -797,   582,  -797,  -797,   730,  -797,
-    -797,   349,  -797,   -10,   730,  -797,  -797,   731,   732,   734,
-     346,  -797,  -797,  -797,  -797,  -797,  -797,   735,   584,   607,
-     610,   -10,  -797,   598,  -797,  -797,  -797,  -797,  -797
+     402,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,    31,    35,    30,    39,    58,
+      75,    86,   136,   173,   206,   208,   219,   230,   257,   272,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,    35,   -97,
+      17,    76,    42,   205,    34,    50,    52,   177,   108,   -45,
+     471,    61,   171,  -807,    69,   153,   224,   273,   296,  -807,
+    -807,  -807,  -807,  -807,   309,  -807,    59,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,   318,   334,   335,  -807,
+    -807,  -807,  -807,  -807,  -807,   336,   337,   338,   339,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,   340,  -807,  -807,  -807,  -807,    66,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,   345,  -807,    68,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,   347,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,    81,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,    88,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,   295,   307,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,   344,  -807,  -807,
+     350,  -807,  -807,  -807,   351,  -807,  -807,   348,   354,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,   356,   358,  -807,  -807,  -807,  -807,   357,   363,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,    92,  -807,  -807,  -807,   366,  -807,  -807,   369,
+    -807,   373,   377,  -807,  -807,   379,   380,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,   110,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,   113,  -807,  -807,  -807,   381,   114,  -807,  -807,
+    -807,  -807,    35,    35,  -807,   197,   382,   384,   385,   387,
+     388,  -807,    17,  -807,   389,   391,   393,   225,   228,   229,
+     399,   400,   405,   407,   410,   411,   245,   246,   249,   253,
+     424,   425,   427,   428,   429,   431,   432,   434,   435,   445,
+     447,   448,   464,   298,   466,   470,   473,    76,  -807,   474,
+     476,   479,   248,    42,  -807,   480,   481,   482,   483,   484,
+     485,   304,   486,   487,   488,   205,  -807,   489,    34,  -807,
+     492,   494,   496,   497,   498,   499,   500,   501,  -807,    50,
+    -807,   503,   504,   341,   507,   509,   510,   342,  -807,   177,
+     515,   349,   352,  -807,   108,   516,   517,    87,  -807,   353,
+     519,   520,   359,   523,   360,   361,   524,   529,   362,   364,
+     530,   532,   534,   535,   471,  -807,   536,    61,  -807,   539,
+     374,   171,  -807,  -807,  -807,   542,   543,   544,    35,    35,
+      35,  -807,   545,   546,   547,  -807,  -807,  -807,   236,   386,
+     404,   565,   569,   572,  -807,  -807,  -807,  -807,   408,   574,
+     575,   576,   577,   578,   413,    82,   581,   583,   584,   598,
+     597,  -807,   599,   578,   600,  -807,   603,   183,   242,  -807,
+    -807,   441,   442,   443,   609,   446,   449,  -807,   603,   450,
+     608,  -807,   451,  -807,   603,   452,   453,   454,   455,   456,
+     457,   458,  -807,   459,   460,  -807,   461,   462,   463,  -807,
+    -807,   465,  -807,  -807,  -807,   467,    35,  -807,  -807,   468,
+     469,  -807,   472,  -807,  -807,    27,   511,  -807,  -807,   -87,
+     475,   477,   478,  -807,   612,  -807,   613,  -807,  -807,    35,
+      76,    61,  -807,  -807,  -807,   171,    42,   610,  -807,  -807,
+    -807,   414,   414,   629,  -807,   633,   636,   639,   642,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,   194,   643,   644,
+     645,   209,   141,  -807,   471,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,   646,  -807,  -807,  -807,
+    -807,   169,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,   647,   629,  -807,   121,   133,
+     134,   195,  -807,   213,  -807,  -807,  -807,  -807,  -807,  -807,
+     601,   651,   652,   653,   654,  -807,  -807,   655,   656,   657,
+     658,   659,  -807,   221,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,   222,  -807,   660,   661,  -807,  -807,   662,   664,
+    -807,  -807,   663,   667,  -807,  -807,   665,   669,  -807,  -807,
+     668,   670,  -807,  -807,  -807,  -807,  -807,  -807,    91,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,   149,  -807,  -807,   671,
+     672,  -807,  -807,   673,   675,  -807,   676,   677,   678,   679,
+     680,   681,   233,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,   235,  -807,  -807,  -807,   244,
+     495,  -807,   682,   683,  -807,  -807,  -807,  -807,   684,  -807,
+     211,  -807,   685,  -807,  -807,  -807,  -807,   686,   610,  -807,
+     689,   690,   691,   692,   505,   514,   518,   525,   526,   695,
+     696,   531,   533,   537,   538,   528,   414,  -807,  -807,   414,
+    -807,   629,   205,  -807,   633,   177,  -807,   636,   108,  -807,
+     639,   417,  -807,   642,   194,  -807,   132,   643,  -807,    50,
+    -807,   644,   -45,  -807,   645,   540,   541,   548,   549,   550,
+     551,   209,  -807,   699,   701,   141,  -807,  -807,  -807,   700,
+     704,    34,  -807,   646,   706,  -807,   162,   647,  -807,  -807,
+     553,  -807,   299,   554,   555,   556,  -807,  -807,  -807,  -807,
+    -807,   557,   558,  -807,  -807,  -807,  -807,  -807,  -807,   250,
+    -807,   292,  -807,   705,  -807,   707,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,   293,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,   710,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,   708,   714,  -807,  -807,  -807,  -807,  -807,   721,  -807,
+     320,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,   560,
+     561,  -807,  -807,   562,   321,  -807,   603,  -807,   729,  -807,
+    -807,  -807,  -807,  -807,  -807,   322,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,   417,  -807,   730,
+     563,  -807,   132,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+     731,   566,   734,   735,   162,  -807,  -807,   570,  -807,  -807,
+     713,  -807,   571,   573,  -807,  -807,   737,  -807,  -807,  -807,
+     306,  -807,   125,   737,  -807,  -807,   738,   741,   742,   743,
+     744,  -807,   323,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,   745,   580,   579,   585,   586,   596,   747,   125,
+    -807,   587,  -807,  -807,  -807,  -807,  -807,   607,  -807,  -807,
+    -807
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
@@ -4047,10 +4219,10 @@ namespace isc { namespace dhcp {
        1,    45,    38,    34,    33,    30,    31,    32,    37,     3,
       35,    36,    58,     5,    70,     7,   128,     9,   265,    11,
      420,    13,   445,    15,   345,    17,   353,    19,   390,    21,
-     230,    23,   537,    25,   607,    27,   598,    29,    47,    41,
+     230,    23,   537,    25,   609,    27,   598,    29,    47,    41,
        0,     0,     0,     0,     0,   447,     0,   355,   392,     0,
        0,     0,     0,    49,     0,    48,     0,     0,    42,    68,
-     605,   590,   592,   594,     0,    67,     0,    60,    62,    64,
+     607,   590,   592,   594,     0,    67,     0,    60,    62,    64,
       65,    66,    63,   596,   117,   143,     0,     0,     0,   466,
      468,   470,   141,   150,   152,     0,     0,     0,     0,   112,
      257,   343,   382,   314,   433,   435,   307,   208,   494,   437,
@@ -4075,268 +4247,271 @@ namespace isc { namespace dhcp {
      565,     0,     0,   569,   573,     0,     0,   577,   584,   586,
      588,   558,   556,   557,     0,   539,   541,   542,   543,   544,
      545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
-     555,   612,     0,   609,   611,   603,     0,   600,   602,    46,
-       0,     0,    39,     0,     0,     0,     0,     0,     0,    57,
-       0,    59,     0,     0,     0,     0,     0,     0,     0,     0,
+     555,   614,     0,   611,   613,   604,     0,     0,   600,   602,
+     603,    46,     0,     0,    39,     0,     0,     0,     0,     0,
+       0,    57,     0,    59,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    71,     0,     0,     0,
-       0,     0,   129,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   266,     0,     0,   421,     0,     0,
-       0,     0,     0,     0,     0,     0,   446,     0,   346,     0,
-       0,     0,     0,     0,     0,     0,   354,     0,     0,     0,
-       0,   391,     0,     0,     0,     0,   231,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    71,     0,
+       0,     0,     0,     0,   129,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   266,     0,     0,   421,
+       0,     0,     0,     0,     0,     0,     0,     0,   446,     0,
+     346,     0,     0,     0,     0,     0,     0,     0,   354,     0,
+       0,     0,     0,   391,     0,     0,     0,     0,   231,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   538,     0,     0,   608,     0,     0,   599,
-      50,    43,     0,     0,     0,     0,     0,     0,    61,     0,
-       0,     0,   114,   115,   116,     0,     0,     0,     0,     0,
-       0,   108,   109,   110,   111,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,   519,     0,
-       0,     0,    73,     0,     0,     0,   140,   120,     0,     0,
-       0,     0,     0,     0,   313,     0,     0,     0,   268,     0,
-     423,     0,     0,     0,     0,     0,     0,     0,     0,   450,
-       0,     0,   370,     0,     0,     0,   381,   358,     0,   410,
-     411,   395,     0,     0,   233,   559,     0,     0,   564,     0,
-     567,   568,     0,     0,   575,   576,     0,     0,     0,     0,
-     540,     0,   610,     0,   601,     0,     0,     0,   591,   593,
-     595,     0,     0,     0,   467,   469,   471,     0,     0,   154,
-     113,   259,   347,   384,   316,    40,   434,   436,   309,   310,
-     311,   312,   308,     0,     0,   439,   224,     0,     0,   534,
-       0,    51,   131,   134,   135,   133,   138,   139,   137,   296,
-     298,   300,   414,   294,   302,   306,   304,     0,   432,   489,
-     477,   479,   483,   481,   487,   485,   473,   373,   194,   377,
-     375,   380,   407,   238,   240,   561,   563,   566,   571,   572,
-     570,   574,   579,   580,   581,   582,   583,   578,   585,   587,
-     589,     0,   154,    44,     0,     0,     0,     0,   148,     0,
-     145,   147,   180,   186,   188,   190,     0,     0,     0,     0,
-       0,   202,   204,     0,     0,     0,     0,     0,   179,     0,
-     160,   162,   163,   164,   165,   166,   167,   168,   169,   170,
-     171,   175,   176,   177,   172,   178,   173,   174,     0,   158,
-       0,   155,   156,   263,     0,   260,   261,   351,     0,   348,
-     349,   388,     0,   385,   386,   320,     0,   317,   318,   217,
-     218,   219,   220,   221,     0,   210,   212,   213,   214,   215,
-     216,   498,     0,   496,   443,     0,   440,   441,   228,     0,
-     225,   226,     0,     0,     0,     0,     0,     0,     0,   243,
-     245,   246,   247,   248,   249,   250,   529,   531,   528,   526,
-     527,     0,   522,   524,   525,     0,    53,   418,     0,   415,
-     416,   474,   492,   493,     0,   616,     0,   614,     0,    69,
-     606,   597,   118,     0,     0,   144,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   538,     0,     0,   610,     0,
+       0,     0,   599,    50,    43,     0,     0,     0,     0,     0,
+       0,    61,     0,     0,     0,   114,   115,   116,     0,     0,
+       0,     0,     0,     0,   108,   109,   110,   111,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   142,   151,     0,   153,     0,     0,   258,
-       0,   355,   344,     0,   392,   383,     0,     0,   315,     0,
-       0,   209,   500,     0,   495,   447,   438,     0,     0,   223,
-       0,     0,     0,     0,     0,     0,     0,     0,   242,     0,
-       0,     0,   521,   536,    55,     0,    54,     0,   413,     0,
-       0,   491,     0,     0,   613,   604,     0,   146,     0,     0,
-       0,     0,   192,   195,   196,   197,   198,     0,     0,   206,
-     207,   199,   200,   201,   161,     0,   157,     0,   262,     0,
-     350,     0,   387,   342,   339,   327,   328,   330,   331,   324,
-     325,   326,   337,   338,   336,     0,   322,   329,   340,   341,
-     332,   333,   334,   335,   319,   211,   516,     0,   514,   515,
-     507,   508,   512,   513,   509,   510,   511,     0,   501,   502,
-     504,   505,   506,   497,     0,   442,     0,   227,   251,   252,
-     253,   254,   255,   256,   244,     0,     0,   523,    52,     0,
-       0,   417,     0,   630,     0,   628,   626,   620,   624,   625,
-       0,   618,   622,   623,   621,   615,   149,   182,   183,   184,
-     185,   181,   187,   189,   191,   203,   205,   159,   264,   352,
-     389,     0,   321,     0,     0,   499,     0,   444,   229,   530,
-     532,    56,   419,   475,     0,     0,     0,     0,   617,   323,
-       0,   518,   503,     0,   627,     0,   619,   517,     0,   629,
-     634,     0,   632,     0,     0,   631,   642,     0,     0,     0,
-       0,   636,   638,   639,   640,   641,   633,     0,     0,     0,
-       0,     0,   635,     0,   644,   645,   646,   637,   643
+       0,   519,     0,     0,     0,    73,     0,     0,     0,   140,
+     120,     0,     0,     0,     0,     0,     0,   313,     0,     0,
+       0,   268,     0,   423,     0,     0,     0,     0,     0,     0,
+       0,     0,   450,     0,     0,   370,     0,     0,     0,   381,
+     358,     0,   410,   411,   395,     0,     0,   233,   559,     0,
+       0,   564,     0,   567,   568,     0,     0,   575,   576,     0,
+       0,     0,     0,   540,     0,   612,     0,   606,   601,     0,
+       0,     0,   591,   593,   595,     0,     0,     0,   467,   469,
+     471,     0,     0,   154,   113,   259,   347,   384,   316,    40,
+     434,   436,   309,   310,   311,   312,   308,     0,     0,   439,
+     224,     0,     0,   534,     0,    51,   131,   134,   135,   133,
+     138,   139,   137,   296,   298,   300,   414,   294,   302,   306,
+     304,     0,   432,   489,   477,   479,   483,   481,   487,   485,
+     473,   373,   194,   377,   375,   380,   407,   238,   240,   561,
+     563,   566,   571,   572,   570,   574,   579,   580,   581,   582,
+     583,   578,   585,   587,   589,     0,   154,    44,     0,     0,
+       0,     0,   148,     0,   145,   147,   180,   186,   188,   190,
+       0,     0,     0,     0,     0,   202,   204,     0,     0,     0,
+       0,     0,   179,     0,   160,   162,   163,   164,   165,   166,
+     167,   168,   169,   170,   171,   175,   176,   177,   172,   178,
+     173,   174,     0,   158,     0,   155,   156,   263,     0,   260,
+     261,   351,     0,   348,   349,   388,     0,   385,   386,   320,
+       0,   317,   318,   217,   218,   219,   220,   221,     0,   210,
+     212,   213,   214,   215,   216,   498,     0,   496,   443,     0,
+     440,   441,   228,     0,   225,   226,     0,     0,     0,     0,
+       0,     0,     0,   243,   245,   246,   247,   248,   249,   250,
+     529,   531,   528,   526,   527,     0,   522,   524,   525,     0,
+      53,   418,     0,   415,   416,   474,   492,   493,     0,   618,
+       0,   616,     0,    69,   608,   597,   118,     0,     0,   144,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,   142,   151,     0,
+     153,     0,     0,   258,     0,   355,   344,     0,   392,   383,
+       0,     0,   315,     0,     0,   209,   500,     0,   495,   447,
+     438,     0,     0,   223,     0,     0,     0,     0,     0,     0,
+       0,     0,   242,     0,     0,     0,   521,   536,    55,     0,
+      54,     0,   413,     0,     0,   491,     0,     0,   615,   605,
+       0,   146,     0,     0,     0,     0,   192,   195,   196,   197,
+     198,     0,     0,   206,   207,   199,   200,   201,   161,     0,
+     157,     0,   262,     0,   350,     0,   387,   342,   339,   327,
+     328,   330,   331,   324,   325,   326,   337,   338,   336,     0,
+     322,   329,   340,   341,   332,   333,   334,   335,   319,   211,
+     516,     0,   514,   515,   507,   508,   512,   513,   509,   510,
+     511,     0,   501,   502,   504,   505,   506,   497,     0,   442,
+       0,   227,   251,   252,   253,   254,   255,   256,   244,     0,
+       0,   523,    52,     0,     0,   417,     0,   635,     0,   633,
+     631,   629,   622,   627,   628,     0,   620,   624,   626,   625,
+     623,   617,   149,   182,   183,   184,   185,   181,   187,   189,
+     191,   203,   205,   159,   264,   352,   389,     0,   321,     0,
+       0,   499,     0,   444,   229,   530,   532,    56,   419,   475,
+       0,     0,     0,     0,     0,   619,   323,     0,   518,   503,
+       0,   630,     0,     0,   621,   517,     0,   634,   632,   639,
+       0,   637,     0,     0,   636,   650,     0,     0,     0,     0,
+       0,   657,     0,   641,   643,   644,   645,   646,   647,   648,
+     649,   638,     0,     0,     0,     0,     0,     0,     0,     0,
+     640,     0,   652,   653,   654,   655,   656,     0,   642,   651,
+     658
   };
 
   const short
   Dhcp4Parser::yypgoto_[] =
   {
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,   -46,  -797,  -451,  -797,
-     121,  -797,  -797,  -797,  -797,  -797,  -797,  -501,  -797,  -797,
-    -797,   -70,  -797,  -797,  -797,   312,  -797,  -797,  -797,  -797,
-     107,   348,   -47,   -44,     4,  -797,  -797,  -797,  -797,    12,
-      15,  -797,  -797,   158,   340,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,   -52,  -797,  -797,  -797,  -797,  -797,  -797,    82,  -797,
-     -72,  -797,  -563,   -59,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,   -26,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   -81,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,   -90,  -797,  -797,  -797,   -83,   321,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,   -61,  -797,  -797,  -797,  -797,
-    -797,  -797,  -796,  -797,  -797,  -797,   -43,  -797,  -797,  -797,
-     -34,   377,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -795,  -797,   -68,  -797,   -55,  -797,    19,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,   -38,  -797,  -797,  -184,   -63,  -797,
-    -797,  -797,  -797,  -797,   -16,  -797,  -797,  -797,   -18,  -797,
-     372,  -797,   -66,  -797,  -797,  -797,  -797,  -797,   -64,  -797,
-    -797,  -797,  -797,  -797,   -19,  -797,  -797,  -797,   -22,  -797,
-    -797,  -797,   -14,  -797,   379,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,   -45,  -797,  -797,  -797,
-     -40,   425,  -797,  -797,   -57,  -797,   -39,  -797,   -62,  -797,
-    -797,  -797,     7,  -797,  -797,  -797,    -8,  -797,   407,    -7,
-    -797,    -3,  -797,     8,  -797,   192,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -790,  -797,  -797,  -797,  -797,  -797,    14,
-    -797,  -797,  -797,  -141,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,    -2,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,   240,   390,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,  -797,
-    -797,   267,   391,  -797,  -797,  -797,  -797,  -797,  -797,   281,
-     395,  -797,  -797,  -797,   -12,  -797,  -797,  -144,  -797,  -797,
-    -797,  -797,  -797,  -797,  -160,  -797,  -797,  -176,  -797,  -797,
-    -797,  -797,  -797
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,   -38,  -807,  -450,  -807,
+     241,  -807,  -807,  -807,  -807,  -807,  -807,  -506,  -807,  -807,
+    -807,   -70,  -807,  -807,  -807,   418,  -807,  -807,  -807,  -807,
+     190,   397,   -47,   -44,     4,  -807,  -807,  -807,  -807,    12,
+      15,  -807,  -807,   202,   378,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,    -8,  -807,  -807,  -807,  -807,  -807,  -807,   129,  -807,
+     -20,  -807,  -568,    -9,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,   -26,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,   -23,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,   -36,  -807,  -807,  -807,   -29,   367,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,   -33,  -807,  -807,  -807,  -807,
+    -807,  -807,  -806,  -807,  -807,  -807,    -1,  -807,  -807,  -807,
+       3,   406,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -799,  -807,   -68,  -807,   -55,  -807,    19,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,    -2,  -807,  -807,  -149,   -63,  -807,
+    -807,  -807,  -807,  -807,    18,  -807,  -807,  -807,    23,  -807,
+     412,  -807,   -66,  -807,  -807,  -807,  -807,  -807,   -64,  -807,
+    -807,  -807,  -807,  -807,   -19,  -807,  -807,  -807,    22,  -807,
+    -807,  -807,    21,  -807,   409,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,    -6,  -807,  -807,  -807,
+      -5,   436,  -807,  -807,   -57,  -807,   -39,  -807,   -62,  -807,
+    -807,  -807,    14,  -807,  -807,  -807,    20,  -807,   433,    -7,
+    -807,    -3,  -807,     8,  -807,   227,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -788,  -807,  -807,  -807,  -807,  -807,    24,
+    -807,  -807,  -807,  -132,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,     9,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,   251,   403,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+    -807,   278,   395,  -807,  -807,  -807,  -807,  -807,  -807,  -807,
+     287,   415,  -807,  -807,  -807,     2,  -807,  -807,  -134,  -807,
+    -807,  -807,  -807,  -807,  -807,  -807,  -807,  -152,  -807,  -807,
+    -177,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807,  -807
   };
 
   const short
   Dhcp4Parser::yydefgoto_[] =
   {
-      -1,    15,    16,    17,    18,    19,    20,    21,    22,    23,
+       0,    15,    16,    17,    18,    19,    20,    21,    22,    23,
       24,    25,    26,    27,    28,    29,    38,    39,    40,    69,
-     596,    87,    88,    41,    68,    84,    85,   612,   776,   855,
-     856,   688,    43,    70,    96,    97,    98,   354,    45,    71,
-     137,   138,   139,   140,   141,   142,   143,   378,   144,   145,
-     146,   147,   363,   177,   178,    47,    72,   179,   397,   180,
-     398,   615,   181,   399,   618,   182,   148,   371,   149,   364,
-     669,   670,   671,   793,   150,   372,   151,   373,   710,   711,
-     712,   815,   689,   690,   691,   796,   971,   692,   797,   693,
-     798,   694,   799,   695,   696,   430,   697,   698,   699,   700,
-     701,   702,   703,   704,   805,   705,   806,   706,   707,   152,
-     386,   734,   735,   736,   737,   738,   739,   740,   153,   389,
-     749,   750,   751,   838,    61,    79,   302,   303,   304,   443,
-     305,   444,   154,   390,   758,   759,   760,   761,   762,   763,
-     764,   765,   155,   379,   714,   715,   716,   818,    49,    73,
-     201,   202,   203,   407,   204,   403,   205,   404,   206,   405,
-     207,   408,   208,   411,   209,   410,   156,   385,   602,   211,
-     157,   382,   726,   727,   728,   827,   905,   906,   158,   380,
-      55,    76,   718,   719,   720,   821,    57,    77,   267,   268,
-     269,   270,   271,   272,   273,   429,   274,   433,   275,   432,
-     276,   277,   434,   278,   159,   381,   722,   723,   724,   824,
-      59,    78,   288,   289,   290,   291,   292,   438,   293,   294,
-     295,   296,   213,   406,   778,   779,   780,   857,    51,    74,
-     226,   227,   228,   415,   160,   383,   161,   384,   162,   388,
-     745,   746,   747,   835,    53,    75,   243,   244,   245,   163,
-     368,   164,   369,   165,   370,   249,   425,   783,   860,   250,
-     419,   251,   420,   252,   422,   253,   421,   254,   424,   255,
-     423,   256,   418,   220,   412,   784,   166,   387,   742,   743,
-     832,   927,   928,   929,   930,   931,   983,   932,   167,   168,
-     392,   771,   772,   773,   849,   774,   850,   169,   393,   170,
-     394,    63,    80,   324,   325,   326,   327,   448,   328,   449,
-     329,   330,   451,   331,   332,   333,   454,   650,   334,   455,
-     335,   336,   337,   458,   657,   338,   459,   339,   460,   340,
-     461,    99,   356,   100,   357,   101,   358,   171,   362,    67,
-      82,   346,   347,   348,   467,   102,   355,    65,    81,   342,
-     343,   344,   464,   786,   787,   862,   960,   961,   962,   963,
-     996,   964,   994,  1011,  1012,  1013,  1020,  1021,  1022,  1027,
-    1023,  1024,  1025
+     600,    87,    88,    41,    68,    84,    85,   616,   780,   859,
+     860,   692,    43,    70,    96,    97,    98,   356,    45,    71,
+     137,   138,   139,   140,   141,   142,   143,   380,   144,   145,
+     146,   147,   365,   177,   178,    47,    72,   179,   399,   180,
+     400,   619,   181,   401,   622,   182,   148,   373,   149,   366,
+     673,   674,   675,   797,   150,   374,   151,   375,   714,   715,
+     716,   819,   693,   694,   695,   800,   977,   696,   801,   697,
+     802,   698,   803,   699,   700,   432,   701,   702,   703,   704,
+     705,   706,   707,   708,   809,   709,   810,   710,   711,   152,
+     388,   738,   739,   740,   741,   742,   743,   744,   153,   391,
+     753,   754,   755,   842,    61,    79,   302,   303,   304,   445,
+     305,   446,   154,   392,   762,   763,   764,   765,   766,   767,
+     768,   769,   155,   381,   718,   719,   720,   822,    49,    73,
+     201,   202,   203,   409,   204,   405,   205,   406,   206,   407,
+     207,   410,   208,   413,   209,   412,   156,   387,   606,   211,
+     157,   384,   730,   731,   732,   831,   909,   910,   158,   382,
+      55,    76,   722,   723,   724,   825,    57,    77,   267,   268,
+     269,   270,   271,   272,   273,   431,   274,   435,   275,   434,
+     276,   277,   436,   278,   159,   383,   726,   727,   728,   828,
+      59,    78,   288,   289,   290,   291,   292,   440,   293,   294,
+     295,   296,   213,   408,   782,   783,   784,   861,    51,    74,
+     226,   227,   228,   417,   160,   385,   161,   386,   162,   390,
+     749,   750,   751,   839,    53,    75,   243,   244,   245,   163,
+     370,   164,   371,   165,   372,   249,   427,   787,   864,   250,
+     421,   251,   422,   252,   424,   253,   423,   254,   426,   255,
+     425,   256,   420,   220,   414,   788,   166,   389,   746,   747,
+     836,   931,   932,   933,   934,   935,   989,   936,   167,   168,
+     394,   775,   776,   777,   853,   778,   854,   169,   395,   170,
+     396,    63,    80,   324,   325,   326,   327,   450,   328,   451,
+     329,   330,   453,   331,   332,   333,   456,   654,   334,   457,
+     335,   336,   337,   460,   661,   338,   461,   339,   462,   340,
+     463,    99,   358,   100,   359,   101,   360,   171,   364,    67,
+      82,   347,   348,   349,   469,   350,   102,   357,    65,    81,
+     342,   343,   344,   466,   790,   791,   866,   965,   966,   967,
+     968,  1003,   969,  1002,   970,  1000,  1020,  1021,  1022,  1032,
+    1033,  1034,  1042,  1035,  1036,  1037,  1038,  1039,  1040,  1048
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yytable_[] =
   {
       95,   136,   176,   195,   222,   239,   223,   265,   284,   301,
      321,   216,   286,   257,   287,   183,   214,   229,   241,   224,
-     279,   297,    83,   322,   625,   708,   196,    89,   648,   197,
-     629,   900,   901,   184,   215,   230,   242,   913,   280,   298,
-      31,   323,    32,    30,    33,    42,   172,   173,   122,   595,
-     174,   266,   285,   175,   212,   225,   240,    44,   360,   595,
-     221,   124,   125,   361,   395,    46,   217,    48,   246,   396,
-     218,    50,   247,   192,   259,   401,   193,   198,   299,   300,
-     402,   219,   103,   248,   104,   199,   124,   125,   200,   413,
-     299,   300,   210,   105,   414,   106,   107,   108,   109,   110,
-     111,   112,   113,   114,   652,   653,   654,   655,   124,   125,
-      52,   752,   753,   754,   755,   756,   757,    54,   259,   281,
-     260,   261,   282,   283,   115,   116,   117,   118,   119,   120,
-     124,   125,  1016,   121,   122,  1017,  1018,  1019,   416,   656,
-      94,   445,   649,   417,   123,    86,   446,   124,   125,    56,
-      94,   953,   126,   954,   955,    58,    90,   127,   128,   729,
-     730,   731,   732,   129,   733,    91,    92,    93,    60,   462,
-      62,   124,   125,   130,   463,    94,   131,   107,   108,   109,
-     110,   111,    94,   132,   133,   900,   901,   134,   135,   465,
-     468,   913,    64,   395,   466,   469,    66,    94,   789,   465,
-      34,    35,    36,    37,   790,   115,   116,   117,   121,   766,
-     767,   185,   186,   187,   830,   122,   341,   831,   345,    94,
-     107,   108,   109,   110,   111,   349,   188,   350,   124,   125,
-     189,   190,   191,   126,   468,   833,    94,   351,   834,   791,
-     192,   401,   472,   193,   129,   352,   792,   353,   115,   116,
-     117,   194,   885,   120,   598,   599,   600,   601,   122,   259,
-      94,   109,   110,   111,   794,   812,   109,   110,   111,   795,
-     813,   124,   125,   812,   190,   258,   126,   847,   814,   851,
-     462,   426,   848,   192,   852,   853,   193,   812,   413,   427,
-      95,   359,   977,   978,   194,   981,   121,   122,   259,   365,
-     982,   366,   122,   367,   470,   471,   259,   374,   260,   261,
-     124,   125,   262,   263,   264,   124,   125,    94,   124,   125,
-     613,   614,   445,   916,   917,   136,   231,   988,   616,   617,
-     375,   176,   232,   233,   234,   235,   236,   237,   863,   238,
-     416,   864,   997,   195,   183,   992,   222,   998,   223,  1031,
-     428,   216,  1014,   436,  1032,  1015,   214,   239,   376,   229,
-      94,   224,   184,   238,   781,   437,   196,   265,   377,   197,
-     241,   391,   284,   400,   215,   409,   286,   230,   287,   431,
-     279,   967,   968,   969,   970,   297,   435,   439,   242,   440,
-     447,   442,   321,   450,   212,   441,   452,   225,   280,    94,
-     453,   456,   457,   298,    94,   322,   217,    94,   240,   473,
-     218,   266,   474,   475,   476,   477,   285,   198,   482,   479,
-     246,   219,   480,   323,   247,   199,   481,   483,   200,   578,
-     579,   580,   210,   484,   485,   248,   486,   124,   125,   487,
-     488,   489,   490,   495,   491,   492,   493,   672,   494,   496,
-     497,   993,   673,   674,   675,   676,   677,   678,   679,   680,
-     681,   682,   683,   684,   685,   686,   687,   498,   499,   500,
-     501,   502,   503,   504,   505,   506,   507,   508,   259,   306,
-     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
-     317,   318,   509,   510,   511,   513,   514,   515,   319,   320,
-     516,   518,   519,   520,   521,   522,   136,   644,   523,   524,
-     525,   526,   176,   527,   529,   531,   532,   533,   534,   535,
-     536,   537,   538,   540,   541,   183,    94,   543,   544,   663,
-     545,   542,   548,   552,   546,   553,   549,   556,   768,   557,
-     321,   550,   555,   184,   558,   559,   560,   561,   562,   563,
-     566,   769,   564,   322,     1,     2,     3,     4,     5,     6,
-       7,     8,     9,    10,    11,    12,    13,    14,   565,   770,
-     567,   323,   568,   569,   571,   573,   575,   584,   585,    94,
-     576,   577,   581,   582,   583,   586,   587,   588,   589,   590,
-     591,   592,   593,   594,   597,   603,    32,   604,   605,   606,
-     872,   668,   607,   608,   610,   611,   619,   620,   621,   622,
-     627,   651,   623,   624,   626,   628,   630,   631,   632,   633,
-     634,   635,   636,   637,   638,   639,   640,   641,   661,   662,
-     861,   609,   709,   713,   717,   721,   725,   741,   642,   643,
-     645,   646,   647,   658,   744,   659,   660,   748,   777,   785,
-     800,   801,   802,   803,   804,   807,   808,   809,   810,   811,
-     817,   854,   816,   820,   819,   822,   823,   825,   826,   829,
-     828,   837,   478,   836,   840,   839,   841,   842,   843,   844,
-     845,   846,   859,   664,   858,   866,   865,   868,   869,   870,
-     871,   877,   878,   873,   945,   875,   874,   946,   876,   949,
-     879,   948,   880,   881,   882,   952,   938,   883,   939,   940,
-     979,   980,   984,   941,   942,   943,   966,   972,   973,   974,
-     975,   976,   985,   986,   987,   989,   990,   991,   995,  1000,
-    1003,  1001,  1005,  1004,  1008,  1028,  1029,  1010,  1030,  1033,
-     667,   517,   867,   512,   788,   886,  1007,  1009,   195,   915,
-     937,   265,  1034,   884,   284,   936,   216,   893,   286,   902,
-     287,   214,   918,  1038,   279,   239,   554,   297,   301,   920,
-     908,   196,   903,  1035,   197,   922,  1036,   888,   241,   215,
-     894,   768,   280,   895,   887,   298,   944,   222,   909,   223,
-     528,   914,   956,   923,   769,   266,   242,   999,   285,   212,
-     229,   899,   224,   889,   892,   958,   919,   890,   907,   547,
-     891,   217,   770,   921,   951,   218,   240,   950,   230,   782,
-     910,   551,   198,   959,   911,   924,   219,   934,   246,   925,
-     199,   896,   247,   200,   539,   912,   957,   210,   225,   897,
-     926,   530,   898,   248,   935,  1002,   904,   933,   666,   947,
-     775,   965,   570,  1006,  1026,  1037,     0,     0,   665,   574,
-     572,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     279,   297,   629,   322,   712,   904,   196,    89,   633,   197,
+      83,    30,   905,   184,   215,   230,   242,    42,   280,   298,
+      31,   323,    32,   917,    33,   652,    44,   656,   657,   658,
+     659,   266,   285,   599,   212,   225,   240,   172,   173,   299,
+     300,   174,   362,   599,   175,    46,   217,   363,   246,   397,
+     218,   403,   247,    86,   398,   351,   404,   198,   109,   110,
+     111,   219,    48,   248,   415,   199,   660,   103,   200,   416,
+     104,   418,   210,    50,   834,   447,   419,   835,   122,   105,
+     448,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     221,   124,   125,   464,   122,   121,   467,   471,   465,   124,
+     125,   468,   472,   192,   397,    94,   193,   124,   125,   793,
+     115,   116,   117,   118,   119,   120,   467,   471,   231,   121,
+     122,   794,   795,    52,   232,   233,   234,   235,   236,   237,
+     123,   238,   837,   124,   125,   838,   352,    90,   126,   653,
+     109,   110,   111,   127,   128,   602,   603,   604,   605,   129,
+      91,    92,    93,   259,   281,   260,   261,   282,   283,   130,
+      54,   904,   131,   345,   346,   124,   125,    94,   905,   132,
+     133,   299,   300,   134,   135,   121,   122,   259,   403,   917,
+     617,   618,   341,   796,    94,    34,    35,    36,    37,   124,
+     125,   258,    94,    56,   867,    58,   798,   868,   124,   125,
+      94,   799,   920,   921,   816,   816,    60,   259,   353,   817,
+     818,   107,   108,   109,   110,   111,   851,    62,   855,   124,
+     125,   852,   259,   856,   260,   261,    94,   464,   262,   263,
+     264,   889,   857,   816,   124,   125,   770,   771,   983,   115,
+     116,   117,   620,   621,    64,   185,   186,   187,  1025,   122,
+     238,   785,  1026,  1027,  1028,  1029,  1030,  1031,    94,    66,
+     188,   354,   124,   125,   189,   190,   191,   126,   733,   734,
+     735,   736,    95,   737,   192,   415,   987,   193,   129,   355,
+     984,   988,    94,   428,   957,   194,   958,   959,   960,  1023,
+     429,    94,  1024,   361,   473,   474,   756,   757,   758,   759,
+     760,   761,   367,   447,   418,  1004,  1049,   136,   994,   998,
+    1005,  1050,    94,   176,   973,   974,   975,   976,   368,   369,
+     376,   377,   378,   379,   393,   195,   183,    94,   222,   402,
+     223,   411,   430,   216,   433,   437,   438,   439,   214,   239,
+     441,   229,   442,   224,   184,   443,   444,   475,   196,   265,
+     449,   197,   241,   452,   284,    94,   215,   454,   286,   230,
+     287,   455,   279,   458,   459,   470,   476,   297,   477,   478,
+     242,   479,   480,   482,   321,   483,   212,   484,   485,   225,
+     280,   486,   487,   488,   489,   298,   588,   322,   217,   490,
+     240,   491,   218,   266,   492,   493,   494,   495,   285,   198,
+     496,   519,   246,   219,   497,   323,   247,   199,   498,   499,
+     200,   500,   501,   502,   210,   503,   504,   248,   505,   506,
+     582,   583,   584,   107,   108,   109,   110,   111,   676,   507,
+     999,   508,   509,   677,   678,   679,   680,   681,   682,   683,
+     684,   685,   686,   687,   688,   689,   690,   691,   510,   511,
+     512,   115,   116,   117,   513,   527,   120,   514,   516,   259,
+     517,   122,   259,   518,   521,   522,   523,   524,   525,   526,
+     528,   529,   530,   532,   124,   125,   534,   190,   535,   126,
+     536,   537,   538,   539,   540,   541,   192,   543,   544,   193,
+     136,   546,   545,   547,   548,   549,   176,   194,   648,   551,
+     555,   556,   552,   559,   560,   553,   558,   562,   565,   183,
+     561,   563,   564,   566,   569,   567,   570,   568,   571,   572,
+     574,   667,   772,   576,   321,   577,   579,   184,   124,   125,
+     580,   581,   585,   586,   587,   773,   589,   322,     1,     2,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,   591,   774,   590,   323,   592,   593,   594,   595,
+     596,   597,   598,   601,    94,    32,   607,    94,   608,   609,
+     306,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   610,   611,   804,   612,   614,   615,   319,
+     320,   623,   624,   625,   626,   631,   627,   665,   666,   628,
+     630,   632,   634,   635,   636,   637,   638,   639,   640,   641,
+     642,   643,   644,   645,   672,   646,   713,   647,   649,   650,
+     717,    94,   651,   721,   655,   662,   725,   663,   664,   729,
+     745,   748,   752,   781,   789,   805,   806,   807,   808,   811,
+     812,   813,   814,   815,   821,   858,   820,   824,   823,   826,
+     827,   829,   830,   833,   832,   841,   876,   840,   844,   843,
+     845,   846,   847,   848,   849,   850,   863,   877,   862,   878,
+     870,   869,   865,   872,   873,   874,   875,   880,   879,   881,
+     882,   887,   883,   949,   884,   950,   952,   953,   885,   886,
+     956,   942,   943,   985,   990,   986,   991,   992,  1016,   944,
+     945,   946,   947,   972,   978,   979,   980,   981,   982,   993,
+     995,   996,   997,  1001,  1007,  1010,  1008,  1011,  1012,  1013,
+    1015,  1017,  1043,  1018,  1019,  1044,  1045,  1046,  1047,  1051,
+    1053,  1057,   195,  1052,   613,   265,  1054,  1059,   284,  1055,
+     216,   897,   286,   906,   287,   214,   922,  1056,   279,   239,
+     668,   297,   301,   924,   912,   196,   907,  1060,   197,   926,
+     481,   520,   241,   215,   898,   772,   280,   899,   671,   298,
+     871,   222,   913,   223,   515,   792,   961,   927,   773,   266,
+     242,   890,   285,   212,   229,   903,   224,   888,   941,   963,
+     923,   919,   911,   940,   557,   217,   774,   925,   948,   218,
+     240,   531,   230,   892,   914,   891,   198,   964,   915,   928,
+     219,   918,   246,   929,   199,   900,   247,   200,  1006,   916,
+     962,   210,   225,   901,   930,   894,   902,   248,   893,   895,
+     908,   550,   896,   554,   533,   939,   954,   955,   786,   938,
+    1009,   937,   542,   670,   951,   779,   578,   573,   669,   971,
+    1014,  1041,  1058,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   575,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   893,     0,   902,     0,     0,   918,     0,     0,     0,
-       0,     0,     0,   920,   908,     0,   903,   956,     0,   922,
-       0,     0,     0,     0,   894,     0,     0,   895,     0,     0,
-     958,     0,   909,     0,     0,     0,     0,   923,     0,     0,
-       0,     0,     0,     0,     0,   899,     0,     0,   959,     0,
-     919,     0,   907,     0,     0,     0,     0,   921,     0,     0,
-       0,   957,     0,     0,   910,     0,     0,     0,   911,   924,
-       0,     0,     0,   925,     0,   896,     0,     0,     0,   912,
-       0,     0,     0,   897,   926,     0,   898,     0,     0,     0,
-     904
+       0,     0,     0,     0,     0,     0,     0,   897,     0,   906,
+       0,     0,   922,     0,     0,     0,     0,     0,     0,   924,
+     912,     0,   907,     0,   961,   926,     0,     0,     0,     0,
+     898,     0,     0,   899,     0,     0,     0,   963,   913,     0,
+       0,     0,     0,   927,     0,     0,     0,     0,     0,     0,
+       0,   903,     0,     0,     0,   964,   923,     0,   911,     0,
+       0,     0,     0,   925,     0,     0,     0,     0,   962,     0,
+     914,     0,     0,     0,   915,   928,     0,     0,     0,   929,
+       0,   900,     0,     0,     0,   916,     0,     0,     0,   901,
+     930,     0,   902,     0,     0,     0,   908
   };
 
   const short
@@ -4344,287 +4519,291 @@ namespace isc { namespace dhcp {
   {
       70,    71,    72,    73,    74,    75,    74,    77,    78,    79,
       80,    73,    78,    76,    78,    72,    73,    74,    75,    74,
-      77,    78,    68,    80,   525,   588,    73,    10,    17,    73,
-     531,   827,   827,    72,    73,    74,    75,   827,    77,    78,
-       5,    80,     7,     0,     9,     7,    14,    15,    63,   500,
-      18,    77,    78,    21,    73,    74,    75,     7,     3,   510,
-      75,    76,    77,     8,     3,     7,    73,     7,    75,     8,
-      73,     7,    75,    88,    64,     3,    91,    73,   103,   104,
-       8,    73,    11,    75,    13,    73,    76,    77,    73,     3,
-     103,   104,    73,    22,     8,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,   133,   134,   135,   136,    76,    77,
-       7,   106,   107,   108,   109,   110,   111,     7,    64,    65,
-      66,    67,    68,    69,    53,    54,    55,    56,    57,    58,
-      76,    77,   142,    62,    63,   145,   146,   147,     3,   168,
-     165,     3,   131,     8,    73,   165,     8,    76,    77,     7,
-     165,   141,    81,   143,   144,     7,   139,    86,    87,    93,
-      94,    95,    96,    92,    98,   148,   149,   150,     7,     3,
-       7,    76,    77,   102,     8,   165,   105,    25,    26,    27,
-      28,    29,   165,   112,   113,   981,   981,   116,   117,     3,
-       3,   981,     7,     3,     8,     8,     7,   165,     8,     3,
-     165,   166,   167,   168,     8,    53,    54,    55,    62,   114,
-     115,    59,    60,    61,     3,    63,   140,     6,    12,   165,
-      25,    26,    27,    28,    29,     6,    74,     3,    76,    77,
-      78,    79,    80,    81,     3,     3,   165,     4,     6,     8,
-      88,     3,   165,    91,    92,     8,     8,     3,    53,    54,
-      55,    99,   815,    58,    82,    83,    84,    85,    63,    64,
-     165,    27,    28,    29,     3,     3,    27,    28,    29,     8,
-       8,    76,    77,     3,    79,    33,    81,     3,     8,     3,
-       3,     8,     8,    88,     8,     8,    91,     3,     3,     3,
-     360,     4,     8,     8,    99,     3,    62,    63,    64,     4,
-       8,     4,    63,     4,   350,   351,    64,     4,    66,    67,
-      76,    77,    70,    71,    72,    76,    77,   165,    76,    77,
-      16,    17,     3,    89,    90,   395,    87,     8,    19,    20,
-       4,   401,    93,    94,    95,    96,    97,    98,     3,   100,
-       3,     6,     3,   413,   401,     8,   416,     8,   416,     3,
-       8,   413,     3,     8,     8,     6,   413,   427,     4,   416,
-     165,   416,   401,   100,   101,     3,   413,   437,     4,   413,
-     427,     4,   442,     4,   413,     4,   442,   416,   442,     4,
-     437,    34,    35,    36,    37,   442,     4,     4,   427,     4,
-       4,     3,   462,     4,   413,     8,     4,   416,   437,   165,
-       4,     4,     4,   442,   165,   462,   413,   165,   427,     4,
-     413,   437,     4,     4,     4,     4,   442,   413,   168,     4,
-     427,   413,     4,   462,   427,   413,     4,   168,   413,   475,
-     476,   477,   413,   168,     4,   427,     4,    76,    77,     4,
-       4,     4,     4,     4,   166,   166,   166,    33,   166,     4,
-       4,   952,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    49,    50,    51,    52,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,   166,    64,   118,
+      77,    78,   528,    80,   592,   831,    73,    10,   534,    73,
+      68,     0,   831,    72,    73,    74,    75,     7,    77,    78,
+       5,    80,     7,   831,     9,    18,     7,   134,   135,   136,
+     137,    77,    78,   503,    73,    74,    75,    15,    16,   104,
+     105,    19,     3,   513,    22,     7,    73,     8,    75,     3,
+      73,     3,    75,   170,     8,     6,     8,    73,    28,    29,
+      30,    73,     7,    75,     3,    73,   173,    11,    73,     8,
+      14,     3,    73,     7,     3,     3,     8,     6,    64,    23,
+       8,    25,    26,    27,    28,    29,    30,    31,    32,    33,
+      76,    77,    78,     3,    64,    63,     3,     3,     8,    77,
+      78,     8,     8,    89,     3,   170,    92,    77,    78,     8,
+      54,    55,    56,    57,    58,    59,     3,     3,    88,    63,
+      64,     8,     8,     7,    94,    95,    96,    97,    98,    99,
+      74,   101,     3,    77,    78,     6,     3,   140,    82,   132,
+      28,    29,    30,    87,    88,    83,    84,    85,    86,    93,
+     153,   154,   155,    65,    66,    67,    68,    69,    70,   103,
+       7,   987,   106,    12,    13,    77,    78,   170,   987,   113,
+     114,   104,   105,   117,   118,    63,    64,    65,     3,   987,
+      17,    18,   141,     8,   170,   170,   171,   172,   173,    77,
+      78,    34,   170,     7,     3,     7,     3,     6,    77,    78,
+     170,     8,    90,    91,     3,     3,     7,    65,     4,     8,
+       8,    26,    27,    28,    29,    30,     3,     7,     3,    77,
+      78,     8,    65,     8,    67,    68,   170,     3,    71,    72,
+      73,   819,     8,     3,    77,    78,   115,   116,     8,    54,
+      55,    56,    20,    21,     7,    60,    61,    62,   143,    64,
+     101,   102,   147,   148,   149,   150,   151,   152,   170,     7,
+      75,     8,    77,    78,    79,    80,    81,    82,    94,    95,
+      96,    97,   362,    99,    89,     3,     3,    92,    93,     3,
+       8,     8,   170,     8,   142,   100,   144,   145,   146,     3,
+       3,   170,     6,     4,   352,   353,   107,   108,   109,   110,
+     111,   112,     4,     3,     3,     3,     3,   397,     8,     8,
+       8,     8,   170,   403,    35,    36,    37,    38,     4,     4,
+       4,     4,     4,     4,     4,   415,   403,   170,   418,     4,
+     418,     4,     8,   415,     4,     4,     8,     3,   415,   429,
+       4,   418,     4,   418,   403,     8,     3,   170,   415,   439,
+       4,   415,   429,     4,   444,   170,   415,     4,   444,   418,
+     444,     4,   439,     4,     4,     4,     4,   444,     4,     4,
+     429,     4,     4,     4,   464,     4,   415,     4,   173,   418,
+     439,   173,   173,     4,     4,   444,   170,   464,   415,     4,
+     429,     4,   415,   439,     4,     4,   171,   171,   444,   415,
+     171,   173,   429,   415,   171,   464,   429,   415,     4,     4,
+     415,     4,     4,     4,   415,     4,     4,   429,     4,     4,
+     478,   479,   480,    26,    27,    28,    29,    30,    34,     4,
+     956,     4,     4,    39,    40,    41,    42,    43,    44,    45,
+      46,    47,    48,    49,    50,    51,    52,    53,     4,   171,
+       4,    54,    55,    56,     4,   171,    59,     4,     4,    65,
+       4,    64,    65,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,    77,    78,     4,    80,     4,    82,
+       4,     4,     4,     4,     4,     4,    89,     4,     4,    92,
+     580,     4,   171,     4,     4,   173,   586,   100,   556,     4,
+       4,     4,   173,     4,     4,   173,   173,     4,     4,   586,
+     171,   171,   171,     4,     4,   173,     4,   173,     4,     4,
+       4,   579,   612,     4,   614,   171,     4,   586,    77,    78,
+       7,     7,     7,     7,     7,   612,   170,   614,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,     7,   612,   170,   614,     7,     5,   170,     5,
+       5,     5,     5,   170,   170,     7,     5,   170,     5,     5,
      119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,     4,     4,     4,     4,     4,     4,   137,   138,
-     168,     4,     4,     4,     4,     4,   576,   553,     4,   166,
-       4,     4,   582,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   582,   165,     4,     4,   575,
-       4,   166,     4,     4,   168,     4,   168,     4,   608,     4,
-     610,   168,   168,   582,   166,     4,   166,   166,     4,     4,
-       4,   608,   168,   610,   151,   152,   153,   154,   155,   156,
-     157,   158,   159,   160,   161,   162,   163,   164,   168,   608,
-       4,   610,     4,     4,     4,     4,     4,   165,   165,   165,
-       7,     7,     7,     7,     7,   165,     7,     7,     5,   165,
-       5,     5,     5,     5,   165,     5,     7,     5,     5,     5,
-     166,    23,     7,     7,     7,     5,   165,   165,   165,     5,
-       7,   132,   165,   165,   165,   165,   165,   165,   165,   165,
-     165,   165,   165,   165,   165,   165,   165,   165,     5,     5,
-       8,   510,     7,     7,     7,     7,     7,     7,   165,   165,
-     165,   165,   165,   165,     7,   165,   165,     7,     7,     7,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       3,   165,     6,     3,     6,     6,     3,     6,     3,     3,
-       6,     3,   360,     6,     3,     6,     4,     4,     4,     4,
-       4,     4,     3,   576,     6,     4,     6,     4,     4,     4,
-       4,     4,     4,   168,     4,   168,   166,     4,   166,     3,
-     166,     6,   166,   166,   166,     4,   166,   168,   166,   166,
-       8,     8,     4,   166,   166,   166,   165,   165,   165,   165,
-     165,   165,     8,     3,     8,   165,   165,   165,     4,     4,
-       4,   168,     4,   166,     5,     4,     4,     7,     4,     4,
-     582,   401,   794,   395,   662,   817,   165,   165,   818,   830,
-     840,   821,   168,   812,   824,   838,   818,   827,   824,   827,
-     824,   818,   832,   165,   821,   835,   445,   824,   838,   832,
-     827,   818,   827,   166,   818,   832,   166,   820,   835,   818,
-     827,   851,   821,   827,   818,   824,   847,   857,   827,   857,
-     413,   829,   862,   832,   851,   821,   835,   981,   824,   818,
-     857,   827,   857,   821,   826,   862,   832,   823,   827,   437,
-     824,   818,   851,   832,   859,   818,   835,   857,   857,   627,
-     827,   442,   818,   862,   827,   832,   818,   835,   835,   832,
-     818,   827,   835,   818,   427,   827,   862,   818,   857,   827,
-     832,   416,   827,   835,   837,   986,   827,   833,   581,   851,
-     610,   863,   462,   997,  1014,  1031,    -1,    -1,   577,   468,
-     465,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     129,   130,   131,     5,     7,     4,     7,     7,     5,   138,
+     139,   170,   170,   170,     5,     7,   170,     5,     5,   170,
+     170,   170,   170,   170,   170,   170,   170,   170,   170,   170,
+     170,   170,   170,   170,    24,   170,     7,   170,   170,   170,
+       7,   170,   170,     7,   133,   170,     7,   170,   170,     7,
+       7,     7,     7,     7,     7,     4,     4,     4,     4,     4,
+       4,     4,     4,     4,     3,   170,     6,     3,     6,     6,
+       3,     6,     3,     3,     6,     3,   171,     6,     3,     6,
+       4,     4,     4,     4,     4,     4,     3,   173,     6,   171,
+       4,     6,     8,     4,     4,     4,     4,   171,   173,     4,
+       4,   173,   171,     4,   171,     4,     6,     3,   171,   171,
+       4,   171,   171,     8,     4,     8,     8,     3,     5,   171,
+     171,   171,   171,   170,   170,   170,   170,   170,   170,     8,
+     170,   170,   170,     4,     4,     4,   173,   171,     4,     4,
+     170,   170,     4,   170,     7,     4,     4,     4,     4,     4,
+     171,     4,   822,   173,   513,   825,   171,   170,   828,   173,
+     822,   831,   828,   831,   828,   822,   836,   171,   825,   839,
+     580,   828,   842,   836,   831,   822,   831,   170,   822,   836,
+     362,   403,   839,   822,   831,   855,   825,   831,   586,   828,
+     798,   861,   831,   861,   397,   666,   866,   836,   855,   825,
+     839,   821,   828,   822,   861,   831,   861,   816,   844,   866,
+     836,   834,   831,   842,   447,   822,   855,   836,   851,   822,
+     839,   415,   861,   824,   831,   822,   822,   866,   831,   836,
+     822,   833,   839,   836,   822,   831,   839,   822,   987,   831,
+     866,   822,   861,   831,   836,   827,   831,   839,   825,   828,
+     831,   439,   830,   444,   418,   841,   861,   863,   631,   839,
+     992,   837,   429,   585,   855,   614,   471,   464,   581,   867,
+    1004,  1023,  1049,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,   467,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,   981,    -1,   981,    -1,    -1,   986,    -1,    -1,    -1,
-      -1,    -1,    -1,   986,   981,    -1,   981,   997,    -1,   986,
-      -1,    -1,    -1,    -1,   981,    -1,    -1,   981,    -1,    -1,
-     997,    -1,   981,    -1,    -1,    -1,    -1,   986,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   981,    -1,    -1,   997,    -1,
-     986,    -1,   981,    -1,    -1,    -1,    -1,   986,    -1,    -1,
-      -1,   997,    -1,    -1,   981,    -1,    -1,    -1,   981,   986,
-      -1,    -1,    -1,   986,    -1,   981,    -1,    -1,    -1,   981,
-      -1,    -1,    -1,   981,   986,    -1,   981,    -1,    -1,    -1,
-     981
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,   987,    -1,   987,
+      -1,    -1,   992,    -1,    -1,    -1,    -1,    -1,    -1,   992,
+     987,    -1,   987,    -1,  1004,   992,    -1,    -1,    -1,    -1,
+     987,    -1,    -1,   987,    -1,    -1,    -1,  1004,   987,    -1,
+      -1,    -1,    -1,   992,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,   987,    -1,    -1,    -1,  1004,   992,    -1,   987,    -1,
+      -1,    -1,    -1,   992,    -1,    -1,    -1,    -1,  1004,    -1,
+     987,    -1,    -1,    -1,   987,   992,    -1,    -1,    -1,   992,
+      -1,   987,    -1,    -1,    -1,   987,    -1,    -1,    -1,   987,
+     992,    -1,   987,    -1,    -1,    -1,   987
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yystos_[] =
   {
-       0,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-     160,   161,   162,   163,   164,   170,   171,   172,   173,   174,
-     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-       0,     5,     7,     9,   165,   166,   167,   168,   185,   186,
-     187,   192,     7,   201,     7,   207,     7,   224,     7,   317,
-       7,   397,     7,   413,     7,   349,     7,   355,     7,   379,
-       7,   293,     7,   470,     7,   516,     7,   508,   193,   188,
-     202,   208,   225,   318,   398,   414,   350,   356,   380,   294,
-     471,   517,   509,   185,   194,   195,   165,   190,   191,    10,
-     139,   148,   149,   150,   165,   200,   203,   204,   205,   500,
-     502,   504,   514,    11,    13,    22,    24,    25,    26,    27,
-      28,    29,    30,    31,    32,    53,    54,    55,    56,    57,
-      58,    62,    63,    73,    76,    77,    81,    86,    87,    92,
-     102,   105,   112,   113,   116,   117,   200,   209,   210,   211,
-     212,   213,   214,   215,   217,   218,   219,   220,   235,   237,
-     243,   245,   278,   287,   301,   311,   335,   339,   347,   373,
-     403,   405,   407,   418,   420,   422,   445,   457,   458,   466,
-     468,   506,    14,    15,    18,    21,   200,   222,   223,   226,
-     228,   231,   234,   403,   405,    59,    60,    61,    74,    78,
-      79,    80,    88,    91,    99,   200,   211,   212,   213,   218,
-     219,   319,   320,   321,   323,   325,   327,   329,   331,   333,
-     335,   338,   373,   391,   403,   405,   407,   418,   420,   422,
-     442,    75,   200,   331,   333,   373,   399,   400,   401,   403,
-     405,    87,    93,    94,    95,    96,    97,    98,   100,   200,
-     373,   403,   405,   415,   416,   417,   418,   420,   422,   424,
-     428,   430,   432,   434,   436,   438,   440,   347,    33,    64,
-      66,    67,    70,    71,    72,   200,   263,   357,   358,   359,
-     360,   361,   362,   363,   365,   367,   369,   370,   372,   403,
-     405,    65,    68,    69,   200,   263,   361,   367,   381,   382,
-     383,   384,   385,   387,   388,   389,   390,   403,   405,   103,
-     104,   200,   295,   296,   297,   299,   118,   119,   120,   121,
-     122,   123,   124,   125,   126,   127,   128,   129,   130,   137,
-     138,   200,   403,   405,   472,   473,   474,   475,   477,   479,
-     480,   482,   483,   484,   487,   489,   490,   491,   494,   496,
-     498,   140,   518,   519,   520,    12,   510,   511,   512,     6,
-       3,     4,     8,     3,   206,   515,   501,   503,   505,     4,
-       3,     8,   507,   221,   238,     4,     4,     4,   419,   421,
-     423,   236,   244,   246,     4,     4,     4,     4,   216,   312,
-     348,   374,   340,   404,   406,   336,   279,   446,   408,   288,
-     302,     4,   459,   467,   469,     3,     8,   227,   229,   232,
-       4,     3,     8,   324,   326,   328,   392,   322,   330,     4,
-     334,   332,   443,     3,     8,   402,     3,     8,   441,   429,
-     431,   435,   433,   439,   437,   425,     8,     3,     8,   364,
-     264,     4,   368,   366,   371,     4,     8,     3,   386,     4,
-       4,     8,     3,   298,   300,     3,     8,     4,   476,   478,
-       4,   481,     4,     4,   485,   488,     4,     4,   492,   495,
-     497,   499,     3,     8,   521,     3,     8,   513,     3,     8,
-     185,   185,   165,     4,     4,     4,     4,     4,   204,     4,
-       4,     4,   168,   168,   168,     4,     4,     4,     4,     4,
-       4,   166,   166,   166,   166,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,     4,   166,     4,
-       4,     4,   210,     4,     4,     4,   168,   223,     4,     4,
-       4,     4,     4,     4,   166,     4,     4,     4,   320,     4,
-     400,     4,     4,     4,     4,     4,     4,     4,     4,   417,
-       4,     4,   166,     4,     4,     4,   168,   359,     4,   168,
-     168,   383,     4,     4,   296,   168,     4,     4,   166,     4,
-     166,   166,     4,     4,   168,   168,     4,     4,     4,     4,
-     473,     4,   519,     4,   511,     4,     7,     7,   185,   185,
-     185,     7,     7,     7,   165,   165,   165,     7,     7,     5,
-     165,     5,     5,     5,     5,   187,   189,   165,    82,    83,
-      84,    85,   337,     5,     5,     5,     5,     7,     7,   189,
-       7,     5,   196,    16,    17,   230,    19,    20,   233,   165,
-     165,   165,     5,   165,   165,   196,   165,     7,   165,   196,
-     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
-     165,   165,   165,   165,   185,   165,   165,   165,    17,   131,
-     486,   132,   133,   134,   135,   136,   168,   493,   165,   165,
-     165,     5,     5,   185,   209,   518,   510,   222,    23,   239,
-     240,   241,    33,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,   200,   251,
-     252,   253,   256,   258,   260,   262,   263,   265,   266,   267,
-     268,   269,   270,   271,   272,   274,   276,   277,   251,     7,
-     247,   248,   249,     7,   313,   314,   315,     7,   351,   352,
-     353,     7,   375,   376,   377,     7,   341,   342,   343,    93,
-      94,    95,    96,    98,   280,   281,   282,   283,   284,   285,
-     286,     7,   447,   448,     7,   409,   410,   411,     7,   289,
-     290,   291,   106,   107,   108,   109,   110,   111,   303,   304,
-     305,   306,   307,   308,   309,   310,   114,   115,   200,   403,
-     405,   460,   461,   462,   464,   472,   197,     7,   393,   394,
-     395,   101,   424,   426,   444,     7,   522,   523,   247,     8,
-       8,     8,     8,   242,     3,     8,   254,   257,   259,   261,
-       4,     4,     4,     4,     4,   273,   275,     4,     4,     4,
-       4,     4,     3,     8,     8,   250,     6,     3,   316,     6,
-       3,   354,     6,     3,   378,     6,     3,   344,     6,     3,
-       3,     6,   449,     3,     6,   412,     6,     3,   292,     6,
-       3,     4,     4,     4,     4,     4,     4,     3,     8,   463,
-     465,     3,     8,     8,   165,   198,   199,   396,     6,     3,
-     427,     8,   524,     3,     6,     6,     4,   240,     4,     4,
-       4,     4,   166,   168,   166,   168,   166,     4,     4,   166,
-     166,   166,   166,   168,   252,   251,   249,   319,   315,   357,
-     353,   381,   377,   200,   211,   212,   213,   218,   219,   263,
-     311,   329,   331,   333,   335,   345,   346,   373,   403,   405,
-     418,   420,   422,   442,   343,   281,    89,    90,   200,   263,
-     347,   373,   403,   405,   418,   420,   422,   450,   451,   452,
-     453,   454,   456,   448,   415,   411,   295,   291,   166,   166,
-     166,   166,   166,   166,   304,     4,     4,   461,     6,     3,
-     399,   395,     4,   141,   143,   144,   200,   263,   403,   405,
-     525,   526,   527,   528,   530,   523,   165,    34,    35,    36,
-      37,   255,   165,   165,   165,   165,   165,     8,     8,     8,
-       8,     3,     8,   455,     4,     8,     3,     8,     8,   165,
-     165,   165,     8,   196,   531,     4,   529,     3,     8,   346,
-       4,   168,   452,     4,   166,     4,   526,   165,     5,   165,
-       7,   532,   533,   534,     3,     6,   142,   145,   146,   147,
-     535,   536,   537,   539,   540,   541,   533,   538,     4,     4,
-       4,     3,     8,     4,   168,   166,   166,   536,   165
+       0,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   175,   176,   177,   178,   179,
+     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
+       0,     5,     7,     9,   170,   171,   172,   173,   190,   191,
+     192,   197,     7,   206,     7,   212,     7,   229,     7,   322,
+       7,   402,     7,   418,     7,   354,     7,   360,     7,   384,
+       7,   298,     7,   475,     7,   522,     7,   513,   198,   193,
+     207,   213,   230,   323,   403,   419,   355,   361,   385,   299,
+     476,   523,   514,   190,   199,   200,   170,   195,   196,    10,
+     140,   153,   154,   155,   170,   205,   208,   209,   210,   505,
+     507,   509,   520,    11,    14,    23,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    54,    55,    56,    57,    58,
+      59,    63,    64,    74,    77,    78,    82,    87,    88,    93,
+     103,   106,   113,   114,   117,   118,   205,   214,   215,   216,
+     217,   218,   219,   220,   222,   223,   224,   225,   240,   242,
+     248,   250,   283,   292,   306,   316,   340,   344,   352,   378,
+     408,   410,   412,   423,   425,   427,   450,   462,   463,   471,
+     473,   511,    15,    16,    19,    22,   205,   227,   228,   231,
+     233,   236,   239,   408,   410,    60,    61,    62,    75,    79,
+      80,    81,    89,    92,   100,   205,   216,   217,   218,   223,
+     224,   324,   325,   326,   328,   330,   332,   334,   336,   338,
+     340,   343,   378,   396,   408,   410,   412,   423,   425,   427,
+     447,    76,   205,   336,   338,   378,   404,   405,   406,   408,
+     410,    88,    94,    95,    96,    97,    98,    99,   101,   205,
+     378,   408,   410,   420,   421,   422,   423,   425,   427,   429,
+     433,   435,   437,   439,   441,   443,   445,   352,    34,    65,
+      67,    68,    71,    72,    73,   205,   268,   362,   363,   364,
+     365,   366,   367,   368,   370,   372,   374,   375,   377,   408,
+     410,    66,    69,    70,   205,   268,   366,   372,   386,   387,
+     388,   389,   390,   392,   393,   394,   395,   408,   410,   104,
+     105,   205,   300,   301,   302,   304,   119,   120,   121,   122,
+     123,   124,   125,   126,   127,   128,   129,   130,   131,   138,
+     139,   205,   408,   410,   477,   478,   479,   480,   482,   484,
+     485,   487,   488,   489,   492,   494,   495,   496,   499,   501,
+     503,   141,   524,   525,   526,    12,    13,   515,   516,   517,
+     519,     6,     3,     4,     8,     3,   211,   521,   506,   508,
+     510,     4,     3,     8,   512,   226,   243,     4,     4,     4,
+     424,   426,   428,   241,   249,   251,     4,     4,     4,     4,
+     221,   317,   353,   379,   345,   409,   411,   341,   284,   451,
+     413,   293,   307,     4,   464,   472,   474,     3,     8,   232,
+     234,   237,     4,     3,     8,   329,   331,   333,   397,   327,
+     335,     4,   339,   337,   448,     3,     8,   407,     3,     8,
+     446,   434,   436,   440,   438,   444,   442,   430,     8,     3,
+       8,   369,   269,     4,   373,   371,   376,     4,     8,     3,
+     391,     4,     4,     8,     3,   303,   305,     3,     8,     4,
+     481,   483,     4,   486,     4,     4,   490,   493,     4,     4,
+     497,   500,   502,   504,     3,     8,   527,     3,     8,   518,
+       4,     3,     8,   190,   190,   170,     4,     4,     4,     4,
+       4,   209,     4,     4,     4,   173,   173,   173,     4,     4,
+       4,     4,     4,     4,   171,   171,   171,   171,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,   171,     4,     4,     4,   215,     4,     4,     4,   173,
+     228,     4,     4,     4,     4,     4,     4,   171,     4,     4,
+       4,   325,     4,   405,     4,     4,     4,     4,     4,     4,
+       4,     4,   422,     4,     4,   171,     4,     4,     4,   173,
+     364,     4,   173,   173,   388,     4,     4,   301,   173,     4,
+       4,   171,     4,   171,   171,     4,     4,   173,   173,     4,
+       4,     4,     4,   478,     4,   525,     4,   171,   516,     4,
+       7,     7,   190,   190,   190,     7,     7,     7,   170,   170,
+     170,     7,     7,     5,   170,     5,     5,     5,     5,   192,
+     194,   170,    83,    84,    85,    86,   342,     5,     5,     5,
+       5,     7,     7,   194,     7,     5,   201,    17,    18,   235,
+      20,    21,   238,   170,   170,   170,     5,   170,   170,   201,
+     170,     7,   170,   201,   170,   170,   170,   170,   170,   170,
+     170,   170,   170,   170,   170,   170,   170,   170,   190,   170,
+     170,   170,    18,   132,   491,   133,   134,   135,   136,   137,
+     173,   498,   170,   170,   170,     5,     5,   190,   214,   524,
+     515,   227,    24,   244,   245,   246,    34,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
+      52,    53,   205,   256,   257,   258,   261,   263,   265,   267,
+     268,   270,   271,   272,   273,   274,   275,   276,   277,   279,
+     281,   282,   256,     7,   252,   253,   254,     7,   318,   319,
+     320,     7,   356,   357,   358,     7,   380,   381,   382,     7,
+     346,   347,   348,    94,    95,    96,    97,    99,   285,   286,
+     287,   288,   289,   290,   291,     7,   452,   453,     7,   414,
+     415,   416,     7,   294,   295,   296,   107,   108,   109,   110,
+     111,   112,   308,   309,   310,   311,   312,   313,   314,   315,
+     115,   116,   205,   408,   410,   465,   466,   467,   469,   477,
+     202,     7,   398,   399,   400,   102,   429,   431,   449,     7,
+     528,   529,   252,     8,     8,     8,     8,   247,     3,     8,
+     259,   262,   264,   266,     4,     4,     4,     4,     4,   278,
+     280,     4,     4,     4,     4,     4,     3,     8,     8,   255,
+       6,     3,   321,     6,     3,   359,     6,     3,   383,     6,
+       3,   349,     6,     3,     3,     6,   454,     3,     6,   417,
+       6,     3,   297,     6,     3,     4,     4,     4,     4,     4,
+       4,     3,     8,   468,   470,     3,     8,     8,   170,   203,
+     204,   401,     6,     3,   432,     8,   530,     3,     6,     6,
+       4,   245,     4,     4,     4,     4,   171,   173,   171,   173,
+     171,     4,     4,   171,   171,   171,   171,   173,   257,   256,
+     254,   324,   320,   362,   358,   386,   382,   205,   216,   217,
+     218,   223,   224,   268,   316,   334,   336,   338,   340,   350,
+     351,   378,   408,   410,   423,   425,   427,   447,   348,   286,
+      90,    91,   205,   268,   352,   378,   408,   410,   423,   425,
+     427,   455,   456,   457,   458,   459,   461,   453,   420,   416,
+     300,   296,   171,   171,   171,   171,   171,   171,   309,     4,
+       4,   466,     6,     3,   404,   400,     4,   142,   144,   145,
+     146,   205,   268,   408,   410,   531,   532,   533,   534,   536,
+     538,   529,   170,    35,    36,    37,    38,   260,   170,   170,
+     170,   170,   170,     8,     8,     8,     8,     3,     8,   460,
+       4,     8,     3,     8,     8,   170,   170,   170,     8,   201,
+     539,     4,   537,   535,     3,     8,   351,     4,   173,   457,
+       4,   171,     4,     4,   532,   170,     5,   170,   170,     7,
+     540,   541,   542,     3,     6,   143,   147,   148,   149,   150,
+     151,   152,   543,   544,   545,   547,   548,   549,   550,   551,
+     552,   541,   546,     4,     4,     4,     4,     4,   553,     3,
+       8,     4,   173,   171,   171,   173,   171,     4,   544,   170,
+     170
   };
 
-  const unsigned short
+  const short
   Dhcp4Parser::yyr1_[] =
   {
-       0,   169,   171,   170,   172,   170,   173,   170,   174,   170,
-     175,   170,   176,   170,   177,   170,   178,   170,   179,   170,
-     180,   170,   181,   170,   182,   170,   183,   170,   184,   170,
-     185,   185,   185,   185,   185,   185,   185,   186,   188,   187,
-     189,   190,   190,   191,   191,   193,   192,   194,   194,   195,
-     195,   197,   196,   198,   198,   199,   199,   200,   202,   201,
-     203,   203,   204,   204,   204,   204,   204,   204,   206,   205,
-     208,   207,   209,   209,   210,   210,   210,   210,   210,   210,
-     210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
-     210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
-     210,   210,   210,   210,   210,   210,   210,   210,   211,   212,
-     213,   214,   216,   215,   217,   218,   219,   221,   220,   222,
-     222,   223,   223,   223,   223,   223,   223,   223,   225,   224,
-     227,   226,   229,   228,   230,   230,   232,   231,   233,   233,
-     234,   236,   235,   238,   237,   239,   239,   240,   242,   241,
-     244,   243,   246,   245,   247,   247,   248,   248,   250,   249,
-     251,   251,   252,   252,   252,   252,   252,   252,   252,   252,
-     252,   252,   252,   252,   252,   252,   252,   252,   252,   252,
-     254,   253,   255,   255,   255,   255,   257,   256,   259,   258,
-     261,   260,   262,   264,   263,   265,   266,   267,   268,   269,
-     270,   271,   273,   272,   275,   274,   276,   277,   279,   278,
-     280,   280,   281,   281,   281,   281,   281,   282,   283,   284,
-     285,   286,   288,   287,   289,   289,   290,   290,   292,   291,
-     294,   293,   295,   295,   295,   296,   296,   298,   297,   300,
-     299,   302,   301,   303,   303,   304,   304,   304,   304,   304,
-     304,   305,   306,   307,   308,   309,   310,   312,   311,   313,
-     313,   314,   314,   316,   315,   318,   317,   319,   319,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   320,   320,   320,   320,   320,   320,   320,
-     320,   320,   320,   322,   321,   324,   323,   326,   325,   328,
-     327,   330,   329,   332,   331,   334,   333,   336,   335,   337,
-     337,   337,   337,   338,   340,   339,   341,   341,   342,   342,
-     344,   343,   345,   345,   346,   346,   346,   346,   346,   346,
-     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
-     346,   346,   346,   348,   347,   350,   349,   351,   351,   352,
-     352,   354,   353,   356,   355,   357,   357,   358,   358,   359,
-     359,   359,   359,   359,   359,   359,   359,   359,   359,   360,
-     361,   362,   364,   363,   366,   365,   368,   367,   369,   371,
-     370,   372,   374,   373,   375,   375,   376,   376,   378,   377,
-     380,   379,   381,   381,   382,   382,   383,   383,   383,   383,
-     383,   383,   383,   383,   383,   384,   386,   385,   387,   388,
-     389,   390,   392,   391,   393,   393,   394,   394,   396,   395,
-     398,   397,   399,   399,   400,   400,   400,   400,   400,   400,
-     400,   402,   401,   404,   403,   406,   405,   408,   407,   409,
-     409,   410,   410,   412,   411,   414,   413,   415,   415,   416,
-     416,   417,   417,   417,   417,   417,   417,   417,   417,   417,
-     417,   417,   417,   417,   417,   417,   419,   418,   421,   420,
-     423,   422,   425,   424,   427,   426,   429,   428,   431,   430,
-     433,   432,   435,   434,   437,   436,   439,   438,   441,   440,
-     443,   442,   444,   444,   446,   445,   447,   447,   449,   448,
-     450,   450,   451,   451,   452,   452,   452,   452,   452,   452,
-     452,   452,   452,   452,   452,   453,   455,   454,   456,   457,
-     459,   458,   460,   460,   461,   461,   461,   461,   461,   463,
-     462,   465,   464,   467,   466,   469,   468,   471,   470,   472,
-     472,   473,   473,   473,   473,   473,   473,   473,   473,   473,
-     473,   473,   473,   473,   473,   473,   473,   473,   473,   474,
-     476,   475,   478,   477,   479,   481,   480,   482,   483,   485,
-     484,   486,   486,   488,   487,   489,   490,   492,   491,   493,
-     493,   493,   493,   493,   495,   494,   497,   496,   499,   498,
-     501,   500,   503,   502,   505,   504,   507,   506,   509,   508,
-     510,   510,   511,   513,   512,   515,   514,   517,   516,   518,
-     518,   519,   521,   520,   522,   522,   524,   523,   525,   525,
-     526,   526,   526,   526,   526,   526,   526,   527,   529,   528,
-     531,   530,   532,   532,   534,   533,   535,   535,   536,   536,
-     536,   536,   538,   537,   539,   540,   541
+       0,   174,   176,   175,   177,   175,   178,   175,   179,   175,
+     180,   175,   181,   175,   182,   175,   183,   175,   184,   175,
+     185,   175,   186,   175,   187,   175,   188,   175,   189,   175,
+     190,   190,   190,   190,   190,   190,   190,   191,   193,   192,
+     194,   195,   195,   196,   196,   198,   197,   199,   199,   200,
+     200,   202,   201,   203,   203,   204,   204,   205,   207,   206,
+     208,   208,   209,   209,   209,   209,   209,   209,   211,   210,
+     213,   212,   214,   214,   215,   215,   215,   215,   215,   215,
+     215,   215,   215,   215,   215,   215,   215,   215,   215,   215,
+     215,   215,   215,   215,   215,   215,   215,   215,   215,   215,
+     215,   215,   215,   215,   215,   215,   215,   215,   216,   217,
+     218,   219,   221,   220,   222,   223,   224,   226,   225,   227,
+     227,   228,   228,   228,   228,   228,   228,   228,   230,   229,
+     232,   231,   234,   233,   235,   235,   237,   236,   238,   238,
+     239,   241,   240,   243,   242,   244,   244,   245,   247,   246,
+     249,   248,   251,   250,   252,   252,   253,   253,   255,   254,
+     256,   256,   257,   257,   257,   257,   257,   257,   257,   257,
+     257,   257,   257,   257,   257,   257,   257,   257,   257,   257,
+     259,   258,   260,   260,   260,   260,   262,   261,   264,   263,
+     266,   265,   267,   269,   268,   270,   271,   272,   273,   274,
+     275,   276,   278,   277,   280,   279,   281,   282,   284,   283,
+     285,   285,   286,   286,   286,   286,   286,   287,   288,   289,
+     290,   291,   293,   292,   294,   294,   295,   295,   297,   296,
+     299,   298,   300,   300,   300,   301,   301,   303,   302,   305,
+     304,   307,   306,   308,   308,   309,   309,   309,   309,   309,
+     309,   310,   311,   312,   313,   314,   315,   317,   316,   318,
+     318,   319,   319,   321,   320,   323,   322,   324,   324,   325,
+     325,   325,   325,   325,   325,   325,   325,   325,   325,   325,
+     325,   325,   325,   325,   325,   325,   325,   325,   325,   325,
+     325,   325,   325,   327,   326,   329,   328,   331,   330,   333,
+     332,   335,   334,   337,   336,   339,   338,   341,   340,   342,
+     342,   342,   342,   343,   345,   344,   346,   346,   347,   347,
+     349,   348,   350,   350,   351,   351,   351,   351,   351,   351,
+     351,   351,   351,   351,   351,   351,   351,   351,   351,   351,
+     351,   351,   351,   353,   352,   355,   354,   356,   356,   357,
+     357,   359,   358,   361,   360,   362,   362,   363,   363,   364,
+     364,   364,   364,   364,   364,   364,   364,   364,   364,   365,
+     366,   367,   369,   368,   371,   370,   373,   372,   374,   376,
+     375,   377,   379,   378,   380,   380,   381,   381,   383,   382,
+     385,   384,   386,   386,   387,   387,   388,   388,   388,   388,
+     388,   388,   388,   388,   388,   389,   391,   390,   392,   393,
+     394,   395,   397,   396,   398,   398,   399,   399,   401,   400,
+     403,   402,   404,   404,   405,   405,   405,   405,   405,   405,
+     405,   407,   406,   409,   408,   411,   410,   413,   412,   414,
+     414,   415,   415,   417,   416,   419,   418,   420,   420,   421,
+     421,   422,   422,   422,   422,   422,   422,   422,   422,   422,
+     422,   422,   422,   422,   422,   422,   424,   423,   426,   425,
+     428,   427,   430,   429,   432,   431,   434,   433,   436,   435,
+     438,   437,   440,   439,   442,   441,   444,   443,   446,   445,
+     448,   447,   449,   449,   451,   450,   452,   452,   454,   453,
+     455,   455,   456,   456,   457,   457,   457,   457,   457,   457,
+     457,   457,   457,   457,   457,   458,   460,   459,   461,   462,
+     464,   463,   465,   465,   466,   466,   466,   466,   466,   468,
+     467,   470,   469,   472,   471,   474,   473,   476,   475,   477,
+     477,   478,   478,   478,   478,   478,   478,   478,   478,   478,
+     478,   478,   478,   478,   478,   478,   478,   478,   478,   479,
+     481,   480,   483,   482,   484,   486,   485,   487,   488,   490,
+     489,   491,   491,   493,   492,   494,   495,   497,   496,   498,
+     498,   498,   498,   498,   500,   499,   502,   501,   504,   503,
+     506,   505,   508,   507,   510,   509,   512,   511,   514,   513,
+     515,   515,   516,   516,   518,   517,   519,   521,   520,   523,
+     522,   524,   524,   525,   527,   526,   528,   528,   530,   529,
+     531,   531,   532,   532,   532,   532,   532,   532,   532,   532,
+     533,   535,   534,   537,   536,   539,   538,   540,   540,   542,
+     541,   543,   543,   544,   544,   544,   544,   544,   544,   544,
+     546,   545,   547,   548,   549,   550,   551,   553,   552
   };
 
-  const unsigned char
+  const signed char
   Dhcp4Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -4687,23 +4866,25 @@ namespace isc { namespace dhcp {
        4,     1,     1,     0,     4,     3,     3,     0,     4,     1,
        1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
        0,     4,     0,     4,     0,     4,     0,     6,     0,     4,
-       1,     3,     1,     0,     6,     0,     6,     0,     4,     1,
-       3,     1,     0,     6,     1,     3,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     3,     0,     4,
-       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
-       1,     1,     0,     4,     3,     3,     3
+       1,     3,     1,     1,     0,     6,     3,     0,     6,     0,
+       4,     1,     3,     1,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       3,     0,     4,     0,     4,     0,     6,     1,     3,     0,
+       4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
+       0,     4,     3,     3,     3,     3,     3,     0,     4
   };
 
 
-
+#if PARSER4_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp4Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"", "\"config-control\"",
-  "\"config-databases\"", "\"interfaces-config\"", "\"interfaces\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp4\"",
+  "\"config-control\"", "\"config-databases\"",
+  "\"config-fetch-wait-time\"", "\"interfaces-config\"", "\"interfaces\"",
   "\"dhcp-socket-type\"", "\"raw\"", "\"udp\"", "\"outbound-interface\"",
   "\"same-as-inbound\"", "\"use-routing\"", "\"re-detect\"",
   "\"sanity-checks\"", "\"lease-checks\"", "\"echo-client-id\"",
@@ -4743,10 +4924,11 @@ namespace isc { namespace dhcp {
   "\"when-present\"", "\"never\"", "\"always\"", "\"when-not-present\"",
   "\"hostname-char-set\"", "\"hostname-char-replacement\"", "\"Logging\"",
   "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp6\"",
-  "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP4",
-  "SUB_DHCP4", "SUB_INTERFACES4", "SUB_SUBNET4", "SUB_POOL4",
-  "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
+  "\"rate-limit\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
+  "\"maxver\"", "\"async\"", "\"queue-size\"", "\"overflow-policy\"",
+  "\"Dhcp6\"", "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON",
+  "TOPLEVEL_DHCP4", "SUB_DHCP4", "SUB_INTERFACES4", "SUB_SUBNET4",
+  "SUB_POOL4", "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
   "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
   "SUB_CONFIG_CONTROL", "\"constant string\"", "\"integer\"",
   "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
@@ -4831,104 +5013,106 @@ namespace isc { namespace dhcp {
   "dhcpddns_json_object", "$@113", "control_agent_json_object", "$@114",
   "config_control", "$@115", "sub_config_control", "$@116",
   "config_control_params", "config_control_param", "config_databases",
-  "$@117", "logging_object", "$@118", "sub_logging", "$@119",
-  "logging_params", "logging_param", "loggers", "$@120", "loggers_entries",
-  "logger_entry", "$@121", "logger_params", "logger_param", "debuglevel",
-  "severity", "$@122", "output_options_list", "$@123",
-  "output_options_list_content", "output_entry", "$@124",
-  "output_params_list", "output_params", "output", "$@125", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "$@117", "config_fetch_wait_time", "logging_object", "$@118",
+  "sub_logging", "$@119", "logging_params", "logging_param", "loggers",
+  "$@120", "loggers_entries", "logger_entry", "$@121", "logger_params",
+  "logger_param", "debuglevel", "severity", "$@122", "rate_limit", "$@123",
+  "output_options_list", "$@124", "output_options_list_content",
+  "output_entry", "$@125", "output_params_list", "output_params", "output",
+  "$@126", "flush", "maxsize", "maxver", "async", "queue_size",
+  "overflow_policy", "$@127", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER4_DEBUG
-  const unsigned short
+  const short
   Dhcp4Parser::yyrline_[] =
   {
-       0,   254,   254,   254,   255,   255,   256,   256,   257,   257,
-     258,   258,   259,   259,   260,   260,   261,   261,   262,   262,
+       0,   259,   259,   259,   260,   260,   261,   261,   262,   262,
      263,   263,   264,   264,   265,   265,   266,   266,   267,   267,
-     275,   276,   277,   278,   279,   280,   281,   284,   289,   289,
-     300,   303,   304,   307,   311,   318,   318,   325,   326,   329,
-     333,   340,   340,   347,   348,   351,   355,   366,   376,   376,
-     392,   393,   397,   398,   399,   400,   401,   402,   405,   405,
-     420,   420,   429,   430,   435,   436,   437,   438,   439,   440,
-     441,   442,   443,   444,   445,   446,   447,   448,   449,   450,
-     451,   452,   453,   454,   455,   456,   457,   458,   459,   460,
-     461,   462,   463,   464,   465,   466,   467,   468,   471,   476,
-     481,   486,   491,   491,   499,   504,   509,   515,   515,   526,
-     527,   530,   531,   532,   533,   534,   535,   536,   539,   539,
-     548,   548,   558,   558,   565,   566,   569,   569,   576,   578,
-     582,   588,   588,   600,   600,   610,   611,   613,   615,   615,
-     633,   633,   645,   645,   655,   656,   659,   660,   663,   663,
-     673,   674,   677,   678,   679,   680,   681,   682,   683,   684,
-     685,   686,   687,   688,   689,   690,   691,   692,   693,   694,
-     697,   697,   704,   705,   706,   707,   710,   710,   718,   718,
-     726,   726,   734,   739,   739,   747,   752,   757,   762,   767,
-     772,   777,   782,   782,   790,   790,   798,   803,   808,   808,
-     818,   819,   822,   823,   824,   825,   826,   829,   834,   839,
-     844,   849,   854,   854,   864,   865,   868,   869,   872,   872,
-     882,   882,   892,   893,   894,   897,   898,   901,   901,   909,
-     909,   917,   917,   928,   929,   932,   933,   934,   935,   936,
-     937,   940,   945,   950,   955,   960,   965,   973,   973,   986,
-     987,   990,   991,   998,   998,  1024,  1024,  1035,  1036,  1040,
-    1041,  1042,  1043,  1044,  1045,  1046,  1047,  1048,  1049,  1050,
-    1051,  1052,  1053,  1054,  1055,  1056,  1057,  1058,  1059,  1060,
-    1061,  1062,  1063,  1066,  1066,  1074,  1074,  1082,  1082,  1090,
-    1090,  1098,  1098,  1106,  1106,  1114,  1114,  1124,  1124,  1131,
-    1132,  1133,  1134,  1137,  1144,  1144,  1155,  1156,  1160,  1161,
-    1164,  1164,  1172,  1173,  1176,  1177,  1178,  1179,  1180,  1181,
-    1182,  1183,  1184,  1185,  1186,  1187,  1188,  1189,  1190,  1191,
-    1192,  1193,  1194,  1201,  1201,  1214,  1214,  1223,  1224,  1227,
-    1228,  1233,  1233,  1248,  1248,  1262,  1263,  1266,  1267,  1270,
-    1271,  1272,  1273,  1274,  1275,  1276,  1277,  1278,  1279,  1282,
-    1284,  1289,  1291,  1291,  1299,  1299,  1307,  1307,  1315,  1317,
-    1317,  1325,  1334,  1334,  1346,  1347,  1352,  1353,  1358,  1358,
-    1370,  1370,  1382,  1383,  1388,  1389,  1394,  1395,  1396,  1397,
-    1398,  1399,  1400,  1401,  1402,  1405,  1407,  1407,  1415,  1417,
-    1419,  1424,  1432,  1432,  1444,  1445,  1448,  1449,  1452,  1452,
-    1462,  1462,  1472,  1473,  1476,  1477,  1478,  1479,  1480,  1481,
-    1482,  1485,  1485,  1493,  1493,  1518,  1518,  1548,  1548,  1558,
-    1559,  1562,  1563,  1566,  1566,  1575,  1575,  1584,  1585,  1588,
-    1589,  1593,  1594,  1595,  1596,  1597,  1598,  1599,  1600,  1601,
-    1602,  1603,  1604,  1605,  1606,  1607,  1610,  1610,  1618,  1618,
-    1626,  1626,  1634,  1634,  1642,  1642,  1652,  1652,  1660,  1660,
-    1668,  1668,  1676,  1676,  1684,  1684,  1692,  1692,  1700,  1700,
-    1713,  1713,  1723,  1724,  1730,  1730,  1740,  1741,  1744,  1744,
-    1754,  1755,  1758,  1759,  1762,  1763,  1764,  1765,  1766,  1767,
-    1768,  1769,  1770,  1771,  1772,  1775,  1777,  1777,  1785,  1794,
-    1801,  1801,  1811,  1812,  1815,  1816,  1817,  1818,  1819,  1822,
-    1822,  1830,  1830,  1841,  1841,  1879,  1879,  1891,  1891,  1901,
-    1902,  1905,  1906,  1907,  1908,  1909,  1910,  1911,  1912,  1913,
-    1914,  1915,  1916,  1917,  1918,  1919,  1920,  1921,  1922,  1925,
-    1930,  1930,  1938,  1938,  1946,  1951,  1951,  1959,  1964,  1969,
-    1969,  1977,  1978,  1981,  1981,  1989,  1994,  1999,  1999,  2007,
-    2010,  2013,  2016,  2019,  2025,  2025,  2033,  2033,  2041,  2041,
-    2052,  2052,  2059,  2059,  2066,  2066,  2073,  2073,  2084,  2084,
-    2094,  2095,  2099,  2102,  2102,  2117,  2117,  2127,  2127,  2138,
-    2139,  2143,  2147,  2147,  2159,  2160,  2164,  2164,  2172,  2173,
-    2176,  2177,  2178,  2179,  2180,  2181,  2182,  2185,  2190,  2190,
-    2198,  2198,  2208,  2209,  2212,  2212,  2220,  2221,  2224,  2225,
-    2226,  2227,  2230,  2230,  2238,  2243,  2248
+     268,   268,   269,   269,   270,   270,   271,   271,   272,   272,
+     280,   281,   282,   283,   284,   285,   286,   289,   294,   294,
+     305,   308,   309,   312,   316,   323,   323,   330,   331,   334,
+     338,   345,   345,   352,   353,   356,   360,   371,   381,   381,
+     397,   398,   402,   403,   404,   405,   406,   407,   410,   410,
+     425,   425,   434,   435,   440,   441,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
+     466,   467,   468,   469,   470,   471,   472,   473,   476,   481,
+     486,   491,   496,   496,   504,   509,   514,   520,   520,   531,
+     532,   535,   536,   537,   538,   539,   540,   541,   544,   544,
+     553,   553,   563,   563,   570,   571,   574,   574,   581,   583,
+     587,   593,   593,   605,   605,   615,   616,   618,   620,   620,
+     638,   638,   650,   650,   660,   661,   664,   665,   668,   668,
+     678,   679,   682,   683,   684,   685,   686,   687,   688,   689,
+     690,   691,   692,   693,   694,   695,   696,   697,   698,   699,
+     702,   702,   709,   710,   711,   712,   715,   715,   723,   723,
+     731,   731,   739,   744,   744,   752,   757,   762,   767,   772,
+     777,   782,   787,   787,   795,   795,   803,   808,   813,   813,
+     823,   824,   827,   828,   829,   830,   831,   834,   839,   844,
+     849,   854,   859,   859,   869,   870,   873,   874,   877,   877,
+     887,   887,   897,   898,   899,   902,   903,   906,   906,   914,
+     914,   922,   922,   933,   934,   937,   938,   939,   940,   941,
+     942,   945,   950,   955,   960,   965,   970,   978,   978,   991,
+     992,   995,   996,  1003,  1003,  1029,  1029,  1040,  1041,  1045,
+    1046,  1047,  1048,  1049,  1050,  1051,  1052,  1053,  1054,  1055,
+    1056,  1057,  1058,  1059,  1060,  1061,  1062,  1063,  1064,  1065,
+    1066,  1067,  1068,  1071,  1071,  1079,  1079,  1087,  1087,  1095,
+    1095,  1103,  1103,  1111,  1111,  1119,  1119,  1129,  1129,  1136,
+    1137,  1138,  1139,  1142,  1149,  1149,  1160,  1161,  1165,  1166,
+    1169,  1169,  1177,  1178,  1181,  1182,  1183,  1184,  1185,  1186,
+    1187,  1188,  1189,  1190,  1191,  1192,  1193,  1194,  1195,  1196,
+    1197,  1198,  1199,  1206,  1206,  1219,  1219,  1228,  1229,  1232,
+    1233,  1238,  1238,  1253,  1253,  1267,  1268,  1271,  1272,  1275,
+    1276,  1277,  1278,  1279,  1280,  1281,  1282,  1283,  1284,  1287,
+    1289,  1294,  1296,  1296,  1304,  1304,  1312,  1312,  1320,  1322,
+    1322,  1330,  1339,  1339,  1351,  1352,  1357,  1358,  1363,  1363,
+    1375,  1375,  1387,  1388,  1393,  1394,  1399,  1400,  1401,  1402,
+    1403,  1404,  1405,  1406,  1407,  1410,  1412,  1412,  1420,  1422,
+    1424,  1429,  1437,  1437,  1449,  1450,  1453,  1454,  1457,  1457,
+    1467,  1467,  1477,  1478,  1481,  1482,  1483,  1484,  1485,  1486,
+    1487,  1490,  1490,  1498,  1498,  1523,  1523,  1553,  1553,  1563,
+    1564,  1567,  1568,  1571,  1571,  1580,  1580,  1589,  1590,  1593,
+    1594,  1598,  1599,  1600,  1601,  1602,  1603,  1604,  1605,  1606,
+    1607,  1608,  1609,  1610,  1611,  1612,  1615,  1615,  1623,  1623,
+    1631,  1631,  1639,  1639,  1647,  1647,  1657,  1657,  1665,  1665,
+    1673,  1673,  1681,  1681,  1689,  1689,  1697,  1697,  1705,  1705,
+    1718,  1718,  1728,  1729,  1735,  1735,  1745,  1746,  1749,  1749,
+    1759,  1760,  1763,  1764,  1767,  1768,  1769,  1770,  1771,  1772,
+    1773,  1774,  1775,  1776,  1777,  1780,  1782,  1782,  1790,  1799,
+    1806,  1806,  1816,  1817,  1820,  1821,  1822,  1823,  1824,  1827,
+    1827,  1835,  1835,  1846,  1846,  1884,  1884,  1896,  1896,  1906,
+    1907,  1910,  1911,  1912,  1913,  1914,  1915,  1916,  1917,  1918,
+    1919,  1920,  1921,  1922,  1923,  1924,  1925,  1926,  1927,  1930,
+    1935,  1935,  1943,  1943,  1951,  1956,  1956,  1964,  1969,  1974,
+    1974,  1982,  1983,  1986,  1986,  1994,  1999,  2004,  2004,  2012,
+    2015,  2018,  2021,  2024,  2030,  2030,  2038,  2038,  2046,  2046,
+    2057,  2057,  2064,  2064,  2071,  2071,  2078,  2078,  2089,  2089,
+    2099,  2100,  2104,  2105,  2108,  2108,  2118,  2128,  2128,  2138,
+    2138,  2149,  2150,  2154,  2158,  2158,  2170,  2171,  2175,  2175,
+    2183,  2184,  2187,  2188,  2189,  2190,  2191,  2192,  2193,  2194,
+    2197,  2202,  2202,  2210,  2210,  2218,  2218,  2228,  2229,  2232,
+    2232,  2240,  2241,  2244,  2245,  2246,  2247,  2248,  2249,  2250,
+    2253,  2253,  2261,  2266,  2271,  2276,  2281,  2286,  2286
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp4Parser::yystack_print_ ()
+  Dhcp4Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp4Parser::yy_reduce_print_ (int yyrule)
+  Dhcp4Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -4941,10 +5125,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER4_DEBUG
 
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:1218
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 4947 "dhcp4_parser.cc" // lalr1.cc:1218
-#line 2253 "dhcp4_parser.yy" // lalr1.cc:1219
+#line 5131 "dhcp4_parser.cc"
+
+#line 2294 "dhcp4_parser.yy"
 
 
 void
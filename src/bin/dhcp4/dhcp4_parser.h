@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,13 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_PARSER4_DHCP4_PARSER_H_INCLUDED
 # define YY_PARSER4_DHCP4_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "dhcp4_parser.yy" // lalr1.cc:404
+// "%code requires" blocks.
+#line 17 "dhcp4_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -56,7 +57,7 @@ using namespace isc::dhcp;
 using namespace isc::data;
 using namespace std;
 
-#line 60 "dhcp4_parser.h" // lalr1.cc:404
+#line 61 "dhcp4_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -85,46 +86,66 @@ using namespace std;
 # define YY_RVREF(Type)    const Type&
 # define YY_COPY(Type)     const Type&
 #endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef PARSER4__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define PARSER4__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -137,6 +158,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -162,193 +204,92 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined PARSER4_DEBUG */
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:404
+#line 14 "dhcp4_parser.yy"
 namespace isc { namespace dhcp {
-#line 168 "dhcp4_parser.h" // lalr1.cc:404
-
-  /// A stack with random access from its top.
-  template <typename T, typename S = std::vector<T> >
-  class stack
-  {
-  public:
-    // Hide our reversed order.
-    typedef typename S::reverse_iterator iterator;
-    typedef typename S::const_reverse_iterator const_iterator;
-    typedef typename S::size_type size_type;
-
-    stack (size_type n = 200)
-      : seq_ (n)
-    {}
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (size_type i)
-    {
-      return seq_[size () - 1 - i];
-    }
+#line 210 "dhcp4_parser.h"
 
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (int i)
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (size_type i) const
-    {
-      return seq_[size () - 1 - i];
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (int i) const
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Steal the contents of \a t.
-    ///
-    /// Close to move-semantics.
-    void
-    push (YY_MOVE_REF (T) t)
-    {
-      seq_.push_back (T ());
-      operator[](0).move (t);
-    }
-
-    void
-    pop (int n = 1)
-    {
-      for (; 0 < n; --n)
-        seq_.pop_back ();
-    }
-
-    void
-    clear ()
-    {
-      seq_.clear ();
-    }
-
-    size_type
-    size () const
-    {
-      return seq_.size ();
-    }
-
-    const_iterator
-    begin () const
-    {
-      return seq_.rbegin ();
-    }
 
-    const_iterator
-    end () const
-    {
-      return seq_.rend ();
-    }
 
-  private:
-    stack (const stack&);
-    stack& operator= (const stack&);
-    /// The wrapped container.
-    S seq_;
-  };
 
-  /// Present a slice of the top of a stack.
-  template <typename T, typename S = stack<T> >
-  class slice
+  /// A Bison parser.
+  class Dhcp4Parser
   {
   public:
-    slice (const S& stack, int range)
-      : stack_ (stack)
-      , range_ (range)
-    {}
-
-    const T&
-    operator[] (int i) const
-    {
-      return stack_[range_ - i];
-    }
-
-  private:
-    const S& stack_;
-    int range_;
-  };
-
-
-
-  /// A char[S] buffer to store and retrieve objects.
+#ifdef PARSER4_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define PARSER4_STYPE in C++, use %define api.value.type"
+# endif
+    typedef PARSER4_STYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      PARSER4__ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
 
-# if 201103L <= YY_CPLUSPLUS
-    /// Instantiate a \a T in here from \a t.
-    template <typename T, typename U>
-    T&
-    emplace (U&& u)
-    {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
-      yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T (std::forward <U>(u));
-    }
-# else
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (!yytypeid_);
+      PARSER4__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -375,75 +316,75 @@ namespace isc { namespace dhcp {
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == typeid (T));
+      PARSER4__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
     /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      PARSER4__ASSERT (yytypeid_);
+      PARSER4__ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type& that)
     {
 # if 201103L <= YY_CPLUSPLUS
-      emplace<T> (std::move (other.as<T> ()));
+      emplace<T> (std::move (that.as<T> ()));
 # else
       emplace<T> ();
-      swap<T> (other);
+      swap<T> (that);
 # endif
-      other.destroy<T> ();
+      that.destroy<T> ();
     }
 
 # if 201103L <= YY_CPLUSPLUS
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type&& other)
+    move (self_type&& that)
     {
-      emplace<T> (std::move (other.as<T> ()));
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
 #endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      emplace<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -456,46 +397,31 @@ namespace isc { namespace dhcp {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    variant (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class Dhcp4Parser
-  {
-  public:
-#ifndef PARSER4_STYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
@@ -520,214 +446,814 @@ namespace isc { namespace dhcp {
 
       // "constant string"
       char dummy5[sizeof (std::string)];
-};
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof (union_type)> semantic_type;
-#else
-    typedef PARSER4_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_DHCP4 = 265,
-        TOKEN_CONFIG_CONTROL = 266,
-        TOKEN_CONFIG_DATABASES = 267,
-        TOKEN_INTERFACES_CONFIG = 268,
-        TOKEN_INTERFACES = 269,
-        TOKEN_DHCP_SOCKET_TYPE = 270,
-        TOKEN_RAW = 271,
-        TOKEN_UDP = 272,
-        TOKEN_OUTBOUND_INTERFACE = 273,
-        TOKEN_SAME_AS_INBOUND = 274,
-        TOKEN_USE_ROUTING = 275,
-        TOKEN_RE_DETECT = 276,
-        TOKEN_SANITY_CHECKS = 277,
-        TOKEN_LEASE_CHECKS = 278,
-        TOKEN_ECHO_CLIENT_ID = 279,
-        TOKEN_MATCH_CLIENT_ID = 280,
-        TOKEN_AUTHORITATIVE = 281,
-        TOKEN_NEXT_SERVER = 282,
-        TOKEN_SERVER_HOSTNAME = 283,
-        TOKEN_BOOT_FILE_NAME = 284,
-        TOKEN_LEASE_DATABASE = 285,
-        TOKEN_HOSTS_DATABASE = 286,
-        TOKEN_HOSTS_DATABASES = 287,
-        TOKEN_TYPE = 288,
-        TOKEN_MEMFILE = 289,
-        TOKEN_MYSQL = 290,
-        TOKEN_POSTGRESQL = 291,
-        TOKEN_CQL = 292,
-        TOKEN_USER = 293,
-        TOKEN_PASSWORD = 294,
-        TOKEN_HOST = 295,
-        TOKEN_PORT = 296,
-        TOKEN_PERSIST = 297,
-        TOKEN_LFC_INTERVAL = 298,
-        TOKEN_READONLY = 299,
-        TOKEN_CONNECT_TIMEOUT = 300,
-        TOKEN_CONTACT_POINTS = 301,
-        TOKEN_KEYSPACE = 302,
-        TOKEN_MAX_RECONNECT_TRIES = 303,
-        TOKEN_RECONNECT_WAIT_TIME = 304,
-        TOKEN_REQUEST_TIMEOUT = 305,
-        TOKEN_TCP_KEEPALIVE = 306,
-        TOKEN_TCP_NODELAY = 307,
-        TOKEN_VALID_LIFETIME = 308,
-        TOKEN_RENEW_TIMER = 309,
-        TOKEN_REBIND_TIMER = 310,
-        TOKEN_DECLINE_PROBATION_PERIOD = 311,
-        TOKEN_SERVER_TAG = 312,
-        TOKEN_SUBNET4 = 313,
-        TOKEN_SUBNET_4O6_INTERFACE = 314,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 315,
-        TOKEN_SUBNET_4O6_SUBNET = 316,
-        TOKEN_OPTION_DEF = 317,
-        TOKEN_OPTION_DATA = 318,
-        TOKEN_NAME = 319,
-        TOKEN_DATA = 320,
-        TOKEN_CODE = 321,
-        TOKEN_SPACE = 322,
-        TOKEN_CSV_FORMAT = 323,
-        TOKEN_ALWAYS_SEND = 324,
-        TOKEN_RECORD_TYPES = 325,
-        TOKEN_ENCAPSULATE = 326,
-        TOKEN_ARRAY = 327,
-        TOKEN_SHARED_NETWORKS = 328,
-        TOKEN_POOLS = 329,
-        TOKEN_POOL = 330,
-        TOKEN_USER_CONTEXT = 331,
-        TOKEN_COMMENT = 332,
-        TOKEN_SUBNET = 333,
-        TOKEN_INTERFACE = 334,
-        TOKEN_ID = 335,
-        TOKEN_RESERVATION_MODE = 336,
-        TOKEN_DISABLED = 337,
-        TOKEN_OUT_OF_POOL = 338,
-        TOKEN_GLOBAL = 339,
-        TOKEN_ALL = 340,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 341,
-        TOKEN_CLIENT_CLASSES = 342,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 343,
-        TOKEN_TEST = 344,
-        TOKEN_ONLY_IF_REQUIRED = 345,
-        TOKEN_CLIENT_CLASS = 346,
-        TOKEN_RESERVATIONS = 347,
-        TOKEN_DUID = 348,
-        TOKEN_HW_ADDRESS = 349,
-        TOKEN_CIRCUIT_ID = 350,
-        TOKEN_CLIENT_ID = 351,
-        TOKEN_HOSTNAME = 352,
-        TOKEN_FLEX_ID = 353,
-        TOKEN_RELAY = 354,
-        TOKEN_IP_ADDRESS = 355,
-        TOKEN_IP_ADDRESSES = 356,
-        TOKEN_HOOKS_LIBRARIES = 357,
-        TOKEN_LIBRARY = 358,
-        TOKEN_PARAMETERS = 359,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 360,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 361,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 362,
-        TOKEN_HOLD_RECLAIMED_TIME = 363,
-        TOKEN_MAX_RECLAIM_LEASES = 364,
-        TOKEN_MAX_RECLAIM_TIME = 365,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 366,
-        TOKEN_DHCP4O6_PORT = 367,
-        TOKEN_CONTROL_SOCKET = 368,
-        TOKEN_SOCKET_TYPE = 369,
-        TOKEN_SOCKET_NAME = 370,
-        TOKEN_DHCP_QUEUE_CONTROL = 371,
-        TOKEN_DHCP_DDNS = 372,
-        TOKEN_ENABLE_UPDATES = 373,
-        TOKEN_QUALIFYING_SUFFIX = 374,
-        TOKEN_SERVER_IP = 375,
-        TOKEN_SERVER_PORT = 376,
-        TOKEN_SENDER_IP = 377,
-        TOKEN_SENDER_PORT = 378,
-        TOKEN_MAX_QUEUE_SIZE = 379,
-        TOKEN_NCR_PROTOCOL = 380,
-        TOKEN_NCR_FORMAT = 381,
-        TOKEN_OVERRIDE_NO_UPDATE = 382,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 383,
-        TOKEN_REPLACE_CLIENT_NAME = 384,
-        TOKEN_GENERATED_PREFIX = 385,
-        TOKEN_TCP = 386,
-        TOKEN_JSON = 387,
-        TOKEN_WHEN_PRESENT = 388,
-        TOKEN_NEVER = 389,
-        TOKEN_ALWAYS = 390,
-        TOKEN_WHEN_NOT_PRESENT = 391,
-        TOKEN_HOSTNAME_CHAR_SET = 392,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 393,
-        TOKEN_LOGGING = 394,
-        TOKEN_LOGGERS = 395,
-        TOKEN_OUTPUT_OPTIONS = 396,
-        TOKEN_OUTPUT = 397,
-        TOKEN_DEBUGLEVEL = 398,
-        TOKEN_SEVERITY = 399,
-        TOKEN_FLUSH = 400,
-        TOKEN_MAXSIZE = 401,
-        TOKEN_MAXVER = 402,
-        TOKEN_DHCP6 = 403,
-        TOKEN_DHCPDDNS = 404,
-        TOKEN_CONTROL_AGENT = 405,
-        TOKEN_TOPLEVEL_JSON = 406,
-        TOKEN_TOPLEVEL_DHCP4 = 407,
-        TOKEN_SUB_DHCP4 = 408,
-        TOKEN_SUB_INTERFACES4 = 409,
-        TOKEN_SUB_SUBNET4 = 410,
-        TOKEN_SUB_POOL4 = 411,
-        TOKEN_SUB_RESERVATION = 412,
-        TOKEN_SUB_OPTION_DEFS = 413,
-        TOKEN_SUB_OPTION_DEF = 414,
-        TOKEN_SUB_OPTION_DATA = 415,
-        TOKEN_SUB_HOOKS_LIBRARY = 416,
-        TOKEN_SUB_DHCP_DDNS = 417,
-        TOKEN_SUB_LOGGING = 418,
-        TOKEN_SUB_CONFIG_CONTROL = 419,
-        TOKEN_STRING = 420,
-        TOKEN_INTEGER = 421,
-        TOKEN_FLOAT = 422,
-        TOKEN_BOOLEAN = 423
+      enum token_kind_type
+      {
+        TOKEN_PARSER4_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_PARSER4_error = 256,     // error
+    TOKEN_PARSER4_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_DHCP4 = 265,             // "Dhcp4"
+    TOKEN_CONFIG_CONTROL = 266,    // "config-control"
+    TOKEN_CONFIG_DATABASES = 267,  // "config-databases"
+    TOKEN_CONFIG_FETCH_WAIT_TIME = 268, // "config-fetch-wait-time"
+    TOKEN_INTERFACES_CONFIG = 269, // "interfaces-config"
+    TOKEN_INTERFACES = 270,        // "interfaces"
+    TOKEN_DHCP_SOCKET_TYPE = 271,  // "dhcp-socket-type"
+    TOKEN_RAW = 272,               // "raw"
+    TOKEN_UDP = 273,               // "udp"
+    TOKEN_OUTBOUND_INTERFACE = 274, // "outbound-interface"
+    TOKEN_SAME_AS_INBOUND = 275,   // "same-as-inbound"
+    TOKEN_USE_ROUTING = 276,       // "use-routing"
+    TOKEN_RE_DETECT = 277,         // "re-detect"
+    TOKEN_SANITY_CHECKS = 278,     // "sanity-checks"
+    TOKEN_LEASE_CHECKS = 279,      // "lease-checks"
+    TOKEN_ECHO_CLIENT_ID = 280,    // "echo-client-id"
+    TOKEN_MATCH_CLIENT_ID = 281,   // "match-client-id"
+    TOKEN_AUTHORITATIVE = 282,     // "authoritative"
+    TOKEN_NEXT_SERVER = 283,       // "next-server"
+    TOKEN_SERVER_HOSTNAME = 284,   // "server-hostname"
+    TOKEN_BOOT_FILE_NAME = 285,    // "boot-file-name"
+    TOKEN_LEASE_DATABASE = 286,    // "lease-database"
+    TOKEN_HOSTS_DATABASE = 287,    // "hosts-database"
+    TOKEN_HOSTS_DATABASES = 288,   // "hosts-databases"
+    TOKEN_TYPE = 289,              // "type"
+    TOKEN_MEMFILE = 290,           // "memfile"
+    TOKEN_MYSQL = 291,             // "mysql"
+    TOKEN_POSTGRESQL = 292,        // "postgresql"
+    TOKEN_CQL = 293,               // "cql"
+    TOKEN_USER = 294,              // "user"
+    TOKEN_PASSWORD = 295,          // "password"
+    TOKEN_HOST = 296,              // "host"
+    TOKEN_PORT = 297,              // "port"
+    TOKEN_PERSIST = 298,           // "persist"
+    TOKEN_LFC_INTERVAL = 299,      // "lfc-interval"
+    TOKEN_READONLY = 300,          // "readonly"
+    TOKEN_CONNECT_TIMEOUT = 301,   // "connect-timeout"
+    TOKEN_CONTACT_POINTS = 302,    // "contact-points"
+    TOKEN_KEYSPACE = 303,          // "keyspace"
+    TOKEN_MAX_RECONNECT_TRIES = 304, // "max-reconnect-tries"
+    TOKEN_RECONNECT_WAIT_TIME = 305, // "reconnect-wait-time"
+    TOKEN_REQUEST_TIMEOUT = 306,   // "request-timeout"
+    TOKEN_TCP_KEEPALIVE = 307,     // "tcp-keepalive"
+    TOKEN_TCP_NODELAY = 308,       // "tcp-nodelay"
+    TOKEN_VALID_LIFETIME = 309,    // "valid-lifetime"
+    TOKEN_RENEW_TIMER = 310,       // "renew-timer"
+    TOKEN_REBIND_TIMER = 311,      // "rebind-timer"
+    TOKEN_DECLINE_PROBATION_PERIOD = 312, // "decline-probation-period"
+    TOKEN_SERVER_TAG = 313,        // "server-tag"
+    TOKEN_SUBNET4 = 314,           // "subnet4"
+    TOKEN_SUBNET_4O6_INTERFACE = 315, // "4o6-interface"
+    TOKEN_SUBNET_4O6_INTERFACE_ID = 316, // "4o6-interface-id"
+    TOKEN_SUBNET_4O6_SUBNET = 317, // "4o6-subnet"
+    TOKEN_OPTION_DEF = 318,        // "option-def"
+    TOKEN_OPTION_DATA = 319,       // "option-data"
+    TOKEN_NAME = 320,              // "name"
+    TOKEN_DATA = 321,              // "data"
+    TOKEN_CODE = 322,              // "code"
+    TOKEN_SPACE = 323,             // "space"
+    TOKEN_CSV_FORMAT = 324,        // "csv-format"
+    TOKEN_ALWAYS_SEND = 325,       // "always-send"
+    TOKEN_RECORD_TYPES = 326,      // "record-types"
+    TOKEN_ENCAPSULATE = 327,       // "encapsulate"
+    TOKEN_ARRAY = 328,             // "array"
+    TOKEN_SHARED_NETWORKS = 329,   // "shared-networks"
+    TOKEN_POOLS = 330,             // "pools"
+    TOKEN_POOL = 331,              // "pool"
+    TOKEN_USER_CONTEXT = 332,      // "user-context"
+    TOKEN_COMMENT = 333,           // "comment"
+    TOKEN_SUBNET = 334,            // "subnet"
+    TOKEN_INTERFACE = 335,         // "interface"
+    TOKEN_ID = 336,                // "id"
+    TOKEN_RESERVATION_MODE = 337,  // "reservation-mode"
+    TOKEN_DISABLED = 338,          // "disabled"
+    TOKEN_OUT_OF_POOL = 339,       // "out-of-pool"
+    TOKEN_GLOBAL = 340,            // "global"
+    TOKEN_ALL = 341,               // "all"
+    TOKEN_HOST_RESERVATION_IDENTIFIERS = 342, // "host-reservation-identifiers"
+    TOKEN_CLIENT_CLASSES = 343,    // "client-classes"
+    TOKEN_REQUIRE_CLIENT_CLASSES = 344, // "require-client-classes"
+    TOKEN_TEST = 345,              // "test"
+    TOKEN_ONLY_IF_REQUIRED = 346,  // "only-if-required"
+    TOKEN_CLIENT_CLASS = 347,      // "client-class"
+    TOKEN_RESERVATIONS = 348,      // "reservations"
+    TOKEN_DUID = 349,              // "duid"
+    TOKEN_HW_ADDRESS = 350,        // "hw-address"
+    TOKEN_CIRCUIT_ID = 351,        // "circuit-id"
+    TOKEN_CLIENT_ID = 352,         // "client-id"
+    TOKEN_HOSTNAME = 353,          // "hostname"
+    TOKEN_FLEX_ID = 354,           // "flex-id"
+    TOKEN_RELAY = 355,             // "relay"
+    TOKEN_IP_ADDRESS = 356,        // "ip-address"
+    TOKEN_IP_ADDRESSES = 357,      // "ip-addresses"
+    TOKEN_HOOKS_LIBRARIES = 358,   // "hooks-libraries"
+    TOKEN_LIBRARY = 359,           // "library"
+    TOKEN_PARAMETERS = 360,        // "parameters"
+    TOKEN_EXPIRED_LEASES_PROCESSING = 361, // "expired-leases-processing"
+    TOKEN_RECLAIM_TIMER_WAIT_TIME = 362, // "reclaim-timer-wait-time"
+    TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 363, // "flush-reclaimed-timer-wait-time"
+    TOKEN_HOLD_RECLAIMED_TIME = 364, // "hold-reclaimed-time"
+    TOKEN_MAX_RECLAIM_LEASES = 365, // "max-reclaim-leases"
+    TOKEN_MAX_RECLAIM_TIME = 366,  // "max-reclaim-time"
+    TOKEN_UNWARNED_RECLAIM_CYCLES = 367, // "unwarned-reclaim-cycles"
+    TOKEN_DHCP4O6_PORT = 368,      // "dhcp4o6-port"
+    TOKEN_CONTROL_SOCKET = 369,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 370,       // "socket-type"
+    TOKEN_SOCKET_NAME = 371,       // "socket-name"
+    TOKEN_DHCP_QUEUE_CONTROL = 372, // "dhcp-queue-control"
+    TOKEN_DHCP_DDNS = 373,         // "dhcp-ddns"
+    TOKEN_ENABLE_UPDATES = 374,    // "enable-updates"
+    TOKEN_QUALIFYING_SUFFIX = 375, // "qualifying-suffix"
+    TOKEN_SERVER_IP = 376,         // "server-ip"
+    TOKEN_SERVER_PORT = 377,       // "server-port"
+    TOKEN_SENDER_IP = 378,         // "sender-ip"
+    TOKEN_SENDER_PORT = 379,       // "sender-port"
+    TOKEN_MAX_QUEUE_SIZE = 380,    // "max-queue-size"
+    TOKEN_NCR_PROTOCOL = 381,      // "ncr-protocol"
+    TOKEN_NCR_FORMAT = 382,        // "ncr-format"
+    TOKEN_OVERRIDE_NO_UPDATE = 383, // "override-no-update"
+    TOKEN_OVERRIDE_CLIENT_UPDATE = 384, // "override-client-update"
+    TOKEN_REPLACE_CLIENT_NAME = 385, // "replace-client-name"
+    TOKEN_GENERATED_PREFIX = 386,  // "generated-prefix"
+    TOKEN_TCP = 387,               // "tcp"
+    TOKEN_JSON = 388,              // "JSON"
+    TOKEN_WHEN_PRESENT = 389,      // "when-present"
+    TOKEN_NEVER = 390,             // "never"
+    TOKEN_ALWAYS = 391,            // "always"
+    TOKEN_WHEN_NOT_PRESENT = 392,  // "when-not-present"
+    TOKEN_HOSTNAME_CHAR_SET = 393, // "hostname-char-set"
+    TOKEN_HOSTNAME_CHAR_REPLACEMENT = 394, // "hostname-char-replacement"
+    TOKEN_LOGGING = 395,           // "Logging"
+    TOKEN_LOGGERS = 396,           // "loggers"
+    TOKEN_OUTPUT_OPTIONS = 397,    // "output_options"
+    TOKEN_OUTPUT = 398,            // "output"
+    TOKEN_DEBUGLEVEL = 399,        // "debuglevel"
+    TOKEN_RATE_LIMIT = 400,        // "rate-limit"
+    TOKEN_SEVERITY = 401,          // "severity"
+    TOKEN_FLUSH = 402,             // "flush"
+    TOKEN_MAXSIZE = 403,           // "maxsize"
+    TOKEN_MAXVER = 404,            // "maxver"
+    TOKEN_ASYNC = 405,             // "async"
+    TOKEN_QUEUE_SIZE = 406,        // "queue-size"
+    TOKEN_OVERFLOW_POLICY = 407,   // "overflow-policy"
+    TOKEN_DHCP6 = 408,             // "Dhcp6"
+    TOKEN_DHCPDDNS = 409,          // "DhcpDdns"
+    TOKEN_CONTROL_AGENT = 410,     // "Control-agent"
+    TOKEN_TOPLEVEL_JSON = 411,     // TOPLEVEL_JSON
+    TOKEN_TOPLEVEL_DHCP4 = 412,    // TOPLEVEL_DHCP4
+    TOKEN_SUB_DHCP4 = 413,         // SUB_DHCP4
+    TOKEN_SUB_INTERFACES4 = 414,   // SUB_INTERFACES4
+    TOKEN_SUB_SUBNET4 = 415,       // SUB_SUBNET4
+    TOKEN_SUB_POOL4 = 416,         // SUB_POOL4
+    TOKEN_SUB_RESERVATION = 417,   // SUB_RESERVATION
+    TOKEN_SUB_OPTION_DEFS = 418,   // SUB_OPTION_DEFS
+    TOKEN_SUB_OPTION_DEF = 419,    // SUB_OPTION_DEF
+    TOKEN_SUB_OPTION_DATA = 420,   // SUB_OPTION_DATA
+    TOKEN_SUB_HOOKS_LIBRARY = 421, // SUB_HOOKS_LIBRARY
+    TOKEN_SUB_DHCP_DDNS = 422,     // SUB_DHCP_DDNS
+    TOKEN_SUB_LOGGING = 423,       // SUB_LOGGING
+    TOKEN_SUB_CONFIG_CONTROL = 424, // SUB_CONFIG_CONTROL
+    TOKEN_STRING = 425,            // "constant string"
+    TOKEN_INTEGER = 426,           // "integer"
+    TOKEN_FLOAT = 427,             // "floating point"
+    TOKEN_BOOLEAN = 428            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 174, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_DHCP4 = 10,                            // "Dhcp4"
+        S_CONFIG_CONTROL = 11,                   // "config-control"
+        S_CONFIG_DATABASES = 12,                 // "config-databases"
+        S_CONFIG_FETCH_WAIT_TIME = 13,           // "config-fetch-wait-time"
+        S_INTERFACES_CONFIG = 14,                // "interfaces-config"
+        S_INTERFACES = 15,                       // "interfaces"
+        S_DHCP_SOCKET_TYPE = 16,                 // "dhcp-socket-type"
+        S_RAW = 17,                              // "raw"
+        S_UDP = 18,                              // "udp"
+        S_OUTBOUND_INTERFACE = 19,               // "outbound-interface"
+        S_SAME_AS_INBOUND = 20,                  // "same-as-inbound"
+        S_USE_ROUTING = 21,                      // "use-routing"
+        S_RE_DETECT = 22,                        // "re-detect"
+        S_SANITY_CHECKS = 23,                    // "sanity-checks"
+        S_LEASE_CHECKS = 24,                     // "lease-checks"
+        S_ECHO_CLIENT_ID = 25,                   // "echo-client-id"
+        S_MATCH_CLIENT_ID = 26,                  // "match-client-id"
+        S_AUTHORITATIVE = 27,                    // "authoritative"
+        S_NEXT_SERVER = 28,                      // "next-server"
+        S_SERVER_HOSTNAME = 29,                  // "server-hostname"
+        S_BOOT_FILE_NAME = 30,                   // "boot-file-name"
+        S_LEASE_DATABASE = 31,                   // "lease-database"
+        S_HOSTS_DATABASE = 32,                   // "hosts-database"
+        S_HOSTS_DATABASES = 33,                  // "hosts-databases"
+        S_TYPE = 34,                             // "type"
+        S_MEMFILE = 35,                          // "memfile"
+        S_MYSQL = 36,                            // "mysql"
+        S_POSTGRESQL = 37,                       // "postgresql"
+        S_CQL = 38,                              // "cql"
+        S_USER = 39,                             // "user"
+        S_PASSWORD = 40,                         // "password"
+        S_HOST = 41,                             // "host"
+        S_PORT = 42,                             // "port"
+        S_PERSIST = 43,                          // "persist"
+        S_LFC_INTERVAL = 44,                     // "lfc-interval"
+        S_READONLY = 45,                         // "readonly"
+        S_CONNECT_TIMEOUT = 46,                  // "connect-timeout"
+        S_CONTACT_POINTS = 47,                   // "contact-points"
+        S_KEYSPACE = 48,                         // "keyspace"
+        S_MAX_RECONNECT_TRIES = 49,              // "max-reconnect-tries"
+        S_RECONNECT_WAIT_TIME = 50,              // "reconnect-wait-time"
+        S_REQUEST_TIMEOUT = 51,                  // "request-timeout"
+        S_TCP_KEEPALIVE = 52,                    // "tcp-keepalive"
+        S_TCP_NODELAY = 53,                      // "tcp-nodelay"
+        S_VALID_LIFETIME = 54,                   // "valid-lifetime"
+        S_RENEW_TIMER = 55,                      // "renew-timer"
+        S_REBIND_TIMER = 56,                     // "rebind-timer"
+        S_DECLINE_PROBATION_PERIOD = 57,         // "decline-probation-period"
+        S_SERVER_TAG = 58,                       // "server-tag"
+        S_SUBNET4 = 59,                          // "subnet4"
+        S_SUBNET_4O6_INTERFACE = 60,             // "4o6-interface"
+        S_SUBNET_4O6_INTERFACE_ID = 61,          // "4o6-interface-id"
+        S_SUBNET_4O6_SUBNET = 62,                // "4o6-subnet"
+        S_OPTION_DEF = 63,                       // "option-def"
+        S_OPTION_DATA = 64,                      // "option-data"
+        S_NAME = 65,                             // "name"
+        S_DATA = 66,                             // "data"
+        S_CODE = 67,                             // "code"
+        S_SPACE = 68,                            // "space"
+        S_CSV_FORMAT = 69,                       // "csv-format"
+        S_ALWAYS_SEND = 70,                      // "always-send"
+        S_RECORD_TYPES = 71,                     // "record-types"
+        S_ENCAPSULATE = 72,                      // "encapsulate"
+        S_ARRAY = 73,                            // "array"
+        S_SHARED_NETWORKS = 74,                  // "shared-networks"
+        S_POOLS = 75,                            // "pools"
+        S_POOL = 76,                             // "pool"
+        S_USER_CONTEXT = 77,                     // "user-context"
+        S_COMMENT = 78,                          // "comment"
+        S_SUBNET = 79,                           // "subnet"
+        S_INTERFACE = 80,                        // "interface"
+        S_ID = 81,                               // "id"
+        S_RESERVATION_MODE = 82,                 // "reservation-mode"
+        S_DISABLED = 83,                         // "disabled"
+        S_OUT_OF_POOL = 84,                      // "out-of-pool"
+        S_GLOBAL = 85,                           // "global"
+        S_ALL = 86,                              // "all"
+        S_HOST_RESERVATION_IDENTIFIERS = 87,     // "host-reservation-identifiers"
+        S_CLIENT_CLASSES = 88,                   // "client-classes"
+        S_REQUIRE_CLIENT_CLASSES = 89,           // "require-client-classes"
+        S_TEST = 90,                             // "test"
+        S_ONLY_IF_REQUIRED = 91,                 // "only-if-required"
+        S_CLIENT_CLASS = 92,                     // "client-class"
+        S_RESERVATIONS = 93,                     // "reservations"
+        S_DUID = 94,                             // "duid"
+        S_HW_ADDRESS = 95,                       // "hw-address"
+        S_CIRCUIT_ID = 96,                       // "circuit-id"
+        S_CLIENT_ID = 97,                        // "client-id"
+        S_HOSTNAME = 98,                         // "hostname"
+        S_FLEX_ID = 99,                          // "flex-id"
+        S_RELAY = 100,                           // "relay"
+        S_IP_ADDRESS = 101,                      // "ip-address"
+        S_IP_ADDRESSES = 102,                    // "ip-addresses"
+        S_HOOKS_LIBRARIES = 103,                 // "hooks-libraries"
+        S_LIBRARY = 104,                         // "library"
+        S_PARAMETERS = 105,                      // "parameters"
+        S_EXPIRED_LEASES_PROCESSING = 106,       // "expired-leases-processing"
+        S_RECLAIM_TIMER_WAIT_TIME = 107,         // "reclaim-timer-wait-time"
+        S_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 108, // "flush-reclaimed-timer-wait-time"
+        S_HOLD_RECLAIMED_TIME = 109,             // "hold-reclaimed-time"
+        S_MAX_RECLAIM_LEASES = 110,              // "max-reclaim-leases"
+        S_MAX_RECLAIM_TIME = 111,                // "max-reclaim-time"
+        S_UNWARNED_RECLAIM_CYCLES = 112,         // "unwarned-reclaim-cycles"
+        S_DHCP4O6_PORT = 113,                    // "dhcp4o6-port"
+        S_CONTROL_SOCKET = 114,                  // "control-socket"
+        S_SOCKET_TYPE = 115,                     // "socket-type"
+        S_SOCKET_NAME = 116,                     // "socket-name"
+        S_DHCP_QUEUE_CONTROL = 117,              // "dhcp-queue-control"
+        S_DHCP_DDNS = 118,                       // "dhcp-ddns"
+        S_ENABLE_UPDATES = 119,                  // "enable-updates"
+        S_QUALIFYING_SUFFIX = 120,               // "qualifying-suffix"
+        S_SERVER_IP = 121,                       // "server-ip"
+        S_SERVER_PORT = 122,                     // "server-port"
+        S_SENDER_IP = 123,                       // "sender-ip"
+        S_SENDER_PORT = 124,                     // "sender-port"
+        S_MAX_QUEUE_SIZE = 125,                  // "max-queue-size"
+        S_NCR_PROTOCOL = 126,                    // "ncr-protocol"
+        S_NCR_FORMAT = 127,                      // "ncr-format"
+        S_OVERRIDE_NO_UPDATE = 128,              // "override-no-update"
+        S_OVERRIDE_CLIENT_UPDATE = 129,          // "override-client-update"
+        S_REPLACE_CLIENT_NAME = 130,             // "replace-client-name"
+        S_GENERATED_PREFIX = 131,                // "generated-prefix"
+        S_TCP = 132,                             // "tcp"
+        S_JSON = 133,                            // "JSON"
+        S_WHEN_PRESENT = 134,                    // "when-present"
+        S_NEVER = 135,                           // "never"
+        S_ALWAYS = 136,                          // "always"
+        S_WHEN_NOT_PRESENT = 137,                // "when-not-present"
+        S_HOSTNAME_CHAR_SET = 138,               // "hostname-char-set"
+        S_HOSTNAME_CHAR_REPLACEMENT = 139,       // "hostname-char-replacement"
+        S_LOGGING = 140,                         // "Logging"
+        S_LOGGERS = 141,                         // "loggers"
+        S_OUTPUT_OPTIONS = 142,                  // "output_options"
+        S_OUTPUT = 143,                          // "output"
+        S_DEBUGLEVEL = 144,                      // "debuglevel"
+        S_RATE_LIMIT = 145,                      // "rate-limit"
+        S_SEVERITY = 146,                        // "severity"
+        S_FLUSH = 147,                           // "flush"
+        S_MAXSIZE = 148,                         // "maxsize"
+        S_MAXVER = 149,                          // "maxver"
+        S_ASYNC = 150,                           // "async"
+        S_QUEUE_SIZE = 151,                      // "queue-size"
+        S_OVERFLOW_POLICY = 152,                 // "overflow-policy"
+        S_DHCP6 = 153,                           // "Dhcp6"
+        S_DHCPDDNS = 154,                        // "DhcpDdns"
+        S_CONTROL_AGENT = 155,                   // "Control-agent"
+        S_TOPLEVEL_JSON = 156,                   // TOPLEVEL_JSON
+        S_TOPLEVEL_DHCP4 = 157,                  // TOPLEVEL_DHCP4
+        S_SUB_DHCP4 = 158,                       // SUB_DHCP4
+        S_SUB_INTERFACES4 = 159,                 // SUB_INTERFACES4
+        S_SUB_SUBNET4 = 160,                     // SUB_SUBNET4
+        S_SUB_POOL4 = 161,                       // SUB_POOL4
+        S_SUB_RESERVATION = 162,                 // SUB_RESERVATION
+        S_SUB_OPTION_DEFS = 163,                 // SUB_OPTION_DEFS
+        S_SUB_OPTION_DEF = 164,                  // SUB_OPTION_DEF
+        S_SUB_OPTION_DATA = 165,                 // SUB_OPTION_DATA
+        S_SUB_HOOKS_LIBRARY = 166,               // SUB_HOOKS_LIBRARY
+        S_SUB_DHCP_DDNS = 167,                   // SUB_DHCP_DDNS
+        S_SUB_LOGGING = 168,                     // SUB_LOGGING
+        S_SUB_CONFIG_CONTROL = 169,              // SUB_CONFIG_CONTROL
+        S_STRING = 170,                          // "constant string"
+        S_INTEGER = 171,                         // "integer"
+        S_FLOAT = 172,                           // "floating point"
+        S_BOOLEAN = 173,                         // "boolean"
+        S_YYACCEPT = 174,                        // $accept
+        S_start = 175,                           // start
+        S_176_1 = 176,                           // $@1
+        S_177_2 = 177,                           // $@2
+        S_178_3 = 178,                           // $@3
+        S_179_4 = 179,                           // $@4
+        S_180_5 = 180,                           // $@5
+        S_181_6 = 181,                           // $@6
+        S_182_7 = 182,                           // $@7
+        S_183_8 = 183,                           // $@8
+        S_184_9 = 184,                           // $@9
+        S_185_10 = 185,                          // $@10
+        S_186_11 = 186,                          // $@11
+        S_187_12 = 187,                          // $@12
+        S_188_13 = 188,                          // $@13
+        S_189_14 = 189,                          // $@14
+        S_value = 190,                           // value
+        S_sub_json = 191,                        // sub_json
+        S_map2 = 192,                            // map2
+        S_193_15 = 193,                          // $@15
+        S_map_value = 194,                       // map_value
+        S_map_content = 195,                     // map_content
+        S_not_empty_map = 196,                   // not_empty_map
+        S_list_generic = 197,                    // list_generic
+        S_198_16 = 198,                          // $@16
+        S_list_content = 199,                    // list_content
+        S_not_empty_list = 200,                  // not_empty_list
+        S_list_strings = 201,                    // list_strings
+        S_202_17 = 202,                          // $@17
+        S_list_strings_content = 203,            // list_strings_content
+        S_not_empty_list_strings = 204,          // not_empty_list_strings
+        S_unknown_map_entry = 205,               // unknown_map_entry
+        S_syntax_map = 206,                      // syntax_map
+        S_207_18 = 207,                          // $@18
+        S_global_objects = 208,                  // global_objects
+        S_global_object = 209,                   // global_object
+        S_dhcp4_object = 210,                    // dhcp4_object
+        S_211_19 = 211,                          // $@19
+        S_sub_dhcp4 = 212,                       // sub_dhcp4
+        S_213_20 = 213,                          // $@20
+        S_global_params = 214,                   // global_params
+        S_global_param = 215,                    // global_param
+        S_valid_lifetime = 216,                  // valid_lifetime
+        S_renew_timer = 217,                     // renew_timer
+        S_rebind_timer = 218,                    // rebind_timer
+        S_decline_probation_period = 219,        // decline_probation_period
+        S_server_tag = 220,                      // server_tag
+        S_221_21 = 221,                          // $@21
+        S_echo_client_id = 222,                  // echo_client_id
+        S_match_client_id = 223,                 // match_client_id
+        S_authoritative = 224,                   // authoritative
+        S_interfaces_config = 225,               // interfaces_config
+        S_226_22 = 226,                          // $@22
+        S_interfaces_config_params = 227,        // interfaces_config_params
+        S_interfaces_config_param = 228,         // interfaces_config_param
+        S_sub_interfaces4 = 229,                 // sub_interfaces4
+        S_230_23 = 230,                          // $@23
+        S_interfaces_list = 231,                 // interfaces_list
+        S_232_24 = 232,                          // $@24
+        S_dhcp_socket_type = 233,                // dhcp_socket_type
+        S_234_25 = 234,                          // $@25
+        S_socket_type = 235,                     // socket_type
+        S_outbound_interface = 236,              // outbound_interface
+        S_237_26 = 237,                          // $@26
+        S_outbound_interface_value = 238,        // outbound_interface_value
+        S_re_detect = 239,                       // re_detect
+        S_lease_database = 240,                  // lease_database
+        S_241_27 = 241,                          // $@27
+        S_sanity_checks = 242,                   // sanity_checks
+        S_243_28 = 243,                          // $@28
+        S_sanity_checks_params = 244,            // sanity_checks_params
+        S_sanity_checks_param = 245,             // sanity_checks_param
+        S_lease_checks = 246,                    // lease_checks
+        S_247_29 = 247,                          // $@29
+        S_hosts_database = 248,                  // hosts_database
+        S_249_30 = 249,                          // $@30
+        S_hosts_databases = 250,                 // hosts_databases
+        S_251_31 = 251,                          // $@31
+        S_database_list = 252,                   // database_list
+        S_not_empty_database_list = 253,         // not_empty_database_list
+        S_database = 254,                        // database
+        S_255_32 = 255,                          // $@32
+        S_database_map_params = 256,             // database_map_params
+        S_database_map_param = 257,              // database_map_param
+        S_database_type = 258,                   // database_type
+        S_259_33 = 259,                          // $@33
+        S_db_type = 260,                         // db_type
+        S_user = 261,                            // user
+        S_262_34 = 262,                          // $@34
+        S_password = 263,                        // password
+        S_264_35 = 264,                          // $@35
+        S_host = 265,                            // host
+        S_266_36 = 266,                          // $@36
+        S_port = 267,                            // port
+        S_name = 268,                            // name
+        S_269_37 = 269,                          // $@37
+        S_persist = 270,                         // persist
+        S_lfc_interval = 271,                    // lfc_interval
+        S_readonly = 272,                        // readonly
+        S_connect_timeout = 273,                 // connect_timeout
+        S_request_timeout = 274,                 // request_timeout
+        S_tcp_keepalive = 275,                   // tcp_keepalive
+        S_tcp_nodelay = 276,                     // tcp_nodelay
+        S_contact_points = 277,                  // contact_points
+        S_278_38 = 278,                          // $@38
+        S_keyspace = 279,                        // keyspace
+        S_280_39 = 280,                          // $@39
+        S_max_reconnect_tries = 281,             // max_reconnect_tries
+        S_reconnect_wait_time = 282,             // reconnect_wait_time
+        S_host_reservation_identifiers = 283,    // host_reservation_identifiers
+        S_284_40 = 284,                          // $@40
+        S_host_reservation_identifiers_list = 285, // host_reservation_identifiers_list
+        S_host_reservation_identifier = 286,     // host_reservation_identifier
+        S_duid_id = 287,                         // duid_id
+        S_hw_address_id = 288,                   // hw_address_id
+        S_circuit_id = 289,                      // circuit_id
+        S_client_id = 290,                       // client_id
+        S_flex_id = 291,                         // flex_id
+        S_hooks_libraries = 292,                 // hooks_libraries
+        S_293_41 = 293,                          // $@41
+        S_hooks_libraries_list = 294,            // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 295,  // not_empty_hooks_libraries_list
+        S_hooks_library = 296,                   // hooks_library
+        S_297_42 = 297,                          // $@42
+        S_sub_hooks_library = 298,               // sub_hooks_library
+        S_299_43 = 299,                          // $@43
+        S_hooks_params = 300,                    // hooks_params
+        S_hooks_param = 301,                     // hooks_param
+        S_library = 302,                         // library
+        S_303_44 = 303,                          // $@44
+        S_parameters = 304,                      // parameters
+        S_305_45 = 305,                          // $@45
+        S_expired_leases_processing = 306,       // expired_leases_processing
+        S_307_46 = 307,                          // $@46
+        S_expired_leases_params = 308,           // expired_leases_params
+        S_expired_leases_param = 309,            // expired_leases_param
+        S_reclaim_timer_wait_time = 310,         // reclaim_timer_wait_time
+        S_flush_reclaimed_timer_wait_time = 311, // flush_reclaimed_timer_wait_time
+        S_hold_reclaimed_time = 312,             // hold_reclaimed_time
+        S_max_reclaim_leases = 313,              // max_reclaim_leases
+        S_max_reclaim_time = 314,                // max_reclaim_time
+        S_unwarned_reclaim_cycles = 315,         // unwarned_reclaim_cycles
+        S_subnet4_list = 316,                    // subnet4_list
+        S_317_47 = 317,                          // $@47
+        S_subnet4_list_content = 318,            // subnet4_list_content
+        S_not_empty_subnet4_list = 319,          // not_empty_subnet4_list
+        S_subnet4 = 320,                         // subnet4
+        S_321_48 = 321,                          // $@48
+        S_sub_subnet4 = 322,                     // sub_subnet4
+        S_323_49 = 323,                          // $@49
+        S_subnet4_params = 324,                  // subnet4_params
+        S_subnet4_param = 325,                   // subnet4_param
+        S_subnet = 326,                          // subnet
+        S_327_50 = 327,                          // $@50
+        S_subnet_4o6_interface = 328,            // subnet_4o6_interface
+        S_329_51 = 329,                          // $@51
+        S_subnet_4o6_interface_id = 330,         // subnet_4o6_interface_id
+        S_331_52 = 331,                          // $@52
+        S_subnet_4o6_subnet = 332,               // subnet_4o6_subnet
+        S_333_53 = 333,                          // $@53
+        S_interface = 334,                       // interface
+        S_335_54 = 335,                          // $@54
+        S_client_class = 336,                    // client_class
+        S_337_55 = 337,                          // $@55
+        S_require_client_classes = 338,          // require_client_classes
+        S_339_56 = 339,                          // $@56
+        S_reservation_mode = 340,                // reservation_mode
+        S_341_57 = 341,                          // $@57
+        S_hr_mode = 342,                         // hr_mode
+        S_id = 343,                              // id
+        S_shared_networks = 344,                 // shared_networks
+        S_345_58 = 345,                          // $@58
+        S_shared_networks_content = 346,         // shared_networks_content
+        S_shared_networks_list = 347,            // shared_networks_list
+        S_shared_network = 348,                  // shared_network
+        S_349_59 = 349,                          // $@59
+        S_shared_network_params = 350,           // shared_network_params
+        S_shared_network_param = 351,            // shared_network_param
+        S_option_def_list = 352,                 // option_def_list
+        S_353_60 = 353,                          // $@60
+        S_sub_option_def_list = 354,             // sub_option_def_list
+        S_355_61 = 355,                          // $@61
+        S_option_def_list_content = 356,         // option_def_list_content
+        S_not_empty_option_def_list = 357,       // not_empty_option_def_list
+        S_option_def_entry = 358,                // option_def_entry
+        S_359_62 = 359,                          // $@62
+        S_sub_option_def = 360,                  // sub_option_def
+        S_361_63 = 361,                          // $@63
+        S_option_def_params = 362,               // option_def_params
+        S_not_empty_option_def_params = 363,     // not_empty_option_def_params
+        S_option_def_param = 364,                // option_def_param
+        S_option_def_name = 365,                 // option_def_name
+        S_code = 366,                            // code
+        S_option_def_code = 367,                 // option_def_code
+        S_option_def_type = 368,                 // option_def_type
+        S_369_64 = 369,                          // $@64
+        S_option_def_record_types = 370,         // option_def_record_types
+        S_371_65 = 371,                          // $@65
+        S_space = 372,                           // space
+        S_373_66 = 373,                          // $@66
+        S_option_def_space = 374,                // option_def_space
+        S_option_def_encapsulate = 375,          // option_def_encapsulate
+        S_376_67 = 376,                          // $@67
+        S_option_def_array = 377,                // option_def_array
+        S_option_data_list = 378,                // option_data_list
+        S_379_68 = 379,                          // $@68
+        S_option_data_list_content = 380,        // option_data_list_content
+        S_not_empty_option_data_list = 381,      // not_empty_option_data_list
+        S_option_data_entry = 382,               // option_data_entry
+        S_383_69 = 383,                          // $@69
+        S_sub_option_data = 384,                 // sub_option_data
+        S_385_70 = 385,                          // $@70
+        S_option_data_params = 386,              // option_data_params
+        S_not_empty_option_data_params = 387,    // not_empty_option_data_params
+        S_option_data_param = 388,               // option_data_param
+        S_option_data_name = 389,                // option_data_name
+        S_option_data_data = 390,                // option_data_data
+        S_391_71 = 391,                          // $@71
+        S_option_data_code = 392,                // option_data_code
+        S_option_data_space = 393,               // option_data_space
+        S_option_data_csv_format = 394,          // option_data_csv_format
+        S_option_data_always_send = 395,         // option_data_always_send
+        S_pools_list = 396,                      // pools_list
+        S_397_72 = 397,                          // $@72
+        S_pools_list_content = 398,              // pools_list_content
+        S_not_empty_pools_list = 399,            // not_empty_pools_list
+        S_pool_list_entry = 400,                 // pool_list_entry
+        S_401_73 = 401,                          // $@73
+        S_sub_pool4 = 402,                       // sub_pool4
+        S_403_74 = 403,                          // $@74
+        S_pool_params = 404,                     // pool_params
+        S_pool_param = 405,                      // pool_param
+        S_pool_entry = 406,                      // pool_entry
+        S_407_75 = 407,                          // $@75
+        S_user_context = 408,                    // user_context
+        S_409_76 = 409,                          // $@76
+        S_comment = 410,                         // comment
+        S_411_77 = 411,                          // $@77
+        S_reservations = 412,                    // reservations
+        S_413_78 = 413,                          // $@78
+        S_reservations_list = 414,               // reservations_list
+        S_not_empty_reservations_list = 415,     // not_empty_reservations_list
+        S_reservation = 416,                     // reservation
+        S_417_79 = 417,                          // $@79
+        S_sub_reservation = 418,                 // sub_reservation
+        S_419_80 = 419,                          // $@80
+        S_reservation_params = 420,              // reservation_params
+        S_not_empty_reservation_params = 421,    // not_empty_reservation_params
+        S_reservation_param = 422,               // reservation_param
+        S_next_server = 423,                     // next_server
+        S_424_81 = 424,                          // $@81
+        S_server_hostname = 425,                 // server_hostname
+        S_426_82 = 426,                          // $@82
+        S_boot_file_name = 427,                  // boot_file_name
+        S_428_83 = 428,                          // $@83
+        S_ip_address = 429,                      // ip_address
+        S_430_84 = 430,                          // $@84
+        S_ip_addresses = 431,                    // ip_addresses
+        S_432_85 = 432,                          // $@85
+        S_duid = 433,                            // duid
+        S_434_86 = 434,                          // $@86
+        S_hw_address = 435,                      // hw_address
+        S_436_87 = 436,                          // $@87
+        S_client_id_value = 437,                 // client_id_value
+        S_438_88 = 438,                          // $@88
+        S_circuit_id_value = 439,                // circuit_id_value
+        S_440_89 = 440,                          // $@89
+        S_flex_id_value = 441,                   // flex_id_value
+        S_442_90 = 442,                          // $@90
+        S_hostname = 443,                        // hostname
+        S_444_91 = 444,                          // $@91
+        S_reservation_client_classes = 445,      // reservation_client_classes
+        S_446_92 = 446,                          // $@92
+        S_relay = 447,                           // relay
+        S_448_93 = 448,                          // $@93
+        S_relay_map = 449,                       // relay_map
+        S_client_classes = 450,                  // client_classes
+        S_451_94 = 451,                          // $@94
+        S_client_classes_list = 452,             // client_classes_list
+        S_client_class_entry = 453,              // client_class_entry
+        S_454_95 = 454,                          // $@95
+        S_client_class_params = 455,             // client_class_params
+        S_not_empty_client_class_params = 456,   // not_empty_client_class_params
+        S_client_class_param = 457,              // client_class_param
+        S_client_class_name = 458,               // client_class_name
+        S_client_class_test = 459,               // client_class_test
+        S_460_96 = 460,                          // $@96
+        S_only_if_required = 461,                // only_if_required
+        S_dhcp4o6_port = 462,                    // dhcp4o6_port
+        S_control_socket = 463,                  // control_socket
+        S_464_97 = 464,                          // $@97
+        S_control_socket_params = 465,           // control_socket_params
+        S_control_socket_param = 466,            // control_socket_param
+        S_control_socket_type = 467,             // control_socket_type
+        S_468_98 = 468,                          // $@98
+        S_control_socket_name = 469,             // control_socket_name
+        S_470_99 = 470,                          // $@99
+        S_dhcp_queue_control = 471,              // dhcp_queue_control
+        S_472_100 = 472,                         // $@100
+        S_dhcp_ddns = 473,                       // dhcp_ddns
+        S_474_101 = 474,                         // $@101
+        S_sub_dhcp_ddns = 475,                   // sub_dhcp_ddns
+        S_476_102 = 476,                         // $@102
+        S_dhcp_ddns_params = 477,                // dhcp_ddns_params
+        S_dhcp_ddns_param = 478,                 // dhcp_ddns_param
+        S_enable_updates = 479,                  // enable_updates
+        S_qualifying_suffix = 480,               // qualifying_suffix
+        S_481_103 = 481,                         // $@103
+        S_server_ip = 482,                       // server_ip
+        S_483_104 = 483,                         // $@104
+        S_server_port = 484,                     // server_port
+        S_sender_ip = 485,                       // sender_ip
+        S_486_105 = 486,                         // $@105
+        S_sender_port = 487,                     // sender_port
+        S_max_queue_size = 488,                  // max_queue_size
+        S_ncr_protocol = 489,                    // ncr_protocol
+        S_490_106 = 490,                         // $@106
+        S_ncr_protocol_value = 491,              // ncr_protocol_value
+        S_ncr_format = 492,                      // ncr_format
+        S_493_107 = 493,                         // $@107
+        S_override_no_update = 494,              // override_no_update
+        S_override_client_update = 495,          // override_client_update
+        S_replace_client_name = 496,             // replace_client_name
+        S_497_108 = 497,                         // $@108
+        S_replace_client_name_value = 498,       // replace_client_name_value
+        S_generated_prefix = 499,                // generated_prefix
+        S_500_109 = 500,                         // $@109
+        S_hostname_char_set = 501,               // hostname_char_set
+        S_502_110 = 502,                         // $@110
+        S_hostname_char_replacement = 503,       // hostname_char_replacement
+        S_504_111 = 504,                         // $@111
+        S_dhcp6_json_object = 505,               // dhcp6_json_object
+        S_506_112 = 506,                         // $@112
+        S_dhcpddns_json_object = 507,            // dhcpddns_json_object
+        S_508_113 = 508,                         // $@113
+        S_control_agent_json_object = 509,       // control_agent_json_object
+        S_510_114 = 510,                         // $@114
+        S_config_control = 511,                  // config_control
+        S_512_115 = 512,                         // $@115
+        S_sub_config_control = 513,              // sub_config_control
+        S_514_116 = 514,                         // $@116
+        S_config_control_params = 515,           // config_control_params
+        S_config_control_param = 516,            // config_control_param
+        S_config_databases = 517,                // config_databases
+        S_518_117 = 518,                         // $@117
+        S_config_fetch_wait_time = 519,          // config_fetch_wait_time
+        S_logging_object = 520,                  // logging_object
+        S_521_118 = 521,                         // $@118
+        S_sub_logging = 522,                     // sub_logging
+        S_523_119 = 523,                         // $@119
+        S_logging_params = 524,                  // logging_params
+        S_logging_param = 525,                   // logging_param
+        S_loggers = 526,                         // loggers
+        S_527_120 = 527,                         // $@120
+        S_loggers_entries = 528,                 // loggers_entries
+        S_logger_entry = 529,                    // logger_entry
+        S_530_121 = 530,                         // $@121
+        S_logger_params = 531,                   // logger_params
+        S_logger_param = 532,                    // logger_param
+        S_debuglevel = 533,                      // debuglevel
+        S_severity = 534,                        // severity
+        S_535_122 = 535,                         // $@122
+        S_rate_limit = 536,                      // rate_limit
+        S_537_123 = 537,                         // $@123
+        S_output_options_list = 538,             // output_options_list
+        S_539_124 = 539,                         // $@124
+        S_output_options_list_content = 540,     // output_options_list_content
+        S_output_entry = 541,                    // output_entry
+        S_542_125 = 542,                         // $@125
+        S_output_params_list = 543,              // output_params_list
+        S_output_params = 544,                   // output_params
+        S_output = 545,                          // output
+        S_546_126 = 546,                         // $@126
+        S_flush = 547,                           // flush
+        S_maxsize = 548,                         // maxsize
+        S_maxver = 549,                          // maxver
+        S_async = 550,                           // async
+        S_queue_size = 551,                      // queue_size
+        S_overflow_policy = 552,                 // overflow_policy
+        S_553_127 = 553                          // $@127
+      };
+    };
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -737,59 +1263,215 @@ namespace isc { namespace dhcp {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
 
-      /// Move or copy constructor.
-      basic_symbol (YY_RVREF (basic_symbol) other);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
 
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
 
-      /// Constructor for valueless symbols, and symbols from each type.
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, location_type&& l);
-#else
-      basic_symbol (typename Base::kind_type t, const location_type& l);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l);
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
 
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
       /// Destroy the symbol.
-      ~basic_symbol ();
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
 
       /// Destroy contents, and record that is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.template destroy< ElementPtr > ();
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.template destroy< bool > ();
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.template destroy< double > ();
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.template destroy< int64_t > ();
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return Dhcp4Parser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
       /// Whether empty.
-      bool empty () const;
+      bool empty () const YY_NOEXCEPT;
 
       /// Destructive move, \a s is emptied into this.
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -797,51 +1479,137 @@ namespace isc { namespace dhcp {
     private:
 #if YY_CPLUSPLUS < 201103L
       /// Assignment operator.
-      basic_symbol& operator= (const basic_symbol& other);
+      basic_symbol& operator= (const basic_symbol& that);
 #endif
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
-      /// Copy constructor.
-      by_type (const by_type& other);
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
 
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_PARSER4_error <= tok && tok <= token::TOKEN_SUB_CONFIG_CONTROL));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, bool v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const bool& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_BOOLEAN);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, double v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const double& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_FLOAT);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_INTEGER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        PARSER4__ASSERT (tok == token::TOKEN_STRING);
+#endif
+      }
+    };
 
     /// Build a parser object.
     Dhcp4Parser (isc::dhcp::Parser4Context& ctx_yyarg);
     virtual ~Dhcp4Parser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    Dhcp4Parser (const Dhcp4Parser&) = delete;
+    /// Non copyable.
+    Dhcp4Parser& operator= (const Dhcp4Parser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -872,2428 +1640,3189 @@ namespace isc { namespace dhcp {
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Symbol constructors declarations.
-    static
-    symbol_type
-    make_END (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COMMA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COLON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LSQUARE_BRACKET (YY_COPY (location_type) l);
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
 
-    static
-    symbol_type
-    make_RSQUARE_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LCURLY_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RCURLY_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NULL_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONFIG_CONTROL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONFIG_DATABASES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTERFACES_CONFIG (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTERFACES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP_SOCKET_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RAW (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_UDP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUTBOUND_INTERFACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SAME_AS_INBOUND (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_USE_ROUTING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RE_DETECT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SANITY_CHECKS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LEASE_CHECKS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ECHO_CLIENT_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MATCH_CLIENT_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_AUTHORITATIVE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NEXT_SERVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_HOSTNAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_BOOT_FILE_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LEASE_DATABASE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTS_DATABASE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTS_DATABASES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MEMFILE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MYSQL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_POSTGRESQL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CQL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_USER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PASSWORD (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOST (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PERSIST (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LFC_INTERVAL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_READONLY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONNECT_TIMEOUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONTACT_POINTS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_KEYSPACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_RECONNECT_TRIES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RECONNECT_WAIT_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REQUEST_TIMEOUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TCP_KEEPALIVE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TCP_NODELAY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_VALID_LIFETIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RENEW_TIMER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REBIND_TIMER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DECLINE_PROBATION_PERIOD (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_TAG (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBNET4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBNET_4O6_INTERFACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBNET_4O6_INTERFACE_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBNET_4O6_SUBNET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OPTION_DEF (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OPTION_DATA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DATA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CODE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SPACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CSV_FORMAT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ALWAYS_SEND (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RECORD_TYPES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ENCAPSULATE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ARRAY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SHARED_NETWORKS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_POOLS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_POOL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_USER_CONTEXT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COMMENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBNET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTERFACE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RESERVATION_MODE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DISABLED (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUT_OF_POOL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_GLOBAL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ALL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOST_RESERVATION_IDENTIFIERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CLIENT_CLASSES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REQUIRE_CLIENT_CLASSES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TEST (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ONLY_IF_REQUIRED (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CLIENT_CLASS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RESERVATIONS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DUID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HW_ADDRESS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CIRCUIT_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CLIENT_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTNAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLEX_ID (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RELAY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_IP_ADDRESS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_IP_ADDRESSES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOOKS_LIBRARIES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LIBRARY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PARAMETERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_EXPIRED_LEASES_PROCESSING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RECLAIM_TIMER_WAIT_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOLD_RECLAIMED_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_RECLAIM_LEASES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_RECLAIM_TIME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_UNWARNED_RECLAIM_CYCLES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP4O6_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONTROL_SOCKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SOCKET_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SOCKET_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP_QUEUE_CONTROL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP_DDNS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ENABLE_UPDATES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_QUALIFYING_SUFFIX (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_IP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SERVER_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SENDER_IP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SENDER_PORT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAX_QUEUE_SIZE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NCR_PROTOCOL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NCR_FORMAT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OVERRIDE_NO_UPDATE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OVERRIDE_CLIENT_UPDATE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_REPLACE_CLIENT_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_GENERATED_PREFIX (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TCP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_JSON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_WHEN_PRESENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NEVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_ALWAYS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_WHEN_NOT_PRESENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTNAME_CHAR_SET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOSTNAME_CHAR_REPLACEMENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LOGGING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LOGGERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUTPUT_OPTIONS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUTPUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DEBUGLEVEL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SEVERITY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLUSH (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAXSIZE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAXVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP6 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCPDDNS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONTROL_AGENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TOPLEVEL_JSON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_TOPLEVEL_DHCP4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_DHCP4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_INTERFACES4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_SUBNET4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_POOL4 (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_RESERVATION (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_OPTION_DEFS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_OPTION_DEF (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_OPTION_DATA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_HOOKS_LIBRARY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_DHCP_DDNS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_LOGGING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUB_CONFIG_CONTROL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_STRING (YY_COPY (std::string) v, YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTEGER (YY_COPY (int64_t) v, YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLOAT (YY_COPY (double) v, YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_BOOLEAN (YY_COPY (bool) v, YY_COPY (location_type) l);
-
-
-
-  private:
-    /// This class is not copyable.
-    Dhcp4Parser (const Dhcp4Parser&);
-    Dhcp4Parser& operator= (const Dhcp4Parser&);
-
-    /// State numbers.
-    typedef int state_type;
-
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
-
-    /// Compute post-reduction state.
-    /// \param yystate   the current state
-    /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
-
-    /// Whether the given \c yypact_ value indicates a defaulted state.
-    /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
-
-    /// Whether the given \c yytable_ value indicates a syntax error.
-    /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
-
-    static const short yypact_ninf_;
-    static const signed char yytable_ninf_;
-
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
-
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
-
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned short yydefact_[];
-
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
-
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
-
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
-
-  static const short yycheck_[];
-
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned short yystos_[];
-
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned short yyr1_[];
-
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
-
-
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
-
-
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
-#if PARSER4_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
-    /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
-    /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
-
-    /// Debugging level.
-    int yydebug_;
-    /// Debug stream.
-    std::ostream* yycdebug_;
-
-    /// \brief Display a symbol type, value and location.
-    /// \param yyo    The output stream.
-    /// \param yysym  The symbol.
-    template <typename Base>
-    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
-#endif
-
-    /// \brief Reclaim the memory associated to a symbol.
-    /// \param yymsg     Why this token is reclaimed.
-    ///                  If null, print nothing.
-    /// \param yysym     The symbol.
-    template <typename Base>
-    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
-
-  private:
-    /// Type access provider for state based symbols.
-    struct by_state
-    {
-      /// Default constructor.
-      by_state ();
-
-      /// The symbol type as needed by the constructor.
-      typedef state_type kind_type;
-
-      /// Constructor.
-      by_state (kind_type s);
-
-      /// Copy constructor.
-      by_state (const by_state& other);
-
-      /// Record that this symbol is empty.
-      void clear ();
-
-      /// Steal the symbol type from \a that.
-      void move (by_state& that);
-
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
-
-      /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
-
-      /// The state.
-      /// \a empty when empty.
-      state_type state;
-    };
-
-    /// "Internal" symbol: element of the stack.
-    struct stack_symbol_type : basic_symbol<by_state>
-    {
-      /// Superclass.
-      typedef basic_symbol<by_state> super_type;
-      /// Construct an empty symbol.
-      stack_symbol_type ();
-      /// Move or copy construction.
-      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
-      /// Steal the contents from \a sym to build this.
-      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
-#if YY_CPLUSPLUS < 201103L
-      /// Assignment, needed by push_back by some old implementations.
-      /// Moves the contents of that.
-      stack_symbol_type& operator= (stack_symbol_type& that);
-#endif
-    };
-
-    /// Stack type.
-    typedef stack<stack_symbol_type> stack_type;
-
-    /// The stack.
-    stack_type yystack_;
-
-    /// Push a new state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param sym  the symbol
-    /// \warning the contents of \a s.value is stolen.
-    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
-
-    /// Push a new look ahead token on the state on the stack.
-    /// \param m    a debug message to display
-    ///             if null, no trace is output.
-    /// \param s    the state
-    /// \param sym  the symbol (for its value and location).
-    /// \warning the contents of \a sym.value is stolen.
-    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
-
-    /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
-
-    /// Constants.
-    enum
-    {
-      yyeof_ = 0,
-      yylast_ = 1000,     ///< Last index in yytable_.
-      yynnts_ = 373,  ///< Number of nonterminal symbols.
-      yyfinal_ = 30, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 169  ///< Number of tokens.
-    };
-
-
-    // User arguments.
-    isc::dhcp::Parser4Context& ctx;
-  };
-
-  // Symbol number corresponding to token number t.
-  inline
-  Dhcp4Parser::token_number_type
-  Dhcp4Parser::yytranslate_ (token_type t)
-  {
-    static
-    const token_number_type
-    translate_table[] =
-    {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
-     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
-     165,   166,   167,   168
-    };
-    const unsigned user_token_number_max_ = 423;
-    const token_number_type undef_token_ = 2;
-
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
-    else
-      return undef_token_;
-  }
-
-  inline
-  Dhcp4Parser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
-  // basic_symbol.
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-    , location ()
-  {}
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (YY_RVREF (basic_symbol) other)
-    : Base (YY_MOVE (other))
-    , value ()
-    , location (YY_MOVE (other.location))
-  {
-    switch (other.type_get ())
-    {
-      case 185: // value
-      case 189: // map_value
-      case 230: // socket_type
-      case 233: // outbound_interface_value
-      case 255: // db_type
-      case 337: // hr_mode
-      case 486: // ncr_protocol_value
-      case 493: // replace_client_name_value
-        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (other.value));
-        break;
-
-      case 168: // "boolean"
-        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (other.value));
-        break;
-
-      case 167: // "floating point"
-        value.YY_MOVE_OR_COPY< double > (YY_MOVE (other.value));
-        break;
-
-      case 166: // "integer"
-        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (other.value));
-        break;
-
-      case 165: // "constant string"
-        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (other.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-
-
-  // Implementation of basic_symbol constructor for each type.
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, location_type&& l)
-    : Base (t)
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const location_type& l)
-    : Base (t)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-
-
-  template <typename Base>
-  Dhcp4Parser::basic_symbol<Base>::~basic_symbol ()
-  {
-    clear ();
-  }
-
-  template <typename Base>
-  void
-  Dhcp4Parser::basic_symbol<Base>::clear ()
-  {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
-    {
-   default:
-      break;
-    }
-
-    // Type destructor.
-  switch (yytype)
-    {
-      case 185: // value
-      case 189: // map_value
-      case 230: // socket_type
-      case 233: // outbound_interface_value
-      case 255: // db_type
-      case 337: // hr_mode
-      case 486: // ncr_protocol_value
-      case 493: // replace_client_name_value
-        value.template destroy< ElementPtr > ();
-        break;
-
-      case 168: // "boolean"
-        value.template destroy< bool > ();
-        break;
-
-      case 167: // "floating point"
-        value.template destroy< double > ();
-        break;
-
-      case 166: // "integer"
-        value.template destroy< int64_t > ();
-        break;
-
-      case 165: // "constant string"
-        value.template destroy< std::string > ();
-        break;
-
-      default:
-        break;
-    }
-
-    Base::clear ();
-  }
-
-  template <typename Base>
-  bool
-  Dhcp4Parser::basic_symbol<Base>::empty () const
-  {
-    return Base::type_get () == empty_symbol;
-  }
-
-  template <typename Base>
-  void
-  Dhcp4Parser::basic_symbol<Base>::move (basic_symbol& s)
-  {
-    super_type::move (s);
-    switch (this->type_get ())
-    {
-      case 185: // value
-      case 189: // map_value
-      case 230: // socket_type
-      case 233: // outbound_interface_value
-      case 255: // db_type
-      case 337: // hr_mode
-      case 486: // ncr_protocol_value
-      case 493: // replace_client_name_value
-        value.move< ElementPtr > (YY_MOVE (s.value));
-        break;
-
-      case 168: // "boolean"
-        value.move< bool > (YY_MOVE (s.value));
-        break;
-
-      case 167: // "floating point"
-        value.move< double > (YY_MOVE (s.value));
-        break;
-
-      case 166: // "integer"
-        value.move< int64_t > (YY_MOVE (s.value));
-        break;
-
-      case 165: // "constant string"
-        value.move< std::string > (YY_MOVE (s.value));
-        break;
-
-      default:
-        break;
-    }
-
-    location = YY_MOVE (s.location);
-  }
-
-  // by_type.
-  inline
-  Dhcp4Parser::by_type::by_type ()
-    : type (empty_symbol)
-  {}
-
-  inline
-  Dhcp4Parser::by_type::by_type (const by_type& other)
-    : type (other.type)
-  {}
-
-  inline
-  Dhcp4Parser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
-  {}
-
-  inline
-  void
-  Dhcp4Parser::by_type::clear ()
-  {
-    type = empty_symbol;
-  }
-
-  inline
-  void
-  Dhcp4Parser::by_type::move (by_type& that)
-  {
-    type = that.type;
-    that.clear ();
-  }
-
-  inline
-  int
-  Dhcp4Parser::by_type::type_get () const
-  {
-    return type;
-  }
-
-  inline
-  Dhcp4Parser::token_type
-  Dhcp4Parser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
-
-  // Implementation of make_symbol for each symbol type.
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_END (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_END, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_COMMA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COMMA, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_COLON (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COLON, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LSQUARE_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RSQUARE_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LCURLY_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RCURLY_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NULL_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP4 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP4, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONFIG_CONTROL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONFIG_CONTROL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONFIG_DATABASES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONFIG_DATABASES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTERFACES_CONFIG (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES_CONFIG, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTERFACES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_INTERFACES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP_SOCKET_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP_SOCKET_TYPE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RAW (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RAW, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_UDP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_UDP, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OUTBOUND_INTERFACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUTBOUND_INTERFACE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SAME_AS_INBOUND (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SAME_AS_INBOUND, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_USE_ROUTING (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_USE_ROUTING, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RE_DETECT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RE_DETECT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SANITY_CHECKS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SANITY_CHECKS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LEASE_CHECKS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LEASE_CHECKS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ECHO_CLIENT_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ECHO_CLIENT_ID, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MATCH_CLIENT_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MATCH_CLIENT_ID, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_AUTHORITATIVE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_AUTHORITATIVE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NEXT_SERVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NEXT_SERVER, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SERVER_HOSTNAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_HOSTNAME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_BOOT_FILE_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_BOOT_FILE_NAME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LEASE_DATABASE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LEASE_DATABASE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOSTS_DATABASE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTS_DATABASE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOSTS_DATABASES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTS_DATABASES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TYPE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MEMFILE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MEMFILE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MYSQL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MYSQL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_POSTGRESQL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_POSTGRESQL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CQL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CQL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_USER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_USER, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_PASSWORD (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PASSWORD, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOST (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOST, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PORT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_PERSIST (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PERSIST, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LFC_INTERVAL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LFC_INTERVAL, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_READONLY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_READONLY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONNECT_TIMEOUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONNECT_TIMEOUT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONTACT_POINTS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONTACT_POINTS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_KEYSPACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_KEYSPACE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAX_RECONNECT_TRIES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECONNECT_TRIES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RECONNECT_WAIT_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_REQUEST_TIMEOUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REQUEST_TIMEOUT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TCP_KEEPALIVE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TCP_KEEPALIVE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TCP_NODELAY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TCP_NODELAY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_VALID_LIFETIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_VALID_LIFETIME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RENEW_TIMER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RENEW_TIMER, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_REBIND_TIMER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REBIND_TIMER, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DECLINE_PROBATION_PERIOD (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SERVER_TAG (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_TAG, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET4 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBNET4, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET_4O6_INTERFACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET_4O6_INTERFACE_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE_ID, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET_4O6_SUBNET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBNET_4O6_SUBNET, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OPTION_DEF (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DEF, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OPTION_DATA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OPTION_DATA, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NAME, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DATA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DATA, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CODE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CODE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SPACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SPACE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CSV_FORMAT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CSV_FORMAT, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ALWAYS_SEND (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS_SEND, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RECORD_TYPES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RECORD_TYPES, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ENCAPSULATE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ENCAPSULATE, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ARRAY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ARRAY, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SHARED_NETWORKS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SHARED_NETWORKS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_POOLS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_POOLS, YY_MOVE (l));
-  }
-
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_POOL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_POOL, YY_MOVE (l));
-  }
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARSER4_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARSER4_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARSER4_UNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_COLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NULL_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NULL_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_CONTROL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_CONTROL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_CONTROL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_CONTROL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_DATABASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_DATABASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_DATABASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_DATABASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONFIG_FETCH_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_FETCH_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONFIG_FETCH_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONFIG_FETCH_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES_CONFIG (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES_CONFIG, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACES (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_SOCKET_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_SOCKET_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RAW (location_type l)
+      {
+        return symbol_type (token::TOKEN_RAW, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RAW (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RAW, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UDP (location_type l)
+      {
+        return symbol_type (token::TOKEN_UDP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UDP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UDP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTBOUND_INTERFACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTBOUND_INTERFACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTBOUND_INTERFACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTBOUND_INTERFACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SAME_AS_INBOUND (location_type l)
+      {
+        return symbol_type (token::TOKEN_SAME_AS_INBOUND, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SAME_AS_INBOUND (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SAME_AS_INBOUND, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USE_ROUTING (location_type l)
+      {
+        return symbol_type (token::TOKEN_USE_ROUTING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USE_ROUTING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USE_ROUTING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RE_DETECT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RE_DETECT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RE_DETECT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RE_DETECT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SANITY_CHECKS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SANITY_CHECKS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SANITY_CHECKS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SANITY_CHECKS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_CHECKS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_CHECKS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_CHECKS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_CHECKS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ECHO_CLIENT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ECHO_CLIENT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ECHO_CLIENT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ECHO_CLIENT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MATCH_CLIENT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_MATCH_CLIENT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MATCH_CLIENT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MATCH_CLIENT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_AUTHORITATIVE (location_type l)
+      {
+        return symbol_type (token::TOKEN_AUTHORITATIVE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_AUTHORITATIVE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_AUTHORITATIVE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEXT_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_NEXT_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEXT_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NEXT_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_HOSTNAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_HOSTNAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOT_FILE_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOT_FILE_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOT_FILE_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOT_FILE_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LEASE_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LEASE_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LEASE_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTS_DATABASE (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTS_DATABASE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTS_DATABASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTS_DATABASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTS_DATABASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MEMFILE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MEMFILE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MEMFILE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MYSQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MYSQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MYSQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POSTGRESQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POSTGRESQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POSTGRESQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CQL (location_type l)
+      {
+        return symbol_type (token::TOKEN_CQL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CQL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CQL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PASSWORD (location_type l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PASSWORD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PASSWORD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PERSIST (location_type l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PERSIST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PERSIST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LFC_INTERVAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LFC_INTERVAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LFC_INTERVAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_READONLY (location_type l)
+      {
+        return symbol_type (token::TOKEN_READONLY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_READONLY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_READONLY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONNECT_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTACT_POINTS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTACT_POINTS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTACT_POINTS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTACT_POINTS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_KEYSPACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_KEYSPACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_KEYSPACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_KEYSPACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECONNECT_TRIES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECONNECT_TRIES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECONNECT_TRIES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECONNECT_TRIES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECONNECT_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECONNECT_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECONNECT_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REQUEST_TIMEOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_REQUEST_TIMEOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REQUEST_TIMEOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REQUEST_TIMEOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP_KEEPALIVE (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP_KEEPALIVE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP_KEEPALIVE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP_KEEPALIVE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP_NODELAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP_NODELAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP_NODELAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP_NODELAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VALID_LIFETIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VALID_LIFETIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_VALID_LIFETIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RENEW_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RENEW_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RENEW_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REBIND_TIMER (location_type l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REBIND_TIMER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REBIND_TIMER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (location_type l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DECLINE_PROBATION_PERIOD (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DECLINE_PROBATION_PERIOD, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_TAG (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_TAG, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_TAG (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_TAG, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET_4O6_INTERFACE_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_INTERFACE_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET_4O6_SUBNET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_SUBNET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET_4O6_SUBNET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET_4O6_SUBNET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_CODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SPACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SPACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SPACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SPACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CSV_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CSV_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CSV_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS_SEND (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_SEND, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS_SEND (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS_SEND, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECORD_TYPES (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECORD_TYPES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECORD_TYPES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENCAPSULATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENCAPSULATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENCAPSULATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ARRAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ARRAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ARRAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SHARED_NETWORKS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SHARED_NETWORKS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SHARED_NETWORKS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SHARED_NETWORKS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOLS (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOLS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOLS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOLS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER_CONTEXT (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER_CONTEXT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBNET (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBNET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBNET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTERFACE (location_type l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTERFACE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTERFACE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATION_MODE (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATION_MODE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATION_MODE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DISABLED (location_type l)
+      {
+        return symbol_type (token::TOKEN_DISABLED, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DISABLED (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DISABLED, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUT_OF_POOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUT_OF_POOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUT_OF_POOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUT_OF_POOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GLOBAL (location_type l)
+      {
+        return symbol_type (token::TOKEN_GLOBAL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GLOBAL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GLOBAL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALL (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOST_RESERVATION_IDENTIFIERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REQUIRE_CLIENT_CLASSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_REQUIRE_CLIENT_CLASSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REQUIRE_CLIENT_CLASSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REQUIRE_CLIENT_CLASSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TEST (location_type l)
+      {
+        return symbol_type (token::TOKEN_TEST, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TEST (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TEST, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ONLY_IF_REQUIRED (location_type l)
+      {
+        return symbol_type (token::TOKEN_ONLY_IF_REQUIRED, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ONLY_IF_REQUIRED (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ONLY_IF_REQUIRED, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_CLASS (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_CLASS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_CLASS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RESERVATIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RESERVATIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RESERVATIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DUID (location_type l)
+      {
+        return symbol_type (token::TOKEN_DUID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DUID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DUID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HW_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HW_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HW_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CIRCUIT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_CIRCUIT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CIRCUIT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CIRCUIT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CLIENT_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CLIENT_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CLIENT_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLEX_ID (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLEX_ID, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLEX_ID (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLEX_ID, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RELAY (location_type l)
+      {
+        return symbol_type (token::TOKEN_RELAY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RELAY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RELAY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESS (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_IP_ADDRESSES (location_type l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESSES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_IP_ADDRESSES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_IP_ADDRESSES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARAMETERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARAMETERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (location_type l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_EXPIRED_LEASES_PROCESSING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RECLAIM_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOLD_RECLAIMED_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_LEASES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_RECLAIM_TIME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (location_type l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UNWARNED_RECLAIM_CYCLES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4O6_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4O6_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4O6_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTROL_SOCKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTROL_SOCKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_QUEUE_CONTROL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_QUEUE_CONTROL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_QUEUE_CONTROL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_QUEUE_CONTROL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ENABLE_UPDATES (location_type l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ENABLE_UPDATES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ENABLE_UPDATES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUALIFYING_SUFFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SERVER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SERVER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SERVER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_IP (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_IP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_IP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SENDER_PORT (location_type l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SENDER_PORT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SENDER_PORT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAX_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_PROTOCOL (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_PROTOCOL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_PROTOCOL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NCR_FORMAT (location_type l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NCR_FORMAT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NCR_FORMAT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_NO_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERRIDE_CLIENT_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_REPLACE_CLIENT_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_GENERATED_PREFIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_GENERATED_PREFIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_GENERATED_PREFIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TCP (location_type l)
+      {
+        return symbol_type (token::TOKEN_TCP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TCP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TCP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NEVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_NEVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NEVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NEVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ALWAYS (location_type l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ALWAYS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ALWAYS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_WHEN_NOT_PRESENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_SET (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_SET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_SET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_SET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_REPLACEMENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_REPLACEMENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOSTNAME_CHAR_REPLACEMENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOSTNAME_CHAR_REPLACEMENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEBUGLEVEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEBUGLEVEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEVERITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEVERITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLUSH (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLUSH (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAXSIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAXSIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAXVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAXVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP6 (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP6 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP6, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCPDDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCPDDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCPDDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTROL_AGENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_AGENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTROL_AGENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_AGENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_TOPLEVEL_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_TOPLEVEL_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_INTERFACES4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_INTERFACES4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_INTERFACES4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_SUBNET4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_SUBNET4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_SUBNET4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_POOL4 (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL4, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_POOL4 (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_POOL4, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_RESERVATION (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_RESERVATION (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_RESERVATION, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DEFS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEFS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DEFS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEFS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_OPTION_DATA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_OPTION_DATA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_HOOKS_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_DHCP_DDNS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_DHCP_DDNS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUB_CONFIG_CONTROL (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUB_CONFIG_CONTROL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUB_CONFIG_CONTROL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUB_CONFIG_CONTROL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STRING, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER (int64_t v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER (const int64_t& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (double v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const double& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOLEAN (bool v, location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOLEAN (const bool& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, v, l);
+      }
+#endif
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_USER_CONTEXT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_USER_CONTEXT, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_COMMENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COMMENT, YY_MOVE (l));
-  }
+    class context
+    {
+    public:
+      context (const Dhcp4Parser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUBNET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBNET, YY_MOVE (l));
-  }
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTERFACE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_INTERFACE, YY_MOVE (l));
-  }
+    private:
+      const Dhcp4Parser& yyparser_;
+      const symbol_type& yyla_;
+    };
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ID, YY_MOVE (l));
-  }
+  private:
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    Dhcp4Parser (const Dhcp4Parser&);
+    /// Non copyable.
+    Dhcp4Parser& operator= (const Dhcp4Parser&);
+#endif
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RESERVATION_MODE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RESERVATION_MODE, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DISABLED (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DISABLED, YY_MOVE (l));
-  }
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OUT_OF_POOL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUT_OF_POOL, YY_MOVE (l));
-  }
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_GLOBAL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_GLOBAL, YY_MOVE (l));
-  }
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
+    /// Compute post-reduction state.
+    /// \param yystate   the current state
+    /// \param yysym     the nonterminal to push on the stack
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ALL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ALL, YY_MOVE (l));
-  }
+    /// Whether the given \c yypact_ value indicates a defaulted state.
+    /// \param yyvalue   the value to check
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOST_RESERVATION_IDENTIFIERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOST_RESERVATION_IDENTIFIERS, YY_MOVE (l));
-  }
+    /// Whether the given \c yytable_ value indicates a syntax error.
+    /// \param yyvalue   the value to check
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CLIENT_CLASSES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASSES, YY_MOVE (l));
-  }
+    static const short yypact_ninf_;
+    static const signed char yytable_ninf_;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_REQUIRE_CLIENT_CLASSES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REQUIRE_CLIENT_CLASSES, YY_MOVE (l));
-  }
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TEST (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TEST, YY_MOVE (l));
-  }
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ONLY_IF_REQUIRED (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ONLY_IF_REQUIRED, YY_MOVE (l));
-  }
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CLIENT_CLASS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_CLASS, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RESERVATIONS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RESERVATIONS, YY_MOVE (l));
-  }
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DUID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DUID, YY_MOVE (l));
-  }
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const short yydefact_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HW_ADDRESS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HW_ADDRESS, YY_MOVE (l));
-  }
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CIRCUIT_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CIRCUIT_ID, YY_MOVE (l));
-  }
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CLIENT_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CLIENT_ID, YY_MOVE (l));
-  }
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOSTNAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME, YY_MOVE (l));
-  }
+    static const short yycheck_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_FLEX_ID (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLEX_ID, YY_MOVE (l));
-  }
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const short yystos_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RELAY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RELAY, YY_MOVE (l));
-  }
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const short yyr1_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_IP_ADDRESS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESS, YY_MOVE (l));
-  }
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_IP_ADDRESSES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_IP_ADDRESSES, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOOKS_LIBRARIES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOOKS_LIBRARIES, YY_MOVE (l));
-  }
+#if PARSER4_DEBUG
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
+    /// Report on the debug stream that the rule \a r is going to be reduced.
+    virtual void yy_reduce_print_ (int r) const;
+    /// Print the state stack on the debug stream.
+    virtual void yy_stack_print_ () const;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LIBRARY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LIBRARY, YY_MOVE (l));
-  }
+    /// Debugging level.
+    int yydebug_;
+    /// Debug stream.
+    std::ostream* yycdebug_;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_PARAMETERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PARAMETERS, YY_MOVE (l));
-  }
+    /// \brief Display a symbol kind, value and location.
+    /// \param yyo    The output stream.
+    /// \param yysym  The symbol.
+    template <typename Base>
+    void yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const;
+#endif
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_EXPIRED_LEASES_PROCESSING (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_EXPIRED_LEASES_PROCESSING, YY_MOVE (l));
-  }
+    /// \brief Reclaim the memory associated to a symbol.
+    /// \param yymsg     Why this token is reclaimed.
+    ///                  If null, print nothing.
+    /// \param yysym     The symbol.
+    template <typename Base>
+    void yy_destroy_ (const char* yymsg, basic_symbol<Base>& yysym) const;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_RECLAIM_TIMER_WAIT_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RECLAIM_TIMER_WAIT_TIME, YY_MOVE (l));
-  }
+  private:
+    /// Type access provider for state based symbols.
+    struct by_state
+    {
+      /// Default constructor.
+      by_state () YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_FLUSH_RECLAIMED_TIMER_WAIT_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME, YY_MOVE (l));
-  }
+      /// The symbol kind as needed by the constructor.
+      typedef state_type kind_type;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOLD_RECLAIMED_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, YY_MOVE (l));
-  }
+      /// Constructor.
+      by_state (kind_type s) YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAX_RECLAIM_LEASES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_LEASES, YY_MOVE (l));
-  }
+      /// Copy constructor.
+      by_state (const by_state& that) YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAX_RECLAIM_TIME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_RECLAIM_TIME, YY_MOVE (l));
-  }
+      /// Record that this symbol is empty.
+      void clear () YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_UNWARNED_RECLAIM_CYCLES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_UNWARNED_RECLAIM_CYCLES, YY_MOVE (l));
-  }
+      /// Steal the symbol kind from \a that.
+      void move (by_state& that);
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP4O6_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP4O6_PORT, YY_MOVE (l));
-  }
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONTROL_SOCKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_SOCKET, YY_MOVE (l));
-  }
+      /// The state number used to denote an empty symbol.
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SOCKET_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_TYPE, YY_MOVE (l));
-  }
+      /// The state.
+      /// \a empty when empty.
+      state_type state;
+    };
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SOCKET_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_NAME, YY_MOVE (l));
-  }
+    /// "Internal" symbol: element of the stack.
+    struct stack_symbol_type : basic_symbol<by_state>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_state> super_type;
+      /// Construct an empty symbol.
+      stack_symbol_type ();
+      /// Move or copy construction.
+      stack_symbol_type (YY_RVREF (stack_symbol_type) that);
+      /// Steal the contents from \a sym to build this.
+      stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) sym);
+#if YY_CPLUSPLUS < 201103L
+      /// Assignment, needed by push_back by some old implementations.
+      /// Moves the contents of that.
+      stack_symbol_type& operator= (stack_symbol_type& that);
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP_QUEUE_CONTROL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP_QUEUE_CONTROL, YY_MOVE (l));
-  }
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP_DDNS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP_DDNS, YY_MOVE (l));
-  }
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ENABLE_UPDATES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ENABLE_UPDATES, YY_MOVE (l));
-  }
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_QUALIFYING_SUFFIX (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_QUALIFYING_SUFFIX, YY_MOVE (l));
-  }
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SERVER_IP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_IP, YY_MOVE (l));
-  }
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SERVER_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SERVER_PORT, YY_MOVE (l));
-  }
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SENDER_IP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SENDER_IP, YY_MOVE (l));
-  }
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SENDER_PORT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SENDER_PORT, YY_MOVE (l));
-  }
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAX_QUEUE_SIZE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAX_QUEUE_SIZE, YY_MOVE (l));
-  }
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NCR_PROTOCOL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NCR_PROTOCOL, YY_MOVE (l));
-  }
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NCR_FORMAT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NCR_FORMAT, YY_MOVE (l));
-  }
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OVERRIDE_NO_UPDATE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OVERRIDE_NO_UPDATE, YY_MOVE (l));
-  }
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
+#endif
+      /// The wrapped container.
+      S seq_;
+    };
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OVERRIDE_CLIENT_UPDATE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OVERRIDE_CLIENT_UPDATE, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_REPLACE_CLIENT_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_REPLACE_CLIENT_NAME, YY_MOVE (l));
-  }
+    /// Stack type.
+    typedef stack<stack_symbol_type> stack_type;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_GENERATED_PREFIX (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_GENERATED_PREFIX, YY_MOVE (l));
-  }
+    /// The stack.
+    stack_type yystack_;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TCP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TCP, YY_MOVE (l));
-  }
+    /// Push a new state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param sym  the symbol
+    /// \warning the contents of \a s.value is stolen.
+    void yypush_ (const char* m, YY_MOVE_REF (stack_symbol_type) sym);
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_JSON (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_JSON, YY_MOVE (l));
-  }
+    /// Push a new look ahead token on the state on the stack.
+    /// \param m    a debug message to display
+    ///             if null, no trace is output.
+    /// \param s    the state
+    /// \param sym  the symbol (for its value and location).
+    /// \warning the contents of \a sym.value is stolen.
+    void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_WHEN_PRESENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_WHEN_PRESENT, YY_MOVE (l));
-  }
+    /// Pop \a n symbols from the stack.
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_NEVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NEVER, YY_MOVE (l));
-  }
+    /// Constants.
+    enum
+    {
+      yylast_ = 1006,     ///< Last index in yytable_.
+      yynnts_ = 380,  ///< Number of nonterminal symbols.
+      yyfinal_ = 30 ///< Termination state number.
+    };
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_ALWAYS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_ALWAYS, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_WHEN_NOT_PRESENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_WHEN_NOT_PRESENT, YY_MOVE (l));
-  }
+    // User arguments.
+    isc::dhcp::Parser4Context& ctx;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOSTNAME_CHAR_SET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOSTNAME_CHAR_SET, YY_MOVE (l));
-  }
+  };
 
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_HOSTNAME_CHAR_REPLACEMENT (YY_COPY (location_type) l)
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::yytranslate_ (int t) YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_HOSTNAME_CHAR_REPLACEMENT, YY_MOVE (l));
-  }
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const unsigned char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
+      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
+      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
+      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
+     105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
+     165,   166,   167,   168,   169,   170,   171,   172,   173
+    };
+    // Last valid token kind.
+    const int code_max = 428;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LOGGING (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LOGGING, YY_MOVE (l));
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
   }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_LOGGERS (YY_COPY (location_type) l)
+  // basic_symbol.
+  template <typename Base>
+  Dhcp4Parser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
   {
-    return symbol_type (token::TOKEN_LOGGERS, YY_MOVE (l));
-  }
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OUTPUT_OPTIONS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, YY_MOVE (l));
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_OUTPUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT, YY_MOVE (l));
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DEBUGLEVEL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, YY_MOVE (l));
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SEVERITY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SEVERITY, YY_MOVE (l));
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (YY_MOVE (that.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_FLUSH (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLUSH, YY_MOVE (l));
-  }
+      default:
+        break;
+    }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAXSIZE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAXSIZE, YY_MOVE (l));
   }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_MAXVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAXVER, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCP6 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP6, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_DHCPDDNS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCPDDNS, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_CONTROL_AGENT (YY_COPY (location_type) l)
+  template <typename Base>
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_CONTROL_AGENT, YY_MOVE (l));
+    return this->kind ();
   }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TOPLEVEL_JSON (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_TOPLEVEL_JSON, YY_MOVE (l));
-  }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_TOPLEVEL_DHCP4 (YY_COPY (location_type) l)
+  template <typename Base>
+  bool
+  Dhcp4Parser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_TOPLEVEL_DHCP4, YY_MOVE (l));
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_DHCP4 (YY_COPY (location_type) l)
+  template <typename Base>
+  void
+  Dhcp4Parser::basic_symbol<Base>::move (basic_symbol& s)
   {
-    return symbol_type (token::TOKEN_SUB_DHCP4, YY_MOVE (l));
-  }
+    super_type::move (s);
+    switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type: // socket_type
+      case symbol_kind::S_outbound_interface_value: // outbound_interface_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.move< ElementPtr > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_INTERFACES4 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_INTERFACES4, YY_MOVE (l));
-  }
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_SUBNET4 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_SUBNET4, YY_MOVE (l));
-  }
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_POOL4 (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_POOL4, YY_MOVE (l));
-  }
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_RESERVATION (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_RESERVATION, YY_MOVE (l));
-  }
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (YY_MOVE (s.value));
+        break;
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_OPTION_DEFS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DEFS, YY_MOVE (l));
-  }
+      default:
+        break;
+    }
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_OPTION_DEF (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DEF, YY_MOVE (l));
+    location = YY_MOVE (s.location);
   }
 
+  // by_kind.
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_OPTION_DATA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_OPTION_DATA, YY_MOVE (l));
-  }
+  Dhcp4Parser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
+  {}
 
+#if 201103L <= YY_CPLUSPLUS
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_HOOKS_LIBRARY (YY_COPY (location_type) l)
+  Dhcp4Parser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
-    return symbol_type (token::TOKEN_SUB_HOOKS_LIBRARY, YY_MOVE (l));
+    that.clear ();
   }
+#endif
 
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_DHCP_DDNS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_DHCP_DDNS, YY_MOVE (l));
-  }
+  Dhcp4Parser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
 
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_LOGGING (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_LOGGING, YY_MOVE (l));
-  }
+  Dhcp4Parser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
+
 
-  inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_SUB_CONFIG_CONTROL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUB_CONFIG_CONTROL, YY_MOVE (l));
-  }
 
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_STRING (YY_COPY (std::string) v, YY_COPY (location_type) l)
+  void
+  Dhcp4Parser::by_kind::clear () YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_STRING, YY_MOVE (v), YY_MOVE (l));
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_INTEGER (YY_COPY (int64_t) v, YY_COPY (location_type) l)
+  void
+  Dhcp4Parser::by_kind::move (by_kind& that)
   {
-    return symbol_type (token::TOKEN_INTEGER, YY_MOVE (v), YY_MOVE (l));
+    kind_ = that.kind_;
+    that.clear ();
   }
 
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_FLOAT (YY_COPY (double) v, YY_COPY (location_type) l)
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::kind () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_FLOAT, YY_MOVE (v), YY_MOVE (l));
+    return kind_;
   }
 
+
   inline
-  Dhcp4Parser::symbol_type
-  Dhcp4Parser::make_BOOLEAN (YY_COPY (bool) v, YY_COPY (location_type) l)
+  Dhcp4Parser::symbol_kind_type
+  Dhcp4Parser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_BOOLEAN, YY_MOVE (v), YY_MOVE (l));
+    return this->kind ();
   }
 
 
-#line 14 "dhcp4_parser.yy" // lalr1.cc:404
+#line 14 "dhcp4_parser.yy"
 } } // isc::dhcp
-#line 3297 "dhcp4_parser.h" // lalr1.cc:404
+#line 4826 "dhcp4_parser.h"
 
 
 
@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -52,6 +52,7 @@ using namespace std;
   DHCP4 "Dhcp4"
   CONFIG_CONTROL "config-control"
   CONFIG_DATABASES "config-databases"
+  CONFIG_FETCH_WAIT_TIME "config-fetch-wait-time"
   INTERFACES_CONFIG "interfaces-config"
   INTERFACES "interfaces"
   DHCP_SOCKET_TYPE "dhcp-socket-type"
@@ -201,10 +202,14 @@ using namespace std;
   OUTPUT_OPTIONS "output_options"
   OUTPUT "output"
   DEBUGLEVEL "debuglevel"
+  RATE_LIMIT "rate-limit"
   SEVERITY "severity"
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow-policy"
 
   DHCP6 "Dhcp6"
   DHCPDDNS "DhcpDdns"
@@ -2097,6 +2102,7 @@ config_control_params: config_control_param
 
 // This defines a list of allowed parameters for each subnet.
 config_control_param: config_databases
+                    | config_fetch_wait_time
                     ;
 
 config_databases: CONFIG_DATABASES {
@@ -2109,6 +2115,11 @@ config_databases: CONFIG_DATABASES {
     ctx.leave();
 };
 
+config_fetch_wait_time: CONFIG_FETCH_WAIT_TIME COLON INTEGER {
+    ElementPtr value(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("config-fetch-wait-time", value);
+};
+
 // --- logging entry -----------------------------------------
 
 // This defines the top level "Logging" object. It parses
@@ -2176,6 +2187,7 @@ logger_params: logger_param
 logger_param: name
             | output_options_list
             | debuglevel
+            | rate_limit
             | severity
             | user_context
             | comment
@@ -2195,6 +2207,14 @@ severity: SEVERITY {
     ctx.leave();
 };
 
+rate_limit: RATE_LIMIT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr rl(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+};
+
 output_options_list: OUTPUT_OPTIONS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("output_options", l);
@@ -2225,6 +2245,9 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | queue_size
+             | overflow_policy
              ;
 
 output: OUTPUT {
@@ -2250,6 +2273,24 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", size);
+};
+
+overflow_policy: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr policy(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+};
+
 %%
 
 void
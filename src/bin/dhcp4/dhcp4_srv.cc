@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -48,6 +48,7 @@
 #include <util/strutil.h>
 #include <stats/stats_mgr.h>
 #include <log/logger.h>
+#include <log/logger_manager.h>
 #include <cryptolink/cryptolink.h>
 #include <cfgrpt/config_report.h>
 
@@ -65,6 +66,7 @@
 #include <boost/algorithm/string.hpp>
 #include <boost/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/lexical_cast.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -108,6 +110,60 @@ struct Dhcp4Hooks {
     }
 };
 
+/// @brief Returns the cache of the options selected for the responses.
+///
+/// The options of the host reservations are not cached because the hosts
+/// may be fetched from a database for each query.
+///
+/// @param ex DHCPv4 exchange.
+/// @return pointer to the cache or null if it must not be used for this
+/// exchange.
+CfgOptionListCachePtr
+getCfgOptionListCache(const Dhcpv4Exchange& ex) {
+    const ConstHostPtr& host = ex.getContext()->currentHost();
+    if (host && !host->getCfgOption4()->empty()) {
+        return (CfgOptionListCachePtr());
+    }
+    return (CfgMgr::instance().getCurrentCfg()->getCfgOptionListCache());
+}
+
+/// @brief Adds the packets dropped since the last report to a statistic.
+///
+/// @param name name of the statistic.
+/// @param count number of packets dropped so far.
+/// @param [in,out] reported number of packets already reported.
+void
+addQueueDropStat(const std::string& name, const uint64_t count,
+                 uint64_t& reported) {
+    if (count > reported) {
+        isc::stats::StatsMgr::instance().addValue(name,
+            static_cast<int64_t>(count - reported));
+        reported = count;
+    }
+}
+
+/// @brief Names of the latency histograms of a message type.
+///
+/// The names are built once rather than for each processed packet.
+struct LatencyHistogramNames {
+    /// @brief Constructor.
+    ///
+    /// @param type message type as it appears in the names, e.g. "request".
+    explicit LatencyHistogramNames(const std::string& type)
+        : total_("pkt4-" + type + "-latency") {
+        for (size_t i = 0; i < Pkt::STAGES_NUM; ++i) {
+            stages_[i] = "pkt4-" + type + "-" +
+                Pkt::stageToText(static_cast<Pkt::Stage>(i)) + "-latency";
+        }
+    }
+
+    /// @brief Names of the histograms of the stages.
+    std::string stages_[Pkt::STAGES_NUM];
+
+    /// @brief Name of the histogram of the whole processing.
+    std::string total_;
+};
+
 } // end of anonymous namespace
 
 // Declare a Hooks object. As this is outside any function or method, it
@@ -444,7 +500,8 @@ const std::string Dhcpv4Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
                      const bool direct_response_desired)
     : io_service_(new IOService()), shutdown_(true), alloc_engine_(), port_(port),
-      use_bcast_(use_bcast), network_state_(new NetworkState(NetworkState::DHCPv4)) {
+      use_bcast_(use_bcast), queue_drop_rules_(), queue_drop_counters_(),
+      network_state_(new NetworkState(NetworkState::DHCPv4)) {
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET).arg(port);
     try {
@@ -579,6 +636,10 @@ Dhcpv4Srv::selectSubnet(const Pkt4Ptr& query, bool& drop,
         callout_handle->getArgument("subnet4", subnet);
     }
 
+    if (!sanity_only) {
+        query->markStage(Pkt::STAGE_SUBNET_SELECTED);
+    }
+
     if (subnet) {
         // Log at higher debug level that subnet has been found.
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC_DATA, DHCP4_SUBNET_SELECTED)
@@ -697,6 +758,10 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query, bool& drop,
         callout_handle->getArgument("subnet4", subnet);
     }
 
+    if (!sanity_only) {
+        query->markStage(Pkt::STAGE_SUBNET_SELECTED);
+    }
+
     if (subnet) {
         // Log at higher debug level that subnet has been found.
         LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC_DATA, DHCP4_SUBNET_SELECTED)
@@ -729,10 +794,28 @@ Dhcpv4Srv::sendPacket(const Pkt4Ptr& packet) {
 
 bool
 Dhcpv4Srv::run() {
+    // Number of messages dropped by the asynchronous logging outputs
+    // already counted in the statistic.
+    uint64_t log_dropped = 0;
+
     while (!shutdown_) {
         try {
             run_one();
             getIOService()->poll();
+
+            // Update the statistic of the log messages dropped because an
+            // asynchronous logging queue was full. The count is checked at
+            // least once a second.
+            const uint64_t dropped = LoggerManager::getAsyncDroppedCount();
+            if (dropped != log_dropped) {
+                isc::stats::StatsMgr::instance().addValue("log-async-dropped",
+                    static_cast<int64_t>(dropped - log_dropped));
+                log_dropped = dropped;
+            }
+
+            // Report the messages suppressed by the logging rate limits
+            // when no further message went through the limits.
+            Logger::flushRateLimits();
         } catch (const std::exception& e) {
             // General catch-all exception that are not caught by more specific
             // catches. This one is for exceptions derived from std::exception.
@@ -769,6 +852,8 @@ Dhcpv4Srv::run_one() {
         // point are: the interface, source address and destination addresses
         // and ports.
         if (query) {
+            query->markStage(Pkt::STAGE_DEQUEUED);
+
             LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_BUFFER_RECEIVED)
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getRemotePort())
@@ -815,6 +900,9 @@ Dhcpv4Srv::run_one() {
             .arg(e.what());
     }
 
+    // Report the packets dropped by the packet queue in the meantime.
+    updateQueueDropStats();
+
     // Timeout may be reached or signal received, which breaks select()
     // with no reception occurred. No need to log anything here because
     // we have logged right after the call to receivePacket().
@@ -837,7 +925,7 @@ Dhcpv4Srv::run_one() {
     }
 
     CalloutHandlePtr callout_handle = getCalloutHandle(query);
-    processPacketBufferSend(callout_handle, rsp);
+    processPacketBufferSend(callout_handle, query, rsp);
 }
 
 void
@@ -1115,7 +1203,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         HooksManager::park("leases4_committed", query,
         [this, callout_handle, query, rsp]() mutable {
             processPacketPktSend(callout_handle, query, rsp);
-            processPacketBufferSend(callout_handle, rsp);
+            processPacketBufferSend(callout_handle, query, rsp);
         });
 
         // If we have parked the packet, let's reset the pointer to the
@@ -1186,9 +1274,35 @@ Dhcpv4Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
     }
 }
 
+void
+Dhcpv4Srv::updateQueueDropStats() {
+    PacketQueue4Ptr queue = IfaceMgr::instance().getPacketQueue4();
+    PacketDropRulesPtr drop_rules;
+    if (queue) {
+        drop_rules = queue->getDropRules();
+    }
+    if (!drop_rules) {
+        return;
+    }
+
+    // The queue is recreated on reconfiguration with new counters.
+    if (drop_rules != queue_drop_rules_) {
+        queue_drop_rules_ = drop_rules;
+        queue_drop_counters_ = PacketDropRules::Counters();
+    }
+
+    PacketDropRules::Counters counters = drop_rules->getCounters();
+    addQueueDropStat("pkt4-queue-drop-rate-limit", counters.rate_limit_,
+                     queue_drop_counters_.rate_limit_);
+    addQueueDropStat("pkt4-queue-drop-duplicate", counters.duplicate_,
+                     queue_drop_counters_.duplicate_);
+    addQueueDropStat("pkt4-queue-drop-low-priority", counters.low_priority_,
+                     queue_drop_counters_.low_priority_);
+}
+
 void
 Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
-                                   Pkt4Ptr& rsp) {
+                                   Pkt4Ptr& query, Pkt4Ptr& rsp) {
     if (!rsp) {
         return;
     }
@@ -1251,6 +1365,8 @@ Dhcpv4Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
 
         // Update statistics accordingly for sent packet.
         processStatsSent(rsp);
+        query->markStage(Pkt::STAGE_SENT);
+        processStatsLatency(query);
 
     } catch (const std::exception& e) {
         LOG_ERROR(packet4_logger, DHCP4_PACKET_SEND_FAIL)
@@ -1398,7 +1514,7 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
 
     Pkt4Ptr query = ex.getQuery();
     Pkt4Ptr resp = ex.getResponse();
-    std::vector<uint8_t> requested_opts;
+    std::vector<uint16_t> requested_opts;
 
     // try to get the 'Parameter Request List' option which holds the
     // codes of requested options.
@@ -1406,45 +1522,75 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
         OptionUint8Array>(query->getOption(DHO_DHCP_PARAMETER_REQUEST_LIST));
     // Get the codes of requested options.
     if (option_prl) {
-        requested_opts = option_prl->getValues();
+        const std::vector<uint8_t>& prl = option_prl->getValues();
+        requested_opts.assign(prl.begin(), prl.end());
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP4_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
+
+    // The options selected for a given option list and requested codes
+    // are always the same so they are taken from the cache when possible.
+    CfgOptionListCachePtr cache = getCfgOptionListCache(ex);
+    const OptionCollection* options = 0;
+    if (cache) {
+        options = cache->get(co_list, DHCP4_OPTION_SPACE, requested_opts);
+    }
+
+    OptionCollection selected;
+    if (!options) {
+        std::vector<uint16_t> codes = requested_opts;
+
+        // Iterate on the configured option list to add persistent options
+        for (CfgOptionList::const_iterator copts = co_list.begin();
+             copts != co_list.end(); ++copts) {
+            const OptionContainerPtr& opts = (*copts)->getAll(DHCP4_OPTION_SPACE);
+            if (!opts) {
+                continue;
+            }
+            // Get persistent options
+            const OptionContainerPersistIndex& idx = opts->get<2>();
+            const OptionContainerPersistRange& range = idx.equal_range(true);
+            for (OptionContainerPersistIndex::const_iterator desc = range.first;
+                 desc != range.second; ++desc) {
+                // Add the persistent option code to requested options
+                if (desc->option_) {
+                    uint8_t code = static_cast<uint8_t>(desc->option_->getType());
+                    codes.push_back(code);
+                }
             }
         }
-    }
 
-    // For each requested option code get the instance of the option
-    // to be returned to the client.
-    for (std::vector<uint8_t>::const_iterator opt = requested_opts.begin();
-         opt != requested_opts.end(); ++opt) {
-        // Add nothing when it is already there
-        if (!resp->getOption(*opt)) {
-            // Iterate on the configured option list
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
-                // Got it: add it and jump to the outer loop
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
+        // For each requested option code get the instance of the option
+        // to be returned to the client.
+        for (std::vector<uint16_t>::const_iterator opt = codes.begin();
+             opt != codes.end(); ++opt) {
+            // Add nothing when it is already there
+            if (selected.find(*opt) == selected.end()) {
+                // Iterate on the configured option list
+                for (CfgOptionList::const_iterator copts = co_list.begin();
+                     copts != co_list.end(); ++copts) {
+                    OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
+                    // Got it: add it and jump to the outer loop
+                    if (desc.option_) {
+                        selected.insert(std::make_pair(*opt, desc.option_));
+                        break;
+                    }
                 }
             }
         }
+
+        if (cache) {
+            options = &cache->add(co_list, DHCP4_OPTION_SPACE, requested_opts,
+                                  selected);
+        } else {
+            options = &selected;
+        }
+    }
+
+    // Add the selected options which are not already in the response.
+    for (OptionCollection::const_iterator opt = options->begin();
+         opt != options->end(); ++opt) {
+        if (!resp->getOption(opt->first)) {
+            resp->addOption(opt->second);
+        }
     }
 }
 
@@ -1475,7 +1621,7 @@ Dhcpv4Srv::appendRequestedVendorOptions(Dhcpv4Exchange& ex) {
     }
 
     uint32_t vendor_id = vendor_req->getVendorId();
-    std::vector<uint8_t> requested_opts;
+    std::vector<uint16_t> requested_opts;
 
     // Let's try to get ORO within that vendor-option
     /// @todo This is very specific to vendor-id=4491 (Cable Labs). Other
@@ -1484,55 +1630,78 @@ Dhcpv4Srv::appendRequestedVendorOptions(Dhcpv4Exchange& ex) {
         boost::dynamic_pointer_cast<OptionUint8Array>(vendor_req->getOption(DOCSIS3_V4_ORO));
     // Get the list of options that client requested.
     if (oro) {
-        requested_opts = oro->getValues();
+        const std::vector<uint8_t>& values = oro->getValues();
+        requested_opts.assign(values.begin(), values.end());
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(vendor_id);
-        if (!opts) {
-            continue;
+
+    // The selected options are taken from the cache when possible, as
+    // for the standard options.
+    CfgOptionListCachePtr cache = getCfgOptionListCache(ex);
+    const std::string option_space = "vendor-" +
+        boost::lexical_cast<std::string>(vendor_id);
+    const OptionCollection* options = 0;
+    if (cache) {
+        options = cache->get(co_list, option_space, requested_opts);
+    }
+
+    OptionCollection selected;
+    if (!options) {
+        std::vector<uint16_t> codes = requested_opts;
+
+        // Iterate on the configured option list to add persistent options
+        for (CfgOptionList::const_iterator copts = co_list.begin();
+             copts != co_list.end(); ++copts) {
+            const OptionContainerPtr& opts = (*copts)->getAll(vendor_id);
+            if (!opts) {
+                continue;
+            }
+            // Get persistent options
+            const OptionContainerPersistIndex& idx = opts->get<2>();
+            const OptionContainerPersistRange& range = idx.equal_range(true);
+            for (OptionContainerPersistIndex::const_iterator desc = range.first;
+                 desc != range.second; ++desc) {
+                // Add the persistent option code to requested options
+                if (desc->option_) {
+                    uint8_t code = static_cast<uint8_t>(desc->option_->getType());
+                    codes.push_back(code);
+                }
+            }
         }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
+
+        // Get the configured instances of the requested options.
+        for (std::vector<uint16_t>::const_iterator code = codes.begin();
+             code != codes.end(); ++code) {
+            if (selected.find(*code) == selected.end()) {
+                for (CfgOptionList::const_iterator copts = co_list.begin();
+                     copts != co_list.end(); ++copts) {
+                    OptionDescriptor desc = (*copts)->get(vendor_id, *code);
+                    if (desc.option_) {
+                        selected.insert(std::make_pair(*code, desc.option_));
+                        break;
+                    }
+                }
             }
         }
+
+        if (cache) {
+            options = &cache->add(co_list, option_space, requested_opts,
+                                  selected);
+        } else {
+            options = &selected;
+        }
     }
 
     // If there is nothing to add don't do anything then.
-    if (requested_opts.empty()) {
+    if (options->empty()) {
         return;
     }
 
     boost::shared_ptr<OptionVendor> vendor_rsp(new OptionVendor(Option::V4, vendor_id));
-
-    // Get the list of options that client requested.
-    bool added = false;
-    for (std::vector<uint8_t>::const_iterator code = requested_opts.begin();
-         code != requested_opts.end(); ++code) {
-        if  (!vendor_rsp->getOption(*code)) {
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(vendor_id, *code);
-                if (desc.option_) {
-                    vendor_rsp->addOption(desc.option_);
-                    added = true;
-                    break;
-                }
-            }
-        }
-
-        if (added) {
-            ex.getResponse()->addOption(vendor_rsp);
-        }
+    for (OptionCollection::const_iterator opt = options->begin();
+         opt != options->end(); ++opt) {
+        vendor_rsp->addOption(opt->second);
     }
+    ex.getResponse()->addOption(vendor_rsp);
 }
 
 
@@ -2067,6 +2236,7 @@ Dhcpv4Srv::assignLease(Dhcpv4Exchange& ex) {
     ctx->callout_handle_ = callout_handle;
 
     Lease4Ptr lease = alloc_engine_->allocateLease4(*ctx);
+    query->markStage(Pkt::STAGE_LEASE_ALLOCATED);
 
     // Subnet may be modified by the allocation engine, if the initial subnet
     // belongs to a shared network.
@@ -2762,6 +2932,15 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release, AllocEngine::ClientContext4Ptr& cont
                     StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-addresses"),
                     static_cast<int64_t>(-1));
 
+                // The address is available again in its pool.
+                if (!lease->stateExpiredReclaimed()) {
+                    Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+                        getCfgSubnets4()->getSubnet(lease->subnet_id_);
+                    if (subnet) {
+                        subnet->addAssignedLeases(Lease::TYPE_V4, lease->addr_, -1);
+                    }
+                }
+
                 // Remove existing DNS entries for the lease, if any.
                 queueNCR(CHG_REMOVE, lease);
 
@@ -3600,6 +3779,52 @@ void Dhcpv4Srv::processStatsSent(const Pkt4Ptr& response) {
                                               static_cast<int64_t>(1));
 }
 
+void Dhcpv4Srv::processStatsLatency(const Pkt4Ptr& query) {
+    // Packets which have not been received from the network (e.g. the
+    // DHCPv4-over-DHCPv6 ones) have no timestamp.
+    const boost::posix_time::ptime& received = query->getTimestamp();
+    if (received.is_not_a_date_time()) {
+        return;
+    }
+
+    // Only the messages the server responds to are sent here.
+    static const LatencyHistogramNames discover_names("discover");
+    static const LatencyHistogramNames request_names("request");
+    static const LatencyHistogramNames inform_names("inform");
+    const LatencyHistogramNames* names;
+    switch (query->getType()) {
+    case DHCPDISCOVER:
+        names = &discover_names;
+        break;
+    case DHCPREQUEST:
+        names = &request_names;
+        break;
+    case DHCPINFORM:
+        names = &inform_names;
+        break;
+    default:
+        return;
+    }
+
+    // Record the time elapsed since the previous stage (or the reception)
+    // for each stage the packet has gone through, at the time the stage
+    // was reached.
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    boost::posix_time::ptime previous = received;
+    for (size_t i = 0; i < Pkt::STAGES_NUM; ++i) {
+        const boost::posix_time::ptime& reached =
+            query->getStageTime(static_cast<Pkt::Stage>(i));
+        if (reached.is_not_a_date_time()) {
+            continue;
+        }
+        stats_mgr.addHistogramSample(names->stages_[i], reached - previous,
+                                     reached);
+        previous = reached;
+    }
+    stats_mgr.addHistogramSample(names->total_, previous - received,
+                                 previous);
+}
+
 int Dhcpv4Srv::getHookIndexBuffer4Receive() {
     return (Hooks.hook_index_buffer4_receive_);
 }
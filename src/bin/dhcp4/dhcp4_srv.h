@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,7 @@
 #include <dhcp/option_string.h>
 #include <dhcp/option4_client_fqdn.h>
 #include <dhcp/option_custom.h>
+#include <dhcp/packet_drop_rules.h>
 #include <dhcp_ddns/ncr_msg.h>
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
@@ -900,9 +901,21 @@ protected:
     /// @brief Executes buffer4_send callout and sends the response.
     ///
     /// @param callout_handle pointer to the callout handle.
+    /// @param query pointer to the query, which processing stage times
+    /// are recorded when the response is sent.
     /// @param rsp pointer to a response.
     void processPacketBufferSend(hooks::CalloutHandlePtr& callout_handle,
-                                 Pkt4Ptr& rsp);
+                                 Pkt4Ptr& query, Pkt4Ptr& rsp);
+
+    /// @brief Updates the statistics of the packets dropped by the early
+    /// drop rules of the packet queue.
+    ///
+    /// The numbers of packets dropped by each rule since the last call
+    /// are added to the pkt4-queue-drop-rate-limit,
+    /// pkt4-queue-drop-duplicate and pkt4-queue-drop-low-priority
+    /// statistics. The rules are applied in the receiver thread, so as
+    /// the statistics are updated by the main thread with this function.
+    void updateQueueDropStats();
 
     /// @brief Allocation Engine.
     /// Pointer to the allocation engine that we are currently using
@@ -930,6 +943,13 @@ private:
     uint16_t port_;  ///< UDP port number on which server listens.
     bool use_bcast_; ///< Should broadcast be enabled on sockets (if true).
 
+    /// @brief Early drop rules of the packet queue which counters are
+    /// reported in the statistics.
+    PacketDropRulesPtr queue_drop_rules_;
+
+    /// @brief Counters of the early drop rules reported in the statistics.
+    PacketDropRules::Counters queue_drop_counters_;
+
 protected:
 
     /// @brief Holds information about disabled DHCP service and/or
@@ -947,6 +967,17 @@ public:
     /// @param response packet transmitted
     static void processStatsSent(const Pkt4Ptr& response);
 
+    /// @brief Updates the latency histograms for a processed packet
+    ///
+    /// For each processing stage reached by the query, the time elapsed
+    /// since the previous stage (or since the reception for the first one)
+    /// is added to the pkt4-<type>-<stage>-latency histogram, e.g.
+    /// pkt4-request-lease-allocated-latency. The whole processing time is
+    /// added to the pkt4-<type>-latency histogram.
+    ///
+    /// @param query packet which response has been sent
+    static void processStatsLatency(const Pkt4Ptr& query);
+
     /// @brief Returns the index for "buffer4_receive" hook point
     /// @return the index for "buffer4_receive" hook point
     static int getHookIndexBuffer4Receive();
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -29,10 +29,12 @@
 #include <dhcpsrv/parsers/shared_networks_list_parser.h>
 #include <dhcpsrv/parsers/sanity_checks_parser.h>
 #include <dhcpsrv/host_data_source_factory.h>
+#include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <process/config_ctl_parser.h>
 #include <hooks/hooks_parser.h>
 #include <config/command_mgr.h>
+#include <stats/stats_mgr.h>
 #include <util/encode/hex.h>
 #include <util/strutil.h>
 
@@ -40,6 +42,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <iostream>
 #include <netinet/in.h>
@@ -694,6 +697,244 @@ void databaseConfigFetch(const SrvConfigPtr& srv_cfg, ElementPtr /* mutable_cfg
     // subnets
 }
 
+CBFetchCursor::CBFetchCursor()
+    : last_modification_time_(boost::posix_time::from_time_t(0)), merged_() {
+}
+
+namespace {
+
+/// @brief Checks if a configuration element fetched from the CB databases
+/// has already been merged.
+///
+/// @param cursor Position of the previous fetch.
+/// @param key Name of the element including its kind.
+/// @param modification_time Modification time of the element.
+/// @return true if the element has been merged with this modification time.
+bool
+alreadyMerged(const CBFetchCursor& cursor, const std::string& key,
+              const boost::posix_time::ptime& modification_time) {
+    auto merged = cursor.merged_.find(key);
+    return ((merged != cursor.merged_.end()) &&
+            (merged->second == modification_time));
+}
+
+} // end of anonymous namespace
+
+size_t
+databaseConfigFetchUpdates(const SrvConfigPtr& srv_cfg, CBFetchCursor& cursor) {
+    ConfigBackendDHCPv4Mgr& mgr = ConfigBackendDHCPv4Mgr::instance();
+    const db::BackendSelector& backend_selector = db::BackendSelector::UNSPEC();
+    const db::ServerSelector& server_selector = db::ServerSelector::ALL();
+
+    // Fetch everything first so as a failure to fetch doesn't leave the
+    // configuration partially updated. The elements modified in the second
+    // of the most recent modification time are fetched again.
+    const boost::posix_time::ptime fetch_time =
+        boost::posix_time::second_clock::universal_time();
+    const boost::posix_time::ptime lb_modification_time =
+        cursor.last_modification_time_ - boost::posix_time::seconds(1);
+    StampedValueCollection all_globals = mgr.getPool()->
+        getModifiedGlobalParameters4(backend_selector, server_selector,
+                                     lb_modification_time);
+    SharedNetwork4Collection all_networks = mgr.getPool()->
+        getModifiedSharedNetworks4(backend_selector, server_selector,
+                                   lb_modification_time);
+    Subnet4Collection all_subnets = mgr.getPool()->
+        getModifiedSubnets4(backend_selector, server_selector,
+                            lb_modification_time);
+    OptionContainer all_options = mgr.getPool()->
+        getModifiedOptions4(backend_selector, server_selector,
+                            lb_modification_time);
+
+    // Leave out the elements already merged.
+    std::map<std::string, boost::posix_time::ptime> fetched;
+    std::vector<std::pair<std::string, ConstElementPtr> > globals;
+    for (auto global = all_globals.begin(); global != all_globals.end(); ++global) {
+        const std::string key = "global " + (*global)->getName();
+        if (alreadyMerged(cursor, key, (*global)->getModificationTime())) {
+            continue;
+        }
+        fetched[key] = (*global)->getModificationTime();
+
+        // Global parameters are stored as strings. Those which can be
+        // converted to integers are stored as integers.
+        ElementPtr value;
+        try {
+            value = Element::create((*global)->getSignedIntegerValue());
+        } catch (const BadValue&) {
+            value = Element::create((*global)->getValue());
+        }
+        globals.push_back(std::make_pair((*global)->getName(), value));
+    }
+    std::vector<SharedNetwork4Ptr> networks;
+    for (auto network = all_networks.begin(); network != all_networks.end();
+         ++network) {
+        const std::string key = "shared-network " + (*network)->getName();
+        if (!alreadyMerged(cursor, key, (*network)->getModificationTime())) {
+            fetched[key] = (*network)->getModificationTime();
+            networks.push_back(*network);
+        }
+    }
+    std::vector<Subnet4Ptr> subnets;
+    for (auto subnet = all_subnets.begin(); subnet != all_subnets.end(); ++subnet) {
+        const std::string key = "subnet " +
+            boost::lexical_cast<std::string>((*subnet)->getID());
+        if (!alreadyMerged(cursor, key, (*subnet)->getModificationTime())) {
+            fetched[key] = (*subnet)->getModificationTime();
+            subnets.push_back(*subnet);
+        }
+    }
+    std::vector<OptionDescriptor> options;
+    for (auto option = all_options.begin(); option != all_options.end(); ++option) {
+        if (!option->option_) {
+            continue;
+        }
+        const std::string key = "option " + option->space_name_ + " " +
+            boost::lexical_cast<std::string>(option->option_->getType());
+        if (!alreadyMerged(cursor, key, option->getModificationTime())) {
+            fetched[key] = option->getModificationTime();
+            options.push_back(*option);
+        }
+    }
+
+    // Merge the subnets and the options into copies of their current
+    // configurations, so as an error doesn't leave the configuration
+    // partially updated. Only the subnets which are new or which pools
+    // have changed need lease statistics to be recounted.
+    CfgSubnets4Ptr cfg_subnets = srv_cfg->getCfgSubnets4();
+    CfgSubnets4 merged_subnets(*cfg_subnets);
+    std::set<SubnetID> replaced;
+    std::vector<std::pair<Subnet4Ptr, Subnet4Ptr> > replacements;
+    SubnetIDSet recount;
+    for (auto subnet = subnets.begin(); subnet != subnets.end(); ++subnet) {
+        const SubnetID subnet_id = (*subnet)->getID();
+        Subnet4Ptr existing = merged_subnets.getSubnet(subnet_id);
+        if (existing) {
+            merged_subnets.del(existing);
+            replaced.insert(subnet_id);
+            replacements.push_back(std::make_pair(*subnet, existing));
+        }
+        if (!existing || !existing->samePools(**subnet)) {
+            recount.insert(subnet_id);
+        }
+        merged_subnets.add(*subnet);
+    }
+
+    CfgOptionPtr cfg_option = srv_cfg->getCfgOption();
+    CfgOption merged_option;
+    cfg_option->copyTo(merged_option);
+    for (auto option = options.begin(); option != options.end(); ++option) {
+        merged_option.del(option->space_name_, option->option_->getType());
+        merged_option.add(*option, option->space_name_);
+    }
+    if (!options.empty()) {
+        merged_option.encapsulate();
+    }
+
+    // Everything which may fail has been done: swap the merged elements in.
+    for (auto global = globals.begin(); global != globals.end(); ++global) {
+        srv_cfg->addConfiguredGlobal(global->first, global->second);
+    }
+
+    // Replace modified shared networks. The subnets belonging to the
+    // replaced network are moved to its new instance, except the replaced
+    // subnets which are added below.
+    CfgSharedNetworks4Ptr cfg_networks = srv_cfg->getCfgSharedNetworks4();
+    for (auto network = networks.begin(); network != networks.end(); ++network) {
+        Subnet4Collection network_subnets;
+        SharedNetwork4Ptr existing = cfg_networks->getByName((*network)->getName());
+        if (existing) {
+            network_subnets = *existing->getAllSubnets();
+            cfg_networks->del(existing->getName());
+        }
+        cfg_networks->add(*network);
+        for (auto subnet = network_subnets.begin(); subnet != network_subnets.end();
+             ++subnet) {
+            if ((replaced.count((*subnet)->getID()) == 0) &&
+                !(*network)->getSubnet((*subnet)->getID())) {
+                (*network)->add(*subnet);
+            }
+        }
+    }
+
+    // Replace modified subnets. The new instances take over the allocation
+    // state of the replaced subnets.
+    *cfg_subnets = merged_subnets;
+    for (auto r = replacements.begin(); r != replacements.end(); ++r) {
+        r->first->copyAllocationState(*r->second);
+        SharedNetwork4Ptr network;
+        r->second->getSharedNetwork(network);
+        if (network) {
+            network->del(r->second->getID());
+        }
+    }
+    for (auto subnet = subnets.begin(); subnet != subnets.end(); ++subnet) {
+        if (!(*subnet)->getSharedNetworkName().empty()) {
+            SharedNetwork4Ptr network =
+                cfg_networks->getByName((*subnet)->getSharedNetworkName());
+            if (network && !network->getSubnet((*subnet)->getID())) {
+                network->add(*subnet);
+            }
+        }
+    }
+
+    // Replace modified global options.
+    if (!options.empty()) {
+        merged_option.copyTo(*cfg_option);
+    }
+
+    // The options selected for the responses may have changed.
+    if (!networks.empty() || !subnets.empty() || !options.empty()) {
+        srv_cfg->getCfgOptionListCache()->clear();
+    }
+
+    // Update the statistics of the merged subnets.
+    if (!subnets.empty()) {
+        using namespace isc::stats;
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        for (auto subnet = subnets.begin(); subnet != subnets.end(); ++subnet) {
+            stats_mgr.setValue(StatsMgr::generateName("subnet", (*subnet)->getID(),
+                                                      "total-addresses"),
+                               static_cast<int64_t>
+                               ((*subnet)->getPoolCapacity(Lease::TYPE_V4)));
+        }
+        if (!recount.empty() && LeaseMgrFactory::haveInstance()) {
+            LeaseMgrFactory::instance().recountLeaseStats4(recount);
+        }
+    }
+
+    // Move the cursor. The elements are remembered until they can no
+    // longer be fetched again.
+    for (auto f = fetched.begin(); f != fetched.end(); ++f) {
+        cursor.last_modification_time_ = std::max(cursor.last_modification_time_,
+                                                  f->second);
+        if (f->second + boost::posix_time::seconds(1) <= fetch_time) {
+            cursor.merged_[f->first] = f->second;
+        }
+    }
+    const boost::posix_time::ptime lb_next =
+        cursor.last_modification_time_ - boost::posix_time::seconds(1);
+    for (auto m = cursor.merged_.begin(); m != cursor.merged_.end(); ) {
+        if (m->second < lb_next) {
+            m = cursor.merged_.erase(m);
+        } else {
+            ++m;
+        }
+    }
+
+    const size_t merged = globals.size() + networks.size() + subnets.size() +
+        options.size();
+    if (merged > 0) {
+        LOG_INFO(dhcp4_logger, DHCP4_CB_FETCH_UPDATES_MERGED)
+            .arg(globals.size())
+            .arg(networks.size())
+            .arg(subnets.size())
+            .arg(options.size());
+    }
+
+    return (merged);
+}
+
 
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
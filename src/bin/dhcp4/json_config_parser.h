@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,9 @@
 #include <dhcpsrv/parsers/dhcp_parsers.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+#include <map>
 #include <stdint.h>
 #include <string>
 
@@ -88,6 +91,54 @@ databaseConfigConnect(const SrvConfigPtr& srv_cfg);
 void
 databaseConfigFetch(const SrvConfigPtr& srv_cfg, isc::data::ElementPtr mutable_cfg);
 
+/// @brief Position of the configuration updates fetched from CB databases.
+///
+/// The configuration backends store the modification times with a one
+/// second resolution and return the elements modified after a given time,
+/// so an element modified in the same second as the most recent element of
+/// a fetch would never be fetched. The updates are therefore fetched from
+/// one second before the most recent modification time and the elements
+/// already merged are recognized by their names (or identifiers) and
+/// modification times.
+struct CBFetchCursor {
+    /// @brief Constructor.
+    ///
+    /// The first fetch returns all elements held in the databases.
+    CBFetchCursor();
+
+    /// @brief Most recent modification time of the merged elements.
+    boost::posix_time::ptime last_modification_time_;
+
+    /// @brief Modification times of the recently merged elements.
+    ///
+    /// The elements are only recorded once the second of their modification
+    /// time is over, as the same element may be modified again within this
+    /// second.
+    std::map<std::string, boost::posix_time::ptime> merged_;
+};
+
+/// @brief Fetch configuration updates from CB databases and merge them into
+/// the given configuration
+///
+/// Fetches global parameters, shared networks, subnets and global options
+/// modified since the previous fetch and merges them into the given server
+/// configuration, replacing the existing elements with the same names or
+/// identifiers. The updates are merged into copies of the subnets and
+/// options configurations which are swapped in once the merge has
+/// succeeded, so an error leaves the configuration unchanged. The replaced
+/// subnets hand their allocation state over to the new instances, see
+/// @ref Subnet::copyAllocationState. The lease statistics are recounted only
+/// for the merged subnets which are new or which pools have changed.
+/// Elements deleted from the databases are not detected and require full
+/// reconfiguration.
+///
+/// @param srv_cfg Server configuration into which the updates should be merged
+/// @param cursor Position of the previous fetch, updated upon success.
+///
+/// @return The number of merged elements.
+size_t
+databaseConfigFetchUpdates(const SrvConfigPtr& srv_cfg, CBFetchCursor& cursor);
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -1,11 +1,11 @@
-// Generated 201811271343
-// A Bison parser, made by GNU Bison 3.2.1.
+// Generated 202610182140
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Starting with Bison 3.2, this file is useless: the structure it
 // used to define is now defined in "location.hh".
 //
 // To get rid of this file:
-// 1. add 'require "3.2"' (or newer) to your grammar file
+// 1. add '%require "3.2"' (or newer) to your grammar file
 // 2. remove references to this file from your build system
 // 3. if you used to include it, include "location.hh" instead.
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -29,6 +29,7 @@
 #include <dhcpsrv/testutils/test_config_backend_dhcp4.h>
 #include <process/config_ctl_info.h>
 #include <hooks/hooks_manager.h>
+#include <stats/stats_mgr.h>
 
 #include "marker_file.h"
 #include "test_libraries.h"
@@ -6476,6 +6477,161 @@ TEST_F(Dhcp4ParserTest, serverTag) {
 }
 #endif // CONFIG_BACKEND
 
+// This test verifies that the configuration elements modified in the
+// configuration backend are merged into the server configuration.
+TEST_F(Dhcp4ParserTest, configBackendFetchUpdates) {
+    string config = "{ " + genIfaceConfig() + "," +
+        "\"valid-lifetime\": 4000,"
+        "\"subnet4\": [ {"
+        "    \"id\": 1,"
+        "    \"subnet\": \"192.0.2.0/24\","
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ]"
+        " } ]"
+        "}";
+    configure(config, CONTROL_RESULT_SUCCESS, "");
+    CfgMgr::instance().commit();
+
+    ConfigBackendDHCPv4Mgr& mgr = ConfigBackendDHCPv4Mgr::instance();
+    ASSERT_TRUE(TestConfigBackendDHCPv4::registerBackendType(mgr, "mysql"));
+    ASSERT_NO_THROW(mgr.addBackend("type=mysql"));
+
+    // Store a modified version of the configured subnet, a new subnet,
+    // a global parameter and a global option in the backend.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 24, 1000, 2000,
+                                   4000, SubnetID(1)));
+    subnet1->addPool(Pool4Ptr(new Pool4(IOAddress("192.0.2.1"),
+                                        IOAddress("192.0.2.200"))));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.3.0"), 24, 1000, 2000,
+                                   4000, SubnetID(2)));
+    subnet2->addPool(Pool4Ptr(new Pool4(IOAddress("192.0.3.1"),
+                                        IOAddress("192.0.3.10"))));
+    OptionDescriptorPtr option(new OptionDescriptor(
+        OptionPtr(new OptionUint8(Option::V4, DHO_DEFAULT_IP_TTL, 64)), true));
+    option->space_name_ = DHCP4_OPTION_SPACE;
+
+    StampedValuePtr global_param = StampedValue::create("decline-probation-period",
+                                                        123);
+
+    // The elements were modified a while ago.
+    const boost::posix_time::ptime modification_time =
+        boost::posix_time::second_clock::universal_time() -
+        boost::posix_time::seconds(10);
+    subnet1->setModificationTime(modification_time);
+    subnet2->setModificationTime(modification_time);
+    option->setModificationTime(modification_time);
+    global_param->setModificationTime(modification_time);
+
+    const db::BackendSelector& backend = db::BackendSelector::UNSPEC();
+    const db::ServerSelector& server = db::ServerSelector::ALL();
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateSubnet4(backend, server, subnet1));
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateSubnet4(backend, server, subnet2));
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateOption4(backend, server, option));
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateGlobalParameter4(backend, server,
+                                                                global_param));
+
+    // Nothing has been modified after the current time.
+    CBFetchCursor cursor;
+    const boost::posix_time::ptime now =
+        boost::posix_time::second_clock::universal_time() +
+        boost::posix_time::seconds(2);
+    cursor.last_modification_time_ = now;
+    EXPECT_EQ(0, databaseConfigFetchUpdates(CfgMgr::instance().getCurrentCfg(),
+                                            cursor));
+    EXPECT_EQ(now, cursor.last_modification_time_);
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+              getAll()->size());
+
+    // The replaced subnet hands its allocation state over.
+    CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getSubnet(1)->
+        setLastAllocated(Lease::TYPE_V4, IOAddress("192.0.2.50"));
+
+    // Cache the options selected for a response.
+    CfgOptionListCachePtr cache = CfgMgr::instance().getCurrentCfg()->
+        getCfgOptionListCache();
+    CfgOptionList co_list;
+    co_list.push_back(CfgMgr::instance().getCurrentCfg()->getCfgOption());
+    cache->add(co_list, DHCP4_OPTION_SPACE, std::vector<uint16_t>(),
+               OptionCollection());
+    ASSERT_EQ(1, cache->size());
+
+    // Fetch all updates and merge them into the current configuration.
+    cursor = CBFetchCursor();
+    size_t merged = 0;
+    ASSERT_NO_THROW(merged =
+                    databaseConfigFetchUpdates(CfgMgr::instance().getCurrentCfg(),
+                                               cursor));
+    EXPECT_EQ(4, merged);
+    EXPECT_EQ(modification_time, cursor.last_modification_time_);
+
+    // The cached options have been discarded.
+    EXPECT_EQ(0, cache->size());
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    ConstCfgSubnets4Ptr subnets = cfg->getCfgSubnets4();
+    ASSERT_EQ(2, subnets->getAll()->size());
+    ConstSubnet4Ptr subnet = subnets->getSubnet(1);
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(subnet1, subnet);
+    EXPECT_EQ(200, subnet->getPoolCapacity(Lease::TYPE_V4));
+    EXPECT_EQ("192.0.2.50", subnet->getLastAllocated(Lease::TYPE_V4).toText());
+    ASSERT_TRUE(subnets->getSubnet(2));
+
+    // The number of available addresses is updated for the merged subnets.
+    using namespace isc::stats;
+    ObservationPtr total = StatsMgr::instance().
+        getObservation(StatsMgr::generateName("subnet", 2, "total-addresses"));
+    ASSERT_TRUE(total);
+    EXPECT_EQ(10, total->getInteger().first);
+
+    OptionUint8Ptr opt_ttl = boost::dynamic_pointer_cast<OptionUint8>
+        (cfg->getCfgOption()->get(DHCP4_OPTION_SPACE, DHO_DEFAULT_IP_TTL).option_);
+    ASSERT_TRUE(opt_ttl);
+    EXPECT_EQ(64, static_cast<int>(opt_ttl->getValue()));
+
+    ConstElementPtr global = cfg->getConfiguredGlobals()->get("decline-probation-period");
+    ASSERT_TRUE(global);
+    EXPECT_EQ(123, global->intValue());
+
+    // The elements modified in the second of the most recent modification
+    // time are fetched again but they are not merged twice.
+    EXPECT_EQ(0, databaseConfigFetchUpdates(cfg, cursor));
+
+    // A subnet modified in this second after the previous fetch is merged.
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.0.4.0"), 24, 1000, 2000,
+                                   4000, SubnetID(3)));
+    subnet3->setModificationTime(modification_time);
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateSubnet4(backend, server, subnet3));
+    EXPECT_EQ(1, databaseConfigFetchUpdates(cfg, cursor));
+    EXPECT_EQ(3, subnets->getAll()->size());
+    EXPECT_EQ(subnet3, subnets->getSubnet(3));
+
+    // An option which can't be merged fails the merge, which leaves the
+    // configuration and the cursor unchanged.
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.0.5.0"), 24, 1000, 2000,
+                                   4000, SubnetID(4)));
+    OptionDescriptorPtr option2(new OptionDescriptor(
+        OptionPtr(new OptionUint8(Option::V4, DHO_DEFAULT_IP_TTL, 32)), true));
+    option2->space_name_ = "invalid space";
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateSubnet4(backend, server, subnet4));
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateOption4(backend, server, option2));
+    ASSERT_NO_THROW(mgr.getPool()->createUpdateGlobalParameter4(backend, server,
+        StampedValue::create("decline-probation-period", 456)));
+    EXPECT_THROW(databaseConfigFetchUpdates(cfg, cursor), BadValue);
+    EXPECT_EQ(modification_time, cursor.last_modification_time_);
+    EXPECT_EQ(3, subnets->getAll()->size());
+    EXPECT_FALSE(subnets->getSubnet(4));
+    opt_ttl = boost::dynamic_pointer_cast<OptionUint8>
+        (cfg->getCfgOption()->get(DHCP4_OPTION_SPACE, DHO_DEFAULT_IP_TTL).option_);
+    ASSERT_TRUE(opt_ttl);
+    EXPECT_EQ(64, static_cast<int>(opt_ttl->getValue()));
+    global = cfg->getConfiguredGlobals()->get("decline-probation-period");
+    ASSERT_TRUE(global);
+    EXPECT_EQ(123, global->intValue());
+
+    mgr.delAllBackends();
+    TestConfigBackendDHCPv4::unregisterBackendType(mgr, "mysql");
+}
+
 // Check whether it is possible to configure packet queue
 TEST_F(Dhcp4ParserTest, dhcpQueueControl) {
     struct Scenario {
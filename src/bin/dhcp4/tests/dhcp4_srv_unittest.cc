@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -3811,6 +3811,61 @@ TEST_F(Dhcpv4SrvTest, prlPersistency) {
     ASSERT_FALSE(response->getOption(DHO_ARP_CACHE_TIMEOUT));
 }
 
+// Checks that the options selected for a response are cached and that
+// the cached options are used for the next responses.
+TEST_F(Dhcpv4SrvTest, prlCache) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    ASSERT_NO_THROW(configure(CONFIGS[2]));
+    CfgOptionListCachePtr cache = CfgMgr::instance().getCurrentCfg()->
+        getCfgOptionListCache();
+    ASSERT_EQ(0, cache->size());
+
+    Pkt4Ptr query(new Pkt4(DHCPDISCOVER, 1234));
+    query->setRemoteAddr(IOAddress("192.0.2.1"));
+    OptionPtr clientid = generateClientId();
+    query->addOption(clientid);
+    query->setIface("eth1");
+
+    OptionUint8ArrayPtr prl(new OptionUint8Array(Option::V4,
+                                                 DHO_DHCP_PARAMETER_REQUEST_LIST));
+    prl->addValue(DHO_DEFAULT_IP_TTL);
+    query->addOption(prl);
+
+    // The first response fills the cache.
+    Pkt4Ptr response = srv_.processDiscover(query);
+    ASSERT_TRUE(response);
+    OptionPtr ttl = response->getOption(DHO_DEFAULT_IP_TTL);
+    ASSERT_TRUE(ttl);
+    ASSERT_TRUE(response->getOption(DHO_IP_FORWARDING));
+    EXPECT_EQ(1, cache->size());
+
+    // The next response gets the same options from the cache.
+    response = srv_.processDiscover(query);
+    ASSERT_TRUE(response);
+    EXPECT_TRUE(response->getOption(DHO_DEFAULT_IP_TTL) == ttl);
+    EXPECT_TRUE(response->getOption(DHO_IP_FORWARDING));
+    EXPECT_EQ(1, cache->size());
+
+    // A different PRL gets its own entry.
+    query->delOption(DHO_DHCP_PARAMETER_REQUEST_LIST);
+    prl.reset(new OptionUint8Array(Option::V4,
+                                   DHO_DHCP_PARAMETER_REQUEST_LIST));
+    prl->addValue(DHO_ARP_CACHE_TIMEOUT);
+    query->addOption(prl);
+    response = srv_.processDiscover(query);
+    ASSERT_TRUE(response);
+    EXPECT_FALSE(response->getOption(DHO_DEFAULT_IP_TTL));
+    EXPECT_TRUE(response->getOption(DHO_IP_FORWARDING));
+    EXPECT_EQ(2, cache->size());
+
+    // A new configuration comes with an empty cache.
+    ASSERT_NO_THROW(configure(CONFIGS[2]));
+    EXPECT_EQ(0, CfgMgr::instance().getCurrentCfg()->
+              getCfgOptionListCache()->size());
+}
+
 // Checks if relay IP address specified in the relay-info structure in
 // subnet4 is being used properly.
 TEST_F(Dhcpv4SrvTest, relayOverride) {
@@ -4381,6 +4436,47 @@ TEST_F(Dhcpv4SrvTest, statisticsUnknownRcvd) {
     EXPECT_EQ(1, drop_stat->getInteger().first);
 }
 
+// Test checks that the packets dropped by the packet queue before they
+// are queued are reported in the statistics.
+TEST_F(Dhcpv4SrvTest, statisticsQueueDrop) {
+    NakedDhcpv4Srv srv(0);
+
+    ConstElementPtr queue_control =
+        Element::fromJSON("{ \"enable-queue\": true,"
+                          " \"queue-type\": \"kea-ring4\","
+                          " \"capacity\": 10,"
+                          " \"drop-duplicates\": true }");
+    ASSERT_TRUE(IfaceMgr::instance().configureDHCPPacketQueue(AF_INET,
+                                                              queue_control));
+
+    // Enqueue the same packet three times.
+    Pkt4 out(DHCPDISCOVER, 1234);
+    out.setHWAddr(generateHWAddr(6));
+    out.pack();
+    const uint8_t* data = static_cast<const uint8_t*>(out.getBuffer().getData());
+    SocketInfo sock(IOAddress("127.0.0.1"), DHCP4_SERVER_PORT, 10);
+    for (int i = 0; i < 3; ++i) {
+        Pkt4Ptr pkt(new Pkt4(data, out.getBuffer().getLength()));
+        IfaceMgr::instance().getPacketQueue4()->enqueuePacket(pkt, sock);
+    }
+
+    // The two duplicates should be reported once.
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    for (int i = 0; i < 2; ++i) {
+        srv.updateQueueDropStats();
+        ObservationPtr drop_stat = mgr.getObservation("pkt4-queue-drop-duplicate");
+        ASSERT_TRUE(drop_stat);
+        EXPECT_EQ(2, drop_stat->getInteger().first);
+    }
+
+    // No other packets were dropped.
+    EXPECT_FALSE(mgr.getObservation("pkt4-queue-drop-rate-limit"));
+    EXPECT_FALSE(mgr.getObservation("pkt4-queue-drop-low-priority"));
+
+    IfaceMgr::instance().configureDHCPPacketQueue(AF_INET, ConstElementPtr());
+}
+
 // This test verifies that the server is able to handle an empty client-id
 // in incoming client message.
 TEST_F(Dhcpv4SrvTest, emptyClientId) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -608,6 +608,29 @@ public:
     /// @c DORA_CONFIGS array.
     void testMultiStageBoot(const unsigned int config_index);
 
+    /// @brief Processes a query as if it was received by a packet filter.
+    ///
+    /// The query is packed and parsed again as the server would receive it
+    /// and it is timestamped as the packet filters do upon reception.
+    ///
+    /// @param srv Server processing the query.
+    /// @param query Query sent by the client.
+    /// @return Response sent by the server or null pointer.
+    Pkt4Ptr receiveTimestamped(NakedDhcpv4Srv& srv, const Pkt4Ptr& query) {
+        query->pack();
+        Pkt4Ptr received(new Pkt4(static_cast<const uint8_t*>
+                                  (query->getBuffer().getData()),
+                                  query->getBuffer().getLength()));
+        received->setRemoteAddr(IOAddress("0.0.0.0"));
+        received->setLocalAddr(IOAddress("255.255.255.255"));
+        received->setIface("eth0");
+        received->updateTimestamp();
+        srv.fake_sent_.clear();
+        srv.fakeReceive(received);
+        srv.run_one();
+        return (srv.fake_sent_.empty() ? Pkt4Ptr() : srv.fake_sent_.back());
+    }
+
     /// @brief Interface Manager's fake configuration control.
     IfaceMgrTestConfig iface_mgr_test_config_;
 
@@ -1958,6 +1981,79 @@ TEST_F(DORATest, statisticsDORA) {
     EXPECT_EQ(5, pkt4_sent->getInteger().first);
 }
 
+/// This test verifies that the processing latency histograms are updated
+/// for each processed query.
+TEST_F(DORATest, statisticsLatency) {
+    Dhcp4Client client(Dhcp4Client::SELECTING);
+    // Configure DHCP server.
+    configure(DORA_CONFIGS[0], *client.getServer());
+    NakedDhcpv4Srv& srv = *client.getServer();
+
+    // The latency is measured from the reception time recorded by the
+    // packet filter.
+    Pkt4Ptr discover(new Pkt4(DHCPDISCOVER, 1234));
+    discover->setHWAddr(generateHWAddr());
+    Pkt4Ptr offer = receiveTimestamped(srv, discover);
+    ASSERT_TRUE(offer);
+    ASSERT_EQ(DHCPOFFER, static_cast<int>(offer->getType()));
+
+    Pkt4Ptr request(new Pkt4(DHCPREQUEST, 1235));
+    request->setHWAddr(discover->getHWAddr());
+    request->addOption(OptionPtr(new Option4AddrLst(DHO_DHCP_REQUESTED_ADDRESS,
+                                                    offer->getYiaddr())));
+    request->addOption(offer->getOption(DHO_DHCP_SERVER_IDENTIFIER));
+    Pkt4Ptr ack = receiveTimestamped(srv, request);
+    ASSERT_TRUE(ack);
+    ASSERT_EQ(DHCPACK, static_cast<int>(ack->getType()));
+
+    // A query without a reception time is not measured.
+    client.config_.lease_.addr_ = ack->getYiaddr();
+    client.config_.serverid_ = IOAddress("10.0.0.1");
+    client.setState(Dhcp4Client::RENEWING);
+    client.setHWAddress(discover->getHWAddr()->toText(false));
+    ASSERT_NO_THROW(client.doRequest());
+    ASSERT_TRUE(client.getContext().response_);
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+
+    // Each query has gone through all the stages.
+    const char* types[] = { "discover", "request" };
+    const char* stages[] = { "dequeued", "subnet-selected",
+                             "lease-allocated", "sent" };
+    for (int i = 0; i < 2; ++i) {
+        const std::string prefix = std::string("pkt4-") + types[i] + "-";
+        HistogramPtr total = mgr.getHistogram(prefix + "latency");
+        ASSERT_TRUE(total) << prefix;
+        EXPECT_EQ(1, total->getCount());
+
+        int64_t sum = 0;
+        for (int j = 0; j < 4; ++j) {
+            HistogramPtr stage = mgr.getHistogram(prefix + stages[j] +
+                                                  "-latency");
+            ASSERT_TRUE(stage) << prefix << stages[j];
+            EXPECT_EQ(1, stage->getCount());
+            sum += stage->getTotal();
+        }
+        // The stages add up to the whole processing time.
+        EXPECT_EQ(total->getTotal(), sum);
+    }
+
+    // The histograms are returned by statistic-get.
+    ConstElementPtr stat = mgr.get("pkt4-request-latency");
+    ASSERT_TRUE(stat);
+    ConstElementPtr value = stat->get("pkt4-request-latency");
+    ASSERT_TRUE(value);
+    ASSERT_EQ(Element::list, value->getType());
+    ASSERT_EQ(1, value->size());
+    ASSERT_EQ(2, value->get(0)->size());
+    ConstElementPtr histogram = value->get(0)->get(0);
+    ASSERT_EQ(Element::map, histogram->getType());
+    ASSERT_TRUE(histogram->get("count"));
+    EXPECT_EQ(1, histogram->get("count")->intValue());
+    EXPECT_TRUE(histogram->get("buckets"));
+}
+
 // This test verifies that after a client completes an exchange that result
 // in NAK, appropriate statistics are updated.
 TEST_F(DORATest, statisticsNAK) {
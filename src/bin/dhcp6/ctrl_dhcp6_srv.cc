@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -18,8 +18,11 @@
 #include <dhcp6/parser_context.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/stopwatch.h>
 #include <cfgrpt/config_report.h>
 #include <signal.h>
+
+#include <algorithm>
 #include <sstream>
 
 using namespace isc::config;
@@ -327,6 +330,9 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
         return (result);
     }
 
+    // Measure the time it takes to apply the new configuration.
+    util::Stopwatch stopwatch;
+
     // We are starting the configuration process so we should remove any
     // staging configuration that has been created during previous
     // configuration attempts.
@@ -358,6 +364,11 @@ ControlledDhcpv6Srv::commandConfigSetHandler(const string&,
 
         // Use new configuration.
         CfgMgr::instance().commit();
+
+        // Report how long the reconfiguration took.
+        stopwatch.stop();
+        StatsMgr::instance().setValue("reconfiguration-duration",
+                                      stopwatch.getTotalDuration());
     } else {
         // Ok, we applied the logging from the upcoming configuration, but
         // there were problems with the config. As such, we need to back off
@@ -789,6 +800,13 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
     CommandMgr::instance().registerCommand("version-get",
         boost::bind(&ControlledDhcpv6Srv::commandVersionGetHandler, this, _1, _2));
 
+    // Register callout statistics commands
+    CommandMgr::instance().registerCommand("callout-statistics-get",
+        boost::bind(&HooksManager::calloutStatisticsGetHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("callout-statistics-reset",
+        boost::bind(&HooksManager::calloutStatisticsResetHandler, _1, _2));
+
     // Register statistic related commands
     CommandMgr::instance().registerCommand("statistic-get",
         boost::bind(&StatsMgr::statisticGetHandler, _1, _2));
@@ -796,6 +814,9 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
     CommandMgr::instance().registerCommand("statistic-get-all",
         boost::bind(&StatsMgr::statisticGetAllHandler, _1, _2));
 
+    CommandMgr::instance().registerCommand("statistic-export",
+        boost::bind(&StatsMgr::statisticExportHandler, _1, _2));
+
     CommandMgr::instance().registerCommand("statistic-reset",
         boost::bind(&StatsMgr::statisticResetHandler, _1, _2));
 
@@ -829,6 +850,8 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
 
         // Deregister any registered commands (please keep in alphabetic order)
         CommandMgr::instance().deregisterCommand("build-report");
+        CommandMgr::instance().deregisterCommand("callout-statistics-get");
+        CommandMgr::instance().deregisterCommand("callout-statistics-reset");
         CommandMgr::instance().deregisterCommand("config-get");
         CommandMgr::instance().deregisterCommand("config-set");
         CommandMgr::instance().deregisterCommand("config-reload");
@@ -839,6 +862,7 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
         CommandMgr::instance().deregisterCommand("shutdown");
+        CommandMgr::instance().deregisterCommand("statistic-export");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-remove");
@@ -870,11 +894,21 @@ ControlledDhcpv6Srv::reclaimExpiredLeases(const size_t max_leases,
                                           const uint16_t timeout,
                                           const bool remove_lease,
                                           const uint16_t max_unwarned_cycles) {
-    server_->alloc_engine_->reclaimExpiredLeases6(max_leases, timeout,
-                                                  remove_lease,
-                                                  max_unwarned_cycles);
+    const bool incomplete =
+        server_->alloc_engine_->reclaimExpiredLeases6(max_leases, timeout,
+                                                      remove_lease,
+                                                      max_unwarned_cycles);
     // We're using the ONE_SHOT timer so there is a need to re-schedule it.
-    TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+    // If some expired leases are left, the next pass is run after the time
+    // equal to the maximum duration of the pass rather than the configured
+    // timer interval. The server processes the received packets between
+    // the passes, so it isn't starved while the reclamation catches up.
+    if (incomplete) {
+        TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME,
+                                    std::max(static_cast<long>(timeout), 1L));
+    } else {
+        TimerMgr::instance()->setup(CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME);
+    }
 }
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -291,7 +291,9 @@ private:
     ///
     /// This is a wrapper method for @c AllocEngine::reclaimExpiredLeases6.
     /// It reschedules the timer for leases reclamation upon completion of
-    /// this method.
+    /// this method. If not all expired leases have been reclaimed, the
+    /// timer is rescheduled to run the next pass after the @c timeout
+    /// rather than after the configured timer interval.
     ///
     /// @param max_leases Maximum number of leases to be reclaimed.
     /// @param timeout Maximum amount of time that the reclamation routine
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 179
-#define YY_END_OF_BUFFER 180
+#define YY_NUM_RULES 183
+#define YY_END_OF_BUFFER 184
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,168 +700,172 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1453] =
+static const flex_int16_t yy_accept[1493] =
     {   0,
-      172,  172,    0,    0,    0,    0,    0,    0,    0,    0,
-      180,  178,   10,   11,  178,    1,  172,  169,  172,  172,
-      178,  171,  170,  178,  178,  178,  178,  178,  165,  166,
-      178,  178,  178,  167,  168,    5,    5,    5,  178,  178,
-      178,   10,   11,    0,    0,  161,    0,    0,    0,    0,
+      176,  176,    0,    0,    0,    0,    0,    0,    0,    0,
+      184,    1,  182,  182,  182,  169,  170,  171,  172,  173,
+      174,  176,  176,  175,  176,  182,  182,  182,  182,  182,
+      182,  182,  182,   10,   11,    5,    5,    5,  182,  182,
+      182,    1,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  172,
-      172,    0,  171,  172,    3,    2,    6,    0,  172,    0,
-        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,  165,    0,    3,    2,    6,
+      175,  176,    0,  176,  176,    0,  176,    0,    0,    0,
+        0,    0,    0,   10,   11,    4,    0,    0,    9,    0,
 
-      162,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  164,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
-        0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
-      139,    0,    0,  140,    0,    0,    0,    0,    0,    0,
-
-        0,    0,  163,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   94,    0,    0,    0,    0,    0,
+        0,    0,  168,    0,    0,    0,    0,    0,  166,    2,
+        0,    0,    0,    0,    0,    0,    0,    8,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,  143,    0,    0,    0,  144,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   94,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      177,  175,    0,  174,  173,    0,    0,    0,    0,    0,
-
-        0,    0,  138,    0,    0,   28,    0,   27,    0,    0,
-      101,    0,    0,    0,    0,    0,    0,    0,    0,   53,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   98,
+        0,    0,    0,  167,    0,    0,  179,  177,    0,    0,
+
+      181,  178,    0,    0,    0,    0,    0,    0,    0,    0,
+       53,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  142,    0,    0,   28,    0,   27,
+        0,  101,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   98,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-      176,  173,    0,    0,    0,    0,    0,    0,    0,    0,
-       29,    0,    0,   31,    0,    0,    0,    0,    0,  102,
-        0,    0,    0,    0,    0,    0,   79,    0,    0,    0,
-        0,    0,    0,  123,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   56,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   78,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   88,
-        0,   57,    0,    0,    0,    0,    0,    0,    0,    0,
+      180,  177,    0,    0,    0,    0,    0,    0,  102,    0,
+        0,    0,    0,   88,    0,   57,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   29,    0,    0,
+       31,    0,    0,    0,    0,   79,    0,    0,    0,    0,
+        0,    0,  127,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   56,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   78,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  118,
-      143,   49,    0,   54,    0,    0,    0,    0,    0,    0,
-      158,   37,    0,   34,    0,   33,    0,    0,    0,  131,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      110,    0,    0,    0,    0,    0,    0,    0,    0,  142,
+        0,  122,  147,   49,    0,   54,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   51,    0,    0,   32,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   81,    0,
+       81,    0,    0,    0,    0,    0,    0,    0,  162,   37,
+        0,   34,    0,   33,    0,    0,    0,  135,  113,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  110,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  146,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   51,   32,    0,
 
-      132,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  127,    0,    0,    0,    0,    0,    0,
-        7,   35,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  136,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      100,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      131,    0,    0,    0,    0,    0,    0,    0,    0,    7,
+        0,    0,    0,    0,    0,    0,    0,   83,    0,    0,
+        0,    0,    0,    0,    0,    0,   35,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      112,    0,    0,    0,    0,    0,    0,  109,    0,    0,
-        0,    0,    0,    0,    0,    0,   83,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  100,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  112,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   91,
-        0,    0,    0,    0,    0,    0,    0,    0,  106,    0,
-        0,    0,    0,   90,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  109,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  126,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  136,  107,
-        0,    0,    0,    0,  111,   50,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   58,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   91,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   90,    0,    0,    0,    0,
+        0,    0,    0,    0,   58,    0,    0,  106,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  130,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  140,
+      107,    0,    0,    0,    0,  111,   50,    0,    0,    0,
 
-        0,    0,    0,    0,    0,   74,    0,    0,    0,    0,
-        0,    0,  159,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   97,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      125,    0,    0,    0,    0,    0,    0,   61,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   55,   82,    0,    0,    0,  122,
-        0,    0,    0,   48,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  114,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   74,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  126,    0,    0,    0,   55,
+       82,    0,  163,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   97,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  129,    0,    0,    0,    0,    0,    0,
+       61,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,   48,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  118,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  157,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   92,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  161,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   40,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   16,
-        0,  137,   14,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   92,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  128,  113,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  124,  141,    0,   39,    0,  133,    0,    0,    0,
-        0,    0,    0,    0,    0,   20,    0,    0,    0,   76,
-        0,    0,    0,    0,  135,   52,    0,   84,    0,    0,
+       40,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+      141,   14,    0,    0,   16,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  132,    0,    0,    0,    0,
+        0,    0,   84,    0,   52,  139,    0,    0,    0,    0,
+      116,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  128,  145,    0,
+       39,    0,    0,  137,    0,    0,    0,    0,    0,    0,
+        0,    0,   20,    0,   76,    0,    0,    0,    0,    0,
+        0,    0,  114,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  117,    0,   73,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   73,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   80,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  130,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,   80,    0,    0,
+        0,    0,    0,  134,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  103,    0,    0,    0,    0,    0,
-
-       77,   99,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   70,    0,    0,    0,    0,    0,    0,
-       17,   15,    0,  155,  154,    0,   65,    0,    0,    0,
-        0,    0,   30,  117,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  152,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   93,    0,  121,   42,    0,
-       59,    0,    0,    0,    0,   19,    0,    0,    0,    0,
-        0,    0,   95,   71,    0,    0,  129,    0,    0,    0,
-        0,    0,  120,    0,    0,    0,    0,   89,    0,  160,
-        0,    0,    0,    0,    0,    0,    0,    0,   87,    0,
-
-        0,  144,    0,    0,    0,    0,    0,    0,    0,    0,
+      103,    0,    0,    0,    0,   77,    0,   99,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   70,    0,
+        0,    0,    0,    0,    0,   15,   17,    0,    0,  159,
+      158,    0,   65,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  121,    0,    0,    0,   30,    0,    0,    0,
+      156,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   93,  125,    0,   42,   59,    0,    0,
+
+        0,    0,   19,    0,    0,    0,    0,    0,    0,    0,
+        0,  133,   71,    0,    0,    0,    0,    0,  124,   95,
+        0,    0,    0,   89,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  164,    0,    0,   87,    0,    0,  148,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       41,    0,   64,    0,    0,    0,  115,   46,    0,    0,
-       66,  153,    0,    0,   12,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   44,    0,    0,   43,   18,    0,
-        0,    0,    0,  108,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   69,    0,    0,
-       60,    0,    0,   85,    0,    0,    0,    0,    0,  134,
-        0,    0,    0,   45,    0,    0,    0,    0,    0,    0,
-
+        0,    0,    0,    0,    0,    0,    0,    0,   41,    0,
+       64,    0,    0,   46,    0,    0,   66,  157,  119,    0,
+        0,    0,    0,   12,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   44,    0,    0,   43,   18,    0,    0,
+
+        0,    0,  108,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   69,    0,   60,    0,
+        0,    0,    0,    0,   85,    0,    0,    0,  138,    0,
+        0,    0,   45,    0,    0,    0,    0,    0,    0,  115,
         0,    0,    0,    0,    0,    0,    0,   63,    0,    0,
-       75,    0,   36,   47,    0,    0,    0,    0,    0,   24,
-        0,    0,    0,    0,    0,    0,  150,    0,  119,    0,
+       75,    0,   47,    0,   36,    0,    0,    0,    0,    0,
+       24,    0,    0,    0,    0,    0,    0,  154,    0,  123,
         0,    0,    0,    0,    0,    0,    0,    0,   96,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   25,   38,
-        0,    0,    0,    0,    0,   13,    0,    0,    0,    0,
-        0,    0,    0,  156,    0,    0,    0,    0,    0,    0,
-      149,    0,    0,   21,   68,    0,    0,    0,    0,    0,
-        0,    0,   86,    0,    0,  148,    0,    0,   67,    0,
-        0,   62,    0,   23,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   25,    0,
+       38,    0,    0,    0,    0,   13,    0,    0,    0,    0,
 
+        0,    0,   68,    0,  160,    0,    0,    0,    0,    0,
+        0,  153,    0,    0,   21,    0,    0,    0,    0,    0,
+        0,    0,   86,    0,    0,    0,    0,  152,   67,    0,
+        0,   62,    0,   23,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   22,    0,  104,  116,    0,    0,    0,    0,    0,
-        0,  146,  151,   72,    0,    0,    0,    0,  145,    0,
+        0,   22,    0,  104,  120,    0,    0,    0,    0,    0,
+        0,  150,  155,   72,    0,    0,    0,    0,  149,    0,
         0,   26,    0,    0,    0,    0,    0,  105,    0,    0,
-      147,    0
+      151,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -877,9 +881,9 @@ static const YY_CHAR yy_ec[256] =
         5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
        40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       48,   49,   50,   51,   52,   28,   53,   54,   55,   56,
+       57,   58,   59,   60,   61,   62,   63,   64,   65,   66,
+       67,   68,   69,    5,   70,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -896,768 +900,901 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[71] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1465] =
+static const flex_int16_t yy_base[1493] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1817, 1818,   32, 1813,  141,    0,  201, 1818,  206,   88,
-       11,  213, 1818, 1795,  114,   25,    2,    6, 1818, 1818,
-       73,   11,   17, 1818, 1818, 1818,  104, 1801, 1756,    0,
-     1793,  107, 1808,  217,  241, 1818,  185, 1752, 1758, 1778,
-       93,   58,  190,   91,  211,  200,   14,  267,  213,  175,
-      269,   64,  231,  184,  187,   75, 1759,  274,  215,  290,
-      278,  297, 1742,  207,  302,  316,  316, 1761,    0,  355,
-      360,  372,  377,  380, 1818,    0, 1818,  295,  383,  227,
-      296,  283,  327,  361,  293, 1818, 1758, 1797, 1818,  237,
-
-     1818,  394,  363, 1745, 1755, 1794,  375,  321,  403, 1749,
-      369,  378,  376,  382,  388, 1792,    0,  445,  407, 1736,
-     1744,  364, 1740, 1729, 1730,  372, 1746, 1729, 1738,  387,
-      308,  378, 1732, 1730,  391, 1719, 1775,  416, 1722, 1773,
-     1715, 1738, 1735, 1735, 1729,  214, 1722, 1715, 1720, 1714,
-      382, 1725, 1718, 1709, 1708, 1722,  362, 1758, 1707,  414,
-     1719, 1722, 1706,  441, 1707,  417, 1719, 1716, 1717, 1715,
-      422, 1697, 1702, 1698, 1690, 1707, 1699,    0,  422,  450,
-      440,  446,  454,  470, 1698, 1818,    0,  476, 1689, 1692,
-     1818,  465,  447, 1818, 1744, 1699,  477, 1742,  481, 1741,
-
-      477, 1740, 1818,  521, 1739,  489, 1700, 1695, 1694, 1685,
-      465, 1734, 1728, 1694, 1673, 1681, 1687, 1675, 1689, 1685,
-     1686, 1686, 1681, 1673, 1675, 1659, 1663, 1676, 1678, 1675,
-     1667, 1657, 1660, 1674, 1818, 1660, 1668, 1671, 1652, 1651,
-     1701, 1650, 1660, 1698,  510, 1659, 1647, 1658, 1694,  490,
-     1698, 1635, 1650,    9, 1640, 1656, 1637, 1639, 1635, 1641,
-     1632, 1631, 1644, 1637, 1639, 1643, 1642, 1636,   80, 1643,
-     1638, 1630, 1620, 1635, 1630, 1634, 1615, 1631, 1617, 1623,
-     1630, 1618,  230, 1611, 1625, 1624, 1627, 1609, 1617,  491,
-     1818, 1818,  492, 1818, 1818, 1604,    0,  376, 1606,  508,
-
-      501, 1660, 1818, 1613,  480, 1818, 1658, 1818, 1652,  562,
-     1818,  480, 1594, 1604, 1654, 1611, 1606, 1609,  304, 1818,
-     1607, 1649, 1604, 1601, 1602,  303, 1606, 1644, 1594, 1589,
-     1586, 1582, 1584, 1633, 1592, 1581, 1597, 1629, 1577,  568,
-     1590, 1590, 1573, 1574, 1587, 1574, 1584, 1579, 1586, 1581,
-     1566,  451, 1575, 1578, 1573, 1569, 1617,  501,  497, 1818,
-     1611, 1563, 1562, 1555, 1557, 1561, 1550, 1557, 1562,  550,
-     1607, 1562,  503, 1559, 1563, 1561, 1550, 1550, 1562,  496,
-     1537, 1538, 1559,  511, 1541, 1538, 1552, 1551, 1537, 1549,
-     1548, 1547, 1546,  507, 1587, 1586, 1585, 1529,  583, 1542,
-
-     1818, 1818, 1541,    0,  518, 1529, 1580, 1579, 1537, 1577,
-     1818, 1525, 1575, 1818,  541,  617,  520, 1574, 1516, 1818,
-     1521, 1527, 1530, 1529, 1516, 1515, 1818, 1517, 1514, 1526,
-      543, 1511, 1513, 1818, 1519, 1504, 1506, 1517, 1515, 1510,
-      585, 1517, 1505, 1498, 1547, 1818, 1496, 1512, 1544, 1548,
-     1506, 1500, 1502, 1503, 1505, 1537, 1490, 1485, 1484, 1486,
-     1479, 1494, 1472, 1479, 1484, 1532, 1818, 1479, 1475, 1529,
-     1482, 1476, 1483, 1468, 1478, 1481, 1470, 1469, 1464, 1818,
-     1519, 1818, 1463, 1462, 1455, 1472, 1509, 1456, 1461, 1470,
-     1464, 1458, 1467,  586, 1502, 1466, 1449, 1449, 1444, 1440,
-
-     1446, 1445, 1453, 1457, 1440, 1496, 1438, 1452, 1441, 1818,
-     1818, 1818, 1441, 1818, 1451, 1485, 1447,    0, 1488, 1438,
-     1818, 1818, 1435, 1818, 1441, 1818,  562,  562,  593, 1818,
-     1479, 1426, 1477, 1424, 1423, 1430, 1423, 1435, 1434, 1418,
-     1433, 1415, 1462, 1429, 1465, 1411, 1413, 1425, 1425, 1424,
-     1818, 1409, 1406, 1462, 1419, 1411, 1417, 1408, 1416, 1818,
-     1401, 1412, 1416, 1398, 1412,  555, 1394, 1388, 1393, 1390,
-     1405, 1406, 1403, 1444, 1401, 1818, 1387, 1389, 1818, 1397,
-     1434, 1433,  575, 1396, 1379, 1380, 1385, 1376, 1818, 1390,
-     1376,  608, 1368, 1389, 1386, 1378, 1421, 1375, 1382, 1418,
-
-     1818, 1366, 1364, 1378, 1362, 1376, 1379, 1411, 1410, 1409,
-     1356, 1407, 1406, 1818,  599, 1368, 1368, 1366, 1355, 1357,
-     1818, 1818, 1400, 1348, 1403,  581,  588, 1346, 1361, 1400,
-      575, 1394, 1393, 1392, 1346, 1336, 1389, 1351, 1341, 1349,
-     1385, 1348, 1330, 1338, 1340, 1344, 1379, 1383, 1340, 1339,
-     1818, 1340, 1333, 1322, 1335, 1338, 1333, 1328, 1333, 1330,
-     1329, 1325, 1331, 1326, 1367, 1366, 1310, 1306,  569, 1363,
-     1818, 1362, 1311, 1303, 1354, 1317, 1304, 1818, 1304, 1313,
-     1312, 1312, 1296, 1351, 1294, 1307, 1818, 1299, 1291, 1300,
-     1293, 1304, 1281, 1285, 1336, 1300, 1282, 1280, 1291, 1331,
-
-     1330, 1329, 1276, 1292,  576,  594, 1269, 1279,  588, 1818,
-     1329, 1275, 1285, 1285, 1274, 1278, 1285, 1322, 1818, 1316,
-      592, 1278, 1270, 1818, 1266, 1279, 1259, 1262, 1258, 1275,
-       11,   65,   79,  184,  220,  300,  426,  389,  419,  469,
-      551,  562, 1818,  583,  587,  582,  602,  600,  644,  586,
-      590,  610,  611,  598,  661,  620,  606,  609, 1818, 1818,
-      625,  624,  629,  617, 1818, 1818,  631,  618,  616,  634,
-      621,  621,  670,  622,  678,  679, 1818,  626,  640,  640,
-      683,  633,  635,  629,  687,  642,  632,  633,  629,  639,
-      643,  654,  638,  656,  651,  653,  646,  648,  660,  650,
-
-      665,  704,  663,  668,  645, 1818,  670,  660,  705,  654,
-      669,  670, 1818,  689,  697,  666,  680,  668,  663,  675,
-      670,  671,  667,  676,  671,  722,  728,  687,  678, 1818,
-      690,  675,  691,  681,  693,  687,  732,  700,  685,  686,
-     1818,  703,  706,  689,  691,  747,  692, 1818,  709,  712,
-      692,  711,  749,  709,  705,  700,  718,  717,  703,  718,
-      710,  706,  724,  709, 1818, 1818,  717,  762,  717, 1818,
-      725,  720,  771, 1818,  722,  727,  769,  723,  724,  736,
-      730,  734,  732,  730,  741,  784,  730,  786,  787,  733,
-      745, 1818,  733,  741,  739,  744,  756,  740,  754,  755,
-
-      756,  772,  777,  759,  746,  747,  767,  756,  761,  768,
-      809,  810,  759,  763, 1818,  808,  759,  777,  774,  812,
-      763,  781,  782,  768,  776,  785,  765,  780,  787,  829,
-      830, 1818,  785,  832,  833,  786,  796,  798,  782,  783,
-      790,  799,  842,  791,  790,  807,  846,  798,  802,  800,
-      798,  851,  852,  804,  854,  850,  810, 1818,  815,  808,
-      799,  818,  812,  807,  817,  814,  819,  815,  827, 1818,
-      811, 1818, 1818,  812,  870,  811,  830,  831,  828,  814,
-      835,  817,  822,  829,  862,  853,  883,  828,  830,  847,
-      845,  837,  841, 1818, 1818,  851,  849,  852,  836,  837,
-
-      895,  850,  855,  842,  853,  845,  851,  847,  865,  867,
-      868, 1818, 1818,  866, 1818,  868, 1818,  853,  855,  874,
-      864,  914,  869,  911,  877, 1818,  869,  861,  920, 1818,
-      921,  870,  877,  919, 1818, 1818,  879, 1818,  870,  870,
-      873,  887,  892,  875,  886,  933,  892,  893,  894,  932,
-      890,  939,  940, 1818,  889,  942,  943,  885,  945,  906,
-      890,  902,  892,  922,  951, 1818,  952,  901,  916,  903,
-      899,  915,  920,  908,  908,  961,  920, 1818,  922,  921,
-      923,  916,  925,  926,  923,  913,  916,  916,  973,  922,
-      975,  976,  921,  979, 1818,  917,  932,  925,  983,  938,
-
-     1818, 1818,  934,  944,  929,  947,  933,  992,  993,  940,
-      950,  997,  956, 1818,  948,  948,  950,  952, 1003,  948,
-     1818, 1818,  950, 1818, 1818,  964, 1818,  958, 1008,  959,
-     1010,  992, 1818, 1818,  956,  964,  958,  957,  960,  960,
-      961, 1019,  969, 1818,  965, 1022,  977,  968,  983,  983,
-      986,  986,  983, 1025,  989, 1818,  981, 1818, 1818,  991,
-     1818,  993,  994,  991, 1033, 1818,  984,  984,  990,  989,
-     1001, 1001, 1818, 1818, 1040,  989, 1818, 1006,  991,  991,
-      993,  999, 1818, 1052, 1005, 1054, 1017, 1818, 1014, 1818,
-     1033, 1058, 1059, 1018, 1004, 1062, 1063, 1018, 1818, 1008,
-
-     1066, 1818, 1006, 1063, 1028, 1024, 1066, 1016, 1021, 1019,
-     1076, 1034, 1078, 1079, 1042, 1031, 1025, 1041, 1085, 1029,
-     1046, 1031, 1046, 1030, 1086, 1087, 1088, 1037, 1090, 1055,
-     1818, 1041, 1818, 1052, 1099, 1071, 1818, 1818, 1045, 1102,
-     1818, 1818, 1051, 1049, 1818, 1105, 1053, 1102, 1047, 1052,
-     1111, 1061, 1071, 1072, 1818, 1115, 1070, 1818, 1818, 1061,
-     1076, 1064, 1079, 1818, 1116, 1084, 1077, 1078, 1087, 1069,
-     1075, 1078, 1130, 1091, 1091, 1134, 1085, 1818, 1136, 1137,
-     1818, 1087, 1087, 1818, 1091, 1086, 1085, 1143, 1098, 1818,
-     1140, 1093, 1090, 1818, 1104, 1107, 1150, 1105, 1152, 1095,
-
-     1097, 1105, 1095, 1111, 1112, 1106, 1122, 1818, 1112, 1162,
-     1818, 1158, 1818, 1818, 1159, 1116, 1124, 1115, 1122, 1818,
-     1119, 1124, 1122, 1172, 1173, 1118, 1818, 1133, 1818, 1123,
-     1135, 1136, 1179, 1123, 1131, 1125, 1133, 1146, 1818, 1145,
-     1133, 1187, 1137, 1149, 1140, 1149, 1151, 1155, 1818, 1818,
-     1194, 1139, 1155, 1197, 1198, 1818, 1194, 1158, 1155, 1160,
-     1147, 1142, 1163, 1818, 1206, 1165, 1166, 1209, 1168, 1171,
-     1818, 1212, 1175, 1818, 1818, 1157, 1215, 1164, 1217, 1162,
-     1179, 1165, 1818, 1165, 1167, 1818, 1172, 1182, 1818, 1168,
-     1180, 1818, 1176, 1818, 1186, 1180, 1184, 1175, 1227, 1176,
-
-     1184, 1193, 1186, 1181, 1182, 1197, 1188, 1195, 1182, 1197,
-     1202, 1245, 1204, 1247, 1248, 1193, 1209, 1200, 1214, 1210,
-     1203, 1818, 1255, 1818, 1818, 1256, 1257, 1214, 1213, 1214,
-     1204, 1818, 1818, 1818, 1262, 1206, 1222, 1265, 1818, 1261,
-     1212, 1818, 1211, 1213, 1224, 1271, 1222, 1818, 1231, 1274,
-     1818, 1818, 1280, 1285, 1290, 1295, 1300, 1305, 1310, 1313,
-     1287, 1292, 1294, 1307
+       71,    0,  141,    0,  206,    0,  208,    0,  205,    0,
+      226,  276,  346,  220,  207,    0,    0,    0,    0,    0,
+        0,  405,  223,    0,  228,  236,  196,  209,  198,  175,
+      205,  196,    0,  261,  261,    0,    0,  253,  211,  447,
+      250,    0,  497,  378,  370,  389,  213,  220,  242,  402,
+      502,  508,  494,  541,  542,  540,  380,  525,  468,  219,
+      388,  513,  482,  226,  533,  535,  548,  548,  216,  524,
+      559,  547,  372,  400,  622,    0,  692,    0,  762,    0,
+        0,    0,    0,    0,    0,  436,    0,  535,  387,  551,
+      474,  555,  476,    0,    0,    0,  485,  533,    0,  522,
+
+      786,  548,  554,  565,  558,  560,  754,  774,  797,  780,
+      791,  832,  810,  809,  837,  794,  809,  813,  811,  817,
+      828,  794,  790,  784,  790,  809,  810,  796,  806,  821,
+      822,  821,  803,  805,  824,  803,  866,  873,  820,  875,
+      820,  844,  843,  845,  841,  846,  838,  833,  831,  836,
+      842,  836,  850,  846,  839,  854,  859,  893,  847,  850,
+      852,  867,  867,  871,  871,  859,  857,  864,  862,  874,
+      858,  870,    0,    0,  954, 1021,    0, 1086,    0,    0,
+      900,  878, 1059,  866,  899,  875,  876,    0,  920,  884,
+      884,  879,  887,  930,  892,  888,  881,  882,  901,  889,
+
+     1036, 1034, 1075, 1035, 1040,    0, 1067, 1070, 1096,    0,
+     1053, 1081, 1098, 1082, 1099, 1078, 1103, 1066, 1067, 1056,
+     1069, 1051, 1061, 1068, 1059, 1074, 1074, 1077, 1079, 1076,
+     1071, 1080, 1072, 1070, 1092, 1090, 1086, 1078, 1094, 1085,
+     1100, 1089,    0, 1099, 1106, 1090, 1091, 1142, 1094, 1105,
+     1145, 1146, 1109, 1100, 1112, 1150, 1114, 1111, 1158, 1098,
+     1155, 1107, 1114, 1106, 1116, 1124, 1125, 1122, 1131, 1128,
+     1123, 1115, 1131, 1128, 1133, 1118, 1136, 1136, 1133, 1126,
+     1134, 1142, 1133, 1179, 1129, 1144, 1145, 1134, 1151, 1144,
+     1200,    0,    0,    0,    0, 1213,    0,    0, 1172, 1150,
+
+        0,    0, 1136, 1151, 1149, 1154, 1159, 1198, 1157, 1150,
+        0, 1160, 1203, 1205, 1167, 1163, 1165, 1174, 1180, 1201,
+     1173, 1226, 1218, 1245,    0, 1200, 1220,    0, 1248,    0,
+     1244,    0, 1189, 1196, 1219, 1261, 1219, 1218, 1221, 1261,
+     1228, 1268, 1221, 1219, 1218, 1216, 1221, 1231, 1272, 1240,
+     1225, 1225, 1281, 1277, 1241, 1243, 1229, 1233, 1247, 1237,
+     1248, 1245, 1254, 1251, 1239, 1242, 1251, 1256, 1253, 1252,
+     1247, 1259, 1303, 1253,    0, 1300, 1255, 1250, 1265, 1263,
+     1268, 1274, 1263, 1272, 1264, 1266, 1257, 1261, 1283, 1280,
+     1269, 1283, 1320, 1285, 1286, 1275, 1274, 1290, 1291, 1292,
+
+     1293, 1290, 1338, 1339, 1341, 1342, 1289, 1303, 1340, 1353,
+        0,    0, 1304, 1295, 1307, 1312, 1313, 1303,    0, 1314,
+     1309, 1306, 1313,    0, 1374,    0, 1321, 1334, 1326, 1333,
+     1330, 1358, 1336, 1388, 1389, 1349, 1397,    0, 1348, 1399,
+        0, 1376, 1346, 1403, 1404,    0, 1357, 1356, 1369, 1367,
+     1358, 1362,    0, 1369, 1357, 1362, 1374, 1374, 1417, 1372,
+     1371, 1383, 1418, 1370, 1387, 1422,    0, 1375, 1430, 1390,
+     1386, 1390, 1393, 1397, 1431, 1387, 1384, 1385, 1389, 1384,
+     1400, 1381, 1390, 1397, 1446, 1447, 1394, 1398,    0, 1400,
+     1405, 1409, 1397, 1406, 1409, 1413, 1452, 1412, 1409, 1419,
+
+     1405, 1412, 1422, 1464, 1460, 1426, 1412, 1414, 1412, 1466,
+     1424, 1419, 1420, 1429, 1415, 1436, 1422, 1479, 1424, 1439,
+     1431,    0,    0,    0, 1443,    0, 1434, 1480, 1478, 1491,
+     1447, 1436, 1486, 1436, 1446, 1455, 1448, 1500, 1522, 1458,
+        0, 1471, 1458, 1461, 1475, 1468, 1525, 1478,    0,    0,
+     1478,    0, 1491,    0, 1511, 1511, 1532,    0,    0, 1497,
+     1498, 1485, 1501, 1486, 1534, 1503, 1541, 1490, 1494, 1507,
+     1509,    0, 1497, 1511, 1553, 1498, 1507, 1514, 1508, 1517,
+     1517,    0, 1506, 1518, 1525, 1512, 1527, 1528, 1514, 1510,
+     1517, 1516, 1532, 1535, 1534, 1577, 1536,    0,    0, 1528,
+
+     1526, 1576, 1539, 1578, 1584, 1534, 1545, 1526, 1533, 1540,
+     1548, 1586, 1550, 1545, 1589, 1540,    0, 1540, 1555, 1542,
+     1557, 1562, 1561, 1556, 1598, 1599, 1549, 1601, 1602, 1603,
+        0, 1609, 1568, 1570, 1561, 1571, 1566,    0, 1607,    0,
+     1569, 1588, 1615, 1625, 1626, 1632, 1593,    0, 1586, 1580,
+     1594, 1582, 1596, 1598, 1585, 1641,    0, 1637, 1588, 1644,
+     1622, 1633, 1598, 1596, 1650, 1614, 1607, 1616, 1654, 1619,
+     1604, 1614, 1617, 1623, 1660, 1624, 1667,    0, 1626, 1623,
+     1615, 1629, 1634, 1633, 1632, 1630, 1637, 1637, 1638, 1643,
+     1637, 1641, 1684, 1685, 1632, 1630, 1640, 1689,    0, 1690,
+
+     1636, 1644, 1653, 1690, 1644, 1646,    0, 1639, 1657, 1654,
+     1655, 1697, 1663, 1648, 1665, 1645, 1651, 1651, 1663, 1705,
+     1706, 1707, 1657, 1663, 1666, 1670, 1671, 1657, 1679, 1670,
+     1671, 1724,    0, 1673, 1686, 1679, 1689, 1685,    0, 1694,
+     1682, 1696, 1679, 1684, 1682,    0, 1690, 1697, 1740, 1700,
+     1689, 1689, 1744, 1745,    0, 1708, 1747,    0, 1743, 1721,
+     1708, 1709, 1700, 1712, 1699, 1698, 1704, 1757, 1706, 1721,
+     1705, 1756, 1714, 1723,    0, 1723, 1726, 1724, 1767, 1712,
+     1721, 1715, 1729, 1731, 1719, 1775, 1721, 1736, 1725,    0,
+        0, 1740, 1739, 1744, 1733,    0,    0, 1733, 1747, 1748,
+
+     1733, 1737, 1737, 1786, 1787, 1743, 1732, 1739, 1740, 1736,
+     1742, 1799, 1754, 1749, 1753, 1763, 1748, 1765, 1760, 1758,
+     1762, 1768, 1759, 1773, 1760, 1762, 1814, 1770, 1774, 1779,
+     1757,    0, 1781, 1773, 1766, 1818, 1781, 1769, 1776, 1771,
+     1782, 1778, 1779, 1793, 1782,    0, 1828, 1786, 1780,    0,
+        0, 1792,    0, 1811, 1819, 1789, 1792, 1787, 1837, 1843,
+     1802, 1794,    0, 1805, 1791, 1806, 1797, 1808, 1803, 1847,
+     1799, 1800, 1815,    0, 1818, 1819, 1803, 1805, 1860, 1807,
+        0, 1826, 1826, 1809, 1826, 1864, 1824, 1821, 1832, 1817,
+     1818, 1832, 1834, 1826, 1822, 1827, 1840, 1837, 1840, 1837,
+
+     1879, 1833, 1886,    0, 1838, 1836, 1847, 1843, 1846, 1845,
+     1843, 1846, 1840, 1897, 1898, 1845, 1856, 1901, 1848,    0,
+     1861, 1848, 1856, 1854, 1859, 1870, 1867, 1856, 1869, 1912,
+     1857, 1876, 1867, 1871, 1878, 1864, 1920, 1873, 1922, 1923,
+     1882, 1898, 1903, 1885, 1928, 1878, 1882,    0, 1926, 1878,
+     1895, 1892, 1930, 1882, 1899, 1900, 1887, 1902, 1883, 1897,
+     1904, 1898, 1945, 1946, 1949, 1901,    0, 1948, 1911, 1904,
+     1917, 1901, 1902, 1909, 1917, 1909, 1961, 1924, 1963, 1911,
+     1917, 1920, 1916, 1920, 1918, 1965, 1971, 1923, 1914, 1932,
+        0, 1933, 1928, 1923, 1932, 1930, 1934, 1931, 1936, 1983,
+
+        0,    0, 1928, 1985,    0, 1930, 1947, 1929, 1947, 1949,
+     1946, 1932, 1934, 1953, 1940,    0, 1943, 1959, 1957, 1950,
+     1954, 1947,    0, 1957,    0,    0, 1954, 1986, 1977, 2007,
+        0, 1969, 1967, 1970, 1955, 1956, 2013, 1968, 1973, 1961,
+     1971, 1964, 1965, 1982, 1983, 1984, 1974,    0,    0, 1984,
+        0, 1984, 1971,    0, 1989, 1974, 1982, 2031, 1986, 2029,
+     1995, 1988,    0, 2037,    0, 1981, 2039, 1989, 1993, 1996,
+     2038, 1989,    0, 2003, 2008, 1992, 1994, 2003, 2050, 2009,
+     2010, 2011, 2049, 1999,    0, 2056,    0, 2057, 2011, 2008,
+     2060, 2061, 2004, 2063, 2008, 2025, 2020, 2016, 2030, 2018,
+
+     2014, 2029, 2072, 2030, 2018, 2047, 2076,    0, 2039, 2028,
+     2028, 2080, 2039,    0, 2041, 2040, 2042, 2036, 2044, 2041,
+     2032, 2035, 2035, 2049, 2041, 2093, 2094, 2040, 2096, 2097,
+        0, 2036, 2051, 2044, 2101,    0, 2057,    0, 2055, 2060,
+     2066, 2052, 2053, 2057, 2066, 2113, 2115, 2074,    0, 2067,
+     2067, 2069, 2071, 2121, 2122,    0,    0, 2068, 2070,    0,
+        0, 2083,    0, 2126, 2079, 2079, 2081, 2075, 2074, 2077,
+     2077, 2079,    0, 2093, 2136, 2118,    0, 2082, 2139, 2090,
+        0, 2086, 2142, 2097, 2089, 2103, 2103, 2105, 2102, 2144,
+     2108, 2110, 2102,    0,    0, 2111,    0,    0, 2112, 2113,
+
+     2110, 2152,    0, 2104, 2104, 2121, 2112, 2111, 2121, 2160,
+     2110,    0,    0, 2126, 2112, 2112, 2114, 2120,    0,    0,
+     2172, 2126, 2174,    0, 2137, 2134, 2177, 2136, 2123, 2180,
+     2181, 2182, 2127,    0, 2160, 2139,    0, 2130, 2187,    0,
+     2128, 2184, 2149, 2145, 2137, 2142, 2140, 2196, 2192, 2155,
+     2199, 2200, 2163, 2153, 2147, 2162, 2205, 2145, 2151, 2167,
+     2166, 2152, 2207, 2208, 2209, 2159, 2211, 2176,    0, 2163,
+        0, 2173, 2220,    0, 2166, 2222,    0,    0,    0, 2177,
+     2196, 2173, 2172,    0, 2227, 2176, 2224, 2170, 2231, 2183,
+     2192, 2193, 2236,    0, 2181, 2192,    0,    0, 2184, 2198,
+
+     2187, 2201,    0, 2243, 2239, 2207, 2200, 2209, 2192, 2198,
+     2200, 2253, 2214, 2213, 2256, 2208,    0, 2258,    0, 2210,
+     2260, 2211, 2211, 2215,    0, 2210, 2209, 2266,    0, 2262,
+     2216, 2213,    0, 2224, 2227, 2230, 2273, 2228, 2275,    0,
+     2219, 2221, 2218, 2233, 2234, 2229, 2244,    0, 2235, 2284,
+        0, 2280,    0, 2244,    0, 2282, 2240, 2247, 2239, 2245,
+        0, 2246, 2245, 2294, 2246, 2296, 2242,    0, 2256,    0,
+     2247, 2258, 2301, 2246, 2254, 2248, 2256, 2268,    0, 2267,
+     2308, 2257, 2310, 2261, 2272, 2264, 2273, 2277,    0, 2274,
+        0, 2317, 2263, 2278, 2320,    0, 2316, 2280, 2277, 2282,
+
+     2270, 2265,    0, 2285,    0, 2328, 2287, 2288, 2289, 2292,
+     2333,    0, 2334, 2297,    0, 2280, 2337, 2287, 2339, 2285,
+     2301, 2288,    0, 2288, 2290, 2295, 2304,    0,    0, 2291,
+     2302,    0, 2299,    0, 2308, 2303, 2306, 2298, 2349, 2299,
+     2307, 2315, 2309, 2304, 2305, 2319, 2311, 2317, 2305, 2319,
+     2324, 2367, 2326, 2369, 2370, 2316, 2331, 2323, 2336, 2332,
+     2326,    0, 2377,    0,    0, 2378, 2379, 2336, 2335, 2336,
+     2327,    0,    0,    0, 2384, 2329, 2344, 2387,    0, 2383,
+     2335,    0, 2334, 2336, 2346, 2393, 2345,    0, 2353, 2396,
+        0,    1
     } ;
 
-static const flex_int16_t yy_def[1465] =
+static const flex_int16_t yy_def[1493] =
     {   0,
-     1453, 1453, 1454, 1454, 1453, 1453, 1453, 1453, 1453, 1453,
-     1452, 1452, 1452, 1452, 1452, 1455, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1456,
-     1452, 1452, 1452, 1457,   15, 1452,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1458,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1455, 1452,
-     1452, 1452, 1452, 1452, 1452, 1459, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1456, 1452, 1457,
-
-     1452, 1452,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1460,   45, 1458,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1459, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1461,   45,   45,   45,
-     1452,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-
-       45, 1460, 1452, 1458,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1452,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1462,   45,   45,   45,
+     1492,    1, 1492,    3,    1,    5,    5,    7,    5,    9,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492,   22,   22,   22, 1492, 1492, 1492, 1492,   27,
+       28,   29, 1492, 1492, 1492, 1492,   34, 1492, 1492, 1492,
+     1492,   12,   13,   43,   43,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   46,   45,   45,   50,
+       45,   45,   45,   45,   45,   45,   53,   45,   45,   45,
+       45,   54,   55,   45, 1492, 1492, 1492, 1492, 1492, 1492,
+       22,   25,   26,   23,   25,   26,   86, 1492,   88, 1492,
+       90, 1492,   92,   34,   35, 1492, 1492,   40, 1492,   45,
 
-       45,   45, 1452,   45,   45, 1452,   45, 1452,   45, 1458,
-     1452,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,  109,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1452, 1452, 1452, 1463,   45,   45,   45,   45,   45,   45,
-     1452,   45,   45, 1452,   45, 1458,   45,   45,   45, 1452,
-       45,   45,   45,   45,   45,   45, 1452,   45,   45,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1452,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  117,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1452,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-       45, 1452,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,  118,   45,   45,   45,   45,
+       45,   45,   45,   45, 1492, 1492,   77, 1492, 1492,   79,
+     1492,  181, 1492,  183, 1492,  185, 1492, 1492,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-     1452, 1452,   45, 1452,   45,   45, 1452, 1464,   45,   45,
-     1452, 1452,   45, 1452,   45, 1452,   45,   45,   45, 1452,
+       45,   45,   45,   45,   45, 1492,   45,   45,   45, 1492,
+       45,   45,   45,   45,   45,   45,   45,  203,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1452,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
+       45,   45, 1492,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,  212,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1452,   45,   45, 1452,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1452,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,  213,   45,   45,   45,   45,   45,   45,
+      175,  176,  176, 1492,   77, 1492, 1492, 1492, 1492,  299,
 
-     1452,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-     1452, 1452,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1492, 1492, 1492,   45,   45,   45,   45,   45,   45,   45,
+     1492,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1492,   45,   45, 1492,   45, 1492,
+       45, 1492,  320,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1452,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1452,   45,   45,   45,   45,   45,   45, 1452,   45,   45,
-       45,   45,   45,   45,   45,   45, 1452,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-       45,   45,   45,   45,   45,   45,   45,   45, 1452,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1452,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1452, 1452,
-       45,   45,   45,   45, 1452, 1452,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1452,   45,   45,   45,
+      327,   45,   45,   45, 1492,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45, 1452,   45,   45,   45,   45,
-       45,   45, 1452,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1452,   45,   45,   45,   45,   45,   45, 1452,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1452, 1452,   45,   45,   45, 1452,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1452,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1452,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1452,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1452,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1452,
-       45, 1452, 1452,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1452, 1452,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1452, 1452,   45, 1452,   45, 1452,   45,   45,   45,
-       45,   45,   45,   45,   45, 1452,   45,   45,   45, 1452,
-       45,   45,   45,   45, 1452, 1452,   45, 1452,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,  175, 1492,
+     1492, 1492, 1492,   45,   45,   45,   45,   45, 1492,   45,
+       45,   45,   45, 1492,   45, 1492,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1492,   45,   45,
+     1492,   45,  432,   45,   45, 1492,   45,   45,   45,   45,
+       45,   45, 1492,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1492,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1452,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1452,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1492,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1452,   45,   45,   45,   45,   45,
-
-     1452, 1452,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-     1452, 1452,   45, 1452, 1452,   45, 1452,   45,   45,   45,
-       45,   45, 1452, 1452,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1452,   45, 1452, 1452,   45,
-     1452,   45,   45,   45,   45, 1452,   45,   45,   45,   45,
-       45,   45, 1452, 1452,   45,   45, 1452,   45,   45,   45,
-       45,   45, 1452,   45,   45,   45,   45, 1452,   45, 1452,
-       45,   45,   45,   45,   45,   45,   45,   45, 1452,   45,
-
-       45, 1452,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1452,   45, 1452,   45,   45,   45, 1452, 1452,   45,   45,
-     1452, 1452,   45,   45, 1452,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1452,   45,   45, 1452, 1452,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1452,   45,   45,
-     1452,   45,   45, 1452,   45,   45,   45,   45,   45, 1452,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1452,   45,   45,
-     1452,   45, 1452, 1452,   45,   45,   45,   45,   45, 1452,
-       45,   45,   45,   45,   45,   45, 1452,   45, 1452,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1452,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1452, 1452,
-       45,   45,   45,   45,   45, 1452,   45,   45,   45,   45,
-       45,   45,   45, 1452,   45,   45,   45,   45,   45,   45,
-     1452,   45,   45, 1452, 1452,   45,   45,   45,   45,   45,
-       45,   45, 1452,   45,   45, 1452,   45,   45, 1452,   45,
-       45, 1452,   45, 1452,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1452,   45, 1452, 1452,   45,   45,   45,   45,   45,
-       45, 1452, 1452, 1452,   45,   45,   45,   45, 1452,   45,
-       45, 1452,   45,   45,   45,   45,   45, 1452,   45,   45,
-     1452,    0, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452
+       47, 1492, 1492, 1492,  111, 1492,  110,  107,  175, 1492,
+     1492,  108,  107,  125,  125,  103,  125,  107,   64,  108,
+     1492,   64,  125,  108,  103,  125,  112,  103, 1492, 1492,
+      110, 1492,  116, 1492,  114,  108,  547, 1492, 1492,  104,
+      104,  125,  173,  173,  173,  104,  107,  173,  108,  156,
+      173, 1492,  108,  173,  112,  125,  154,  156,  147,  173,
+      156, 1492,  123,  153,  142,  123,  127,  127,  125,  124,
+      128,  173,  156,  143,  156,  173,  156, 1492, 1492,  133,
+
+      150,  137,  153,  137,  173,  173,  173,  141,  148,  147,
+      156,  173,  156,  154,  173,  148, 1492,  152,  156,  152,
+      156,  162,  163,  173,  173,  173,  173,  173,  173,  173,
+     1492,  173,  170,  173,  173,  170,  172,  173, 1492, 1492,
+      173,  173,  173,  173,  173,  174,  282, 1492,  196,  200,
+      193,  200,  224,  227,  200,  209, 1492,  248,  200,  209,
+      204,  212,  233,  276,  248,  224,  220,  224,  248,  227,
+      222,  223,  232,  227,  248,  224,  259, 1492,  224,  232,
+      233,  224,  226,  282,  230,  232,  282,  230,  230,  241,
+      348,  236,  259,  259,  249,  264,  263,  259, 1492,  259,
+
+      285,  316,  266,  248,  344,  318, 1492,  317,  257,  258,
+      258,  256,  282,  285,  282,  260,  285,  264,  268,  331,
+      331,  331,  285,  318,  316,  268,  268,  334,  282,  283,
+      283,  308, 1492,  344,  275,  283,  277,  279,   77,  289,
+      318,  289,  285,  344,  352, 1492,  343,  286,  308,  356,
+      638,  321,  308,  308, 1492,  350,  308, 1492,  331,  352,
+      309,  355,  344,  356,  352,  346,  344,  324,  344,  350,
+      352,  331,  343,  335, 1492,  356,  341,  355,  329,  357,
+      343,  352,  355,  355,  352,  342,  357,  355,  345, 1492,
+     1492,  416,  355,  350,  386, 1492, 1492,  374,  350,  350,
+
+      351,  374,  360,  354,  354,  386,  482,  357,  357,  387,
+      397,  373,  362,  456,  579,  416,  397,  416,  367,  579,
+      369,  392,  374,  382,  456,  374,  403,  638,  381,  382,
+      387, 1492,  382,  447,  397,  393,  472,  397,  420,  397,
+      460,  414,  414,  449,  420, 1492,  463,  447,  431, 1492,
+     1492,  415, 1492,  456,  399,  420,  447,  407,  463,  404,
+      428,  414, 1492,  408,  421,  428,  456,  428,  447,  463,
+      423,  423,  506, 1492,  449,  449,  431,  464,  431,  431,
+     1492,  449,  506,  509,  454,  463,  460,  439,  506,  493,
+      493,  472,  454,  451,  493,  456,  476,  553,  454,  460,
+
+      463,  456,  469, 1492,  579,  638,  481,  461,  471,  484,
+      479,  579,  493,  469,  469,  477,  553,  485,  477, 1492,
+      481,  493,  579,  638,  484,  585,  481,  483,  481,  485,
+      493,  585,  579,  491,  506,  507,  518,  494,  518,  518,
+      520,  508,  499,  500,  518,  521,  511, 1492,  505,  508,
+      585,  520,  505,  508,  585,  585,  638,  585,  638,  638,
+      638,  514,  518,  518,  518,  624, 1492,  520,  638,  638,
+      585,  591,  591,  579,  542,  600,  547,  585,  547,  638,
+      545,  624,  600,  545,  600,  567,  547,  579,  638,  560,
+     1492,  560,  577,  569,  624,  579,  624,  638,  624,  575,
+
+     1492, 1492,  576,  575, 1492,  576,  587,  638,  570,  578,
+      624,  590,  638,  578,  589, 1492,  583,  638,  581,  638,
+      638,  591, 1492,  624, 1492, 1492,  638,  593,  589,  596,
+     1492,  638,  593,  594,  618,  618,  596,  624,  597,  609,
+      624,  638,  638,  622,  622,  622,  610, 1492, 1492,  623,
+     1492,  634,  616, 1492,  622,  616,  614,  638,  624,  625,
+      623,  637, 1492,  638, 1492,  638,  638,  635,  637,  638,
+      626,  638, 1492,  633,  638,  638,  638,  638,  638,  636,
+      636,  638,  638,  701, 1492,  646, 1492,  646,  970,  706,
+      646,  656,  664,  656,  701,  684,  673,  706,  683,  706,
+
+      701,  666,  660,  837,  701,  663,  677, 1492,  683,  667,
+      706,  677,  676, 1492,  670,  837,  676,  702,  676,  680,
+      701,  695,  681,  682,  706,  693,  693,  745,  693,  693,
+     1492,  807,  701,  701,  693, 1492,  710, 1492,  730,  710,
+      709,  696,  696,  752,  710,  700,  732,  709, 1492,  730,
+      706,  730,  725,  732,  732, 1492, 1492,  745,  752, 1492,
+     1492,  735, 1492,  732,  747,  725,  747,  745,  718,  745,
+      723,  745, 1492,  735,  732,  735, 1492,  743,  732,  730,
+     1492,  745,  732,  738,  745,  735,  837,  735,  738,  759,
+      748,  750,  795, 1492, 1492,  748, 1492, 1492,  748,  748,
+
+      813,  759, 1492,  752,  765,  774,  795,  763,  837,  759,
+      780, 1492, 1492,  764,  780,  766,  780,  798, 1492, 1492,
+      768,  970,  768, 1492,  770,  778,  768,  778,  780,  786,
+      786,  786,  780, 1492,  795,  813, 1492,  780,  786, 1492,
+     1013,  804,  864,  813,  785,  798,  789,  812,  804,  837,
+      812,  812,  794,  815,  808,  829,  812,  810,  808,  864,
+      837,  989,  836,  836,  836,  809,  836,  864, 1492,  849,
+     1492,  813,  827, 1492,  849,  827, 1492, 1492, 1492,  819,
+      835,  823,  858, 1492,  827,  825,  836, 1013,  827,  839,
+      829,  829,  860, 1492,  835,  841, 1492, 1492,  849,  861,
+
+      858,  864, 1492,  860,  847,  844,  841,  844,  865,  843,
+      845,  860,  873,  861,  860,  905, 1492,  860, 1492,  905,
+      860,  888,  862,  869, 1492,  871,  865,  903, 1492,  870,
+      867,  890, 1492,  887,  898,  885,  903,  887,  903, 1492,
+     1066,  890, 1013,  887,  887,  896,  882, 1492,  908,  903,
+     1492,  886, 1492,  885, 1492,  886,  908,  893,  894,  900,
+     1492,  900,  908,  903,  905,  903,  936, 1492,  899, 1492,
+      902,  899,  903,  913,  905,  913,  905,  926, 1492,  935,
+      914,  924,  914,  998,  935,  923,  944,  926, 1492,  921,
+     1492,  918,  936,  944,  930, 1492,  949,  927,  934,  927,
+
+      936, 1012, 1492,  929, 1492,  930,  941,  941,  941,  935,
+      937, 1492,  937,  951, 1492, 1003,  939,  946,  940,  972,
+     1007,  950, 1492,  972,  950,  998,  952, 1492, 1492, 1003,
+      962, 1492,  998, 1492,  952,  981,  962,  972,  986, 1003,
+      974,  975,  974,  972,  972,  975,  976,  966,  989,  982,
+      975,  977,  975,  977,  977, 1022, 1052,  998,  978, 1104,
+      998, 1492,  987, 1492, 1492,  987,  987, 1335,  995,  995,
+     1003, 1492, 1492, 1492,  987, 1003,  990, 1000, 1492, 1060,
+      994, 1492, 1003, 1022,  997, 1000, 1047, 1492, 1009, 1000,
+     1492,    0
     } ;
 
-static const flex_int16_t yy_nxt[1890] =
+static const flex_int16_t yy_nxt[2467] =
     {   0,
-     1452,   13,   14,   13, 1452,   15,   16, 1452,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   85,  363,
-       37,   14,   37,   86,   25,   26,   38, 1452, 1452,   27,
-       37,   14,   37,   42,   28,   42,   38,   91,   92,   29,
-      115,   30,   13,   14,   13,   90,   91,   25,   31,   92,
-       13,   14,   13,   13,   14,   13,   32,   40,  824,   13,
-       14,   13,   33,   40,  115,   91,   92,  364,   90,   34,
-       35,   13,   14,   13,   94,   15,   16,   95,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  108,   39,   90,   25,   26,   13,   14,   13,   27,
-
-       39,   84,   84,   84,   28,   42,   41,   42,   42,   29,
-       42,   30,   82,  107,   41,  111,   93,   25,   31,  108,
-      130,  138,   88,  825,   88,  826,   32,   89,   89,   89,
-      131,  139,   33,  140,  379,   82,  107,  380,  111,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   48,   49,   50,   51,   45,   52,   53,
-       54,   45,   45,   45,   45,   55,   56,   45,   57,   45,
-       45,   58,   45,   45,   59,   45,   60,   61,   62,   63,
-       64,   65,   66,   52,   67,   68,   69,   70,   71,   72,
-
-       73,   74,   75,   76,   77,   78,   57,   45,   45,   45,
-       45,   45,   80,  103,   81,   81,   81,   80,  109,   83,
-       83,   83,  101,  114,   80,   82,   83,   83,   83,  121,
-       82,  133,  122,  112,  123,  306,  124,   82,  134,  103,
-      394,  103,  101,  113,  135,  827,  114,  110,   82,  136,
-      163,  107,  137,   82,  164,  179,  112,  102,  146,  244,
-       82,   45,  147,   45,   45,   45,   45,  119,   45,   45,
-       45,  113,  117,  120,  107,   45,   45,  102,   45,   45,
-      245,  179,  148,  828,   45,  132,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   89,   89,
-       89,   45,  125,  431,  111,   45,  126,  432,  181,  127,
-      128,  142,  143,   45,  180,  144,  152,   45,  181,   45,
-      118,  145,  129,  149,  153,  150,  154,  151,  112,  114,
-      157,  155,  156,  158,  159,  165,  181,  424,  113,  166,
-      180,  193,  167,  224,  160,  179,  184,  161,  829,  168,
-      169,  171,  114,  172,  425,  170,  225,  173,   84,   84,
-       84,   80,  175,   81,   81,   81,  113,  176,  193,   82,
-       88,  182,   88,  174,   82,   89,   89,   89,   80,  180,
-       83,   83,   83,   84,   84,   84,   89,   89,   89,  100,
-
-      188,   82,   82,  192,   82,  197,  100,   82,  194,  198,
-      209,  199,  201,  200,  405,  183,  215,  216,  197,  210,
-      211,  235,  256,  257,   82,  226,  217,   82,  188,  192,
-      221,  830,  222,  197,  100,  201,  198,  195,  100,  199,
-      200,  227,  100,  405,  188,  230,  250,  831,  231,  223,
-      100,  266,  232,  198,  100,  290,  100,  187,  204,  204,
-      204,  205,  832,  236,  292,  204,  204,  204,  204,  204,
-      204,  260,  206,  276,  261,  262,  302,  277,  291,  290,
-      283,  278,  291,  290,  267,  268,  269,  292,  204,  204,
-      204,  204,  204,  204,  292,  270,  298,  271,  301,  272,
-
-      273,  305,  274,  302,  291,  307,  309,  293,  294,  298,
-      461,  462,  413,  317,  305,  401,  401,  295,  405,  298,
-      352,  318,  407,  408,  305,  410,  301,  319,  307,  413,
-      833,  409,  312,  309,  310,  310,  310,  359,  401,  402,
-      413,  310,  310,  310,  310,  310,  310,  417,  410,  468,
-      484,  519,  492,  519,  485,  480,  493,  470,  497,  469,
-      508,  834,  498,  509,  310,  310,  310,  310,  310,  310,
-      527,  353,  528,  446,  354,  416,  416,  416,  447,  519,
-      678,  529,  416,  416,  416,  416,  416,  416,  514,  541,
-      551,  601,  626,  515,  627,  552,  602,  527,  622,  528,
-
-      662,  663,  542,  628,  710,  416,  416,  416,  416,  416,
-      416,  481,  721,  687,  711,  720,  835,  679,  688,  626,
-      725,  726,  627,  763,  448,  815,  764,  797,  836,  449,
-       45,   45,   45,  837,  798,  721,  838,   45,   45,   45,
-       45,   45,   45,  720,  804,  799,  839,  840,  843,  841,
-      805,  844,  800,  815,  842,  689,  801,  845,  846,  847,
-       45,   45,   45,   45,   45,   45,  848,  849,  850,  851,
-      852,  853,  854,  855,  856,  857,  858,  859,  861,  862,
-      863,  860,  864,  865,  866,  867,  868,  869,  870,  871,
-      872,  873,  874,  875,  876,  877,  878,  879,  880,  881,
-
-      882,  883,  884,  885,  886,  887,  888,  890,  891,  892,
-      893,  894,  895,  896,  897,  898,  899,  900,  889,  901,
-      902,  903,  904,  905,  906,  907,  908,  909,  910,  911,
-      912,  913,  914,  915,  916,  917,  918,  919,  920,  921,
-      922,  923,  924,  925,  903,  926,  927,  902,  928,  929,
-      930,  931,  932,  935,  936,  937,  938,  933,  939,  940,
-      941,  942,  943,  944,  945,  946,  947,  948,  949,  950,
-      952,  953,  954,  955,  956,  957,  958,  959,  960,  961,
-      951,  962,  963,  964,  965,  966,  967,  968,  969,  970,
-      971,  972,  973,  974,  975,  976,  977,  978,  979,  980,
+       11, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492,   33,   34,   35,   34,   33,   13,   12,   33,   23,
+       20,   22,   25,   14,   24,   24,   24,   21,   15,   33,
+       33,   33,   33,   33,   33,   26,   31,   33,   33,   33,
+
+       32,   33,   33,   33,   33,   30,   33,   33,   33,   33,
+       16,   33,   17,   33,   33,   33,   33,   33,   26,   28,
+       33,   33,   33,   33,   33,   33,   29,   33,   33,   33,
+       33,   33,   27,   33,   33,   33,   33,   33,   33,   18,
+       19,   36,   37,   35,   37,   36,   36,   36,   38,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   33,   33,   40,   33,   33,   33,   33,   33,   33,
+       33,   33,   33,   33,   41, 1492,   80,   78,   88,   91,
+       33,   33,   79,   92,   88,   33,   84,   84,   84, 1492,
+       33,   85,   85,   85,   86,   33,   86,   33,   91,   87,
+       87,   87,   90,   33,   33,   89,   33,   39,   92,   33,
+       93,   33,   94,   95,   94,   96,   97,   33,   99,  110,
+      111,  112,  132,  141,   33,   33,   42,   42,  157,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   77,   77,   77,   45,
+       45,   76,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   46,   45,   47,   48,
+       49,   50,   45,   51,   52,   53,   45,   45,   45,   45,
+       54,   55,   45,   56,   45,   45,   75,   45,   45,   57,
+       45,   43,   58,   59,   60,   61,   62,   63,   64,   65,
+
+       66,   67,   68,   44,   69,   70,   71,   72,   73,   74,
+       56,   45,   45,   45,   45,   45,   82,  109,   81,   81,
+       81,  106,  113,   45,  107,  108,   45,  171,   45,   83,
+       45,   45,  170,  122,  105,  134,   45,  104,   45,  123,
+      124,  133,  109,  172, 1492,  113, 1492,   98,   98,  182,
+       98,   98,   83,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+
+       98,   98,   98,   98,   98,   98,   98,   98,   98,   98,
+       98,   98,   98,   98,   98,   98,   98,   45,  117,   45,
+       45,   45,   45,  130,   45,   45,   45,  184,  138,  186,
+      187,   45,   45,  131,   45,  114,  115,  139,  188,  140,
+       45,  117,   45,   45,   45,   45,   45,   45,   45,   45,
+      102,   45,   45,  101,   45,  103,   45,  100,   45,   45,
+       45,   45,  114,  118,  116,  120,  121,  159,  125,  135,
+      181,  158,  126,  119,  136,  127,  128,  137,  146,  184,
+      142,  143,  147,  185,  144,  189,  118,  129,  120,  145,
+      121,  151,  166,  150,  167,  149,  153,  181,  168,  193,
+
+      119,  148,  161,  154,  183,  152,  160,  194,  185,  162,
+      155,  156,  195,  169,  196,  163,  164,  197,  198,  199,
+      200,  165,  176,  176,  176,  176,  176,  173,  176,  176,
+      176,  176,  176,  176,  174,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  174,  176,  176,  176,  174,  176,  176,  176,
+      174,  176,  176,  176,  176,  176,  176,  174,  176,  176,
+      176,  174,  176,  174,  175,  176,  176,  176,  176,  176,
+      176,  176,  177,  177,  177,  177,  177,  179,  177,  177,
+
+      177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+      177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+      177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+      177,  177,  178,  177,  177,  177,  177,  177,  177,  177,
+      177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+      177,  177,  177,  177,  177,  177,  177,  177,  177,  177,
+      177,  177,  180,  180,  201,  180,  180,  180,  180,  180,
+      180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+      180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+      180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+
+      180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+      180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+      180,  180,  180,  180,  180,  180,  180,  180,  180,  180,
+      180,  180,  191,  202,  203,  204,  205,  206,  207,  208,
+      192,  190,  210,  211,  213,  212,  214,  217,  215,  219,
+      220,  221,  216,  222,  223,  225,  226,  227,  218,  235,
+      236,  203,  224,  207,  228,  208,  229,  231,  234,  240,
+      213,  209,  212,  214,  215,  216,  241,  239,  243,  232,
+      237,  244,  230,  233,  238,  245,  246,  247,  248,  249,
+      250,  251,  253,  254,  255,  256,  257,  258,  259,  260,
+
+      261,  262,  263,  266,  274,  277,  264,  279,  275,  276,
+      280,  252,  281,  278,  282,  283,  284,  285,  286,  287,
+      242,  288,  289,  290,  297,  298,  299,  301,  302,  303,
+      304,  308,  305,  309,  310,  311,  267,  268,  265,  306,
+      312,  313,  314,  315,  316,  307,  269,  297,  270,  317,
+      271,  272,  301,  273,  292,  292,  292,  292,  292,  292,
+      292,  292,  292,  292,  292,  292,  292,  291,  291,  291,
+      292,  292,  292,  292,  291,  291,  291,  291,  291,  291,
+      292,  292,  292,  292,  292,  292,  292,  292,  292,  292,
+      292,  292,  292,  292,  292,  292,  292,  291,  291,  291,
+
+      291,  291,  291,  292,  292,  292,  292,  292,  292,  292,
+      292,  292,  292,  292,  292,  292,  292,  292,  292,  292,
+      292,  292,  292,  292,  293,  293,  294,  293,  293,  293,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      293,  293,  293,  293,  293,  293,  293,  293,  293,  293,
+      293,  295,  299,  318,  319,  320,  321,  322,  295,  324,
+
+      323,  325,  326,  328,  330,  327,  329,  331,  332,  333,
+      334,  335,  336,  337,  338,  339,  340,  341,  320,  300,
+      342,  343,  344,  345,  346,  324,  295,  323,  327,  329,
+      295,  347,  348,  331,  295,  349,  350,  351,  352,  353,
+      354,  295,  355,  356,  357,  295,  358,  295,  296,  359,
+      360,  361,  362,  363,  364,  365,  366,  369,  370,  371,
+      372,  373,  374,  375,  376,  377,  379,  380,  381,  382,
+      384,  385,  383,  386,  387,  388,  389,  390,  391,  392,
+      393,  394,  395,  396,  397,  398,  399,  400,  401,  402,
+      403,  404,  405,  406,  407,  408,  411,  412,  413,  414,
+
+      415,  416,  417,  419,  420,  421,  367,  423,  424,  368,
+      426,  422,  378,  409,  409,  409,  427,  428,  418,  411,
+      409,  409,  409,  409,  409,  409,  410,  410,  410,  429,
+      430,  431,  433,  410,  410,  410,  410,  410,  410,  432,
+      434,  435,  437,  409,  409,  409,  409,  409,  409,  436,
+      438,  439,  440,  441,  442,  443,  410,  410,  410,  410,
+      410,  410,  444,  425,  445,  437,  446,  432,  447,  448,
+      449,  450,  452,  453,  454,  451,  455,  456,  457,  440,
+      458,  459,  460,  461,  462,  463,  467,  468,  469,  470,
+      471,  464,  472,  473,  474,  475,  476,  477,  478,  479,
+
+      480,  481,  482,  483,  484,  485,  486,  488,  489,  490,
+      491,  492,  493,  494,  496,  497,  487,  498,  499,  501,
+      502,  503,  500,  504,  495,  505,  506,  507,  509,  510,
+      511,  508,  512,  513,  514,  515,  465,  516,  517,  518,
+      519,  466,  520,  522,  523,  521,  524,  526,  527,  528,
+      531,  532,  525,  529,  529,  529,  533,  534,  535,  536,
+      529,  529,  529,  529,  529,  529,  530,  530,  530,  537,
+      538,  539,  540,  530,  530,  530,  530,  530,  530,  541,
+      542,  543,  544,  529,  529,  529,  529,  529,  529,  545,
+      546,  547,  548,  549,  550,  551,  530,  530,  530,  530,
+
+      530,  530,  552,  553,  554,  555,  557,  556,  558,  559,
+      560,  561,  562,  563,  565,  566,  567,  568,  547,  569,
+      570,  571,  572,  574,  575,  564,  576,  573,  577,  578,
+      579,  555,  580,  556,  581,  582,  583,  584,  585,  586,
+      587,  588,  589,  590,  591,  592,  593,  594,  595,  596,
+      597,  598,  599,  600,  601,  602,  603,  604,  605,  606,
+      607,  608,  609,  610,  611,  612,  613,  614,  615,  617,
+      618,  619,  620,  621,  616,  622,  623,  624,  625,  626,
+      627,  628,  629,  630,  631,  632,  633,  634,  635,  636,
+      637,  638,  638,  638,  640,  641,  642,  643,  638,  638,
+
+      638,  638,  638,  638,  639,  639,  639,  644,  645,  646,
+      647,  639,  639,  639,  639,  639,  639,  651,  652,  653,
+      654,  638,  638,  638,  638,  638,  638,  648,  655,  656,
+      657,  658,  649,  659,  639,  639,  639,  639,  639,  639,
+      660,  661,  663,  662,  664,  665,  666,  667,  668,  669,
+      670,  671,  672,  673,  674,  675,  676,  677,  678,  679,
+      680,  681,  682,  683,  684,  685,  686,  661,  687,  650,
+      662,  688,  689,  691,  690,  692,  693,  694,  695,  696,
+      697,  698,  699,  700,  701,  702,  703,  704,  705,  707,
+      708,  709,  710,  711,  712,  713,  714,  715,  716,  717,
+
+      718,  719,  720,  721,  722,  723,  724,  725,  726,  727,
+      728,  729,  730,  731,  733,  734,  735,  736,  737,  738,
+      739,  739,  739,  740,  732,  743,  706,  739,  739,  739,
+      739,  739,  739,  741,  742,  744,  745,  746,  747,  748,
+      749,  750,  751,  752,  753,  754,  755,  756,  757,  758,
+      739,  739,  739,  739,  739,  739,  759,  760,  761,  762,
+      763,  764,  765,  766,  767,  768,  769,  770,  771,  772,
+      773,  774,  775,  776,  777,  778,  779,  780,  781,  782,
+      760,  783,  784,  759,  785,  786,  787,  788,  789,  790,
+      791,  792,  793,  794,  796,  797,  795,  798,  799,  800,
+
+      801,  802,  803,  804,  805,  806,  807,  808,  809,  810,
+      811,  812,  813,  814,  815,  816,  817,  818,  819,  820,
+      821,  822,  825,  827,  828,  829,  830,  823,  826,  832,
+      833,  824,  831,  834,  835,  836,  837,  838,  839,  840,
+      841,  842,  843,  844,  845,  846,  847,  848,  849,  850,
+      851,  852,  853,  854,  855,  856,  857,  858,  859,  860,
+      861,  862,  863,  864,  865,  866,  867,  868,  869,  870,
+      871,  872,  874,  875,  876,  877,  878,  873,  879,  880,
+      881,  855,  882,  883,  884,  885,  886,  887,  888,  889,
+      890,  891,  893,  894,  895,  892,  896,  897,  898,  899,
+
+      900,  901,  902,  903,  904,  905,  906,  907,  908,  909,
+      910,  911,  912,  913,  914,  916,  917,  918,  919,  920,
+      921,  922,  923,  924,  925,  915,  926,  927,  928,  929,
+      930,  931,  932,  933,  934,  935,  936,  937,  938,  939,
+      940,  941,  942,  943,  944,  945,  946,  947,  948,  949,
+      950,  951,  952,  953,  954,  955,  956,  957,  958,  959,
+      960,  961,  962,  963,  964,  967,  943,  968,  942,  969,
+      966,  970,  971,  972,  973,  974,  975,  976,  977,  978,
+      979,  980,  981,  982,  983,  984,  986,  987,  988,  989,
+      990,  991,  992,  993,  994,  985,  995,  996,  997,  998,
+
+      999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008,
+     1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
+      965, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027,
+     1028, 1030, 1029, 1031, 1032, 1033, 1034, 1035, 1036, 1037,
+     1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
+     1048, 1049, 1052, 1054, 1051, 1055, 1056, 1028, 1029, 1050,
+     1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066,
+     1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076,
+     1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086,
+     1087, 1088, 1089, 1090, 1091, 1053, 1092, 1093, 1094, 1095,
 
-      981,  982,  983,  984,  985,  987,  986,  988,  934,  989,
-      990,  991,  992,  993,  994,  995,  996,  997,  998,  999,
-     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
-     1010, 1011,  985,  986, 1012, 1013, 1014, 1015, 1017, 1019,
-     1020, 1021, 1016, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
-     1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
-     1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
-     1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058,
-     1018, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
-     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
-
-     1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085, 1086, 1064,
-     1087, 1088, 1089, 1090, 1091, 1065, 1092, 1093, 1094, 1095,
      1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
      1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115,
-     1116, 1117, 1118, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
-     1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134, 1136, 1137,
-     1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147,
-     1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157,
-     1158, 1159, 1160, 1132, 1161, 1162, 1163, 1165, 1166, 1167,
-     1168, 1169, 1170, 1119, 1164, 1171, 1172, 1173, 1174, 1135,
-
-     1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
-     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
-     1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
-     1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1191,
-     1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
-     1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
-     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253,
-     1254, 1255, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1236,
-     1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273,
-
-     1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283,
-     1284, 1286, 1287, 1288, 1289, 1285, 1290, 1291, 1292, 1293,
-     1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303,
-     1304, 1305, 1306, 1279, 1307, 1308, 1309, 1256, 1310, 1311,
-     1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321,
-     1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
+     1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125,
+     1126, 1127, 1128, 1106, 1129, 1130, 1131, 1132, 1107, 1133,
+     1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
+     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
+     1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
+     1165, 1166, 1167, 1168, 1169, 1170, 1171, 1173, 1174, 1175,
+     1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184, 1185,
+     1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1195,
+
+     1196, 1197, 1198, 1199, 1200, 1202, 1203, 1176, 1204, 1154,
+     1205, 1206, 1201, 1207, 1208, 1209, 1210, 1211, 1212, 1172,
+     1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222,
+     1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232,
+     1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242,
+     1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+     1253, 1254, 1255, 1256, 1257, 1235, 1258, 1259, 1260, 1261,
+     1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
+     1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281,
+     1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
+
+     1292, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302,
+     1303, 1304, 1305, 1306, 1307, 1281, 1308, 1309, 1310, 1311,
+     1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1322,
+     1321, 1323, 1325, 1326, 1327, 1328, 1329, 1324, 1330, 1331,
      1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341,
-     1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351,
-     1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361,
-     1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
-
-     1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381,
-     1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
-     1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
-     1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
-     1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
-     1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431,
-     1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441,
-     1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451,
-       12,   12,   12,   12,   12,   36,   36,   36,   36,   36,
-       79,  297,   79,   79,   79,   98,  404,   98,  518,   98,
-
-      100,  100,  100,  100,  100,  116,  116,  116,  116,  116,
-      178,  100,  178,  178,  178,  202,  202,  202,  823,  822,
-      821,  820,  819,  818,  817,  816,  814,  813,  812,  811,
-      810,  809,  808,  807,  806,  803,  802,  796,  795,  794,
-      793,  792,  791,  790,  789,  788,  787,  786,  785,  784,
-      783,  782,  781,  780,  779,  778,  777,  776,  775,  774,
-      773,  772,  771,  770,  769,  768,  767,  766,  765,  762,
-      761,  760,  759,  758,  757,  756,  755,  754,  753,  752,
-      751,  750,  749,  748,  747,  746,  745,  744,  743,  742,
-      741,  740,  739,  738,  737,  736,  735,  734,  733,  732,
-
-      731,  730,  729,  728,  727,  724,  723,  722,  719,  718,
-      717,  716,  715,  714,  713,  712,  709,  708,  707,  706,
-      705,  704,  703,  702,  701,  700,  699,  698,  697,  696,
-      695,  694,  693,  692,  691,  690,  686,  685,  684,  683,
-      682,  681,  680,  677,  676,  675,  674,  673,  672,  671,
-      670,  669,  668,  667,  666,  665,  664,  661,  660,  659,
-      658,  657,  656,  655,  654,  653,  652,  651,  650,  649,
-      648,  647,  646,  645,  644,  643,  642,  641,  640,  639,
-      638,  637,  636,  635,  634,  633,  632,  631,  630,  629,
-      625,  624,  623,  622,  621,  620,  619,  618,  617,  616,
-
-      615,  614,  613,  612,  611,  610,  609,  608,  607,  606,
-      605,  604,  603,  600,  599,  598,  597,  596,  595,  594,
-      593,  592,  591,  590,  589,  588,  587,  586,  585,  584,
-      583,  582,  581,  580,  579,  578,  577,  576,  575,  574,
-      573,  572,  571,  570,  569,  568,  567,  566,  565,  564,
-      563,  562,  561,  560,  559,  558,  557,  556,  555,  554,
-      553,  550,  549,  548,  547,  546,  545,  544,  543,  540,
-      539,  538,  537,  536,  535,  534,  533,  532,  531,  530,
-      526,  525,  524,  523,  522,  521,  520,  517,  516,  513,
-      512,  511,  510,  507,  506,  505,  504,  503,  502,  501,
-
-      500,  499,  496,  495,  494,  491,  490,  489,  488,  487,
-      486,  483,  482,  479,  478,  477,  476,  475,  474,  473,
-      472,  471,  467,  466,  465,  464,  463,  460,  459,  458,
-      457,  456,  455,  454,  453,  452,  451,  450,  445,  444,
-      443,  442,  441,  440,  439,  438,  437,  436,  435,  434,
-      433,  430,  429,  428,  427,  426,  423,  422,  421,  420,
-      419,  418,  415,  414,  412,  411,  406,  403,  400,  399,
-      398,  397,  396,  395,  393,  392,  391,  390,  389,  388,
-      387,  386,  385,  384,  383,  382,  381,  378,  377,  376,
-      375,  374,  373,  372,  371,  370,  369,  368,  367,  366,
-
-      365,  362,  361,  360,  358,  357,  356,  355,  351,  350,
-      349,  348,  347,  346,  345,  344,  343,  342,  341,  340,
-      339,  338,  337,  336,  335,  334,  333,  332,  331,  330,
-      329,  328,  327,  326,  325,  324,  323,  322,  321,  320,
-      316,  315,  314,  313,  311,  203,  308,  306,  304,  303,
-      300,  299,  296,  289,  288,  287,  286,  285,  284,  282,
-      281,  280,  279,  275,  265,  264,  263,  259,  258,  255,
-      254,  253,  252,  251,  249,  248,  247,  246,  243,  242,
-      241,  240,  239,  238,  237,  234,  233,  229,  228,  220,
-      219,  218,  214,  213,  212,  208,  207,  203,  196,  191,
-
-      190,  189,  186,  185,  177,  162,  141,  106,  105,  104,
-       43,   99,   97,   96,   87,   43, 1452,   11, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452
+     1342, 1343, 1344, 1345, 1346, 1347, 1293, 1321, 1348, 1349,
+     1350, 1351, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+     1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369,
+     1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379,
+     1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389,
+
+     1390, 1391, 1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399,
+     1400, 1401, 1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409,
+     1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+     1420, 1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429,
+     1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+     1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449,
+     1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459,
+     1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468, 1469,
+     1470, 1471, 1472, 1473, 1474, 1475, 1476, 1477, 1478, 1479,
+     1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489,
+
+     1490, 1491,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[1890] =
+static const flex_int16_t yy_chk[2467] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  254,
-        3,    3,    3,   21,    1,    1,    3,    0,    0,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  731,    8,
-        8,    8,    1,    8,   57,   27,   28,  254,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-       62,   66,   25,  732,   25,  733,    2,   25,   25,   25,
-       62,   66,    2,   66,  269,   20,   51,  269,   54,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
-       15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   47,   17,   17,   17,   19,   53,   19,
-       19,   19,   44,   56,   22,   17,   22,   22,   22,   60,
-       19,   64,   60,   55,   60,  283,   60,   22,   64,   47,
-      283,   59,  100,   55,   65,  734,   56,   53,   17,   65,
-       74,   63,   65,   19,   74,   90,   55,   44,   69,  146,
-       22,   45,   69,   45,   45,   45,   45,   59,   45,   45,
-       45,   55,   58,   59,   63,   45,   45,  100,   45,   58,
-      146,   90,   69,  735,   45,   63,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+     1492,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
 
-       45,   45,   45,   45,   45,   45,   45,   58,   88,   88,
-       88,   58,   61,  326,   70,   58,   61,  326,   92,   61,
-       61,   68,   68,   58,   91,   68,   71,   58,   95,   58,
-       58,   68,   61,   70,   71,   70,   71,   70,   76,   77,
-       72,   71,   71,   72,   72,   75,   92,  319,   76,   75,
-       91,  108,   75,  131,   72,   93,   95,   72,  736,   75,
-       75,   76,   77,   76,  319,   75,  131,   76,   80,   80,
-       80,   81,   77,   81,   81,   81,   76,   77,  108,   80,
-       82,   93,   82,   76,   81,   82,   82,   82,   83,   94,
-       83,   83,   83,   84,   84,   84,   89,   89,   89,  102,
-
-      103,   83,   80,  107,   84,  111,  102,   81,  109,  112,
-      122,  113,  115,  114,  298,   94,  126,  126,  151,  122,
-      122,  138,  157,  157,   83,  132,  126,   84,  103,  107,
-      130,  737,  130,  111,  102,  115,  112,  109,  102,  113,
-      114,  132,  102,  298,  119,  135,  151,  738,  135,  130,
-      102,  164,  135,  171,  102,  179,  102,  102,  118,  118,
-      118,  119,  739,  138,  181,  118,  118,  118,  118,  118,
-      118,  160,  119,  166,  160,  160,  193,  166,  180,  182,
-      171,  166,  183,  179,  164,  164,  164,  181,  118,  118,
-      118,  118,  118,  118,  184,  164,  188,  164,  192,  164,
-
-      164,  197,  164,  193,  180,  199,  201,  182,  183,  206,
-      352,  352,  305,  211,  250,  290,  293,  184,  312,  188,
-      245,  211,  300,  300,  197,  301,  192,  211,  199,  359,
-      740,  300,  206,  201,  204,  204,  204,  250,  290,  293,
-      305,  204,  204,  204,  204,  204,  204,  312,  301,  358,
-      373,  405,  380,  417,  373,  370,  380,  359,  384,  358,
-      394,  741,  384,  394,  204,  204,  204,  204,  204,  204,
-      415,  245,  415,  340,  245,  310,  310,  310,  340,  405,
-      583,  417,  310,  310,  310,  310,  310,  310,  399,  431,
-      441,  494,  527,  399,  528,  441,  494,  415,  529,  415,
-
-      566,  566,  431,  529,  615,  310,  310,  310,  310,  310,
-      310,  370,  627,  592,  615,  626,  742,  583,  592,  527,
-      631,  631,  528,  669,  340,  721,  669,  705,  744,  340,
-      416,  416,  416,  745,  705,  627,  746,  416,  416,  416,
-      416,  416,  416,  626,  709,  706,  747,  748,  750,  749,
-      709,  751,  706,  721,  749,  592,  706,  752,  753,  754,
-      416,  416,  416,  416,  416,  416,  755,  756,  757,  758,
-      761,  762,  763,  764,  767,  768,  769,  770,  771,  772,
-      773,  770,  774,  775,  776,  778,  779,  780,  781,  782,
-      783,  784,  785,  786,  787,  788,  789,  790,  791,  792,
-
-      793,  794,  795,  796,  797,  798,  799,  800,  801,  802,
-      803,  804,  805,  807,  808,  809,  810,  811,  799,  812,
-      814,  815,  816,  817,  818,  819,  820,  821,  822,  823,
-      824,  825,  826,  827,  828,  829,  831,  832,  833,  834,
-      835,  836,  837,  838,  815,  839,  840,  814,  842,  843,
-      844,  845,  846,  847,  849,  850,  851,  846,  852,  853,
-      854,  855,  856,  857,  858,  859,  860,  861,  862,  863,
-      864,  867,  868,  869,  871,  872,  873,  875,  876,  877,
-      863,  878,  879,  880,  881,  882,  883,  884,  885,  886,
-      887,  888,  889,  890,  891,  893,  894,  895,  896,  897,
-
-      898,  899,  900,  901,  902,  904,  903,  905,  846,  906,
-      907,  908,  909,  910,  911,  912,  913,  914,  916,  917,
-      918,  919,  920,  921,  922,  923,  924,  925,  926,  927,
-      928,  929,  902,  903,  930,  931,  933,  934,  935,  936,
-      937,  938,  934,  939,  940,  941,  942,  943,  944,  945,
-      946,  947,  948,  949,  950,  951,  952,  953,  954,  955,
-      956,  957,  959,  960,  961,  962,  963,  964,  965,  966,
-      967,  968,  969,  971,  974,  975,  976,  977,  978,  979,
-      935,  980,  981,  982,  983,  984,  985,  986,  987,  988,
-      989,  990,  991,  992,  993,  996,  997,  998,  999, 1000,
-
-     1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,  985,
-     1010, 1011, 1014, 1016, 1018,  986, 1019, 1020, 1021, 1022,
-     1023, 1024, 1025, 1027, 1028, 1029, 1031, 1032, 1033, 1034,
-     1037, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
-     1048, 1049, 1050, 1051, 1052, 1053, 1055, 1056, 1057, 1058,
-     1059, 1060, 1061, 1062, 1063, 1064, 1065, 1067, 1068, 1069,
-     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1079, 1080,
-     1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090,
-     1091, 1092, 1093, 1064, 1094, 1096, 1097, 1098, 1099, 1100,
-     1103, 1104, 1105, 1050, 1097, 1106, 1107, 1108, 1109, 1067,
-
-     1110, 1111, 1112, 1113, 1115, 1116, 1117, 1118, 1119, 1120,
-     1123, 1126, 1128, 1129, 1130, 1131, 1132, 1135, 1136, 1137,
-     1138, 1139, 1140, 1141, 1142, 1143, 1145, 1146, 1147, 1148,
-     1149, 1150, 1151, 1152, 1153, 1154, 1155, 1157, 1160, 1132,
-     1162, 1163, 1164, 1165, 1167, 1168, 1169, 1170, 1171, 1172,
-     1175, 1176, 1178, 1179, 1180, 1181, 1182, 1184, 1185, 1186,
-     1187, 1189, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198,
-     1200, 1201, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210,
-     1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1191,
-     1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
-
-     1229, 1230, 1232, 1234, 1235, 1236, 1239, 1240, 1243, 1244,
-     1246, 1247, 1248, 1249, 1250, 1246, 1251, 1252, 1253, 1254,
-     1256, 1257, 1260, 1261, 1262, 1263, 1265, 1266, 1267, 1268,
-     1269, 1270, 1271, 1236, 1272, 1273, 1274, 1211, 1275, 1276,
-     1277, 1279, 1280, 1282, 1283, 1285, 1286, 1287, 1288, 1289,
-     1291, 1292, 1293, 1295, 1296, 1297, 1298, 1299, 1300, 1301,
-     1302, 1303, 1304, 1305, 1306, 1307, 1309, 1310, 1312, 1315,
-     1316, 1317, 1318, 1319, 1321, 1322, 1323, 1324, 1325, 1326,
-     1328, 1330, 1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338,
-     1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1351,
-
-     1352, 1353, 1354, 1355, 1357, 1358, 1359, 1360, 1361, 1362,
-     1363, 1365, 1366, 1367, 1368, 1369, 1370, 1372, 1373, 1376,
-     1377, 1378, 1379, 1380, 1381, 1382, 1384, 1385, 1387, 1388,
-     1390, 1391, 1393, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
-     1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
-     1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
-     1423, 1426, 1427, 1428, 1429, 1430, 1431, 1435, 1436, 1437,
-     1438, 1440, 1441, 1443, 1444, 1445, 1446, 1447, 1449, 1450,
-     1453, 1453, 1453, 1453, 1453, 1454, 1454, 1454, 1454, 1454,
-     1455, 1461, 1455, 1455, 1455, 1456, 1462, 1456, 1463, 1456,
-
-     1457, 1457, 1457, 1457, 1457, 1458, 1458, 1458, 1458, 1458,
-     1459, 1464, 1459, 1459, 1459, 1460, 1460, 1460,  730,  729,
-      728,  727,  726,  725,  723,  722,  720,  718,  717,  716,
-      715,  714,  713,  712,  711,  708,  707,  704,  703,  702,
-      701,  700,  699,  698,  697,  696,  695,  694,  693,  692,
-      691,  690,  689,  688,  686,  685,  684,  683,  682,  681,
-      680,  679,  677,  676,  675,  674,  673,  672,  670,  668,
-      667,  666,  665,  664,  663,  662,  661,  660,  659,  658,
-      657,  656,  655,  654,  653,  652,  650,  649,  648,  647,
-      646,  645,  644,  643,  642,  641,  640,  639,  638,  637,
-
-      636,  635,  634,  633,  632,  630,  629,  628,  625,  624,
-      623,  620,  619,  618,  617,  616,  613,  612,  611,  610,
-      609,  608,  607,  606,  605,  604,  603,  602,  600,  599,
-      598,  597,  596,  595,  594,  593,  591,  590,  588,  587,
-      586,  585,  584,  582,  581,  580,  578,  577,  575,  574,
-      573,  572,  571,  570,  569,  568,  567,  565,  564,  563,
-      562,  561,  559,  558,  557,  556,  555,  554,  553,  552,
-      550,  549,  548,  547,  546,  545,  544,  543,  542,  541,
-      540,  539,  538,  537,  536,  535,  534,  533,  532,  531,
-      525,  523,  520,  519,  517,  516,  515,  513,  509,  508,
-
-      507,  506,  505,  504,  503,  502,  501,  500,  499,  498,
-      497,  496,  495,  493,  492,  491,  490,  489,  488,  487,
-      486,  485,  484,  483,  481,  479,  478,  477,  476,  475,
-      474,  473,  472,  471,  470,  469,  468,  466,  465,  464,
-      463,  462,  461,  460,  459,  458,  457,  456,  455,  454,
-      453,  452,  451,  450,  449,  448,  447,  445,  444,  443,
-      442,  440,  439,  438,  437,  436,  435,  433,  432,  430,
-      429,  428,  426,  425,  424,  423,  422,  421,  419,  418,
-      413,  412,  410,  409,  408,  407,  406,  403,  400,  398,
-      397,  396,  395,  393,  392,  391,  390,  389,  388,  387,
-
-      386,  385,  383,  382,  381,  379,  378,  377,  376,  375,
-      374,  372,  371,  369,  368,  367,  366,  365,  364,  363,
-      362,  361,  357,  356,  355,  354,  353,  351,  350,  349,
-      348,  347,  346,  345,  344,  343,  342,  341,  339,  338,
-      337,  336,  335,  334,  333,  332,  331,  330,  329,  328,
-      327,  325,  324,  323,  322,  321,  318,  317,  316,  315,
-      314,  313,  309,  307,  304,  302,  299,  296,  289,  288,
-      287,  286,  285,  284,  282,  281,  280,  279,  278,  277,
-      276,  275,  274,  273,  272,  271,  270,  268,  267,  266,
-      265,  264,  263,  262,  261,  260,  259,  258,  257,  256,
-
-      255,  253,  252,  251,  249,  248,  247,  246,  244,  243,
-      242,  241,  240,  239,  238,  237,  236,  234,  233,  232,
-      231,  230,  229,  228,  227,  226,  225,  224,  223,  222,
-      221,  220,  219,  218,  217,  216,  215,  214,  213,  212,
-      210,  209,  208,  207,  205,  202,  200,  198,  196,  195,
-      190,  189,  185,  177,  176,  175,  174,  173,  172,  170,
-      169,  168,  167,  165,  163,  162,  161,  159,  158,  156,
-      155,  154,  153,  152,  150,  149,  148,  147,  145,  144,
-      143,  142,  141,  140,  139,  137,  136,  134,  133,  129,
-      128,  127,  125,  124,  123,  121,  120,  116,  110,  106,
-
-      105,  104,   98,   97,   78,   73,   67,   50,   49,   48,
-       43,   41,   39,   38,   24,   14,   11, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
-     1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    5,    5,    7,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    9,   11,   15,   14,   27,   28,
+        5,    5,   14,   29,   30,    5,   23,   23,   23,   25,
+        5,   25,   25,   25,   26,    5,   26,    5,   31,   26,
+       26,   26,   28,    5,    5,   27,    9,    5,   32,    7,
+       29,    5,   34,   35,   34,   38,   39,    5,   41,   47,
+       48,   49,   60,   64,    5,    5,   12,   12,   69,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   22,   46,   22,   22,
+       22,   44,   50,   45,   44,   44,   45,   73,   45,   22,
+       45,   44,   73,   57,   44,   61,   44,   44,   44,   57,
+       57,   61,   46,   74,   86,   50,   86,   40,   40,   89,
+       40,   40,   22,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   43,   53,   43,
+       43,   43,   43,   59,   43,   43,   43,   91,   63,   93,
+       97,   43,   43,   59,   43,   51,   52,   63,   98,   63,
+       43,   53,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+       43,   43,   51,   54,   52,   55,   56,   70,   58,   62,
+       88,   70,   58,   54,   62,   58,   58,   62,   66,   90,
+       65,   65,   66,   92,   65,  100,   54,   58,   55,   65,
+       56,   67,   72,   67,   72,   67,   68,   88,   72,  102,
+
+       54,   66,   71,   68,   90,   68,   71,  103,   92,   71,
+       68,   68,  104,   72,  105,   71,   71,  105,  105,  106,
+      106,   71,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+       75,   75,   77,   77,   77,   77,   77,   77,   77,   77,
+
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+       77,   77,   79,   79,  107,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,   79,   79,   79,   79,   79,   79,   79,   79,
+       79,   79,  101,  108,  109,  110,  111,  112,  113,  114,
+      101,  101,  115,  116,  118,  117,  119,  122,  120,  123,
+      124,  125,  121,  126,  126,  127,  128,  129,  122,  133,
+      134,  109,  126,  113,  130,  114,  130,  131,  132,  136,
+      118,  115,  117,  119,  120,  121,  137,  135,  138,  131,
+      135,  139,  130,  132,  135,  140,  141,  142,  143,  144,
+      145,  146,  147,  148,  149,  150,  151,  152,  153,  154,
+
+      155,  156,  157,  158,  159,  160,  157,  161,  159,  160,
+      162,  146,  163,  160,  164,  165,  166,  167,  168,  169,
+      138,  170,  171,  172,  181,  182,  184,  185,  186,  187,
+      189,  191,  190,  192,  193,  194,  158,  158,  158,  190,
+      195,  196,  197,  198,  199,  190,  158,  181,  158,  200,
+      158,  158,  185,  158,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  175,  175,  175,  175,  175,  175,
+      175,  175,  175,  175,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  176,  176,  176,  176,  176,  176,  176,  176,  176,
+      176,  178,  183,  201,  202,  203,  204,  205,  178,  208,
+
+      207,  209,  211,  213,  215,  212,  214,  216,  217,  218,
+      219,  220,  221,  222,  223,  224,  225,  226,  203,  183,
+      227,  228,  229,  230,  231,  208,  178,  207,  212,  214,
+      178,  232,  233,  216,  178,  234,  235,  236,  237,  238,
+      239,  178,  240,  241,  242,  178,  244,  178,  178,  245,
+      246,  247,  248,  249,  250,  251,  252,  253,  254,  255,
+      256,  257,  258,  259,  260,  261,  262,  263,  264,  265,
+      266,  267,  265,  268,  269,  270,  271,  272,  273,  274,
+      275,  276,  277,  278,  279,  280,  281,  282,  283,  284,
+      285,  286,  287,  288,  289,  290,  299,  300,  303,  304,
+
+      305,  306,  307,  308,  309,  310,  252,  312,  313,  252,
+      314,  312,  261,  291,  291,  291,  315,  316,  307,  299,
+      291,  291,  291,  291,  291,  291,  296,  296,  296,  317,
+      318,  319,  321,  296,  296,  296,  296,  296,  296,  320,
+      322,  322,  323,  291,  291,  291,  291,  291,  291,  322,
+      324,  326,  327,  329,  331,  333,  296,  296,  296,  296,
+      296,  296,  334,  313,  335,  323,  336,  320,  337,  338,
+      339,  340,  341,  342,  343,  340,  344,  345,  346,  327,
+      347,  348,  349,  350,  351,  352,  353,  354,  355,  356,
+      357,  353,  358,  359,  360,  361,  362,  363,  364,  365,
+
+      366,  366,  367,  368,  369,  370,  371,  372,  373,  374,
+      376,  377,  378,  379,  380,  381,  372,  382,  383,  384,
+      385,  386,  383,  387,  379,  388,  389,  390,  391,  392,
+      393,  390,  394,  395,  396,  397,  353,  398,  399,  400,
+      401,  353,  402,  403,  404,  402,  405,  406,  407,  408,
+      413,  414,  406,  409,  409,  409,  415,  416,  417,  418,
+      409,  409,  409,  409,  409,  409,  410,  410,  410,  420,
+      421,  422,  423,  410,  410,  410,  410,  410,  410,  425,
+      427,  428,  429,  409,  409,  409,  409,  409,  409,  430,
+      431,  432,  433,  434,  435,  436,  410,  410,  410,  410,
+
+      410,  410,  437,  439,  440,  442,  443,  442,  444,  445,
+      447,  448,  449,  450,  451,  452,  454,  455,  432,  456,
+      457,  458,  459,  460,  461,  450,  462,  459,  463,  464,
+      465,  442,  466,  442,  468,  469,  470,  471,  472,  473,
+      474,  475,  476,  477,  478,  479,  480,  481,  482,  483,
+      484,  485,  486,  487,  488,  490,  491,  492,  493,  494,
+      495,  496,  497,  498,  499,  500,  501,  502,  503,  504,
+      505,  506,  507,  508,  504,  509,  510,  511,  512,  513,
+      514,  515,  516,  517,  518,  519,  520,  521,  525,  527,
+      528,  529,  529,  529,  531,  532,  533,  534,  529,  529,
+
+      529,  529,  529,  529,  530,  530,  530,  535,  536,  537,
+      538,  530,  530,  530,  530,  530,  530,  540,  542,  543,
+      544,  529,  529,  529,  529,  529,  529,  539,  545,  546,
+      547,  548,  539,  551,  530,  530,  530,  530,  530,  530,
+      553,  555,  557,  556,  560,  561,  562,  563,  564,  565,
+      566,  567,  568,  569,  570,  571,  573,  574,  575,  576,
+      577,  578,  579,  580,  581,  583,  584,  555,  585,  539,
+      556,  586,  587,  588,  588,  589,  590,  591,  592,  593,
+      594,  595,  596,  597,  600,  601,  602,  603,  604,  605,
+      606,  607,  608,  609,  610,  611,  612,  613,  614,  615,
+
+      616,  618,  619,  620,  621,  622,  623,  624,  625,  626,
+      627,  628,  629,  630,  632,  633,  634,  635,  636,  637,
+      639,  639,  639,  641,  632,  643,  605,  639,  639,  639,
+      639,  639,  639,  642,  642,  644,  645,  646,  647,  649,
+      650,  651,  652,  653,  654,  655,  656,  658,  659,  660,
+      639,  639,  639,  639,  639,  639,  661,  662,  663,  664,
+      665,  666,  667,  668,  669,  670,  671,  672,  673,  674,
+      675,  676,  677,  679,  680,  681,  682,  683,  684,  685,
+      662,  686,  687,  661,  688,  689,  690,  691,  692,  693,
+      694,  695,  696,  697,  698,  700,  697,  701,  702,  703,
+
+      704,  705,  706,  708,  709,  710,  711,  712,  713,  714,
+      715,  716,  717,  718,  719,  720,  721,  722,  723,  724,
+      725,  726,  727,  728,  729,  730,  731,  726,  727,  732,
+      734,  726,  731,  735,  736,  737,  738,  740,  741,  742,
+      743,  744,  745,  747,  748,  749,  750,  751,  752,  753,
+      754,  756,  757,  759,  760,  761,  762,  763,  764,  765,
+      766,  767,  768,  769,  770,  771,  772,  773,  774,  776,
+      777,  778,  779,  780,  781,  782,  783,  779,  784,  785,
+      786,  760,  787,  788,  789,  792,  793,  794,  795,  798,
+      799,  800,  801,  802,  803,  800,  804,  805,  806,  807,
+
+      808,  809,  810,  811,  812,  813,  814,  815,  816,  817,
+      818,  819,  820,  821,  822,  823,  824,  825,  826,  827,
+      828,  829,  830,  831,  833,  822,  834,  835,  836,  837,
+      838,  839,  840,  841,  842,  843,  844,  845,  847,  848,
+      849,  852,  854,  855,  856,  857,  858,  859,  860,  861,
+      862,  864,  865,  866,  867,  868,  869,  870,  871,  872,
+      873,  875,  876,  877,  878,  879,  855,  880,  854,  882,
+      879,  883,  884,  885,  886,  887,  888,  889,  890,  891,
+      892,  893,  894,  895,  896,  897,  898,  899,  900,  901,
+      902,  903,  905,  906,  907,  897,  908,  909,  910,  911,
+
+      912,  913,  914,  915,  916,  917,  918,  919,  921,  922,
+      923,  924,  925,  926,  927,  928,  929,  930,  931,  932,
+      879,  933,  934,  935,  936,  937,  938,  939,  940,  941,
+      942,  944,  943,  945,  946,  947,  949,  950,  951,  952,
+      953,  954,  955,  956,  957,  958,  959,  960,  961,  962,
+      963,  964,  966,  968,  965,  969,  970,  942,  943,  965,
+      971,  972,  973,  974,  975,  976,  977,  978,  979,  980,
+      981,  982,  983,  984,  985,  986,  987,  988,  989,  990,
+      992,  993,  994,  995,  996,  997,  998,  999, 1000, 1003,
+     1004, 1006, 1007, 1008, 1009,  968, 1010, 1011, 1012, 1013,
+
+     1014, 1015, 1017, 1018, 1019, 1020, 1021, 1022, 1024, 1027,
+     1028, 1029, 1030, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+     1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1050,
+     1052, 1053, 1055, 1028, 1056, 1057, 1058, 1059, 1029, 1060,
+     1061, 1062, 1064, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
+     1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083,
+     1084, 1086, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+     1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+     1106, 1107, 1109, 1110, 1111, 1112, 1113, 1115, 1116, 1117,
+     1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127,
+
+     1128, 1129, 1130, 1132, 1133, 1134, 1135, 1106, 1137, 1083,
+     1139, 1140, 1133, 1141, 1142, 1143, 1144, 1145, 1146, 1103,
+     1147, 1148, 1150, 1151, 1152, 1153, 1154, 1155, 1158, 1159,
+     1162, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172,
+     1174, 1175, 1176, 1178, 1179, 1180, 1182, 1183, 1184, 1185,
+     1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1196, 1199,
+     1200, 1201, 1202, 1204, 1205, 1176, 1206, 1207, 1208, 1209,
+     1210, 1211, 1214, 1215, 1216, 1217, 1218, 1221, 1222, 1223,
+     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1235,
+     1236, 1238, 1239, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
+
+     1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256,
+     1257, 1258, 1259, 1260, 1261, 1235, 1262, 1263, 1264, 1265,
+     1266, 1267, 1268, 1270, 1272, 1273, 1275, 1276, 1280, 1282,
+     1281, 1283, 1285, 1286, 1287, 1288, 1289, 1285, 1290, 1291,
+     1292, 1293, 1295, 1296, 1299, 1300, 1301, 1302, 1304, 1305,
+     1306, 1307, 1308, 1309, 1310, 1311, 1248, 1281, 1312, 1313,
+     1314, 1315, 1316, 1318, 1320, 1321, 1322, 1323, 1324, 1326,
+     1327, 1328, 1330, 1331, 1332, 1334, 1335, 1336, 1337, 1338,
+     1339, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1349, 1350,
+     1352, 1354, 1356, 1357, 1358, 1359, 1360, 1362, 1363, 1364,
+
+     1365, 1366, 1367, 1369, 1371, 1372, 1373, 1374, 1375, 1376,
+     1377, 1378, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387,
+     1388, 1390, 1392, 1393, 1394, 1395, 1397, 1398, 1399, 1400,
+     1401, 1402, 1404, 1406, 1407, 1408, 1409, 1410, 1411, 1413,
+     1414, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1424, 1425,
+     1426, 1427, 1430, 1431, 1433, 1435, 1436, 1437, 1438, 1439,
+     1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449,
+     1450, 1451, 1452, 1453, 1454, 1455, 1456, 1457, 1458, 1459,
+     1460, 1461, 1463, 1466, 1467, 1468, 1469, 1470, 1471, 1475,
+     1476, 1477, 1478, 1480, 1481, 1483, 1484, 1485, 1486, 1487,
+
+     1489, 1490,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1666,7 +1803,7 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[179] =
+static const flex_int16_t yy_rule_linenum[183] =
     {   0,
       149,  151,  153,  158,  159,  164,  165,  166,  178,  181,
       186,  193,  202,  211,  220,  229,  238,  247,  256,  265,
@@ -1680,13 +1817,14 @@ static const flex_int16_t yy_rule_linenum[179] =
       995, 1004, 1014, 1024, 1033, 1043, 1054, 1063, 1072, 1081,
 
      1090, 1099, 1109, 1118, 1127, 1136, 1145, 1154, 1163, 1172,
-     1181, 1190, 1200, 1209, 1218, 1228, 1240, 1253, 1262, 1271,
-     1281, 1291, 1300, 1311, 1321, 1330, 1340, 1350, 1359, 1368,
-     1377, 1386, 1396, 1405, 1415, 1424, 1433, 1442, 1451, 1460,
+     1181, 1190, 1199, 1208, 1217, 1227, 1236, 1245, 1254, 1264,
+     1276, 1289, 1298, 1307, 1317, 1327, 1336, 1347, 1357, 1366,
+     1376, 1386, 1395, 1404, 1413, 1422, 1432, 1441, 1451, 1460,
      1469, 1478, 1487, 1496, 1505, 1514, 1523, 1532, 1541, 1550,
      1559, 1568, 1577, 1586, 1595, 1604, 1613, 1622, 1631, 1640,
-     1650, 1749, 1754, 1759, 1764, 1765, 1766, 1767, 1768, 1769,
-     1771, 1789, 1802, 1807, 1811, 1813, 1815, 1817
+     1649, 1658, 1667, 1676, 1686, 1785, 1790, 1795, 1800, 1801,
+     1802, 1803, 1804, 1805, 1807, 1825, 1838, 1843, 1847, 1849,
+     1851, 1853
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1698,7 +1836,7 @@ static const flex_int16_t yy_rule_linenum[179] =
 #define YY_RESTORE_YY_MORE_OFFSET
 char *yytext;
 #line 1 "dhcp6_lexer.ll"
-/* Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -1739,7 +1877,7 @@ using namespace isc::dhcp;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1742 "dhcp6_lexer.cc"
+#line 1880 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1765,8 +1903,8 @@ using namespace isc::dhcp;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1768 "dhcp6_lexer.cc"
-#line 1769 "dhcp6_lexer.cc"
+#line 1906 "dhcp6_lexer.cc"
+#line 1907 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -2098,7 +2236,7 @@ YY_DECL
     }
 
 
-#line 2101 "dhcp6_lexer.cc"
+#line 2239 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2127,13 +2265,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1453 )
+				if ( yy_current_state >= 1493 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1452 );
+		while ( yy_current_state != 1492 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -3572,7 +3710,43 @@ YY_RULE_SETUP
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
-#line 1200 "dhcp6_lexer.ll"
+#line 1199 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 114:
+YY_RULE_SETUP
+#line 1208 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 115:
+YY_RULE_SETUP
+#line 1217 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 116:
+YY_RULE_SETUP
+#line 1227 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3582,9 +3756,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 117:
 YY_RULE_SETUP
-#line 1209 "dhcp6_lexer.ll"
+#line 1236 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LOGGERS:
+        return isc::dhcp::Dhcp6Parser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 118:
+YY_RULE_SETUP
+#line 1245 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3594,9 +3780,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 119:
 YY_RULE_SETUP
-#line 1218 "dhcp6_lexer.ll"
+#line 1254 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3607,9 +3793,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 120:
 YY_RULE_SETUP
-#line 1228 "dhcp6_lexer.ll"
+#line 1264 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3622,9 +3808,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 121:
 YY_RULE_SETUP
-#line 1240 "dhcp6_lexer.ll"
+#line 1276 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3638,9 +3824,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 122:
 YY_RULE_SETUP
-#line 1253 "dhcp6_lexer.ll"
+#line 1289 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3650,9 +3836,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 123:
 YY_RULE_SETUP
-#line 1262 "dhcp6_lexer.ll"
+#line 1298 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3662,9 +3848,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 124:
 YY_RULE_SETUP
-#line 1271 "dhcp6_lexer.ll"
+#line 1307 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3675,9 +3861,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 125:
 YY_RULE_SETUP
-#line 1281 "dhcp6_lexer.ll"
+#line 1317 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3688,9 +3874,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 126:
 YY_RULE_SETUP
-#line 1291 "dhcp6_lexer.ll"
+#line 1327 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3700,9 +3886,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 127:
 YY_RULE_SETUP
-#line 1300 "dhcp6_lexer.ll"
+#line 1336 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -3714,9 +3900,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 128:
 YY_RULE_SETUP
-#line 1311 "dhcp6_lexer.ll"
+#line 1347 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3727,9 +3913,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 129:
 YY_RULE_SETUP
-#line 1321 "dhcp6_lexer.ll"
+#line 1357 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3739,9 +3925,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 130:
 YY_RULE_SETUP
-#line 1330 "dhcp6_lexer.ll"
+#line 1366 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3752,9 +3938,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 131:
 YY_RULE_SETUP
-#line 1340 "dhcp6_lexer.ll"
+#line 1376 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3765,9 +3951,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 132:
 YY_RULE_SETUP
-#line 1350 "dhcp6_lexer.ll"
+#line 1386 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3777,9 +3963,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 133:
 YY_RULE_SETUP
-#line 1359 "dhcp6_lexer.ll"
+#line 1395 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3789,9 +3975,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 134:
 YY_RULE_SETUP
-#line 1368 "dhcp6_lexer.ll"
+#line 1404 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3801,9 +3987,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 135:
 YY_RULE_SETUP
-#line 1377 "dhcp6_lexer.ll"
+#line 1413 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3813,9 +3999,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 136:
 YY_RULE_SETUP
-#line 1386 "dhcp6_lexer.ll"
+#line 1422 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3826,9 +4012,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 137:
 YY_RULE_SETUP
-#line 1396 "dhcp6_lexer.ll"
+#line 1432 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -3838,9 +4024,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 138:
 YY_RULE_SETUP
-#line 1405 "dhcp6_lexer.ll"
+#line 1441 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3850,9 +4036,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 139:
 YY_RULE_SETUP
-#line 1415 "dhcp6_lexer.ll"
+#line 1451 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3862,9 +4048,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 140:
 YY_RULE_SETUP
-#line 1424 "dhcp6_lexer.ll"
+#line 1460 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3874,9 +4060,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 141:
 YY_RULE_SETUP
-#line 1433 "dhcp6_lexer.ll"
+#line 1469 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3886,9 +4072,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 142:
 YY_RULE_SETUP
-#line 1442 "dhcp6_lexer.ll"
+#line 1478 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3898,9 +4084,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 143:
 YY_RULE_SETUP
-#line 1451 "dhcp6_lexer.ll"
+#line 1487 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3910,9 +4096,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 144:
 YY_RULE_SETUP
-#line 1460 "dhcp6_lexer.ll"
+#line 1496 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3922,9 +4108,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 145:
 YY_RULE_SETUP
-#line 1469 "dhcp6_lexer.ll"
+#line 1505 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3934,9 +4120,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 146:
 YY_RULE_SETUP
-#line 1478 "dhcp6_lexer.ll"
+#line 1514 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3946,9 +4132,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 147:
 YY_RULE_SETUP
-#line 1487 "dhcp6_lexer.ll"
+#line 1523 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3958,9 +4144,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 148:
 YY_RULE_SETUP
-#line 1496 "dhcp6_lexer.ll"
+#line 1532 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3970,9 +4156,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 149:
 YY_RULE_SETUP
-#line 1505 "dhcp6_lexer.ll"
+#line 1541 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3982,9 +4168,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 150:
 YY_RULE_SETUP
-#line 1514 "dhcp6_lexer.ll"
+#line 1550 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3994,9 +4180,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 151:
 YY_RULE_SETUP
-#line 1523 "dhcp6_lexer.ll"
+#line 1559 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4006,9 +4192,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 152:
 YY_RULE_SETUP
-#line 1532 "dhcp6_lexer.ll"
+#line 1568 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4018,9 +4204,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 153:
 YY_RULE_SETUP
-#line 1541 "dhcp6_lexer.ll"
+#line 1577 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4030,9 +4216,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 154:
 YY_RULE_SETUP
-#line 1550 "dhcp6_lexer.ll"
+#line 1586 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4042,9 +4228,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 155:
 YY_RULE_SETUP
-#line 1559 "dhcp6_lexer.ll"
+#line 1595 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -4054,9 +4240,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 156:
 YY_RULE_SETUP
-#line 1568 "dhcp6_lexer.ll"
+#line 1604 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4066,9 +4252,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 157:
 YY_RULE_SETUP
-#line 1577 "dhcp6_lexer.ll"
+#line 1613 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4078,9 +4264,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 158:
 YY_RULE_SETUP
-#line 1586 "dhcp6_lexer.ll"
+#line 1622 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4090,9 +4276,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 159:
 YY_RULE_SETUP
-#line 1595 "dhcp6_lexer.ll"
+#line 1631 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -4102,9 +4288,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 160:
 YY_RULE_SETUP
-#line 1604 "dhcp6_lexer.ll"
+#line 1640 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4114,9 +4300,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 161:
 YY_RULE_SETUP
-#line 1613 "dhcp6_lexer.ll"
+#line 1649 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -4126,9 +4312,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 158:
+case 162:
 YY_RULE_SETUP
-#line 1622 "dhcp6_lexer.ll"
+#line 1658 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4138,9 +4324,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 159:
+case 163:
 YY_RULE_SETUP
-#line 1631 "dhcp6_lexer.ll"
+#line 1667 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4150,9 +4336,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 160:
+case 164:
 YY_RULE_SETUP
-#line 1640 "dhcp6_lexer.ll"
+#line 1676 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -4162,9 +4348,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 161:
+case 165:
 YY_RULE_SETUP
-#line 1650 "dhcp6_lexer.ll"
+#line 1686 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -4264,65 +4450,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 162:
-/* rule 162 can match eol */
+case 166:
+/* rule 166 can match eol */
 YY_RULE_SETUP
-#line 1749 "dhcp6_lexer.ll"
+#line 1785 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 163:
-/* rule 163 can match eol */
+case 167:
+/* rule 167 can match eol */
 YY_RULE_SETUP
-#line 1754 "dhcp6_lexer.ll"
+#line 1790 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 164:
+case 168:
 YY_RULE_SETUP
-#line 1759 "dhcp6_lexer.ll"
+#line 1795 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 165:
+case 169:
 YY_RULE_SETUP
-#line 1764 "dhcp6_lexer.ll"
+#line 1800 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 166:
+case 170:
 YY_RULE_SETUP
-#line 1765 "dhcp6_lexer.ll"
+#line 1801 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 167:
+case 171:
 YY_RULE_SETUP
-#line 1766 "dhcp6_lexer.ll"
+#line 1802 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 168:
+case 172:
 YY_RULE_SETUP
-#line 1767 "dhcp6_lexer.ll"
+#line 1803 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 169:
+case 173:
 YY_RULE_SETUP
-#line 1768 "dhcp6_lexer.ll"
+#line 1804 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 170:
+case 174:
 YY_RULE_SETUP
-#line 1769 "dhcp6_lexer.ll"
+#line 1805 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 171:
+case 175:
 YY_RULE_SETUP
-#line 1771 "dhcp6_lexer.ll"
+#line 1807 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -4341,9 +4527,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 172:
+case 176:
 YY_RULE_SETUP
-#line 1789 "dhcp6_lexer.ll"
+#line 1825 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -4357,43 +4543,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 173:
+case 177:
 YY_RULE_SETUP
-#line 1802 "dhcp6_lexer.ll"
+#line 1838 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 174:
+case 178:
 YY_RULE_SETUP
-#line 1807 "dhcp6_lexer.ll"
+#line 1843 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 175:
+case 179:
 YY_RULE_SETUP
-#line 1811 "dhcp6_lexer.ll"
+#line 1847 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 176:
+case 180:
 YY_RULE_SETUP
-#line 1813 "dhcp6_lexer.ll"
+#line 1849 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 177:
+case 181:
 YY_RULE_SETUP
-#line 1815 "dhcp6_lexer.ll"
+#line 1851 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 178:
+case 182:
 YY_RULE_SETUP
-#line 1817 "dhcp6_lexer.ll"
+#line 1853 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1819 "dhcp6_lexer.ll"
+#line 1855 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -4417,12 +4603,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 179:
+case 183:
 YY_RULE_SETUP
-#line 1842 "dhcp6_lexer.ll"
+#line 1878 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4425 "dhcp6_lexer.cc"
+#line 4611 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4741,7 +4927,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1453 )
+			if ( yy_current_state >= 1493 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4774,11 +4960,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1453 )
+		if ( yy_current_state >= 1493 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1452);
+	yy_is_jam = (yy_current_state == 1492);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5527,7 +5713,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 1842 "dhcp6_lexer.ll"
+#line 1878 "dhcp6_lexer.ll"
 
 
 using namespace isc::dhcp;
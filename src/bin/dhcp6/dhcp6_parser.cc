@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 34 "dhcp6_parser.yy" // lalr1.cc:438
+#line 34 "dhcp6_parser.yy"
 
 #include <dhcp6/parser_context.h>
 
-#line 51 "dhcp6_parser.cc" // lalr1.cc:438
+#line 52 "dhcp6_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -88,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if PARSER6_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !PARSER6_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:513
+#line 14 "dhcp6_parser.yy"
 namespace isc { namespace dhcp {
-#line 146 "dhcp6_parser.cc" // lalr1.cc:513
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  Dhcp6Parser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "dhcp6_parser.cc"
 
   /// Build a parser object.
   Dhcp6Parser::Dhcp6Parser (isc::dhcp::Parser6Context& ctx_yyarg)
-    :
 #if PARSER6_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -195,24 +157,26 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::~Dhcp6Parser ()
   {}
 
+  Dhcp6Parser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  Dhcp6Parser::by_state::by_state ()
+  Dhcp6Parser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  Dhcp6Parser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  Dhcp6Parser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
   void
-  Dhcp6Parser::by_state::clear ()
+  Dhcp6Parser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
@@ -224,17 +188,17 @@ namespace isc { namespace dhcp {
     that.clear ();
   }
 
-  Dhcp6Parser::by_state::by_state (state_type s)
+  Dhcp6Parser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  Dhcp6Parser::symbol_number_type
-  Dhcp6Parser::by_state::type_get () const
+  Dhcp6Parser::symbol_kind_type
+  Dhcp6Parser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   Dhcp6Parser::stack_symbol_type::stack_symbol_type ()
@@ -243,31 +207,31 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 191: // value
-      case 195: // map_value
-      case 247: // db_type
-      case 336: // hr_mode
-      case 472: // duid_type
-      case 507: // ncr_protocol_value
-      case 514: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 173: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 172: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 171: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 170: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -284,31 +248,31 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
-    {
-      case 191: // value
-      case 195: // map_value
-      case 247: // db_type
-      case 336: // hr_mode
-      case 472: // duid_type
-      case 507: // ncr_protocol_value
-      case 514: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 173: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 172: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 171: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 170: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -317,39 +281,79 @@ namespace isc { namespace dhcp {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  Dhcp6Parser::stack_symbol_type&
+  Dhcp6Parser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   Dhcp6Parser::stack_symbol_type&
   Dhcp6Parser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
-    {
-      case 191: // value
-      case 195: // map_value
-      case 247: // db_type
-      case 336: // hr_mode
-      case 472: // duid_type
-      case 507: // ncr_protocol_value
-      case 514: // replace_client_name_value
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 173: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 172: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 171: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 170: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -375,103 +379,91 @@ namespace isc { namespace dhcp {
 #if PARSER6_DEBUG
   template <typename Base>
   void
-  Dhcp6Parser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  Dhcp6Parser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 170: // "constant string"
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 398 "dhcp6_parser.cc" // lalr1.cc:672
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 400 "dhcp6_parser.cc"
         break;
 
-      case 171: // "integer"
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 405 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_INTEGER: // "integer"
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 406 "dhcp6_parser.cc"
         break;
 
-      case 172: // "floating point"
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< double > (); }
-#line 412 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 412 "dhcp6_parser.cc"
         break;
 
-      case 173: // "boolean"
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 419 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 418 "dhcp6_parser.cc"
         break;
 
-      case 191: // value
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 426 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_value: // value
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 424 "dhcp6_parser.cc"
         break;
 
-      case 195: // map_value
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 433 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_map_value: // map_value
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 430 "dhcp6_parser.cc"
         break;
 
-      case 247: // db_type
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 440 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_db_type: // db_type
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 436 "dhcp6_parser.cc"
         break;
 
-      case 336: // hr_mode
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 447 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_hr_mode: // hr_mode
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 442 "dhcp6_parser.cc"
         break;
 
-      case 472: // duid_type
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 454 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_duid_type: // duid_type
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 448 "dhcp6_parser.cc"
         break;
 
-      case 507: // ncr_protocol_value
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 461 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 454 "dhcp6_parser.cc"
         break;
 
-      case 514: // replace_client_name_value
-
-#line 248 "dhcp6_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 468 "dhcp6_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
+#line 252 "dhcp6_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 460 "dhcp6_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -495,7 +487,7 @@ namespace isc { namespace dhcp {
   }
 
   void
-  Dhcp6Parser::yypop_ (int n)
+  Dhcp6Parser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -530,21 +522,21 @@ namespace isc { namespace dhcp {
   Dhcp6Parser::state_type
   Dhcp6Parser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue)
+  Dhcp6Parser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue)
+  Dhcp6Parser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -558,7 +550,6 @@ namespace isc { namespace dhcp {
   int
   Dhcp6Parser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -590,27 +581,33 @@ namespace isc { namespace dhcp {
     yystack_.clear ();
     yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -621,6 +618,7 @@ namespace isc { namespace dhcp {
 #if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
@@ -628,11 +626,23 @@ namespace isc { namespace dhcp {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -649,20 +659,22 @@ namespace isc { namespace dhcp {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
@@ -674,29 +686,29 @@ namespace isc { namespace dhcp {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 191: // value
-      case 195: // map_value
-      case 247: // db_type
-      case 336: // hr_mode
-      case 472: // duid_type
-      case 507: // ncr_protocol_value
-      case 514: // replace_client_name_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_db_type: // db_type
+      case symbol_kind::S_hr_mode: // hr_mode
+      case symbol_kind::S_duid_type: // duid_type
+      case symbol_kind::S_ncr_protocol_value: // ncr_protocol_value
+      case symbol_kind::S_replace_client_name_value: // replace_client_name_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 173: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 172: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 171: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 170: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -707,8 +719,8 @@ namespace isc { namespace dhcp {
 
       // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
         yyerror_range[1].location = yylhs.location;
       }
 
@@ -720,288 +732,288 @@ namespace isc { namespace dhcp {
         {
           switch (yyn)
             {
-  case 2:
-#line 257 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.NO_KEYWORD; }
-#line 727 "dhcp6_parser.cc" // lalr1.cc:907
+  case 2: // $@1: %empty
+#line 261 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.NO_KEYWORD; }
+#line 739 "dhcp6_parser.cc"
     break;
 
-  case 4:
-#line 258 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 733 "dhcp6_parser.cc" // lalr1.cc:907
+  case 4: // $@2: %empty
+#line 262 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.CONFIG; }
+#line 745 "dhcp6_parser.cc"
     break;
 
-  case 6:
-#line 259 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 739 "dhcp6_parser.cc" // lalr1.cc:907
+  case 6: // $@3: %empty
+#line 263 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.DHCP6; }
+#line 751 "dhcp6_parser.cc"
     break;
 
-  case 8:
-#line 260 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
-#line 745 "dhcp6_parser.cc" // lalr1.cc:907
+  case 8: // $@4: %empty
+#line 264 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
+#line 757 "dhcp6_parser.cc"
     break;
 
-  case 10:
-#line 261 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.SUBNET6; }
-#line 751 "dhcp6_parser.cc" // lalr1.cc:907
+  case 10: // $@5: %empty
+#line 265 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.SUBNET6; }
+#line 763 "dhcp6_parser.cc"
     break;
 
-  case 12:
-#line 262 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.POOLS; }
-#line 757 "dhcp6_parser.cc" // lalr1.cc:907
+  case 12: // $@6: %empty
+#line 266 "dhcp6_parser.yy"
+                 { ctx.ctx_ = ctx.POOLS; }
+#line 769 "dhcp6_parser.cc"
     break;
 
-  case 14:
-#line 263 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.PD_POOLS; }
-#line 763 "dhcp6_parser.cc" // lalr1.cc:907
+  case 14: // $@7: %empty
+#line 267 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.PD_POOLS; }
+#line 775 "dhcp6_parser.cc"
     break;
 
-  case 16:
-#line 264 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.RESERVATIONS; }
-#line 769 "dhcp6_parser.cc" // lalr1.cc:907
+  case 16: // $@8: %empty
+#line 268 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.RESERVATIONS; }
+#line 781 "dhcp6_parser.cc"
     break;
 
-  case 18:
-#line 265 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP6; }
-#line 775 "dhcp6_parser.cc" // lalr1.cc:907
+  case 18: // $@9: %empty
+#line 269 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.DHCP6; }
+#line 787 "dhcp6_parser.cc"
     break;
 
-  case 20:
-#line 266 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.OPTION_DEF; }
-#line 781 "dhcp6_parser.cc" // lalr1.cc:907
+  case 20: // $@10: %empty
+#line 270 "dhcp6_parser.yy"
+                      { ctx.ctx_ = ctx.OPTION_DEF; }
+#line 793 "dhcp6_parser.cc"
     break;
 
-  case 22:
-#line 267 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.OPTION_DATA; }
-#line 787 "dhcp6_parser.cc" // lalr1.cc:907
+  case 22: // $@11: %empty
+#line 271 "dhcp6_parser.yy"
+                       { ctx.ctx_ = ctx.OPTION_DATA; }
+#line 799 "dhcp6_parser.cc"
     break;
 
-  case 24:
-#line 268 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
-#line 793 "dhcp6_parser.cc" // lalr1.cc:907
+  case 24: // $@12: %empty
+#line 272 "dhcp6_parser.yy"
+                         { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
+#line 805 "dhcp6_parser.cc"
     break;
 
-  case 26:
-#line 269 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.DHCP_DDNS; }
-#line 799 "dhcp6_parser.cc" // lalr1.cc:907
+  case 26: // $@13: %empty
+#line 273 "dhcp6_parser.yy"
+                     { ctx.ctx_ = ctx.DHCP_DDNS; }
+#line 811 "dhcp6_parser.cc"
     break;
 
-  case 28:
-#line 270 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.LOGGING; }
-#line 805 "dhcp6_parser.cc" // lalr1.cc:907
+  case 28: // $@14: %empty
+#line 274 "dhcp6_parser.yy"
+                   { ctx.ctx_ = ctx.LOGGING; }
+#line 817 "dhcp6_parser.cc"
     break;
 
-  case 30:
-#line 271 "dhcp6_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG_CONTROL; }
-#line 811 "dhcp6_parser.cc" // lalr1.cc:907
+  case 30: // $@15: %empty
+#line 275 "dhcp6_parser.yy"
+                          { ctx.ctx_ = ctx.CONFIG_CONTROL; }
+#line 823 "dhcp6_parser.cc"
     break;
 
-  case 32:
-#line 279 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 817 "dhcp6_parser.cc" // lalr1.cc:907
+  case 32: // value: "integer"
+#line 283 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 829 "dhcp6_parser.cc"
     break;
 
-  case 33:
-#line 280 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 823 "dhcp6_parser.cc" // lalr1.cc:907
+  case 33: // value: "floating point"
+#line 284 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 835 "dhcp6_parser.cc"
     break;
 
-  case 34:
-#line 281 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 829 "dhcp6_parser.cc" // lalr1.cc:907
+  case 34: // value: "boolean"
+#line 285 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 841 "dhcp6_parser.cc"
     break;
 
-  case 35:
-#line 282 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 835 "dhcp6_parser.cc" // lalr1.cc:907
+  case 35: // value: "constant string"
+#line 286 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 847 "dhcp6_parser.cc"
     break;
 
-  case 36:
-#line 283 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 841 "dhcp6_parser.cc" // lalr1.cc:907
+  case 36: // value: "null"
+#line 287 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 853 "dhcp6_parser.cc"
     break;
 
-  case 37:
-#line 284 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 847 "dhcp6_parser.cc" // lalr1.cc:907
+  case 37: // value: map2
+#line 288 "dhcp6_parser.yy"
+            { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 859 "dhcp6_parser.cc"
     break;
 
-  case 38:
-#line 285 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 853 "dhcp6_parser.cc" // lalr1.cc:907
+  case 38: // value: list_generic
+#line 289 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 865 "dhcp6_parser.cc"
     break;
 
-  case 39:
-#line 288 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 39: // sub_json: value
+#line 292 "dhcp6_parser.yy"
+                {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 862 "dhcp6_parser.cc" // lalr1.cc:907
+#line 874 "dhcp6_parser.cc"
     break;
 
-  case 40:
-#line 293 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 40: // $@16: %empty
+#line 297 "dhcp6_parser.yy"
+                     {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 873 "dhcp6_parser.cc" // lalr1.cc:907
+#line 885 "dhcp6_parser.cc"
     break;
 
-  case 41:
-#line 298 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 41: // map2: "{" $@16 map_content "}"
+#line 302 "dhcp6_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 883 "dhcp6_parser.cc" // lalr1.cc:907
+#line 895 "dhcp6_parser.cc"
     break;
 
-  case 42:
-#line 304 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 889 "dhcp6_parser.cc" // lalr1.cc:907
+  case 42: // map_value: map2
+#line 308 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 901 "dhcp6_parser.cc"
     break;
 
-  case 45:
-#line 311 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 45: // not_empty_map: "constant string" ":" value
+#line 315 "dhcp6_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 898 "dhcp6_parser.cc" // lalr1.cc:907
+#line 910 "dhcp6_parser.cc"
     break;
 
-  case 46:
-#line 315 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 46: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 319 "dhcp6_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 908 "dhcp6_parser.cc" // lalr1.cc:907
+#line 920 "dhcp6_parser.cc"
     break;
 
-  case 47:
-#line 322 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 47: // $@17: %empty
+#line 326 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 917 "dhcp6_parser.cc" // lalr1.cc:907
+#line 929 "dhcp6_parser.cc"
     break;
 
-  case 48:
-#line 325 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 48: // list_generic: "[" $@17 list_content "]"
+#line 329 "dhcp6_parser.yy"
+                               {
     // list parsing complete. Put any sanity checking here
 }
-#line 925 "dhcp6_parser.cc" // lalr1.cc:907
+#line 937 "dhcp6_parser.cc"
     break;
 
-  case 51:
-#line 333 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 51: // not_empty_list: value
+#line 337 "dhcp6_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 934 "dhcp6_parser.cc" // lalr1.cc:907
+#line 946 "dhcp6_parser.cc"
     break;
 
-  case 52:
-#line 337 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 52: // not_empty_list: not_empty_list "," value
+#line 341 "dhcp6_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 943 "dhcp6_parser.cc" // lalr1.cc:907
+#line 955 "dhcp6_parser.cc"
     break;
 
-  case 53:
-#line 344 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 53: // $@18: %empty
+#line 348 "dhcp6_parser.yy"
+                              {
     // List parsing about to start
 }
-#line 951 "dhcp6_parser.cc" // lalr1.cc:907
+#line 963 "dhcp6_parser.cc"
     break;
 
-  case 54:
-#line 346 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 54: // list_strings: "[" $@18 list_strings_content "]"
+#line 350 "dhcp6_parser.yy"
+                                       {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
 }
-#line 960 "dhcp6_parser.cc" // lalr1.cc:907
+#line 972 "dhcp6_parser.cc"
     break;
 
-  case 57:
-#line 355 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 57: // not_empty_list_strings: "constant string"
+#line 359 "dhcp6_parser.yy"
+                               {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 969 "dhcp6_parser.cc" // lalr1.cc:907
+#line 981 "dhcp6_parser.cc"
     break;
 
-  case 58:
-#line 359 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-                          ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 58: // not_empty_list_strings: not_empty_list_strings "," "constant string"
+#line 363 "dhcp6_parser.yy"
+                                                            {
+                          ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
                           }
-#line 978 "dhcp6_parser.cc" // lalr1.cc:907
+#line 990 "dhcp6_parser.cc"
     break;
 
-  case 59:
-#line 370 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 59: // unknown_map_entry: "constant string" ":"
+#line 374 "dhcp6_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 989 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1001 "dhcp6_parser.cc"
     break;
 
-  case 60:
-#line 380 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 60: // $@19: %empty
+#line 384 "dhcp6_parser.yy"
+                           {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1000 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1012 "dhcp6_parser.cc"
     break;
 
-  case 61:
-#line 385 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 61: // syntax_map: "{" $@19 global_objects "}"
+#line 389 "dhcp6_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
@@ -1009,12 +1021,12 @@ namespace isc { namespace dhcp {
     // Dhcp6 is required
     ctx.require("Dhcp6", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 1013 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1025 "dhcp6_parser.cc"
     break;
 
-  case 70:
-#line 408 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 70: // $@20: %empty
+#line 412 "dhcp6_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1022,840 +1034,840 @@ namespace isc { namespace dhcp {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP6);
 }
-#line 1026 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1038 "dhcp6_parser.cc"
     break;
 
-  case 71:
-#line 415 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 71: // dhcp6_object: "Dhcp6" $@20 ":" "{" global_params "}"
+#line 419 "dhcp6_parser.yy"
+                                                    {
     // No global parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1036 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1048 "dhcp6_parser.cc"
     break;
 
-  case 72:
-#line 423 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 72: // $@21: %empty
+#line 427 "dhcp6_parser.yy"
+                          {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1046 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1058 "dhcp6_parser.cc"
     break;
 
-  case 73:
-#line 427 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 73: // sub_dhcp6: "{" $@21 global_params "}"
+#line 431 "dhcp6_parser.yy"
+                               {
     // No global parameter is required
     // parsing completed
 }
-#line 1055 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1067 "dhcp6_parser.cc"
     break;
 
-  case 108:
-#line 472 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 108: // preferred_lifetime: "preferred-lifetime" ":" "integer"
+#line 476 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
 }
-#line 1064 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1076 "dhcp6_parser.cc"
     break;
 
-  case 109:
-#line 477 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 109: // valid_lifetime: "valid-lifetime" ":" "integer"
+#line 481 "dhcp6_parser.yy"
+                                             {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
 }
-#line 1073 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1085 "dhcp6_parser.cc"
     break;
 
-  case 110:
-#line 482 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 110: // renew_timer: "renew-timer" ":" "integer"
+#line 486 "dhcp6_parser.yy"
+                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
 }
-#line 1082 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1094 "dhcp6_parser.cc"
     break;
 
-  case 111:
-#line 487 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 111: // rebind_timer: "rebind-timer" ":" "integer"
+#line 491 "dhcp6_parser.yy"
+                                         {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
 }
-#line 1091 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1103 "dhcp6_parser.cc"
     break;
 
-  case 112:
-#line 492 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 112: // decline_probation_period: "decline-probation-period" ":" "integer"
+#line 496 "dhcp6_parser.yy"
+                                                                 {
+    ElementPtr dpp(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
 }
-#line 1100 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1112 "dhcp6_parser.cc"
     break;
 
-  case 113:
-#line 497 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 113: // $@22: %empty
+#line 501 "dhcp6_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1108 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1120 "dhcp6_parser.cc"
     break;
 
-  case 114:
-#line 499 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr stag(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 114: // server_tag: "server-tag" $@22 ":" "constant string"
+#line 503 "dhcp6_parser.yy"
+               {
+    ElementPtr stag(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-tag", stag);
     ctx.leave();
 }
-#line 1118 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1130 "dhcp6_parser.cc"
     break;
 
-  case 115:
-#line 505 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 115: // $@23: %empty
+#line 509 "dhcp6_parser.yy"
+                                     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.INTERFACES_CONFIG);
 }
-#line 1129 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1141 "dhcp6_parser.cc"
     break;
 
-  case 116:
-#line 510 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 116: // interfaces_config: "interfaces-config" $@23 ":" "{" interfaces_config_params "}"
+#line 514 "dhcp6_parser.yy"
+                                                               {
     // No interfaces config param is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1139 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1151 "dhcp6_parser.cc"
     break;
 
-  case 117:
-#line 516 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 117: // $@24: %empty
+#line 520 "dhcp6_parser.yy"
+                                {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1149 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1161 "dhcp6_parser.cc"
     break;
 
-  case 118:
-#line 520 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 118: // sub_interfaces6: "{" $@24 interfaces_config_params "}"
+#line 524 "dhcp6_parser.yy"
+                                          {
     // No interfaces config param is required
     // parsing completed
 }
-#line 1158 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1170 "dhcp6_parser.cc"
     break;
 
-  case 126:
-#line 536 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 126: // $@25: %empty
+#line 540 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1169 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1181 "dhcp6_parser.cc"
     break;
 
-  case 127:
-#line 541 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 127: // interfaces_list: "interfaces" $@25 ":" list_strings
+#line 545 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1178 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1190 "dhcp6_parser.cc"
     break;
 
-  case 128:
-#line 546 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 128: // re_detect: "re-detect" ":" "boolean"
+#line 550 "dhcp6_parser.yy"
+                                   {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
 }
-#line 1187 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1199 "dhcp6_parser.cc"
     break;
 
-  case 129:
-#line 552 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 129: // $@26: %empty
+#line 556 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.LEASE_DATABASE);
 }
-#line 1198 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1210 "dhcp6_parser.cc"
     break;
 
-  case 130:
-#line 557 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 130: // lease_database: "lease-database" $@26 ":" "{" database_map_params "}"
+#line 561 "dhcp6_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1209 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1221 "dhcp6_parser.cc"
     break;
 
-  case 131:
-#line 564 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 131: // $@27: %empty
+#line 568 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1220 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1232 "dhcp6_parser.cc"
     break;
 
-  case 132:
-#line 569 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 132: // hosts_database: "hosts-database" $@27 ":" "{" database_map_params "}"
+#line 573 "dhcp6_parser.yy"
+                                                          {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1231 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1243 "dhcp6_parser.cc"
     break;
 
-  case 133:
-#line 576 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 133: // $@28: %empty
+#line 580 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1242 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1254 "dhcp6_parser.cc"
     break;
 
-  case 134:
-#line 581 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 134: // hosts_databases: "hosts-databases" $@28 ":" "[" database_list "]"
+#line 585 "dhcp6_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1251 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1263 "dhcp6_parser.cc"
     break;
 
-  case 139:
-#line 594 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 139: // $@29: %empty
+#line 598 "dhcp6_parser.yy"
+                         {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1261 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1273 "dhcp6_parser.cc"
     break;
 
-  case 140:
-#line 598 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 140: // database: "{" $@29 database_map_params "}"
+#line 602 "dhcp6_parser.yy"
+                                     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1271 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1283 "dhcp6_parser.cc"
     break;
 
-  case 161:
-#line 628 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 161: // $@30: %empty
+#line 632 "dhcp6_parser.yy"
+                    {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1279 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1291 "dhcp6_parser.cc"
     break;
 
-  case 162:
-#line 630 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 162: // database_type: "type" $@30 ":" db_type
+#line 634 "dhcp6_parser.yy"
+                {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1288 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1300 "dhcp6_parser.cc"
     break;
 
-  case 163:
-#line 635 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1294 "dhcp6_parser.cc" // lalr1.cc:907
+  case 163: // db_type: "memfile"
+#line 639 "dhcp6_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
+#line 1306 "dhcp6_parser.cc"
     break;
 
-  case 164:
-#line 636 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1300 "dhcp6_parser.cc" // lalr1.cc:907
+  case 164: // db_type: "mysql"
+#line 640 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
+#line 1312 "dhcp6_parser.cc"
     break;
 
-  case 165:
-#line 637 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1306 "dhcp6_parser.cc" // lalr1.cc:907
+  case 165: // db_type: "postgresql"
+#line 641 "dhcp6_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
+#line 1318 "dhcp6_parser.cc"
     break;
 
-  case 166:
-#line 638 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1312 "dhcp6_parser.cc" // lalr1.cc:907
+  case 166: // db_type: "cql"
+#line 642 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
+#line 1324 "dhcp6_parser.cc"
     break;
 
-  case 167:
-#line 641 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 167: // $@31: %empty
+#line 645 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1320 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1332 "dhcp6_parser.cc"
     break;
 
-  case 168:
-#line 643 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 168: // user: "user" $@31 ":" "constant string"
+#line 647 "dhcp6_parser.yy"
+               {
+    ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1330 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1342 "dhcp6_parser.cc"
     break;
 
-  case 169:
-#line 649 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 169: // $@32: %empty
+#line 653 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1338 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1350 "dhcp6_parser.cc"
     break;
 
-  case 170:
-#line 651 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 170: // password: "password" $@32 ":" "constant string"
+#line 655 "dhcp6_parser.yy"
+               {
+    ElementPtr pwd(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1348 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1360 "dhcp6_parser.cc"
     break;
 
-  case 171:
-#line 657 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 171: // $@33: %empty
+#line 661 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1356 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1368 "dhcp6_parser.cc"
     break;
 
-  case 172:
-#line 659 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 172: // host: "host" $@33 ":" "constant string"
+#line 663 "dhcp6_parser.yy"
+               {
+    ElementPtr h(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1366 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1378 "dhcp6_parser.cc"
     break;
 
-  case 173:
-#line 665 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 173: // port: "port" ":" "integer"
+#line 669 "dhcp6_parser.yy"
+                         {
+    ElementPtr p(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1375 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1387 "dhcp6_parser.cc"
     break;
 
-  case 174:
-#line 670 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 174: // $@34: %empty
+#line 674 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1383 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1395 "dhcp6_parser.cc"
     break;
 
-  case 175:
-#line 672 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 175: // name: "name" $@34 ":" "constant string"
+#line 676 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1393 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1405 "dhcp6_parser.cc"
     break;
 
-  case 176:
-#line 678 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 176: // persist: "persist" ":" "boolean"
+#line 682 "dhcp6_parser.yy"
+                               {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1402 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1414 "dhcp6_parser.cc"
     break;
 
-  case 177:
-#line 683 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 177: // lfc_interval: "lfc-interval" ":" "integer"
+#line 687 "dhcp6_parser.yy"
+                                         {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1411 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1423 "dhcp6_parser.cc"
     break;
 
-  case 178:
-#line 688 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 178: // readonly: "readonly" ":" "boolean"
+#line 692 "dhcp6_parser.yy"
+                                 {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1420 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1432 "dhcp6_parser.cc"
     break;
 
-  case 179:
-#line 693 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 179: // connect_timeout: "connect-timeout" ":" "integer"
+#line 697 "dhcp6_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1429 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1441 "dhcp6_parser.cc"
     break;
 
-  case 180:
-#line 698 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 180: // reconnect_wait_time: "reconnect-wait-time" ":" "integer"
+#line 702 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1438 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1450 "dhcp6_parser.cc"
     break;
 
-  case 181:
-#line 703 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 181: // request_timeout: "request-timeout" ":" "integer"
+#line 707 "dhcp6_parser.yy"
+                                               {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1447 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1459 "dhcp6_parser.cc"
     break;
 
-  case 182:
-#line 708 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 182: // tcp_keepalive: "tcp-keepalive" ":" "integer"
+#line 712 "dhcp6_parser.yy"
+                                           {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1456 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1468 "dhcp6_parser.cc"
     break;
 
-  case 183:
-#line 713 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 183: // tcp_nodelay: "tcp-nodelay" ":" "boolean"
+#line 717 "dhcp6_parser.yy"
+                                       {
+    ElementPtr n(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1465 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1477 "dhcp6_parser.cc"
     break;
 
-  case 184:
-#line 718 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 184: // $@35: %empty
+#line 722 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1473 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1485 "dhcp6_parser.cc"
     break;
 
-  case 185:
-#line 720 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 185: // contact_points: "contact-points" $@35 ":" "constant string"
+#line 724 "dhcp6_parser.yy"
+               {
+    ElementPtr cp(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1483 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1495 "dhcp6_parser.cc"
     break;
 
-  case 186:
-#line 726 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 186: // max_reconnect_tries: "max-reconnect-tries" ":" "integer"
+#line 730 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr n(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1492 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1504 "dhcp6_parser.cc"
     break;
 
-  case 187:
-#line 731 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 187: // $@36: %empty
+#line 735 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1500 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1512 "dhcp6_parser.cc"
     break;
 
-  case 188:
-#line 733 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 188: // keyspace: "keyspace" $@36 ":" "constant string"
+#line 737 "dhcp6_parser.yy"
+               {
+    ElementPtr ks(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1510 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1522 "dhcp6_parser.cc"
     break;
 
-  case 189:
-#line 739 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 189: // $@37: %empty
+#line 743 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SANITY_CHECKS);
 }
-#line 1521 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1533 "dhcp6_parser.cc"
     break;
 
-  case 190:
-#line 744 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 190: // sanity_checks: "sanity-checks" $@37 ":" "{" sanity_checks_params "}"
+#line 748 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1530 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1542 "dhcp6_parser.cc"
     break;
 
-  case 194:
-#line 754 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 194: // $@38: %empty
+#line 758 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1538 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1550 "dhcp6_parser.cc"
     break;
 
-  case 195:
-#line 756 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 195: // lease_checks: "lease-checks" $@38 ":" "constant string"
+#line 760 "dhcp6_parser.yy"
+               {
 
-    if ( (string(yystack_[0].value.as< std::string > ()) == "none") ||
-         (string(yystack_[0].value.as< std::string > ()) == "warn") ||
-         (string(yystack_[0].value.as< std::string > ()) == "fix") ||
-         (string(yystack_[0].value.as< std::string > ()) == "fix-del") ||
-         (string(yystack_[0].value.as< std::string > ()) == "del")) {
-        ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    if ( (string(yystack_[0].value.as < std::string > ()) == "none") ||
+         (string(yystack_[0].value.as < std::string > ()) == "warn") ||
+         (string(yystack_[0].value.as < std::string > ()) == "fix") ||
+         (string(yystack_[0].value.as < std::string > ()) == "fix-del") ||
+         (string(yystack_[0].value.as < std::string > ()) == "del")) {
+        ElementPtr user(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
         ctx.stack_.back()->set("lease-checks", user);
         ctx.leave();
     } else {
-        error(yystack_[0].location, "Unsupported 'lease-checks value: " + string(yystack_[0].value.as< std::string > ()) +
+        error(yystack_[0].location, "Unsupported 'lease-checks value: " + string(yystack_[0].value.as < std::string > ()) +
               ", supported values are: none, warn, fix, fix-del, del");
     }
 }
-#line 1558 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1570 "dhcp6_parser.cc"
     break;
 
-  case 196:
-#line 772 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 196: // $@39: %empty
+#line 776 "dhcp6_parser.yy"
+                         {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1569 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1581 "dhcp6_parser.cc"
     break;
 
-  case 197:
-#line 777 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 197: // mac_sources: "mac-sources" $@39 ":" "[" mac_sources_list "]"
+#line 781 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1578 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1590 "dhcp6_parser.cc"
     break;
 
-  case 202:
-#line 790 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 202: // duid_id: "duid"
+#line 794 "dhcp6_parser.yy"
+               {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1587 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1599 "dhcp6_parser.cc"
     break;
 
-  case 203:
-#line 795 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 203: // string_id: "constant string"
+#line 799 "dhcp6_parser.yy"
+                   {
+    ElementPtr duid(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1596 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1608 "dhcp6_parser.cc"
     break;
 
-  case 204:
-#line 800 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 204: // $@40: %empty
+#line 804 "dhcp6_parser.yy"
+                                                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1607 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1619 "dhcp6_parser.cc"
     break;
 
-  case 205:
-#line 805 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 205: // host_reservation_identifiers: "host-reservation-identifiers" $@40 ":" "[" host_reservation_identifiers_list "]"
+#line 809 "dhcp6_parser.yy"
+                                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1616 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1628 "dhcp6_parser.cc"
     break;
 
-  case 211:
-#line 819 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 211: // hw_address_id: "hw-address"
+#line 823 "dhcp6_parser.yy"
+                           {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1625 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1637 "dhcp6_parser.cc"
     break;
 
-  case 212:
-#line 824 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 212: // flex_id: "flex-id"
+#line 828 "dhcp6_parser.yy"
+                  {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1634 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1646 "dhcp6_parser.cc"
     break;
 
-  case 213:
-#line 831 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 213: // $@41: %empty
+#line 835 "dhcp6_parser.yy"
+                                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1645 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1657 "dhcp6_parser.cc"
     break;
 
-  case 214:
-#line 836 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 214: // relay_supplied_options: "relay-supplied-options" $@41 ":" "[" list_content "]"
+#line 840 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1654 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1666 "dhcp6_parser.cc"
     break;
 
-  case 215:
-#line 841 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 215: // $@42: %empty
+#line 845 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1665 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1677 "dhcp6_parser.cc"
     break;
 
-  case 216:
-#line 846 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 216: // hooks_libraries: "hooks-libraries" $@42 ":" "[" hooks_libraries_list "]"
+#line 850 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1674 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1686 "dhcp6_parser.cc"
     break;
 
-  case 221:
-#line 859 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 221: // $@43: %empty
+#line 863 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1684 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1696 "dhcp6_parser.cc"
     break;
 
-  case 222:
-#line 863 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 222: // hooks_library: "{" $@43 hooks_params "}"
+#line 867 "dhcp6_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1694 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1706 "dhcp6_parser.cc"
     break;
 
-  case 223:
-#line 869 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 223: // $@44: %empty
+#line 873 "dhcp6_parser.yy"
+                                  {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1704 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1716 "dhcp6_parser.cc"
     break;
 
-  case 224:
-#line 873 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 224: // sub_hooks_library: "{" $@44 hooks_params "}"
+#line 877 "dhcp6_parser.yy"
+                              {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1714 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1726 "dhcp6_parser.cc"
     break;
 
-  case 230:
-#line 888 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 230: // $@45: %empty
+#line 892 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1722 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1734 "dhcp6_parser.cc"
     break;
 
-  case 231:
-#line 890 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 231: // library: "library" $@45 ":" "constant string"
+#line 894 "dhcp6_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1732 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1744 "dhcp6_parser.cc"
     break;
 
-  case 232:
-#line 896 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 232: // $@46: %empty
+#line 900 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1740 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1752 "dhcp6_parser.cc"
     break;
 
-  case 233:
-#line 898 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 233: // parameters: "parameters" $@46 ":" value
+#line 902 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1749 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1761 "dhcp6_parser.cc"
     break;
 
-  case 234:
-#line 904 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 234: // $@47: %empty
+#line 908 "dhcp6_parser.yy"
+                                                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1760 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1772 "dhcp6_parser.cc"
     break;
 
-  case 235:
-#line 909 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 235: // expired_leases_processing: "expired-leases-processing" $@47 ":" "{" expired_leases_params "}"
+#line 913 "dhcp6_parser.yy"
+                                                            {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1770 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1782 "dhcp6_parser.cc"
     break;
 
-  case 244:
-#line 927 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 244: // reclaim_timer_wait_time: "reclaim-timer-wait-time" ":" "integer"
+#line 931 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1779 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1791 "dhcp6_parser.cc"
     break;
 
-  case 245:
-#line 932 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 245: // flush_reclaimed_timer_wait_time: "flush-reclaimed-timer-wait-time" ":" "integer"
+#line 936 "dhcp6_parser.yy"
+                                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1788 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1800 "dhcp6_parser.cc"
     break;
 
-  case 246:
-#line 937 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 246: // hold_reclaimed_time: "hold-reclaimed-time" ":" "integer"
+#line 941 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1797 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1809 "dhcp6_parser.cc"
     break;
 
-  case 247:
-#line 942 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 247: // max_reclaim_leases: "max-reclaim-leases" ":" "integer"
+#line 946 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1806 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1818 "dhcp6_parser.cc"
     break;
 
-  case 248:
-#line 947 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 248: // max_reclaim_time: "max-reclaim-time" ":" "integer"
+#line 951 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1815 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1827 "dhcp6_parser.cc"
     break;
 
-  case 249:
-#line 952 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 249: // unwarned_reclaim_cycles: "unwarned-reclaim-cycles" ":" "integer"
+#line 956 "dhcp6_parser.yy"
+                                                               {
+    ElementPtr value(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1824 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1836 "dhcp6_parser.cc"
     break;
 
-  case 250:
-#line 960 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 250: // $@48: %empty
+#line 964 "dhcp6_parser.yy"
+                      {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 1835 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1847 "dhcp6_parser.cc"
     break;
 
-  case 251:
-#line 965 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 251: // subnet6_list: "subnet6" $@48 ":" "[" subnet6_list_content "]"
+#line 969 "dhcp6_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1844 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1856 "dhcp6_parser.cc"
     break;
 
-  case 256:
-#line 985 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 256: // $@49: %empty
+#line 989 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1854 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1866 "dhcp6_parser.cc"
     break;
 
-  case 257:
-#line 989 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 257: // subnet6: "{" $@49 subnet6_params "}"
+#line 993 "dhcp6_parser.yy"
+                                {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
     // In particular we can do things like this:
@@ -1876,573 +1888,573 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1880 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1892 "dhcp6_parser.cc"
     break;
 
-  case 258:
-#line 1011 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 258: // $@50: %empty
+#line 1015 "dhcp6_parser.yy"
+                            {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1890 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1902 "dhcp6_parser.cc"
     break;
 
-  case 259:
-#line 1015 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 259: // sub_subnet6: "{" $@50 subnet6_params "}"
+#line 1019 "dhcp6_parser.yy"
+                                {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1900 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1912 "dhcp6_parser.cc"
     break;
 
-  case 282:
-#line 1049 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 282: // $@51: %empty
+#line 1053 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1908 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1920 "dhcp6_parser.cc"
     break;
 
-  case 283:
-#line 1051 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 283: // subnet: "subnet" $@51 ":" "constant string"
+#line 1055 "dhcp6_parser.yy"
+               {
+    ElementPtr subnet(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1918 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1930 "dhcp6_parser.cc"
     break;
 
-  case 284:
-#line 1057 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 284: // $@52: %empty
+#line 1061 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1926 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1938 "dhcp6_parser.cc"
     break;
 
-  case 285:
-#line 1059 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 285: // interface: "interface" $@52 ":" "constant string"
+#line 1063 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1936 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1948 "dhcp6_parser.cc"
     break;
 
-  case 286:
-#line 1065 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 286: // $@53: %empty
+#line 1069 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1944 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1956 "dhcp6_parser.cc"
     break;
 
-  case 287:
-#line 1067 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 287: // interface_id: "interface-id" $@53 ":" "constant string"
+#line 1071 "dhcp6_parser.yy"
+               {
+    ElementPtr iface(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1954 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1966 "dhcp6_parser.cc"
     break;
 
-  case 288:
-#line 1073 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 288: // $@54: %empty
+#line 1077 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1962 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1974 "dhcp6_parser.cc"
     break;
 
-  case 289:
-#line 1075 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 289: // client_class: "client-class" $@54 ":" "constant string"
+#line 1079 "dhcp6_parser.yy"
+               {
+    ElementPtr cls(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1972 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1984 "dhcp6_parser.cc"
     break;
 
-  case 290:
-#line 1081 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 290: // $@55: %empty
+#line 1085 "dhcp6_parser.yy"
+                                               {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1983 "dhcp6_parser.cc" // lalr1.cc:907
+#line 1995 "dhcp6_parser.cc"
     break;
 
-  case 291:
-#line 1086 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 291: // require_client_classes: "require-client-classes" $@55 ":" list_strings
+#line 1090 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1992 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2004 "dhcp6_parser.cc"
     break;
 
-  case 292:
-#line 1091 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 292: // $@56: %empty
+#line 1095 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2000 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2012 "dhcp6_parser.cc"
     break;
 
-  case 293:
-#line 1093 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
+  case 293: // reservation_mode: "reservation-mode" $@56 ":" hr_mode
+#line 1097 "dhcp6_parser.yy"
+                {
+    ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2009 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2021 "dhcp6_parser.cc"
     break;
 
-  case 294:
-#line 1098 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2015 "dhcp6_parser.cc" // lalr1.cc:907
+  case 294: // hr_mode: "disabled"
+#line 1102 "dhcp6_parser.yy"
+                  { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
+#line 2027 "dhcp6_parser.cc"
     break;
 
-  case 295:
-#line 1099 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2021 "dhcp6_parser.cc" // lalr1.cc:907
+  case 295: // hr_mode: "out-of-pool"
+#line 1103 "dhcp6_parser.yy"
+                     { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
+#line 2033 "dhcp6_parser.cc"
     break;
 
-  case 296:
-#line 1100 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2027 "dhcp6_parser.cc" // lalr1.cc:907
+  case 296: // hr_mode: "global"
+#line 1104 "dhcp6_parser.yy"
+                { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
+#line 2039 "dhcp6_parser.cc"
     break;
 
-  case 297:
-#line 1101 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2033 "dhcp6_parser.cc" // lalr1.cc:907
+  case 297: // hr_mode: "all"
+#line 1105 "dhcp6_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
+#line 2045 "dhcp6_parser.cc"
     break;
 
-  case 298:
-#line 1104 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 298: // id: "id" ":" "integer"
+#line 1108 "dhcp6_parser.yy"
+                     {
+    ElementPtr id(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2042 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2054 "dhcp6_parser.cc"
     break;
 
-  case 299:
-#line 1109 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 299: // rapid_commit: "rapid-commit" ":" "boolean"
+#line 1113 "dhcp6_parser.yy"
+                                         {
+    ElementPtr rc(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 2051 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2063 "dhcp6_parser.cc"
     break;
 
-  case 300:
-#line 1117 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 300: // $@57: %empty
+#line 1121 "dhcp6_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2062 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2074 "dhcp6_parser.cc"
     break;
 
-  case 301:
-#line 1122 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 301: // shared_networks: "shared-networks" $@57 ":" "[" shared_networks_content "]"
+#line 1126 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2071 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2083 "dhcp6_parser.cc"
     break;
 
-  case 306:
-#line 1137 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 306: // $@58: %empty
+#line 1141 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2081 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2093 "dhcp6_parser.cc"
     break;
 
-  case 307:
-#line 1141 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 307: // shared_network: "{" $@58 shared_network_params "}"
+#line 1145 "dhcp6_parser.yy"
+                                       {
     ctx.stack_.pop_back();
 }
-#line 2089 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2101 "dhcp6_parser.cc"
     break;
 
-  case 327:
-#line 1172 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 327: // $@59: %empty
+#line 1176 "dhcp6_parser.yy"
+                            {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2100 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2112 "dhcp6_parser.cc"
     break;
 
-  case 328:
-#line 1177 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 328: // option_def_list: "option-def" $@59 ":" "[" option_def_list_content "]"
+#line 1181 "dhcp6_parser.yy"
+                                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2109 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2121 "dhcp6_parser.cc"
     break;
 
-  case 329:
-#line 1185 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 329: // $@60: %empty
+#line 1189 "dhcp6_parser.yy"
+                                    {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2118 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2130 "dhcp6_parser.cc"
     break;
 
-  case 330:
-#line 1188 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 330: // sub_option_def_list: "{" $@60 option_def_list "}"
+#line 1192 "dhcp6_parser.yy"
+                                 {
     // parsing completed
 }
-#line 2126 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2138 "dhcp6_parser.cc"
     break;
 
-  case 335:
-#line 1204 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 335: // $@61: %empty
+#line 1208 "dhcp6_parser.yy"
+                                 {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2136 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2148 "dhcp6_parser.cc"
     break;
 
-  case 336:
-#line 1208 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 336: // option_def_entry: "{" $@61 option_def_params "}"
+#line 1212 "dhcp6_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2148 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2160 "dhcp6_parser.cc"
     break;
 
-  case 337:
-#line 1219 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 337: // $@62: %empty
+#line 1223 "dhcp6_parser.yy"
+                               {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2158 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2170 "dhcp6_parser.cc"
     break;
 
-  case 338:
-#line 1223 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 338: // sub_option_def: "{" $@62 option_def_params "}"
+#line 1227 "dhcp6_parser.yy"
+                                   {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("code", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2170 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2182 "dhcp6_parser.cc"
     break;
 
-  case 354:
-#line 1255 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 354: // code: "code" ":" "integer"
+#line 1259 "dhcp6_parser.yy"
+                         {
+    ElementPtr code(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2179 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2191 "dhcp6_parser.cc"
     break;
 
-  case 356:
-#line 1262 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 356: // $@63: %empty
+#line 1266 "dhcp6_parser.yy"
+                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2187 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2199 "dhcp6_parser.cc"
     break;
 
-  case 357:
-#line 1264 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 357: // option_def_type: "type" $@63 ":" "constant string"
+#line 1268 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2197 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2209 "dhcp6_parser.cc"
     break;
 
-  case 358:
-#line 1270 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 358: // $@64: %empty
+#line 1274 "dhcp6_parser.yy"
+                                      {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2205 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2217 "dhcp6_parser.cc"
     break;
 
-  case 359:
-#line 1272 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 359: // option_def_record_types: "record-types" $@64 ":" "constant string"
+#line 1276 "dhcp6_parser.yy"
+               {
+    ElementPtr rtypes(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2215 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2227 "dhcp6_parser.cc"
     break;
 
-  case 360:
-#line 1278 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 360: // $@65: %empty
+#line 1282 "dhcp6_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2223 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2235 "dhcp6_parser.cc"
     break;
 
-  case 361:
-#line 1280 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 361: // space: "space" $@65 ":" "constant string"
+#line 1284 "dhcp6_parser.yy"
+               {
+    ElementPtr space(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2233 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2245 "dhcp6_parser.cc"
     break;
 
-  case 363:
-#line 1288 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 363: // $@66: %empty
+#line 1292 "dhcp6_parser.yy"
+                                    {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2241 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2253 "dhcp6_parser.cc"
     break;
 
-  case 364:
-#line 1290 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 364: // option_def_encapsulate: "encapsulate" $@66 ":" "constant string"
+#line 1294 "dhcp6_parser.yy"
+               {
+    ElementPtr encap(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2251 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2263 "dhcp6_parser.cc"
     break;
 
-  case 365:
-#line 1296 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 365: // option_def_array: "array" ":" "boolean"
+#line 1300 "dhcp6_parser.yy"
+                                      {
+    ElementPtr array(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2260 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2272 "dhcp6_parser.cc"
     break;
 
-  case 366:
-#line 1305 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 366: // $@67: %empty
+#line 1309 "dhcp6_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2271 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2283 "dhcp6_parser.cc"
     break;
 
-  case 367:
-#line 1310 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 367: // option_data_list: "option-data" $@67 ":" "[" option_data_list_content "]"
+#line 1314 "dhcp6_parser.yy"
+                                                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2280 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2292 "dhcp6_parser.cc"
     break;
 
-  case 372:
-#line 1329 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 372: // $@68: %empty
+#line 1333 "dhcp6_parser.yy"
+                                  {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2290 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2302 "dhcp6_parser.cc"
     break;
 
-  case 373:
-#line 1333 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 373: // option_data_entry: "{" $@68 option_data_params "}"
+#line 1337 "dhcp6_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2299 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2311 "dhcp6_parser.cc"
     break;
 
-  case 374:
-#line 1341 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 374: // $@69: %empty
+#line 1345 "dhcp6_parser.yy"
+                                {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2309 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2321 "dhcp6_parser.cc"
     break;
 
-  case 375:
-#line 1345 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 375: // sub_option_data: "{" $@69 option_data_params "}"
+#line 1349 "dhcp6_parser.yy"
+                                    {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2318 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2330 "dhcp6_parser.cc"
     break;
 
-  case 390:
-#line 1378 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 390: // $@70: %empty
+#line 1382 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2326 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2338 "dhcp6_parser.cc"
     break;
 
-  case 391:
-#line 1380 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 391: // option_data_data: "data" $@70 ":" "constant string"
+#line 1384 "dhcp6_parser.yy"
+               {
+    ElementPtr data(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2336 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2348 "dhcp6_parser.cc"
     break;
 
-  case 394:
-#line 1390 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 394: // option_data_csv_format: "csv-format" ":" "boolean"
+#line 1394 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr space(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2345 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2357 "dhcp6_parser.cc"
     break;
 
-  case 395:
-#line 1395 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 395: // option_data_always_send: "always-send" ":" "boolean"
+#line 1399 "dhcp6_parser.yy"
+                                                   {
+    ElementPtr persist(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2354 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2366 "dhcp6_parser.cc"
     break;
 
-  case 396:
-#line 1403 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 396: // $@71: %empty
+#line 1407 "dhcp6_parser.yy"
+                  {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2365 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2377 "dhcp6_parser.cc"
     break;
 
-  case 397:
-#line 1408 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 397: // pools_list: "pools" $@71 ":" "[" pools_list_content "]"
+#line 1412 "dhcp6_parser.yy"
+                                                           {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2374 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2386 "dhcp6_parser.cc"
     break;
 
-  case 402:
-#line 1423 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 402: // $@72: %empty
+#line 1427 "dhcp6_parser.yy"
+                                {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2384 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2396 "dhcp6_parser.cc"
     break;
 
-  case 403:
-#line 1427 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 403: // pool_list_entry: "{" $@72 pool_params "}"
+#line 1431 "dhcp6_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2394 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2406 "dhcp6_parser.cc"
     break;
 
-  case 404:
-#line 1433 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 404: // $@73: %empty
+#line 1437 "dhcp6_parser.yy"
+                          {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2404 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2416 "dhcp6_parser.cc"
     break;
 
-  case 405:
-#line 1437 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 405: // sub_pool6: "{" $@73 pool_params "}"
+#line 1441 "dhcp6_parser.yy"
+                             {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
 }
-#line 2413 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2425 "dhcp6_parser.cc"
     break;
 
-  case 415:
-#line 1455 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 415: // $@74: %empty
+#line 1459 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2421 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2433 "dhcp6_parser.cc"
     break;
 
-  case 416:
-#line 1457 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 416: // pool_entry: "pool" $@74 ":" "constant string"
+#line 1461 "dhcp6_parser.yy"
+               {
+    ElementPtr pool(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2431 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2443 "dhcp6_parser.cc"
     break;
 
-  case 417:
-#line 1463 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 417: // $@75: %empty
+#line 1467 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2439 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2451 "dhcp6_parser.cc"
     break;
 
-  case 418:
-#line 1465 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 418: // user_context: "user-context" $@75 ":" map_value
+#line 1469 "dhcp6_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
-    ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
+    ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
 
     // Handle already existing user context
@@ -2462,23 +2474,23 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2466 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2478 "dhcp6_parser.cc"
     break;
 
-  case 419:
-#line 1488 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 419: // $@76: %empty
+#line 1492 "dhcp6_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2474 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2486 "dhcp6_parser.cc"
     break;
 
-  case 420:
-#line 1490 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 420: // comment: "comment" $@76 ":" "constant string"
+#line 1494 "dhcp6_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
-    ElementPtr comment(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     user_context->set("comment", comment);
 
     // Handle already existing user context
@@ -2499,610 +2511,610 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2503 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2515 "dhcp6_parser.cc"
     break;
 
-  case 421:
-#line 1518 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 421: // $@77: %empty
+#line 1522 "dhcp6_parser.yy"
+                        {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2514 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2526 "dhcp6_parser.cc"
     break;
 
-  case 422:
-#line 1523 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 422: // pd_pools_list: "pd-pools" $@77 ":" "[" pd_pools_list_content "]"
+#line 1527 "dhcp6_parser.yy"
+                                                              {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2523 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2535 "dhcp6_parser.cc"
     break;
 
-  case 427:
-#line 1538 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 427: // $@78: %empty
+#line 1542 "dhcp6_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2533 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2545 "dhcp6_parser.cc"
     break;
 
-  case 428:
-#line 1542 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 428: // pd_pool_entry: "{" $@78 pd_pool_params "}"
+#line 1546 "dhcp6_parser.yy"
+                                {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("prefix-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2545 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2557 "dhcp6_parser.cc"
     break;
 
-  case 429:
-#line 1550 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 429: // $@79: %empty
+#line 1554 "dhcp6_parser.yy"
+                            {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2555 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2567 "dhcp6_parser.cc"
     break;
 
-  case 430:
-#line 1554 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 430: // sub_pd_pool: "{" $@79 pd_pool_params "}"
+#line 1558 "dhcp6_parser.yy"
+                                {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("prefix-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.require("delegated-len", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2567 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2579 "dhcp6_parser.cc"
     break;
 
-  case 444:
-#line 1579 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 444: // $@80: %empty
+#line 1583 "dhcp6_parser.yy"
+                  {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2575 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2587 "dhcp6_parser.cc"
     break;
 
-  case 445:
-#line 1581 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 445: // pd_prefix: "prefix" $@80 ":" "constant string"
+#line 1585 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2585 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2597 "dhcp6_parser.cc"
     break;
 
-  case 446:
-#line 1587 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 446: // pd_prefix_len: "prefix-len" ":" "integer"
+#line 1591 "dhcp6_parser.yy"
+                                        {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2594 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2606 "dhcp6_parser.cc"
     break;
 
-  case 447:
-#line 1592 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 447: // $@81: %empty
+#line 1596 "dhcp6_parser.yy"
+                                 {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2602 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2614 "dhcp6_parser.cc"
     break;
 
-  case 448:
-#line 1594 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 448: // excluded_prefix: "excluded-prefix" $@81 ":" "constant string"
+#line 1598 "dhcp6_parser.yy"
+               {
+    ElementPtr prf(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2612 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2624 "dhcp6_parser.cc"
     break;
 
-  case 449:
-#line 1600 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 449: // excluded_prefix_len: "excluded-prefix-len" ":" "integer"
+#line 1604 "dhcp6_parser.yy"
+                                                       {
+    ElementPtr prf(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2621 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2633 "dhcp6_parser.cc"
     break;
 
-  case 450:
-#line 1605 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 450: // pd_delegated_len: "delegated-len" ":" "integer"
+#line 1609 "dhcp6_parser.yy"
+                                              {
+    ElementPtr deleg(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2630 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2642 "dhcp6_parser.cc"
     break;
 
-  case 451:
-#line 1613 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 451: // $@82: %empty
+#line 1617 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2641 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2653 "dhcp6_parser.cc"
     break;
 
-  case 452:
-#line 1618 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 452: // reservations: "reservations" $@82 ":" "[" reservations_list "]"
+#line 1622 "dhcp6_parser.yy"
+                                                          {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2650 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2662 "dhcp6_parser.cc"
     break;
 
-  case 457:
-#line 1631 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 457: // $@83: %empty
+#line 1635 "dhcp6_parser.yy"
+                            {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2660 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2672 "dhcp6_parser.cc"
     break;
 
-  case 458:
-#line 1635 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 458: // reservation: "{" $@83 reservation_params "}"
+#line 1639 "dhcp6_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2669 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2681 "dhcp6_parser.cc"
     break;
 
-  case 459:
-#line 1640 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 459: // $@84: %empty
+#line 1644 "dhcp6_parser.yy"
+                                {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2679 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2691 "dhcp6_parser.cc"
     break;
 
-  case 460:
-#line 1644 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 460: // sub_reservation: "{" $@84 reservation_params "}"
+#line 1648 "dhcp6_parser.yy"
+                                    {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2688 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2700 "dhcp6_parser.cc"
     break;
 
-  case 476:
-#line 1671 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 476: // $@85: %empty
+#line 1675 "dhcp6_parser.yy"
+                           {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2699 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2711 "dhcp6_parser.cc"
     break;
 
-  case 477:
-#line 1676 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 477: // ip_addresses: "ip-addresses" $@85 ":" list_strings
+#line 1680 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2708 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2720 "dhcp6_parser.cc"
     break;
 
-  case 478:
-#line 1681 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 478: // $@86: %empty
+#line 1685 "dhcp6_parser.yy"
+                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2719 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2731 "dhcp6_parser.cc"
     break;
 
-  case 479:
-#line 1686 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 479: // prefixes: "prefixes" $@86 ":" list_strings
+#line 1690 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2728 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2740 "dhcp6_parser.cc"
     break;
 
-  case 480:
-#line 1691 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 480: // $@87: %empty
+#line 1695 "dhcp6_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2736 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2748 "dhcp6_parser.cc"
     break;
 
-  case 481:
-#line 1693 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 481: // duid: "duid" $@87 ":" "constant string"
+#line 1697 "dhcp6_parser.yy"
+               {
+    ElementPtr d(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2746 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2758 "dhcp6_parser.cc"
     break;
 
-  case 482:
-#line 1699 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 482: // $@88: %empty
+#line 1703 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2754 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2766 "dhcp6_parser.cc"
     break;
 
-  case 483:
-#line 1701 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 483: // hw_address: "hw-address" $@88 ":" "constant string"
+#line 1705 "dhcp6_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2764 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2776 "dhcp6_parser.cc"
     break;
 
-  case 484:
-#line 1707 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 484: // $@89: %empty
+#line 1711 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2772 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2784 "dhcp6_parser.cc"
     break;
 
-  case 485:
-#line 1709 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 485: // hostname: "hostname" $@89 ":" "constant string"
+#line 1713 "dhcp6_parser.yy"
+               {
+    ElementPtr host(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2782 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2794 "dhcp6_parser.cc"
     break;
 
-  case 486:
-#line 1715 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 486: // $@90: %empty
+#line 1719 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2790 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2802 "dhcp6_parser.cc"
     break;
 
-  case 487:
-#line 1717 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 487: // flex_id_value: "flex-id" $@90 ":" "constant string"
+#line 1721 "dhcp6_parser.yy"
+               {
+    ElementPtr hw(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2800 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2812 "dhcp6_parser.cc"
     break;
 
-  case 488:
-#line 1723 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 488: // $@91: %empty
+#line 1727 "dhcp6_parser.yy"
+                                           {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2811 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2823 "dhcp6_parser.cc"
     break;
 
-  case 489:
-#line 1728 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 489: // reservation_client_classes: "client-classes" $@91 ":" list_strings
+#line 1732 "dhcp6_parser.yy"
+                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2820 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2832 "dhcp6_parser.cc"
     break;
 
-  case 490:
-#line 1736 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 490: // $@92: %empty
+#line 1740 "dhcp6_parser.yy"
+             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2831 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2843 "dhcp6_parser.cc"
     break;
 
-  case 491:
-#line 1741 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 491: // relay: "relay" $@92 ":" "{" relay_map "}"
+#line 1745 "dhcp6_parser.yy"
+                                                {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2840 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2852 "dhcp6_parser.cc"
     break;
 
-  case 494:
-#line 1750 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 494: // $@93: %empty
+#line 1754 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2848 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2860 "dhcp6_parser.cc"
     break;
 
-  case 495:
-#line 1752 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 495: // ip_address: "ip-address" $@93 ":" "constant string"
+#line 1756 "dhcp6_parser.yy"
+               {
+    ElementPtr addr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2858 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2870 "dhcp6_parser.cc"
     break;
 
-  case 496:
-#line 1761 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 496: // $@94: %empty
+#line 1765 "dhcp6_parser.yy"
+                               {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2869 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2881 "dhcp6_parser.cc"
     break;
 
-  case 497:
-#line 1766 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 497: // client_classes: "client-classes" $@94 ":" "[" client_classes_list "]"
+#line 1770 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2878 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2890 "dhcp6_parser.cc"
     break;
 
-  case 500:
-#line 1775 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 500: // $@95: %empty
+#line 1779 "dhcp6_parser.yy"
+                                   {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2888 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2900 "dhcp6_parser.cc"
     break;
 
-  case 501:
-#line 1779 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 501: // client_class_entry: "{" $@95 client_class_params "}"
+#line 1783 "dhcp6_parser.yy"
+                                     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2898 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2910 "dhcp6_parser.cc"
     break;
 
-  case 514:
-#line 1804 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 514: // $@96: %empty
+#line 1808 "dhcp6_parser.yy"
+                        {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2906 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2918 "dhcp6_parser.cc"
     break;
 
-  case 515:
-#line 1806 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 515: // client_class_test: "test" $@96 ":" "constant string"
+#line 1810 "dhcp6_parser.yy"
+               {
+    ElementPtr test(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2916 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2928 "dhcp6_parser.cc"
     break;
 
-  case 516:
-#line 1812 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 516: // only_if_required: "only-if-required" ":" "boolean"
+#line 1816 "dhcp6_parser.yy"
+                                                 {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 2925 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2937 "dhcp6_parser.cc"
     break;
 
-  case 517:
-#line 1820 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 517: // $@97: %empty
+#line 1824 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 2936 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2948 "dhcp6_parser.cc"
     break;
 
-  case 518:
-#line 1825 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 518: // server_id: "server-id" $@97 ":" "{" server_id_params "}"
+#line 1829 "dhcp6_parser.yy"
+                                                       {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2947 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2959 "dhcp6_parser.cc"
     break;
 
-  case 530:
-#line 1847 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 530: // $@98: %empty
+#line 1851 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 2955 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2967 "dhcp6_parser.cc"
     break;
 
-  case 531:
-#line 1849 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
+  case 531: // server_id_type: "type" $@98 ":" duid_type
+#line 1853 "dhcp6_parser.yy"
+                  {
+    ctx.stack_.back()->set("type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 2964 "dhcp6_parser.cc" // lalr1.cc:907
+#line 2976 "dhcp6_parser.cc"
     break;
 
-  case 532:
-#line 1854 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 2970 "dhcp6_parser.cc" // lalr1.cc:907
+  case 532: // duid_type: "LLT"
+#line 1858 "dhcp6_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
+#line 2982 "dhcp6_parser.cc"
     break;
 
-  case 533:
-#line 1855 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 2976 "dhcp6_parser.cc" // lalr1.cc:907
+  case 533: // duid_type: "EN"
+#line 1859 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
+#line 2988 "dhcp6_parser.cc"
     break;
 
-  case 534:
-#line 1856 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 2982 "dhcp6_parser.cc" // lalr1.cc:907
+  case 534: // duid_type: "LL"
+#line 1860 "dhcp6_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
+#line 2994 "dhcp6_parser.cc"
     break;
 
-  case 535:
-#line 1859 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 535: // htype: "htype" ":" "integer"
+#line 1863 "dhcp6_parser.yy"
+                           {
+    ElementPtr htype(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 2991 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3003 "dhcp6_parser.cc"
     break;
 
-  case 536:
-#line 1864 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 536: // $@99: %empty
+#line 1868 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2999 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3011 "dhcp6_parser.cc"
     break;
 
-  case 537:
-#line 1866 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 537: // identifier: "identifier" $@99 ":" "constant string"
+#line 1870 "dhcp6_parser.yy"
+               {
+    ElementPtr id(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 3009 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3021 "dhcp6_parser.cc"
     break;
 
-  case 538:
-#line 1872 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 538: // time: "time" ":" "integer"
+#line 1876 "dhcp6_parser.yy"
+                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 3018 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3030 "dhcp6_parser.cc"
     break;
 
-  case 539:
-#line 1877 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 539: // enterprise_id: "enterprise-id" ":" "integer"
+#line 1881 "dhcp6_parser.yy"
+                                           {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 3027 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3039 "dhcp6_parser.cc"
     break;
 
-  case 540:
-#line 1884 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 540: // dhcp4o6_port: "dhcp4o6-port" ":" "integer"
+#line 1888 "dhcp6_parser.yy"
+                                         {
+    ElementPtr time(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 3036 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3048 "dhcp6_parser.cc"
     break;
 
-  case 541:
-#line 1891 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 541: // $@100: %empty
+#line 1895 "dhcp6_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 3047 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3059 "dhcp6_parser.cc"
     break;
 
-  case 542:
-#line 1896 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 542: // control_socket: "control-socket" $@100 ":" "{" control_socket_params "}"
+#line 1900 "dhcp6_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3056 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3068 "dhcp6_parser.cc"
     break;
 
-  case 550:
-#line 1912 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 550: // $@101: %empty
+#line 1916 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3064 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3076 "dhcp6_parser.cc"
     break;
 
-  case 551:
-#line 1914 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 551: // socket_type: "socket-type" $@101 ":" "constant string"
+#line 1918 "dhcp6_parser.yy"
+               {
+    ElementPtr stype(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 3074 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3086 "dhcp6_parser.cc"
     break;
 
-  case 552:
-#line 1920 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 552: // $@102: %empty
+#line 1924 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3082 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3094 "dhcp6_parser.cc"
     break;
 
-  case 553:
-#line 1922 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 553: // socket_name: "socket-name" $@102 ":" "constant string"
+#line 1926 "dhcp6_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 3092 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3104 "dhcp6_parser.cc"
     break;
 
-  case 554:
-#line 1930 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 554: // $@103: %empty
+#line 1934 "dhcp6_parser.yy"
+                                       {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3100 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3112 "dhcp6_parser.cc"
     break;
 
-  case 555:
-#line 1932 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr qc = yystack_[0].value.as< ElementPtr > ();
+  case 555: // dhcp_queue_control: "dhcp-queue-control" $@103 ":" map_value
+#line 1936 "dhcp6_parser.yy"
+                  {
+    ElementPtr qc = yystack_[0].value.as < ElementPtr > ();
     ctx.stack_.back()->set("dhcp-queue-control", qc);
 
     // Doing this manually, because dhcp-queue-control
@@ -3136,617 +3148,672 @@ namespace isc { namespace dhcp {
 
     ctx.leave();
 }
-#line 3140 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3152 "dhcp6_parser.cc"
     break;
 
-  case 556:
-#line 1970 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 556: // $@104: %empty
+#line 1974 "dhcp6_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 3151 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3163 "dhcp6_parser.cc"
     break;
 
-  case 557:
-#line 1975 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 557: // dhcp_ddns: "dhcp-ddns" $@104 ":" "{" dhcp_ddns_params "}"
+#line 1979 "dhcp6_parser.yy"
+                                                       {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3162 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3174 "dhcp6_parser.cc"
     break;
 
-  case 558:
-#line 1982 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 558: // $@105: %empty
+#line 1986 "dhcp6_parser.yy"
+                              {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3172 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3184 "dhcp6_parser.cc"
     break;
 
-  case 559:
-#line 1986 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 559: // sub_dhcp_ddns: "{" $@105 dhcp_ddns_params "}"
+#line 1990 "dhcp6_parser.yy"
+                                  {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3182 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3194 "dhcp6_parser.cc"
     break;
 
-  case 580:
-#line 2016 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 580: // enable_updates: "enable-updates" ":" "boolean"
+#line 2020 "dhcp6_parser.yy"
+                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3191 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3203 "dhcp6_parser.cc"
     break;
 
-  case 581:
-#line 2021 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 581: // $@106: %empty
+#line 2025 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3199 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3211 "dhcp6_parser.cc"
     break;
 
-  case 582:
-#line 2023 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 582: // qualifying_suffix: "qualifying-suffix" $@106 ":" "constant string"
+#line 2027 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3209 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3221 "dhcp6_parser.cc"
     break;
 
-  case 583:
-#line 2029 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 583: // $@107: %empty
+#line 2033 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3217 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3229 "dhcp6_parser.cc"
     break;
 
-  case 584:
-#line 2031 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 584: // server_ip: "server-ip" $@107 ":" "constant string"
+#line 2035 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3227 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3239 "dhcp6_parser.cc"
     break;
 
-  case 585:
-#line 2037 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 585: // server_port: "server-port" ":" "integer"
+#line 2041 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3236 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3248 "dhcp6_parser.cc"
     break;
 
-  case 586:
-#line 2042 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 586: // $@108: %empty
+#line 2046 "dhcp6_parser.yy"
+                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3244 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3256 "dhcp6_parser.cc"
     break;
 
-  case 587:
-#line 2044 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 587: // sender_ip: "sender-ip" $@108 ":" "constant string"
+#line 2048 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3254 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3266 "dhcp6_parser.cc"
     break;
 
-  case 588:
-#line 2050 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 588: // sender_port: "sender-port" ":" "integer"
+#line 2054 "dhcp6_parser.yy"
+                                       {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3263 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3275 "dhcp6_parser.cc"
     break;
 
-  case 589:
-#line 2055 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 589: // max_queue_size: "max-queue-size" ":" "integer"
+#line 2059 "dhcp6_parser.yy"
+                                             {
+    ElementPtr i(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3272 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3284 "dhcp6_parser.cc"
     break;
 
-  case 590:
-#line 2060 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 590: // $@109: %empty
+#line 2064 "dhcp6_parser.yy"
+                           {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3280 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3292 "dhcp6_parser.cc"
     break;
 
-  case 591:
-#line 2062 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
+  case 591: // ncr_protocol: "ncr-protocol" $@109 ":" ncr_protocol_value
+#line 2066 "dhcp6_parser.yy"
+                           {
+    ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3289 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3301 "dhcp6_parser.cc"
     break;
 
-  case 592:
-#line 2068 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3295 "dhcp6_parser.cc" // lalr1.cc:907
+  case 592: // ncr_protocol_value: "UDP"
+#line 2072 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
+#line 3307 "dhcp6_parser.cc"
     break;
 
-  case 593:
-#line 2069 "dhcp6_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3301 "dhcp6_parser.cc" // lalr1.cc:907
+  case 593: // ncr_protocol_value: "TCP"
+#line 2073 "dhcp6_parser.yy"
+        { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
+#line 3313 "dhcp6_parser.cc"
     break;
 
-  case 594:
-#line 2072 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 594: // $@110: %empty
+#line 2076 "dhcp6_parser.yy"
+                       {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3309 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3321 "dhcp6_parser.cc"
     break;
 
-  case 595:
-#line 2074 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 595: // ncr_format: "ncr-format" $@110 ":" "JSON"
+#line 2078 "dhcp6_parser.yy"
+             {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3319 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3331 "dhcp6_parser.cc"
     break;
 
-  case 596:
-#line 2080 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 596: // override_no_update: "override-no-update" ":" "boolean"
+#line 2084 "dhcp6_parser.yy"
+                                                     {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3328 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3340 "dhcp6_parser.cc"
     break;
 
-  case 597:
-#line 2085 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 597: // override_client_update: "override-client-update" ":" "boolean"
+#line 2089 "dhcp6_parser.yy"
+                                                             {
+    ElementPtr b(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3337 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3349 "dhcp6_parser.cc"
     break;
 
-  case 598:
-#line 2090 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 598: // $@111: %empty
+#line 2094 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3345 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3357 "dhcp6_parser.cc"
     break;
 
-  case 599:
-#line 2092 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
+  case 599: // replace_client_name: "replace-client-name" $@111 ":" replace_client_name_value
+#line 2096 "dhcp6_parser.yy"
+                                  {
+    ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3354 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3366 "dhcp6_parser.cc"
     break;
 
-  case 600:
-#line 2098 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
+  case 600: // replace_client_name_value: "when-present"
+#line 2102 "dhcp6_parser.yy"
+                 {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3362 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3374 "dhcp6_parser.cc"
     break;
 
-  case 601:
-#line 2101 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
+  case 601: // replace_client_name_value: "never"
+#line 2105 "dhcp6_parser.yy"
+          {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3370 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3382 "dhcp6_parser.cc"
     break;
 
-  case 602:
-#line 2104 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
+  case 602: // replace_client_name_value: "always"
+#line 2108 "dhcp6_parser.yy"
+           {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3378 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3390 "dhcp6_parser.cc"
     break;
 
-  case 603:
-#line 2107 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-      yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
+  case 603: // replace_client_name_value: "when-not-present"
+#line 2111 "dhcp6_parser.yy"
+                     {
+      yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3386 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3398 "dhcp6_parser.cc"
     break;
 
-  case 604:
-#line 2110 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 604: // replace_client_name_value: "boolean"
+#line 2114 "dhcp6_parser.yy"
+             {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 3395 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3407 "dhcp6_parser.cc"
     break;
 
-  case 605:
-#line 2116 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 605: // $@112: %empty
+#line 2120 "dhcp6_parser.yy"
+                                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3403 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3415 "dhcp6_parser.cc"
     break;
 
-  case 606:
-#line 2118 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 606: // generated_prefix: "generated-prefix" $@112 ":" "constant string"
+#line 2122 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3413 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3425 "dhcp6_parser.cc"
     break;
 
-  case 607:
-#line 2124 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 607: // $@113: %empty
+#line 2128 "dhcp6_parser.yy"
+                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3421 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3433 "dhcp6_parser.cc"
     break;
 
-  case 608:
-#line 2126 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 608: // hostname_char_set: "hostname-char-set" $@113 ":" "constant string"
+#line 2130 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3431 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3443 "dhcp6_parser.cc"
     break;
 
-  case 609:
-#line 2132 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 609: // $@114: %empty
+#line 2136 "dhcp6_parser.yy"
+                                                     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3439 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3451 "dhcp6_parser.cc"
     break;
 
-  case 610:
-#line 2134 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 610: // hostname_char_replacement: "hostname-char-replacement" $@114 ":" "constant string"
+#line 2138 "dhcp6_parser.yy"
+               {
+    ElementPtr s(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3449 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3461 "dhcp6_parser.cc"
     break;
 
-  case 611:
-#line 2142 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 611: // $@115: %empty
+#line 2146 "dhcp6_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3457 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3469 "dhcp6_parser.cc"
     break;
 
-  case 612:
-#line 2144 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
+  case 612: // dhcp4_json_object: "Dhcp4" $@115 ":" value
+#line 2148 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3466 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3478 "dhcp6_parser.cc"
     break;
 
-  case 613:
-#line 2149 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 613: // $@116: %empty
+#line 2153 "dhcp6_parser.yy"
+                               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3474 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3486 "dhcp6_parser.cc"
     break;
 
-  case 614:
-#line 2151 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
+  case 614: // dhcpddns_json_object: "DhcpDdns" $@116 ":" value
+#line 2155 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3483 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3495 "dhcp6_parser.cc"
     break;
 
-  case 615:
-#line 2156 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 615: // $@117: %empty
+#line 2160 "dhcp6_parser.yy"
+                                         {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3491 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3503 "dhcp6_parser.cc"
     break;
 
-  case 616:
-#line 2158 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
+  case 616: // control_agent_json_object: "Control-agent" $@117 ":" value
+#line 2162 "dhcp6_parser.yy"
+              {
+    ctx.stack_.back()->set("Control-agent", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 3500 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3512 "dhcp6_parser.cc"
     break;
 
-  case 617:
-#line 2165 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 617: // $@118: %empty
+#line 2169 "dhcp6_parser.yy"
+                               {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-control", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.CONFIG_CONTROL);
 }
-#line 3511 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3523 "dhcp6_parser.cc"
     break;
 
-  case 618:
-#line 2170 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 618: // config_control: "config-control" $@118 ":" "{" config_control_params "}"
+#line 2174 "dhcp6_parser.yy"
+                                                            {
     // No config control params are required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3521 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3533 "dhcp6_parser.cc"
     break;
 
-  case 619:
-#line 2176 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 619: // $@119: %empty
+#line 2180 "dhcp6_parser.yy"
+                                   {
     // Parse the config-control map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3531 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3543 "dhcp6_parser.cc"
     break;
 
-  case 620:
-#line 2180 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 620: // sub_config_control: "{" $@119 config_control_params "}"
+#line 2184 "dhcp6_parser.yy"
+                                       {
     // No config_control params are required
     // parsing completed
 }
-#line 3540 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3552 "dhcp6_parser.cc"
     break;
 
-  case 624:
-#line 2194 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 624: // $@120: %empty
+#line 2198 "dhcp6_parser.yy"
+                                   {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("config-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CONFIG_DATABASE);
 }
-#line 3551 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3563 "dhcp6_parser.cc"
     break;
 
-  case 625:
-#line 2199 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 625: // config_databases: "config-databases" $@120 ":" "[" database_list "]"
+#line 2203 "dhcp6_parser.yy"
+                                                      {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3560 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3572 "dhcp6_parser.cc"
     break;
 
-  case 626:
-#line 2209 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 626: // $@121: %empty
+#line 2213 "dhcp6_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3571 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3583 "dhcp6_parser.cc"
     break;
 
-  case 627:
-#line 2214 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 627: // logging_object: "Logging" $@121 ":" "{" logging_params "}"
+#line 2218 "dhcp6_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3580 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3592 "dhcp6_parser.cc"
     break;
 
-  case 628:
-#line 2219 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 628: // $@122: %empty
+#line 2223 "dhcp6_parser.yy"
+                            {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3590 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3602 "dhcp6_parser.cc"
     break;
 
-  case 629:
-#line 2223 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 629: // sub_logging: "{" $@122 logging_params "}"
+#line 2227 "dhcp6_parser.yy"
+                                {
     // parsing completed
 }
-#line 3598 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3610 "dhcp6_parser.cc"
     break;
 
-  case 633:
-#line 2239 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 633: // $@123: %empty
+#line 2243 "dhcp6_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3609 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3621 "dhcp6_parser.cc"
     break;
 
-  case 634:
-#line 2244 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 634: // loggers: "loggers" $@123 ":" "[" loggers_entries "]"
+#line 2248 "dhcp6_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3618 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3630 "dhcp6_parser.cc"
     break;
 
-  case 637:
-#line 2256 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 637: // $@124: %empty
+#line 2260 "dhcp6_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3628 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3640 "dhcp6_parser.cc"
     break;
 
-  case 638:
-#line 2260 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 638: // logger_entry: "{" $@124 logger_params "}"
+#line 2264 "dhcp6_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 3636 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3648 "dhcp6_parser.cc"
     break;
 
-  case 648:
-#line 2277 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 649: // debuglevel: "debuglevel" ":" "integer"
+#line 2282 "dhcp6_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3645 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3657 "dhcp6_parser.cc"
     break;
 
-  case 649:
-#line 2282 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 650: // $@125: %empty
+#line 2287 "dhcp6_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3653 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3665 "dhcp6_parser.cc"
     break;
 
-  case 650:
-#line 2284 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 651: // severity: "severity" $@125 ":" "constant string"
+#line 2289 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3663 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3675 "dhcp6_parser.cc"
     break;
 
-  case 651:
-#line 2290 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 652: // $@126: %empty
+#line 2295 "dhcp6_parser.yy"
+                       {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3683 "dhcp6_parser.cc"
+    break;
+
+  case 653: // rate_limit: "rate-limit" $@126 ":" "constant string"
+#line 2297 "dhcp6_parser.yy"
+               {
+    ElementPtr rl(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+}
+#line 3693 "dhcp6_parser.cc"
+    break;
+
+  case 654: // $@127: %empty
+#line 2303 "dhcp6_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3674 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3704 "dhcp6_parser.cc"
     break;
 
-  case 652:
-#line 2295 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 655: // output_options_list: "output_options" $@127 ":" "[" output_options_list_content "]"
+#line 2308 "dhcp6_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3683 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3713 "dhcp6_parser.cc"
     break;
 
-  case 655:
-#line 2304 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 658: // $@128: %empty
+#line 2317 "dhcp6_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3693 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3723 "dhcp6_parser.cc"
     break;
 
-  case 656:
-#line 2308 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 659: // output_entry: "{" $@128 output_params_list "}"
+#line 2321 "dhcp6_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 3701 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3731 "dhcp6_parser.cc"
     break;
 
-  case 663:
-#line 2322 "dhcp6_parser.yy" // lalr1.cc:907
-    {
+  case 669: // $@129: %empty
+#line 2338 "dhcp6_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3709 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3739 "dhcp6_parser.cc"
     break;
 
-  case 664:
-#line 2324 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 670: // output: "output" $@129 ":" "constant string"
+#line 2340 "dhcp6_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3719 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3749 "dhcp6_parser.cc"
     break;
 
-  case 665:
-#line 2330 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 671: // flush: "flush" ":" "boolean"
+#line 2346 "dhcp6_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3728 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3758 "dhcp6_parser.cc"
     break;
 
-  case 666:
-#line 2335 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 672: // maxsize: "maxsize" ":" "integer"
+#line 2351 "dhcp6_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3737 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3767 "dhcp6_parser.cc"
     break;
 
-  case 667:
-#line 2340 "dhcp6_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 673: // maxver: "maxver" ":" "integer"
+#line 2356 "dhcp6_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3746 "dhcp6_parser.cc" // lalr1.cc:907
+#line 3776 "dhcp6_parser.cc"
     break;
 
+  case 674: // async: "async" ":" "boolean"
+#line 2361 "dhcp6_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 3785 "dhcp6_parser.cc"
+    break;
+
+  case 675: // queue_size: "queue-size" ":" "integer"
+#line 2366 "dhcp6_parser.yy"
+                                     {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", size);
+}
+#line 3794 "dhcp6_parser.cc"
+    break;
+
+  case 676: // $@130: %empty
+#line 2371 "dhcp6_parser.yy"
+                                 {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3802 "dhcp6_parser.cc"
+    break;
+
+  case 677: // overflow_policy: "overflow-policy" $@130 ":" "constant string"
+#line 2373 "dhcp6_parser.yy"
+               {
+    ElementPtr policy(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 3812 "dhcp6_parser.cc"
+    break;
+
+
+#line 3816 "dhcp6_parser.cc"
 
-#line 3750 "dhcp6_parser.cc" // lalr1.cc:907
             default:
               break;
             }
@@ -3754,6 +3821,7 @@ namespace isc { namespace dhcp {
 #if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
@@ -3761,13 +3829,13 @@ namespace isc { namespace dhcp {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -3776,7 +3844,9 @@ namespace isc { namespace dhcp {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -3787,7 +3857,7 @@ namespace isc { namespace dhcp {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -3804,68 +3874,81 @@ namespace isc { namespace dhcp {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -3873,6 +3956,7 @@ namespace isc { namespace dhcp {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -3906,18 +3990,103 @@ namespace isc { namespace dhcp {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  Dhcp6Parser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  Dhcp6Parser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
 
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  Dhcp6Parser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
+
+  // Dhcp6Parser::context.
+  Dhcp6Parser::context::context (const Dhcp6Parser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  Dhcp6Parser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  Dhcp6Parser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -3936,41 +4105,32 @@ namespace isc { namespace dhcp {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  Dhcp6Parser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -3991,11 +4151,11 @@ namespace isc { namespace dhcp {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -4011,118 +4171,120 @@ namespace isc { namespace dhcp {
   const short
   Dhcp6Parser::yypact_[] =
   {
-     337,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,    65,    55,    66,    90,
-     108,   110,   119,   125,   136,   169,   176,   177,   217,   245,
-     246,   247,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+     359,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,    44,    40,    33,    39,
+      55,   107,   114,   148,   190,   226,   227,   239,   247,   260,
+     262,   266,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,    55,  -119,    28,    59,    25,   218,    64,   233,
-     350,    47,    30,   170,   -54,   456,   -73,   165,  -821,   258,
-     194,   262,   293,   267,  -821,  -821,  -821,  -821,  -821,   320,
-    -821,    71,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,   324,   346,   352,   354,   355,  -821,  -821,
+    -821,  -821,    40,     1,    27,    61,    24,   209,    85,   223,
+      26,   140,    32,   265,   -14,   372,   113,   279,  -821,   296,
+     302,   304,   301,   308,  -821,  -821,  -821,  -821,  -821,   316,
+    -821,   122,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,   328,   342,   348,   352,   354,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,   360,  -821,  -821,  -821,  -821,
-      79,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,   361,  -821,  -821,  -821,  -821,
+     128,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,   361,  -821,    80,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,   362,   364,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,    86,  -821,  -821,
+    -821,  -821,  -821,  -821,   362,  -821,   145,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,   365,   374,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,   149,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   104,
-    -821,  -821,  -821,  -821,  -821,   380,  -821,   381,   386,  -821,
-    -821,  -821,  -821,  -821,  -821,   105,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   170,
+    -821,  -821,  -821,  -821,  -821,   380,  -821,   394,   395,  -821,
+    -821,  -821,  -821,  -821,  -821,   179,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,   340,   351,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,   370,  -821,  -821,   391,  -821,  -821,  -821,
-     394,  -821,  -821,   392,   396,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   398,   401,
-    -821,  -821,  -821,  -821,   400,   403,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   111,  -821,
-    -821,  -821,   405,  -821,  -821,   406,  -821,   409,   418,  -821,
-    -821,   419,   421,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-     120,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   154,  -821,
-    -821,  -821,   155,  -821,  -821,  -821,    55,    55,  -821,   257,
-     424,   430,   432,   441,   447,  -821,    28,  -821,   448,   449,
-     450,   453,   459,   289,   294,   295,   296,   298,   460,   464,
-     466,   467,   468,   469,   471,   472,   474,   475,   476,   477,
-     478,   479,   480,   482,   483,   317,   503,   504,   505,    59,
-    -821,   506,   339,    25,  -821,   509,   510,   511,   512,   514,
-     348,   353,   519,   520,   521,   218,  -821,   523,    64,  -821,
-     524,   358,   526,   363,   365,   233,  -821,   527,   528,   531,
-     533,   534,   535,   536,  -821,   350,  -821,   537,   540,   375,
-     543,   544,   545,   377,  -821,    30,   547,   379,   382,  -821,
-     170,   549,   550,    51,  -821,   383,   553,   558,   393,   559,
-     395,   399,   561,   565,   402,   423,   567,   568,   569,   570,
-     456,  -821,   572,   -73,  -821,   587,   165,  -821,  -821,  -821,
-     590,   592,   593,    55,    55,    55,  -821,   594,   595,   596,
-     597,   600,  -821,  -821,  -821,  -821,  -821,   436,   602,   603,
-     604,   605,   440,   374,   606,   608,   609,   610,   611,   612,
-     614,   615,   616,   617,  -821,   618,   605,   620,  -821,   623,
-    -821,  -821,   624,   625,   446,   451,   452,  -821,  -821,   623,
-     461,   626,  -821,   462,  -821,   465,  -821,   470,  -821,  -821,
-    -821,   623,   623,   623,   473,   481,   484,   485,  -821,   486,
-     487,  -821,   488,   489,   490,  -821,  -821,   491,  -821,  -821,
-    -821,   492,    55,  -821,  -821,   493,   494,  -821,   495,  -821,
-    -821,    26,   498,  -821,  -821,    15,   496,   497,   499,  -821,
-     631,  -821,   632,  -821,    55,    59,   -73,  -821,  -821,  -821,
-     165,    25,   213,   213,   634,  -821,   635,   637,   638,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,   639,   -50,    55,
-     139,   556,   640,   641,   642,   229,    99,   138,  -821,   456,
-    -821,  -821,   643,   645,  -821,  -821,  -821,  -821,  -821,   -39,
+    -821,  -821,  -821,   397,   309,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,   398,  -821,  -821,   399,  -821,  -821,  -821,
+     404,  -821,  -821,   401,   321,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   406,   409,
+    -821,  -821,  -821,  -821,   415,   347,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   185,  -821,
+    -821,  -821,   413,  -821,  -821,   421,  -821,   427,   428,  -821,
+    -821,   430,   436,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+     186,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   187,  -821,
+    -821,  -821,   233,  -821,  -821,  -821,    40,    40,  -821,   228,
+     437,   438,   440,   451,   454,  -821,    27,  -821,   461,   462,
+     463,   464,   465,   299,   303,   305,   306,   307,   466,   467,
+     469,   472,   473,   475,   480,   481,   482,   483,   484,   488,
+     502,   503,   504,   505,   506,   337,   511,   512,   530,    61,
+    -821,   531,   360,    24,  -821,   532,   534,   535,   536,   537,
+     369,   370,   544,   545,   546,   209,  -821,   547,    85,  -821,
+     548,   378,   550,   381,   389,   223,  -821,   551,   553,   556,
+     559,   561,   562,   565,  -821,    26,  -821,   566,   567,   400,
+     568,   569,   570,   402,  -821,    32,   572,   403,   405,  -821,
+     265,   573,   574,   110,  -821,   407,   577,   579,   410,   582,
+     412,   414,   584,   587,   417,   419,   593,   594,   595,   596,
+     372,  -821,   597,   113,  -821,   598,   279,  -821,  -821,  -821,
+     599,   600,   601,    40,    40,    40,  -821,   602,   603,   604,
+     605,   608,  -821,  -821,  -821,  -821,  -821,   431,   609,   610,
+     611,   612,   432,    37,   613,   615,   616,   617,   618,   619,
+     621,   622,   623,   624,  -821,   625,   612,   626,  -821,   629,
+    -821,  -821,   630,   631,   443,   449,   455,  -821,  -821,   629,
+     468,   632,  -821,   470,  -821,   471,  -821,   474,  -821,  -821,
+    -821,   629,   629,   629,   476,   477,   478,   479,  -821,   485,
+     486,  -821,   487,   489,   490,  -821,  -821,   491,  -821,  -821,
+    -821,   492,    40,  -821,  -821,   493,   494,  -821,   495,  -821,
+    -821,    77,   501,  -821,  -821,    25,   496,   497,   498,  -821,
+     633,  -821,   635,  -821,    40,    61,   113,  -821,  -821,  -821,
+     279,    24,   194,   194,   634,  -821,   636,   639,   640,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,   642,   -50,    40,
+      43,   522,   647,   648,   649,   159,   126,     5,  -821,   372,
+    -821,  -821,   650,   651,  -821,  -821,  -821,  -821,  -821,   -32,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,   646,   634,  -821,   164,   182,   191,
-     259,  -821,  -821,  -821,  -821,   664,   666,   667,   668,   669,
-    -821,   670,   671,  -821,   672,   673,   674,  -821,   260,  -821,
+    -821,  -821,  -821,  -821,   655,   634,  -821,   244,   250,   287,
+     291,  -821,  -821,  -821,  -821,   669,   670,   671,   672,   673,
+    -821,   674,   675,  -821,   676,   677,   678,  -821,   295,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,   270,  -821,   633,
-     676,  -821,  -821,   675,   677,  -821,  -821,   678,   679,  -821,
-    -821,   680,   682,  -821,  -821,   681,   685,  -821,  -821,  -821,
-     167,  -821,  -821,  -821,   683,  -821,  -821,  -821,   190,  -821,
-    -821,  -821,  -821,   271,  -821,  -821,  -821,   297,  -821,  -821,
-     684,   688,  -821,  -821,   686,   690,  -821,   691,   692,   693,
-     694,   695,   696,   273,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,   697,   698,   699,  -821,  -821,  -821,  -821,
-     301,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,   304,  -821,  -821,  -821,   307,   513,  -821,   700,
-     701,  -821,  -821,   702,   704,  -821,  -821,  -821,   703,  -821,
-    -821,   333,  -821,   706,  -821,  -821,  -821,  -821,   705,   709,
-     710,   711,   539,   532,   546,   548,   551,   712,   552,   554,
-     714,   555,   557,   560,   213,  -821,  -821,   213,  -821,   634,
-     218,  -821,   635,    30,  -821,   637,   170,  -821,   638,   390,
-    -821,   639,   -50,  -821,  -821,   139,  -821,   715,   556,  -821,
-     121,   640,  -821,   350,  -821,   641,   -54,  -821,   642,   563,
-     564,   566,   571,   573,   574,   229,  -821,   716,   720,   575,
-     576,   577,    99,  -821,   723,   725,   138,  -821,  -821,  -821,
-     724,   728,    64,  -821,   643,   233,  -821,   645,   732,  -821,
-      44,   646,  -821,  -821,   397,   562,   579,   580,  -821,  -821,
-    -821,  -821,  -821,   581,  -821,  -821,   582,  -821,  -821,  -821,
-    -821,   308,  -821,   311,  -821,   730,  -821,   731,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,   298,  -821,   679,
+     680,  -821,  -821,   681,   683,  -821,  -821,   682,   686,  -821,
+    -821,   684,   688,  -821,  -821,   687,   689,  -821,  -821,  -821,
+      57,  -821,  -821,  -821,   690,  -821,  -821,  -821,    93,  -821,
+    -821,  -821,  -821,   318,  -821,  -821,  -821,   153,  -821,  -821,
+     691,   692,  -821,  -821,   693,   695,  -821,   696,   697,   698,
+     699,   700,   701,   319,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,   702,   703,   704,  -821,  -821,  -821,  -821,
+     320,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,   330,  -821,  -821,  -821,   331,   510,  -821,   705,
+     706,  -821,  -821,   707,   709,  -821,  -821,  -821,   620,  -821,
+    -821,   168,  -821,   708,  -821,  -821,  -821,  -821,   711,   712,
+     713,   714,   519,   533,   549,   542,   552,   716,   554,   555,
+     717,   557,   558,   560,   194,  -821,  -821,   194,  -821,   634,
+     209,  -821,   636,    32,  -821,   639,   265,  -821,   640,   388,
+    -821,   642,   -50,  -821,  -821,    43,  -821,   718,   522,  -821,
+      81,   647,  -821,    26,  -821,   648,   -14,  -821,   649,   563,
+     564,   571,   575,   576,   578,   159,  -821,   719,   721,   580,
+     581,   583,   126,  -821,   722,   724,     5,  -821,  -821,  -821,
+     725,   731,    85,  -821,   650,   223,  -821,   651,   732,  -821,
+     271,   655,  -821,  -821,   441,   585,   586,   588,  -821,  -821,
+    -821,  -821,  -821,   589,  -821,  -821,   590,  -821,  -821,  -821,
+    -821,   332,  -821,   339,  -821,   727,  -821,   733,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,   315,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,   583,  -821,  -821,   736,  -821,  -821,  -821,  -821,  -821,
-     733,   740,  -821,  -821,  -821,  -821,  -821,   746,  -821,   318,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   107,   585,
-    -821,  -821,  -821,  -821,   586,   588,  -821,  -821,   589,   319,
-    -821,   334,  -821,   591,  -821,   753,  -821,  -821,  -821,  -821,
-    -821,   335,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,   340,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,   591,  -821,  -821,   736,  -821,  -821,  -821,  -821,  -821,
+     734,   740,  -821,  -821,  -821,  -821,  -821,   737,  -821,   346,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   135,   607,
+    -821,  -821,  -821,  -821,   627,   641,  -821,  -821,   643,   356,
+    -821,   382,  -821,   653,  -821,   743,  -821,  -821,  -821,  -821,
+    -821,  -821,   385,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,   390,  -821,  -821,   756,   598,  -821,   121,  -821,  -821,
+    -821,  -821,  -821,   388,  -821,  -821,   744,   606,  -821,    81,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,   758,   613,   759,    44,  -821,  -821,   629,  -821,  -821,
-     689,  -821,   630,  -821,  -821,   757,  -821,  -821,   343,  -821,
-      -5,   757,  -821,  -821,   761,   763,   764,   344,  -821,  -821,
-    -821,  -821,  -821,  -821,   770,   628,   622,   644,    -5,  -821,
-     650,  -821,  -821,  -821,  -821,  -821
+    -821,  -821,  -821,   745,   592,   748,   750,   271,  -821,  -821,
+     657,  -821,  -821,   739,  -821,   658,   659,  -821,  -821,   754,
+    -821,  -821,  -821,   193,  -821,   297,   754,  -821,  -821,   753,
+     764,   767,   770,   780,  -821,   392,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,   789,   637,   628,   660,   646,
+     665,   790,   297,  -821,   667,  -821,  -821,  -821,  -821,  -821,
+     720,  -821,  -821,  -821
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yydefact_[] =
   {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
@@ -4224,73 +4386,76 @@ namespace isc { namespace dhcp {
        0,   503,   504,   506,   507,   508,   499,     0,   456,     0,
      220,   244,   245,   246,   247,   248,   249,   237,     0,     0,
      535,   538,   539,   520,     0,     0,   544,    54,     0,     0,
-     401,     0,   426,     0,   651,     0,   649,   647,   641,   645,
-     646,     0,   639,   643,   644,   642,   636,   163,   164,   165,
-     166,   162,   168,   170,   172,   185,   188,   140,   257,   336,
-     373,     0,   307,   195,     0,     0,   501,     0,   458,   222,
-     532,   533,   534,   531,   537,   551,   553,    58,   403,   428,
-     495,     0,     0,     0,     0,   638,   309,     0,   516,   505,
-       0,   648,     0,   640,   515,     0,   650,   655,     0,   653,
-       0,     0,   652,   663,     0,     0,     0,     0,   657,   659,
-     660,   661,   662,   654,     0,     0,     0,     0,     0,   656,
-       0,   665,   666,   667,   658,   664
+     401,     0,   426,     0,   654,     0,   652,   650,   648,   641,
+     646,   647,     0,   639,   643,   645,   644,   642,   636,   163,
+     164,   165,   166,   162,   168,   170,   172,   185,   188,   140,
+     257,   336,   373,     0,   307,   195,     0,     0,   501,     0,
+     458,   222,   532,   533,   534,   531,   537,   551,   553,    58,
+     403,   428,   495,     0,     0,     0,     0,     0,   638,   309,
+       0,   516,   505,     0,   649,     0,     0,   640,   515,     0,
+     653,   651,   658,     0,   656,     0,     0,   655,   669,     0,
+       0,     0,     0,     0,   676,     0,   660,   662,   663,   664,
+     665,   666,   667,   668,   657,     0,     0,     0,     0,     0,
+       0,     0,     0,   659,     0,   671,   672,   673,   674,   675,
+       0,   661,   670,   677
   };
 
   const short
   Dhcp6Parser::yypgoto_[] =
   {
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,     6,  -821,  -453,
-    -821,   265,  -821,  -821,  -821,  -821,   174,  -821,  -408,  -821,
-    -821,  -821,   -74,  -821,  -821,  -821,   443,  -821,  -821,  -821,
-    -821,   211,   411,   -62,   -46,   -45,   -43,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,   220,   420,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,   149,  -821,   -12,  -821,  -565,
-      -3,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,     6,  -821,  -451,
+    -821,   280,  -821,  -821,  -821,  -821,   191,  -821,  -448,  -821,
+    -821,  -821,   -74,  -821,  -821,  -821,   433,  -821,  -821,  -821,
+    -821,   224,   411,   -62,   -45,   -43,   -42,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,   252,   442,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,   182,  -821,     9,  -821,  -565,
+      10,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,   -70,  -821,  -600,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   -26,
-    -821,  -821,  -821,  -821,  -821,   -19,  -584,  -821,  -821,  -821,
-    -821,   -20,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-     -28,  -821,  -821,  -821,   -25,   404,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,   -31,  -821,  -821,  -821,  -821,  -821,  -821,
-    -820,  -821,  -821,  -821,     1,  -821,  -821,  -821,     5,   431,
-    -821,  -821,  -819,  -821,  -816,  -821,   -36,  -821,   -32,  -821,
-     -42,  -821,  -821,  -821,  -813,  -821,  -821,  -821,  -821,    -4,
-    -821,  -821,  -173,   769,  -821,  -821,  -821,  -821,  -821,     8,
-    -821,  -821,  -821,    11,  -821,   410,  -821,   -76,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,    -8,
+    -821,  -821,  -821,  -821,  -821,    -1,  -584,  -821,  -821,  -821,
+    -821,    -2,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+     -13,  -821,  -821,  -821,   -12,   408,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,   -18,  -821,  -821,  -821,  -821,  -821,  -821,
+    -820,  -821,  -821,  -821,    18,  -821,  -821,  -821,    23,   450,
+    -821,  -821,  -819,  -821,  -818,  -821,   -36,  -821,    -3,  -821,
+     -29,  -821,  -821,  -821,  -816,  -821,  -821,  -821,  -821,    13,
+    -821,  -821,  -157,   786,  -821,  -821,  -821,  -821,  -821,    28,
+    -821,  -821,  -821,    29,  -821,   424,  -821,   -76,  -821,  -821,
     -821,  -821,  -821,   -69,  -821,  -821,  -821,  -821,  -821,   -11,
-    -821,  -821,  -821,     3,  -821,  -821,  -821,    18,  -821,   415,
+    -821,  -821,  -821,    22,  -821,  -821,  -821,    31,  -821,   425,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,   -33,  -821,  -821,  -821,   -23,   454,  -821,  -821,   -58,
-    -821,   -24,  -821,  -821,  -821,  -821,  -821,   -30,  -821,  -821,
-    -821,   -29,   445,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-     -60,  -821,  -821,  -821,     9,  -821,  -821,  -821,    10,  -821,
-     442,   249,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -812,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,    14,  -821,  -821,  -821,  -148,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,    -2,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,    -1,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   263,
-     413,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,   -20,  -821,  -821,  -821,   -10,   460,  -821,  -821,   -58,
+    -821,   -24,  -821,  -821,  -821,  -821,  -821,   -17,  -821,  -821,
+    -821,   -16,   458,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+     -60,  -821,  -821,  -821,    20,  -821,  -821,  -821,    30,  -821,
+     452,   257,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -813,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,    34,  -821,  -821,  -821,  -141,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,     8,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,    11,  -821,
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,   272,
+     426,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
     -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,  -821,
-    -821,  -821,  -821,  -821,  -821,  -821,  -821,   299,   412,  -821,
-    -821,  -821,  -821,  -821,  -821,   300,   414,  -821,  -821,  -821,
-     -10,  -821,  -821,  -154,  -821,  -821,  -821,  -821,  -821,  -821,
-    -169,  -821,  -821,  -185,  -821,  -821,  -821,  -821,  -821
+    -821,  -821,  -821,  -821,  -821,  -821,  -821,   310,   422,  -821,
+    -821,  -821,  -821,  -821,  -821,   313,   429,  -821,  -821,  -821,
+       0,  -821,  -821,  -144,  -821,  -821,  -821,  -821,  -821,  -821,
+    -821,  -821,  -162,  -821,  -821,  -187,  -821,  -821,  -821,  -821,
+    -821,  -821,  -821,  -821,  -821
   };
 
   const short
   Dhcp6Parser::yydefgoto_[] =
   {
-      -1,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+       0,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    88,    41,    42,
       73,   600,    92,    93,    43,    72,    89,    90,   621,   797,
      890,   891,   687,    45,    74,   101,   102,   103,   360,    47,
       75,   140,   141,   142,   143,   144,   145,   146,   147,   378,
      148,   369,    49,    76,   176,   177,   178,   401,   179,   149,
      370,   150,   371,   151,   372,   709,   710,   711,   837,   688,
-     689,   690,   818,  1011,   691,   819,   692,   820,   693,   821,
+     689,   690,   818,  1013,   691,   819,   692,   820,   693,   821,
      694,   695,   438,   696,   697,   698,   699,   700,   701,   702,
      703,   704,   827,   705,   706,   830,   152,   389,   743,   744,
      745,   857,   153,   386,   730,   731,   732,   733,   154,   388,
@@ -4312,7 +4477,7 @@ namespace isc { namespace dhcp {
      255,   256,   428,   257,   429,   258,   430,   259,   431,   260,
      432,   261,   433,   262,   427,   213,   414,   808,   809,   898,
      166,   390,   747,   748,   860,   960,   961,   962,   963,   964,
-    1024,   965,   167,   394,   780,   781,   782,   877,  1033,   783,
+    1026,   965,   167,   394,   780,   781,   782,   877,  1035,   783,
      784,   878,   785,   786,   168,   169,   396,   792,   793,   794,
      884,   795,   885,   170,   397,   171,   398,    67,    85,   330,
      331,   332,   333,   456,   334,   457,   335,   336,   459,   337,
@@ -4320,116 +4485,117 @@ namespace isc { namespace dhcp {
      660,   344,   467,   345,   468,   346,   469,   104,   362,   105,
      363,   106,   364,   172,   368,    71,    87,   352,   353,   354,
      475,   107,   361,    69,    86,   348,   349,   350,   472,   811,
-     812,   900,  1001,  1002,  1003,  1004,  1043,  1005,  1041,  1058,
-    1059,  1060,  1067,  1068,  1069,  1074,  1070,  1071,  1072
+     812,   900,  1002,  1003,  1004,  1005,  1046,  1006,  1045,  1007,
+    1043,  1063,  1064,  1065,  1075,  1076,  1077,  1085,  1078,  1079,
+    1080,  1081,  1082,  1083,  1091
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yytable_[] =
   {
      100,   139,   175,   192,   215,   229,   249,   292,   271,   290,
      307,   327,   272,   291,   293,   193,   777,   212,   180,   209,
      222,   233,   251,    40,   285,   303,   737,   328,   707,   935,
-     936,   194,   195,   937,   196,   204,   941,   947,    94,   173,
-     174,   728,   216,   230,   305,   306,   217,   231,   599,   264,
-     243,    91,   181,   210,   223,   234,   252,   806,   286,   304,
-      33,   329,    34,   599,    35,    32,   207,   218,   232,   250,
-     108,   347,   109,    44,   366,   110,   111,   112,   265,   367,
-     266,   267,   399,   403,   268,   269,   270,   400,   404,   415,
-     122,   123,   265,   120,   416,   122,   123,    46,   113,   114,
-     115,   116,   117,   118,   119,   120,   121,   418,   425,   122,
-     123,   121,   419,   426,   453,    48,    99,    50,   771,   454,
-     729,   627,   214,   470,   122,   123,    52,   676,   471,   122,
-     123,   124,    54,   633,   634,   635,   125,   126,   127,   128,
-     129,  1063,   130,    56,  1064,  1065,  1066,   131,   189,   305,
-     306,   190,   655,   656,   657,   658,   132,   473,   476,   133,
-     651,   652,   474,   477,   122,   123,   134,   399,   121,   265,
-     852,    95,   814,   853,   135,   136,    58,   351,   137,   138,
-      96,    97,    98,    60,    62,   473,   122,   123,   659,   994,
-     815,   995,   996,   855,   476,    99,   856,   356,    99,   816,
-      99,   935,   936,   122,   123,   937,   953,   954,   941,   947,
-     772,   773,   774,   775,    99,  1030,  1031,  1032,   265,   287,
-     266,   267,   288,   289,    64,    36,    37,    38,    39,    99,
-     728,   735,   671,   736,    99,   122,   123,   672,   673,   674,
-     675,   676,   677,   678,   679,   680,   681,   682,   683,   684,
-     685,   686,    66,    68,    70,   787,   788,   113,   114,   115,
-     116,   265,   403,   834,   355,   121,   357,   817,   835,    99,
-     359,   737,   921,   834,   858,   182,   875,   183,   836,   859,
-     121,   876,   777,   122,   123,   184,   185,   186,   187,   188,
-     124,    99,   100,   224,   225,   226,   227,   228,   122,   123,
-     861,   358,   189,   862,   882,   190,   131,   886,    99,   883,
-     470,   834,   887,   191,   415,   888,  1017,   189,  1021,  1018,
-     190,   453,   418,  1022,   365,   139,  1029,  1038,   373,   175,
-     757,   758,   759,   760,   761,   762,   901,   425,  1044,   902,
-      99,   192,  1039,  1045,   215,   180,  1061,  1078,   434,  1062,
-     374,   229,  1079,   193,   435,   212,   375,   209,   376,   377,
-     222,   249,   478,   479,   395,   402,   410,   233,   411,   194,
-     195,   271,   196,   204,   292,   272,   290,   251,   436,   181,
-     291,   293,   216,    99,   421,   423,   217,   285,    99,   230,
-     424,   210,   303,   231,   223,   439,   327,   121,   443,   445,
-     444,   234,   447,    99,   207,   448,   450,   218,   449,   455,
-     458,   252,   328,   460,   232,   122,   123,  1007,  1008,  1009,
-    1010,   286,   461,   464,   250,   465,   304,   480,   481,   113,
-     114,   115,   116,   242,   482,   119,   483,   121,   265,   243,
-     244,   245,   246,   247,   248,   484,   329,   602,   603,   604,
-     605,   485,   487,   488,   489,   122,   123,   490,   185,   186,
-     492,   188,   124,   491,   497,   493,   494,   495,   498,   496,
-     499,   500,   501,   502,   189,   503,   504,   190,   505,   506,
-     507,   508,   509,   510,   511,   191,   512,   513,   514,   587,
-     588,   589,     1,     2,     3,     4,     5,     6,     7,     8,
-       9,    10,    11,    12,    13,    14,    15,   515,   516,   517,
-     519,   139,   520,   522,   523,   524,   525,   175,   526,   527,
-      99,   122,   123,   529,   530,   531,   528,   533,   535,   536,
-     537,   541,   542,   180,   538,   543,   539,   544,   545,   546,
-     547,   549,   776,   789,   550,   327,   551,   552,   553,   554,
-     555,   557,   558,   561,   562,   559,   564,   565,   778,   790,
-      99,   328,   566,   568,   567,   571,   569,   181,   647,   572,
-     570,   575,   576,   577,   578,   573,   580,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     666,   582,   779,   791,   584,   329,   574,   325,   326,   585,
-     586,   590,   591,   592,   593,   594,   595,   596,   597,   598,
-     601,   607,    34,   608,   609,   610,   624,   612,   611,   613,
-     614,   625,   626,   615,   616,   617,    99,   619,   620,   622,
-     623,   628,   630,   629,   654,   631,   664,   665,   742,   838,
-     632,   708,   712,   636,   716,   720,   724,   746,   749,   753,
-     798,   637,   802,   810,   638,   639,   640,   641,   642,   643,
-     644,   645,   646,   648,   649,   650,   661,   662,   822,   663,
-     823,   824,   825,   826,   828,   829,   831,   832,   833,   839,
-     842,   841,   845,   889,   844,   848,   847,   850,   851,   854,
-     864,   865,   867,   868,  1055,   869,   870,   871,   872,   873,
-     874,   879,   880,   881,   894,   909,   893,   897,   896,   904,
-     908,   899,   903,   905,   906,   907,   913,   910,   916,   951,
-     978,   911,   912,   914,   979,   915,   917,   984,   918,   985,
-     987,   988,  1012,   919,   971,   972,   993,   973,  1019,  1020,
-    1025,  1026,   974,  1027,   975,   976,   980,   981,   982,  1013,
-    1014,  1015,  1016,  1023,  1028,  1034,  1035,  1042,  1036,  1037,
-    1047,  1040,  1050,  1052,  1057,  1075,   192,  1076,  1077,   271,
-     292,  1048,   290,   272,  1080,   929,   291,   293,   193,   934,
-     212,   618,   209,   734,  1051,   285,   955,   930,   303,   249,
-     956,   945,   307,  1082,   194,   195,   667,   196,   204,  1054,
-    1056,  1081,   958,   931,   932,   251,   933,   940,   776,   486,
-     518,   670,   789,   938,   813,  1083,   210,   939,   215,   286,
-    1085,   229,   304,   521,   778,   946,   997,   922,   790,   207,
-     998,   920,   952,   949,   222,   950,   959,   233,   944,   252,
-     970,   969,   999,   924,   977,   923,   532,   948,  1046,   957,
-     263,   928,   250,   926,   925,   556,   216,   563,   779,   230,
-     217,   990,   791,   231,   927,   560,   991,   992,   223,   989,
-     540,   234,   534,   967,   968,   966,  1000,   548,   807,  1049,
-     983,   218,   796,   579,   232,   986,   668,   581,   583,   669,
-    1053,  1006,  1073,  1084,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     936,   937,   194,   941,   195,   196,   947,    94,   173,   174,
+      44,   728,   216,   230,    32,    33,    46,    34,   204,    35,
+     599,   264,   181,   210,   223,   234,   252,   243,   286,   304,
+     852,   329,    48,   853,   806,   599,   207,   218,   232,   250,
+     122,   123,   108,   121,   109,   217,   231,   110,   111,   112,
+     265,   627,   266,   267,   305,   306,   268,   269,   270,   122,
+     123,   122,   123,   633,   634,   635,   855,   122,   123,   856,
+     113,   114,   115,   116,   117,   118,   119,   120,   121,   242,
+     602,   603,   604,   605,    50,   243,   244,   245,   246,   247,
+     248,    52,   787,   788,   729,   366,   122,   123,   121,   265,
+     367,   399,   121,   124,   728,   735,   400,   736,   125,   126,
+     127,   128,   129,   214,   130,   771,   122,   123,   403,   131,
+     122,   123,   415,   404,   676,    54,   861,   416,   132,   862,
+      99,   133,   655,   656,   657,   658,   953,   954,   134,   189,
+      95,   901,   190,   418,   902,    91,   135,   136,   419,    99,
+     137,   138,   425,    96,    97,    98,   120,   426,   453,   470,
+     473,   122,   123,   454,   471,   474,  1066,    56,    99,  1067,
+      99,    99,   659,   935,   936,   937,    99,   941,   305,   306,
+     947,   651,   652,   671,    36,    37,    38,    39,   672,   673,
+     674,   675,   676,   677,   678,   679,   680,   681,   682,   683,
+     684,   685,   686,    58,    60,    99,   476,   772,   773,   774,
+     775,   477,   265,  1032,  1033,  1034,    62,   399,   113,   114,
+     115,   116,   814,   473,    64,    99,   121,   347,   815,    99,
+     757,   758,   759,   760,   761,   762,   182,    66,   183,    68,
+     121,   737,   921,    70,   122,   123,   184,   185,   186,   187,
+     188,   124,   777,   224,   225,   226,   227,   228,   122,   123,
+     476,   351,   100,   189,   403,   816,   190,   131,   834,   817,
+      99,   834,   355,   835,   191,   356,   836,   189,   357,   358,
+     190,   359,   435,   265,   287,   266,   267,   288,   289,   265,
+     365,   858,   875,   882,   445,   139,   859,   876,   883,   175,
+     122,   123,   373,   886,   470,   834,   122,   123,   887,   888,
+    1019,   192,   415,  1023,   215,   180,   374,  1020,  1024,   453,
+     450,   229,   375,   193,  1031,   212,   376,   209,   377,   418,
+     222,   249,   478,   479,  1040,   395,   402,   233,    99,   410,
+     194,   271,   195,   196,   292,   272,   290,   251,   411,   181,
+     291,   293,   216,    99,   421,   425,   204,   285,  1047,   230,
+    1041,   210,   303,  1048,   223,  1092,   327,    99,   423,   424,
+    1093,   234,   480,   439,   207,   434,   436,   218,   443,   444,
+     447,   252,   328,   448,   232,   217,   994,   455,   995,   996,
+     997,   286,   231,   449,   250,   458,   304,   113,   114,   115,
+     116,   460,   461,   119,   464,   121,   265,   122,   123,    99,
+     465,   481,   482,  1068,   483,    99,   329,  1069,  1070,  1071,
+    1072,  1073,  1074,   122,   123,   484,   185,   186,   485,   188,
+     124,  1009,  1010,  1011,  1012,   487,   488,   489,   490,   491,
+     497,   498,   189,   499,   492,   190,   500,   501,   493,   502,
+     494,   495,   496,   191,   503,   504,   505,   506,   507,   587,
+     588,   589,   508,   312,   313,   314,   315,   316,   317,   318,
+     319,   320,   321,   322,   323,   324,   509,   510,   511,   512,
+     513,   139,   514,   325,   326,   515,   516,   175,     1,     2,
+       3,     4,     5,     6,     7,     8,     9,    10,    11,    12,
+      13,    14,    15,   180,   517,   519,   522,   520,   523,   524,
+     525,   526,   776,   789,   527,   327,    99,   528,   529,   530,
+     531,   533,   535,   536,   537,   541,   538,   542,   778,   790,
+     543,   328,    99,   544,   539,   545,   546,   181,   647,   547,
+     549,   550,   552,   553,   554,   551,   557,   561,   562,   555,
+     558,   565,   559,   566,   564,   567,   568,   569,   571,   570,
+     666,   572,   779,   791,   573,   329,   574,   575,   576,   577,
+     578,   580,   582,   584,   742,   595,   601,   585,   586,   590,
+     591,   592,   593,   594,   596,   597,   598,   624,   607,    34,
+     608,   609,   610,   625,   612,   611,   613,   614,   899,   626,
+     615,   616,   617,   619,   620,   622,   623,   654,   664,   629,
+     665,   708,   628,   712,   630,   631,   716,   720,   632,   724,
+     636,   637,   638,   639,   746,   749,   753,   798,   802,   640,
+     641,   642,   810,   643,   644,   645,   646,   648,   649,   650,
+     661,   662,   663,   822,   823,   824,   825,   826,   828,   829,
+     831,   832,   833,   839,   889,   838,   842,   841,   844,   845,
+     847,   848,   851,   850,   908,   865,   854,   864,   868,   867,
+     869,   870,   871,   872,   873,   874,   879,   880,   881,   894,
+     909,   893,   897,   896,   903,   904,   905,   906,   907,   911,
+     913,   916,   951,   978,   910,   979,   984,   912,   985,   914,
+     915,   987,   917,   918,   988,  1021,   993,   919,   971,   972,
+    1027,  1022,  1028,  1029,  1059,  1030,   973,  1044,  1050,  1053,
+     974,   975,  1055,   976,  1056,   980,   981,  1086,   982,  1014,
+    1015,  1062,  1016,  1017,  1018,  1025,   192,  1054,  1087,   271,
+     292,  1088,   290,   272,  1089,   929,   291,   293,   193,   934,
+     212,  1036,   209,  1051,  1090,   285,   955,   930,   303,   249,
+     956,   945,   307,  1094,  1100,   194,   618,   195,   196,   486,
+     734,  1037,   958,  1096,   931,   251,   932,   933,   776,   667,
+     518,   204,   789,   938,  1095,  1038,   210,  1039,   215,   286,
+     940,   229,   304,  1098,   778,   946,   998,  1042,   790,   207,
+     999,  1058,  1060,  1061,   222,  1097,   959,   233,   944,   252,
+    1099,  1102,  1000,   670,   920,   521,   939,   813,   922,   957,
+     952,   949,   250,   950,   969,   970,   216,   977,   779,   230,
+     924,   563,   791,   923,   948,   532,  1049,   263,   223,   556,
+     928,   234,   925,   926,   990,   560,  1001,   927,   534,   991,
+     992,   218,   989,   540,   232,   968,   807,   548,  1052,   217,
+     983,   796,   231,   967,  1103,   966,   579,   986,   583,   668,
+     669,  1008,   581,  1057,  1084,  1101,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   929,     0,     0,
-       0,   934,     0,   955,     0,     0,     0,   956,     0,   930,
-       0,     0,     0,   945,     0,     0,     0,     0,     0,   958,
-     997,     0,     0,     0,   998,   931,   932,     0,   933,   940,
-       0,     0,     0,     0,     0,   938,   999,     0,     0,   939,
-       0,     0,     0,     0,     0,     0,     0,   946,     0,     0,
-       0,     0,     0,   959,     0,     0,     0,     0,     0,     0,
-     944,     0,     0,     0,     0,     0,   957,     0,     0,     0,
-    1000
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   929,
+       0,     0,     0,   934,     0,   955,     0,     0,     0,   956,
+       0,   930,     0,     0,     0,   945,     0,     0,     0,     0,
+       0,   958,     0,   998,     0,     0,     0,   999,   931,     0,
+     932,   933,     0,     0,     0,     0,     0,   938,     0,  1000,
+       0,     0,     0,     0,   940,     0,     0,     0,     0,   946,
+       0,     0,     0,     0,     0,   959,     0,     0,     0,     0,
+       0,     0,   944,     0,     0,     0,     0,     0,   957,     0,
+     939,     0,     0,  1001
   };
 
   const short
@@ -4438,295 +4604,298 @@ namespace isc { namespace dhcp {
       74,    75,    76,    77,    78,    79,    80,    83,    82,    83,
       84,    85,    82,    83,    83,    77,   616,    77,    76,    77,
       78,    79,    80,    17,    82,    83,   610,    85,   593,   849,
-     849,    77,    77,   849,    77,    77,   849,   849,    10,    14,
-      15,    91,    78,    79,    98,    99,    78,    79,   501,    19,
-      89,   170,    76,    77,    78,    79,    80,    96,    82,    83,
-       5,    85,     7,   516,     9,     0,    77,    78,    79,    80,
-      11,   144,    13,     7,     3,    16,    17,    18,    48,     8,
-      50,    51,     3,     3,    54,    55,    56,     8,     8,     3,
-      65,    66,    48,    46,     8,    65,    66,     7,    39,    40,
-      41,    42,    43,    44,    45,    46,    47,     3,     3,    65,
-      66,    47,     8,     8,     3,     7,   170,     7,    19,     8,
-     170,   529,    58,     3,    65,    66,     7,    28,     8,    65,
-      66,    72,     7,   541,   542,   543,    77,    78,    79,    80,
-      81,   146,    83,     7,   149,   150,   151,    88,    84,    98,
-      99,    87,   137,   138,   139,   140,    97,     3,     3,   100,
-     134,   135,     8,     8,    65,    66,   107,     3,    47,    48,
-       3,   143,     8,     6,   115,   116,     7,    12,   119,   120,
-     152,   153,   154,     7,     7,     3,    65,    66,   173,   145,
-       8,   147,   148,     3,     3,   170,     6,     3,   170,     8,
-     170,  1021,  1021,    65,    66,  1021,    85,    86,  1021,  1021,
-     111,   112,   113,   114,   170,   108,   109,   110,    48,    49,
-      50,    51,    52,    53,     7,   170,   171,   172,   173,   170,
-      91,    92,    19,    94,   170,    65,    66,    24,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-      37,    38,     7,     7,     7,   117,   118,    39,    40,    41,
-      42,    48,     3,     3,     6,    47,     4,     8,     8,   170,
-       3,   855,   837,     3,     3,    57,     3,    59,     8,     8,
-      47,     8,   882,    65,    66,    67,    68,    69,    70,    71,
-      72,   170,   366,    60,    61,    62,    63,    64,    65,    66,
-       3,     8,    84,     6,     3,    87,    88,     3,   170,     8,
-       3,     3,     8,    95,     3,     8,     8,    84,     3,     8,
-      87,     3,     3,     8,     4,   399,     8,     8,     4,   403,
-     101,   102,   103,   104,   105,   106,     3,     3,     3,     6,
-     170,   415,     8,     8,   418,   403,     3,     3,     8,     6,
-       4,   425,     8,   415,     3,   415,     4,   415,     4,     4,
-     418,   435,   356,   357,     4,     4,     4,   425,     4,   415,
-     415,   445,   415,   415,   450,   445,   450,   435,     8,   403,
-     450,   450,   418,   170,     4,     4,   418,   445,   170,   425,
-       4,   415,   450,   425,   418,     4,   470,    47,     4,     3,
-       8,   425,     4,   170,   415,     4,     3,   418,     8,     4,
-       4,   435,   470,     4,   425,    65,    66,    20,    21,    22,
-      23,   445,     4,     4,   435,     4,   450,   170,     4,    39,
-      40,    41,    42,    83,     4,    45,     4,    47,    48,    89,
-      90,    91,    92,    93,    94,     4,   470,    73,    74,    75,
-      76,     4,     4,     4,     4,    65,    66,     4,    68,    69,
-     171,    71,    72,     4,     4,   171,   171,   171,     4,   171,
-       4,     4,     4,     4,    84,     4,     4,    87,     4,     4,
-       4,     4,     4,     4,     4,    95,     4,     4,   171,   483,
-     484,   485,   155,   156,   157,   158,   159,   160,   161,   162,
-     163,   164,   165,   166,   167,   168,   169,     4,     4,     4,
-       4,   585,   173,     4,     4,     4,     4,   591,     4,   171,
-     170,    65,    66,     4,     4,     4,   173,     4,     4,   171,
-       4,     4,     4,   591,   171,     4,   171,     4,     4,     4,
-       4,     4,   616,   617,     4,   619,   171,     4,     4,     4,
-     173,     4,   173,     4,     4,   173,   173,     4,   616,   617,
-     170,   619,     4,     4,   171,     4,   171,   591,   562,     4,
-     171,     4,     4,     4,     4,   173,     4,   121,   122,   123,
-     124,   125,   126,   127,   128,   129,   130,   131,   132,   133,
-     584,     4,   616,   617,     4,   619,   173,   141,   142,     7,
-       7,     7,     7,     7,     7,     5,   170,     5,     5,     5,
-     170,     5,     7,     5,     5,     5,   170,     5,     7,     5,
-       5,   170,   170,     7,     7,     7,   170,     7,     5,     5,
-       5,   170,   170,     7,   136,   170,     5,     5,    82,     6,
-     170,     7,     7,   170,     7,     7,     7,     7,     7,     7,
-       7,   170,     7,     7,   170,   170,   170,   170,   170,   170,
-     170,   170,   170,   170,   170,   170,   170,   170,     4,   170,
+     849,   849,    77,   849,    77,    77,   849,    10,    14,    15,
+       7,    91,    78,    79,     0,     5,     7,     7,    77,     9,
+     501,    19,    76,    77,    78,    79,    80,    89,    82,    83,
+       3,    85,     7,     6,    96,   516,    77,    78,    79,    80,
+      65,    66,    11,    47,    13,    78,    79,    16,    17,    18,
+      48,   529,    50,    51,    98,    99,    54,    55,    56,    65,
+      66,    65,    66,   541,   542,   543,     3,    65,    66,     6,
+      39,    40,    41,    42,    43,    44,    45,    46,    47,    83,
+      73,    74,    75,    76,     7,    89,    90,    91,    92,    93,
+      94,     7,   117,   118,   174,     3,    65,    66,    47,    48,
+       8,     3,    47,    72,    91,    92,     8,    94,    77,    78,
+      79,    80,    81,    58,    83,    19,    65,    66,     3,    88,
+      65,    66,     3,     8,    28,     7,     3,     8,    97,     6,
+     174,   100,   137,   138,   139,   140,    85,    86,   107,    84,
+     143,     3,    87,     3,     6,   174,   115,   116,     8,   174,
+     119,   120,     3,   156,   157,   158,    46,     8,     3,     3,
+       3,    65,    66,     8,     8,     8,     3,     7,   174,     6,
+     174,   174,   177,  1023,  1023,  1023,   174,  1023,    98,    99,
+    1023,   134,   135,    19,   174,   175,   176,   177,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,    37,    38,     7,     7,   174,     3,   111,   112,   113,
+     114,     8,    48,   108,   109,   110,     7,     3,    39,    40,
+      41,    42,     8,     3,     7,   174,    47,   144,     8,   174,
+     101,   102,   103,   104,   105,   106,    57,     7,    59,     7,
+      47,   855,   837,     7,    65,    66,    67,    68,    69,    70,
+      71,    72,   882,    60,    61,    62,    63,    64,    65,    66,
+       3,    12,   366,    84,     3,     8,    87,    88,     3,     8,
+     174,     3,     6,     8,    95,     3,     8,    84,     4,     8,
+      87,     3,     3,    48,    49,    50,    51,    52,    53,    48,
+       4,     3,     3,     3,     3,   399,     8,     8,     8,   403,
+      65,    66,     4,     3,     3,     3,    65,    66,     8,     8,
+       8,   415,     3,     3,   418,   403,     4,     8,     8,     3,
+       3,   425,     4,   415,     8,   415,     4,   415,     4,     3,
+     418,   435,   356,   357,     8,     4,     4,   425,   174,     4,
+     415,   445,   415,   415,   450,   445,   450,   435,     4,   403,
+     450,   450,   418,   174,     4,     3,   415,   445,     3,   425,
+       8,   415,   450,     8,   418,     3,   470,   174,     4,     4,
+       8,   425,   174,     4,   415,     8,     8,   418,     4,     8,
+       4,   435,   470,     4,   425,   418,   145,     4,   147,   148,
+     149,   445,   425,     8,   435,     4,   450,    39,    40,    41,
+      42,     4,     4,    45,     4,    47,    48,    65,    66,   174,
+       4,     4,     4,   146,     4,   174,   470,   150,   151,   152,
+     153,   154,   155,    65,    66,     4,    68,    69,     4,    71,
+      72,    20,    21,    22,    23,     4,     4,     4,     4,     4,
+       4,     4,    84,     4,   175,    87,     4,     4,   175,     4,
+     175,   175,   175,    95,     4,     4,     4,     4,     4,   483,
+     484,   485,     4,   121,   122,   123,   124,   125,   126,   127,
+     128,   129,   130,   131,   132,   133,     4,     4,     4,     4,
+       4,   585,   175,   141,   142,     4,     4,   591,   159,   160,
+     161,   162,   163,   164,   165,   166,   167,   168,   169,   170,
+     171,   172,   173,   591,     4,     4,     4,   177,     4,     4,
+       4,     4,   616,   617,   175,   619,   174,   177,     4,     4,
+       4,     4,     4,   175,     4,     4,   175,     4,   616,   617,
+       4,   619,   174,     4,   175,     4,     4,   591,   562,     4,
+       4,     4,     4,     4,     4,   175,     4,     4,     4,   177,
+     177,     4,   177,     4,   177,   175,     4,   175,     4,   175,
+     584,     4,   616,   617,   177,   619,   177,     4,     4,     4,
+       4,     4,     4,     4,    82,   174,   174,     7,     7,     7,
+       7,     7,     7,     5,     5,     5,     5,   174,     5,     7,
+       5,     5,     5,   174,     5,     7,     5,     5,     8,   174,
+       7,     7,     7,     7,     5,     5,     5,   136,     5,     7,
+       5,     7,   174,     7,   174,   174,     7,     7,   174,     7,
+     174,   174,   174,   174,     7,     7,     7,     7,     7,   174,
+     174,   174,     7,   174,   174,   174,   174,   174,   174,   174,
+     174,   174,   174,     4,     4,     4,     4,     4,     4,     4,
+       4,     4,     4,     3,   174,     6,     3,     6,     6,     3,
+       6,     3,     3,     6,   175,     3,     6,     6,     3,     6,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     3,
-       3,     6,     3,   170,     6,     3,     6,     6,     3,     6,
-       6,     3,     6,     3,     5,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     3,   173,     6,     3,     6,     4,
-     171,     8,     6,     4,     4,     4,     4,   171,     4,     4,
-       4,   173,   171,   171,     4,   171,   171,     4,   171,     4,
-       6,     3,   170,   173,   171,   171,     4,   171,     8,     8,
-       4,     8,   171,     3,   171,   171,   171,   171,   171,   170,
-     170,   170,   170,   170,     8,   170,   170,     4,   170,   170,
-       4,   170,     4,     4,     7,     4,   840,     4,     4,   843,
-     846,   173,   846,   843,     4,   849,   846,   846,   840,   849,
-     840,   516,   840,   609,   171,   843,   860,   849,   846,   863,
-     860,   849,   866,   171,   840,   840,   585,   840,   840,   170,
-     170,   173,   860,   849,   849,   863,   849,   849,   882,   366,
-     399,   591,   886,   849,   665,   171,   840,   849,   892,   843,
-     170,   895,   846,   403,   882,   849,   900,   839,   886,   840,
-     900,   834,   858,   852,   892,   855,   860,   895,   849,   863,
-     868,   866,   900,   842,   875,   840,   415,   851,  1021,   860,
-      81,   848,   863,   845,   843,   445,   892,   453,   882,   895,
-     892,   894,   886,   895,   846,   450,   895,   897,   892,   892,
-     425,   895,   418,   863,   865,   861,   900,   435,   629,  1027,
-     882,   892,   619,   470,   895,   886,   586,   473,   476,   590,
-    1044,   901,  1061,  1078,    -1,    -1,    -1,    -1,    -1,    -1,
+     177,     6,     3,     6,     6,     4,     4,     4,     4,   177,
+       4,     4,     4,     4,   175,     4,     4,   175,     4,   175,
+     175,     6,   175,   175,     3,     8,     4,   177,   175,   175,
+       4,     8,     8,     3,     5,     8,   175,     4,     4,     4,
+     175,   175,     4,   175,     4,   175,   175,     4,   175,   174,
+     174,     7,   174,   174,   174,   174,   840,   175,     4,   843,
+     846,     4,   846,   843,     4,   849,   846,   846,   840,   849,
+     840,   174,   840,   177,     4,   843,   860,   849,   846,   863,
+     860,   849,   866,     4,     4,   840,   516,   840,   840,   366,
+     609,   174,   860,   175,   849,   863,   849,   849,   882,   585,
+     399,   840,   886,   849,   177,   174,   840,   174,   892,   843,
+     849,   895,   846,   177,   882,   849,   900,   174,   886,   840,
+     900,   174,   174,   174,   892,   175,   860,   895,   849,   863,
+     175,   174,   900,   591,   834,   403,   849,   665,   839,   860,
+     858,   852,   863,   855,   866,   868,   892,   875,   882,   895,
+     842,   453,   886,   840,   851,   415,  1023,    81,   892,   445,
+     848,   895,   843,   845,   894,   450,   900,   846,   418,   895,
+     897,   892,   892,   425,   895,   865,   629,   435,  1029,   892,
+     882,   619,   895,   863,   174,   861,   470,   886,   476,   586,
+     590,   901,   473,  1047,  1066,  1092,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1021,    -1,    -1,
-      -1,  1021,    -1,  1027,    -1,    -1,    -1,  1027,    -1,  1021,
-      -1,    -1,    -1,  1021,    -1,    -1,    -1,    -1,    -1,  1027,
-    1044,    -1,    -1,    -1,  1044,  1021,  1021,    -1,  1021,  1021,
-      -1,    -1,    -1,    -1,    -1,  1021,  1044,    -1,    -1,  1021,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,  1021,    -1,    -1,
-      -1,    -1,    -1,  1027,    -1,    -1,    -1,    -1,    -1,    -1,
-    1021,    -1,    -1,    -1,    -1,    -1,  1027,    -1,    -1,    -1,
-    1044
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,  1023,
+      -1,    -1,    -1,  1023,    -1,  1029,    -1,    -1,    -1,  1029,
+      -1,  1023,    -1,    -1,    -1,  1023,    -1,    -1,    -1,    -1,
+      -1,  1029,    -1,  1047,    -1,    -1,    -1,  1047,  1023,    -1,
+    1023,  1023,    -1,    -1,    -1,    -1,    -1,  1023,    -1,  1047,
+      -1,    -1,    -1,    -1,  1023,    -1,    -1,    -1,    -1,  1023,
+      -1,    -1,    -1,    -1,    -1,  1029,    -1,    -1,    -1,    -1,
+      -1,    -1,  1023,    -1,    -1,    -1,    -1,    -1,  1029,    -1,
+    1023,    -1,    -1,  1047
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yystos_[] =
   {
-       0,   155,   156,   157,   158,   159,   160,   161,   162,   163,
-     164,   165,   166,   167,   168,   169,   175,   176,   177,   178,
-     179,   180,   181,   182,   183,   184,   185,   186,   187,   188,
-     189,   190,     0,     5,     7,     9,   170,   171,   172,   173,
-     191,   192,   193,   198,     7,   207,     7,   213,     7,   226,
-       7,   320,     7,   397,     7,   413,     7,   430,     7,   349,
-       7,   355,     7,   379,     7,   296,     7,   491,     7,   537,
-       7,   529,   199,   194,   208,   214,   227,   321,   398,   414,
-     431,   350,   356,   380,   297,   492,   538,   530,   191,   200,
-     201,   170,   196,   197,    10,   143,   152,   153,   154,   170,
-     206,   209,   210,   211,   521,   523,   525,   535,    11,    13,
+       0,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   179,   180,   181,   182,
+     183,   184,   185,   186,   187,   188,   189,   190,   191,   192,
+     193,   194,     0,     5,     7,     9,   174,   175,   176,   177,
+     195,   196,   197,   202,     7,   211,     7,   217,     7,   230,
+       7,   324,     7,   401,     7,   417,     7,   434,     7,   353,
+       7,   359,     7,   383,     7,   300,     7,   495,     7,   541,
+       7,   533,   203,   198,   212,   218,   231,   325,   402,   418,
+     435,   354,   360,   384,   301,   496,   542,   534,   195,   204,
+     205,   174,   200,   201,    10,   143,   156,   157,   158,   174,
+     210,   213,   214,   215,   525,   527,   529,   539,    11,    13,
       16,    17,    18,    39,    40,    41,    42,    43,    44,    45,
       46,    47,    65,    66,    72,    77,    78,    79,    80,    81,
-      83,    88,    97,   100,   107,   115,   116,   119,   120,   206,
-     215,   216,   217,   218,   219,   220,   221,   222,   224,   233,
-     235,   237,   270,   276,   282,   288,   290,   304,   314,   334,
-     339,   347,   373,   403,   405,   424,   454,   466,   478,   479,
-     487,   489,   527,    14,    15,   206,   228,   229,   230,   232,
-     403,   405,    57,    59,    67,    68,    69,    70,    71,    84,
-      87,    95,   206,   217,   218,   219,   220,   322,   323,   324,
-     326,   328,   330,   332,   334,   337,   338,   373,   391,   403,
-     405,   407,   424,   449,    58,   206,   330,   332,   373,   399,
-     400,   401,   403,   405,    60,    61,    62,    63,    64,   206,
-     330,   332,   373,   403,   405,   415,   416,   417,   419,   420,
-     422,   423,    83,    89,    90,    91,    92,    93,    94,   206,
-     373,   403,   405,   432,   433,   434,   435,   437,   439,   441,
-     443,   445,   447,   347,    19,    48,    50,    51,    54,    55,
-      56,   206,   255,   357,   358,   359,   360,   361,   362,   363,
-     365,   367,   369,   370,   372,   403,   405,    49,    52,    53,
-     206,   255,   361,   367,   381,   382,   383,   384,   385,   387,
-     388,   389,   390,   403,   405,    98,    99,   206,   298,   299,
-     300,   302,   121,   122,   123,   124,   125,   126,   127,   128,
-     129,   130,   131,   132,   133,   141,   142,   206,   403,   405,
-     493,   494,   495,   496,   498,   500,   501,   503,   504,   505,
-     508,   510,   511,   512,   515,   517,   519,   144,   539,   540,
-     541,    12,   531,   532,   533,     6,     3,     4,     8,     3,
-     212,   536,   522,   524,   526,     4,     3,     8,   528,   225,
-     234,   236,   238,     4,     4,     4,     4,     4,   223,   315,
-     348,   374,   404,   406,   335,   340,   277,   289,   283,   271,
-     455,   425,   291,   305,   467,     4,   480,   488,   490,     3,
-       8,   231,     4,     3,     8,   392,   408,   325,   327,   329,
-       4,     4,   333,   331,   450,     3,     8,   402,     3,     8,
-     418,     4,   421,     4,     4,     3,     8,   448,   436,   438,
-     440,   442,   444,   446,     8,     3,     8,   364,   256,     4,
-     368,   366,   371,     4,     8,     3,   386,     4,     4,     8,
-       3,   301,   303,     3,     8,     4,   497,   499,     4,   502,
-       4,     4,   506,   509,     4,     4,   513,   516,   518,   520,
-       3,     8,   542,     3,     8,   534,     3,     8,   191,   191,
-     170,     4,     4,     4,     4,     4,   210,     4,     4,     4,
-       4,     4,   171,   171,   171,   171,   171,     4,     4,     4,
+      83,    88,    97,   100,   107,   115,   116,   119,   120,   210,
+     219,   220,   221,   222,   223,   224,   225,   226,   228,   237,
+     239,   241,   274,   280,   286,   292,   294,   308,   318,   338,
+     343,   351,   377,   407,   409,   428,   458,   470,   482,   483,
+     491,   493,   531,    14,    15,   210,   232,   233,   234,   236,
+     407,   409,    57,    59,    67,    68,    69,    70,    71,    84,
+      87,    95,   210,   221,   222,   223,   224,   326,   327,   328,
+     330,   332,   334,   336,   338,   341,   342,   377,   395,   407,
+     409,   411,   428,   453,    58,   210,   334,   336,   377,   403,
+     404,   405,   407,   409,    60,    61,    62,    63,    64,   210,
+     334,   336,   377,   407,   409,   419,   420,   421,   423,   424,
+     426,   427,    83,    89,    90,    91,    92,    93,    94,   210,
+     377,   407,   409,   436,   437,   438,   439,   441,   443,   445,
+     447,   449,   451,   351,    19,    48,    50,    51,    54,    55,
+      56,   210,   259,   361,   362,   363,   364,   365,   366,   367,
+     369,   371,   373,   374,   376,   407,   409,    49,    52,    53,
+     210,   259,   365,   371,   385,   386,   387,   388,   389,   391,
+     392,   393,   394,   407,   409,    98,    99,   210,   302,   303,
+     304,   306,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   130,   131,   132,   133,   141,   142,   210,   407,   409,
+     497,   498,   499,   500,   502,   504,   505,   507,   508,   509,
+     512,   514,   515,   516,   519,   521,   523,   144,   543,   544,
+     545,    12,   535,   536,   537,     6,     3,     4,     8,     3,
+     216,   540,   526,   528,   530,     4,     3,     8,   532,   229,
+     238,   240,   242,     4,     4,     4,     4,     4,   227,   319,
+     352,   378,   408,   410,   339,   344,   281,   293,   287,   275,
+     459,   429,   295,   309,   471,     4,   484,   492,   494,     3,
+       8,   235,     4,     3,     8,   396,   412,   329,   331,   333,
+       4,     4,   337,   335,   454,     3,     8,   406,     3,     8,
+     422,     4,   425,     4,     4,     3,     8,   452,   440,   442,
+     444,   446,   448,   450,     8,     3,     8,   368,   260,     4,
+     372,   370,   375,     4,     8,     3,   390,     4,     4,     8,
+       3,   305,   307,     3,     8,     4,   501,   503,     4,   506,
+       4,     4,   510,   513,     4,     4,   517,   520,   522,   524,
+       3,     8,   546,     3,     8,   538,     3,     8,   195,   195,
+     174,     4,     4,     4,     4,     4,   214,     4,     4,     4,
+       4,     4,   175,   175,   175,   175,   175,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   171,     4,     4,     4,   216,     4,
-     173,   229,     4,     4,     4,     4,     4,   171,   173,     4,
-       4,     4,   323,     4,   400,     4,   171,     4,   171,   171,
-     416,     4,     4,     4,     4,     4,     4,     4,   434,     4,
-       4,   171,     4,     4,     4,   173,   359,     4,   173,   173,
-     383,     4,     4,   299,   173,     4,     4,   171,     4,   171,
-     171,     4,     4,   173,   173,     4,     4,     4,     4,   494,
-       4,   540,     4,   532,     4,     7,     7,   191,   191,   191,
-       7,     7,     7,     7,     5,   170,     5,     5,     5,   193,
-     195,   170,    73,    74,    75,    76,   336,     5,     5,     5,
-       5,     7,     5,     5,     5,     7,     7,     7,   195,     7,
-       5,   202,     5,     5,   170,   170,   170,   202,   170,     7,
-     170,   170,   170,   202,   202,   202,   170,   170,   170,   170,
-     170,   170,   170,   170,   170,   170,   170,   191,   170,   170,
-     170,   134,   135,   507,   136,   137,   138,   139,   140,   173,
-     514,   170,   170,   170,     5,     5,   191,   215,   539,   531,
-     228,    19,    24,    25,    26,    27,    28,    29,    30,    31,
-      32,    33,    34,    35,    36,    37,    38,   206,   243,   244,
-     245,   248,   250,   252,   254,   255,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   267,   268,   243,     7,   239,
-     240,   241,     7,   316,   317,   318,     7,   351,   352,   353,
-       7,   375,   376,   377,     7,   341,   342,   343,    91,   170,
-     278,   279,   280,   281,   200,    92,    94,   280,   284,   285,
-     286,   287,    82,   272,   273,   274,     7,   456,   457,     7,
-     426,   427,   428,     7,   292,   293,   294,   101,   102,   103,
-     104,   105,   106,   306,   307,   308,   309,   310,   311,   312,
-     313,    19,   111,   112,   113,   114,   206,   257,   403,   405,
-     468,   469,   470,   473,   474,   476,   477,   117,   118,   206,
-     403,   405,   481,   482,   483,   485,   493,   203,     7,   393,
-     394,   395,     7,   409,   410,   411,    96,   435,   451,   452,
-       7,   543,   544,   239,     8,     8,     8,     8,   246,   249,
-     251,   253,     4,     4,     4,     4,     4,   266,     4,     4,
-     269,     4,     4,     4,     3,     8,     8,   242,     6,     3,
-     319,     6,     3,   354,     6,     3,   378,     6,     3,   344,
-       6,     3,     3,     6,     6,     3,     6,   275,     3,     8,
-     458,     3,     6,   429,     6,     3,   295,     6,     3,     4,
-       4,     4,     4,     4,     4,     3,     8,   471,   475,     4,
-       4,     4,     3,     8,   484,   486,     3,     8,     8,   170,
-     204,   205,   396,     6,     3,   412,     6,     3,   453,     8,
-     545,     3,     6,     6,     4,     4,     4,     4,   171,   173,
-     171,   173,   171,     4,   171,   171,     4,   171,   171,   173,
-     244,   243,   241,   322,   318,   357,   353,   381,   377,   206,
-     217,   218,   219,   220,   255,   314,   326,   328,   330,   332,
-     334,   338,   345,   346,   373,   403,   405,   449,   343,   279,
-     285,     4,   273,    85,    86,   206,   255,   373,   403,   405,
-     459,   460,   461,   462,   463,   465,   457,   432,   428,   298,
-     294,   171,   171,   171,   171,   171,   171,   307,     4,     4,
-     171,   171,   171,   469,     4,     4,   482,     6,     3,   399,
-     395,   415,   411,     4,   145,   147,   148,   206,   255,   403,
-     405,   546,   547,   548,   549,   551,   544,    20,    21,    22,
-      23,   247,   170,   170,   170,   170,   170,     8,     8,     8,
-       8,     3,     8,   170,   464,     4,     8,     3,     8,     8,
-     108,   109,   110,   472,   170,   170,   170,   170,     8,     8,
-     170,   552,     4,   550,     3,     8,   346,     4,   173,   461,
-       4,   171,     4,   547,   170,     5,   170,     7,   553,   554,
-     555,     3,     6,   146,   149,   150,   151,   556,   557,   558,
-     560,   561,   562,   554,   559,     4,     4,     4,     3,     8,
-       4,   173,   171,   171,   557,   170
+       4,     4,     4,     4,   175,     4,     4,     4,   220,     4,
+     177,   233,     4,     4,     4,     4,     4,   175,   177,     4,
+       4,     4,   327,     4,   404,     4,   175,     4,   175,   175,
+     420,     4,     4,     4,     4,     4,     4,     4,   438,     4,
+       4,   175,     4,     4,     4,   177,   363,     4,   177,   177,
+     387,     4,     4,   303,   177,     4,     4,   175,     4,   175,
+     175,     4,     4,   177,   177,     4,     4,     4,     4,   498,
+       4,   544,     4,   536,     4,     7,     7,   195,   195,   195,
+       7,     7,     7,     7,     5,   174,     5,     5,     5,   197,
+     199,   174,    73,    74,    75,    76,   340,     5,     5,     5,
+       5,     7,     5,     5,     5,     7,     7,     7,   199,     7,
+       5,   206,     5,     5,   174,   174,   174,   206,   174,     7,
+     174,   174,   174,   206,   206,   206,   174,   174,   174,   174,
+     174,   174,   174,   174,   174,   174,   174,   195,   174,   174,
+     174,   134,   135,   511,   136,   137,   138,   139,   140,   177,
+     518,   174,   174,   174,     5,     5,   195,   219,   543,   535,
+     232,    19,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,   210,   247,   248,
+     249,   252,   254,   256,   258,   259,   261,   262,   263,   264,
+     265,   266,   267,   268,   269,   271,   272,   247,     7,   243,
+     244,   245,     7,   320,   321,   322,     7,   355,   356,   357,
+       7,   379,   380,   381,     7,   345,   346,   347,    91,   174,
+     282,   283,   284,   285,   204,    92,    94,   284,   288,   289,
+     290,   291,    82,   276,   277,   278,     7,   460,   461,     7,
+     430,   431,   432,     7,   296,   297,   298,   101,   102,   103,
+     104,   105,   106,   310,   311,   312,   313,   314,   315,   316,
+     317,    19,   111,   112,   113,   114,   210,   261,   407,   409,
+     472,   473,   474,   477,   478,   480,   481,   117,   118,   210,
+     407,   409,   485,   486,   487,   489,   497,   207,     7,   397,
+     398,   399,     7,   413,   414,   415,    96,   439,   455,   456,
+       7,   547,   548,   243,     8,     8,     8,     8,   250,   253,
+     255,   257,     4,     4,     4,     4,     4,   270,     4,     4,
+     273,     4,     4,     4,     3,     8,     8,   246,     6,     3,
+     323,     6,     3,   358,     6,     3,   382,     6,     3,   348,
+       6,     3,     3,     6,     6,     3,     6,   279,     3,     8,
+     462,     3,     6,   433,     6,     3,   299,     6,     3,     4,
+       4,     4,     4,     4,     4,     3,     8,   475,   479,     4,
+       4,     4,     3,     8,   488,   490,     3,     8,     8,   174,
+     208,   209,   400,     6,     3,   416,     6,     3,   457,     8,
+     549,     3,     6,     6,     4,     4,     4,     4,   175,   177,
+     175,   177,   175,     4,   175,   175,     4,   175,   175,   177,
+     248,   247,   245,   326,   322,   361,   357,   385,   381,   210,
+     221,   222,   223,   224,   259,   318,   330,   332,   334,   336,
+     338,   342,   349,   350,   377,   407,   409,   453,   347,   283,
+     289,     4,   277,    85,    86,   210,   259,   377,   407,   409,
+     463,   464,   465,   466,   467,   469,   461,   436,   432,   302,
+     298,   175,   175,   175,   175,   175,   175,   311,     4,     4,
+     175,   175,   175,   473,     4,     4,   486,     6,     3,   403,
+     399,   419,   415,     4,   145,   147,   148,   149,   210,   259,
+     407,   409,   550,   551,   552,   553,   555,   557,   548,    20,
+      21,    22,    23,   251,   174,   174,   174,   174,   174,     8,
+       8,     8,     8,     3,     8,   174,   468,     4,     8,     3,
+       8,     8,   108,   109,   110,   476,   174,   174,   174,   174,
+       8,     8,   174,   558,     4,   556,   554,     3,     8,   350,
+       4,   177,   465,     4,   175,     4,     4,   551,   174,     5,
+     174,   174,     7,   559,   560,   561,     3,     6,   146,   150,
+     151,   152,   153,   154,   155,   562,   563,   564,   566,   567,
+     568,   569,   570,   571,   560,   565,     4,     4,     4,     4,
+       4,   572,     3,     8,     4,   177,   175,   175,   177,   175,
+       4,   563,   174,   174
   };
 
-  const unsigned short
+  const short
   Dhcp6Parser::yyr1_[] =
   {
-       0,   174,   176,   175,   177,   175,   178,   175,   179,   175,
-     180,   175,   181,   175,   182,   175,   183,   175,   184,   175,
-     185,   175,   186,   175,   187,   175,   188,   175,   189,   175,
-     190,   175,   191,   191,   191,   191,   191,   191,   191,   192,
-     194,   193,   195,   196,   196,   197,   197,   199,   198,   200,
-     200,   201,   201,   203,   202,   204,   204,   205,   205,   206,
-     208,   207,   209,   209,   210,   210,   210,   210,   210,   210,
-     212,   211,   214,   213,   215,   215,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   216,   216,
-     216,   216,   216,   216,   216,   216,   216,   216,   217,   218,
-     219,   220,   221,   223,   222,   225,   224,   227,   226,   228,
-     228,   229,   229,   229,   229,   229,   231,   230,   232,   234,
-     233,   236,   235,   238,   237,   239,   239,   240,   240,   242,
-     241,   243,   243,   244,   244,   244,   244,   244,   244,   244,
-     244,   244,   244,   244,   244,   244,   244,   244,   244,   244,
-     244,   246,   245,   247,   247,   247,   247,   249,   248,   251,
-     250,   253,   252,   254,   256,   255,   257,   258,   259,   260,
-     261,   262,   263,   264,   266,   265,   267,   269,   268,   271,
-     270,   272,   272,   273,   275,   274,   277,   276,   278,   278,
-     279,   279,   280,   281,   283,   282,   284,   284,   285,   285,
-     285,   286,   287,   289,   288,   291,   290,   292,   292,   293,
-     293,   295,   294,   297,   296,   298,   298,   298,   299,   299,
-     301,   300,   303,   302,   305,   304,   306,   306,   307,   307,
-     307,   307,   307,   307,   308,   309,   310,   311,   312,   313,
-     315,   314,   316,   316,   317,   317,   319,   318,   321,   320,
-     322,   322,   323,   323,   323,   323,   323,   323,   323,   323,
-     323,   323,   323,   323,   323,   323,   323,   323,   323,   323,
-     323,   323,   325,   324,   327,   326,   329,   328,   331,   330,
-     333,   332,   335,   334,   336,   336,   336,   336,   337,   338,
-     340,   339,   341,   341,   342,   342,   344,   343,   345,   345,
-     346,   346,   346,   346,   346,   346,   346,   346,   346,   346,
-     346,   346,   346,   346,   346,   346,   346,   348,   347,   350,
-     349,   351,   351,   352,   352,   354,   353,   356,   355,   357,
-     357,   358,   358,   359,   359,   359,   359,   359,   359,   359,
-     359,   359,   359,   360,   361,   362,   364,   363,   366,   365,
-     368,   367,   369,   371,   370,   372,   374,   373,   375,   375,
-     376,   376,   378,   377,   380,   379,   381,   381,   382,   382,
-     383,   383,   383,   383,   383,   383,   383,   383,   383,   384,
-     386,   385,   387,   388,   389,   390,   392,   391,   393,   393,
-     394,   394,   396,   395,   398,   397,   399,   399,   400,   400,
-     400,   400,   400,   400,   400,   402,   401,   404,   403,   406,
-     405,   408,   407,   409,   409,   410,   410,   412,   411,   414,
-     413,   415,   415,   416,   416,   416,   416,   416,   416,   416,
-     416,   416,   416,   416,   418,   417,   419,   421,   420,   422,
-     423,   425,   424,   426,   426,   427,   427,   429,   428,   431,
-     430,   432,   432,   433,   433,   434,   434,   434,   434,   434,
-     434,   434,   434,   434,   434,   434,   436,   435,   438,   437,
-     440,   439,   442,   441,   444,   443,   446,   445,   448,   447,
-     450,   449,   451,   451,   453,   452,   455,   454,   456,   456,
-     458,   457,   459,   459,   460,   460,   461,   461,   461,   461,
-     461,   461,   461,   462,   464,   463,   465,   467,   466,   468,
-     468,   469,   469,   469,   469,   469,   469,   469,   469,   469,
-     471,   470,   472,   472,   472,   473,   475,   474,   476,   477,
-     478,   480,   479,   481,   481,   482,   482,   482,   482,   482,
-     484,   483,   486,   485,   488,   487,   490,   489,   492,   491,
-     493,   493,   494,   494,   494,   494,   494,   494,   494,   494,
-     494,   494,   494,   494,   494,   494,   494,   494,   494,   494,
-     495,   497,   496,   499,   498,   500,   502,   501,   503,   504,
-     506,   505,   507,   507,   509,   508,   510,   511,   513,   512,
-     514,   514,   514,   514,   514,   516,   515,   518,   517,   520,
-     519,   522,   521,   524,   523,   526,   525,   528,   527,   530,
-     529,   531,   531,   532,   534,   533,   536,   535,   538,   537,
-     539,   539,   540,   542,   541,   543,   543,   545,   544,   546,
-     546,   547,   547,   547,   547,   547,   547,   547,   548,   550,
-     549,   552,   551,   553,   553,   555,   554,   556,   556,   557,
-     557,   557,   557,   559,   558,   560,   561,   562
+       0,   178,   180,   179,   181,   179,   182,   179,   183,   179,
+     184,   179,   185,   179,   186,   179,   187,   179,   188,   179,
+     189,   179,   190,   179,   191,   179,   192,   179,   193,   179,
+     194,   179,   195,   195,   195,   195,   195,   195,   195,   196,
+     198,   197,   199,   200,   200,   201,   201,   203,   202,   204,
+     204,   205,   205,   207,   206,   208,   208,   209,   209,   210,
+     212,   211,   213,   213,   214,   214,   214,   214,   214,   214,
+     216,   215,   218,   217,   219,   219,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   220,   220,
+     220,   220,   220,   220,   220,   220,   220,   220,   221,   222,
+     223,   224,   225,   227,   226,   229,   228,   231,   230,   232,
+     232,   233,   233,   233,   233,   233,   235,   234,   236,   238,
+     237,   240,   239,   242,   241,   243,   243,   244,   244,   246,
+     245,   247,   247,   248,   248,   248,   248,   248,   248,   248,
+     248,   248,   248,   248,   248,   248,   248,   248,   248,   248,
+     248,   250,   249,   251,   251,   251,   251,   253,   252,   255,
+     254,   257,   256,   258,   260,   259,   261,   262,   263,   264,
+     265,   266,   267,   268,   270,   269,   271,   273,   272,   275,
+     274,   276,   276,   277,   279,   278,   281,   280,   282,   282,
+     283,   283,   284,   285,   287,   286,   288,   288,   289,   289,
+     289,   290,   291,   293,   292,   295,   294,   296,   296,   297,
+     297,   299,   298,   301,   300,   302,   302,   302,   303,   303,
+     305,   304,   307,   306,   309,   308,   310,   310,   311,   311,
+     311,   311,   311,   311,   312,   313,   314,   315,   316,   317,
+     319,   318,   320,   320,   321,   321,   323,   322,   325,   324,
+     326,   326,   327,   327,   327,   327,   327,   327,   327,   327,
+     327,   327,   327,   327,   327,   327,   327,   327,   327,   327,
+     327,   327,   329,   328,   331,   330,   333,   332,   335,   334,
+     337,   336,   339,   338,   340,   340,   340,   340,   341,   342,
+     344,   343,   345,   345,   346,   346,   348,   347,   349,   349,
+     350,   350,   350,   350,   350,   350,   350,   350,   350,   350,
+     350,   350,   350,   350,   350,   350,   350,   352,   351,   354,
+     353,   355,   355,   356,   356,   358,   357,   360,   359,   361,
+     361,   362,   362,   363,   363,   363,   363,   363,   363,   363,
+     363,   363,   363,   364,   365,   366,   368,   367,   370,   369,
+     372,   371,   373,   375,   374,   376,   378,   377,   379,   379,
+     380,   380,   382,   381,   384,   383,   385,   385,   386,   386,
+     387,   387,   387,   387,   387,   387,   387,   387,   387,   388,
+     390,   389,   391,   392,   393,   394,   396,   395,   397,   397,
+     398,   398,   400,   399,   402,   401,   403,   403,   404,   404,
+     404,   404,   404,   404,   404,   406,   405,   408,   407,   410,
+     409,   412,   411,   413,   413,   414,   414,   416,   415,   418,
+     417,   419,   419,   420,   420,   420,   420,   420,   420,   420,
+     420,   420,   420,   420,   422,   421,   423,   425,   424,   426,
+     427,   429,   428,   430,   430,   431,   431,   433,   432,   435,
+     434,   436,   436,   437,   437,   438,   438,   438,   438,   438,
+     438,   438,   438,   438,   438,   438,   440,   439,   442,   441,
+     444,   443,   446,   445,   448,   447,   450,   449,   452,   451,
+     454,   453,   455,   455,   457,   456,   459,   458,   460,   460,
+     462,   461,   463,   463,   464,   464,   465,   465,   465,   465,
+     465,   465,   465,   466,   468,   467,   469,   471,   470,   472,
+     472,   473,   473,   473,   473,   473,   473,   473,   473,   473,
+     475,   474,   476,   476,   476,   477,   479,   478,   480,   481,
+     482,   484,   483,   485,   485,   486,   486,   486,   486,   486,
+     488,   487,   490,   489,   492,   491,   494,   493,   496,   495,
+     497,   497,   498,   498,   498,   498,   498,   498,   498,   498,
+     498,   498,   498,   498,   498,   498,   498,   498,   498,   498,
+     499,   501,   500,   503,   502,   504,   506,   505,   507,   508,
+     510,   509,   511,   511,   513,   512,   514,   515,   517,   516,
+     518,   518,   518,   518,   518,   520,   519,   522,   521,   524,
+     523,   526,   525,   528,   527,   530,   529,   532,   531,   534,
+     533,   535,   535,   536,   538,   537,   540,   539,   542,   541,
+     543,   543,   544,   546,   545,   547,   547,   549,   548,   550,
+     550,   551,   551,   551,   551,   551,   551,   551,   551,   552,
+     554,   553,   556,   555,   558,   557,   559,   559,   561,   560,
+     562,   562,   563,   563,   563,   563,   563,   563,   563,   565,
+     564,   566,   567,   568,   569,   570,   572,   571
   };
 
-  const unsigned char
+  const signed char
   Dhcp6Parser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     3,
@@ -4793,39 +4962,40 @@ namespace isc { namespace dhcp {
        4,     0,     4,     0,     4,     0,     4,     0,     6,     0,
        4,     1,     3,     1,     0,     6,     0,     6,     0,     4,
        1,     3,     1,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     3,     0,
-       4,     0,     6,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     3,     3,     3
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       0,     4,     0,     4,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     3,     3,     3,     3,     0,     4
   };
 
 
-
+#if PARSER6_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const Dhcp6Parser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"", "\"config-control\"",
-  "\"config-databases\"", "\"interfaces-config\"", "\"interfaces\"",
-  "\"re-detect\"", "\"lease-database\"", "\"hosts-database\"",
-  "\"hosts-databases\"", "\"type\"", "\"memfile\"", "\"mysql\"",
-  "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
-  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"max-reconnect-tries\"",
-  "\"reconnect-wait-time\"", "\"keyspace\"", "\"request-timeout\"",
-  "\"tcp-keepalive\"", "\"tcp-nodelay\"", "\"preferred-lifetime\"",
-  "\"valid-lifetime\"", "\"renew-timer\"", "\"rebind-timer\"",
-  "\"decline-probation-period\"", "\"server-tag\"", "\"subnet6\"",
-  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
-  "\"space\"", "\"csv-format\"", "\"always-send\"", "\"record-types\"",
-  "\"encapsulate\"", "\"array\"", "\"pools\"", "\"pool\"", "\"pd-pools\"",
-  "\"prefix\"", "\"prefix-len\"", "\"excluded-prefix\"",
-  "\"excluded-prefix-len\"", "\"delegated-len\"", "\"user-context\"",
-  "\"comment\"", "\"subnet\"", "\"interface\"", "\"interface-id\"",
-  "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"", "\"disabled\"",
-  "\"out-of-pool\"", "\"global\"", "\"all\"", "\"shared-networks\"",
-  "\"mac-sources\"", "\"relay-supplied-options\"",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Dhcp6\"",
+  "\"config-control\"", "\"config-databases\"", "\"interfaces-config\"",
+  "\"interfaces\"", "\"re-detect\"", "\"lease-database\"",
+  "\"hosts-database\"", "\"hosts-databases\"", "\"type\"", "\"memfile\"",
+  "\"mysql\"", "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"",
+  "\"host\"", "\"port\"", "\"persist\"", "\"lfc-interval\"",
+  "\"readonly\"", "\"connect-timeout\"", "\"contact-points\"",
+  "\"max-reconnect-tries\"", "\"reconnect-wait-time\"", "\"keyspace\"",
+  "\"request-timeout\"", "\"tcp-keepalive\"", "\"tcp-nodelay\"",
+  "\"preferred-lifetime\"", "\"valid-lifetime\"", "\"renew-timer\"",
+  "\"rebind-timer\"", "\"decline-probation-period\"", "\"server-tag\"",
+  "\"subnet6\"", "\"option-def\"", "\"option-data\"", "\"name\"",
+  "\"data\"", "\"code\"", "\"space\"", "\"csv-format\"", "\"always-send\"",
+  "\"record-types\"", "\"encapsulate\"", "\"array\"", "\"pools\"",
+  "\"pool\"", "\"pd-pools\"", "\"prefix\"", "\"prefix-len\"",
+  "\"excluded-prefix\"", "\"excluded-prefix-len\"", "\"delegated-len\"",
+  "\"user-context\"", "\"comment\"", "\"subnet\"", "\"interface\"",
+  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
+  "\"disabled\"", "\"out-of-pool\"", "\"global\"", "\"all\"",
+  "\"shared-networks\"", "\"mac-sources\"", "\"relay-supplied-options\"",
   "\"host-reservation-identifiers\"", "\"sanity-checks\"",
   "\"lease-checks\"", "\"client-classes\"", "\"require-client-classes\"",
   "\"test\"", "\"only-if-required\"", "\"client-class\"",
@@ -4847,8 +5017,9 @@ namespace isc { namespace dhcp {
   "\"JSON\"", "\"when-present\"", "\"never\"", "\"always\"",
   "\"when-not-present\"", "\"hostname-char-set\"",
   "\"hostname-char-replacement\"", "\"Logging\"", "\"loggers\"",
-  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
-  "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp4\"", "\"DhcpDdns\"",
+  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"rate-limit\"",
+  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"queue-size\"", "\"overflow-policy\"", "\"Dhcp4\"", "\"DhcpDdns\"",
   "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6",
   "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL",
   "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
@@ -4943,102 +5114,104 @@ namespace isc { namespace dhcp {
   "$@121", "sub_logging", "$@122", "logging_params", "logging_param",
   "loggers", "$@123", "loggers_entries", "logger_entry", "$@124",
   "logger_params", "logger_param", "debuglevel", "severity", "$@125",
-  "output_options_list", "$@126", "output_options_list_content",
-  "output_entry", "$@127", "output_params_list", "output_params", "output",
-  "$@128", "flush", "maxsize", "maxver", YY_NULLPTR
+  "rate_limit", "$@126", "output_options_list", "$@127",
+  "output_options_list_content", "output_entry", "$@128",
+  "output_params_list", "output_params", "output", "$@129", "flush",
+  "maxsize", "maxver", "async", "queue_size", "overflow_policy", "$@130", YY_NULLPTR
   };
+#endif
+
 
 #if PARSER6_DEBUG
-  const unsigned short
+  const short
   Dhcp6Parser::yyrline_[] =
   {
-       0,   257,   257,   257,   258,   258,   259,   259,   260,   260,
-     261,   261,   262,   262,   263,   263,   264,   264,   265,   265,
-     266,   266,   267,   267,   268,   268,   269,   269,   270,   270,
-     271,   271,   279,   280,   281,   282,   283,   284,   285,   288,
-     293,   293,   304,   307,   308,   311,   315,   322,   322,   329,
-     330,   333,   337,   344,   344,   351,   352,   355,   359,   370,
-     380,   380,   395,   396,   400,   401,   402,   403,   404,   405,
-     408,   408,   423,   423,   432,   433,   438,   439,   440,   441,
-     442,   443,   444,   445,   446,   447,   448,   449,   450,   451,
-     452,   453,   454,   455,   456,   457,   458,   459,   460,   461,
-     462,   463,   464,   465,   466,   467,   468,   469,   472,   477,
-     482,   487,   492,   497,   497,   505,   505,   516,   516,   525,
-     526,   529,   530,   531,   532,   533,   536,   536,   546,   552,
-     552,   564,   564,   576,   576,   586,   587,   590,   591,   594,
-     594,   604,   605,   608,   609,   610,   611,   612,   613,   614,
-     615,   616,   617,   618,   619,   620,   621,   622,   623,   624,
-     625,   628,   628,   635,   636,   637,   638,   641,   641,   649,
-     649,   657,   657,   665,   670,   670,   678,   683,   688,   693,
-     698,   703,   708,   713,   718,   718,   726,   731,   731,   739,
-     739,   749,   750,   752,   754,   754,   772,   772,   782,   783,
-     786,   787,   790,   795,   800,   800,   810,   811,   814,   815,
-     816,   819,   824,   831,   831,   841,   841,   851,   852,   855,
-     856,   859,   859,   869,   869,   879,   880,   881,   884,   885,
-     888,   888,   896,   896,   904,   904,   915,   916,   919,   920,
-     921,   922,   923,   924,   927,   932,   937,   942,   947,   952,
-     960,   960,   973,   974,   977,   978,   985,   985,  1011,  1011,
-    1022,  1023,  1027,  1028,  1029,  1030,  1031,  1032,  1033,  1034,
-    1035,  1036,  1037,  1038,  1039,  1040,  1041,  1042,  1043,  1044,
-    1045,  1046,  1049,  1049,  1057,  1057,  1065,  1065,  1073,  1073,
-    1081,  1081,  1091,  1091,  1098,  1099,  1100,  1101,  1104,  1109,
-    1117,  1117,  1128,  1129,  1133,  1134,  1137,  1137,  1145,  1146,
-    1149,  1150,  1151,  1152,  1153,  1154,  1155,  1156,  1157,  1158,
-    1159,  1160,  1161,  1162,  1163,  1164,  1165,  1172,  1172,  1185,
-    1185,  1194,  1195,  1198,  1199,  1204,  1204,  1219,  1219,  1233,
-    1234,  1237,  1238,  1241,  1242,  1243,  1244,  1245,  1246,  1247,
-    1248,  1249,  1250,  1253,  1255,  1260,  1262,  1262,  1270,  1270,
-    1278,  1278,  1286,  1288,  1288,  1296,  1305,  1305,  1317,  1318,
-    1323,  1324,  1329,  1329,  1341,  1341,  1353,  1354,  1359,  1360,
-    1365,  1366,  1367,  1368,  1369,  1370,  1371,  1372,  1373,  1376,
-    1378,  1378,  1386,  1388,  1390,  1395,  1403,  1403,  1415,  1416,
-    1419,  1420,  1423,  1423,  1433,  1433,  1442,  1443,  1446,  1447,
-    1448,  1449,  1450,  1451,  1452,  1455,  1455,  1463,  1463,  1488,
-    1488,  1518,  1518,  1530,  1531,  1534,  1535,  1538,  1538,  1550,
-    1550,  1562,  1563,  1566,  1567,  1568,  1569,  1570,  1571,  1572,
-    1573,  1574,  1575,  1576,  1579,  1579,  1587,  1592,  1592,  1600,
-    1605,  1613,  1613,  1623,  1624,  1627,  1628,  1631,  1631,  1640,
-    1640,  1649,  1650,  1653,  1654,  1658,  1659,  1660,  1661,  1662,
-    1663,  1664,  1665,  1666,  1667,  1668,  1671,  1671,  1681,  1681,
-    1691,  1691,  1699,  1699,  1707,  1707,  1715,  1715,  1723,  1723,
-    1736,  1736,  1746,  1747,  1750,  1750,  1761,  1761,  1771,  1772,
-    1775,  1775,  1785,  1786,  1789,  1790,  1793,  1794,  1795,  1796,
-    1797,  1798,  1799,  1802,  1804,  1804,  1812,  1820,  1820,  1832,
-    1833,  1836,  1837,  1838,  1839,  1840,  1841,  1842,  1843,  1844,
-    1847,  1847,  1854,  1855,  1856,  1859,  1864,  1864,  1872,  1877,
-    1884,  1891,  1891,  1901,  1902,  1905,  1906,  1907,  1908,  1909,
-    1912,  1912,  1920,  1920,  1930,  1930,  1970,  1970,  1982,  1982,
-    1992,  1993,  1996,  1997,  1998,  1999,  2000,  2001,  2002,  2003,
-    2004,  2005,  2006,  2007,  2008,  2009,  2010,  2011,  2012,  2013,
-    2016,  2021,  2021,  2029,  2029,  2037,  2042,  2042,  2050,  2055,
-    2060,  2060,  2068,  2069,  2072,  2072,  2080,  2085,  2090,  2090,
-    2098,  2101,  2104,  2107,  2110,  2116,  2116,  2124,  2124,  2132,
-    2132,  2142,  2142,  2149,  2149,  2156,  2156,  2165,  2165,  2176,
-    2176,  2186,  2187,  2191,  2194,  2194,  2209,  2209,  2219,  2219,
-    2230,  2231,  2235,  2239,  2239,  2251,  2252,  2256,  2256,  2264,
-    2265,  2268,  2269,  2270,  2271,  2272,  2273,  2274,  2277,  2282,
-    2282,  2290,  2290,  2300,  2301,  2304,  2304,  2312,  2313,  2316,
-    2317,  2318,  2319,  2322,  2322,  2330,  2335,  2340
+       0,   261,   261,   261,   262,   262,   263,   263,   264,   264,
+     265,   265,   266,   266,   267,   267,   268,   268,   269,   269,
+     270,   270,   271,   271,   272,   272,   273,   273,   274,   274,
+     275,   275,   283,   284,   285,   286,   287,   288,   289,   292,
+     297,   297,   308,   311,   312,   315,   319,   326,   326,   333,
+     334,   337,   341,   348,   348,   355,   356,   359,   363,   374,
+     384,   384,   399,   400,   404,   405,   406,   407,   408,   409,
+     412,   412,   427,   427,   436,   437,   442,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
+     466,   467,   468,   469,   470,   471,   472,   473,   476,   481,
+     486,   491,   496,   501,   501,   509,   509,   520,   520,   529,
+     530,   533,   534,   535,   536,   537,   540,   540,   550,   556,
+     556,   568,   568,   580,   580,   590,   591,   594,   595,   598,
+     598,   608,   609,   612,   613,   614,   615,   616,   617,   618,
+     619,   620,   621,   622,   623,   624,   625,   626,   627,   628,
+     629,   632,   632,   639,   640,   641,   642,   645,   645,   653,
+     653,   661,   661,   669,   674,   674,   682,   687,   692,   697,
+     702,   707,   712,   717,   722,   722,   730,   735,   735,   743,
+     743,   753,   754,   756,   758,   758,   776,   776,   786,   787,
+     790,   791,   794,   799,   804,   804,   814,   815,   818,   819,
+     820,   823,   828,   835,   835,   845,   845,   855,   856,   859,
+     860,   863,   863,   873,   873,   883,   884,   885,   888,   889,
+     892,   892,   900,   900,   908,   908,   919,   920,   923,   924,
+     925,   926,   927,   928,   931,   936,   941,   946,   951,   956,
+     964,   964,   977,   978,   981,   982,   989,   989,  1015,  1015,
+    1026,  1027,  1031,  1032,  1033,  1034,  1035,  1036,  1037,  1038,
+    1039,  1040,  1041,  1042,  1043,  1044,  1045,  1046,  1047,  1048,
+    1049,  1050,  1053,  1053,  1061,  1061,  1069,  1069,  1077,  1077,
+    1085,  1085,  1095,  1095,  1102,  1103,  1104,  1105,  1108,  1113,
+    1121,  1121,  1132,  1133,  1137,  1138,  1141,  1141,  1149,  1150,
+    1153,  1154,  1155,  1156,  1157,  1158,  1159,  1160,  1161,  1162,
+    1163,  1164,  1165,  1166,  1167,  1168,  1169,  1176,  1176,  1189,
+    1189,  1198,  1199,  1202,  1203,  1208,  1208,  1223,  1223,  1237,
+    1238,  1241,  1242,  1245,  1246,  1247,  1248,  1249,  1250,  1251,
+    1252,  1253,  1254,  1257,  1259,  1264,  1266,  1266,  1274,  1274,
+    1282,  1282,  1290,  1292,  1292,  1300,  1309,  1309,  1321,  1322,
+    1327,  1328,  1333,  1333,  1345,  1345,  1357,  1358,  1363,  1364,
+    1369,  1370,  1371,  1372,  1373,  1374,  1375,  1376,  1377,  1380,
+    1382,  1382,  1390,  1392,  1394,  1399,  1407,  1407,  1419,  1420,
+    1423,  1424,  1427,  1427,  1437,  1437,  1446,  1447,  1450,  1451,
+    1452,  1453,  1454,  1455,  1456,  1459,  1459,  1467,  1467,  1492,
+    1492,  1522,  1522,  1534,  1535,  1538,  1539,  1542,  1542,  1554,
+    1554,  1566,  1567,  1570,  1571,  1572,  1573,  1574,  1575,  1576,
+    1577,  1578,  1579,  1580,  1583,  1583,  1591,  1596,  1596,  1604,
+    1609,  1617,  1617,  1627,  1628,  1631,  1632,  1635,  1635,  1644,
+    1644,  1653,  1654,  1657,  1658,  1662,  1663,  1664,  1665,  1666,
+    1667,  1668,  1669,  1670,  1671,  1672,  1675,  1675,  1685,  1685,
+    1695,  1695,  1703,  1703,  1711,  1711,  1719,  1719,  1727,  1727,
+    1740,  1740,  1750,  1751,  1754,  1754,  1765,  1765,  1775,  1776,
+    1779,  1779,  1789,  1790,  1793,  1794,  1797,  1798,  1799,  1800,
+    1801,  1802,  1803,  1806,  1808,  1808,  1816,  1824,  1824,  1836,
+    1837,  1840,  1841,  1842,  1843,  1844,  1845,  1846,  1847,  1848,
+    1851,  1851,  1858,  1859,  1860,  1863,  1868,  1868,  1876,  1881,
+    1888,  1895,  1895,  1905,  1906,  1909,  1910,  1911,  1912,  1913,
+    1916,  1916,  1924,  1924,  1934,  1934,  1974,  1974,  1986,  1986,
+    1996,  1997,  2000,  2001,  2002,  2003,  2004,  2005,  2006,  2007,
+    2008,  2009,  2010,  2011,  2012,  2013,  2014,  2015,  2016,  2017,
+    2020,  2025,  2025,  2033,  2033,  2041,  2046,  2046,  2054,  2059,
+    2064,  2064,  2072,  2073,  2076,  2076,  2084,  2089,  2094,  2094,
+    2102,  2105,  2108,  2111,  2114,  2120,  2120,  2128,  2128,  2136,
+    2136,  2146,  2146,  2153,  2153,  2160,  2160,  2169,  2169,  2180,
+    2180,  2190,  2191,  2195,  2198,  2198,  2213,  2213,  2223,  2223,
+    2234,  2235,  2239,  2243,  2243,  2255,  2256,  2260,  2260,  2268,
+    2269,  2272,  2273,  2274,  2275,  2276,  2277,  2278,  2279,  2282,
+    2287,  2287,  2295,  2295,  2303,  2303,  2313,  2314,  2317,  2317,
+    2325,  2326,  2329,  2330,  2331,  2332,  2333,  2334,  2335,  2338,
+    2338,  2346,  2351,  2356,  2361,  2366,  2371,  2371
   };
 
-  // Print the state stack on the debug stream.
   void
-  Dhcp6Parser::yystack_print_ ()
+  Dhcp6Parser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  Dhcp6Parser::yy_reduce_print_ (int yyrule)
+  Dhcp6Parser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -5051,10 +5224,11 @@ namespace isc { namespace dhcp {
 #endif // PARSER6_DEBUG
 
 
-#line 14 "dhcp6_parser.yy" // lalr1.cc:1218
+#line 14 "dhcp6_parser.yy"
 } } // isc::dhcp
-#line 5057 "dhcp6_parser.cc" // lalr1.cc:1218
-#line 2345 "dhcp6_parser.yy" // lalr1.cc:1219
+#line 5230 "dhcp6_parser.cc"
+
+#line 2379 "dhcp6_parser.yy"
 
 
 void
@@ -1,4 +1,4 @@
-/* Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+/* Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 
    This Source Code Form is subject to the terms of the Mozilla Public
    License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -204,10 +204,14 @@ using namespace std;
   OUTPUT_OPTIONS "output_options"
   OUTPUT "output"
   DEBUGLEVEL "debuglevel"
+  RATE_LIMIT "rate-limit"
   SEVERITY "severity"
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow-policy"
 
   DHCP4 "Dhcp4"
   DHCPDDNS "DhcpDdns"
@@ -2268,6 +2272,7 @@ logger_params: logger_param
 logger_param: name
             | output_options_list
             | debuglevel
+            | rate_limit
             | severity
             | user_context
             | comment
@@ -2287,6 +2292,14 @@ severity: SEVERITY {
     ctx.leave();
 };
 
+rate_limit: RATE_LIMIT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr rl(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+};
+
 output_options_list: OUTPUT_OPTIONS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("output_options", l);
@@ -2317,6 +2330,9 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | queue_size
+             | overflow_policy
              ;
 
 output: OUTPUT {
@@ -2342,6 +2358,24 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", size);
+};
+
+overflow_policy: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr policy(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+};
+
 %%
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -51,6 +51,7 @@
 #include <util/pointer_util.h>
 #include <util/range_utilities.h>
 #include <log/logger.h>
+#include <log/logger_manager.h>
 #include <cryptolink/cryptolink.h>
 #include <cfgrpt/config_report.h>
 
@@ -172,6 +173,43 @@ createStatusCode(const Pkt6& pkt, const Option6IA& ia, const uint16_t status_cod
     return (option_status);
 }
 
+/// @brief Adds the packets dropped since the last report to a statistic.
+///
+/// @param name name of the statistic.
+/// @param count number of packets dropped so far.
+/// @param [in,out] reported number of packets already reported.
+void
+addQueueDropStat(const std::string& name, const uint64_t count,
+                 uint64_t& reported) {
+    if (count > reported) {
+        isc::stats::StatsMgr::instance().addValue(name,
+            static_cast<int64_t>(count - reported));
+        reported = count;
+    }
+}
+
+/// @brief Names of the latency histograms of a message type.
+///
+/// The names are built once rather than for each processed packet.
+struct LatencyHistogramNames {
+    /// @brief Constructor.
+    ///
+    /// @param type message type as it appears in the names, e.g. "request".
+    explicit LatencyHistogramNames(const std::string& type)
+        : total_("pkt6-" + type + "-latency") {
+        for (size_t i = 0; i < Pkt::STAGES_NUM; ++i) {
+            stages_[i] = "pkt6-" + type + "-" +
+                Pkt::stageToText(static_cast<Pkt::Stage>(i)) + "-latency";
+        }
+    }
+
+    /// @brief Names of the histograms of the stages.
+    std::string stages_[Pkt::STAGES_NUM];
+
+    /// @brief Name of the histogram of the whole processing.
+    std::string total_;
+};
+
 }; // anonymous namespace
 
 namespace isc {
@@ -182,7 +220,8 @@ const std::string Dhcpv6Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 Dhcpv6Srv::Dhcpv6Srv(uint16_t port)
     : io_service_(new IOService()), port_(port), serverid_(), shutdown_(true),
       alloc_engine_(), name_change_reqs_(),
-      network_state_(new NetworkState(NetworkState::DHCPv6))
+      network_state_(new NetworkState(NetworkState::DHCPv6)),
+      queue_drop_rules_(), queue_drop_counters_()
 {
 
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_START, DHCP6_OPEN_SOCKET).arg(port);
@@ -402,10 +441,28 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt,
 }
 
 bool Dhcpv6Srv::run() {
+    // Number of messages dropped by the asynchronous logging outputs
+    // already counted in the statistic.
+    uint64_t log_dropped = 0;
+
     while (!shutdown_) {
         try {
             run_one();
             getIOService()->poll();
+
+            // Update the statistic of the log messages dropped because an
+            // asynchronous logging queue was full. The count is checked at
+            // least once a second.
+            const uint64_t dropped = LoggerManager::getAsyncDroppedCount();
+            if (dropped != log_dropped) {
+                isc::stats::StatsMgr::instance().addValue("log-async-dropped",
+                    static_cast<int64_t>(dropped - log_dropped));
+                log_dropped = dropped;
+            }
+
+            // Report the messages suppressed by the logging rate limits
+            // when no further message went through the limits.
+            Logger::flushRateLimits();
         } catch (const std::exception& e) {
             // General catch-all standard exceptions that are not caught by more
             // specific catches.
@@ -440,6 +497,8 @@ void Dhcpv6Srv::run_one() {
         // point are: the interface, source address and destination addresses
         // and ports.
         if (query) {
+            query->markStage(Pkt::STAGE_DEQUEUED);
+
             LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC, DHCP6_BUFFER_RECEIVED)
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getRemotePort())
@@ -491,6 +550,9 @@ void Dhcpv6Srv::run_one() {
             .arg(e.what());
     }
 
+    // Report the packets dropped by the packet queue in the meantime.
+    updateQueueDropStats();
+
     // Timeout may be reached or signal received, which breaks select()
     // with no packet received
     if (!query) {
@@ -512,7 +574,7 @@ void Dhcpv6Srv::run_one() {
     }
 
     CalloutHandlePtr callout_handle = getCalloutHandle(query);
-    processPacketBufferSend(callout_handle, rsp);
+    processPacketBufferSend(callout_handle, query, rsp);
 }
 
 void
@@ -869,7 +931,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         HooksManager::park("leases6_committed", query,
         [this, callout_handle, query, rsp]() mutable {
             processPacketPktSend(callout_handle, query, rsp);
-            processPacketBufferSend(callout_handle, rsp);
+            processPacketBufferSend(callout_handle, query, rsp);
         });
 
         // If we have parked the packet, let's reset the pointer to the
@@ -947,9 +1009,35 @@ Dhcpv6Srv::processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
     }
 }
 
+void
+Dhcpv6Srv::updateQueueDropStats() {
+    PacketQueue6Ptr queue = IfaceMgr::instance().getPacketQueue6();
+    PacketDropRulesPtr drop_rules;
+    if (queue) {
+        drop_rules = queue->getDropRules();
+    }
+    if (!drop_rules) {
+        return;
+    }
+
+    // The queue is recreated on reconfiguration with new counters.
+    if (drop_rules != queue_drop_rules_) {
+        queue_drop_rules_ = drop_rules;
+        queue_drop_counters_ = PacketDropRules::Counters();
+    }
+
+    PacketDropRules::Counters counters = drop_rules->getCounters();
+    addQueueDropStat("pkt6-queue-drop-rate-limit", counters.rate_limit_,
+                     queue_drop_counters_.rate_limit_);
+    addQueueDropStat("pkt6-queue-drop-duplicate", counters.duplicate_,
+                     queue_drop_counters_.duplicate_);
+    addQueueDropStat("pkt6-queue-drop-low-priority", counters.low_priority_,
+                     queue_drop_counters_.low_priority_);
+}
+
 void
 Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
-                                   Pkt6Ptr& rsp) {
+                                   Pkt6Ptr& query, Pkt6Ptr& rsp) {
     if (!rsp) {
         return;
     }
@@ -998,6 +1086,8 @@ Dhcpv6Srv::processPacketBufferSend(CalloutHandlePtr& callout_handle,
 
         // Update statistics accordingly for sent packet.
         processStatsSent(rsp);
+        query->markStage(Pkt::STAGE_SENT);
+        processStatsLatency(query);
 
     } catch (const std::exception& e) {
         LOG_ERROR(packet6_logger, DHCP6_PACKET_SEND_FAIL).arg(e.what());
@@ -1416,6 +1506,8 @@ Dhcpv6Srv::selectSubnet(const Pkt6Ptr& question, bool& drop) {
         callout_handle->getArgument("subnet6", subnet);
     }
 
+    question->markStage(Pkt::STAGE_SUBNET_SELECTED);
+
     if (subnet) {
         // Log at higher debug level that subnet has been found.
         LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC_DATA, DHCP6_SUBNET_SELECTED)
@@ -1770,6 +1862,7 @@ Dhcpv6Srv::assignIA_NA(const Pkt6Ptr& query, const Pkt6Ptr& answer,
     // may be used instead. If fake_allocation is set to false, the lease will
     // be inserted into the LeaseMgr as well.
     Lease6Collection leases = alloc_engine_->allocateLeases6(ctx);
+    query->markStage(Pkt::STAGE_LEASE_ALLOCATED);
 
     /// @todo: Handle more than one lease
     Lease6Ptr lease;
@@ -1876,6 +1969,7 @@ Dhcpv6Srv::assignIA_PD(const Pkt6Ptr& query, const Pkt6Ptr& /*answer*/,
     // may be used instead. If fake_allocation is set to false, the lease will
     // be inserted into the LeaseMgr as well.
     Lease6Collection leases = alloc_engine_->allocateLeases6(ctx);
+    query->markStage(Pkt::STAGE_LEASE_ALLOCATED);
 
     if (!leases.empty()) {
 
@@ -2011,6 +2105,7 @@ Dhcpv6Srv::extendIA_NA(const Pkt6Ptr& query, const Pkt6Ptr& answer,
     }
 
     Lease6Collection leases = alloc_engine_->renewLeases6(ctx);
+    query->markStage(Pkt::STAGE_LEASE_ALLOCATED);
 
     // Ok, now we have the leases extended. We have:
     // - what the client tried to renew in ctx.hints_
@@ -2186,6 +2281,7 @@ Dhcpv6Srv::extendIA_PD(const Pkt6Ptr& query,
     // - changed_leases - leases that have FQDN changed (not really important
     //                    in PD context)
     Lease6Collection leases = alloc_engine_->renewLeases6(ctx);
+    query->markStage(Pkt::STAGE_LEASE_ALLOCATED);
 
     // For each IA inserted by the client we have to determine what to do
     // about included prefixes and notify the client. We will iterate over
@@ -2707,6 +2803,13 @@ Dhcpv6Srv::releaseIA_PD(const DuidPtr& duid, const Pkt6Ptr& query,
         StatsMgr::instance().addValue(
             StatsMgr::generateName("subnet", lease->subnet_id_, "assigned-pds"),
             static_cast<int64_t>(-1));
+
+        // The prefix is free again in its pool.
+        Subnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets6()->getSubnet(lease->subnet_id_);
+        if (subnet) {
+            subnet->addAssignedLeases(Lease::TYPE_PD, lease->addr_, -1);
+        }
     }
 
     return (ia_rsp);
@@ -3807,6 +3910,76 @@ void Dhcpv6Srv::processStatsSent(const Pkt6Ptr& response) {
     StatsMgr::instance().addValue(stat_name, static_cast<int64_t>(1));
 }
 
+void Dhcpv6Srv::processStatsLatency(const Pkt6Ptr& query) {
+    // Packets which have not been received from the network have no
+    // timestamp.
+    const boost::posix_time::ptime& received = query->getTimestamp();
+    if (received.is_not_a_date_time()) {
+        return;
+    }
+
+    // Only the messages the server responds to are sent here.
+    static const LatencyHistogramNames solicit_names("solicit");
+    static const LatencyHistogramNames request_names("request");
+    static const LatencyHistogramNames confirm_names("confirm");
+    static const LatencyHistogramNames renew_names("renew");
+    static const LatencyHistogramNames rebind_names("rebind");
+    static const LatencyHistogramNames release_names("release");
+    static const LatencyHistogramNames decline_names("decline");
+    static const LatencyHistogramNames infrequest_names("infrequest");
+    static const LatencyHistogramNames dhcpv4_query_names("dhcpv4-query");
+    const LatencyHistogramNames* names;
+    switch (query->getType()) {
+    case DHCPV6_SOLICIT:
+        names = &solicit_names;
+        break;
+    case DHCPV6_REQUEST:
+        names = &request_names;
+        break;
+    case DHCPV6_CONFIRM:
+        names = &confirm_names;
+        break;
+    case DHCPV6_RENEW:
+        names = &renew_names;
+        break;
+    case DHCPV6_REBIND:
+        names = &rebind_names;
+        break;
+    case DHCPV6_RELEASE:
+        names = &release_names;
+        break;
+    case DHCPV6_DECLINE:
+        names = &decline_names;
+        break;
+    case DHCPV6_INFORMATION_REQUEST:
+        names = &infrequest_names;
+        break;
+    case DHCPV6_DHCPV4_QUERY:
+        names = &dhcpv4_query_names;
+        break;
+    default:
+        return;
+    }
+
+    // Record the time elapsed since the previous stage (or the reception)
+    // for each stage the packet has gone through, at the time the stage
+    // was reached.
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    boost::posix_time::ptime previous = received;
+    for (size_t i = 0; i < Pkt::STAGES_NUM; ++i) {
+        const boost::posix_time::ptime& reached =
+            query->getStageTime(static_cast<Pkt::Stage>(i));
+        if (reached.is_not_a_date_time()) {
+            continue;
+        }
+        stats_mgr.addHistogramSample(names->stages_[i], reached - previous,
+                                     reached);
+        previous = reached;
+    }
+    stats_mgr.addHistogramSample(names->total_, previous - received,
+                                 previous);
+}
+
 int Dhcpv6Srv::getHookIndexBuffer6Send() {
     return (Hooks.hook_index_buffer6_send_);
 }
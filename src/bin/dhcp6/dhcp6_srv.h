@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,6 +15,7 @@
 #include <dhcp/option6_client_fqdn.h>
 #include <dhcp/option6_ia.h>
 #include <dhcp/option_definition.h>
+#include <dhcp/packet_drop_rules.h>
 #include <dhcp/pkt6.h>
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/callout_handle_store.h>
@@ -931,6 +932,17 @@ private:
     /// @param query packet received
     static void processStatsReceived(const Pkt6Ptr& query);
 
+    /// @brief Updates the latency histograms for a processed packet
+    ///
+    /// For each processing stage reached by the query, the time elapsed
+    /// since the previous stage (or since the reception for the first one)
+    /// is added to the pkt6-<type>-<stage>-latency histogram, e.g.
+    /// pkt6-renew-lease-allocated-latency. The whole processing time is
+    /// added to the pkt6-<type>-latency histogram.
+    ///
+    /// @param query packet which response has been sent
+    static void processStatsLatency(const Pkt6Ptr& query);
+
     /// @brief Checks if the specified option code has been requested using
     /// the Option Request option.
     ///
@@ -957,9 +969,11 @@ public:
     /// @brief Executes buffer6_send callout and sends the response.
     ///
     /// @param callout_handle pointer to the callout handle.
+    /// @param query pointer to the query, which processing stage times
+    /// are recorded when the response is sent.
     /// @param rsp pointer to a response.
     void processPacketBufferSend(hooks::CalloutHandlePtr& callout_handle,
-                                 Pkt6Ptr& rsp);
+                                 Pkt6Ptr& query, Pkt6Ptr& rsp);
 
 protected:
 
@@ -978,6 +992,16 @@ protected:
     void processPacketPktSend(hooks::CalloutHandlePtr& callout_handle,
                               Pkt6Ptr& query, Pkt6Ptr& rsp);
 
+    /// @brief Updates the statistics of the packets dropped by the early
+    /// drop rules of the packet queue.
+    ///
+    /// The numbers of packets dropped by each rule since the last call
+    /// are added to the pkt6-queue-drop-rate-limit,
+    /// pkt6-queue-drop-duplicate and pkt6-queue-drop-low-priority
+    /// statistics. The rules are applied in the receiver thread, so as
+    /// the statistics are updated by the main thread with this function.
+    void updateQueueDropStats();
+
     /// @brief Allocation Engine.
     /// Pointer to the allocation engine that we are currently using
     /// It must be a pointer, because we will support changing engines
@@ -992,6 +1016,13 @@ protected:
     /// disabled subnet/network scopes.
     NetworkStatePtr network_state_;
 
+    /// @brief Early drop rules of the packet queue which counters are
+    /// reported in the statistics.
+    PacketDropRulesPtr queue_drop_rules_;
+
+    /// @brief Counters of the early drop rules reported in the statistics.
+    PacketDropRules::Counters queue_drop_counters_;
+
 };
 
 }; // namespace isc::dhcp
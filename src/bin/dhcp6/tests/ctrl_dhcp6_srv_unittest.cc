@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -783,12 +783,15 @@ TEST_F(CtrlDhcpv6SrvTest, commandsRegistration) {
 
     EXPECT_TRUE(command_list.find("\"list-commands\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"build-report\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"callout-statistics-get\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"callout-statistics-reset\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-write\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"leases-reclaim\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"libreload\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"config-set\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"shutdown\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"statistic-export\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove\"") != string::npos);
@@ -1015,6 +1018,8 @@ TEST_F(CtrlChannelDhcpv6SrvTest, commandsList) {
 
     // We expect the server to report at least the following commands:
     checkListCommands(rsp, "build-report");
+    checkListCommands(rsp, "callout-statistics-get");
+    checkListCommands(rsp, "callout-statistics-reset");
     checkListCommands(rsp, "config-get");
     checkListCommands(rsp, "config-set");
     checkListCommands(rsp, "config-test");
@@ -1024,6 +1029,7 @@ TEST_F(CtrlChannelDhcpv6SrvTest, commandsList) {
     checkListCommands(rsp, "libreload");
     checkListCommands(rsp, "version-get");
     checkListCommands(rsp, "shutdown");
+    checkListCommands(rsp, "statistic-export");
     checkListCommands(rsp, "statistic-get");
     checkListCommands(rsp, "statistic-get-all");
     checkListCommands(rsp, "statistic-remove");
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -2566,6 +2566,47 @@ TEST_F(Dhcpv6SrvTest, receiveParseFailedStat) {
     EXPECT_EQ(1, recv_drop->getInteger().first);
 }
 
+// Test checks that the packets dropped by the packet queue before they
+// are queued are reported in the statistics.
+TEST_F(Dhcpv6SrvTest, receiveQueueDropStat) {
+    NakedDhcpv6Srv srv(0);
+
+    ConstElementPtr queue_control =
+        Element::fromJSON("{ \"enable-queue\": true,"
+                          " \"queue-type\": \"kea-ring6\","
+                          " \"capacity\": 10,"
+                          " \"max-client-rate\": 1 }");
+    ASSERT_TRUE(IfaceMgr::instance().configureDHCPPacketQueue(AF_INET6,
+                                                              queue_control));
+
+    // Enqueue three packets from the same client.
+    SocketInfo sock(IOAddress("::1"), DHCP6_SERVER_PORT, 10);
+    for (int i = 0; i < 3; ++i) {
+        Pkt6 out(DHCPV6_SOLICIT, 1234 + i);
+        out.addOption(generateClientId());
+        out.pack();
+        Pkt6Ptr pkt(new Pkt6(static_cast<const uint8_t*>(out.getBuffer().getData()),
+                             out.getBuffer().getLength()));
+        IfaceMgr::instance().getPacketQueue6()->enqueuePacket(pkt, sock);
+    }
+
+    // The two packets exceeding the rate should be reported once.
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    for (int i = 0; i < 2; ++i) {
+        srv.updateQueueDropStats();
+        ObservationPtr drop_stat = mgr.getObservation("pkt6-queue-drop-rate-limit");
+        ASSERT_TRUE(drop_stat);
+        EXPECT_EQ(2, drop_stat->getInteger().first);
+    }
+
+    // No other packets were dropped.
+    EXPECT_FALSE(mgr.getObservation("pkt6-queue-drop-duplicate"));
+    EXPECT_FALSE(mgr.getObservation("pkt6-queue-drop-low-priority"));
+
+    IfaceMgr::instance().configureDHCPPacketQueue(AF_INET6, ConstElementPtr());
+}
+
 // This test verifies that the server is able to handle an empty DUID (client-id)
 // in incoming client message.
 TEST_F(Dhcpv6SrvTest, emptyClientId) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -208,6 +208,31 @@ public:
         isc::stats::StatsMgr::instance().removeAll();
     }
 
+    /// @brief Processes a query as if it was received by a packet filter.
+    ///
+    /// The query is packed and parsed again as the server would receive it
+    /// and it is timestamped as the packet filters do upon reception.
+    ///
+    /// @param srv Server processing the query.
+    /// @param query Query sent by the client.
+    /// @param iface Name of the interface the query is received on.
+    /// @return Response sent by the server or null pointer.
+    Pkt6Ptr receiveTimestamped(NakedDhcpv6Srv& srv, const Pkt6Ptr& query,
+                               const std::string& iface) {
+        query->pack();
+        Pkt6Ptr received(new Pkt6(static_cast<const uint8_t*>
+                                  (query->getBuffer().getData()),
+                                  query->getBuffer().getLength()));
+        received->setRemoteAddr(IOAddress("fe80::3a60:77ff:fed5:cdef"));
+        received->setLocalAddr(IOAddress(ALL_DHCP_RELAY_AGENTS_AND_SERVERS));
+        received->setIface(iface);
+        received->updateTimestamp();
+        srv.fake_sent_.clear();
+        srv.fakeReceive(received);
+        srv.run_one();
+        return (srv.fake_sent_.empty() ? Pkt6Ptr() : srv.fake_sent_.back());
+    }
+
     /// @brief Interface Manager's fake configuration control.
     IfaceMgrTestConfig iface_mgr_test_config_;
 };
@@ -536,6 +561,66 @@ TEST_F(SARRTest, sarrStats) {
     EXPECT_EQ(2, pkt6_sent->getInteger().first);
 }
 
+// This test verifies that the processing latency histograms are updated
+// for each processed query.
+TEST_F(SARRTest, sarrLatencyStats) {
+    Dhcp6Client client;
+    configure(CONFIGS[1], *client.getServer());
+    NakedDhcpv6Srv& srv = *client.getServer();
+
+    // The latency is measured from the reception time recorded by the
+    // packet filter.
+    OptionPtr clientid = generateClientId();
+    Pkt6Ptr solicit = createMessage(DHCPV6_SOLICIT, Lease::TYPE_NA,
+                                    IOAddress("::"), 0, 1234);
+    solicit->addOption(clientid);
+    Pkt6Ptr advertise = receiveTimestamped(srv, solicit, "eth1");
+    ASSERT_TRUE(advertise);
+    ASSERT_EQ(DHCPV6_ADVERTISE, advertise->getType());
+    Option6IAAddrPtr iaaddr = boost::dynamic_pointer_cast<Option6IAAddr>
+        (advertise->getOption(D6O_IA_NA)->getOption(D6O_IAADDR));
+    ASSERT_TRUE(iaaddr);
+
+    Pkt6Ptr request = createMessage(DHCPV6_REQUEST, Lease::TYPE_NA,
+                                    iaaddr->getAddress(), 128, 1234);
+    request->addOption(clientid);
+    request->addOption(advertise->getOption(D6O_SERVERID));
+    Pkt6Ptr reply = receiveTimestamped(srv, request, "eth1");
+    ASSERT_TRUE(reply);
+    ASSERT_EQ(DHCPV6_REPLY, reply->getType());
+
+    // A query without a reception time is not measured.
+    client.setInterface("eth1");
+    client.requestAddress();
+    ASSERT_NO_THROW(client.doSARR());
+    ASSERT_EQ(1, client.getLeaseNum());
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+
+    // Each query has gone through all the stages.
+    const char* types[] = { "solicit", "request" };
+    const char* stages[] = { "dequeued", "subnet-selected",
+                             "lease-allocated", "sent" };
+    for (int i = 0; i < 2; ++i) {
+        const std::string prefix = std::string("pkt6-") + types[i] + "-";
+        HistogramPtr total = mgr.getHistogram(prefix + "latency");
+        ASSERT_TRUE(total) << prefix;
+        EXPECT_EQ(1, total->getCount());
+
+        int64_t sum = 0;
+        for (int j = 0; j < 4; ++j) {
+            HistogramPtr stage = mgr.getHistogram(prefix + stages[j] +
+                                                  "-latency");
+            ASSERT_TRUE(stage) << prefix << stages[j];
+            EXPECT_EQ(1, stage->getCount());
+            sum += stage->getTotal();
+        }
+        // The stages add up to the whole processing time.
+        EXPECT_EQ(total->getTotal(), sum);
+    }
+}
+
 // This test verifies that pkt6-receive-drop is increased properly when the
 // client's packet is rejected due to mismatched server-id value.
 TEST_F(SARRTest, pkt6ReceiveDropStat1) {
@@ -691,8 +691,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to yytext[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 62
-#define YY_END_OF_BUFFER 63
+#define YY_NUM_RULES 66
+#define YY_END_OF_BUFFER 67
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -700,48 +700,54 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[367] =
+static const flex_int16_t yy_accept[415] =
     {   0,
-       55,   55,    0,    0,    0,    0,    0,    0,    0,    0,
-       63,   61,   10,   11,   61,    1,   55,   52,   55,   55,
-       61,   54,   53,   61,   61,   61,   61,   61,   48,   49,
-       61,   61,   61,   50,   51,    5,    5,    5,   61,   61,
-       61,   10,   11,    0,    0,   44,    0,    0,    0,    0,
+       59,   59,    0,    0,    0,    0,    0,    0,    0,    0,
+       67,    1,   65,   65,   65,   65,   65,   65,   65,   65,
+       65,   10,   65,   59,   56,   59,   59,   58,   57,   65,
+       52,   53,   54,   55,   11,    5,    5,    5,   65,   65,
+       65,    1,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    1,   55,   55,    0,   54,   55,    3,    2,
-        6,    0,   55,    0,    0,    0,    0,    0,    0,    4,
-        0,    0,    9,    0,   45,    0,    0,    0,    0,   47,
+        0,    0,   48,    0,    3,    2,    0,    0,    0,    0,
+        6,    0,    0,   10,   59,   59,    0,   58,   59,    0,
+       59,   11,    4,    0,    0,    9,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
-        0,    0,    8,    0,    0,    0,    0,   46,    0,    0,
-       22,    0,    0,   21,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   51,    0,    0,    0,
+       49,    0,    2,    0,    0,    0,    0,    0,    0,    0,
+        8,    0,   21,    0,    0,    0,    0,    0,    0,    0,
+        0,   22,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   60,   58,    0,   57,   56,
+        0,    0,    0,    0,    0,   50,    0,    0,   62,   60,
+        0,    0,   64,   61,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   59,
-       56,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,   26,    0,    0,    0,    0,    0,
-        0,   36,    0,    0,    0,    0,    0,    0,   25,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   19,
-       20,   39,    0,    0,    0,    0,    0,    0,   23,    0,
-        0,    0,    0,    0,    0,    0,    0,    7,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
-       38,    0,    0,    0,    0,   27,    0,    0,    0,   34,
-       12,    0,   14,    0,    0,    0,   32,   35,    0,   40,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   43,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,   60,   63,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   36,
+        0,    0,    0,    0,   26,    0,    0,    0,   25,    0,
+        0,    0,    0,    0,   19,   20,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   23,    0,   42,    0,   39,    0,    0,    0,    0,
+        0,    0,    0,    0,    7,    0,    0,    0,    0,    0,
+        0,   27,    0,    0,    0,    0,    0,    0,    0,   41,
+        0,    0,    0,    0,   38,    0,    0,    0,    0,    0,
+
+        0,    0,    0,   34,    0,    0,    0,    0,    0,   14,
+        0,   32,   35,    0,   40,   12,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   47,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   42,    0,
-        0,    0,   33,    0,    0,   30,    0,    0,    0,   15,
-        0,    0,    0,    0,   29,   28,    0,    0,    0,    0,
-        0,    0,    0,    0,   13,    0,    0,    0,    0,    0,
-        0,    0,   24,    0,    0,   37,    0,    0,   31,   18,
-        0,    0,    0,   17,   16,    0
+        0,    0,    0,    0,    0,    0,   45,   33,   46,    0,
+        0,   30,    0,    0,    0,    0,    0,    0,    0,   43,
+        0,    0,   29,   28,    0,    0,    0,   15,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   13,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   24,
+
+        0,    0,   37,    0,    0,    0,   18,   31,   44,    0,
+        0,   17,   16,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -758,8 +764,8 @@ static const YY_CHAR yy_ec[256] =
        32,   33,   34,    5,   35,    5,   36,   37,   38,   39,
 
        40,   41,   42,   43,   44,    5,   45,   46,   47,   48,
-       49,   50,    5,   51,   52,   53,   54,   55,    5,   56,
-       57,   58,   59,    5,   60,    5,    5,    5,    5,    5,
+       49,   50,   51,   52,   53,   54,   55,   56,   57,   58,
+       59,   60,   61,    5,   62,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -776,672 +782,397 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[61] =
+static const YY_CHAR yy_meta[63] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    5,    6,    6,    6,    6,    3,    3,    3,
-        3,    6,    6,    6,    6,    3,    3,    3,    3,    3,
-        3,    3,    5,    3,    3,    6,    7,    6,    6,    6,
-        7,    3,    3,    3,    3,    3,    3,    5,    3,    3,
-        5,    3,    5,    5,    3,    3,    3,    3,    3,    3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1
     } ;
 
-static const flex_int16_t yy_base[380] =
+static const flex_int16_t yy_base[415] =
     {   0,
-        0,    0,   59,   62,   65,    0,   63,   67,   47,   64,
-      291, 2481,   84,  286,  125,    0,  105, 2481,  120,  125,
-       85,  169, 2481,  262,  139,   65,   69,   82, 2481, 2481,
-       80,   84,  118, 2481, 2481, 2481,   92,  269,  230,    0,
-      256,  110,  270,   97,  186, 2481,  193,  199,  197,  210,
-      219,  234,  255,  263,  269,  278,  284,  291,  297,  303,
-      320,  338,    0,  345,  363,  375,  381,  385, 2481,    0,
-     2481,  332,  349,  121,  144,  128,  152,  171,  160, 2481,
-      222,  248, 2481,  198, 2481,  169,  405,  411,  209,  417,
-      451,  428,  439,  450,  478,  493,  499,  506,  512,  518,
-
-      532,  540,  546,  552,  574,  586,  594,  602,  608,  614,
-      622,  628,  648,  661,    0,  177,  181,  184,  189,  207,
-      204,  130, 2481,    0,  667,  673,  155, 2481,  698,  695,
-     2481,  683,  723, 2481,  739,  748,  756,  762,  768,  776,
-      782,  810,  819,  827,  833,  839,  847,  853,  862,  875,
-      895,  903,  909,  917,  222, 2481, 2481,  223, 2481, 2481,
-      103,    0,  924,  931,  967,  937,  992, 1008,  943, 1014,
-     1020, 1032, 1042, 1049, 1055, 1065, 1071, 1077, 1088, 1099,
-     1110, 1121, 1127, 1134, 1143, 1149, 1155, 1169, 1183, 2481,
-     2481,  104,    0, 1190, 1197, 1232, 1204, 1211, 1218, 1230,
-
-     1259, 1276, 1282, 1288, 2481, 1294, 1300, 1310, 1316, 1322,
-     1328, 2481, 1334, 1351, 1357, 1363, 1369, 1375, 2481, 1391,
-     1397,   64,    0, 1403, 1409, 1437, 1445, 1451, 1459, 2481,
-     2481, 2481, 1470, 1479, 1487, 1499, 1507, 1516, 2481, 1522,
-     1528, 1540, 1557, 1550, 1563, 1569, 1576, 2481, 1583, 1597,
-     1609, 1618, 1625, 1631, 1637, 1643, 1651, 1660, 1666, 2481,
-     2481, 1672, 1686, 1694, 1700, 2481, 1706, 1712, 1722, 2481,
-     2481, 1728, 2481, 1734, 1767, 1773, 2481, 2481, 1779, 2481,
-     1786, 1792, 1802, 1812, 1820, 1827, 1836, 1848, 1855, 1861,
-     1869, 1883, 1889, 1897, 1903, 1909, 2481, 1918, 1925, 1943,
-
-     1951, 1965, 1971, 1977, 1985, 1991, 2000, 2010, 2019, 2025,
-     2036, 2044, 2053, 2064, 2072, 2079, 2086, 2092, 2481, 2098,
-     2105, 2112, 2481, 2133, 2140, 2481, 2149, 2156, 2162, 2481,
-     2168, 2174, 2182, 2210, 2481, 2481, 2218, 2224, 2230, 2236,
-     2243, 2258, 2264, 2271, 2481, 2278, 2284, 2292, 2299, 2312,
-     2320, 2327, 2481, 2333, 2340, 2481, 2346, 2355, 2481, 2481,
-     2362, 2368, 2375, 2481, 2481, 2481, 2414, 2421, 2428, 2435,
-     2442, 2449, 2456, 2460, 2465, 2467, 2469, 2471, 2473
+       63,    0,  125,    0,  182,    0,  184,    0,  181,    0,
+      203,  244,  306,  197,  180,  182,  190,  182,  163,  181,
+      164,  225,    0,  357,    0,  224,  363,    0,    0,  373,
+        0,    0,    0,    0,  217,  208,    0,    0,  176,  391,
+      211,    0,  439,  457,  197,  198,  415,  334,  342,  422,
+      420,  199,  206,  323,  336,  348,  408,  412,  404,  448,
+      425,  501,    0,  563,    0,  625,  443,  408,  662,  427,
+        0,  663,  435,    0,    0,    0,    0,    0,    0,  681,
+        0,    0,    0,  445,  478,    0,  461,  622,  654,  641,
+      640,  653,  640,  659,  659,  662,  694,  654,  666,  662,
+
+      657,  667,  653,  663,  652,  663,  658,  665,  662,  663,
+      678,  679,  676,  681,  676,    0,    0,  722,  781,    0,
+        0,  838,    0,  821,  806,  819,  794,  823,  804,  806,
+        0,  803,    0,  799,  819,  816,  815,  818,  814,  811,
+      809,    0,  816,  810,  813,  824,  831,  817,  828,  836,
+      836,  829,  824,  827,  836,  832,  833,  832,  830,  829,
+      836,  845,  880,    0,    0,    0,    0,  908,    0,    0,
+      867,  858,    0,    0,  844,  884,  864,  861,  898,  866,
+      859,  872,  858,  876,  875,  874,  891,  888,  887,  890,
+      895,  890,  888,  932,  901,  929,  898,  889,  937,  895,
+
+      910,  912,  947,  943,  916,  942,  970,    0,    0,  921,
+      955,  956,  917,  928,  923,  922,  927,  918,  919,  922,
+      927,  927,  925,  936,  949,  930,  939,  990,  949,    0,
+      992,  944,  994,  990,    0,  948,  957,  993,    0,  967,
+      976,  999, 1027,  977,    0,    0,  978,  965,  976,  983,
+      972, 1016, 1022,  985,  976,  985,  973,  980,  995, 1005,
+     1040,    0, 1006,    0,  998,    0, 1007, 1048, 1006, 1003,
+     1008, 1004,    0, 1055,    0, 1003, 1020, 1014, 1056, 1014,
+     1027,    0, 1037, 1070, 1073, 1079, 1080, 1076, 1082,    0,
+     1083, 1051, 1053, 1049,    0, 1042, 1056, 1053, 1062,    0,
+
+     1063, 1052, 1061,    0, 1100, 1071, 1049, 1057, 1070,    0,
+     1058,    0,    0, 1059,    0,    0, 1077, 1077, 1065, 1105,
+     1057, 1064, 1108, 1074, 1068, 1068,    0, 1076, 1074, 1079,
+     1115, 1078, 1088, 1075, 1078, 1077, 1082, 1093, 1094, 1097,
+     1130, 1131, 1132, 1099, 1100, 1135, 1104, 1105, 1092, 1105,
+     1110, 1103, 1099, 1143, 1092, 1108,    0,    0,    0, 1146,
+     1147,    0, 1111, 1110, 1100, 1151, 1106, 1110, 1114,    0,
+     1107, 1126,    0,    0, 1127, 1124, 1125,    0, 1122, 1119,
+     1124, 1163, 1122, 1123, 1118, 1121, 1134, 1122, 1138,    0,
+     1135, 1136, 1173, 1127, 1128, 1176, 1124, 1144, 1145,    0,
+
+     1180, 1181,    0, 1182, 1136, 1137,    0,    0,    0, 1185,
+     1186,    0,    0,    1
     } ;
 
-static const flex_int16_t yy_def[380] =
+static const flex_int16_t yy_def[415] =
     {   0,
-      366,    1,  367,  367,    1,    5,    5,    5,    5,    5,
-      366,  366,  366,  366,  368,  369,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  370,
-      366,  366,  366,  371,  368,  366,  368,  368,  372,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  369,  366,  366,  366,  366,  366,  366,  373,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  370,  366,  371,  366,  374,  368,  368,  375,  368,
-      372,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  373,  366,  366,  366,  366,  366,
-      366,  366,  366,  376,  368,  368,  375,  366,  372,  368,
-      366,  368,  368,  366,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  366,  366,  366,  366,  366,  366,
-      366,  377,  368,  368,  372,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  366,
-      366,  366,  378,  368,  368,  372,  368,  368,  368,  368,
-
-      368,  368,  368,  368,  366,  368,  368,  368,  368,  368,
-      368,  366,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  366,  379,  368,  368,  368,  368,  368,  368,  366,
-      366,  366,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  368,  368,  368,  368,  368,  368,  366,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  366,
-      366,  368,  368,  368,  368,  366,  368,  368,  368,  366,
-      366,  368,  366,  368,  368,  368,  366,  366,  368,  366,
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  366,  368,  368,  368,
-
-      368,  368,  368,  368,  368,  368,  368,  368,  368,  368,
-      368,  368,  368,  368,  368,  368,  368,  368,  366,  368,
-      368,  368,  366,  368,  368,  366,  368,  368,  368,  366,
-      368,  368,  368,  368,  366,  366,  368,  368,  368,  368,
-      368,  368,  368,  368,  366,  368,  368,  368,  368,  368,
-      368,  368,  366,  368,  368,  366,  368,  368,  366,  366,
-      368,  368,  368,  366,  366,    0,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366
+      414,    1,  414,    3,    1,    5,    5,    7,    5,    9,
+      414,  414,  414,  414,  414,  414,  414,  414,   15,   16,
+       18,  414,  414,  414,  414,   24,   24,   26,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,   22,  414,  414,
+      414,   12,   13,   43,   44,   44,   46,   44,   46,   44,
+       44,   44,   44,   53,   46,   53,   46,   53,   53,   53,
+       44,  414,  414,  414,  414,  414,  414,   67,  414,   69,
+      414,  414,   72,   22,   24,   27,   30,   26,   27,   30,
+       80,   35,  414,  414,   40,  414,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+
+       53,   53,   53,   53,   53,   46,   53,   46,   53,   53,
+       51,   51,   53,   51,   53,   53,   53,  414,  414,   64,
+      414,  414,   66,  414,  124,  414,  126,  414,  128,  414,
+      414,   53,  414,   53,   44,   51,   53,   51,   53,   46,
+       53,  414,   53,   53,   53,   53,   44,   53,   51,   53,
+       51,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,  118,  119,  119,  414,   64,  414,  414,  414,
+      414,  171,  414,  414,  414,   53,   53,   53,   53,   53,
+       53,   51,   53,   53,   51,   53,   44,   51,   53,   53,
+       51,   53,   46,   53,   53,   53,   53,   53,   53,   53,
+
+       53,   51,   53,   53,   53,  118,  414,  414,  414,  414,
+       53,   53,   53,   51,   53,   53,   53,   53,   53,   53,
+       53,   46,   53,   53,   51,   53,   53,   53,   53,  414,
+       53,   53,   53,   53,  414,   53,   53,   53,  414,   53,
+       44,  118,  414,  414,  414,  414,   51,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   51,
+       53,  414,   53,  414,   53,  414,   53,   53,   46,   53,
+       46,   53,   53,  414,  414,   53,   51,   53,   53,   53,
+       53,  414,   53,   53,   53,   53,   53,   53,   53,  414,
+       53,   53,   53,   46,  414,   53,   53,   53,   51,   64,
+
+       51,   53,   53,  414,   53,   44,   53,   53,   51,  414,
+       53,  414,  414,   53,  414,  414,   44,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,  414,   53,   53,   53,
+       53,   46,   51,   53,   53,   53,   53,   51,   51,   53,
+       53,   53,   53,   51,   51,   53,   53,   53,   53,   51,
+       44,   53,   46,   53,   53,   53,  414,  414,  414,   53,
+       53,  414,   53,   53,   53,   53,   53,   46,   53,  414,
+       53,   44,  414,  414,   44,   51,   51,  414,   53,   53,
+       53,   53,   53,   53,   53,   53,   51,   53,   53,  414,
+       53,   53,   53,   53,   53,   53,   53,   51,   51,  414,
+
+       53,   53,  414,   53,   53,   53,  414,  414,  414,   53,
+       53,  414,  414,    0
     } ;
 
-static const flex_int16_t yy_nxt[2542] =
+static const flex_int16_t yy_nxt[1249] =
     {   0,
-       12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
-       19,   20,   21,   22,   22,   22,   22,   23,   24,   12,
-       12,   12,   12,   25,   26,   12,   27,   12,   12,   28,
-       12,   29,   12,   30,   12,   12,   12,   12,   12,   25,
-       31,   12,   12,   12,   12,   12,   12,   32,   12,   12,
-       12,   12,   33,   12,   12,   12,   12,   12,   34,   35,
-       37,   14,   37,   37,   14,   37,   38,   41,   40,   38,
-       12,   12,   40,   12,   12,   12,   12,   12,   12,   12,
-       12,   12,   12,   12,   41,   42,   74,   42,   12,   12,
-       12,   12,   69,   42,   12,   42,   12,   70,   12,   75,
-
-       74,   74,   85,  248,   12,   12,   12,   12,   39,   76,
-       12,   42,   12,   42,   75,   77,   64,   12,   65,   65,
-       65,   65,   75,   12,   12,   44,   44,   44,   66,   86,
-       46,   64,   76,   67,   67,   67,   67,   78,   68,   68,
-       68,   68,  222,   66,   66,   76,  116,   72,   66,   72,
-       47,   48,   73,   73,   73,   73,  192,   49,  118,   66,
-      128,   50,   51,   52,   66,   53,  116,   54,   79,  117,
-       55,   56,   57,   58,   59,  161,   60,  116,   61,   62,
-       64,  118,   67,   67,   67,   67,   44,   44,   44,  117,
-      118,   46,   66,   44,   44,   44,  117,  119,   46,   44,
-
-       44,   44,   90,   85,   46,  155,  156,  157,   66,   45,
-       44,   44,   44,  121,  128,   46,  120,  155,   49,   44,
-       44,   44,  124,  157,   46,   49,  156,  157,  155,   45,
-       86,   49,  156,   45,   44,   44,   44,   45,   88,   46,
-      158,   87,   49,  160,   45,  190,  190,   45,   95,   45,
-       91,   49,  159,  123,   93,   44,   44,   44,   92,  122,
-       46,  190,  191,   44,   44,   44,   49,   94,   46,   44,
-       44,   44,   43,   96,   46,   83,   97,   81,   44,   44,
-       44,   80,   71,   46,   44,   44,   44,   49,   43,   46,
-      366,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-
-       98,   49,   46,   44,   44,   44,  366,  366,   46,  366,
-       49,   99,  101,  103,  366,  100,   49,  102,  366,  105,
-       44,   44,   44,   49,  366,   46,  104,  366,  366,   49,
-      366,  366,  107,  366,  366,   49,  366,  366,   44,   44,
-       44,  366,  108,   46,  106,   73,   73,   73,   73,  366,
-      366,  109,   49,  366,  366,  110,  111,  366,   68,   68,
-       68,   68,   73,   73,   73,   73,  366,  112,   66,  366,
-       49,  113,  366,  114,   64,  366,   65,   65,   65,   65,
-      366,  366,  366,   72,   66,   72,   66,  366,   73,   73,
-       73,   73,   64,  366,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   66,  366,   66,   44,   44,   44,   66,  366,
-       46,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-       66,  366,   46,  366,   66,  366,  366,  366,   44,   44,
-       44,  366,  366,   46,  366,  366,  366,   49,  366,   44,
-       44,   44,  366,   49,  131,  366,  125,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,  366,  366,  366,  366,
-       49,  366,  366,  126,  129,  129,  129,  129,  366,  366,
-      366,   49,  129,  129,  129,  129,  130,  366,   44,   44,
-       44,  366,   49,  134,  366,  366,  129,  129,  129,  129,
-      129,  129,  366,   44,   44,   44,  132,  133,   46,   44,
-
-       44,   44,  366,  366,   46,  366,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,   44,   44,
-       44,  366,  366,   46,  366,   49,  366,  366,  366,  135,
-      366,   49,   44,   44,   44,  366,  136,   46,   49,  366,
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,  366,  137,
-      138,  366,  366,  366,   49,  366,  366,  366,  140,  366,
-      139,  366,   49,  366,   44,   44,   44,  366,   49,   46,
-      366,  141,  366,  366,   49,  366,   44,   44,   44,  366,
-      144,   46,  366,  142,   44,   44,   44,  366,  366,   46,
-
-      366,  143,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,  366,   46,   44,   44,   44,  366,   49,   46,
-      145,  366,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,  366,   46,   49,  366,  366,  366,  146,  366,
-       49,  366,  366,  366,  147,  149,   49,  366,   44,   44,
-       44,  366,  150,   46,   49,  366,  148,  366,  151,  366,
-       49,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-      366,  152,   46,   44,   44,   44,  366,  366,   46,  366,
-       49,  366,  366,   44,   44,   44,  366,  153,   46,  366,
-      366,  366,  366,   49,  366,   44,   44,   44,  366,   49,
-
-       46,  366,  366,  366,  366,   49,  154,  366,  163,  366,
-      164,  165,  165,  165,  165,   49,  366,  366,  366,  165,
-      165,  165,  165,   44,   44,   44,  366,   49,   46,  167,
-      366,  366,  366,  165,  165,  165,  165,  165,  165,   44,
-       44,   44,  366,  366,   46,  366,  366,  166,   44,   44,
-       44,  366,  366,   46,  366,   49,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,   44,   44,
-       44,   49,  366,   46,  366,  168,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  366,  169,  366,   49,  366,  366,  170,  366,  366,
-
-       49,  366,  366,  366,  366,  366,  172,  171,   49,  366,
-       44,   44,   44,  366,   49,   46,  366,  173,  366,   44,
-       44,   44,  366,  175,   46,  366,  174,   44,   44,   44,
-      366,  366,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,   49,  366,   46,  176,  366,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  366,   46,   49,
-      366,  366,   44,   44,   44,   49,  179,   46,  366,  366,
-      177,   49,  180,  178,  366,   44,   44,   44,  366,   49,
-       46,  366,  182,  366,  366,   49,  366,  366,  181,  366,
-      366,  366,  183,  366,   49,   44,   44,   44,  366,  366,
-
-       46,  366,  366,   44,   44,   44,  184,   49,   46,   44,
-       44,   44,  366,  366,   46,  366,  366,   44,   44,   44,
-      366,  366,   46,  185,   44,   44,   44,   49,  366,   46,
-      366,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  186,  197,   46,   49,
-      366,  366,  366,  366,  366,  366,   49,  366,  187,  188,
-      189,  366,  366,   49,  366,  366,  366,  194,  366,   49,
-      366,  366,  366,  366,  366,   49,  366,  366,  366,  195,
-      196,  196,  196,  196,  200,  366,  366,  366,  196,  196,
-      196,  196,   44,   44,   44,  366,  366,   46,  366,  366,
-
-      366,  366,  196,  196,  196,  196,  196,  196,   44,   44,
-       44,  366,  366,   46,   44,   44,   44,  366,  366,   46,
-       44,   44,   44,  366,   49,   46,  366,  366,  366,  201,
-      202,  198,   44,   44,   44,  366,  366,   46,  366,  366,
-       49,  366,   44,   44,   44,  366,   49,  205,  366,   44,
-       44,   44,   49,  366,   46,   44,   44,   44,  199,  366,
-       46,  366,  203,  366,   49,   44,   44,   44,  366,  366,
-       46,   44,   44,   44,   49,  366,   46,   44,   44,   44,
-      366,   49,   46,  204,  206,  366,  366,   49,   44,   44,
-       44,  366,  366,   46,  207,  366,  366,   49,  366,   44,
-
-       44,   44,  366,   49,  212,  366,  208,  366,  366,   49,
-       44,   44,   44,  366,  209,   46,  210,  366,  366,  366,
-       49,   44,   44,   44,  366,  366,   46,   44,   44,   44,
-      366,   49,   46,  211,   44,   44,   44,  366,  366,   46,
-      366,  366,   49,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,   49,   46,   44,   44,   44,  366,   49,
-      219,  366,  366,  213,  366,  366,   49,  214,  366,   44,
-       44,   44,  366,  216,   46,   49,  366,  215,  366,  220,
-      366,   49,  366,   44,   44,   44,  218,   49,   46,  366,
-       44,   44,   44,  366,  366,   46,  217,   44,   44,   44,
-
-      366,   49,   46,  366,   44,   44,   44,  366,  366,   46,
-      366,   44,   44,   44,  366,   49,   46,  366,   44,   44,
-       44,  221,   49,   46,  366,  366,  366,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,   49,  224,  366,  366,
-      366,  366,  366,   49,  225,   45,   45,   45,   45,  366,
-       49,  366,  366,   45,   45,   45,   45,  226,  227,   44,
-       44,   44,   49,  366,  230,  366,  228,   45,   45,   45,
-       45,   45,   45,  366,  366,  229,   44,   44,   44,  366,
-      366,  231,   44,   44,   44,  366,  366,  232,   44,   44,
-       44,   49,  366,   46,   44,   44,   44,  366,  233,   46,
-
-       44,   44,   44,  366,  366,   46,  366,  366,   49,  366,
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-       49,   46,   44,   44,   44,  366,   49,   46,   44,   44,
-       44,  366,   49,  239,   44,   44,   44,  366,  366,   46,
-      366,  366,   49,  366,  234,  366,  366,  366,   49,  236,
-      235,   44,   44,   44,   49,  366,   46,   44,   44,   44,
-       49,  366,   46,   44,   44,   44,   49,  366,   46,   44,
-       44,   44,  238,  237,   46,   44,   44,   44,  366,  366,
-       46,  366,  366,   49,  366,  366,  240,  366,  366,   49,
-      241,   44,   44,   44,  366,   49,   46,   44,   44,   44,
-
-      242,   49,   46,   44,   44,   44,  366,   49,   46,   44,
-       44,   44,  366,  366,   46,  243,  366,  366,  366,  366,
-      366,  244,  366,   49,  366,  245,  366,  366,  246,   49,
-      366,  366,  247,  366,  366,   49,  366,   44,   44,   44,
-      366,   49,   46,  366,  249,   44,   44,   44,  366,  250,
-       46,   44,   44,   44,  366,  366,   46,  366,  366,   44,
-       44,   44,  366,  366,   46,  366,  366,  366,  366,   49,
-       44,   44,   44,  366,  366,   46,  366,   49,  366,   44,
-       44,   44,  366,   49,   46,  366,  251,   44,   44,   44,
-      366,   49,   46,  366,  366,  366,  253,  252,  254,   44,
-
-       44,   44,   49,  366,   46,  366,  366,   44,   44,   44,
-      366,   49,   46,  366,  366,  255,   44,   44,   44,   49,
-      366,  260,   44,   44,   44,  366,  366,  261,   44,   44,
-       44,   49,  366,   46,  366,  256,  366,  258,  257,   49,
-       44,   44,   44,  366,  366,   46,  259,  366,   49,  366,
-       44,   44,   44,  366,   49,  266,  262,   44,   44,   44,
-       49,  366,   46,   44,   44,   44,  366,  265,   46,   44,
-       44,   44,   49,  366,   46,  366,   44,   44,   44,  366,
-      263,   46,   49,   44,   44,   44,  366,  366,  270,   49,
-      366,  366,  264,  366,  366,   49,  366,   44,   44,   44,
-
-      366,   49,  271,  366,  366,  366,  267,  366,   49,   44,
-       44,   44,  366,  366,   46,   49,  366,  268,   44,   44,
-       44,  366,  366,  273,  366,   44,   44,   44,  269,   49,
-       46,   44,   44,   44,  366,  274,   46,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  272,  277,  366,
-       49,   44,   44,   44,  366,  366,  278,   49,  366,  366,
-       44,   44,   44,   49,  366,   46,   44,   44,   44,   49,
-      279,  280,   44,   44,   44,   49,  366,   46,  366,  366,
-      276,  366,  366,   49,  366,  275,   44,   44,   44,  366,
-      366,   46,   49,  366,   44,   44,   44,  366,   49,   46,
-
-       44,   44,   44,  366,   49,   46,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,   49,  366,
-      281,  366,   44,   44,   44,  282,   49,   46,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,   49,   46,
-      366,  366,  287,  366,   49,  366,  366,  284,  366,  366,
-      283,  366,  285,  286,   49,  366,  366,  366,  366,  288,
-       49,  289,  366,  290,  366,  366,   49,   44,   44,   44,
-      366,  366,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,  366,   46,  291,   44,   44,   44,  366,
-      366,   46,   44,   44,   44,  366,  366,   46,  366,   49,
-
-      366,  366,   44,   44,   44,   49,  292,  297,  366,  293,
-      366,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-       44,   44,   44,  366,   49,   46,  366,   44,   44,   44,
-      294,  366,   46,  366,   49,  295,   44,   44,   44,  366,
-      366,   46,  296,  366,   49,  366,  366,  298,   44,   44,
-       44,  366,   49,   46,  366,   44,   44,   44,  366,   49,
-       46,   44,   44,   44,  366,  303,   46,  366,   49,   44,
-       44,   44,  366,  366,   46,  301,  299,  300,  366,  366,
-       49,  366,  366,   44,   44,   44,  366,   49,   46,   44,
-       44,   44,  366,   49,   46,  366,  366,   44,   44,   44,
-
-      302,   49,   46,   44,   44,   44,  366,  366,   46,   44,
-       44,   44,  366,  304,   46,   49,  366,  305,   44,   44,
-       44,   49,  366,   46,  366,   44,   44,   44,  306,   49,
-       46,  366,  366,  366,  366,   49,  308,  366,  366,  307,
-      366,   49,  366,   44,   44,   44,  366,  366,   46,  366,
-       49,   44,   44,   44,  366,  309,   46,   49,  366,  366,
-      310,  314,  366,  366,  311,   44,   44,   44,  366,  366,
-       46,   44,   44,   44,  312,   49,   46,   44,   44,   44,
-      366,  366,   46,   49,  366,   44,   44,   44,  313,  366,
-       46,   44,   44,   44,  366,  366,  319,   49,  366,  366,
-
-       44,   44,   44,   49,  315,   46,  366,  366,  316,   49,
-       44,   44,   44,  366,  366,   46,  317,   49,  366,   44,
-       44,   44,  318,   49,   46,   44,   44,   44,  366,  366,
-      323,  366,   49,  366,  366,  320,   44,   44,   44,  366,
-      366,   46,   49,  366,   44,   44,   44,  366,  366,   46,
-      366,   49,  366,   44,   44,   44,  366,   49,  326,  366,
-      321,  366,  322,  366,   44,   44,   44,  366,   49,   46,
-      366,  366,   44,   44,   44,  324,   49,   46,  366,   44,
-       44,   44,  366,  325,   46,   49,   44,   44,   44,  366,
-      366,  330,   44,   44,   44,  366,   49,   46,   44,   44,
-
-       44,  327,  366,   46,   49,   44,   44,   44,  366,  366,
-       46,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  329,  366,  366,   49,  366,  366,  328,  366,  366,
-       49,  366,  366,   44,   44,   44,  331,   49,  335,  366,
-       44,   44,   44,  366,   49,  336,  366,  366,  332,   44,
-       44,   44,  366,  366,   46,  366,   44,   44,   44,  333,
-      334,   46,   44,   44,   44,   49,  366,   46,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,  366,   46,
-      366,   49,   44,   44,   44,  366,  366,   46,   49,  366,
-      366,  337,  366,  366,   49,  366,  366,  339,  366,  366,
-
-       49,  366,  366,  366,  366,  366,   49,  340,  338,  366,
-       44,   44,   44,  366,   49,   46,  366,  341,   44,   44,
-       44,  342,  366,   46,   44,   44,   44,  366,  366,  345,
-       44,   44,   44,  366,  366,   46,   44,   44,   44,  366,
-      366,   46,   49,   44,   44,   44,  366,  366,   46,  366,
-       49,  366,  366,  344,  366,  366,   49,  343,   44,   44,
-       44,  366,   49,   46,   44,   44,   44,  366,   49,   46,
-      366,   44,   44,   44,  366,   49,   46,  346,   44,   44,
-       44,  366,  348,   46,   44,   44,   44,  366,  347,  353,
-       49,  366,   44,   44,   44,  366,   49,   46,  366,   44,
-
-       44,   44,  366,   49,   46,  366,  366,  366,  349,  366,
-       49,  366,   44,   44,   44,  350,   49,  356,  351,  352,
-       44,   44,   44,  366,   49,   46,  366,   44,   44,   44,
-      366,   49,   46,   44,   44,   44,  366,  366,  359,  366,
-       44,   44,   44,  354,   49,  360,   44,   44,   44,  366,
-      355,   46,   49,  366,  366,   44,   44,   44,  366,   49,
-       46,  357,   44,   44,   44,   49,  358,   46,   44,   44,
-       44,  366,   49,  364,  366,   44,   44,   44,   49,  366,
-      365,  366,  366,  366,  366,  361,  366,   49,  366,  366,
-      366,  366,  366,  366,   49,  366,  366,  366,  366,  366,
-
-       49,  366,  366,  366,  366,  366,  362,   49,  366,  366,
-      366,  366,  366,  363,   36,   36,   36,   36,   36,   36,
-       36,   45,   45,   45,   45,   45,   45,   45,   63,  366,
-       63,   63,   63,   63,   63,   82,  366,   82,  366,   82,
-       82,   82,   84,   84,   84,   84,   84,   84,   84,   89,
-       89,   89,   89,   89,   89,   89,  115,  366,  115,  115,
-      115,  115,  115,   84,   84,  366,   84,  127,  127,  127,
-      127,  127,  162,  162,  193,  193,  223,  223,   84,   84,
-       11,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+       11,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,   23,   22,   35,   22,   23,   13,   12,
+       23,   24,   25,   26,   27,   14,   28,   28,   28,   28,
+       29,   17,   23,   23,   23,   23,   30,   20,   23,   21,
+       23,   23,   19,   23,   31,   23,   32,   23,   23,   23,
+
+       23,   23,   30,   16,   23,   23,   23,   23,   23,   23,
+       18,   23,   23,   23,   23,   23,   15,   23,   23,   23,
+       23,   23,   23,   33,   34,   37,   38,   35,   38,   37,
+       37,   37,   36,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   37,   37,   37,
+       37,   37,   37,   37,   37,   37,   37,   23,   23,   40,
+       23,   23,   23,   23,   23,   23,   23,   23,   23,   23,
+
+       23,   41,  414,   70,   65,   23,   23,   68,   23,   66,
+       71,   23,   73,   23,   68,   23,   70,   69,   73,   82,
+       83,   23,   23,   84,   23,   39,   74,   23,   74,   23,
+       86,   67,   91,   53,  104,   23,   72,   78,   78,   78,
+       78,   53,   23,   23,   42,   42,   92,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+       42,   42,   42,   42,   42,   42,   42,   42,   42,   42,
+
+       42,   42,   42,   42,   42,   42,   64,   64,   64,   53,
+       53,   63,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+       53,   46,   51,   53,   53,   53,   53,   53,   62,   53,
+       53,   54,   55,   48,   43,   53,   56,   53,   57,   53,
+       53,   49,   50,   52,   58,   44,   59,   45,   47,   53,
+       60,   61,   53,   53,   53,   53,   53,   53,   76,   97,
+       75,   75,   75,   75,  414,  105,   79,   79,   79,   79,
+       77,   80,   98,   80,  106,   99,   81,   81,   81,   81,
+      100,   85,   85,  107,   85,   85,   77,   85,   85,   85,
+
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   85,   85,   85,   85,   85,   85,   85,
+       85,   85,   85,   88,   93,   53,  108,  101,  112,  103,
+      115,  109,  125,   94,   53,   53,  110,  111,   95,   96,
+      102,   53,  127,  125,   53,   53,   53,   53,   89,   53,
+      128,   87,  130,  131,   53,   53,   53,   53,   53,   53,
+       53,   53,   90,   53,   53,  113,   53,  124,  132,   53,
+
+      114,  119,  119,  119,  119,  119,  117,  119,  119,  119,
+      119,  119,  119,  116,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  116,  119,  119,  119,  116,  119,  119,
+      119,  116,  119,  119,  119,  119,  119,  119,  116,  119,
+      119,  119,  116,  119,  116,  118,  119,  119,  119,  119,
+      119,  119,  119,  120,  120,  120,  120,  120,  121,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  122,  120,  120,  120,  120,
+
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  120,  120,  120,  120,  120,
+      120,  120,  120,  120,  120,  123,  123,  133,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  123,  123,  123,
+      123,  123,  123,  123,  123,  123,  123,  127,  128,  414,
+      134,  414,  135,  136,  137,  138,  139,  140,  141,  142,
+
+      143,  144,  145,  146,  147,  149,  150,  126,  129,  151,
+      152,  153,  154,  155,  148,  156,  157,  158,  159,  160,
+      161,  162,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  163,  163,  163,  163,  164,
+      164,  164,  164,  163,  163,  163,  163,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  163,  163,  163,
+      163,  163,  163,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  164,  164,  164,  164,  164,  164,
+      164,  164,  164,  164,  165,  165,  166,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  165,  165,  165,  165,  165,  165,  165,
+      165,  165,  165,  167,  169,  169,  172,  172,  173,  174,
+      167,  175,  176,  177,  178,  179,  180,  181,  182,  183,
+      170,  184,  185,  186,  187,  188,  189,  192,  173,  190,
+      167,  171,  191,  193,  167,  194,  195,  196,  167,  197,
+      198,  199,  200,  201,  202,  167,  203,  204,  205,  167,
+      209,  167,  168,  206,  206,  206,  206,  209,  210,  211,
+
+      212,  206,  206,  206,  206,  213,  208,  214,  215,  216,
+      217,  218,  219,  220,  221,  206,  206,  206,  206,  206,
+      206,  207,  207,  207,  207,  222,  223,  224,  225,  207,
+      207,  207,  207,  226,  227,  228,  229,  230,  231,  232,
+      233,  234,  235,  207,  207,  207,  207,  207,  207,  236,
+      237,  238,  239,  240,  241,  242,  242,  242,  242,  244,
+      245,  246,  247,  242,  242,  242,  242,  248,  249,  250,
+      251,  252,  253,  254,  255,  256,  257,  242,  242,  242,
+      242,  242,  242,  243,  243,  243,  243,  258,  259,  260,
+      261,  243,  243,  243,  243,  262,  263,  264,  265,  266,
+
+      267,  268,  269,  270,  271,  243,  243,  243,  243,  243,
+      243,  272,  273,  273,  273,  273,  275,  276,  277,  278,
+      273,  273,  273,  273,  279,  280,  281,  282,  283,  284,
+      285,  286,  287,  288,  273,  273,  273,  273,  273,  273,
+      274,  274,  274,  274,  289,  290,  291,  292,  274,  274,
+      274,  274,  293,  295,  296,  297,  298,  299,  301,  302,
+      303,  304,  274,  274,  274,  274,  274,  274,  300,  300,
+      300,  300,  305,  309,  306,  310,  300,  300,  300,  300,
+      307,  308,  294,  311,  312,  313,  314,  315,  316,  317,
+      300,  300,  300,  300,  300,  300,  318,  319,  320,  321,
+
+      322,  323,  324,  325,  326,  327,  328,  329,  330,  331,
+      332,  333,  334,  335,  336,  337,  338,  339,  340,  341,
+      342,  343,  344,  345,  346,  347,  348,  349,  350,  351,
+      352,  353,  354,  355,  356,  357,  358,  359,  360,  361,
+      362,  363,  364,  365,  366,  367,  368,  369,  370,  371,
+      372,  373,  374,  375,  376,  377,  378,  379,  380,  381,
+      382,  383,  384,  385,  386,  387,  388,  389,  390,  391,
+      392,  393,  394,  395,  396,  397,  398,  399,  400,  401,
+      402,  403,  404,  405,  406,  407,  408,  409,  410,  411,
+      412,  413,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[2542] =
+static const flex_int16_t yy_chk[1249] =
     {   0,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,  414,  414,  414,  414,  414,  414,  414,
+      414,  414,  414,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    3,    9,    7,    4,
-        5,    5,    8,    5,    5,    5,    5,    5,    5,    5,
-        5,    5,    5,    5,   10,   13,   26,   13,    5,    5,
-        9,    5,   21,   37,    5,   37,    5,   21,    5,   27,
-
-       26,   31,   44,  222,    5,    5,    7,   10,    5,   28,
-        8,   42,    5,   42,   32,   31,   17,    5,   17,   17,
-       17,   17,   27,    5,    5,   15,   15,   15,   17,   44,
-       15,   19,   28,   19,   19,   19,   19,   32,   20,   20,
-       20,   20,  192,   19,   17,   33,   74,   25,   20,   25,
-       15,   15,   25,   25,   25,   25,  161,   15,   76,   19,
-      127,   15,   15,   15,   20,   15,   74,   15,   33,   75,
-       15,   15,   15,   15,   15,  122,   15,   77,   15,   15,
-       22,   76,   22,   22,   22,   22,   45,   45,   45,   75,
-       79,   45,   22,   47,   47,   47,   78,   77,   47,   48,
-
-       48,   48,   49,   84,   48,  116,  117,  118,   22,   49,
-       50,   50,   50,   79,   89,   50,   78,  119,   45,   51,
-       51,   51,   86,  118,   51,   47,  117,  121,  116,   49,
-       84,   48,  120,   49,   52,   52,   52,   49,   48,   52,
-      119,   47,   50,  121,   49,  155,  158,   49,   52,   49,
-       49,   51,  120,   82,   51,   53,   53,   53,   50,   81,
-       53,  155,  158,   54,   54,   54,   52,   51,   54,   55,
-       55,   55,   43,   52,   55,   41,   52,   39,   56,   56,
-       56,   38,   24,   56,   57,   57,   57,   53,   14,   57,
-       11,   58,   58,   58,    0,   54,   58,   59,   59,   59,
-
-       53,   55,   59,   60,   60,   60,    0,    0,   60,    0,
-       56,   54,   55,   56,    0,   54,   57,   55,    0,   57,
-       61,   61,   61,   58,    0,   61,   56,    0,    0,   59,
-        0,    0,   59,    0,    0,   60,    0,    0,   62,   62,
-       62,    0,   60,   62,   58,   72,   72,   72,   72,    0,
-        0,   60,   61,    0,    0,   60,   60,    0,   64,   64,
-       64,   64,   73,   73,   73,   73,    0,   61,   64,    0,
-       62,   61,    0,   62,   65,    0,   65,   65,   65,   65,
-        0,    0,    0,   66,   64,   66,   65,    0,   66,   66,
-       66,   66,   67,    0,   67,   67,   67,   67,   68,   68,
-
-       68,   68,   65,    0,   67,   87,   87,   87,   68,    0,
-       87,   88,   88,   88,    0,    0,   88,   90,   90,   90,
-       67,    0,   90,    0,   68,    0,    0,    0,   92,   92,
-       92,    0,    0,   92,    0,    0,    0,   87,    0,   93,
-       93,   93,    0,   88,   93,    0,   87,    0,    0,   90,
-       94,   94,   94,    0,    0,   94,    0,    0,    0,    0,
-       92,    0,    0,   88,   91,   91,   91,   91,    0,    0,
-        0,   93,   91,   91,   91,   91,   92,    0,   95,   95,
-       95,    0,   94,   95,    0,    0,   91,   91,   91,   91,
-       91,   91,    0,   96,   96,   96,   94,   94,   96,   97,
-
-       97,   97,    0,    0,   97,    0,   98,   98,   98,    0,
-       95,   98,   99,   99,   99,    0,    0,   99,  100,  100,
-      100,    0,    0,  100,    0,   96,    0,    0,    0,   96,
-        0,   97,  101,  101,  101,    0,   97,  101,   98,    0,
-      102,  102,  102,    0,   99,  102,  103,  103,  103,    0,
-      100,  103,  104,  104,  104,    0,    0,  104,    0,   98,
-       99,    0,    0,    0,  101,    0,    0,    0,  101,    0,
-      100,    0,  102,    0,  105,  105,  105,    0,  103,  105,
-        0,  102,    0,    0,  104,    0,  106,  106,  106,    0,
-      104,  106,    0,  103,  107,  107,  107,    0,    0,  107,
-
-        0,  103,  108,  108,  108,    0,  105,  108,  109,  109,
-      109,    0,    0,  109,  110,  110,  110,    0,  106,  110,
-      105,    0,  111,  111,  111,    0,  107,  111,  112,  112,
-      112,    0,    0,  112,  108,    0,    0,    0,  106,    0,
-      109,    0,    0,    0,  107,  109,  110,    0,  113,  113,
-      113,    0,  110,  113,  111,    0,  108,    0,  111,    0,
-      112,  114,  114,  114,    0,    0,  114,  125,  125,  125,
-        0,  112,  125,  126,  126,  126,    0,    0,  126,    0,
-      113,    0,    0,  132,  132,  132,    0,  113,  132,    0,
-        0,    0,    0,  114,    0,  130,  130,  130,    0,  125,
-
-      130,    0,    0,    0,    0,  126,  114,    0,  125,    0,
-      126,  129,  129,  129,  129,  132,    0,    0,    0,  129,
-      129,  129,  129,  133,  133,  133,    0,  130,  133,  132,
-        0,    0,    0,  129,  129,  129,  129,  129,  129,  135,
-      135,  135,    0,    0,  135,    0,    0,  130,  136,  136,
-      136,    0,    0,  136,    0,  133,  137,  137,  137,    0,
-        0,  137,  138,  138,  138,    0,    0,  138,  139,  139,
-      139,  135,    0,  139,    0,  133,  140,  140,  140,    0,
-      136,  140,  141,  141,  141,    0,    0,  141,  137,    0,
-        0,    0,  135,    0,  138,    0,    0,  136,    0,    0,
-
-      139,    0,    0,    0,    0,    0,  138,  137,  140,    0,
-      142,  142,  142,    0,  141,  142,    0,  139,    0,  143,
-      143,  143,    0,  141,  143,    0,  140,  144,  144,  144,
-        0,    0,  144,  145,  145,  145,    0,    0,  145,  146,
-      146,  146,  142,    0,  146,  142,    0,  147,  147,  147,
-        0,  143,  147,  148,  148,  148,    0,    0,  148,  144,
-        0,    0,  149,  149,  149,  145,  144,  149,    0,    0,
-      143,  146,  145,  143,    0,  150,  150,  150,    0,  147,
-      150,    0,  147,    0,    0,  148,    0,    0,  146,    0,
-        0,    0,  148,    0,  149,  151,  151,  151,    0,    0,
-
-      151,    0,    0,  152,  152,  152,  149,  150,  152,  153,
-      153,  153,    0,    0,  153,    0,    0,  154,  154,  154,
-        0,    0,  154,  150,  163,  163,  163,  151,    0,  163,
-        0,  164,  164,  164,    0,  152,  164,  166,  166,  166,
-        0,  153,  166,  169,  169,  169,  151,  166,  169,  154,
-        0,    0,    0,    0,    0,    0,  163,    0,  152,  153,
-      154,    0,    0,  164,    0,    0,    0,  163,    0,  166,
-        0,    0,    0,    0,    0,  169,    0,    0,    0,  164,
-      165,  165,  165,  165,  169,    0,    0,    0,  165,  165,
-      165,  165,  167,  167,  167,    0,    0,  167,    0,    0,
-
-        0,    0,  165,  165,  165,  165,  165,  165,  168,  168,
-      168,    0,    0,  168,  170,  170,  170,    0,    0,  170,
-      171,  171,  171,    0,  167,  171,    0,    0,    0,  170,
-      170,  167,  172,  172,  172,    0,    0,  172,    0,    0,
-      168,    0,  173,  173,  173,    0,  170,  173,    0,  174,
-      174,  174,  171,    0,  174,  175,  175,  175,  168,    0,
-      175,    0,  171,    0,  172,  176,  176,  176,    0,    0,
-      176,  177,  177,  177,  173,    0,  177,  178,  178,  178,
-        0,  174,  178,  172,  174,    0,    0,  175,  179,  179,
-      179,    0,    0,  179,  175,    0,    0,  176,    0,  180,
-
-      180,  180,    0,  177,  180,    0,  176,    0,    0,  178,
-      181,  181,  181,    0,  177,  181,  178,    0,    0,    0,
-      179,  182,  182,  182,    0,    0,  182,  183,  183,  183,
-        0,  180,  183,  179,  184,  184,  184,    0,    0,  184,
-        0,    0,  181,  185,  185,  185,    0,    0,  185,  186,
-      186,  186,    0,  182,  186,  187,  187,  187,    0,  183,
-      187,    0,    0,  181,    0,    0,  184,  182,    0,  188,
-      188,  188,    0,  184,  188,  185,    0,  183,    0,  188,
-        0,  186,    0,  189,  189,  189,  186,  187,  189,    0,
-      194,  194,  194,    0,    0,  194,  185,  195,  195,  195,
-
-        0,  188,  195,    0,  197,  197,  197,    0,    0,  197,
-        0,  198,  198,  198,    0,  189,  198,    0,  199,  199,
-      199,  189,  194,  199,    0,    0,    0,    0,    0,  195,
-      200,  200,  200,    0,    0,  200,  197,  194,    0,    0,
-        0,    0,    0,  198,  195,  196,  196,  196,  196,    0,
-      199,    0,    0,  196,  196,  196,  196,  197,  198,  201,
-      201,  201,  200,    0,  201,    0,  199,  196,  196,  196,
-      196,  196,  196,    0,    0,  200,  202,  202,  202,    0,
-        0,  202,  203,  203,  203,    0,    0,  203,  204,  204,
-      204,  201,    0,  204,  206,  206,  206,    0,  204,  206,
-
-      207,  207,  207,    0,    0,  207,    0,    0,  202,    0,
-      208,  208,  208,    0,  203,  208,  209,  209,  209,    0,
-      204,  209,  210,  210,  210,    0,  206,  210,  211,  211,
-      211,    0,  207,  211,  213,  213,  213,    0,    0,  213,
-        0,    0,  208,    0,  206,    0,    0,    0,  209,  208,
-      207,  214,  214,  214,  210,    0,  214,  215,  215,  215,
-      211,    0,  215,  216,  216,  216,  213,    0,  216,  217,
-      217,  217,  210,  209,  217,  218,  218,  218,    0,    0,
-      218,    0,    0,  214,    0,    0,  213,    0,    0,  215,
-      214,  220,  220,  220,    0,  216,  220,  221,  221,  221,
-
-      215,  217,  221,  224,  224,  224,    0,  218,  224,  225,
-      225,  225,    0,    0,  225,  216,    0,    0,    0,    0,
-        0,  217,    0,  220,    0,  218,    0,    0,  220,  221,
-        0,    0,  221,    0,    0,  224,    0,  226,  226,  226,
-        0,  225,  226,    0,  224,  227,  227,  227,    0,  225,
-      227,  228,  228,  228,    0,    0,  228,    0,    0,  229,
-      229,  229,    0,    0,  229,    0,    0,    0,    0,  226,
-      233,  233,  233,    0,    0,  233,    0,  227,    0,  234,
-      234,  234,    0,  228,  234,    0,  226,  235,  235,  235,
-        0,  229,  235,    0,    0,    0,  228,  227,  229,  236,
-
-      236,  236,  233,    0,  236,    0,    0,  237,  237,  237,
-        0,  234,  237,    0,    0,  233,  238,  238,  238,  235,
-        0,  238,  240,  240,  240,    0,    0,  240,  241,  241,
-      241,  236,    0,  241,    0,  234,    0,  236,  235,  237,
-      242,  242,  242,    0,    0,  242,  237,    0,  238,    0,
-      244,  244,  244,    0,  240,  244,  240,  243,  243,  243,
-      241,    0,  243,  245,  245,  245,    0,  243,  245,  246,
-      246,  246,  242,    0,  246,    0,  247,  247,  247,    0,
-      241,  247,  244,  249,  249,  249,    0,    0,  249,  243,
-        0,    0,  242,    0,    0,  245,    0,  250,  250,  250,
-
-        0,  246,  250,    0,    0,    0,  245,    0,  247,  251,
-      251,  251,    0,    0,  251,  249,    0,  246,  252,  252,
-      252,    0,    0,  252,    0,  253,  253,  253,  247,  250,
-      253,  254,  254,  254,    0,  253,  254,  255,  255,  255,
-        0,  251,  255,  256,  256,  256,    0,  251,  256,    0,
-      252,  257,  257,  257,    0,    0,  257,  253,    0,    0,
-      258,  258,  258,  254,    0,  258,  259,  259,  259,  255,
-      258,  259,  262,  262,  262,  256,    0,  262,    0,    0,
-      255,    0,    0,  257,    0,  254,  263,  263,  263,    0,
-        0,  263,  258,    0,  264,  264,  264,    0,  259,  264,
-
-      265,  265,  265,    0,  262,  265,  267,  267,  267,    0,
-        0,  267,  268,  268,  268,    0,    0,  268,  263,    0,
-      262,    0,  269,  269,  269,  263,  264,  269,  272,  272,
-      272,    0,  265,  272,  274,  274,  274,    0,  267,  274,
-        0,    0,  267,    0,  268,    0,    0,  265,    0,    0,
-      264,    0,  265,  265,  269,    0,    0,    0,    0,  268,
-      272,  269,    0,  272,    0,    0,  274,  275,  275,  275,
-        0,    0,  275,  276,  276,  276,    0,    0,  276,  279,
-      279,  279,    0,    0,  279,  274,  281,  281,  281,    0,
-        0,  281,  282,  282,  282,    0,    0,  282,    0,  275,
-
-        0,    0,  283,  283,  283,  276,  275,  283,    0,  276,
-        0,  279,  284,  284,  284,    0,    0,  284,  281,    0,
-      285,  285,  285,    0,  282,  285,    0,  286,  286,  286,
-      279,    0,  286,    0,  283,  281,  287,  287,  287,    0,
-        0,  287,  282,    0,  284,    0,    0,  284,  288,  288,
-      288,    0,  285,  288,    0,  289,  289,  289,    0,  286,
-      289,  290,  290,  290,    0,  289,  290,    0,  287,  291,
-      291,  291,    0,    0,  291,  287,  285,  286,    0,    0,
-      288,    0,    0,  292,  292,  292,    0,  289,  292,  293,
-      293,  293,    0,  290,  293,    0,    0,  294,  294,  294,
-
-      288,  291,  294,  295,  295,  295,    0,    0,  295,  296,
-      296,  296,    0,  290,  296,  292,    0,  291,  298,  298,
-      298,  293,    0,  298,    0,  299,  299,  299,  292,  294,
-      299,    0,    0,    0,    0,  295,  294,    0,    0,  293,
-        0,  296,    0,  300,  300,  300,    0,    0,  300,    0,
-      298,  301,  301,  301,    0,  295,  301,  299,    0,    0,
-      296,  301,    0,    0,  298,  302,  302,  302,    0,    0,
-      302,  303,  303,  303,  299,  300,  303,  304,  304,  304,
-        0,    0,  304,  301,    0,  305,  305,  305,  300,    0,
-      305,  306,  306,  306,    0,    0,  306,  302,    0,    0,
-
-      307,  307,  307,  303,  302,  307,    0,    0,  303,  304,
-      308,  308,  308,    0,    0,  308,  304,  305,    0,  309,
-      309,  309,  305,  306,  309,  310,  310,  310,    0,    0,
-      310,    0,  307,    0,    0,  307,  311,  311,  311,    0,
-        0,  311,  308,    0,  312,  312,  312,    0,    0,  312,
-        0,  309,    0,  313,  313,  313,    0,  310,  313,    0,
-      308,    0,  309,    0,  314,  314,  314,    0,  311,  314,
-        0,    0,  315,  315,  315,  311,  312,  315,    0,  316,
-      316,  316,    0,  312,  316,  313,  317,  317,  317,    0,
-        0,  317,  318,  318,  318,    0,  314,  318,  320,  320,
-
-      320,  314,    0,  320,  315,  321,  321,  321,    0,    0,
-      321,  316,  322,  322,  322,    0,    0,  322,  317,    0,
-        0,  316,    0,    0,  318,    0,    0,  315,    0,    0,
-      320,    0,    0,  324,  324,  324,  318,  321,  324,    0,
-      325,  325,  325,    0,  322,  325,    0,    0,  320,  327,
-      327,  327,    0,    0,  327,    0,  328,  328,  328,  321,
-      322,  328,  329,  329,  329,  324,    0,  329,  331,  331,
-      331,    0,  325,  331,  332,  332,  332,    0,    0,  332,
-        0,  327,  333,  333,  333,    0,    0,  333,  328,    0,
-        0,  327,    0,    0,  329,    0,    0,  329,    0,    0,
-
-      331,    0,    0,    0,    0,    0,  332,  331,  328,    0,
-      334,  334,  334,    0,  333,  334,    0,  332,  337,  337,
-      337,  333,    0,  337,  338,  338,  338,    0,    0,  338,
-      339,  339,  339,    0,    0,  339,  340,  340,  340,    0,
-        0,  340,  334,  341,  341,  341,    0,    0,  341,    0,
-      337,    0,    0,  337,    0,    0,  338,  334,  342,  342,
-      342,    0,  339,  342,  343,  343,  343,    0,  340,  343,
-        0,  344,  344,  344,    0,  341,  344,  339,  346,  346,
-      346,    0,  341,  346,  347,  347,  347,    0,  340,  347,
-      342,    0,  348,  348,  348,    0,  343,  348,    0,  349,
-
-      349,  349,    0,  344,  349,    0,    0,    0,  342,    0,
-      346,    0,  350,  350,  350,  343,  347,  350,  344,  346,
-      351,  351,  351,    0,  348,  351,    0,  352,  352,  352,
-        0,  349,  352,  354,  354,  354,    0,    0,  354,    0,
-      355,  355,  355,  348,  350,  355,  357,  357,  357,    0,
-      349,  357,  351,    0,    0,  358,  358,  358,    0,  352,
-      358,  351,  361,  361,  361,  354,  352,  361,  362,  362,
-      362,    0,  355,  362,    0,  363,  363,  363,  357,    0,
-      363,    0,    0,    0,    0,  357,    0,  358,    0,    0,
-        0,    0,    0,    0,  361,    0,    0,    0,    0,    0,
-
-      362,    0,    0,    0,    0,    0,  358,  363,    0,    0,
-        0,    0,    0,  361,  367,  367,  367,  367,  367,  367,
-      367,  368,  368,  368,  368,  368,  368,  368,  369,    0,
-      369,  369,  369,  369,  369,  370,    0,  370,    0,  370,
-      370,  370,  371,  371,  371,  371,  371,  371,  371,  372,
-      372,  372,  372,  372,  372,  372,  373,    0,  373,  373,
-      373,  373,  373,  374,  374,    0,  374,  375,  375,  375,
-      375,  375,  376,  376,  377,  377,  378,  378,  379,  379,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366,  366,  366,  366,  366,  366,  366,  366,  366,  366,
-      366
+        1,    1,    1,    1,    1,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    5,    5,    7,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+
+        5,    9,   11,   16,   14,    5,    5,   15,    5,   14,
+       17,    5,   18,    5,   19,    5,   20,   16,   21,   35,
+       36,    5,    5,   39,    9,    5,   22,    7,   22,    5,
+       41,   15,   45,   46,   52,    5,   18,   26,   26,   26,
+       26,   53,    5,    5,   12,   12,   46,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+
+       12,   12,   12,   12,   12,   12,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   13,   13,
+       13,   13,   13,   13,   13,   13,   13,   13,   24,   48,
+       24,   24,   24,   24,   27,   54,   27,   27,   27,   27,
+       24,   30,   48,   30,   55,   49,   30,   30,   30,   30,
+       49,   40,   40,   56,   40,   40,   24,   40,   40,   40,
+
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   43,   47,   51,   57,   50,   59,   51,
+       61,   57,   68,   47,   43,   43,   58,   58,   47,   47,
+       50,   44,   70,   67,   43,   43,   43,   43,   43,   43,
+       73,   43,   84,   85,   43,   43,   43,   43,   43,   43,
+       43,   43,   44,   43,   43,   60,   44,   67,   87,   44,
+
+       60,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   62,   62,   62,   62,   62,   62,   62,
+       62,   62,   62,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+       64,   64,   64,   64,   64,   66,   66,   88,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+       66,   66,   66,   66,   66,   66,   66,   69,   72,   80,
+       89,   80,   90,   91,   92,   93,   94,   95,   96,   97,
+
+       98,   98,   99,  100,  101,  102,  103,   69,   72,  104,
+      105,  106,  107,  108,  101,  109,  110,  111,  112,  113,
+      114,  115,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  118,  118,  118,  118,  118,  118,
+      118,  118,  118,  118,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  119,  119,  119,  119,  119,  119,  119,
+      119,  119,  119,  122,  124,  125,  127,  126,  128,  129,
+      122,  130,  132,  134,  135,  136,  137,  138,  139,  140,
+      124,  141,  143,  144,  145,  146,  147,  149,  128,  148,
+      122,  126,  148,  150,  122,  151,  152,  153,  122,  154,
+      155,  156,  157,  158,  159,  122,  160,  161,  162,  122,
+      171,  122,  122,  163,  163,  163,  163,  172,  175,  176,
+
+      176,  163,  163,  163,  163,  177,  171,  178,  179,  180,
+      181,  182,  183,  184,  185,  163,  163,  163,  163,  163,
+      163,  168,  168,  168,  168,  186,  187,  188,  189,  168,
+      168,  168,  168,  190,  191,  192,  193,  194,  195,  196,
+      197,  198,  199,  168,  168,  168,  168,  168,  168,  200,
+      201,  202,  203,  204,  205,  206,  206,  206,  206,  210,
+      211,  212,  213,  206,  206,  206,  206,  214,  215,  216,
+      217,  218,  219,  220,  221,  222,  223,  206,  206,  206,
+      206,  206,  206,  207,  207,  207,  207,  224,  225,  226,
+      227,  207,  207,  207,  207,  228,  229,  231,  232,  233,
+
+      234,  236,  237,  238,  240,  207,  207,  207,  207,  207,
+      207,  241,  242,  242,  242,  242,  244,  247,  248,  249,
+      242,  242,  242,  242,  250,  251,  252,  253,  254,  255,
+      256,  257,  258,  259,  242,  242,  242,  242,  242,  242,
+      243,  243,  243,  243,  260,  261,  263,  265,  243,  243,
+      243,  243,  267,  268,  269,  270,  271,  272,  276,  277,
+      278,  279,  243,  243,  243,  243,  243,  243,  274,  274,
+      274,  274,  280,  283,  281,  284,  274,  274,  274,  274,
+      281,  281,  268,  285,  286,  287,  288,  289,  291,  292,
+      274,  274,  274,  274,  274,  274,  293,  294,  296,  297,
+
+      298,  299,  301,  302,  303,  305,  306,  307,  308,  309,
+      311,  314,  317,  318,  319,  320,  321,  322,  323,  324,
+      325,  326,  328,  329,  330,  331,  332,  333,  334,  335,
+      336,  337,  338,  339,  340,  341,  342,  343,  344,  345,
+      346,  347,  348,  349,  350,  351,  352,  353,  354,  355,
+      356,  360,  361,  363,  364,  365,  366,  367,  368,  369,
+      371,  372,  375,  376,  377,  379,  380,  381,  382,  383,
+      384,  385,  386,  387,  388,  389,  391,  392,  393,  394,
+      395,  396,  397,  398,  399,  401,  402,  404,  405,  406,
+      410,  411,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1450,15 +1181,15 @@ static char *yy_last_accepting_cpos;
 extern int yy_flex_debug;
 int yy_flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[62] =
+static const flex_int16_t yy_rule_linenum[66] =
     {   0,
       133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
       170,  177,  186,  198,  210,  220,  230,  240,  249,  258,
       267,  276,  285,  294,  303,  312,  321,  330,  339,  348,
       357,  366,  375,  384,  393,  402,  411,  420,  429,  438,
-      447,  456,  465,  474,  573,  578,  583,  588,  589,  590,
-      591,  592,  593,  595,  613,  626,  631,  635,  637,  639,
-      641
+      447,  456,  465,  474,  483,  492,  501,  510,  609,  614,
+      619,  624,  625,  626,  627,  628,  629,  631,  649,  662,
+      667,  671,  673,  675,  677
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1513,7 +1244,7 @@ using isc::netconf::NetconfParser;
 
 /* To avoid the call to exit... oops! */
 #define YY_FATAL_ERROR(msg) isc::netconf::ParserContext::fatal(msg)
-#line 1516 "netconf_lexer.cc"
+#line 1247 "netconf_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1539,8 +1270,8 @@ using isc::netconf::NetconfParser;
    by moving it ahead by yyleng bytes. yyleng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1542 "netconf_lexer.cc"
-#line 1543 "netconf_lexer.cc"
+#line 1273 "netconf_lexer.cc"
+#line 1274 "netconf_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1854,7 +1585,7 @@ YY_DECL
     }
 
 
-#line 1857 "netconf_lexer.cc"
+#line 1588 "netconf_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1883,13 +1614,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 367 )
+				if ( yy_current_state >= 415 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 366 );
+		while ( yy_current_state != 414 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -2390,6 +2121,42 @@ YY_RULE_SETUP
 case 42:
 YY_RULE_SETUP
 #line 456 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 43:
+YY_RULE_SETUP
+#line 465 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 44:
+YY_RULE_SETUP
+#line 474 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 45:
+YY_RULE_SETUP
+#line 483 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2399,9 +2166,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 46:
 YY_RULE_SETUP
-#line 465 "netconf_lexer.ll"
+#line 492 "netconf_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 47:
+YY_RULE_SETUP
+#line 501 "netconf_lexer.ll"
 {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -2411,9 +2190,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 48:
 YY_RULE_SETUP
-#line 474 "netconf_lexer.ll"
+#line 510 "netconf_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -2513,65 +2292,65 @@ YY_RULE_SETUP
     return NetconfParser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 45:
-/* rule 45 can match eol */
+case 49:
+/* rule 49 can match eol */
 YY_RULE_SETUP
-#line 573 "netconf_lexer.ll"
+#line 609 "netconf_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 46:
-/* rule 46 can match eol */
+case 50:
+/* rule 50 can match eol */
 YY_RULE_SETUP
-#line 578 "netconf_lexer.ll"
+#line 614 "netconf_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 47:
+case 51:
 YY_RULE_SETUP
-#line 583 "netconf_lexer.ll"
+#line 619 "netconf_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 48:
+case 52:
 YY_RULE_SETUP
-#line 588 "netconf_lexer.ll"
+#line 624 "netconf_lexer.ll"
 { return NetconfParser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 49:
+case 53:
 YY_RULE_SETUP
-#line 589 "netconf_lexer.ll"
+#line 625 "netconf_lexer.ll"
 { return NetconfParser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 50:
+case 54:
 YY_RULE_SETUP
-#line 590 "netconf_lexer.ll"
+#line 626 "netconf_lexer.ll"
 { return NetconfParser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 51:
+case 55:
 YY_RULE_SETUP
-#line 591 "netconf_lexer.ll"
+#line 627 "netconf_lexer.ll"
 { return NetconfParser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 52:
+case 56:
 YY_RULE_SETUP
-#line 592 "netconf_lexer.ll"
+#line 628 "netconf_lexer.ll"
 { return NetconfParser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 53:
+case 57:
 YY_RULE_SETUP
-#line 593 "netconf_lexer.ll"
+#line 629 "netconf_lexer.ll"
 { return NetconfParser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 54:
+case 58:
 YY_RULE_SETUP
-#line 595 "netconf_lexer.ll"
+#line 631 "netconf_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(yytext);
@@ -2590,9 +2369,9 @@ YY_RULE_SETUP
     return NetconfParser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 55:
+case 59:
 YY_RULE_SETUP
-#line 613 "netconf_lexer.ll"
+#line 649 "netconf_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(yytext);
@@ -2606,43 +2385,43 @@ YY_RULE_SETUP
     return NetconfParser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 56:
+case 60:
 YY_RULE_SETUP
-#line 626 "netconf_lexer.ll"
+#line 662 "netconf_lexer.ll"
 {
     string tmp(yytext);
     return NetconfParser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 57:
+case 61:
 YY_RULE_SETUP
-#line 631 "netconf_lexer.ll"
+#line 667 "netconf_lexer.ll"
 {
    return NetconfParser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 58:
+case 62:
 YY_RULE_SETUP
-#line 635 "netconf_lexer.ll"
+#line 671 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 59:
+case 63:
 YY_RULE_SETUP
-#line 637 "netconf_lexer.ll"
+#line 673 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 60:
+case 64:
 YY_RULE_SETUP
-#line 639 "netconf_lexer.ll"
+#line 675 "netconf_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 61:
+case 65:
 YY_RULE_SETUP
-#line 641 "netconf_lexer.ll"
+#line 677 "netconf_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 643 "netconf_lexer.ll"
+#line 679 "netconf_lexer.ll"
 {
     if (driver.states_.empty()) {
         return NetconfParser::make_END(driver.loc_);
@@ -2666,12 +2445,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 62:
+case 66:
 YY_RULE_SETUP
-#line 666 "netconf_lexer.ll"
+#line 702 "netconf_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2674 "netconf_lexer.cc"
+#line 2453 "netconf_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2990,7 +2769,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 367 )
+			if ( yy_current_state >= 415 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3023,11 +2802,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 367 )
+		if ( yy_current_state >= 415 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 366);
+	yy_is_jam = (yy_current_state == 414);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3776,7 +3555,7 @@ void yyfree (void * ptr )
 
 /* %ok-for-header */
 
-#line 666 "netconf_lexer.ll"
+#line 702 "netconf_lexer.ll"
 
 
 using namespace isc::dhcp;
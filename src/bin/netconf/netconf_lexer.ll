@@ -452,6 +452,33 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"async\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_ASYNC(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("async", driver.loc_);
+    }
+}
+
+\"queue-size\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("queue-size", driver.loc_);
+    }
+}
+
+\"overflow-policy\" {
+    switch(driver.ctx_) {
+    case ParserContext::OUTPUT_OPTIONS:
+        return NetconfParser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+
 \"debuglevel\" {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
@@ -461,6 +488,15 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"rate-limit\" {
+    switch(driver.ctx_) {
+    case ParserContext::LOGGERS:
+        return NetconfParser::make_RATE_LIMIT(driver.loc_);
+    default:
+        return NetconfParser::make_STRING("rate-limit", driver.loc_);
+    }
+}
+
 \"severity\" {
     switch(driver.ctx_) {
     case ParserContext::LOGGERS:
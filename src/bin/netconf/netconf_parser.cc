@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton implementation for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -30,8 +30,9 @@
 // This special exception was added by the Free Software Foundation in
 // version 2.2 of Bison.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 
 // Take the name prefix into account.
@@ -43,11 +44,11 @@
 
 
 // Unqualified %code blocks.
-#line 33 "netconf_parser.yy" // lalr1.cc:438
+#line 33 "netconf_parser.yy"
 
 #include <netconf/parser_context.h>
 
-#line 51 "netconf_parser.cc" // lalr1.cc:438
+#line 52 "netconf_parser.cc"
 
 
 #ifndef YY_
@@ -62,6 +63,7 @@
 # endif
 #endif
 
+
 // Whether we are compiled with exception support.
 #ifndef YY_EXCEPTIONS
 # if defined __GNUC__ && !defined __EXCEPTIONS
@@ -88,13 +90,10 @@
         {                                                               \
           (Current).begin = (Current).end = YYRHSLOC (Rhs, 0).end;      \
         }                                                               \
-    while (/*CONSTCOND*/ false)
+    while (false)
 # endif
 
 
-// Suppress unused-variable warnings by "using" E.
-#define YYUSE(E) ((void) (E))
-
 // Enable debugging if requested.
 #if NETCONF_DEBUG
 
@@ -120,13 +119,13 @@
 # define YY_STACK_PRINT()               \
   do {                                  \
     if (yydebug_)                       \
-      yystack_print_ ();                \
+      yy_stack_print_ ();                \
   } while (false)
 
 #else // !NETCONF_DEBUG
 
 # define YYCDEBUG if (false) std::cerr
-# define YY_SYMBOL_PRINT(Title, Symbol)  YYUSE (Symbol)
+# define YY_SYMBOL_PRINT(Title, Symbol)  YY_USE (Symbol)
 # define YY_REDUCE_PRINT(Rule)           static_cast<void> (0)
 # define YY_STACK_PRINT()                static_cast<void> (0)
 
@@ -140,54 +139,17 @@
 #define YYERROR         goto yyerrorlab
 #define YYRECOVERING()  (!!yyerrstatus_)
 
-#line 14 "netconf_parser.yy" // lalr1.cc:513
+#line 14 "netconf_parser.yy"
 namespace isc { namespace netconf {
-#line 146 "netconf_parser.cc" // lalr1.cc:513
-
-  /* Return YYSTR after stripping away unnecessary quotes and
-     backslashes, so that it's suitable for yyerror.  The heuristic is
-     that double-quoting is unnecessary unless the string contains an
-     apostrophe, a comma, or backslash (other than backslash-backslash).
-     YYSTR is taken from yytname.  */
-  std::string
-  NetconfParser::yytnamerr_ (const char *yystr)
-  {
-    if (*yystr == '"')
-      {
-        std::string yyr = "";
-        char const *yyp = yystr;
-
-        for (;;)
-          switch (*++yyp)
-            {
-            case '\'':
-            case ',':
-              goto do_not_strip_quotes;
-
-            case '\\':
-              if (*++yyp != '\\')
-                goto do_not_strip_quotes;
-              // Fall through.
-            default:
-              yyr += *yyp;
-              break;
-
-            case '"':
-              return yyr;
-            }
-      do_not_strip_quotes: ;
-      }
-
-    return yystr;
-  }
-
+#line 145 "netconf_parser.cc"
 
   /// Build a parser object.
   NetconfParser::NetconfParser (isc::netconf::ParserContext& ctx_yyarg)
-    :
 #if NETCONF_DEBUG
-      yydebug_ (false),
+    : yydebug_ (false),
       yycdebug_ (&std::cerr),
+#else
+    :
 #endif
       ctx (ctx_yyarg)
   {}
@@ -195,24 +157,26 @@ namespace isc { namespace netconf {
   NetconfParser::~NetconfParser ()
   {}
 
+  NetconfParser::syntax_error::~syntax_error () YY_NOEXCEPT YY_NOTHROW
+  {}
 
-  /*---------------.
-  | Symbol types.  |
-  `---------------*/
+  /*---------.
+  | symbol.  |
+  `---------*/
 
 
 
   // by_state.
-  NetconfParser::by_state::by_state ()
+  NetconfParser::by_state::by_state () YY_NOEXCEPT
     : state (empty_state)
   {}
 
-  NetconfParser::by_state::by_state (const by_state& other)
-    : state (other.state)
+  NetconfParser::by_state::by_state (const by_state& that) YY_NOEXCEPT
+    : state (that.state)
   {}
 
   void
-  NetconfParser::by_state::clear ()
+  NetconfParser::by_state::clear () YY_NOEXCEPT
   {
     state = empty_state;
   }
@@ -224,17 +188,17 @@ namespace isc { namespace netconf {
     that.clear ();
   }
 
-  NetconfParser::by_state::by_state (state_type s)
+  NetconfParser::by_state::by_state (state_type s) YY_NOEXCEPT
     : state (s)
   {}
 
-  NetconfParser::symbol_number_type
-  NetconfParser::by_state::type_get () const
+  NetconfParser::symbol_kind_type
+  NetconfParser::by_state::kind () const YY_NOEXCEPT
   {
     if (state == empty_state)
-      return empty_symbol;
+      return symbol_kind::S_YYEMPTY;
     else
-      return yystos_[state];
+      return YY_CAST (symbol_kind_type, yystos_[+state]);
   }
 
   NetconfParser::stack_symbol_type::stack_symbol_type ()
@@ -243,27 +207,27 @@ namespace isc { namespace netconf {
   NetconfParser::stack_symbol_type::stack_symbol_type (YY_RVREF (stack_symbol_type) that)
     : super_type (YY_MOVE (that.state), YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.YY_MOVE_OR_COPY< bool > (YY_MOVE (that.value));
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.YY_MOVE_OR_COPY< double > (YY_MOVE (that.value));
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (that.value));
         break;
 
@@ -280,27 +244,27 @@ namespace isc { namespace netconf {
   NetconfParser::stack_symbol_type::stack_symbol_type (state_type s, YY_MOVE_REF (symbol_type) that)
     : super_type (s, YY_MOVE (that.location))
   {
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (that.value));
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (that.value));
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (that.value));
         break;
 
@@ -309,35 +273,71 @@ namespace isc { namespace netconf {
     }
 
     // that is emptied.
-    that.type = empty_symbol;
+    that.kind_ = symbol_kind::S_YYEMPTY;
   }
 
 #if YY_CPLUSPLUS < 201103L
+  NetconfParser::stack_symbol_type&
+  NetconfParser::stack_symbol_type::operator= (const stack_symbol_type& that)
+  {
+    state = that.state;
+    switch (that.kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.copy< ElementPtr > (that.value);
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (that.value);
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (that.value);
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (that.value);
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (that.value);
+        break;
+
+      default:
+        break;
+    }
+
+    location = that.location;
+    return *this;
+  }
+
   NetconfParser::stack_symbol_type&
   NetconfParser::stack_symbol_type::operator= (stack_symbol_type& that)
   {
     state = that.state;
-    switch (that.type_get ())
+    switch (that.kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -363,75 +363,67 @@ namespace isc { namespace netconf {
 #if NETCONF_DEBUG
   template <typename Base>
   void
-  NetconfParser::yy_print_ (std::ostream& yyo,
-                                     const basic_symbol<Base>& yysym) const
+  NetconfParser::yy_print_ (std::ostream& yyo, const basic_symbol<Base>& yysym) const
   {
     std::ostream& yyoutput = yyo;
-    YYUSE (yyoutput);
-    symbol_number_type yytype = yysym.type_get ();
-    // Avoid a (spurious) G++ 4.8 warning about "array subscript is
-    // below array bounds".
+    YY_USE (yyoutput);
     if (yysym.empty ())
-      std::abort ();
-    yyo << (yytype < yyntokens_ ? "token" : "nterm")
-        << ' ' << yytname_[yytype] << " ("
-        << yysym.location << ": ";
-    switch (yytype)
-    {
-            case 45: // "constant string"
-
-#line 107 "netconf_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< std::string > (); }
-#line 386 "netconf_parser.cc" // lalr1.cc:672
+      yyo << "empty symbol";
+    else
+      {
+        symbol_kind_type yykind = yysym.kind ();
+        yyo << (yykind < YYNTOKENS ? "token" : "nterm")
+            << ' ' << yysym.name () << " ("
+            << yysym.location << ": ";
+        switch (yykind)
+    {
+      case symbol_kind::S_STRING: // "constant string"
+#line 111 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < std::string > (); }
+#line 384 "netconf_parser.cc"
         break;
 
-      case 46: // "integer"
-
-#line 107 "netconf_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< int64_t > (); }
-#line 393 "netconf_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_INTEGER: // "integer"
+#line 111 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < int64_t > (); }
+#line 390 "netconf_parser.cc"
         break;
 
-      case 47: // "floating point"
-
-#line 107 "netconf_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< double > (); }
-#line 400 "netconf_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_FLOAT: // "floating point"
+#line 111 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < double > (); }
+#line 396 "netconf_parser.cc"
         break;
 
-      case 48: // "boolean"
-
-#line 107 "netconf_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< bool > (); }
-#line 407 "netconf_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_BOOLEAN: // "boolean"
+#line 111 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < bool > (); }
+#line 402 "netconf_parser.cc"
         break;
 
-      case 57: // value
-
-#line 107 "netconf_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 414 "netconf_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_value: // value
+#line 111 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 408 "netconf_parser.cc"
         break;
 
-      case 60: // map_value
-
-#line 107 "netconf_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 421 "netconf_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_map_value: // map_value
+#line 111 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 414 "netconf_parser.cc"
         break;
 
-      case 119: // socket_type_value
-
-#line 107 "netconf_parser.yy" // lalr1.cc:672
-        { yyoutput << yysym.value.template as< ElementPtr > (); }
-#line 428 "netconf_parser.cc" // lalr1.cc:672
+      case symbol_kind::S_socket_type_value: // socket_type_value
+#line 111 "netconf_parser.yy"
+                 { yyoutput << yysym.value.template as < ElementPtr > (); }
+#line 420 "netconf_parser.cc"
         break;
 
-
       default:
         break;
     }
-    yyo << ')';
+        yyo << ')';
+      }
   }
 #endif
 
@@ -455,7 +447,7 @@ namespace isc { namespace netconf {
   }
 
   void
-  NetconfParser::yypop_ (int n)
+  NetconfParser::yypop_ (int n) YY_NOEXCEPT
   {
     yystack_.pop (n);
   }
@@ -490,21 +482,21 @@ namespace isc { namespace netconf {
   NetconfParser::state_type
   NetconfParser::yy_lr_goto_state_ (state_type yystate, int yysym)
   {
-    int yyr = yypgoto_[yysym - yyntokens_] + yystate;
+    int yyr = yypgoto_[yysym - YYNTOKENS] + yystate;
     if (0 <= yyr && yyr <= yylast_ && yycheck_[yyr] == yystate)
       return yytable_[yyr];
     else
-      return yydefgoto_[yysym - yyntokens_];
+      return yydefgoto_[yysym - YYNTOKENS];
   }
 
   bool
-  NetconfParser::yy_pact_value_is_default_ (int yyvalue)
+  NetconfParser::yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yypact_ninf_;
   }
 
   bool
-  NetconfParser::yy_table_value_is_error_ (int yyvalue)
+  NetconfParser::yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT
   {
     return yyvalue == yytable_ninf_;
   }
@@ -518,7 +510,6 @@ namespace isc { namespace netconf {
   int
   NetconfParser::parse ()
   {
-    // State.
     int yyn;
     /// Length of the RHS of the rule being reduced.
     int yylen = 0;
@@ -550,27 +541,33 @@ namespace isc { namespace netconf {
     yystack_.clear ();
     yypush_ (YY_NULLPTR, 0, YY_MOVE (yyla));
 
-    // A new symbol was pushed on the stack.
+  /*-----------------------------------------------.
+  | yynewstate -- push a new symbol on the stack.  |
+  `-----------------------------------------------*/
   yynewstate:
-    YYCDEBUG << "Entering state " << yystack_[0].state << '\n';
+    YYCDEBUG << "Entering state " << int (yystack_[0].state) << '\n';
+    YY_STACK_PRINT ();
 
     // Accept?
     if (yystack_[0].state == yyfinal_)
-      goto yyacceptlab;
+      YYACCEPT;
 
     goto yybackup;
 
-    // Backup.
+
+  /*-----------.
+  | yybackup.  |
+  `-----------*/
   yybackup:
     // Try to take a decision without lookahead.
-    yyn = yypact_[yystack_[0].state];
+    yyn = yypact_[+yystack_[0].state];
     if (yy_pact_value_is_default_ (yyn))
       goto yydefault;
 
     // Read a lookahead token.
     if (yyla.empty ())
       {
-        YYCDEBUG << "Reading a token: ";
+        YYCDEBUG << "Reading a token\n";
 #if YY_EXCEPTIONS
         try
 #endif // YY_EXCEPTIONS
@@ -581,6 +578,7 @@ namespace isc { namespace netconf {
 #if YY_EXCEPTIONS
         catch (const syntax_error& yyexc)
           {
+            YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
             error (yyexc);
             goto yyerrlab1;
           }
@@ -588,11 +586,23 @@ namespace isc { namespace netconf {
       }
     YY_SYMBOL_PRINT ("Next token is", yyla);
 
+    if (yyla.kind () == symbol_kind::S_YYerror)
+    {
+      // The scanner already issued an error message, process directly
+      // to error recovery.  But do not keep the error token as
+      // lookahead, it is too special and may lead us to an endless
+      // loop in error recovery. */
+      yyla.kind_ = symbol_kind::S_YYUNDEF;
+      goto yyerrlab1;
+    }
+
     /* If the proper action on seeing token YYLA.TYPE is to reduce or
        to detect an error, take that action.  */
-    yyn += yyla.type_get ();
-    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.type_get ())
-      goto yydefault;
+    yyn += yyla.kind ();
+    if (yyn < 0 || yylast_ < yyn || yycheck_[yyn] != yyla.kind ())
+      {
+        goto yydefault;
+      }
 
     // Reduce or error.
     yyn = yytable_[yyn];
@@ -609,20 +619,22 @@ namespace isc { namespace netconf {
       --yyerrstatus_;
 
     // Shift the lookahead token.
-    yypush_ ("Shifting", yyn, YY_MOVE (yyla));
+    yypush_ ("Shifting", state_type (yyn), YY_MOVE (yyla));
     goto yynewstate;
 
+
   /*-----------------------------------------------------------.
   | yydefault -- do the default action for the current state.  |
   `-----------------------------------------------------------*/
   yydefault:
-    yyn = yydefact_[yystack_[0].state];
+    yyn = yydefact_[+yystack_[0].state];
     if (yyn == 0)
       goto yyerrlab;
     goto yyreduce;
 
+
   /*-----------------------------.
-  | yyreduce -- Do a reduction.  |
+  | yyreduce -- do a reduction.  |
   `-----------------------------*/
   yyreduce:
     yylen = yyr2_[yyn];
@@ -634,25 +646,25 @@ namespace isc { namespace netconf {
          when using variants.  */
       switch (yyr1_[yyn])
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         yylhs.value.emplace< ElementPtr > ();
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         yylhs.value.emplace< bool > ();
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         yylhs.value.emplace< double > ();
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         yylhs.value.emplace< int64_t > ();
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         yylhs.value.emplace< std::string > ();
         break;
 
@@ -663,8 +675,8 @@ namespace isc { namespace netconf {
 
       // Default location.
       {
-        slice<stack_symbol_type, stack_type> slice (yystack_, yylen);
-        YYLLOC_DEFAULT (yylhs.location, slice, yylen);
+        stack_type::slice range (yystack_, yylen);
+        YYLLOC_DEFAULT (yylhs.location, range, yylen);
         yyerror_range[1].location = yylhs.location;
       }
 
@@ -676,208 +688,208 @@ namespace isc { namespace netconf {
         {
           switch (yyn)
             {
-  case 2:
-#line 118 "netconf_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.NO_KEYWORDS; }
-#line 683 "netconf_parser.cc" // lalr1.cc:907
+  case 2: // $@1: %empty
+#line 122 "netconf_parser.yy"
+                       { ctx.ctx_ = ctx.NO_KEYWORDS; }
+#line 695 "netconf_parser.cc"
     break;
 
-  case 4:
-#line 119 "netconf_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.CONFIG; }
-#line 689 "netconf_parser.cc" // lalr1.cc:907
+  case 4: // $@2: %empty
+#line 123 "netconf_parser.yy"
+                         { ctx.ctx_ = ctx.CONFIG; }
+#line 701 "netconf_parser.cc"
     break;
 
-  case 6:
-#line 120 "netconf_parser.yy" // lalr1.cc:907
-    { ctx.ctx_ = ctx.NETCONF; }
-#line 695 "netconf_parser.cc" // lalr1.cc:907
+  case 6: // $@3: %empty
+#line 124 "netconf_parser.yy"
+                         { ctx.ctx_ = ctx.NETCONF; }
+#line 707 "netconf_parser.cc"
     break;
 
-  case 8:
-#line 128 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 8: // $@4: %empty
+#line 132 "netconf_parser.yy"
+                            {
     // Parse the Netconf map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 705 "netconf_parser.cc" // lalr1.cc:907
+#line 717 "netconf_parser.cc"
     break;
 
-  case 9:
-#line 132 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 9: // sub_netconf: "{" $@4 global_params "}"
+#line 136 "netconf_parser.yy"
+                               {
     // parsing completed
 }
-#line 713 "netconf_parser.cc" // lalr1.cc:907
+#line 725 "netconf_parser.cc"
     break;
 
-  case 10:
-#line 139 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 10: // json: value
+#line 143 "netconf_parser.yy"
+            {
     // Push back the JSON value on the stack
-    ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
+    ctx.stack_.push_back(yystack_[0].value.as < ElementPtr > ());
 }
-#line 722 "netconf_parser.cc" // lalr1.cc:907
+#line 734 "netconf_parser.cc"
     break;
 
-  case 11:
-#line 145 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
-#line 728 "netconf_parser.cc" // lalr1.cc:907
+  case 11: // value: "integer"
+#line 149 "netconf_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location))); }
+#line 740 "netconf_parser.cc"
     break;
 
-  case 12:
-#line 146 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
-#line 734 "netconf_parser.cc" // lalr1.cc:907
+  case 12: // value: "floating point"
+#line 150 "netconf_parser.yy"
+             { yylhs.value.as < ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as < double > (), ctx.loc2pos(yystack_[0].location))); }
+#line 746 "netconf_parser.cc"
     break;
 
-  case 13:
-#line 147 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
-#line 740 "netconf_parser.cc" // lalr1.cc:907
+  case 13: // value: "boolean"
+#line 151 "netconf_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location))); }
+#line 752 "netconf_parser.cc"
     break;
 
-  case 14:
-#line 148 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
-#line 746 "netconf_parser.cc" // lalr1.cc:907
+  case 14: // value: "constant string"
+#line 152 "netconf_parser.yy"
+              { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location))); }
+#line 758 "netconf_parser.cc"
     break;
 
-  case 15:
-#line 149 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
-#line 752 "netconf_parser.cc" // lalr1.cc:907
+  case 15: // value: "null"
+#line 153 "netconf_parser.yy"
+                 { yylhs.value.as < ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
+#line 764 "netconf_parser.cc"
     break;
 
-  case 16:
-#line 150 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 758 "netconf_parser.cc" // lalr1.cc:907
+  case 16: // value: map
+#line 154 "netconf_parser.yy"
+           { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 770 "netconf_parser.cc"
     break;
 
-  case 17:
-#line 151 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 764 "netconf_parser.cc" // lalr1.cc:907
+  case 17: // value: list_generic
+#line 155 "netconf_parser.yy"
+                    { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 776 "netconf_parser.cc"
     break;
 
-  case 18:
-#line 155 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 18: // $@5: %empty
+#line 159 "netconf_parser.yy"
+                    {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 775 "netconf_parser.cc" // lalr1.cc:907
+#line 787 "netconf_parser.cc"
     break;
 
-  case 19:
-#line 160 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 19: // map: "{" $@5 map_content "}"
+#line 164 "netconf_parser.yy"
+                             {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 785 "netconf_parser.cc" // lalr1.cc:907
+#line 797 "netconf_parser.cc"
     break;
 
-  case 20:
-#line 166 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
-#line 791 "netconf_parser.cc" // lalr1.cc:907
+  case 20: // map_value: map
+#line 170 "netconf_parser.yy"
+               { yylhs.value.as < ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
+#line 803 "netconf_parser.cc"
     break;
 
-  case 23:
-#line 180 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 23: // not_empty_map: "constant string" ":" value
+#line 184 "netconf_parser.yy"
+                                  {
                   // map containing a single entry
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 800 "netconf_parser.cc" // lalr1.cc:907
+#line 812 "netconf_parser.cc"
     break;
 
-  case 24:
-#line 184 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 24: // not_empty_map: not_empty_map "," "constant string" ":" value
+#line 188 "netconf_parser.yy"
+                                                      {
                   // map consisting of a shorter map followed by
                   // comma and string:value
-                  ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->set(yystack_[2].value.as < std::string > (), yystack_[0].value.as < ElementPtr > ());
                   }
-#line 810 "netconf_parser.cc" // lalr1.cc:907
+#line 822 "netconf_parser.cc"
     break;
 
-  case 25:
-#line 191 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 25: // $@6: %empty
+#line 195 "netconf_parser.yy"
+                              {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 819 "netconf_parser.cc" // lalr1.cc:907
+#line 831 "netconf_parser.cc"
     break;
 
-  case 26:
-#line 194 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 26: // list_generic: "[" $@6 list_content "]"
+#line 198 "netconf_parser.yy"
+                               {
 }
-#line 826 "netconf_parser.cc" // lalr1.cc:907
+#line 838 "netconf_parser.cc"
     break;
 
-  case 29:
-#line 201 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 29: // not_empty_list: value
+#line 205 "netconf_parser.yy"
+                      {
                   // List consisting of a single element.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 835 "netconf_parser.cc" // lalr1.cc:907
+#line 847 "netconf_parser.cc"
     break;
 
-  case 30:
-#line 205 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 30: // not_empty_list: not_empty_list "," value
+#line 209 "netconf_parser.yy"
+                                           {
                   // List ending with , and a value.
-                  ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
+                  ctx.stack_.back()->add(yystack_[0].value.as < ElementPtr > ());
                   }
-#line 844 "netconf_parser.cc" // lalr1.cc:907
+#line 856 "netconf_parser.cc"
     break;
 
-  case 31:
-#line 218 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 31: // unknown_map_entry: "constant string" ":"
+#line 222 "netconf_parser.yy"
+                                {
     const std::string& where = ctx.contextName();
-    const std::string& keyword = yystack_[1].value.as< std::string > ();
+    const std::string& keyword = yystack_[1].value.as < std::string > ();
     error(yystack_[1].location,
           "got unexpected keyword \"" + keyword + "\" in " + where + " map.");
 }
-#line 855 "netconf_parser.cc" // lalr1.cc:907
+#line 867 "netconf_parser.cc"
     break;
 
-  case 32:
-#line 226 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 32: // $@7: %empty
+#line 230 "netconf_parser.yy"
+                                   {
     // This code is executed when we're about to start parsing
     // the content of the map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 866 "netconf_parser.cc" // lalr1.cc:907
+#line 878 "netconf_parser.cc"
     break;
 
-  case 33:
-#line 231 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 33: // netconf_syntax_map: "{" $@7 global_objects "}"
+#line 235 "netconf_parser.yy"
+                                {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
     // for it.
 }
-#line 876 "netconf_parser.cc" // lalr1.cc:907
+#line 888 "netconf_parser.cc"
     break;
 
-  case 38:
-#line 248 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 38: // $@8: %empty
+#line 252 "netconf_parser.yy"
+                        {
 
     // Let's create a MapElement that will represent it, add it to the
     // top level map (that's already on the stack) and put the new map
@@ -888,60 +900,60 @@ namespace isc { namespace netconf {
     ctx.stack_.push_back(m);
     ctx.enter(ctx.NETCONF);
 }
-#line 892 "netconf_parser.cc" // lalr1.cc:907
+#line 904 "netconf_parser.cc"
     break;
 
-  case 39:
-#line 258 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 39: // netconf_object: "Netconf" $@8 ":" "{" global_params "}"
+#line 262 "netconf_parser.yy"
+                                                    {
     // Ok, we're done with parsing Netconf. Let's take the map
     // off the stack.
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 903 "netconf_parser.cc" // lalr1.cc:907
+#line 915 "netconf_parser.cc"
     break;
 
-  case 52:
-#line 285 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flag(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 52: // boot_update: "boot-update" ":" "boolean"
+#line 289 "netconf_parser.yy"
+                                       {
+    ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-update", flag);
 }
-#line 912 "netconf_parser.cc" // lalr1.cc:907
+#line 924 "netconf_parser.cc"
     break;
 
-  case 53:
-#line 290 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flag(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 53: // subscribe_changes: "subscribe-changes" ":" "boolean"
+#line 294 "netconf_parser.yy"
+                                                   {
+    ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subscribe-changes", flag);
 }
-#line 921 "netconf_parser.cc" // lalr1.cc:907
+#line 933 "netconf_parser.cc"
     break;
 
-  case 54:
-#line 295 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flag(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 54: // validate_changes: "validate-changes" ":" "boolean"
+#line 299 "netconf_parser.yy"
+                                                 {
+    ElementPtr flag(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("validate-changes", flag);
 }
-#line 930 "netconf_parser.cc" // lalr1.cc:907
+#line 942 "netconf_parser.cc"
     break;
 
-  case 55:
-#line 300 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 55: // $@9: %empty
+#line 304 "netconf_parser.yy"
+                           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 938 "netconf_parser.cc" // lalr1.cc:907
+#line 950 "netconf_parser.cc"
     break;
 
-  case 56:
-#line 302 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 56: // user_context: "user-context" $@9 ":" map_value
+#line 306 "netconf_parser.yy"
+                  {
     ElementPtr parent = ctx.stack_.back();
-    ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
+    ElementPtr user_context = yystack_[0].value.as < ElementPtr > ();
     ConstElementPtr old = parent->get("user-context");
 
     // Handle already existing user context
@@ -961,23 +973,23 @@ namespace isc { namespace netconf {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 965 "netconf_parser.cc" // lalr1.cc:907
+#line 977 "netconf_parser.cc"
     break;
 
-  case 57:
-#line 325 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 57: // $@10: %empty
+#line 329 "netconf_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 973 "netconf_parser.cc" // lalr1.cc:907
+#line 985 "netconf_parser.cc"
     break;
 
-  case 58:
-#line 327 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 58: // comment: "comment" $@10 ":" "constant string"
+#line 331 "netconf_parser.yy"
+               {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
-    ElementPtr comment(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ElementPtr comment(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     user_context->set("comment", comment);
 
     // Handle already existing user context
@@ -998,479 +1010,534 @@ namespace isc { namespace netconf {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 1002 "netconf_parser.cc" // lalr1.cc:907
+#line 1014 "netconf_parser.cc"
     break;
 
-  case 59:
-#line 353 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 59: // $@11: %empty
+#line 357 "netconf_parser.yy"
+                                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1013 "netconf_parser.cc" // lalr1.cc:907
+#line 1025 "netconf_parser.cc"
     break;
 
-  case 60:
-#line 358 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 60: // hooks_libraries: "hooks-libraries" $@11 ":" "[" hooks_libraries_list "]"
+#line 362 "netconf_parser.yy"
+                                                             {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1022 "netconf_parser.cc" // lalr1.cc:907
+#line 1034 "netconf_parser.cc"
     break;
 
-  case 65:
-#line 371 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 65: // $@12: %empty
+#line 375 "netconf_parser.yy"
+                              {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1032 "netconf_parser.cc" // lalr1.cc:907
+#line 1044 "netconf_parser.cc"
     break;
 
-  case 66:
-#line 375 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 66: // hooks_library: "{" $@12 hooks_params "}"
+#line 379 "netconf_parser.yy"
+                              {
     ctx.stack_.pop_back();
 }
-#line 1040 "netconf_parser.cc" // lalr1.cc:907
+#line 1052 "netconf_parser.cc"
     break;
 
-  case 72:
-#line 388 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 72: // $@13: %empty
+#line 392 "netconf_parser.yy"
+                 {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1048 "netconf_parser.cc" // lalr1.cc:907
+#line 1060 "netconf_parser.cc"
     break;
 
-  case 73:
-#line 390 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 73: // library: "library" $@13 ":" "constant string"
+#line 394 "netconf_parser.yy"
+               {
+    ElementPtr lib(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1058 "netconf_parser.cc" // lalr1.cc:907
+#line 1070 "netconf_parser.cc"
     break;
 
-  case 74:
-#line 396 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 74: // $@14: %empty
+#line 400 "netconf_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1066 "netconf_parser.cc" // lalr1.cc:907
+#line 1078 "netconf_parser.cc"
     break;
 
-  case 75:
-#line 398 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
+  case 75: // parameters: "parameters" $@14 ":" value
+#line 402 "netconf_parser.yy"
+              {
+    ctx.stack_.back()->set("parameters", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1075 "netconf_parser.cc" // lalr1.cc:907
+#line 1087 "netconf_parser.cc"
     break;
 
-  case 76:
-#line 406 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 76: // $@15: %empty
+#line 410 "netconf_parser.yy"
+                                                      {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[2].location)));
     ctx.stack_.back()->set("managed-servers", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.MANAGED_SERVERS);
 }
-#line 1086 "netconf_parser.cc" // lalr1.cc:907
+#line 1098 "netconf_parser.cc"
     break;
 
-  case 77:
-#line 411 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 77: // managed_servers: "managed-servers" ":" "{" $@15 servers_entries "}"
+#line 415 "netconf_parser.yy"
+                                 {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1095 "netconf_parser.cc" // lalr1.cc:907
+#line 1107 "netconf_parser.cc"
     break;
 
-  case 87:
-#line 435 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 87: // $@16: %empty
+#line 439 "netconf_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1106 "netconf_parser.cc" // lalr1.cc:907
+#line 1118 "netconf_parser.cc"
     break;
 
-  case 88:
-#line 440 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 88: // dhcp4_server: "dhcp4" $@16 ":" "{" managed_server_params "}"
+#line 444 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1115 "netconf_parser.cc" // lalr1.cc:907
+#line 1127 "netconf_parser.cc"
     break;
 
-  case 89:
-#line 446 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 89: // $@17: %empty
+#line 450 "netconf_parser.yy"
+                           {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp6", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1126 "netconf_parser.cc" // lalr1.cc:907
+#line 1138 "netconf_parser.cc"
     break;
 
-  case 90:
-#line 451 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 90: // dhcp6_server: "dhcp6" $@17 ":" "{" managed_server_params "}"
+#line 455 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1135 "netconf_parser.cc" // lalr1.cc:907
+#line 1147 "netconf_parser.cc"
     break;
 
-  case 91:
-#line 457 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 91: // $@18: %empty
+#line 461 "netconf_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("d2", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1146 "netconf_parser.cc" // lalr1.cc:907
+#line 1158 "netconf_parser.cc"
     break;
 
-  case 92:
-#line 462 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 92: // d2_server: "d2" $@18 ":" "{" managed_server_params "}"
+#line 466 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1155 "netconf_parser.cc" // lalr1.cc:907
+#line 1167 "netconf_parser.cc"
     break;
 
-  case 93:
-#line 468 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 93: // $@19: %empty
+#line 472 "netconf_parser.yy"
+                     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ca", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER);
 }
-#line 1166 "netconf_parser.cc" // lalr1.cc:907
+#line 1178 "netconf_parser.cc"
     break;
 
-  case 94:
-#line 473 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 94: // ca_server: "ca" $@19 ":" "{" managed_server_params "}"
+#line 477 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1175 "netconf_parser.cc" // lalr1.cc:907
+#line 1187 "netconf_parser.cc"
     break;
 
-  case 105:
-#line 495 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 105: // $@20: %empty
+#line 499 "netconf_parser.yy"
+             {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1183 "netconf_parser.cc" // lalr1.cc:907
+#line 1195 "netconf_parser.cc"
     break;
 
-  case 106:
-#line 497 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr model(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 106: // model: "model" $@20 ":" "constant string"
+#line 501 "netconf_parser.yy"
+               {
+    ElementPtr model(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("model", model);
     ctx.leave();
 }
-#line 1193 "netconf_parser.cc" // lalr1.cc:907
+#line 1205 "netconf_parser.cc"
     break;
 
-  case 107:
-#line 504 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 107: // $@21: %empty
+#line 508 "netconf_parser.yy"
+                               {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 1204 "netconf_parser.cc" // lalr1.cc:907
+#line 1216 "netconf_parser.cc"
     break;
 
-  case 108:
-#line 509 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 108: // control_socket: "control-socket" $@21 ":" "{" control_socket_params "}"
+#line 513 "netconf_parser.yy"
+                                                            {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1213 "netconf_parser.cc" // lalr1.cc:907
+#line 1225 "netconf_parser.cc"
     break;
 
-  case 117:
-#line 527 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 117: // $@22: %empty
+#line 531 "netconf_parser.yy"
+                         {
     ctx.enter(ctx.SOCKET_TYPE);
 }
-#line 1221 "netconf_parser.cc" // lalr1.cc:907
+#line 1233 "netconf_parser.cc"
     break;
 
-  case 118:
-#line 529 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ctx.stack_.back()->set("socket-type", yystack_[0].value.as< ElementPtr > ());
+  case 118: // socket_type: "socket-type" $@22 ":" socket_type_value
+#line 533 "netconf_parser.yy"
+                          {
+    ctx.stack_.back()->set("socket-type", yystack_[0].value.as < ElementPtr > ());
     ctx.leave();
 }
-#line 1230 "netconf_parser.cc" // lalr1.cc:907
+#line 1242 "netconf_parser.cc"
     break;
 
-  case 119:
-#line 535 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
-#line 1236 "netconf_parser.cc" // lalr1.cc:907
+  case 119: // socket_type_value: "unix"
+#line 539 "netconf_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("unix", ctx.loc2pos(yystack_[0].location))); }
+#line 1248 "netconf_parser.cc"
     break;
 
-  case 120:
-#line 536 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("http", ctx.loc2pos(yystack_[0].location))); }
-#line 1242 "netconf_parser.cc" // lalr1.cc:907
+  case 120: // socket_type_value: "http"
+#line 540 "netconf_parser.yy"
+                         { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("http", ctx.loc2pos(yystack_[0].location))); }
+#line 1254 "netconf_parser.cc"
     break;
 
-  case 121:
-#line 537 "netconf_parser.yy" // lalr1.cc:907
-    { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("stdout", ctx.loc2pos(yystack_[0].location))); }
-#line 1248 "netconf_parser.cc" // lalr1.cc:907
+  case 121: // socket_type_value: "stdout"
+#line 541 "netconf_parser.yy"
+                           { yylhs.value.as < ElementPtr > () = ElementPtr(new StringElement("stdout", ctx.loc2pos(yystack_[0].location))); }
+#line 1260 "netconf_parser.cc"
     break;
 
-  case 122:
-#line 540 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 122: // $@23: %empty
+#line 544 "netconf_parser.yy"
+                         {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1256 "netconf_parser.cc" // lalr1.cc:907
+#line 1268 "netconf_parser.cc"
     break;
 
-  case 123:
-#line 542 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 123: // socket_name: "socket-name" $@23 ":" "constant string"
+#line 546 "netconf_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 1266 "netconf_parser.cc" // lalr1.cc:907
+#line 1278 "netconf_parser.cc"
     break;
 
-  case 124:
-#line 549 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 124: // $@24: %empty
+#line 553 "netconf_parser.yy"
+                       {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1274 "netconf_parser.cc" // lalr1.cc:907
+#line 1286 "netconf_parser.cc"
     break;
 
-  case 125:
-#line 551 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr url(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 125: // socket_url: "socket-url" $@24 ":" "constant string"
+#line 555 "netconf_parser.yy"
+               {
+    ElementPtr url(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-url", url);
     ctx.leave();
 }
-#line 1284 "netconf_parser.cc" // lalr1.cc:907
+#line 1296 "netconf_parser.cc"
     break;
 
-  case 126:
-#line 564 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 126: // $@25: %empty
+#line 568 "netconf_parser.yy"
+                        {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1295 "netconf_parser.cc" // lalr1.cc:907
+#line 1307 "netconf_parser.cc"
     break;
 
-  case 127:
-#line 569 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 127: // logging_object: "Logging" $@25 ":" "{" logging_params "}"
+#line 573 "netconf_parser.yy"
+                                                     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1304 "netconf_parser.cc" // lalr1.cc:907
+#line 1316 "netconf_parser.cc"
     break;
 
-  case 131:
-#line 586 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 131: // $@26: %empty
+#line 590 "netconf_parser.yy"
+                 {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1315 "netconf_parser.cc" // lalr1.cc:907
+#line 1327 "netconf_parser.cc"
     break;
 
-  case 132:
-#line 591 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 132: // loggers: "loggers" $@26 ":" "[" loggers_entries "]"
+#line 595 "netconf_parser.yy"
+                                                         {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1324 "netconf_parser.cc" // lalr1.cc:907
+#line 1336 "netconf_parser.cc"
     break;
 
-  case 135:
-#line 603 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 135: // $@27: %empty
+#line 607 "netconf_parser.yy"
+                             {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1334 "netconf_parser.cc" // lalr1.cc:907
+#line 1346 "netconf_parser.cc"
     break;
 
-  case 136:
-#line 607 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 136: // logger_entry: "{" $@27 logger_params "}"
+#line 611 "netconf_parser.yy"
+                               {
     ctx.stack_.pop_back();
 }
-#line 1342 "netconf_parser.cc" // lalr1.cc:907
+#line 1354 "netconf_parser.cc"
     break;
 
-  case 146:
-#line 624 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 147: // $@28: %empty
+#line 629 "netconf_parser.yy"
+           {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1350 "netconf_parser.cc" // lalr1.cc:907
+#line 1362 "netconf_parser.cc"
     break;
 
-  case 147:
-#line 626 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 148: // name: "name" $@28 ":" "constant string"
+#line 631 "netconf_parser.yy"
+               {
+    ElementPtr name(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1360 "netconf_parser.cc" // lalr1.cc:907
+#line 1372 "netconf_parser.cc"
     break;
 
-  case 148:
-#line 632 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 149: // debuglevel: "debuglevel" ":" "integer"
+#line 637 "netconf_parser.yy"
+                                     {
+    ElementPtr dl(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1369 "netconf_parser.cc" // lalr1.cc:907
+#line 1381 "netconf_parser.cc"
     break;
 
-  case 149:
-#line 637 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 150: // $@29: %empty
+#line 642 "netconf_parser.yy"
+                   {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1377 "netconf_parser.cc" // lalr1.cc:907
+#line 1389 "netconf_parser.cc"
     break;
 
-  case 150:
-#line 639 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 151: // severity: "severity" $@29 ":" "constant string"
+#line 644 "netconf_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1387 "netconf_parser.cc" // lalr1.cc:907
+#line 1399 "netconf_parser.cc"
     break;
 
-  case 151:
-#line 645 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 152: // $@30: %empty
+#line 650 "netconf_parser.yy"
+                       {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1407 "netconf_parser.cc"
+    break;
+
+  case 153: // rate_limit: "rate-limit" $@30 ":" "constant string"
+#line 652 "netconf_parser.yy"
+               {
+    ElementPtr rl(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+}
+#line 1417 "netconf_parser.cc"
+    break;
+
+  case 154: // $@31: %empty
+#line 658 "netconf_parser.yy"
+                                    {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1398 "netconf_parser.cc" // lalr1.cc:907
+#line 1428 "netconf_parser.cc"
     break;
 
-  case 152:
-#line 650 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 155: // output_options_list: "output_options" $@31 ":" "[" output_options_list_content "]"
+#line 663 "netconf_parser.yy"
+                                                                    {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1407 "netconf_parser.cc" // lalr1.cc:907
+#line 1437 "netconf_parser.cc"
     break;
 
-  case 155:
-#line 659 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 158: // $@32: %empty
+#line 672 "netconf_parser.yy"
+                             {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1417 "netconf_parser.cc" // lalr1.cc:907
+#line 1447 "netconf_parser.cc"
     break;
 
-  case 156:
-#line 663 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 159: // output_entry: "{" $@32 output_params_list "}"
+#line 676 "netconf_parser.yy"
+                                    {
     ctx.stack_.pop_back();
 }
-#line 1425 "netconf_parser.cc" // lalr1.cc:907
+#line 1455 "netconf_parser.cc"
     break;
 
-  case 163:
-#line 677 "netconf_parser.yy" // lalr1.cc:907
-    {
+  case 169: // $@33: %empty
+#line 693 "netconf_parser.yy"
+               {
     ctx.enter(ctx.NO_KEYWORDS);
 }
-#line 1433 "netconf_parser.cc" // lalr1.cc:907
+#line 1463 "netconf_parser.cc"
     break;
 
-  case 164:
-#line 679 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+  case 170: // output: "output" $@33 ":" "constant string"
+#line 695 "netconf_parser.yy"
+               {
+    ElementPtr sev(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1443 "netconf_parser.cc" // lalr1.cc:907
+#line 1473 "netconf_parser.cc"
     break;
 
-  case 165:
-#line 685 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+  case 171: // flush: "flush" ":" "boolean"
+#line 701 "netconf_parser.yy"
+                           {
+    ElementPtr flush(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1452 "netconf_parser.cc" // lalr1.cc:907
+#line 1482 "netconf_parser.cc"
     break;
 
-  case 166:
-#line 690 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 172: // maxsize: "maxsize" ":" "integer"
+#line 706 "netconf_parser.yy"
+                               {
+    ElementPtr maxsize(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1461 "netconf_parser.cc" // lalr1.cc:907
+#line 1491 "netconf_parser.cc"
     break;
 
-  case 167:
-#line 695 "netconf_parser.yy" // lalr1.cc:907
-    {
-    ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+  case 173: // maxver: "maxver" ":" "integer"
+#line 711 "netconf_parser.yy"
+                             {
+    ElementPtr maxver(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1470 "netconf_parser.cc" // lalr1.cc:907
+#line 1500 "netconf_parser.cc"
+    break;
+
+  case 174: // async: "async" ":" "boolean"
+#line 716 "netconf_parser.yy"
+                           {
+    ElementPtr async(new BoolElement(yystack_[0].value.as < bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 1509 "netconf_parser.cc"
     break;
 
+  case 175: // queue_size: "queue-size" ":" "integer"
+#line 721 "netconf_parser.yy"
+                                     {
+    ElementPtr size(new IntElement(yystack_[0].value.as < int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", size);
+}
+#line 1518 "netconf_parser.cc"
+    break;
+
+  case 176: // $@34: %empty
+#line 726 "netconf_parser.yy"
+                                 {
+    ctx.enter(ctx.NO_KEYWORDS);
+}
+#line 1526 "netconf_parser.cc"
+    break;
+
+  case 177: // overflow_policy: "overflow-policy" $@34 ":" "constant string"
+#line 728 "netconf_parser.yy"
+               {
+    ElementPtr policy(new StringElement(yystack_[0].value.as < std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 1536 "netconf_parser.cc"
+    break;
+
+
+#line 1540 "netconf_parser.cc"
 
-#line 1474 "netconf_parser.cc" // lalr1.cc:907
             default:
               break;
             }
@@ -1478,6 +1545,7 @@ namespace isc { namespace netconf {
 #if YY_EXCEPTIONS
       catch (const syntax_error& yyexc)
         {
+          YYCDEBUG << "Caught exception: " << yyexc.what() << '\n';
           error (yyexc);
           YYERROR;
         }
@@ -1485,13 +1553,13 @@ namespace isc { namespace netconf {
       YY_SYMBOL_PRINT ("-> $$ =", yylhs);
       yypop_ (yylen);
       yylen = 0;
-      YY_STACK_PRINT ();
 
       // Shift the result of the reduction.
       yypush_ (YY_NULLPTR, YY_MOVE (yylhs));
     }
     goto yynewstate;
 
+
   /*--------------------------------------.
   | yyerrlab -- here on detecting error.  |
   `--------------------------------------*/
@@ -1500,7 +1568,9 @@ namespace isc { namespace netconf {
     if (!yyerrstatus_)
       {
         ++yynerrs_;
-        error (yyla.location, yysyntax_error_ (yystack_[0].state, yyla));
+        context yyctx (*this, yyla);
+        std::string msg = yysyntax_error_ (yyctx);
+        error (yyla.location, YY_MOVE (msg));
       }
 
 
@@ -1511,7 +1581,7 @@ namespace isc { namespace netconf {
            error, discard it.  */
 
         // Return failure if at end of input.
-        if (yyla.type_get () == yyeof_)
+        if (yyla.kind () == symbol_kind::S_YYEOF)
           YYABORT;
         else if (!yyla.empty ())
           {
@@ -1528,68 +1598,81 @@ namespace isc { namespace netconf {
   | yyerrorlab -- error raised explicitly by YYERROR.  |
   `---------------------------------------------------*/
   yyerrorlab:
-
-    /* Pacify compilers like GCC when the user code never invokes
-       YYERROR and the label yyerrorlab therefore never appears in user
-       code.  */
+    /* Pacify compilers when the user code never invokes YYERROR and
+       the label yyerrorlab therefore never appears in user code.  */
     if (false)
-      goto yyerrorlab;
+      YYERROR;
+
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYERROR.  */
     yypop_ (yylen);
     yylen = 0;
+    YY_STACK_PRINT ();
     goto yyerrlab1;
 
+
   /*-------------------------------------------------------------.
   | yyerrlab1 -- common code for both syntax error and YYERROR.  |
   `-------------------------------------------------------------*/
   yyerrlab1:
     yyerrstatus_ = 3;   // Each real token shifted decrements this.
-    {
-      stack_symbol_type error_token;
-      for (;;)
-        {
-          yyn = yypact_[yystack_[0].state];
-          if (!yy_pact_value_is_default_ (yyn))
-            {
-              yyn += yyterror_;
-              if (0 <= yyn && yyn <= yylast_ && yycheck_[yyn] == yyterror_)
-                {
-                  yyn = yytable_[yyn];
-                  if (0 < yyn)
-                    break;
-                }
-            }
+    // Pop stack until we find a state that shifts the error token.
+    for (;;)
+      {
+        yyn = yypact_[+yystack_[0].state];
+        if (!yy_pact_value_is_default_ (yyn))
+          {
+            yyn += symbol_kind::S_YYerror;
+            if (0 <= yyn && yyn <= yylast_
+                && yycheck_[yyn] == symbol_kind::S_YYerror)
+              {
+                yyn = yytable_[yyn];
+                if (0 < yyn)
+                  break;
+              }
+          }
 
-          // Pop the current state because it cannot handle the error token.
-          if (yystack_.size () == 1)
-            YYABORT;
+        // Pop the current state because it cannot handle the error token.
+        if (yystack_.size () == 1)
+          YYABORT;
 
-          yyerror_range[1].location = yystack_[0].location;
-          yy_destroy_ ("Error: popping", yystack_[0]);
-          yypop_ ();
-          YY_STACK_PRINT ();
-        }
+        yyerror_range[1].location = yystack_[0].location;
+        yy_destroy_ ("Error: popping", yystack_[0]);
+        yypop_ ();
+        YY_STACK_PRINT ();
+      }
+    {
+      stack_symbol_type error_token;
 
       yyerror_range[2].location = yyla.location;
       YYLLOC_DEFAULT (error_token.location, yyerror_range, 2);
 
       // Shift the error token.
-      error_token.state = yyn;
+      error_token.state = state_type (yyn);
       yypush_ ("Shifting", YY_MOVE (error_token));
     }
     goto yynewstate;
 
-    // Accept.
+
+  /*-------------------------------------.
+  | yyacceptlab -- YYACCEPT comes here.  |
+  `-------------------------------------*/
   yyacceptlab:
     yyresult = 0;
     goto yyreturn;
 
-    // Abort.
+
+  /*-----------------------------------.
+  | yyabortlab -- YYABORT comes here.  |
+  `-----------------------------------*/
   yyabortlab:
     yyresult = 1;
     goto yyreturn;
 
+
+  /*-----------------------------------------------------.
+  | yyreturn -- parsing is finished, return the result.  |
+  `-----------------------------------------------------*/
   yyreturn:
     if (!yyla.empty ())
       yy_destroy_ ("Cleanup: discarding lookahead", yyla);
@@ -1597,6 +1680,7 @@ namespace isc { namespace netconf {
     /* Do not reclaim the symbols of the rule whose action triggered
        this YYABORT or YYACCEPT.  */
     yypop_ (yylen);
+    YY_STACK_PRINT ();
     while (1 < yystack_.size ())
       {
         yy_destroy_ ("Cleanup: popping", yystack_[0]);
@@ -1630,18 +1714,103 @@ namespace isc { namespace netconf {
     error (yyexc.location, yyexc.what ());
   }
 
-  // Generate an error message.
+  /* Return YYSTR after stripping away unnecessary quotes and
+     backslashes, so that it's suitable for yyerror.  The heuristic is
+     that double-quoting is unnecessary unless the string contains an
+     apostrophe, a comma, or backslash (other than backslash-backslash).
+     YYSTR is taken from yytname.  */
   std::string
-  NetconfParser::yysyntax_error_ (state_type yystate, const symbol_type& yyla) const
+  NetconfParser::yytnamerr_ (const char *yystr)
   {
-    // Number of reported tokens (one for the "unexpected", one per
-    // "expected").
-    size_t yycount = 0;
-    // Its maximum.
-    enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-    // Arguments of yyformat.
-    char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
+    if (*yystr == '"')
+      {
+        std::string yyr;
+        char const *yyp = yystr;
+
+        for (;;)
+          switch (*++yyp)
+            {
+            case '\'':
+            case ',':
+              goto do_not_strip_quotes;
+
+            case '\\':
+              if (*++yyp != '\\')
+                goto do_not_strip_quotes;
+              else
+                goto append;
+
+            append:
+            default:
+              yyr += *yyp;
+              break;
+
+            case '"':
+              return yyr;
+            }
+      do_not_strip_quotes: ;
+      }
+
+    return yystr;
+  }
+
+  std::string
+  NetconfParser::symbol_name (symbol_kind_type yysymbol)
+  {
+    return yytnamerr_ (yytname_[yysymbol]);
+  }
+
+
 
+  // NetconfParser::context.
+  NetconfParser::context::context (const NetconfParser& yyparser, const symbol_type& yyla)
+    : yyparser_ (yyparser)
+    , yyla_ (yyla)
+  {}
+
+  int
+  NetconfParser::context::expected_tokens (symbol_kind_type yyarg[], int yyargn) const
+  {
+    // Actual number of expected tokens
+    int yycount = 0;
+
+    const int yyn = yypact_[+yyparser_.yystack_[0].state];
+    if (!yy_pact_value_is_default_ (yyn))
+      {
+        /* Start YYX at -YYN if negative to avoid negative indexes in
+           YYCHECK.  In other words, skip the first -YYN actions for
+           this state because they are default actions.  */
+        const int yyxbegin = yyn < 0 ? -yyn : 0;
+        // Stay within bounds of both yycheck and yytname.
+        const int yychecklim = yylast_ - yyn + 1;
+        const int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+        for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
+          if (yycheck_[yyx + yyn] == yyx && yyx != symbol_kind::S_YYerror
+              && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
+            {
+              if (!yyarg)
+                ++yycount;
+              else if (yycount == yyargn)
+                return 0;
+              else
+                yyarg[yycount++] = YY_CAST (symbol_kind_type, yyx);
+            }
+      }
+
+    if (yyarg && yycount == 0 && 0 < yyargn)
+      yyarg[0] = symbol_kind::S_YYEMPTY;
+    return yycount;
+  }
+
+
+
+
+
+
+  int
+  NetconfParser::yy_syntax_error_arguments_ (const context& yyctx,
+                                                 symbol_kind_type yyarg[], int yyargn) const
+  {
     /* There are many possibilities here to consider:
        - If this state is a consistent state with a default action, then
          the only way this function was invoked is if the default action
@@ -1660,41 +1829,32 @@ namespace isc { namespace netconf {
        - Of course, the expected token list depends on states to have
          correct lookahead information, and it depends on the parser not
          to perform extra reductions after fetching a lookahead from the
-         scanner and before detecting a syntax error.  Thus, state
-         merging (from LALR or IELR) and default reductions corrupt the
-         expected token list.  However, the list is correct for
-         canonical LR with one exception: it will still contain any
-         token that will not be accepted due to an error action in a
-         later state.
+         scanner and before detecting a syntax error.  Thus, state merging
+         (from LALR or IELR) and default reductions corrupt the expected
+         token list.  However, the list is correct for canonical LR with
+         one exception: it will still contain any token that will not be
+         accepted due to an error action in a later state.
     */
-    if (!yyla.empty ())
+
+    if (!yyctx.lookahead ().empty ())
       {
-        int yytoken = yyla.type_get ();
-        yyarg[yycount++] = yytname_[yytoken];
-        int yyn = yypact_[yystate];
-        if (!yy_pact_value_is_default_ (yyn))
-          {
-            /* Start YYX at -YYN if negative to avoid negative indexes in
-               YYCHECK.  In other words, skip the first -YYN actions for
-               this state because they are default actions.  */
-            int yyxbegin = yyn < 0 ? -yyn : 0;
-            // Stay within bounds of both yycheck and yytname.
-            int yychecklim = yylast_ - yyn + 1;
-            int yyxend = yychecklim < yyntokens_ ? yychecklim : yyntokens_;
-            for (int yyx = yyxbegin; yyx < yyxend; ++yyx)
-              if (yycheck_[yyx + yyn] == yyx && yyx != yyterror_
-                  && !yy_table_value_is_error_ (yytable_[yyx + yyn]))
-                {
-                  if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                    {
-                      yycount = 1;
-                      break;
-                    }
-                  else
-                    yyarg[yycount++] = yytname_[yyx];
-                }
-          }
+        if (yyarg)
+          yyarg[0] = yyctx.token ();
+        int yyn = yyctx.expected_tokens (yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+        return yyn + 1;
       }
+    return 0;
+  }
+
+  // Generate an error message.
+  std::string
+  NetconfParser::yysyntax_error_ (const context& yyctx) const
+  {
+    // Its maximum.
+    enum { YYARGS_MAX = 5 };
+    // Arguments of yyformat.
+    symbol_kind_type yyarg[YYARGS_MAX];
+    int yycount = yy_syntax_error_arguments_ (yyctx, yyarg, YYARGS_MAX);
 
     char const* yyformat = YY_NULLPTR;
     switch (yycount)
@@ -1715,11 +1875,11 @@ namespace isc { namespace netconf {
 
     std::string yyres;
     // Argument number.
-    size_t yyi = 0;
+    std::ptrdiff_t yyi = 0;
     for (char const* yyp = yyformat; *yyp; ++yyp)
       if (yyp[0] == '%' && yyp[1] == 's' && yyi < yycount)
         {
-          yyres += yytnamerr_ (yyarg[yyi++]);
+          yyres += symbol_name (yyarg[yyi++]);
           ++yyp;
         }
       else
@@ -1728,41 +1888,43 @@ namespace isc { namespace netconf {
   }
 
 
-  const signed char NetconfParser::yypact_ninf_ = -64;
+  const signed char NetconfParser::yypact_ninf_ = -65;
 
   const signed char NetconfParser::yytable_ninf_ = -1;
 
   const short
   NetconfParser::yypact_[] =
   {
-      64,   -64,   -64,   -64,    13,     9,    18,    29,   -64,   -64,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-     -64,   -64,   -64,   -64,     9,   -22,    10,    15,   -64,     1,
-      70,    79,    74,   106,   -64,   -64,     7,   -64,   -64,   -64,
-     -64,   -64,   113,   116,   117,   118,   -64,   119,   -64,   120,
-     121,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-       9,     9,   -64,    80,   122,   123,    10,   -64,   125,   126,
-      83,    84,    85,   127,   131,   -64,   -64,    15,   -64,   -64,
-     132,   130,   133,   -64,   134,    97,   -64,   -64,   -64,   -64,
-     138,   -64,     9,    15,   105,   -64,   -64,   -64,    44,   137,
-     -64,   139,   -64,    16,   -64,   -64,   -64,   -64,   -64,   -64,
-     -64,   140,   136,   -64,   -64,   -64,   -64,   -64,   -64,   143,
-     142,   -64,   -64,   146,   105,   -64,   147,   148,   152,   153,
-     -64,    44,     2,   -64,   137,   141,   -64,   154,   155,   156,
-     157,   -64,   -64,   -64,   -64,    40,   -64,   -64,   -64,   -64,
-     158,    65,    65,    65,    65,   162,   163,    88,   -64,   -64,
-      43,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-      62,   -64,   -64,   -64,    82,    91,    92,   114,     9,   -64,
-       0,   158,   -64,   164,   165,    65,   -64,   -64,   -64,   -64,
-     -64,   -64,   -64,   -64,   166,   -64,   -64,   -64,   -64,    93,
-     -64,   -64,   -64,   -64,   -64,   -64,   115,   167,   -64,   168,
-     169,   129,   172,     0,   -64,   -64,    -6,   135,   173,   -64,
-     149,   -64,   -64,   -64,   -64,   -64,   -64,   -64,    94,   -64,
-     -64,   -64,   -64,   -64,   170,   -64,   175,   177,   178,    -6,
-     -64,   -64,    78,   -64,    87,   150,   151,   -64,    52,   170,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   179,   180,
-     181,    95,   -64,   -64,   -64,   -64,   -64,   -64,   188,   145,
-     159,   160,    52,   -64,   171,   -64,   -64,   -64,   -64,   -64
+      53,   -65,   -65,   -65,     7,     5,    16,    23,   -65,   -65,
+     -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,
+     -65,   -65,   -65,   -65,     5,   -30,    38,    13,   -65,    84,
+      44,    99,    85,   119,   -65,   -65,     8,   -65,   -65,   -65,
+     -65,   -65,   120,   121,   122,   123,   -65,   124,   -65,   115,
+     126,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,
+       5,     5,   -65,    81,   127,   128,    38,   -65,   129,   130,
+      83,    87,    91,   131,   132,   -65,   -65,    13,   -65,   -65,
+     133,   134,   135,   -65,   137,    96,   -65,   -65,   -65,   -65,
+     141,   -65,     5,    13,   107,   -65,   -65,   -65,    14,   140,
+     -65,   142,   -65,    10,   -65,   -65,   -65,   -65,   -65,   -65,
+     -65,   143,   145,   -65,   -65,   -65,   -65,   -65,   -65,   146,
+     153,   -65,   -65,   155,   107,   -65,   156,   157,   158,   159,
+     -65,    14,    46,   -65,   140,   144,   -65,   150,   160,   161,
+     162,   -65,   -65,   -65,   -65,    12,   -65,   -65,   -65,   -65,
+     163,    24,    24,    24,    24,   167,   168,    34,   -65,   -65,
+      75,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,
+      41,   -65,   -65,   -65,    77,    86,    88,   116,     5,   -65,
+      49,   163,   -65,   169,   170,    24,   -65,   -65,   -65,   -65,
+     -65,   -65,   -65,   -65,   171,   -65,   -65,   -65,   -65,   -65,
+      89,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   117,   172,
+     -65,   173,   174,   114,   176,   177,    49,   -65,   -65,    -6,
+     136,   178,   -65,   138,   139,   -65,   -65,   -65,   -65,   -65,
+     -65,   -65,   109,   -65,   -65,   -65,   -65,   -65,   175,   -65,
+     -65,   180,   182,   191,    -6,   -65,   -65,    76,   -65,    90,
+     147,   148,   -65,    66,   175,   -65,   -65,   -65,   -65,   -65,
+     -65,   -65,   -65,   194,   195,   196,   197,   198,   -65,   110,
+     -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   199,
+     152,   164,   165,   154,   166,   201,    66,   -65,   179,   -65,
+     -65,   -65,   -65,   -65,   181,   -65,   -65,   -65
   };
 
   const unsigned char
@@ -1787,163 +1949,170 @@ namespace isc { namespace netconf {
        0,   133,   105,   107,   104,    98,    99,   100,   102,   103,
        0,    95,    97,   101,     0,     0,     0,     0,     0,    68,
        0,     0,   132,     0,     0,     0,    88,    90,    92,    94,
-      73,    75,   146,   151,     0,   149,   145,   143,   144,     0,
-     137,   139,   141,   142,   140,   134,     0,     0,    96,     0,
-       0,     0,     0,     0,   136,   106,     0,     0,     0,   148,
-       0,   138,   117,   122,   124,   116,   114,   115,     0,   109,
-     111,   112,   113,   147,     0,   150,     0,     0,     0,     0,
-     108,   155,     0,   153,     0,     0,     0,   110,     0,     0,
-     152,   119,   120,   121,   118,   123,   125,   163,     0,     0,
-       0,     0,   157,   159,   160,   161,   162,   154,     0,     0,
-       0,     0,     0,   156,     0,   165,   166,   167,   158,   164
+      73,    75,   147,   154,     0,   152,   150,   146,   144,   145,
+       0,   137,   139,   141,   143,   142,   140,   134,     0,     0,
+      96,     0,     0,     0,     0,     0,     0,   136,   106,     0,
+       0,     0,   149,     0,     0,   138,   117,   122,   124,   116,
+     114,   115,     0,   109,   111,   112,   113,   148,     0,   153,
+     151,     0,     0,     0,     0,   108,   158,     0,   156,     0,
+       0,     0,   110,     0,     0,   155,   119,   120,   121,   118,
+     123,   125,   169,     0,     0,     0,     0,     0,   176,     0,
+     160,   162,   163,   164,   165,   166,   167,   168,   157,     0,
+       0,     0,     0,     0,     0,     0,     0,   159,     0,   171,
+     172,   173,   174,   175,     0,   161,   170,   177
   };
 
   const short
   NetconfParser::yypgoto_[] =
   {
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -20,   124,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -27,   -64,
-     -64,   -64,   144,   -64,   -64,   104,   -64,   161,   -24,   -19,
-     -18,   -26,   -64,   -25,   -64,   -64,   -64,   -64,   -64,    37,
-     -64,   -64,    41,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-     -64,    68,   -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,
-     -38,    17,   -64,   -64,   -64,   -64,   -64,   -39,   -64,   -64,
-     -64,   -64,   -64,   -64,   -64,   -64,   -64,   -64,    77,   -64,
-     -64,   -64,    22,   -64,   -64,    -9,   -64,   -64,   -64,   -64,
-     -64,   -64,   -64,   -64,   -42,   -64,   -64,   -63,   -64,   -64,
-     -64,   -64,   -64
+     -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -20,    92,
+     -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -27,   -65,
+     -65,   -65,   183,   -65,   -65,   118,   -65,   149,   -24,   -19,
+     -18,   -26,   -65,   -25,   -65,   -65,   -65,   -65,   -65,    73,
+     -65,   -65,    51,   -65,   -65,   -65,   -65,   -65,   -65,   -65,
+     -65,    78,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,
+     -33,    25,   -65,   -65,   -65,   -65,   -65,   -32,   -65,   -65,
+     -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,    97,   -65,
+     -65,   -65,    32,   -65,   -65,     4,   -65,   -65,   -65,   -65,
+     -65,   -65,   -65,   -65,   -65,   -65,   -31,   -65,   -65,   -64,
+     -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65,   -65
   };
 
   const short
   NetconfParser::yydefgoto_[] =
   {
-      -1,     4,     5,     6,     7,    23,    27,    16,    17,    18,
+       0,     4,     5,     6,     7,    23,    27,    16,    17,    18,
       25,    96,    32,    33,    19,    24,    29,    30,   164,    21,
       26,    36,    37,    38,    64,    49,    50,    51,   165,   166,
      167,   168,    68,   169,    69,    57,    74,   119,   120,   121,
      132,   145,   146,   147,   155,   148,   156,    58,    98,   111,
      112,   113,   114,   126,   115,   127,   116,   128,   117,   129,
-     170,   171,   172,   183,   173,   184,   228,   229,   230,   236,
-     254,   231,   237,   232,   238,    39,    65,   103,   104,   105,
-     123,   160,   161,   180,   199,   200,   201,   209,   202,   203,
-     212,   204,   210,   242,   243,   248,   261,   262,   263,   268,
-     264,   265,   266
+     170,   171,   172,   183,   173,   184,   232,   233,   234,   241,
+     259,   235,   242,   236,   243,    39,    65,   103,   104,   105,
+     123,   160,   161,   180,   200,   201,   202,   211,   203,   204,
+     215,   205,   214,   206,   212,   247,   248,   253,   269,   270,
+     271,   279,   272,   273,   274,   275,   276,   277,   285
   };
 
-  const unsigned short
+  const short
   NetconfParser::yytable_[] =
   {
-      48,    55,    56,    52,    28,    40,    41,    59,    53,    54,
-      66,    40,    41,     8,     9,    67,    10,   222,    11,   124,
-      34,   223,   224,    31,   125,    20,    40,    41,    42,    43,
-      44,    45,   142,   143,   192,   193,    22,   194,   195,    47,
-      78,    79,    35,   157,    46,    47,   181,    47,   158,   182,
+      48,    55,    56,    52,    28,    40,    41,     8,    53,    54,
+       9,    66,    10,   124,    11,   157,    67,   226,   125,    31,
+     158,   227,   228,    20,    40,    41,    42,    43,    44,    45,
+      22,   106,   107,   108,   109,    40,    41,    42,    43,    44,
+      78,    79,    46,    47,   185,   162,   163,    60,    34,   186,
       48,    55,    56,    52,    12,    13,    14,    15,    53,    54,
-      47,   106,   107,   108,   109,   185,    48,    55,    56,    52,
-     186,   110,   100,    60,    53,    54,    40,    41,    42,    43,
-      44,   249,    62,    61,   250,   185,   162,   163,   257,    47,
-     187,   258,   259,   260,   185,   185,   213,   239,   272,   188,
-     189,   214,   240,   273,   110,   144,     1,     2,     3,    63,
-      47,   251,   252,   253,   174,   175,   176,    70,   142,   143,
-      71,    72,    73,    75,    77,    80,    81,    82,    76,    84,
-      85,    86,    87,    88,    89,    90,    92,    93,   102,   131,
-      94,    10,    97,    99,   118,   134,   150,   122,   130,   133,
-     135,   137,   138,   196,   197,   198,   139,   140,   191,   190,
-     215,   151,   152,   153,   154,   159,   177,   178,   206,   207,
-     211,   149,   217,   218,   216,   219,   220,   241,   234,   244,
-     233,   245,   246,   269,   270,   271,   196,   197,   198,   225,
-     226,   227,   274,   275,   235,   255,   256,   101,   179,   141,
-     247,   136,   208,   205,   221,   276,   277,   267,    95,   278,
-      83,     0,   225,   226,   227,     0,   279,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    91
+      40,    41,    47,    47,   142,   143,    48,    55,    56,    52,
+      35,   110,   100,    47,    53,    54,   142,   143,   181,   254,
+     185,   182,   255,   192,   193,   187,   194,   195,   196,   185,
+      59,   185,   216,    62,   188,    47,   189,   217,    47,     1,
+       2,     3,   262,    61,   110,   144,   263,   264,   265,   266,
+     267,   268,   244,   286,   256,   257,   258,   245,   287,   174,
+     175,   176,    63,    76,    70,    71,    72,    73,    75,    77,
+      80,    81,    82,    84,    85,    86,    90,    92,    89,    87,
+     102,    93,    94,    88,    10,    97,    99,   118,   131,   150,
+     122,   130,   133,   197,   198,   199,   134,   151,   191,   135,
+     137,   138,   139,   140,   222,   190,   218,   152,   153,   154,
+     159,   177,   178,   208,   209,   213,    95,   220,   221,   219,
+     223,   224,   246,   238,   249,   237,   250,   239,   240,   197,
+     198,   199,   229,   230,   231,   251,   260,   261,   280,   281,
+     282,   283,   284,   288,   289,   294,   292,   149,   179,   141,
+     210,   101,   252,   207,   290,   291,   293,   229,   230,   231,
+     225,   136,   295,   278,     0,     0,    91,     0,   296,     0,
+     297,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    83
   };
 
   const short
   NetconfParser::yycheck_[] =
   {
-      27,    27,    27,    27,    24,    11,    12,     6,    27,    27,
-       3,    11,    12,     0,     5,     8,     7,    23,     9,     3,
-      10,    27,    28,    45,     8,     7,    11,    12,    13,    14,
-      15,    16,    30,    31,    34,    35,     7,    37,    38,    45,
-      60,    61,    32,     3,    29,    45,     3,    45,     8,     6,
-      77,    77,    77,    77,    45,    46,    47,    48,    77,    77,
-      45,    17,    18,    19,    20,     3,    93,    93,    93,    93,
-       8,    98,    92,     3,    93,    93,    11,    12,    13,    14,
-      15,     3,     8,     4,     6,     3,    21,    22,    36,    45,
-       8,    39,    40,    41,     3,     3,     3,     3,     3,     8,
-       8,     8,     8,     8,   131,   132,    42,    43,    44,     3,
-      45,    24,    25,    26,   152,   153,   154,     4,    30,    31,
-       4,     4,     4,     4,     3,    45,     4,     4,     8,     4,
-       4,    48,    48,    48,     7,     4,     4,     7,    33,     3,
-       7,     7,    45,     5,     7,     3,     5,     8,     8,     6,
-       4,     4,     4,   180,   180,   180,     4,     4,   178,    45,
-      45,     7,     7,     7,     7,     7,     4,     4,     4,     4,
-       4,   134,     4,     4,     7,    46,     4,     7,     5,     4,
-      45,     4,     4,     4,     4,     4,   213,   213,   213,   216,
-     216,   216,     4,    48,    45,    45,    45,    93,   157,   131,
-     239,   124,   185,   181,   213,    46,    46,   249,    84,   272,
-      66,    -1,   239,   239,   239,    -1,    45,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    77
+      27,    27,    27,    27,    24,    11,    12,     0,    27,    27,
+       5,     3,     7,     3,     9,     3,     8,    23,     8,    49,
+       8,    27,    28,     7,    11,    12,    13,    14,    15,    16,
+       7,    17,    18,    19,    20,    11,    12,    13,    14,    15,
+      60,    61,    29,    49,     3,    21,    22,     3,    10,     8,
+      77,    77,    77,    77,    49,    50,    51,    52,    77,    77,
+      11,    12,    49,    49,    30,    31,    93,    93,    93,    93,
+      32,    98,    92,    49,    93,    93,    30,    31,     3,     3,
+       3,     6,     6,    34,    35,     8,    37,    38,    39,     3,
+       6,     3,     3,     8,     8,    49,     8,     8,    49,    46,
+      47,    48,    36,     4,   131,   132,    40,    41,    42,    43,
+      44,    45,     3,     3,    24,    25,    26,     8,     8,   152,
+     153,   154,     3,     8,     4,     4,     4,     4,     4,     3,
+      49,     4,     4,     4,     4,    52,     4,     4,     7,    52,
+      33,     7,     7,    52,     7,    49,     5,     7,     3,     5,
+       8,     8,     6,   180,   180,   180,     3,     7,   178,     4,
+       4,     4,     4,     4,    50,    49,    49,     7,     7,     7,
+       7,     4,     4,     4,     4,     4,    84,     4,     4,     7,
+       4,     4,     7,     5,     4,    49,     4,    49,    49,   216,
+     216,   216,   219,   219,   219,     4,    49,    49,     4,     4,
+       4,     4,     4,     4,    52,     4,    52,   134,   157,   131,
+     185,    93,   244,   181,    50,    50,    50,   244,   244,   244,
+     216,   124,   286,   254,    -1,    -1,    77,    -1,    49,    -1,
+      49,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    66
   };
 
   const unsigned char
   NetconfParser::yystos_[] =
   {
-       0,    42,    43,    44,    50,    51,    52,    53,     0,     5,
-       7,     9,    45,    46,    47,    48,    56,    57,    58,    63,
-       7,    68,     7,    54,    64,    59,    69,    55,    57,    65,
-      66,    45,    61,    62,    10,    32,    70,    71,    72,   124,
-      11,    12,    13,    14,    15,    16,    29,    45,    67,    74,
-      75,    76,    77,    78,    79,    80,    82,    84,    96,     6,
-       3,     4,     8,     3,    73,   125,     3,     8,    81,    83,
-       4,     4,     4,     4,    85,     4,     8,     3,    57,    57,
-      45,     4,     4,    71,     4,     4,    48,    48,    48,     7,
-       4,    76,     4,     7,     7,    58,    60,    45,    97,     5,
-      57,    74,    33,   126,   127,   128,    17,    18,    19,    20,
-      67,    98,    99,   100,   101,   103,   105,   107,     7,    86,
-      87,    88,     8,   129,     3,     8,   102,   104,   106,   108,
-       8,     3,    89,     6,     3,     4,   127,     4,     4,     4,
-       4,   100,    30,    31,    67,    90,    91,    92,    94,    88,
-       5,     7,     7,     7,     7,    93,    95,     3,     8,     7,
-     130,   131,    21,    22,    67,    77,    78,    79,    80,    82,
-     109,   110,   111,   113,   109,   109,   109,     4,     4,    91,
-     132,     3,     6,   112,   114,     3,     8,     8,     8,     8,
-      45,    57,    34,    35,    37,    38,    67,    80,    82,   133,
-     134,   135,   137,   138,   140,   131,     4,     4,   110,   136,
-     141,     4,   139,     3,     8,    45,     7,     4,     4,    46,
-       4,   134,    23,    27,    28,    67,    80,    82,   115,   116,
-     117,   120,   122,    45,     5,    45,   118,   121,   123,     3,
-       8,     7,   142,   143,     4,     4,     4,   116,   144,     3,
-       6,    24,    25,    26,   119,    45,    45,    36,    39,    40,
-      41,   145,   146,   147,   149,   150,   151,   143,   148,     4,
-       4,     4,     3,     8,     4,    48,    46,    46,   146,    45
+       0,    46,    47,    48,    54,    55,    56,    57,     0,     5,
+       7,     9,    49,    50,    51,    52,    60,    61,    62,    67,
+       7,    72,     7,    58,    68,    63,    73,    59,    61,    69,
+      70,    49,    65,    66,    10,    32,    74,    75,    76,   128,
+      11,    12,    13,    14,    15,    16,    29,    49,    71,    78,
+      79,    80,    81,    82,    83,    84,    86,    88,   100,     6,
+       3,     4,     8,     3,    77,   129,     3,     8,    85,    87,
+       4,     4,     4,     4,    89,     4,     8,     3,    61,    61,
+      49,     4,     4,    75,     4,     4,    52,    52,    52,     7,
+       4,    80,     4,     7,     7,    62,    64,    49,   101,     5,
+      61,    78,    33,   130,   131,   132,    17,    18,    19,    20,
+      71,   102,   103,   104,   105,   107,   109,   111,     7,    90,
+      91,    92,     8,   133,     3,     8,   106,   108,   110,   112,
+       8,     3,    93,     6,     3,     4,   131,     4,     4,     4,
+       4,   104,    30,    31,    71,    94,    95,    96,    98,    92,
+       5,     7,     7,     7,     7,    97,    99,     3,     8,     7,
+     134,   135,    21,    22,    71,    81,    82,    83,    84,    86,
+     113,   114,   115,   117,   113,   113,   113,     4,     4,    95,
+     136,     3,     6,   116,   118,     3,     8,     8,     8,     8,
+      49,    61,    34,    35,    37,    38,    39,    71,    84,    86,
+     137,   138,   139,   141,   142,   144,   146,   135,     4,     4,
+     114,   140,   147,     4,   145,   143,     3,     8,    49,     7,
+       4,     4,    50,     4,     4,   138,    23,    27,    28,    71,
+      84,    86,   119,   120,   121,   124,   126,    49,     5,    49,
+      49,   122,   125,   127,     3,     8,     7,   148,   149,     4,
+       4,     4,   120,   150,     3,     6,    24,    25,    26,   123,
+      49,    49,    36,    40,    41,    42,    43,    44,    45,   151,
+     152,   153,   155,   156,   157,   158,   159,   160,   149,   154,
+       4,     4,     4,     4,     4,   161,     3,     8,     4,    52,
+      50,    50,    52,    50,     4,   152,    49,    49
   };
 
   const unsigned char
   NetconfParser::yyr1_[] =
   {
-       0,    49,    51,    50,    52,    50,    53,    50,    55,    54,
-      56,    57,    57,    57,    57,    57,    57,    57,    59,    58,
-      60,    61,    61,    62,    62,    64,    63,    65,    65,    66,
-      66,    67,    69,    68,    70,    70,    71,    71,    73,    72,
-      74,    74,    75,    75,    76,    76,    76,    76,    76,    76,
-      76,    76,    77,    78,    79,    81,    80,    83,    82,    85,
-      84,    86,    86,    87,    87,    89,    88,    90,    90,    90,
-      91,    91,    93,    92,    95,    94,    97,    96,    98,    98,
-      99,    99,   100,   100,   100,   100,   100,   102,   101,   104,
-     103,   106,   105,   108,   107,   109,   109,   110,   110,   110,
-     110,   110,   110,   110,   110,   112,   111,   114,   113,   115,
-     115,   116,   116,   116,   116,   116,   116,   118,   117,   119,
-     119,   119,   121,   120,   123,   122,   125,   124,   126,   126,
-     127,   129,   128,   130,   130,   132,   131,   133,   133,   134,
-     134,   134,   134,   134,   134,   134,   136,   135,   137,   139,
-     138,   141,   140,   142,   142,   144,   143,   145,   145,   146,
-     146,   146,   146,   148,   147,   149,   150,   151
+       0,    53,    55,    54,    56,    54,    57,    54,    59,    58,
+      60,    61,    61,    61,    61,    61,    61,    61,    63,    62,
+      64,    65,    65,    66,    66,    68,    67,    69,    69,    70,
+      70,    71,    73,    72,    74,    74,    75,    75,    77,    76,
+      78,    78,    79,    79,    80,    80,    80,    80,    80,    80,
+      80,    80,    81,    82,    83,    85,    84,    87,    86,    89,
+      88,    90,    90,    91,    91,    93,    92,    94,    94,    94,
+      95,    95,    97,    96,    99,    98,   101,   100,   102,   102,
+     103,   103,   104,   104,   104,   104,   104,   106,   105,   108,
+     107,   110,   109,   112,   111,   113,   113,   114,   114,   114,
+     114,   114,   114,   114,   114,   116,   115,   118,   117,   119,
+     119,   120,   120,   120,   120,   120,   120,   122,   121,   123,
+     123,   123,   125,   124,   127,   126,   129,   128,   130,   130,
+     131,   133,   132,   134,   134,   136,   135,   137,   137,   138,
+     138,   138,   138,   138,   138,   138,   138,   140,   139,   141,
+     143,   142,   145,   144,   147,   146,   148,   148,   150,   149,
+     151,   151,   152,   152,   152,   152,   152,   152,   152,   154,
+     153,   155,   156,   157,   158,   159,   161,   160
   };
 
-  const unsigned char
+  const signed char
   NetconfParser::yyr2_[] =
   {
        0,     2,     0,     3,     0,     3,     0,     3,     0,     4,
@@ -1960,95 +2129,100 @@ namespace isc { namespace netconf {
        3,     1,     1,     1,     1,     1,     1,     0,     4,     1,
        1,     1,     0,     4,     0,     4,     0,     6,     1,     3,
        1,     0,     6,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     0,     4,     3,     0,
-       4,     0,     6,     1,     3,     0,     4,     1,     3,     1,
-       1,     1,     1,     0,     4,     3,     3,     3
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     3,
+       0,     4,     0,     4,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     3,     3,     3,     3,     0,     4
   };
 
 
-
+#if NETCONF_DEBUG || 1
   // YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
-  // First, the terminals, then, starting at \a yyntokens_, nonterminals.
+  // First, the terminals, then, starting at \a YYNTOKENS, nonterminals.
   const char*
   const NetconfParser::yytname_[] =
   {
-  "\"end of file\"", "error", "$undefined", "\",\"", "\":\"", "\"[\"",
-  "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Netconf\"", "\"user-context\"",
-  "\"comment\"", "\"boot-update\"", "\"subscribe-changes\"",
-  "\"validate-changes\"", "\"managed-servers\"", "\"dhcp4\"", "\"dhcp6\"",
-  "\"d2\"", "\"ca\"", "\"model\"", "\"control-socket\"", "\"socket-type\"",
-  "\"unix\"", "\"http\"", "\"stdout\"", "\"socket-name\"",
-  "\"socket-url\"", "\"hooks-libraries\"", "\"library\"", "\"parameters\"",
-  "\"Logging\"", "\"loggers\"", "\"name\"", "\"output_options\"",
-  "\"output\"", "\"debuglevel\"", "\"severity\"", "\"flush\"",
-  "\"maxsize\"", "\"maxver\"", "START_JSON", "START_NETCONF",
-  "START_SUB_NETCONF", "\"constant string\"", "\"integer\"",
-  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
-  "$@3", "sub_netconf", "$@4", "json", "value", "map", "$@5", "map_value",
-  "map_content", "not_empty_map", "list_generic", "$@6", "list_content",
-  "not_empty_list", "unknown_map_entry", "netconf_syntax_map", "$@7",
-  "global_objects", "global_object", "netconf_object", "$@8",
-  "global_params", "not_empty_global_params", "global_param",
-  "boot_update", "subscribe_changes", "validate_changes", "user_context",
-  "$@9", "comment", "$@10", "hooks_libraries", "$@11",
-  "hooks_libraries_list", "not_empty_hooks_libraries_list",
-  "hooks_library", "$@12", "hooks_params", "hooks_param", "library",
-  "$@13", "parameters", "$@14", "managed_servers", "$@15",
-  "servers_entries", "not_empty_servers_entries", "server_entry",
-  "dhcp4_server", "$@16", "dhcp6_server", "$@17", "d2_server", "$@18",
-  "ca_server", "$@19", "managed_server_params", "managed_server_param",
-  "model", "$@20", "control_socket", "$@21", "control_socket_params",
+  "\"end of file\"", "error", "\"invalid token\"", "\",\"", "\":\"",
+  "\"[\"", "\"]\"", "\"{\"", "\"}\"", "\"null\"", "\"Netconf\"",
+  "\"user-context\"", "\"comment\"", "\"boot-update\"",
+  "\"subscribe-changes\"", "\"validate-changes\"", "\"managed-servers\"",
+  "\"dhcp4\"", "\"dhcp6\"", "\"d2\"", "\"ca\"", "\"model\"",
+  "\"control-socket\"", "\"socket-type\"", "\"unix\"", "\"http\"",
+  "\"stdout\"", "\"socket-name\"", "\"socket-url\"", "\"hooks-libraries\"",
+  "\"library\"", "\"parameters\"", "\"Logging\"", "\"loggers\"",
+  "\"name\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
+  "\"rate-limit\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
+  "\"maxver\"", "\"async\"", "\"queue-size\"", "\"overflow-policy\"",
+  "START_JSON", "START_NETCONF", "START_SUB_NETCONF",
+  "\"constant string\"", "\"integer\"", "\"floating point\"",
+  "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "sub_netconf",
+  "$@4", "json", "value", "map", "$@5", "map_value", "map_content",
+  "not_empty_map", "list_generic", "$@6", "list_content", "not_empty_list",
+  "unknown_map_entry", "netconf_syntax_map", "$@7", "global_objects",
+  "global_object", "netconf_object", "$@8", "global_params",
+  "not_empty_global_params", "global_param", "boot_update",
+  "subscribe_changes", "validate_changes", "user_context", "$@9",
+  "comment", "$@10", "hooks_libraries", "$@11", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@12",
+  "hooks_params", "hooks_param", "library", "$@13", "parameters", "$@14",
+  "managed_servers", "$@15", "servers_entries",
+  "not_empty_servers_entries", "server_entry", "dhcp4_server", "$@16",
+  "dhcp6_server", "$@17", "d2_server", "$@18", "ca_server", "$@19",
+  "managed_server_params", "managed_server_param", "model", "$@20",
+  "control_socket", "$@21", "control_socket_params",
   "control_socket_param", "socket_type", "$@22", "socket_type_value",
   "socket_name", "$@23", "socket_url", "$@24", "logging_object", "$@25",
   "logging_params", "logging_param", "loggers", "$@26", "loggers_entries",
   "logger_entry", "$@27", "logger_params", "logger_param", "name", "$@28",
-  "debuglevel", "severity", "$@29", "output_options_list", "$@30",
-  "output_options_list_content", "output_entry", "$@31",
-  "output_params_list", "output_params", "output", "$@32", "flush",
-  "maxsize", "maxver", YY_NULLPTR
+  "debuglevel", "severity", "$@29", "rate_limit", "$@30",
+  "output_options_list", "$@31", "output_options_list_content",
+  "output_entry", "$@32", "output_params_list", "output_params", "output",
+  "$@33", "flush", "maxsize", "maxver", "async", "queue_size",
+  "overflow_policy", "$@34", YY_NULLPTR
   };
+#endif
+
 
 #if NETCONF_DEBUG
-  const unsigned short
+  const short
   NetconfParser::yyrline_[] =
   {
-       0,   118,   118,   118,   119,   119,   120,   120,   128,   128,
-     139,   145,   146,   147,   148,   149,   150,   151,   155,   155,
-     166,   171,   172,   180,   184,   191,   191,   197,   198,   201,
-     205,   218,   226,   226,   238,   239,   243,   244,   248,   248,
-     265,   266,   269,   270,   275,   276,   277,   278,   279,   280,
-     281,   282,   285,   290,   295,   300,   300,   325,   325,   353,
-     353,   363,   364,   367,   368,   371,   371,   379,   380,   381,
-     384,   385,   388,   388,   396,   396,   406,   406,   416,   417,
-     420,   421,   427,   428,   429,   430,   431,   435,   435,   446,
-     446,   457,   457,   468,   468,   479,   480,   484,   485,   486,
-     487,   488,   489,   490,   491,   495,   495,   504,   504,   515,
-     516,   519,   520,   521,   522,   523,   524,   527,   527,   535,
-     536,   537,   540,   540,   549,   549,   564,   564,   577,   578,
-     582,   586,   586,   598,   599,   603,   603,   611,   612,   615,
-     616,   617,   618,   619,   620,   621,   624,   624,   632,   637,
-     637,   645,   645,   655,   656,   659,   659,   667,   668,   671,
-     672,   673,   674,   677,   677,   685,   690,   695
+       0,   122,   122,   122,   123,   123,   124,   124,   132,   132,
+     143,   149,   150,   151,   152,   153,   154,   155,   159,   159,
+     170,   175,   176,   184,   188,   195,   195,   201,   202,   205,
+     209,   222,   230,   230,   242,   243,   247,   248,   252,   252,
+     269,   270,   273,   274,   279,   280,   281,   282,   283,   284,
+     285,   286,   289,   294,   299,   304,   304,   329,   329,   357,
+     357,   367,   368,   371,   372,   375,   375,   383,   384,   385,
+     388,   389,   392,   392,   400,   400,   410,   410,   420,   421,
+     424,   425,   431,   432,   433,   434,   435,   439,   439,   450,
+     450,   461,   461,   472,   472,   483,   484,   488,   489,   490,
+     491,   492,   493,   494,   495,   499,   499,   508,   508,   519,
+     520,   523,   524,   525,   526,   527,   528,   531,   531,   539,
+     540,   541,   544,   544,   553,   553,   568,   568,   581,   582,
+     586,   590,   590,   602,   603,   607,   607,   615,   616,   619,
+     620,   621,   622,   623,   624,   625,   626,   629,   629,   637,
+     642,   642,   650,   650,   658,   658,   668,   669,   672,   672,
+     680,   681,   684,   685,   686,   687,   688,   689,   690,   693,
+     693,   701,   706,   711,   716,   721,   726,   726
   };
 
-  // Print the state stack on the debug stream.
   void
-  NetconfParser::yystack_print_ ()
+  NetconfParser::yy_stack_print_ () const
   {
     *yycdebug_ << "Stack now";
     for (stack_type::const_iterator
            i = yystack_.begin (),
            i_end = yystack_.end ();
          i != i_end; ++i)
-      *yycdebug_ << ' ' << i->state;
+      *yycdebug_ << ' ' << int (i->state);
     *yycdebug_ << '\n';
   }
 
-  // Report on the debug stream that the rule \a yyrule is going to be reduced.
   void
-  NetconfParser::yy_reduce_print_ (int yyrule)
+  NetconfParser::yy_reduce_print_ (int yyrule) const
   {
-    unsigned yylno = yyrline_[yyrule];
+    int yylno = yyrline_[yyrule];
     int yynrhs = yyr2_[yyrule];
     // Print the symbols being reduced, and their result.
     *yycdebug_ << "Reducing stack by rule " << yyrule - 1
@@ -2061,10 +2235,11 @@ namespace isc { namespace netconf {
 #endif // NETCONF_DEBUG
 
 
-#line 14 "netconf_parser.yy" // lalr1.cc:1218
+#line 14 "netconf_parser.yy"
 } } // isc::netconf
-#line 2067 "netconf_parser.cc" // lalr1.cc:1218
-#line 700 "netconf_parser.yy" // lalr1.cc:1219
+#line 2241 "netconf_parser.cc"
+
+#line 734 "netconf_parser.yy"
 
 
 void
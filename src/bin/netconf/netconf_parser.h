@@ -1,8 +1,8 @@
-// A Bison parser, made by GNU Bison 3.2.1.
+// A Bison parser, made by GNU Bison 3.8.2.
 
 // Skeleton interface for Bison LALR(1) parsers in C++
 
-// Copyright (C) 2002-2015, 2018 Free Software Foundation, Inc.
+// Copyright (C) 2002-2015, 2018-2021 Free Software Foundation, Inc.
 
 // This program is free software: you can redistribute it and/or modify
 // it under the terms of the GNU General Public License as published by
@@ -15,7 +15,7 @@
 // GNU General Public License for more details.
 
 // You should have received a copy of the GNU General Public License
-// along with this program.  If not, see <http://www.gnu.org/licenses/>.
+// along with this program.  If not, see <https://www.gnu.org/licenses/>.
 
 // As a special exception, you may create a larger work that contains
 // part or all of the Bison parser skeleton and distribute that work
@@ -38,13 +38,14 @@
 
 // C++ LALR(1) parser skeleton written by Akim Demaille.
 
-// Undocumented macros, especially those whose name start with YY_,
-// are private implementation details.  Do not rely on them.
+// DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+// especially those whose name start with YY_ or yy_.  They are
+// private implementation details that can be changed or removed.
 
 #ifndef YY_NETCONF_NETCONF_PARSER_H_INCLUDED
 # define YY_NETCONF_NETCONF_PARSER_H_INCLUDED
-// //                    "%code requires" blocks.
-#line 17 "netconf_parser.yy" // lalr1.cc:404
+// "%code requires" blocks.
+#line 17 "netconf_parser.yy"
 
 #include <string>
 #include <cc/data.h>
@@ -55,7 +56,7 @@ using namespace isc::netconf;
 using namespace isc::data;
 using namespace std;
 
-#line 59 "netconf_parser.h" // lalr1.cc:404
+#line 60 "netconf_parser.h"
 
 # include <cassert>
 # include <cstdlib> // std::abort
@@ -84,46 +85,66 @@ using namespace std;
 # define YY_RVREF(Type)    const Type&
 # define YY_COPY(Type)     const Type&
 #endif
+
+// Support noexcept when possible.
+#if 201103L <= YY_CPLUSPLUS
+# define YY_NOEXCEPT noexcept
+# define YY_NOTHROW
+#else
+# define YY_NOEXCEPT
+# define YY_NOTHROW throw ()
+#endif
+
+// Support constexpr when possible.
+#if 201703 <= YY_CPLUSPLUS
+# define YY_CONSTEXPR constexpr
+#else
+# define YY_CONSTEXPR
+#endif
 # include "location.hh"
 #include <typeinfo>
-#ifndef YYASSERT
+#ifndef NETCONF__ASSERT
 # include <cassert>
-# define YYASSERT assert
+# define NETCONF__ASSERT assert
 #endif
 
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
 # else
-#  define YY_ATTRIBUTE(Spec) /* empty */
+#  define YY_ATTRIBUTE_PURE
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
-#endif
-
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && ! defined __ICC && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -136,6 +157,27 @@ using namespace std;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
 #  if defined __cplusplus
 #   if 201103L <= __cplusplus
@@ -161,193 +203,92 @@ using namespace std;
 # endif /* ! defined YYDEBUG */
 #endif  /* ! defined NETCONF_DEBUG */
 
-#line 14 "netconf_parser.yy" // lalr1.cc:404
+#line 14 "netconf_parser.yy"
 namespace isc { namespace netconf {
-#line 167 "netconf_parser.h" // lalr1.cc:404
-
-  /// A stack with random access from its top.
-  template <typename T, typename S = std::vector<T> >
-  class stack
-  {
-  public:
-    // Hide our reversed order.
-    typedef typename S::reverse_iterator iterator;
-    typedef typename S::const_reverse_iterator const_iterator;
-    typedef typename S::size_type size_type;
-
-    stack (size_type n = 200)
-      : seq_ (n)
-    {}
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (size_type i)
-    {
-      return seq_[size () - 1 - i];
-    }
+#line 209 "netconf_parser.h"
 
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    T&
-    operator[] (int i)
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (size_type i) const
-    {
-      return seq_[size () - 1 - i];
-    }
-
-    /// Random access.
-    ///
-    /// Index 0 returns the topmost element.
-    const T&
-    operator[] (int i) const
-    {
-      return operator[] (size_type (i));
-    }
-
-    /// Steal the contents of \a t.
-    ///
-    /// Close to move-semantics.
-    void
-    push (YY_MOVE_REF (T) t)
-    {
-      seq_.push_back (T ());
-      operator[](0).move (t);
-    }
-
-    void
-    pop (int n = 1)
-    {
-      for (; 0 < n; --n)
-        seq_.pop_back ();
-    }
-
-    void
-    clear ()
-    {
-      seq_.clear ();
-    }
-
-    size_type
-    size () const
-    {
-      return seq_.size ();
-    }
-
-    const_iterator
-    begin () const
-    {
-      return seq_.rbegin ();
-    }
 
-    const_iterator
-    end () const
-    {
-      return seq_.rend ();
-    }
 
-  private:
-    stack (const stack&);
-    stack& operator= (const stack&);
-    /// The wrapped container.
-    S seq_;
-  };
 
-  /// Present a slice of the top of a stack.
-  template <typename T, typename S = stack<T> >
-  class slice
+  /// A Bison parser.
+  class NetconfParser
   {
   public:
-    slice (const S& stack, int range)
-      : stack_ (stack)
-      , range_ (range)
-    {}
-
-    const T&
-    operator[] (int i) const
-    {
-      return stack_[range_ - i];
-    }
-
-  private:
-    const S& stack_;
-    int range_;
-  };
-
-
-
-  /// A char[S] buffer to store and retrieve objects.
+#ifdef NETCONF_STYPE
+# ifdef __GNUC__
+#  pragma GCC message "bison: do not #define NETCONF_STYPE in C++, use %define api.value.type"
+# endif
+    typedef NETCONF_STYPE value_type;
+#else
+  /// A buffer to store and retrieve objects.
   ///
   /// Sort of a variant, but does not keep track of the nature
   /// of the stored data, since that knowledge is available
-  /// via the current state.
-  template <size_t S>
-  struct variant
+  /// via the current parser state.
+  class value_type
   {
+  public:
     /// Type of *this.
-    typedef variant<S> self_type;
+    typedef value_type self_type;
 
     /// Empty construction.
-    variant ()
-      : yybuffer_ ()
+    value_type () YY_NOEXCEPT
+      : yyraw_ ()
       , yytypeid_ (YY_NULLPTR)
     {}
 
     /// Construct and fill.
     template <typename T>
-    variant (YY_RVREF (T) t)
+    value_type (YY_RVREF (T) t)
       : yytypeid_ (&typeid (T))
     {
-      YYASSERT (sizeof (T) <= S);
+      NETCONF__ASSERT (sizeof (T) <= size);
       new (yyas_<T> ()) T (YY_MOVE (t));
     }
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    value_type (const self_type&) = delete;
+    /// Non copyable.
+    self_type& operator= (const self_type&) = delete;
+#endif
+
     /// Destruction, allowed only if empty.
-    ~variant ()
+    ~value_type () YY_NOEXCEPT
     {
-      YYASSERT (!yytypeid_);
+      NETCONF__ASSERT (!yytypeid_);
     }
 
+# if 201103L <= YY_CPLUSPLUS
+    /// Instantiate a \a T in here from \a t.
+    template <typename T, typename... U>
+    T&
+    emplace (U&&... u)
+    {
+      NETCONF__ASSERT (!yytypeid_);
+      NETCONF__ASSERT (sizeof (T) <= size);
+      yytypeid_ = & typeid (T);
+      return *new (yyas_<T> ()) T (std::forward <U>(u)...);
+    }
+# else
     /// Instantiate an empty \a T in here.
     template <typename T>
     T&
     emplace ()
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      NETCONF__ASSERT (!yytypeid_);
+      NETCONF__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T ();
     }
 
-# if 201103L <= YY_CPLUSPLUS
-    /// Instantiate a \a T in here from \a t.
-    template <typename T, typename U>
-    T&
-    emplace (U&& u)
-    {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
-      yytypeid_ = & typeid (T);
-      return *new (yyas_<T> ()) T (std::forward <U>(u));
-    }
-# else
     /// Instantiate a \a T in here from \a t.
     template <typename T>
     T&
     emplace (const T& t)
     {
-      YYASSERT (!yytypeid_);
-      YYASSERT (sizeof (T) <= S);
+      NETCONF__ASSERT (!yytypeid_);
+      NETCONF__ASSERT (sizeof (T) <= size);
       yytypeid_ = & typeid (T);
       return *new (yyas_<T> ()) T (t);
     }
@@ -374,75 +315,75 @@ namespace isc { namespace netconf {
     /// Accessor to a built \a T.
     template <typename T>
     T&
-    as ()
+    as () YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      NETCONF__ASSERT (yytypeid_);
+      NETCONF__ASSERT (*yytypeid_ == typeid (T));
+      NETCONF__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
     /// Const accessor to a built \a T (for %printer).
     template <typename T>
     const T&
-    as () const
+    as () const YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == typeid (T));
-      YYASSERT (sizeof (T) <= S);
+      NETCONF__ASSERT (yytypeid_);
+      NETCONF__ASSERT (*yytypeid_ == typeid (T));
+      NETCONF__ASSERT (sizeof (T) <= size);
       return *yyas_<T> ();
     }
 
-    /// Swap the content with \a other, of same type.
+    /// Swap the content with \a that, of same type.
     ///
     /// Both variants must be built beforehand, because swapping the actual
     /// data requires reading it (with as()), and this is not possible on
     /// unconstructed variants: it would require some dynamic testing, which
     /// should not be the variant's responsibility.
     /// Swapping between built and (possibly) non-built is done with
-    /// variant::move ().
+    /// self_type::move ().
     template <typename T>
     void
-    swap (self_type& other)
+    swap (self_type& that) YY_NOEXCEPT
     {
-      YYASSERT (yytypeid_);
-      YYASSERT (*yytypeid_ == *other.yytypeid_);
-      std::swap (as<T> (), other.as<T> ());
+      NETCONF__ASSERT (yytypeid_);
+      NETCONF__ASSERT (*yytypeid_ == *that.yytypeid_);
+      std::swap (as<T> (), that.as<T> ());
     }
 
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     ///
-    /// Destroys \a other.
+    /// Destroys \a that.
     template <typename T>
     void
-    move (self_type& other)
+    move (self_type& that)
     {
 # if 201103L <= YY_CPLUSPLUS
-      emplace<T> (std::move (other.as<T> ()));
+      emplace<T> (std::move (that.as<T> ()));
 # else
       emplace<T> ();
-      swap<T> (other);
+      swap<T> (that);
 # endif
-      other.destroy<T> ();
+      that.destroy<T> ();
     }
 
 # if 201103L <= YY_CPLUSPLUS
-    /// Move the content of \a other to this.
+    /// Move the content of \a that to this.
     template <typename T>
     void
-    move (self_type&& other)
+    move (self_type&& that)
     {
-      emplace<T> (std::move (other.as<T> ()));
-      other.destroy<T> ();
+      emplace<T> (std::move (that.as<T> ()));
+      that.destroy<T> ();
     }
 #endif
 
-    /// Copy the content of \a other to this.
+    /// Copy the content of \a that to this.
     template <typename T>
     void
-    copy (const self_type& other)
+    copy (const self_type& that)
     {
-      emplace<T> (other.as<T> ());
+      emplace<T> (that.as<T> ());
     }
 
     /// Destroy the stored \a T.
@@ -455,46 +396,31 @@ namespace isc { namespace netconf {
     }
 
   private:
-    /// Prohibit blind copies.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
+    value_type (const self_type&);
+    /// Non copyable.
     self_type& operator= (const self_type&);
-    variant (const self_type&);
+#endif
 
     /// Accessor to raw memory as \a T.
     template <typename T>
     T*
-    yyas_ ()
+    yyas_ () YY_NOEXCEPT
     {
-      void *yyp = yybuffer_.yyraw;
+      void *yyp = yyraw_;
       return static_cast<T*> (yyp);
      }
 
     /// Const accessor to raw memory as \a T.
     template <typename T>
     const T*
-    yyas_ () const
+    yyas_ () const YY_NOEXCEPT
     {
-      const void *yyp = yybuffer_.yyraw;
+      const void *yyp = yyraw_;
       return static_cast<const T*> (yyp);
      }
 
-    union
-    {
-      /// Strongest alignment constraints.
-      long double yyalign_me;
-      /// A buffer large enough to store any of the semantic values.
-      char yyraw[S];
-    } yybuffer_;
-
-    /// Whether the content is built: if defined, the name of the stored type.
-    const std::type_info *yytypeid_;
-  };
-
-
-  /// A Bison parser.
-  class NetconfParser
-  {
-  public:
-#ifndef NETCONF_STYPE
     /// An auxiliary type to compute the largest semantic type.
     union union_type
     {
@@ -514,94 +440,301 @@ namespace isc { namespace netconf {
 
       // "constant string"
       char dummy5[sizeof (std::string)];
-};
+    };
+
+    /// The size of the largest semantic type.
+    enum { size = sizeof (union_type) };
+
+    /// A buffer to store semantic values.
+    union
+    {
+      /// Strongest alignment constraints.
+      long double yyalign_me_;
+      /// A buffer large enough to store any of the semantic values.
+      char yyraw_[size];
+    };
+
+    /// Whether the content is built: if defined, the name of the stored type.
+    const std::type_info *yytypeid_;
+  };
 
-    /// Symbol semantic values.
-    typedef variant<sizeof (union_type)> semantic_type;
-#else
-    typedef NETCONF_STYPE semantic_type;
 #endif
+    /// Backward compatibility (Bison 3.8).
+    typedef value_type semantic_type;
+
     /// Symbol locations.
     typedef location location_type;
 
     /// Syntax errors thrown from user actions.
     struct syntax_error : std::runtime_error
     {
-      syntax_error (const location_type& l, const std::string& m);
+      syntax_error (const location_type& l, const std::string& m)
+        : std::runtime_error (m)
+        , location (l)
+      {}
+
+      syntax_error (const syntax_error& s)
+        : std::runtime_error (s.what ())
+        , location (s.location)
+      {}
+
+      ~syntax_error () YY_NOEXCEPT YY_NOTHROW;
+
       location_type location;
     };
 
-    /// Tokens.
+    /// Token kinds.
     struct token
     {
-      enum yytokentype
-      {
-        TOKEN_END = 0,
-        TOKEN_COMMA = 258,
-        TOKEN_COLON = 259,
-        TOKEN_LSQUARE_BRACKET = 260,
-        TOKEN_RSQUARE_BRACKET = 261,
-        TOKEN_LCURLY_BRACKET = 262,
-        TOKEN_RCURLY_BRACKET = 263,
-        TOKEN_NULL_TYPE = 264,
-        TOKEN_NETCONF = 265,
-        TOKEN_USER_CONTEXT = 266,
-        TOKEN_COMMENT = 267,
-        TOKEN_BOOT_UPDATE = 268,
-        TOKEN_SUBSCRIBE_CHANGES = 269,
-        TOKEN_VALIDATE_CHANGES = 270,
-        TOKEN_MANAGED_SERVERS = 271,
-        TOKEN_DHCP4_SERVER = 272,
-        TOKEN_DHCP6_SERVER = 273,
-        TOKEN_D2_SERVER = 274,
-        TOKEN_CA_SERVER = 275,
-        TOKEN_MODEL = 276,
-        TOKEN_CONTROL_SOCKET = 277,
-        TOKEN_SOCKET_TYPE = 278,
-        TOKEN_UNIX = 279,
-        TOKEN_HTTP = 280,
-        TOKEN_STDOUT = 281,
-        TOKEN_SOCKET_NAME = 282,
-        TOKEN_SOCKET_URL = 283,
-        TOKEN_HOOKS_LIBRARIES = 284,
-        TOKEN_LIBRARY = 285,
-        TOKEN_PARAMETERS = 286,
-        TOKEN_LOGGING = 287,
-        TOKEN_LOGGERS = 288,
-        TOKEN_NAME = 289,
-        TOKEN_OUTPUT_OPTIONS = 290,
-        TOKEN_OUTPUT = 291,
-        TOKEN_DEBUGLEVEL = 292,
-        TOKEN_SEVERITY = 293,
-        TOKEN_FLUSH = 294,
-        TOKEN_MAXSIZE = 295,
-        TOKEN_MAXVER = 296,
-        TOKEN_START_JSON = 297,
-        TOKEN_START_NETCONF = 298,
-        TOKEN_START_SUB_NETCONF = 299,
-        TOKEN_STRING = 300,
-        TOKEN_INTEGER = 301,
-        TOKEN_FLOAT = 302,
-        TOKEN_BOOLEAN = 303
+      enum token_kind_type
+      {
+        TOKEN_NETCONF_EMPTY = -2,
+    TOKEN_END = 0,                 // "end of file"
+    TOKEN_NETCONF_error = 256,     // error
+    TOKEN_NETCONF_UNDEF = 257,     // "invalid token"
+    TOKEN_COMMA = 258,             // ","
+    TOKEN_COLON = 259,             // ":"
+    TOKEN_LSQUARE_BRACKET = 260,   // "["
+    TOKEN_RSQUARE_BRACKET = 261,   // "]"
+    TOKEN_LCURLY_BRACKET = 262,    // "{"
+    TOKEN_RCURLY_BRACKET = 263,    // "}"
+    TOKEN_NULL_TYPE = 264,         // "null"
+    TOKEN_NETCONF = 265,           // "Netconf"
+    TOKEN_USER_CONTEXT = 266,      // "user-context"
+    TOKEN_COMMENT = 267,           // "comment"
+    TOKEN_BOOT_UPDATE = 268,       // "boot-update"
+    TOKEN_SUBSCRIBE_CHANGES = 269, // "subscribe-changes"
+    TOKEN_VALIDATE_CHANGES = 270,  // "validate-changes"
+    TOKEN_MANAGED_SERVERS = 271,   // "managed-servers"
+    TOKEN_DHCP4_SERVER = 272,      // "dhcp4"
+    TOKEN_DHCP6_SERVER = 273,      // "dhcp6"
+    TOKEN_D2_SERVER = 274,         // "d2"
+    TOKEN_CA_SERVER = 275,         // "ca"
+    TOKEN_MODEL = 276,             // "model"
+    TOKEN_CONTROL_SOCKET = 277,    // "control-socket"
+    TOKEN_SOCKET_TYPE = 278,       // "socket-type"
+    TOKEN_UNIX = 279,              // "unix"
+    TOKEN_HTTP = 280,              // "http"
+    TOKEN_STDOUT = 281,            // "stdout"
+    TOKEN_SOCKET_NAME = 282,       // "socket-name"
+    TOKEN_SOCKET_URL = 283,        // "socket-url"
+    TOKEN_HOOKS_LIBRARIES = 284,   // "hooks-libraries"
+    TOKEN_LIBRARY = 285,           // "library"
+    TOKEN_PARAMETERS = 286,        // "parameters"
+    TOKEN_LOGGING = 287,           // "Logging"
+    TOKEN_LOGGERS = 288,           // "loggers"
+    TOKEN_NAME = 289,              // "name"
+    TOKEN_OUTPUT_OPTIONS = 290,    // "output_options"
+    TOKEN_OUTPUT = 291,            // "output"
+    TOKEN_DEBUGLEVEL = 292,        // "debuglevel"
+    TOKEN_RATE_LIMIT = 293,        // "rate-limit"
+    TOKEN_SEVERITY = 294,          // "severity"
+    TOKEN_FLUSH = 295,             // "flush"
+    TOKEN_MAXSIZE = 296,           // "maxsize"
+    TOKEN_MAXVER = 297,            // "maxver"
+    TOKEN_ASYNC = 298,             // "async"
+    TOKEN_QUEUE_SIZE = 299,        // "queue-size"
+    TOKEN_OVERFLOW_POLICY = 300,   // "overflow-policy"
+    TOKEN_START_JSON = 301,        // START_JSON
+    TOKEN_START_NETCONF = 302,     // START_NETCONF
+    TOKEN_START_SUB_NETCONF = 303, // START_SUB_NETCONF
+    TOKEN_STRING = 304,            // "constant string"
+    TOKEN_INTEGER = 305,           // "integer"
+    TOKEN_FLOAT = 306,             // "floating point"
+    TOKEN_BOOLEAN = 307            // "boolean"
       };
+      /// Backward compatibility alias (Bison 3.6).
+      typedef token_kind_type yytokentype;
     };
 
-    /// (External) token type, as returned by yylex.
-    typedef token::yytokentype token_type;
+    /// Token kind, as returned by yylex.
+    typedef token::token_kind_type token_kind_type;
 
-    /// Symbol type: an internal symbol number.
-    typedef int symbol_number_type;
+    /// Backward compatibility alias (Bison 3.6).
+    typedef token_kind_type token_type;
 
-    /// The symbol type number to denote an empty symbol.
-    enum { empty_symbol = -2 };
+    /// Symbol kinds.
+    struct symbol_kind
+    {
+      enum symbol_kind_type
+      {
+        YYNTOKENS = 53, ///< Number of tokens.
+        S_YYEMPTY = -2,
+        S_YYEOF = 0,                             // "end of file"
+        S_YYerror = 1,                           // error
+        S_YYUNDEF = 2,                           // "invalid token"
+        S_COMMA = 3,                             // ","
+        S_COLON = 4,                             // ":"
+        S_LSQUARE_BRACKET = 5,                   // "["
+        S_RSQUARE_BRACKET = 6,                   // "]"
+        S_LCURLY_BRACKET = 7,                    // "{"
+        S_RCURLY_BRACKET = 8,                    // "}"
+        S_NULL_TYPE = 9,                         // "null"
+        S_NETCONF = 10,                          // "Netconf"
+        S_USER_CONTEXT = 11,                     // "user-context"
+        S_COMMENT = 12,                          // "comment"
+        S_BOOT_UPDATE = 13,                      // "boot-update"
+        S_SUBSCRIBE_CHANGES = 14,                // "subscribe-changes"
+        S_VALIDATE_CHANGES = 15,                 // "validate-changes"
+        S_MANAGED_SERVERS = 16,                  // "managed-servers"
+        S_DHCP4_SERVER = 17,                     // "dhcp4"
+        S_DHCP6_SERVER = 18,                     // "dhcp6"
+        S_D2_SERVER = 19,                        // "d2"
+        S_CA_SERVER = 20,                        // "ca"
+        S_MODEL = 21,                            // "model"
+        S_CONTROL_SOCKET = 22,                   // "control-socket"
+        S_SOCKET_TYPE = 23,                      // "socket-type"
+        S_UNIX = 24,                             // "unix"
+        S_HTTP = 25,                             // "http"
+        S_STDOUT = 26,                           // "stdout"
+        S_SOCKET_NAME = 27,                      // "socket-name"
+        S_SOCKET_URL = 28,                       // "socket-url"
+        S_HOOKS_LIBRARIES = 29,                  // "hooks-libraries"
+        S_LIBRARY = 30,                          // "library"
+        S_PARAMETERS = 31,                       // "parameters"
+        S_LOGGING = 32,                          // "Logging"
+        S_LOGGERS = 33,                          // "loggers"
+        S_NAME = 34,                             // "name"
+        S_OUTPUT_OPTIONS = 35,                   // "output_options"
+        S_OUTPUT = 36,                           // "output"
+        S_DEBUGLEVEL = 37,                       // "debuglevel"
+        S_RATE_LIMIT = 38,                       // "rate-limit"
+        S_SEVERITY = 39,                         // "severity"
+        S_FLUSH = 40,                            // "flush"
+        S_MAXSIZE = 41,                          // "maxsize"
+        S_MAXVER = 42,                           // "maxver"
+        S_ASYNC = 43,                            // "async"
+        S_QUEUE_SIZE = 44,                       // "queue-size"
+        S_OVERFLOW_POLICY = 45,                  // "overflow-policy"
+        S_START_JSON = 46,                       // START_JSON
+        S_START_NETCONF = 47,                    // START_NETCONF
+        S_START_SUB_NETCONF = 48,                // START_SUB_NETCONF
+        S_STRING = 49,                           // "constant string"
+        S_INTEGER = 50,                          // "integer"
+        S_FLOAT = 51,                            // "floating point"
+        S_BOOLEAN = 52,                          // "boolean"
+        S_YYACCEPT = 53,                         // $accept
+        S_start = 54,                            // start
+        S_55_1 = 55,                             // $@1
+        S_56_2 = 56,                             // $@2
+        S_57_3 = 57,                             // $@3
+        S_sub_netconf = 58,                      // sub_netconf
+        S_59_4 = 59,                             // $@4
+        S_json = 60,                             // json
+        S_value = 61,                            // value
+        S_map = 62,                              // map
+        S_63_5 = 63,                             // $@5
+        S_map_value = 64,                        // map_value
+        S_map_content = 65,                      // map_content
+        S_not_empty_map = 66,                    // not_empty_map
+        S_list_generic = 67,                     // list_generic
+        S_68_6 = 68,                             // $@6
+        S_list_content = 69,                     // list_content
+        S_not_empty_list = 70,                   // not_empty_list
+        S_unknown_map_entry = 71,                // unknown_map_entry
+        S_netconf_syntax_map = 72,               // netconf_syntax_map
+        S_73_7 = 73,                             // $@7
+        S_global_objects = 74,                   // global_objects
+        S_global_object = 75,                    // global_object
+        S_netconf_object = 76,                   // netconf_object
+        S_77_8 = 77,                             // $@8
+        S_global_params = 78,                    // global_params
+        S_not_empty_global_params = 79,          // not_empty_global_params
+        S_global_param = 80,                     // global_param
+        S_boot_update = 81,                      // boot_update
+        S_subscribe_changes = 82,                // subscribe_changes
+        S_validate_changes = 83,                 // validate_changes
+        S_user_context = 84,                     // user_context
+        S_85_9 = 85,                             // $@9
+        S_comment = 86,                          // comment
+        S_87_10 = 87,                            // $@10
+        S_hooks_libraries = 88,                  // hooks_libraries
+        S_89_11 = 89,                            // $@11
+        S_hooks_libraries_list = 90,             // hooks_libraries_list
+        S_not_empty_hooks_libraries_list = 91,   // not_empty_hooks_libraries_list
+        S_hooks_library = 92,                    // hooks_library
+        S_93_12 = 93,                            // $@12
+        S_hooks_params = 94,                     // hooks_params
+        S_hooks_param = 95,                      // hooks_param
+        S_library = 96,                          // library
+        S_97_13 = 97,                            // $@13
+        S_parameters = 98,                       // parameters
+        S_99_14 = 99,                            // $@14
+        S_managed_servers = 100,                 // managed_servers
+        S_101_15 = 101,                          // $@15
+        S_servers_entries = 102,                 // servers_entries
+        S_not_empty_servers_entries = 103,       // not_empty_servers_entries
+        S_server_entry = 104,                    // server_entry
+        S_dhcp4_server = 105,                    // dhcp4_server
+        S_106_16 = 106,                          // $@16
+        S_dhcp6_server = 107,                    // dhcp6_server
+        S_108_17 = 108,                          // $@17
+        S_d2_server = 109,                       // d2_server
+        S_110_18 = 110,                          // $@18
+        S_ca_server = 111,                       // ca_server
+        S_112_19 = 112,                          // $@19
+        S_managed_server_params = 113,           // managed_server_params
+        S_managed_server_param = 114,            // managed_server_param
+        S_model = 115,                           // model
+        S_116_20 = 116,                          // $@20
+        S_control_socket = 117,                  // control_socket
+        S_118_21 = 118,                          // $@21
+        S_control_socket_params = 119,           // control_socket_params
+        S_control_socket_param = 120,            // control_socket_param
+        S_socket_type = 121,                     // socket_type
+        S_122_22 = 122,                          // $@22
+        S_socket_type_value = 123,               // socket_type_value
+        S_socket_name = 124,                     // socket_name
+        S_125_23 = 125,                          // $@23
+        S_socket_url = 126,                      // socket_url
+        S_127_24 = 127,                          // $@24
+        S_logging_object = 128,                  // logging_object
+        S_129_25 = 129,                          // $@25
+        S_logging_params = 130,                  // logging_params
+        S_logging_param = 131,                   // logging_param
+        S_loggers = 132,                         // loggers
+        S_133_26 = 133,                          // $@26
+        S_loggers_entries = 134,                 // loggers_entries
+        S_logger_entry = 135,                    // logger_entry
+        S_136_27 = 136,                          // $@27
+        S_logger_params = 137,                   // logger_params
+        S_logger_param = 138,                    // logger_param
+        S_name = 139,                            // name
+        S_140_28 = 140,                          // $@28
+        S_debuglevel = 141,                      // debuglevel
+        S_severity = 142,                        // severity
+        S_143_29 = 143,                          // $@29
+        S_rate_limit = 144,                      // rate_limit
+        S_145_30 = 145,                          // $@30
+        S_output_options_list = 146,             // output_options_list
+        S_147_31 = 147,                          // $@31
+        S_output_options_list_content = 148,     // output_options_list_content
+        S_output_entry = 149,                    // output_entry
+        S_150_32 = 150,                          // $@32
+        S_output_params_list = 151,              // output_params_list
+        S_output_params = 152,                   // output_params
+        S_output = 153,                          // output
+        S_154_33 = 154,                          // $@33
+        S_flush = 155,                           // flush
+        S_maxsize = 156,                         // maxsize
+        S_maxver = 157,                          // maxver
+        S_async = 158,                           // async
+        S_queue_size = 159,                      // queue_size
+        S_overflow_policy = 160,                 // overflow_policy
+        S_161_34 = 161                           // $@34
+      };
+    };
 
-    /// Internal symbol number for tokens (subsumed by symbol_number_type).
-    typedef unsigned char token_number_type;
+    /// (Internal) symbol kind.
+    typedef symbol_kind::symbol_kind_type symbol_kind_type;
+
+    /// The number of tokens.
+    static const symbol_kind_type YYNTOKENS = symbol_kind::YYNTOKENS;
 
     /// A complete symbol.
     ///
-    /// Expects its Base type to provide access to the symbol type
-    /// via type_get ().
+    /// Expects its Base type to provide access to the symbol kind
+    /// via kind ().
     ///
     /// Provide access to semantic value and location.
     template <typename Base>
@@ -611,59 +744,205 @@ namespace isc { namespace netconf {
       typedef Base super_type;
 
       /// Default constructor.
-      basic_symbol ();
+      basic_symbol () YY_NOEXCEPT
+        : value ()
+        , location ()
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      basic_symbol (basic_symbol&& that)
+        : Base (std::move (that))
+        , value ()
+        , location (std::move (that.location))
+      {
+        switch (this->kind ())
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.move< ElementPtr > (std::move (that.value));
+        break;
 
-      /// Move or copy constructor.
-      basic_symbol (YY_RVREF (basic_symbol) other);
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.move< bool > (std::move (that.value));
+        break;
 
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.move< double > (std::move (that.value));
+        break;
 
-      /// Constructor for valueless symbols, and symbols from each type.
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, location_type&& l);
-#else
-      basic_symbol (typename Base::kind_type t, const location_type& l);
+      case symbol_kind::S_INTEGER: // "integer"
+        value.move< int64_t > (std::move (that.value));
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.move< std::string > (std::move (that.value));
+        break;
+
+      default:
+        break;
+    }
+
+      }
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l);
+
+      /// Copy constructor.
+      basic_symbol (const basic_symbol& that);
+
+      /// Constructors for typed symbols.
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, location_type&& l)
+        : Base (t)
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const location_type& l)
+        : Base (t)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
-# if 201103L <= YY_CPLUSPLUS
-      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l);
+
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
 #else
-      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l);
+      basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
 #endif
 
+#if 201103L <= YY_CPLUSPLUS
+      basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
+        : Base (t)
+        , value (std::move (v))
+        , location (std::move (l))
+      {}
+#else
+      basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
+        : Base (t)
+        , value (v)
+        , location (l)
+      {}
+#endif
 
       /// Destroy the symbol.
-      ~basic_symbol ();
+      ~basic_symbol ()
+      {
+        clear ();
+      }
+
+
 
       /// Destroy contents, and record that is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT
+      {
+        // User destructor.
+        symbol_kind_type yykind = this->kind ();
+        basic_symbol<Base>& yysym = *this;
+        (void) yysym;
+        switch (yykind)
+        {
+       default:
+          break;
+        }
+
+        // Value type destructor.
+switch (yykind)
+    {
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.template destroy< ElementPtr > ();
+        break;
+
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.template destroy< bool > ();
+        break;
+
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.template destroy< double > ();
+        break;
+
+      case symbol_kind::S_INTEGER: // "integer"
+        value.template destroy< int64_t > ();
+        break;
+
+      case symbol_kind::S_STRING: // "constant string"
+        value.template destroy< std::string > ();
+        break;
+
+      default:
+        break;
+    }
+
+        Base::clear ();
+      }
+
+      /// The user-facing name of this symbol.
+      std::string name () const YY_NOEXCEPT
+      {
+        return NetconfParser::symbol_name (this->kind ());
+      }
+
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
       /// Whether empty.
-      bool empty () const;
+      bool empty () const YY_NOEXCEPT;
 
       /// Destructive move, \a s is emptied into this.
       void move (basic_symbol& s);
 
       /// The semantic value.
-      semantic_type value;
+      value_type value;
 
       /// The location.
       location_type location;
@@ -671,51 +950,137 @@ namespace isc { namespace netconf {
     private:
 #if YY_CPLUSPLUS < 201103L
       /// Assignment operator.
-      basic_symbol& operator= (const basic_symbol& other);
+      basic_symbol& operator= (const basic_symbol& that);
 #endif
     };
 
     /// Type access provider for token (enum) based symbols.
-    struct by_type
+    struct by_kind
     {
+      /// The symbol kind as needed by the constructor.
+      typedef token_kind_type kind_type;
+
       /// Default constructor.
-      by_type ();
+      by_kind () YY_NOEXCEPT;
 
-      /// Copy constructor.
-      by_type (const by_type& other);
+#if 201103L <= YY_CPLUSPLUS
+      /// Move constructor.
+      by_kind (by_kind&& that) YY_NOEXCEPT;
+#endif
 
-      /// The symbol type as needed by the constructor.
-      typedef token_type kind_type;
+      /// Copy constructor.
+      by_kind (const by_kind& that) YY_NOEXCEPT;
 
       /// Constructor from (external) token numbers.
-      by_type (kind_type t);
+      by_kind (kind_type t) YY_NOEXCEPT;
+
+
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
-      void move (by_type& that);
+      /// Steal the symbol kind from \a that.
+      void move (by_kind& that);
 
       /// The (internal) type number (corresponding to \a type).
       /// \a empty when empty.
-      symbol_number_type type_get () const;
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
-      /// The token.
-      token_type token () const;
+      /// Backward compatibility (Bison 3.6).
+      symbol_kind_type type_get () const YY_NOEXCEPT;
 
-      /// The symbol type.
-      /// \a empty_symbol when empty.
-      /// An int, not token_number_type, to be able to store empty_symbol.
-      int type;
+      /// The symbol kind.
+      /// \a S_YYEMPTY when empty.
+      symbol_kind_type kind_;
     };
 
+    /// Backward compatibility for a private implementation detail (Bison 3.6).
+    typedef by_kind by_type;
+
     /// "External" symbols: returned by the scanner.
-    typedef basic_symbol<by_type> symbol_type;
+    struct symbol_type : basic_symbol<by_kind>
+    {
+      /// Superclass.
+      typedef basic_symbol<by_kind> super_type;
+
+      /// Empty symbol.
+      symbol_type () YY_NOEXCEPT {}
+
+      /// Constructor for valueless symbols, and symbols from each type.
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, location_type l)
+        : super_type (token_kind_type (tok), std::move (l))
+#else
+      symbol_type (int tok, const location_type& l)
+        : super_type (token_kind_type (tok), l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        NETCONF__ASSERT (tok == token::TOKEN_END
+                   || (token::TOKEN_NETCONF_error <= tok && tok <= token::TOKEN_START_SUB_NETCONF));
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, bool v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const bool& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        NETCONF__ASSERT (tok == token::TOKEN_BOOLEAN);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, double v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const double& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        NETCONF__ASSERT (tok == token::TOKEN_FLOAT);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, int64_t v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const int64_t& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        NETCONF__ASSERT (tok == token::TOKEN_INTEGER);
+#endif
+      }
+#if 201103L <= YY_CPLUSPLUS
+      symbol_type (int tok, std::string v, location_type l)
+        : super_type (token_kind_type (tok), std::move (v), std::move (l))
+#else
+      symbol_type (int tok, const std::string& v, const location_type& l)
+        : super_type (token_kind_type (tok), v, l)
+#endif
+      {
+#if !defined _MSC_VER || defined __clang__
+        NETCONF__ASSERT (tok == token::TOKEN_STRING);
+#endif
+      }
+    };
 
     /// Build a parser object.
     NetconfParser (isc::netconf::ParserContext& ctx_yyarg);
     virtual ~NetconfParser ();
 
+#if 201103L <= YY_CPLUSPLUS
+    /// Non copyable.
+    NetconfParser (const NetconfParser&) = delete;
+    /// Non copyable.
+    NetconfParser& operator= (const NetconfParser&) = delete;
+#endif
+
     /// Parse.  An alias for parse ().
     /// \returns  0 iff parsing succeeded.
     int operator() ();
@@ -746,284 +1111,921 @@ namespace isc { namespace netconf {
     /// Report a syntax error.
     void error (const syntax_error& err);
 
-    // Symbol constructors declarations.
-    static
-    symbol_type
-    make_END (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COMMA (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COLON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LSQUARE_BRACKET (YY_COPY (location_type) l);
+    /// The user-facing name of the symbol whose (internal) number is
+    /// YYSYMBOL.  No bounds checking.
+    static std::string symbol_name (symbol_kind_type yysymbol);
 
-    static
-    symbol_type
-    make_RSQUARE_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LCURLY_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_RCURLY_BRACKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NULL_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NETCONF (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_USER_CONTEXT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_COMMENT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_BOOT_UPDATE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SUBSCRIBE_CHANGES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_VALIDATE_CHANGES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MANAGED_SERVERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP4_SERVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DHCP6_SERVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_D2_SERVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CA_SERVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MODEL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_CONTROL_SOCKET (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SOCKET_TYPE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_UNIX (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HTTP (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_STDOUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SOCKET_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SOCKET_URL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_HOOKS_LIBRARIES (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LIBRARY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_PARAMETERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LOGGING (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_LOGGERS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_NAME (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUTPUT_OPTIONS (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_OUTPUT (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_DEBUGLEVEL (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_SEVERITY (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_FLUSH (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAXSIZE (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_MAXVER (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_START_JSON (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_START_NETCONF (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_START_SUB_NETCONF (YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_STRING (YY_COPY (std::string) v, YY_COPY (location_type) l);
-
-    static
-    symbol_type
-    make_INTEGER (YY_COPY (int64_t) v, YY_COPY (location_type) l);
+    // Implementation of make_symbol for each token kind.
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_END (location_type l)
+      {
+        return symbol_type (token::TOKEN_END, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_END (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_END, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NETCONF_error (location_type l)
+      {
+        return symbol_type (token::TOKEN_NETCONF_error, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NETCONF_error (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NETCONF_error, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NETCONF_UNDEF (location_type l)
+      {
+        return symbol_type (token::TOKEN_NETCONF_UNDEF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NETCONF_UNDEF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NETCONF_UNDEF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMA (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMA, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMA (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMA, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COLON (location_type l)
+      {
+        return symbol_type (token::TOKEN_COLON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COLON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COLON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RSQUARE_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RSQUARE_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RCURLY_BRACKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RCURLY_BRACKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RCURLY_BRACKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NULL_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NULL_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NULL_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NETCONF (location_type l)
+      {
+        return symbol_type (token::TOKEN_NETCONF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NETCONF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NETCONF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_USER_CONTEXT (location_type l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_USER_CONTEXT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_USER_CONTEXT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_COMMENT (location_type l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_COMMENT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_COMMENT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOT_UPDATE (location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOT_UPDATE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOT_UPDATE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOT_UPDATE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SUBSCRIBE_CHANGES (location_type l)
+      {
+        return symbol_type (token::TOKEN_SUBSCRIBE_CHANGES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SUBSCRIBE_CHANGES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SUBSCRIBE_CHANGES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_VALIDATE_CHANGES (location_type l)
+      {
+        return symbol_type (token::TOKEN_VALIDATE_CHANGES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_VALIDATE_CHANGES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_VALIDATE_CHANGES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MANAGED_SERVERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_MANAGED_SERVERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MANAGED_SERVERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MANAGED_SERVERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP4_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP4_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP4_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP4_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DHCP6_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_DHCP6_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DHCP6_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DHCP6_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_D2_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_D2_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_D2_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_D2_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CA_SERVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_CA_SERVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CA_SERVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CA_SERVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MODEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_MODEL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MODEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MODEL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_CONTROL_SOCKET (location_type l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_CONTROL_SOCKET (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_CONTROL_SOCKET, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_TYPE (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_TYPE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_TYPE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_UNIX (location_type l)
+      {
+        return symbol_type (token::TOKEN_UNIX, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_UNIX (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_UNIX, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HTTP (location_type l)
+      {
+        return symbol_type (token::TOKEN_HTTP, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HTTP (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HTTP, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STDOUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_STDOUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STDOUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STDOUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SOCKET_URL (location_type l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_URL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SOCKET_URL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SOCKET_URL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (location_type l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_HOOKS_LIBRARIES (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_HOOKS_LIBRARIES, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LIBRARY (location_type l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LIBRARY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LIBRARY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_PARAMETERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_PARAMETERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_PARAMETERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGING (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGING (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGING, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_LOGGERS (location_type l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_LOGGERS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_LOGGERS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_NAME (location_type l)
+      {
+        return symbol_type (token::TOKEN_NAME, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_NAME (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_NAME, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT_OPTIONS (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT_OPTIONS, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OUTPUT (location_type l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OUTPUT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OUTPUT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_DEBUGLEVEL (location_type l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_DEBUGLEVEL (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_DEBUGLEVEL, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_RATE_LIMIT (location_type l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_RATE_LIMIT (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_RATE_LIMIT, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_SEVERITY (location_type l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_SEVERITY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_SEVERITY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLUSH (location_type l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLUSH (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLUSH, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAXSIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAXSIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXSIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_MAXVER (location_type l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_MAXVER (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_MAXVER, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_ASYNC (location_type l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_ASYNC (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_ASYNC, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_QUEUE_SIZE (location_type l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_QUEUE_SIZE (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (location_type l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_OVERFLOW_POLICY (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_START_JSON (location_type l)
+      {
+        return symbol_type (token::TOKEN_START_JSON, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_START_JSON (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_START_JSON, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_START_NETCONF (location_type l)
+      {
+        return symbol_type (token::TOKEN_START_NETCONF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_START_NETCONF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_START_NETCONF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_START_SUB_NETCONF (location_type l)
+      {
+        return symbol_type (token::TOKEN_START_SUB_NETCONF, std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_START_SUB_NETCONF (const location_type& l)
+      {
+        return symbol_type (token::TOKEN_START_SUB_NETCONF, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_STRING (std::string v, location_type l)
+      {
+        return symbol_type (token::TOKEN_STRING, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_STRING (const std::string& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_STRING, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_INTEGER (int64_t v, location_type l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_INTEGER (const int64_t& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_INTEGER, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_FLOAT (double v, location_type l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_FLOAT (const double& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_FLOAT, v, l);
+      }
+#endif
+#if 201103L <= YY_CPLUSPLUS
+      static
+      symbol_type
+      make_BOOLEAN (bool v, location_type l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, std::move (v), std::move (l));
+      }
+#else
+      static
+      symbol_type
+      make_BOOLEAN (const bool& v, const location_type& l)
+      {
+        return symbol_type (token::TOKEN_BOOLEAN, v, l);
+      }
+#endif
 
-    static
-    symbol_type
-    make_FLOAT (YY_COPY (double) v, YY_COPY (location_type) l);
 
-    static
-    symbol_type
-    make_BOOLEAN (YY_COPY (bool) v, YY_COPY (location_type) l);
+    class context
+    {
+    public:
+      context (const NetconfParser& yyparser, const symbol_type& yyla);
+      const symbol_type& lookahead () const YY_NOEXCEPT { return yyla_; }
+      symbol_kind_type token () const YY_NOEXCEPT { return yyla_.kind (); }
+      const location_type& location () const YY_NOEXCEPT { return yyla_.location; }
 
+      /// Put in YYARG at most YYARGN of the expected tokens, and return the
+      /// number of tokens stored in YYARG.  If YYARG is null, return the
+      /// number of expected tokens (guaranteed to be less than YYNTOKENS).
+      int expected_tokens (symbol_kind_type yyarg[], int yyargn) const;
 
+    private:
+      const NetconfParser& yyparser_;
+      const symbol_type& yyla_;
+    };
 
   private:
-    /// This class is not copyable.
+#if YY_CPLUSPLUS < 201103L
+    /// Non copyable.
     NetconfParser (const NetconfParser&);
+    /// Non copyable.
     NetconfParser& operator= (const NetconfParser&);
+#endif
 
-    /// State numbers.
-    typedef int state_type;
 
-    /// Generate an error message.
-    /// \param yystate   the state where the error occurred.
-    /// \param yyla      the lookahead token.
-    virtual std::string yysyntax_error_ (state_type yystate,
-                                         const symbol_type& yyla) const;
+    /// Stored state numbers (used for stacks).
+    typedef short state_type;
 
+    /// The arguments of the error message.
+    int yy_syntax_error_arguments_ (const context& yyctx,
+                                    symbol_kind_type yyarg[], int yyargn) const;
+
+    /// Generate an error message.
+    /// \param yyctx     the context in which the error occurred.
+    virtual std::string yysyntax_error_ (const context& yyctx) const;
     /// Compute post-reduction state.
     /// \param yystate   the current state
     /// \param yysym     the nonterminal to push on the stack
-    state_type yy_lr_goto_state_ (state_type yystate, int yysym);
+    static state_type yy_lr_goto_state_ (state_type yystate, int yysym);
 
     /// Whether the given \c yypact_ value indicates a defaulted state.
     /// \param yyvalue   the value to check
-    static bool yy_pact_value_is_default_ (int yyvalue);
+    static bool yy_pact_value_is_default_ (int yyvalue) YY_NOEXCEPT;
 
     /// Whether the given \c yytable_ value indicates a syntax error.
     /// \param yyvalue   the value to check
-    static bool yy_table_value_is_error_ (int yyvalue);
+    static bool yy_table_value_is_error_ (int yyvalue) YY_NOEXCEPT;
 
     static const signed char yypact_ninf_;
     static const signed char yytable_ninf_;
 
-    /// Convert a scanner token number \a t to a symbol number.
-    static token_number_type yytranslate_ (token_type t);
+    /// Convert a scanner token kind \a t to a symbol kind.
+    /// In theory \a t should be a token_kind_type, but character literals
+    /// are valid, yet not members of the token_kind_type enum.
+    static symbol_kind_type yytranslate_ (int t) YY_NOEXCEPT;
 
-    // Tables.
-  // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-  // STATE-NUM.
-  static const short yypact_[];
+    /// Convert the symbol name \a n to a form suitable for a diagnostic.
+    static std::string yytnamerr_ (const char *yystr);
+
+    /// For a symbol, its name in clear.
+    static const char* const yytname_[];
 
-  // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-  // Performed when YYTABLE does not specify something else to do.  Zero
-  // means the default is an error.
-  static const unsigned char yydefact_[];
 
-  // YYPGOTO[NTERM-NUM].
-  static const short yypgoto_[];
+    // Tables.
+    // YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+    // STATE-NUM.
+    static const short yypact_[];
 
-  // YYDEFGOTO[NTERM-NUM].
-  static const short yydefgoto_[];
+    // YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+    // Performed when YYTABLE does not specify something else to do.  Zero
+    // means the default is an error.
+    static const unsigned char yydefact_[];
 
-  // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-  // positive, shift that token.  If negative, reduce the rule whose
-  // number is the opposite.  If YYTABLE_NINF, syntax error.
-  static const unsigned short yytable_[];
+    // YYPGOTO[NTERM-NUM].
+    static const short yypgoto_[];
 
-  static const short yycheck_[];
+    // YYDEFGOTO[NTERM-NUM].
+    static const short yydefgoto_[];
 
-  // YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-  // symbol of state STATE-NUM.
-  static const unsigned char yystos_[];
+    // YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+    // positive, shift that token.  If negative, reduce the rule whose
+    // number is the opposite.  If YYTABLE_NINF, syntax error.
+    static const short yytable_[];
 
-  // YYR1[YYN] -- Symbol number of symbol that rule YYN derives.
-  static const unsigned char yyr1_[];
+    static const short yycheck_[];
 
-  // YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.
-  static const unsigned char yyr2_[];
+    // YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+    // state STATE-NUM.
+    static const unsigned char yystos_[];
 
+    // YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.
+    static const unsigned char yyr1_[];
 
-    /// Convert the symbol name \a n to a form suitable for a diagnostic.
-    static std::string yytnamerr_ (const char *n);
+    // YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.
+    static const signed char yyr2_[];
 
 
-    /// For a symbol, its name in clear.
-    static const char* const yytname_[];
 #if NETCONF_DEBUG
-  // YYRLINE[YYN] -- Source line where rule number YYN was defined.
-  static const unsigned short yyrline_[];
+    // YYRLINE[YYN] -- Source line where rule number YYN was defined.
+    static const short yyrline_[];
     /// Report on the debug stream that the rule \a r is going to be reduced.
-    virtual void yy_reduce_print_ (int r);
+    virtual void yy_reduce_print_ (int r) const;
     /// Print the state stack on the debug stream.
-    virtual void yystack_print_ ();
+    virtual void yy_stack_print_ () const;
 
     /// Debugging level.
     int yydebug_;
     /// Debug stream.
     std::ostream* yycdebug_;
 
-    /// \brief Display a symbol type, value and location.
+    /// \brief Display a symbol kind, value and location.
     /// \param yyo    The output stream.
     /// \param yysym  The symbol.
     template <typename Base>
@@ -1042,29 +2044,30 @@ namespace isc { namespace netconf {
     struct by_state
     {
       /// Default constructor.
-      by_state ();
+      by_state () YY_NOEXCEPT;
 
-      /// The symbol type as needed by the constructor.
+      /// The symbol kind as needed by the constructor.
       typedef state_type kind_type;
 
       /// Constructor.
-      by_state (kind_type s);
+      by_state (kind_type s) YY_NOEXCEPT;
 
       /// Copy constructor.
-      by_state (const by_state& other);
+      by_state (const by_state& that) YY_NOEXCEPT;
 
       /// Record that this symbol is empty.
-      void clear ();
+      void clear () YY_NOEXCEPT;
 
-      /// Steal the symbol type from \a that.
+      /// Steal the symbol kind from \a that.
       void move (by_state& that);
 
-      /// The (internal) type number (corresponding to \a state).
-      /// \a empty_symbol when empty.
-      symbol_number_type type_get () const;
+      /// The symbol kind (corresponding to \a state).
+      /// \a symbol_kind::S_YYEMPTY when empty.
+      symbol_kind_type kind () const YY_NOEXCEPT;
 
       /// The state number used to denote an empty symbol.
-      enum { empty_state = -1 };
+      /// We use the initial state, as it does not have a value.
+      enum { empty_state = 0 };
 
       /// The state.
       /// \a empty when empty.
@@ -1086,9 +2089,131 @@ namespace isc { namespace netconf {
       /// Assignment, needed by push_back by some old implementations.
       /// Moves the contents of that.
       stack_symbol_type& operator= (stack_symbol_type& that);
+
+      /// Assignment, needed by push_back by other implementations.
+      /// Needed by some other old implementations.
+      stack_symbol_type& operator= (const stack_symbol_type& that);
+#endif
+    };
+
+    /// A stack with random access from its top.
+    template <typename T, typename S = std::vector<T> >
+    class stack
+    {
+    public:
+      // Hide our reversed order.
+      typedef typename S::iterator iterator;
+      typedef typename S::const_iterator const_iterator;
+      typedef typename S::size_type size_type;
+      typedef typename std::ptrdiff_t index_type;
+
+      stack (size_type n = 200) YY_NOEXCEPT
+        : seq_ (n)
+      {}
+
+#if 201103L <= YY_CPLUSPLUS
+      /// Non copyable.
+      stack (const stack&) = delete;
+      /// Non copyable.
+      stack& operator= (const stack&) = delete;
+#endif
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      const T&
+      operator[] (index_type i) const
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Random access.
+      ///
+      /// Index 0 returns the topmost element.
+      T&
+      operator[] (index_type i)
+      {
+        return seq_[size_type (size () - 1 - i)];
+      }
+
+      /// Steal the contents of \a t.
+      ///
+      /// Close to move-semantics.
+      void
+      push (YY_MOVE_REF (T) t)
+      {
+        seq_.push_back (T ());
+        operator[] (0).move (t);
+      }
+
+      /// Pop elements from the stack.
+      void
+      pop (std::ptrdiff_t n = 1) YY_NOEXCEPT
+      {
+        for (; 0 < n; --n)
+          seq_.pop_back ();
+      }
+
+      /// Pop all elements from the stack.
+      void
+      clear () YY_NOEXCEPT
+      {
+        seq_.clear ();
+      }
+
+      /// Number of elements on the stack.
+      index_type
+      size () const YY_NOEXCEPT
+      {
+        return index_type (seq_.size ());
+      }
+
+      /// Iterator on top of the stack (going downwards).
+      const_iterator
+      begin () const YY_NOEXCEPT
+      {
+        return seq_.begin ();
+      }
+
+      /// Bottom of the stack.
+      const_iterator
+      end () const YY_NOEXCEPT
+      {
+        return seq_.end ();
+      }
+
+      /// Present a slice of the top of a stack.
+      class slice
+      {
+      public:
+        slice (const stack& stack, index_type range) YY_NOEXCEPT
+          : stack_ (stack)
+          , range_ (range)
+        {}
+
+        const T&
+        operator[] (index_type i) const
+        {
+          return stack_[range_ - i];
+        }
+
+      private:
+        const stack& stack_;
+        index_type range_;
+      };
+
+    private:
+#if YY_CPLUSPLUS < 201103L
+      /// Non copyable.
+      stack (const stack&);
+      /// Non copyable.
+      stack& operator= (const stack&);
 #endif
+      /// The wrapped container.
+      S seq_;
     };
 
+
     /// Stack type.
     typedef stack<stack_symbol_type> stack_type;
 
@@ -1111,275 +2236,128 @@ namespace isc { namespace netconf {
     void yypush_ (const char* m, state_type s, YY_MOVE_REF (symbol_type) sym);
 
     /// Pop \a n symbols from the stack.
-    void yypop_ (int n = 1);
+    void yypop_ (int n = 1) YY_NOEXCEPT;
 
     /// Constants.
     enum
     {
-      yyeof_ = 0,
-      yylast_ = 238,     ///< Last index in yytable_.
-      yynnts_ = 103,  ///< Number of nonterminal symbols.
-      yyfinal_ = 8, ///< Termination state number.
-      yyterror_ = 1,
-      yyerrcode_ = 256,
-      yyntokens_ = 49  ///< Number of tokens.
-    };
-
-
-    // User arguments.
-    isc::netconf::ParserContext& ctx;
-  };
-
-  // Symbol number corresponding to token number t.
-  inline
-  NetconfParser::token_number_type
-  NetconfParser::yytranslate_ (token_type t)
-  {
-    static
-    const token_number_type
-    translate_table[] =
-    {
-     0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
-       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
-      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48
+      yylast_ = 249,     ///< Last index in yytable_.
+      yynnts_ = 109,  ///< Number of nonterminal symbols.
+      yyfinal_ = 8 ///< Termination state number.
     };
-    const unsigned user_token_number_max_ = 303;
-    const token_number_type undef_token_ = 2;
-
-    if (static_cast<int> (t) <= yyeof_)
-      return yyeof_;
-    else if (static_cast<unsigned> (t) <= user_token_number_max_)
-      return translate_table[t];
-    else
-      return undef_token_;
-  }
-
-  inline
-  NetconfParser::syntax_error::syntax_error (const location_type& l, const std::string& m)
-    : std::runtime_error (m)
-    , location (l)
-  {}
-
-  // basic_symbol.
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol ()
-    : value ()
-    , location ()
-  {}
-
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (YY_RVREF (basic_symbol) other)
-    : Base (YY_MOVE (other))
-    , value ()
-    , location (YY_MOVE (other.location))
-  {
-    switch (other.type_get ())
-    {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
-        value.YY_MOVE_OR_COPY< ElementPtr > (YY_MOVE (other.value));
-        break;
-
-      case 48: // "boolean"
-        value.YY_MOVE_OR_COPY< bool > (YY_MOVE (other.value));
-        break;
-
-      case 47: // "floating point"
-        value.YY_MOVE_OR_COPY< double > (YY_MOVE (other.value));
-        break;
-
-      case 46: // "integer"
-        value.YY_MOVE_OR_COPY< int64_t > (YY_MOVE (other.value));
-        break;
-
-      case 45: // "constant string"
-        value.YY_MOVE_OR_COPY< std::string > (YY_MOVE (other.value));
-        break;
-
-      default:
-        break;
-    }
-
-  }
-
-
-  // Implementation of basic_symbol constructor for each type.
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, location_type&& l)
-    : Base (t)
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const location_type& l)
-    : Base (t)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, ElementPtr&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const ElementPtr& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, bool&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const bool& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, double&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const double& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, int64_t&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const int64_t& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
-# if 201103L <= YY_CPLUSPLUS
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, std::string&& v, location_type&& l)
-    : Base (t)
-    , value (std::move (v))
-    , location (std::move (l))
-  {}
-#else
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::basic_symbol (typename Base::kind_type t, const std::string& v, const location_type& l)
-    : Base (t)
-    , value (v)
-    , location (l)
-  {}
-#endif
 
 
-  template <typename Base>
-  NetconfParser::basic_symbol<Base>::~basic_symbol ()
+    // User arguments.
+    isc::netconf::ParserContext& ctx;
+
+  };
+
+  inline
+  NetconfParser::symbol_kind_type
+  NetconfParser::yytranslate_ (int t) YY_NOEXCEPT
   {
-    clear ();
+    // YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to
+    // TOKEN-NUM as returned by yylex.
+    static
+    const signed char
+    translate_table[] =
+    {
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46,    47,    48,    49,    50,    51,    52
+    };
+    // Last valid token kind.
+    const int code_max = 307;
+
+    if (t <= 0)
+      return symbol_kind::S_YYEOF;
+    else if (t <= code_max)
+      return static_cast <symbol_kind_type> (translate_table[t]);
+    else
+      return symbol_kind::S_YYUNDEF;
   }
 
+  // basic_symbol.
   template <typename Base>
-  void
-  NetconfParser::basic_symbol<Base>::clear ()
+  NetconfParser::basic_symbol<Base>::basic_symbol (const basic_symbol& that)
+    : Base (that)
+    , value ()
+    , location (that.location)
   {
-    // User destructor.
-    symbol_number_type yytype = this->type_get ();
-    basic_symbol<Base>& yysym = *this;
-    (void) yysym;
-    switch (yytype)
-    {
-   default:
-      break;
-    }
-
-    // Type destructor.
-  switch (yytype)
+    switch (this->kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
-        value.template destroy< ElementPtr > ();
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
+        value.copy< ElementPtr > (YY_MOVE (that.value));
         break;
 
-      case 48: // "boolean"
-        value.template destroy< bool > ();
+      case symbol_kind::S_BOOLEAN: // "boolean"
+        value.copy< bool > (YY_MOVE (that.value));
         break;
 
-      case 47: // "floating point"
-        value.template destroy< double > ();
+      case symbol_kind::S_FLOAT: // "floating point"
+        value.copy< double > (YY_MOVE (that.value));
         break;
 
-      case 46: // "integer"
-        value.template destroy< int64_t > ();
+      case symbol_kind::S_INTEGER: // "integer"
+        value.copy< int64_t > (YY_MOVE (that.value));
         break;
 
-      case 45: // "constant string"
-        value.template destroy< std::string > ();
+      case symbol_kind::S_STRING: // "constant string"
+        value.copy< std::string > (YY_MOVE (that.value));
         break;
 
       default:
         break;
     }
 
-    Base::clear ();
   }
 
+
+
+
+  template <typename Base>
+  NetconfParser::symbol_kind_type
+  NetconfParser::basic_symbol<Base>::type_get () const YY_NOEXCEPT
+  {
+    return this->kind ();
+  }
+
+
   template <typename Base>
   bool
-  NetconfParser::basic_symbol<Base>::empty () const
+  NetconfParser::basic_symbol<Base>::empty () const YY_NOEXCEPT
   {
-    return Base::type_get () == empty_symbol;
+    return this->kind () == symbol_kind::S_YYEMPTY;
   }
 
   template <typename Base>
@@ -1387,27 +2365,27 @@ namespace isc { namespace netconf {
   NetconfParser::basic_symbol<Base>::move (basic_symbol& s)
   {
     super_type::move (s);
-    switch (this->type_get ())
+    switch (this->kind ())
     {
-      case 57: // value
-      case 60: // map_value
-      case 119: // socket_type_value
+      case symbol_kind::S_value: // value
+      case symbol_kind::S_map_value: // map_value
+      case symbol_kind::S_socket_type_value: // socket_type_value
         value.move< ElementPtr > (YY_MOVE (s.value));
         break;
 
-      case 48: // "boolean"
+      case symbol_kind::S_BOOLEAN: // "boolean"
         value.move< bool > (YY_MOVE (s.value));
         break;
 
-      case 47: // "floating point"
+      case symbol_kind::S_FLOAT: // "floating point"
         value.move< double > (YY_MOVE (s.value));
         break;
 
-      case 46: // "integer"
+      case symbol_kind::S_INTEGER: // "integer"
         value.move< int64_t > (YY_MOVE (s.value));
         break;
 
-      case 45: // "constant string"
+      case symbol_kind::S_STRING: // "constant string"
         value.move< std::string > (YY_MOVE (s.value));
         break;
 
@@ -1418,397 +2396,67 @@ namespace isc { namespace netconf {
     location = YY_MOVE (s.location);
   }
 
-  // by_type.
-  inline
-  NetconfParser::by_type::by_type ()
-    : type (empty_symbol)
-  {}
-
+  // by_kind.
   inline
-  NetconfParser::by_type::by_type (const by_type& other)
-    : type (other.type)
+  NetconfParser::by_kind::by_kind () YY_NOEXCEPT
+    : kind_ (symbol_kind::S_YYEMPTY)
   {}
 
+#if 201103L <= YY_CPLUSPLUS
   inline
-  NetconfParser::by_type::by_type (token_type t)
-    : type (yytranslate_ (t))
-  {}
-
-  inline
-  void
-  NetconfParser::by_type::clear ()
-  {
-    type = empty_symbol;
-  }
-
-  inline
-  void
-  NetconfParser::by_type::move (by_type& that)
+  NetconfParser::by_kind::by_kind (by_kind&& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
   {
-    type = that.type;
     that.clear ();
   }
+#endif
 
   inline
-  int
-  NetconfParser::by_type::type_get () const
-  {
-    return type;
-  }
-
-  inline
-  NetconfParser::token_type
-  NetconfParser::by_type::token () const
-  {
-    // YYTOKNUM[NUM] -- (External) token number corresponding to the
-    // (internal) symbol number NUM (which must be that of a token).  */
-    static
-    const unsigned short
-    yytoken_number_[] =
-    {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303
-    };
-    return static_cast<token_type> (yytoken_number_[type]);
-  }
-
-  // Implementation of make_symbol for each symbol type.
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_END (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_END, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_COMMA (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COMMA, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_COLON (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COLON, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_LSQUARE_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LSQUARE_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_RSQUARE_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RSQUARE_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_LCURLY_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LCURLY_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_RCURLY_BRACKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_RCURLY_BRACKET, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_NULL_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NULL_TYPE, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_NETCONF (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NETCONF, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_USER_CONTEXT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_USER_CONTEXT, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_COMMENT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_COMMENT, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_BOOT_UPDATE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_BOOT_UPDATE, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_SUBSCRIBE_CHANGES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SUBSCRIBE_CHANGES, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_VALIDATE_CHANGES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_VALIDATE_CHANGES, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_MANAGED_SERVERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MANAGED_SERVERS, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_DHCP4_SERVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP4_SERVER, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_DHCP6_SERVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DHCP6_SERVER, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_D2_SERVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_D2_SERVER, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_CA_SERVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CA_SERVER, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_MODEL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MODEL, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_CONTROL_SOCKET (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_CONTROL_SOCKET, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_SOCKET_TYPE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_TYPE, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_UNIX (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_UNIX, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_HTTP (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HTTP, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_STDOUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_STDOUT, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_SOCKET_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_NAME, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_SOCKET_URL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SOCKET_URL, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_HOOKS_LIBRARIES (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_HOOKS_LIBRARIES, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_LIBRARY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LIBRARY, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_PARAMETERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_PARAMETERS, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_LOGGING (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LOGGING, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_LOGGERS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_LOGGERS, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_NAME (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_NAME, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_OUTPUT_OPTIONS (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT_OPTIONS, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_OUTPUT (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_OUTPUT, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_DEBUGLEVEL (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_DEBUGLEVEL, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_SEVERITY (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_SEVERITY, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_FLUSH (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLUSH, YY_MOVE (l));
-  }
-
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_MAXSIZE (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAXSIZE, YY_MOVE (l));
-  }
+  NetconfParser::by_kind::by_kind (const by_kind& that) YY_NOEXCEPT
+    : kind_ (that.kind_)
+  {}
 
   inline
-  NetconfParser::symbol_type
-  NetconfParser::make_MAXVER (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_MAXVER, YY_MOVE (l));
-  }
+  NetconfParser::by_kind::by_kind (token_kind_type t) YY_NOEXCEPT
+    : kind_ (yytranslate_ (t))
+  {}
 
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_START_JSON (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_START_JSON, YY_MOVE (l));
-  }
 
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_START_NETCONF (YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_START_NETCONF, YY_MOVE (l));
-  }
 
   inline
-  NetconfParser::symbol_type
-  NetconfParser::make_START_SUB_NETCONF (YY_COPY (location_type) l)
+  void
+  NetconfParser::by_kind::clear () YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_START_SUB_NETCONF, YY_MOVE (l));
+    kind_ = symbol_kind::S_YYEMPTY;
   }
 
   inline
-  NetconfParser::symbol_type
-  NetconfParser::make_STRING (YY_COPY (std::string) v, YY_COPY (location_type) l)
+  void
+  NetconfParser::by_kind::move (by_kind& that)
   {
-    return symbol_type (token::TOKEN_STRING, YY_MOVE (v), YY_MOVE (l));
+    kind_ = that.kind_;
+    that.clear ();
   }
 
   inline
-  NetconfParser::symbol_type
-  NetconfParser::make_INTEGER (YY_COPY (int64_t) v, YY_COPY (location_type) l)
+  NetconfParser::symbol_kind_type
+  NetconfParser::by_kind::kind () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_INTEGER, YY_MOVE (v), YY_MOVE (l));
+    return kind_;
   }
 
-  inline
-  NetconfParser::symbol_type
-  NetconfParser::make_FLOAT (YY_COPY (double) v, YY_COPY (location_type) l)
-  {
-    return symbol_type (token::TOKEN_FLOAT, YY_MOVE (v), YY_MOVE (l));
-  }
 
   inline
-  NetconfParser::symbol_type
-  NetconfParser::make_BOOLEAN (YY_COPY (bool) v, YY_COPY (location_type) l)
+  NetconfParser::symbol_kind_type
+  NetconfParser::by_kind::type_get () const YY_NOEXCEPT
   {
-    return symbol_type (token::TOKEN_BOOLEAN, YY_MOVE (v), YY_MOVE (l));
+    return this->kind ();
   }
 
 
-#line 14 "netconf_parser.yy" // lalr1.cc:404
+#line 14 "netconf_parser.yy"
 } } // isc::netconf
-#line 1812 "netconf_parser.h" // lalr1.cc:404
+#line 2460 "netconf_parser.h"
 
 
 
@@ -81,10 +81,14 @@ using namespace std;
   OUTPUT_OPTIONS "output_options"
   OUTPUT "output"
   DEBUGLEVEL "debuglevel"
+  RATE_LIMIT "rate-limit"
   SEVERITY "severity"
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow-policy"
 
   // Not real tokens, just a way to signal what the parser is expected to
   // parse. This define the starting point. It either can be full grammar
@@ -615,6 +619,7 @@ logger_params: logger_param
 logger_param: name
             | output_options_list
             | debuglevel
+            | rate_limit
             | severity
             | user_context
             | comment
@@ -642,6 +647,14 @@ severity: SEVERITY {
     ctx.leave();
 };
 
+rate_limit: RATE_LIMIT {
+    ctx.enter(ctx.NO_KEYWORDS);
+} COLON STRING {
+    ElementPtr rl(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("rate-limit", rl);
+    ctx.leave();
+};
+
 output_options_list: OUTPUT_OPTIONS {
     ElementPtr l(new ListElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("output_options", l);
@@ -672,6 +685,9 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | queue_size
+             | overflow_policy
              ;
 
 output: OUTPUT {
@@ -697,6 +713,24 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr size(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", size);
+};
+
+overflow_policy: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORDS);
+} COLON STRING {
+    ElementPtr policy(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+};
+
 %%
 
 void
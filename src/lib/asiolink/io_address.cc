@@ -1,4 +1,4 @@
-// Copyright (C) 2010-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2010-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,11 +11,13 @@
 #include <exceptions/exceptions.h>
 
 #include <boost/static_assert.hpp>
+#include <boost/functional/hash.hpp>
 
 #include <unistd.h>             // for some IPC/network system calls
 #include <stdint.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
+#include <algorithm>
 
 using namespace boost::asio;
 using boost::asio::ip::udp;
@@ -82,6 +84,21 @@ IOAddress::toBytes() const {
     return (std::vector<uint8_t>(bytes6.begin(), bytes6.end()));
 }
 
+size_t
+IOAddress::toBytes(uint8_t* data) const {
+    if (asio_address_.is_v4()) {
+        const boost::asio::ip::address_v4::bytes_type bytes4 =
+            asio_address_.to_v4().to_bytes();
+        std::copy(bytes4.begin(), bytes4.end(), data);
+        return (bytes4.size());
+    }
+
+    const boost::asio::ip::address_v6::bytes_type bytes6 =
+        asio_address_.to_v6().to_bytes();
+    std::copy(bytes6.begin(), bytes6.end(), data);
+    return (bytes6.size());
+}
+
 short
 IOAddress::getFamily() const {
     if (asio_address_.is_v4()) {
@@ -157,6 +174,16 @@ IOAddress::subtract(const IOAddress& a, const IOAddress& b) {
     }
 }
 
+size_t
+hash_value(const IOAddress& address) {
+    if (address.isV4()) {
+        return (boost::hash_value(address.toUint32()));
+    }
+    // For IPv6 addresses hash the 16 bytes of the address.
+    const std::vector<uint8_t> bytes(address.toBytes());
+    return (boost::hash_range(bytes.begin(), bytes.end()));
+}
+
 IOAddress
 IOAddress::increase(const IOAddress& addr) {
     std::vector<uint8_t> packed(addr.toBytes());
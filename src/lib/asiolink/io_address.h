@@ -1,4 +1,4 @@
-// Copyright (C) 2010-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2010-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -157,6 +157,17 @@ public:
     ///         order.
     std::vector<uint8_t> toBytes() const;
 
+    /// \brief Write address as set of bytes
+    ///
+    /// This variant writes the address into a buffer supplied by the
+    /// caller, so no vector is allocated.
+    ///
+    /// \param [out] data Buffer of at least V4ADDRESS_LEN bytes for an
+    ///        IPv4 address or V6ADDRESS_LEN bytes for an IPv6 address.
+    ///
+    /// \return Number of bytes written in network-byte order.
+    size_t toBytes(uint8_t* data) const;
+
     /// \brief Compare addresses for equality
     ///
     /// \param other Address to compare against.
@@ -339,6 +350,17 @@ private:
 std::ostream&
 operator<<(std::ostream& os, const IOAddress& address);
 
+/// \brief Hash the IOAddress.
+///
+/// This method allows boost multi-index hashed indexes on IOAddresses.
+/// It follows the requirement with equality: if two addresses are equal
+/// their hashes are equal, if two addresses are not equal their hashes
+/// are almost surely not equal.
+///
+/// \param address A \c IOAddress to hash.
+/// \return The hash of the IOAddress.
+size_t hash_value(const IOAddress& address);
+
 } // namespace asiolink
 } // namespace isc
 #endif // IO_ADDRESS_H
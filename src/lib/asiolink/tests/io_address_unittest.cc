@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -88,6 +88,11 @@ TEST(IOAddressTest, toBytesV4) {
     std::vector<uint8_t> actual = IOAddress(V4STRING).toBytes();
     ASSERT_EQ(sizeof(V4), actual.size());
     EXPECT_TRUE(std::equal(actual.begin(), actual.end(), V4));
+
+    // The same bytes are written into a buffer.
+    uint8_t buf[isc::asiolink::V6ADDRESS_LEN];
+    ASSERT_EQ(sizeof(V4), IOAddress(V4STRING).toBytes(buf));
+    EXPECT_TRUE(std::equal(buf, buf + sizeof(V4), V4));
 }
 
 TEST(IOAddressTest, toBytesV6) {
@@ -101,6 +106,11 @@ TEST(IOAddressTest, toBytesV6) {
     std::vector<uint8_t> actual = IOAddress(V6STRING).toBytes();
     ASSERT_EQ(sizeof(V6), actual.size());
     EXPECT_TRUE(std::equal(actual.begin(), actual.end(), V6));
+
+    // The same bytes are written into a buffer.
+    uint8_t buf[isc::asiolink::V6ADDRESS_LEN];
+    ASSERT_EQ(sizeof(V6), IOAddress(V6STRING).toBytes(buf));
+    EXPECT_TRUE(std::equal(buf, buf + sizeof(V6), V6));
 }
 
 TEST(IOAddressTest, isV4) {
@@ -339,3 +349,21 @@ TEST(IOAddressTest, increaseAddr) {
     EXPECT_EQ(IOAddress("::1"), IOAddress::increase(any6));
     EXPECT_EQ(IOAddress("::"), IOAddress::increase(the_last_one));
 }
+
+// Test checks that hash_value() is consistent with address equality.
+TEST(IOAddressTest, hash) {
+    IOAddress addr1("192.0.2.12");
+    IOAddress addr2("192.0.2.12");
+    IOAddress addr3("192.0.2.13");
+    IOAddress addr4("2001:db8::1");
+    IOAddress addr5("2001:db8::1");
+    IOAddress addr6("2001:db8::2");
+
+    // Equal addresses must have equal hashes.
+    EXPECT_EQ(hash_value(addr1), hash_value(addr2));
+    EXPECT_EQ(hash_value(addr4), hash_value(addr5));
+
+    // Different addresses should have different hashes.
+    EXPECT_NE(hash_value(addr1), hash_value(addr3));
+    EXPECT_NE(hash_value(addr4), hash_value(addr6));
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2010-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2010-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <config.h>
 
 #include <cc/data.h>
+#include <cc/json_writer.h>
 
 #include <cstring>
 #include <cassert>
@@ -22,6 +23,7 @@
 #include <cerrno>
 
 #include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
 
 #include <cmath>
 
@@ -221,12 +223,12 @@ bool operator!=(const Element& a, const Element& b) {
 //
 ElementPtr
 Element::create(const Position& pos) {
-    return (ElementPtr(new NullElement(pos)));
+    return (boost::make_shared<NullElement>(pos));
 }
 
 ElementPtr
 Element::create(const long long int i, const Position& pos) {
-    return (ElementPtr(new IntElement(static_cast<int64_t>(i), pos)));
+    return (boost::make_shared<IntElement>(static_cast<int64_t>(i), pos));
 }
 
 ElementPtr
@@ -241,17 +243,17 @@ Element::create(const long int i, const Position& pos) {
 
 ElementPtr
 Element::create(const double d, const Position& pos) {
-    return (ElementPtr(new DoubleElement(d, pos)));
+    return (boost::make_shared<DoubleElement>(d, pos));
 }
 
 ElementPtr
 Element::create(const bool b, const Position& pos) {
-    return (ElementPtr(new BoolElement(b, pos)));
+    return (boost::make_shared<BoolElement>(b, pos));
 }
 
 ElementPtr
 Element::create(const std::string& s, const Position& pos) {
-    return (ElementPtr(new StringElement(s, pos)));
+    return (boost::make_shared<StringElement>(s, pos));
 }
 
 ElementPtr
@@ -261,12 +263,12 @@ Element::create(const char *s, const Position& pos) {
 
 ElementPtr
 Element::createList(const Position& pos) {
-    return (ElementPtr(new ListElement(pos)));
+    return (boost::make_shared<ListElement>(pos));
 }
 
 ElementPtr
 Element::createMap(const Position& pos) {
-    return (ElementPtr(new MapElement(pos)));
+    return (boost::make_shared<MapElement>(pos));
 }
 
 
@@ -276,9 +278,8 @@ Element::createMap(const Position& pos) {
 namespace {
 bool
 charIn(const int c, const char* chars) {
-    const size_t chars_len = std::strlen(chars);
-    for (size_t i = 0; i < chars_len; ++i) {
-        if (chars[i] == c) {
+    for (; *chars != '\0'; ++chars) {
+        if (*chars == c) {
             return (true);
         }
     }
@@ -344,7 +345,9 @@ std::string
 strFromStringstream(std::istream& in, const std::string& file,
                     const int line, int& pos)
 {
-    std::stringstream ss;
+    // The value is collected directly in a string rather than in a
+    // string stream, which is much cheaper for short keys and values.
+    std::string result;
     int c = in.get();
     ++pos;
     if (c == '"') {
@@ -432,35 +435,35 @@ strFromStringstream(std::istream& in, const std::string& file,
             in.ignore();
             ++pos;
         }
-        ss.put(c);
+        result.push_back(static_cast<char>(c));
         c = in.get();
         ++pos;
     }
     if (c == EOF) {
         throwJSONError("Unterminated string", file, line, pos);
     }
-    return (ss.str());
+    return (result);
 }
 
 std::string
 wordFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
+    std::string word;
     while (isalpha(in.peek())) {
-        ss << (char) in.get();
+        word.push_back(static_cast<char>(in.get()));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += word.size();
+    return (word);
 }
 
 std::string
 numberFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
+    std::string number;
     while (isdigit(in.peek()) || in.peek() == '+' || in.peek() == '-' ||
            in.peek() == '.' || in.peek() == 'e' || in.peek() == 'E') {
-        ss << (char) in.get();
+        number.push_back(static_cast<char>(in.get()));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += number.size();
+    return (number);
 }
 
 // Should we change from IntElement and DoubleElement to NumberElement
@@ -810,50 +813,7 @@ NullElement::toJSON(std::ostream& ss) const {
 
 void
 StringElement::toJSON(std::ostream& ss) const {
-    ss << "\"";
-    const std::string& str = stringValue();
-    for (size_t i = 0; i < str.size(); ++i) {
-        const char c = str[i];
-        // Escape characters as defined in JSON spec
-        // Note that we do not escape forward slash; this
-        // is allowed, but not mandatory.
-        switch (c) {
-        case '"':
-            ss << '\\' << c;
-            break;
-        case '\\':
-            ss << '\\' << c;
-            break;
-        case '\b':
-            ss << '\\' << 'b';
-            break;
-        case '\f':
-            ss << '\\' << 'f';
-            break;
-        case '\n':
-            ss << '\\' << 'n';
-            break;
-        case '\r':
-            ss << '\\' << 'r';
-            break;
-        case '\t':
-            ss << '\\' << 't';
-            break;
-        default:
-            if (((c >= 0) && (c < 0x20)) || (c < 0) || (c >= 0x7f)) {
-                std::ostringstream esc;
-                esc << "\\u"
-                    << hex
-                    << setw(4)
-                    << setfill('0')
-                    << (static_cast<unsigned>(c) & 0xff);
-                ss << esc.str();
-            } else {
-                ss << c;
-            }
-        }
-    }
-    ss << "\"";
+    JSONWriter::writeString(ss, stringValue());
 }
 
 void
@@ -881,7 +841,8 @@ MapElement::toJSON(std::ostream& ss) const {
         if (it != m.begin()) {
             ss << ", ";
         }
-        ss << "\"" << (*it).first << "\": ";
+        JSONWriter::writeString(ss, (*it).first);
+        ss << ": ";
         if ((*it).second) {
             (*it).second->toJSON(ss);
         } else {
@@ -1117,17 +1078,17 @@ copy(ConstElementPtr from, int level) {
     }
     int from_type = from->getType();
     if (from_type == Element::integer) {
-        return (ElementPtr(new IntElement(from->intValue())));
+        return (boost::make_shared<IntElement>(from->intValue()));
     } else if (from_type == Element::real) {
-        return (ElementPtr(new DoubleElement(from->doubleValue())));
+        return (boost::make_shared<DoubleElement>(from->doubleValue()));
     } else if (from_type == Element::boolean) {
-        return (ElementPtr(new BoolElement(from->boolValue())));
+        return (boost::make_shared<BoolElement>(from->boolValue()));
     } else if (from_type == Element::null) {
-        return (ElementPtr(new NullElement()));
+        return (boost::make_shared<NullElement>());
     } else if (from_type == Element::string) {
-        return (ElementPtr(new StringElement(from->stringValue())));
+        return (boost::make_shared<StringElement>(from->stringValue()));
     } else if (from_type == Element::list) {
-        ElementPtr result = ElementPtr(new ListElement());
+        ElementPtr result = boost::make_shared<ListElement>();
         typedef std::vector<ElementPtr> ListType;
         const ListType& value = from->listValue();
         for (ListType::const_iterator it = value.cbegin();
@@ -1140,7 +1101,7 @@ copy(ConstElementPtr from, int level) {
         }
         return (result);
     } else if (from_type == Element::map) {
-        ElementPtr result = ElementPtr(new MapElement());
+        ElementPtr result = boost::make_shared<MapElement>();
         typedef std::map<std::string, ConstElementPtr> MapType;
         const MapType& value = from->mapValue();
         for (MapType::const_iterator it = value.cbegin();
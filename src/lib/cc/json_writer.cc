@@ -0,0 +1,277 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/json_writer.h>
+#include <exceptions/exceptions.h>
+
+namespace isc {
+namespace data {
+
+JSONWriter::JSONWriter(std::ostream& os)
+    : os_(os), scopes_(), key_pending_(false), done_(false) {
+}
+
+void
+JSONWriter::startMap() {
+    beforeValue();
+    os_ << "{ ";
+    scopes_.push_back(Scope{true, true});
+}
+
+void
+JSONWriter::endMap() {
+    if (scopes_.empty() || !scopes_.back().map_) {
+        isc_throw(InvalidOperation, "JSON writer: no map to end");
+    }
+    if (key_pending_) {
+        isc_throw(InvalidOperation, "JSON writer: map ends after a key");
+    }
+    os_ << " }";
+    scopes_.pop_back();
+    afterValue();
+}
+
+void
+JSONWriter::startList() {
+    beforeValue();
+    os_ << "[ ";
+    scopes_.push_back(Scope{false, true});
+}
+
+void
+JSONWriter::endList() {
+    if (scopes_.empty() || scopes_.back().map_) {
+        isc_throw(InvalidOperation, "JSON writer: no list to end");
+    }
+    os_ << " ]";
+    scopes_.pop_back();
+    afterValue();
+}
+
+void
+JSONWriter::key(const std::string& name) {
+    if (scopes_.empty() || !scopes_.back().map_) {
+        isc_throw(InvalidOperation, "JSON writer: key '" << name
+                  << "' outside of a map");
+    }
+    if (key_pending_) {
+        isc_throw(InvalidOperation, "JSON writer: key '" << name
+                  << "' follows another key");
+    }
+    if (!scopes_.back().empty_) {
+        os_ << ", ";
+    }
+    scopes_.back().empty_ = false;
+    writeString(os_, name);
+    os_ << ": ";
+    key_pending_ = true;
+}
+
+void
+JSONWriter::value(const std::string& str) {
+    beforeValue();
+    writeString(os_, str);
+    afterValue();
+}
+
+void
+JSONWriter::value(const char* str) {
+    value(std::string(str));
+}
+
+void
+JSONWriter::value(long long int i) {
+    beforeValue();
+    os_ << i;
+    afterValue();
+}
+
+void
+JSONWriter::value(double d) {
+    beforeValue();
+    os_ << d;
+    afterValue();
+}
+
+void
+JSONWriter::value(bool b) {
+    beforeValue();
+    os_ << (b ? "true" : "false");
+    afterValue();
+}
+
+void
+JSONWriter::valueNull() {
+    beforeValue();
+    os_ << "null";
+    afterValue();
+}
+
+void
+JSONWriter::value(const ConstElementPtr& element) {
+    beforeValue();
+    if (element) {
+        element->toJSON(os_);
+    } else {
+        os_ << "null";
+    }
+    afterValue();
+}
+
+void
+JSONWriter::beforeValue() {
+    if (done_) {
+        isc_throw(InvalidOperation, "JSON writer: value after the end"
+                  " of the JSON structure");
+    }
+    if (scopes_.empty()) {
+        return;
+    }
+    Scope& scope = scopes_.back();
+    if (scope.map_) {
+        if (!key_pending_) {
+            isc_throw(InvalidOperation, "JSON writer: value in a map"
+                      " without a key");
+        }
+        key_pending_ = false;
+
+    } else {
+        if (!scope.empty_) {
+            os_ << ", ";
+        }
+        scope.empty_ = false;
+    }
+}
+
+void
+JSONWriter::afterValue() {
+    if (scopes_.empty()) {
+        done_ = true;
+    }
+}
+
+void
+JSONWriter::writeString(std::ostream& os, const std::string& str) {
+    static const char hex_digits[] = "0123456789abcdef";
+
+    os << '"';
+    // Characters which don't need escaping are written in runs.
+    size_t run = 0;
+    for (size_t i = 0; i < str.size(); ++i) {
+        const char c = str[i];
+        // Escape characters as defined in JSON spec
+        // Note that we do not escape forward slash; this
+        // is allowed, but not mandatory.
+        char esc = 0;
+        switch (c) {
+        case '"':
+        case '\\':
+            esc = c;
+            break;
+        case '\b':
+            esc = 'b';
+            break;
+        case '\f':
+            esc = 'f';
+            break;
+        case '\n':
+            esc = 'n';
+            break;
+        case '\r':
+            esc = 'r';
+            break;
+        case '\t':
+            esc = 't';
+            break;
+        default:
+            if ((c >= 0x20) && (c < 0x7f)) {
+                continue;
+            }
+        }
+        os.write(str.data() + run, i - run);
+        run = i + 1;
+        if (esc) {
+            const char escaped[] = { '\\', esc };
+            os.write(escaped, sizeof(escaped));
+        } else {
+            const unsigned value = static_cast<unsigned>(c) & 0xff;
+            const char escaped[] = { '\\', 'u', '0', '0',
+                                     hex_digits[value >> 4],
+                                     hex_digits[value & 0xf] };
+            os.write(escaped, sizeof(escaped));
+        }
+    }
+    os.write(str.data() + run, str.size() - run);
+    os << '"';
+}
+
+JSONChunkWriter::JSONChunkWriter(const ConstElementPtr& element)
+    : element_(element), os_(), writer_(os_), frames_(), started_(false) {
+}
+
+bool
+JSONChunkWriter::next(std::string& chunk, const size_t size) {
+    os_.str(std::string());
+    if (!started_) {
+        started_ = true;
+        writeElement(element_);
+    }
+    while (!frames_.empty() && (static_cast<size_t>(os_.tellp()) < size)) {
+        writeNext();
+    }
+    chunk = os_.str();
+    return (!chunk.empty());
+}
+
+void
+JSONChunkWriter::writeElement(const ConstElementPtr& element) {
+    if (element && (element->getType() == Element::map)) {
+        writer_.startMap();
+        frames_.push_back(Frame{element, element->mapValue().begin(), 0});
+
+    } else if (element && (element->getType() == Element::list)) {
+        writer_.startList();
+        frames_.push_back(Frame{element,
+                                std::map<std::string, ConstElementPtr>::const_iterator(),
+                                0});
+
+    } else {
+        writer_.value(element);
+    }
+}
+
+void
+JSONChunkWriter::writeNext() {
+    // The frame is advanced before the entry is written as writing a map
+    // or a list adds a frame.
+    Frame& frame = frames_.back();
+    ConstElementPtr entry;
+    if (frame.element_->getType() == Element::map) {
+        if (frame.map_it_ == frame.element_->mapValue().end()) {
+            writer_.endMap();
+            frames_.pop_back();
+            return;
+        }
+        writer_.key(frame.map_it_->first);
+        entry = frame.map_it_->second;
+        ++frame.map_it_;
+
+    } else {
+        if (frame.list_index_ == frame.element_->size()) {
+            writer_.endList();
+            frames_.pop_back();
+            return;
+        }
+        entry = frame.element_->get(frame.list_index_);
+        ++frame.list_index_;
+    }
+    writeElement(entry);
+}
+
+} // end of isc::data namespace
+} // end of isc namespace
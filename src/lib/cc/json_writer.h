@@ -0,0 +1,231 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <cc/data.h>
+#include <boost/noncopyable.hpp>
+#include <map>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace data {
+
+/// @brief Streaming writer of JSON text.
+///
+/// The @ref Element::toJSON requires that the whole structure is built
+/// in memory before it is serialized: each value is a separately
+/// allocated object and each map entry a node in a map. When the output
+/// is large, e.g. thousands of leases or statistics, the tree takes many
+/// times more memory than the resulting text.
+///
+/// This class writes the JSON text directly to the output stream as the
+/// caller walks over its own data, one token at a time:
+///
+/// @code
+/// JSONWriter writer(os);
+/// writer.startMap();
+/// writer.key("leases");
+/// writer.startList();
+/// for (auto lease : leases) {
+///     writer.startMap();
+///     writer.key("ip-address");
+///     writer.value(lease->addr_.toText());
+///     writer.endMap();
+/// }
+/// writer.endList();
+/// writer.endMap();
+/// @endcode
+///
+/// The caller can still write whole subtrees with @ref value(ConstElementPtr)
+/// when they are small. The output has the same layout as produced by the
+/// @ref Element::str, so the text written for a structure is identical to
+/// the text of the equivalent element tree.
+///
+/// The writer checks that the calls form a valid JSON structure, e.g.
+/// that each value in a map is preceded by a key, and throws
+/// @ref isc::InvalidOperation otherwise.
+class JSONWriter : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param os Stream to which the JSON text is written.
+    explicit JSONWriter(std::ostream& os);
+
+    /// @brief Starts a map.
+    void startMap();
+
+    /// @brief Ends the current map.
+    ///
+    /// @throw InvalidOperation if the current structure is not a map or
+    /// a key without the value has been written.
+    void endMap();
+
+    /// @brief Starts a list.
+    void startList();
+
+    /// @brief Ends the current list.
+    ///
+    /// @throw InvalidOperation if the current structure is not a list.
+    void endList();
+
+    /// @brief Writes a key of the next map entry.
+    ///
+    /// @param name Key.
+    /// @throw InvalidOperation if the current structure is not a map or
+    /// the previous key has no value yet.
+    void key(const std::string& name);
+
+    /// @name Methods writing a value.
+    ///
+    /// Each of them throws @ref isc::InvalidOperation when the value is
+    /// not allowed at this position, e.g. in a map without a key or after
+    /// the top level structure has been completed.
+    //@{
+    void value(const std::string& str);
+    void value(const char* str);
+    void value(long long int i);
+    void value(int i) { value(static_cast<long long int>(i)); }
+    void value(long int i) { value(static_cast<long long int>(i)); }
+    void value(double d);
+    void value(bool b);
+    void valueNull();
+
+    /// @brief Writes an element tree.
+    ///
+    /// @param element Element to be written. Null pointer is written as
+    /// the JSON null.
+    void value(const ConstElementPtr& element);
+    //@}
+
+    /// @brief Checks if a complete JSON structure has been written.
+    ///
+    /// @return true if the top level value has been written and all maps
+    /// and lists have been closed.
+    bool complete() const {
+        return (done_);
+    }
+
+    /// @brief Writes a quoted and escaped JSON string.
+    ///
+    /// This is the escaping used by @ref StringElement::toJSON.
+    ///
+    /// @param os Output stream.
+    /// @param str String to be written.
+    static void writeString(std::ostream& os, const std::string& str);
+
+private:
+
+    /// @brief Performs checks and writes a separator before a value.
+    void beforeValue();
+
+    /// @brief Marks the value as written.
+    void afterValue();
+
+    /// @brief Scope of an open map or list.
+    struct Scope {
+        /// @brief Indicates whether it is a map.
+        bool map_;
+
+        /// @brief Indicates whether it has no entries yet.
+        bool empty_;
+    };
+
+    /// @brief Output stream.
+    std::ostream& os_;
+
+    /// @brief Stack of open maps and lists.
+    std::vector<Scope> scopes_;
+
+    /// @brief Indicates whether a key has been written without its value.
+    bool key_pending_;
+
+    /// @brief Indicates whether the top level value is complete.
+    bool done_;
+};
+
+/// @brief Writer of the JSON text of an element tree in chunks.
+///
+/// The command channel sends the responses in chunks of limited size.
+/// Rendering a large response with @ref Element::str before sending it
+/// holds its whole text in memory along with the element tree. This class
+/// walks over the tree as the chunks are requested and renders only the
+/// next chunk, using a @ref JSONWriter. The concatenated chunks are
+/// identical to the output of @ref Element::str.
+class JSONChunkWriter : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param element Element tree to be written. It must not be modified
+    /// until the whole text has been written.
+    explicit JSONChunkWriter(const ConstElementPtr& element);
+
+    /// @brief Renders the next chunk of the text.
+    ///
+    /// The chunk is at least @c size bytes long, unless it is the last one.
+    /// It may be longer as the scalar values are not split.
+    ///
+    /// @param [out] chunk Rendered chunk, empty when the whole text has
+    /// already been written.
+    /// @param size Minimum size of the chunk.
+    /// @return false if the whole text has already been written.
+    bool next(std::string& chunk, const size_t size);
+
+    /// @brief Checks if the whole text has been written.
+    ///
+    /// @return true if the last chunk has been rendered.
+    bool complete() const {
+        return (started_ && frames_.empty());
+    }
+
+private:
+
+    /// @brief Writes an element or starts writing a map or a list.
+    ///
+    /// @param element Element to be written.
+    void writeElement(const ConstElementPtr& element);
+
+    /// @brief Writes the next entry of the innermost map or list, or ends it.
+    void writeNext();
+
+    /// @brief Position in a map or a list being written.
+    struct Frame {
+        /// @brief Map or list.
+        ConstElementPtr element_;
+
+        /// @brief Next entry of the map.
+        std::map<std::string, ConstElementPtr>::const_iterator map_it_;
+
+        /// @brief Next entry of the list.
+        size_t list_index_;
+    };
+
+    /// @brief Element tree to be written.
+    ConstElementPtr element_;
+
+    /// @brief Stream holding the chunk being rendered.
+    std::ostringstream os_;
+
+    /// @brief Writer rendering the chunks.
+    JSONWriter writer_;
+
+    /// @brief Stack of maps and lists being written.
+    std::vector<Frame> frames_;
+
+    /// @brief Indicates whether the first chunk has been rendered.
+    bool started_;
+};
+
+} // end of isc::data namespace
+} // end of isc namespace
+
+#endif // JSON_WRITER_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -103,14 +103,16 @@ size_t SimpleParser::setDefaults(isc::data::ElementPtr scope,
     // This is the position representing a default value. As the values
     // we're inserting here are not present in whatever the config file
     // came from, we need to make sure it's clearly labeled as default.
-    const Element::Position pos("<default-value>", 0, 0);
+    // It is created once because this function is called for every
+    // subnet, pool and option in the configuration.
+    static const Element::Position pos("<default-value>", 0, 0);
 
     // Let's go over all parameters we have defaults for.
-    BOOST_FOREACH(SimpleDefault def_value, default_values) {
+    BOOST_FOREACH(const SimpleDefault& def_value, default_values) {
 
         // Try if such a parameter is there. If it is, let's
         // skip it, because user knows best *cough*.
-        ConstElementPtr x = scope->get(string(def_value.name_));
+        ConstElementPtr x = scope->get(def_value.name_);
         if (x) {
             // There is such a value already, skip it.
             continue;
@@ -173,7 +175,7 @@ size_t
 SimpleParser::setListDefaults(isc::data::ConstElementPtr list,
                               const SimpleDefaults& default_values) {
     size_t cnt = 0;
-    BOOST_FOREACH(ElementPtr entry, list->listValue()) {
+    BOOST_FOREACH(const ElementPtr& entry, list->listValue()) {
         cnt += setDefaults(entry, default_values);
     }
     return (cnt);
@@ -189,7 +191,7 @@ SimpleParser::deriveParams(isc::data::ConstElementPtr parent,
     }
 
     size_t cnt = 0;
-    BOOST_FOREACH(string param, params) {
+    BOOST_FOREACH(const string& param, params) {
         ConstElementPtr x = parent->get(param);
         if (!x) {
             // Parent doesn't define this parameter, so there's
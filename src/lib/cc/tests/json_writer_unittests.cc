@@ -0,0 +1,161 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <cc/data.h>
+#include <cc/json_writer.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+
+using namespace isc;
+using namespace isc::data;
+
+namespace {
+
+// This test verifies that the writer produces the same text as the
+// equivalent element tree.
+TEST(JSONWriterTest, sameAsElement) {
+    ElementPtr elem = Element::fromJSON("{ \"name\": \"foo\\n\\\"bar\\\"\","
+                                        " \"int\": -5, \"double\": 1.5,"
+                                        " \"bool\": true, \"null\": null,"
+                                        " \"list\": [ 1, [ ], { } ],"
+                                        " \"map\": { \"a\": \"b\" } }");
+    std::ostringstream s;
+    JSONWriter writer(s);
+    EXPECT_FALSE(writer.complete());
+    // Keys are written in the order in which they are stored in the map.
+    writer.startMap();
+    writer.key("bool");
+    writer.value(true);
+    writer.key("double");
+    writer.value(1.5);
+    writer.key("int");
+    writer.value(-5);
+    writer.key("list");
+    writer.startList();
+    writer.value(1);
+    writer.startList();
+    writer.endList();
+    writer.startMap();
+    writer.endMap();
+    writer.endList();
+    writer.key("map");
+    writer.value(elem->get("map"));
+    writer.key("name");
+    writer.value("foo\n\"bar\"");
+    writer.key("null");
+    writer.valueNull();
+    writer.endMap();
+    EXPECT_TRUE(writer.complete());
+
+    EXPECT_EQ(elem->str(), s.str());
+    ElementPtr parsed;
+    ASSERT_NO_THROW(parsed = Element::fromJSON(s.str()));
+    EXPECT_TRUE(parsed->equals(*elem));
+}
+
+// This test verifies that a single scalar is a complete JSON text.
+TEST(JSONWriterTest, scalar) {
+    std::ostringstream s;
+    JSONWriter writer(s);
+    writer.value(std::string("foo"));
+    EXPECT_TRUE(writer.complete());
+    EXPECT_EQ("\"foo\"", s.str());
+    EXPECT_THROW(writer.value(1), InvalidOperation);
+}
+
+// This test verifies that strings are escaped the same way as in the
+// string elements.
+TEST(JSONWriterTest, writeString) {
+    std::string str("a\"b\\c\b\f\n\r\t/");
+    str.push_back('\x01');
+    str.push_back('\x7f');
+    str.push_back('\xc3');
+    std::ostringstream s;
+    JSONWriter::writeString(s, str);
+    EXPECT_EQ("\"a\\\"b\\\\c\\b\\f\\n\\r\\t/\\u0001\\u007f\\u00c3\"", s.str());
+    EXPECT_EQ(s.str(), Element::create(str)->str());
+
+    s.str("");
+    JSONWriter::writeString(s, "");
+    EXPECT_EQ("\"\"", s.str());
+}
+
+// This test verifies that invalid sequences of calls are rejected.
+TEST(JSONWriterTest, invalidSequence) {
+    std::ostringstream s;
+
+    {
+        // Value in a map without a key.
+        JSONWriter writer(s);
+        writer.startMap();
+        EXPECT_THROW(writer.value(1), InvalidOperation);
+        // Map closed after a key.
+        writer.key("foo");
+        EXPECT_THROW(writer.key("bar"), InvalidOperation);
+        EXPECT_THROW(writer.endMap(), InvalidOperation);
+        // List closes a map.
+        writer.value(1);
+        EXPECT_THROW(writer.endList(), InvalidOperation);
+        EXPECT_NO_THROW(writer.endMap());
+        // Nothing to close.
+        EXPECT_THROW(writer.endMap(), InvalidOperation);
+    }
+
+    {
+        // Key outside of a map.
+        JSONWriter writer(s);
+        EXPECT_THROW(writer.key("foo"), InvalidOperation);
+        writer.startList();
+        EXPECT_THROW(writer.key("foo"), InvalidOperation);
+        EXPECT_THROW(writer.endMap(), InvalidOperation);
+        writer.endList();
+        EXPECT_TRUE(writer.complete());
+        EXPECT_THROW(writer.startMap(), InvalidOperation);
+    }
+}
+
+// This test verifies that an element tree is written in chunks which
+// concatenate into the same text as the element.
+TEST(JSONChunkWriterTest, chunks) {
+    ElementPtr elem = Element::fromJSON("{ \"arguments\": { \"leases\": ["
+                                        " { \"ip-address\": \"192.0.2.1\" },"
+                                        " { \"ip-address\": \"192.0.2.2\" },"
+                                        " [ ], { }, null ] },"
+                                        " \"result\": 0,"
+                                        " \"text\": \"2 leases found\" }");
+    for (size_t size = 1; size < 200; size += 13) {
+        JSONChunkWriter writer(elem);
+        std::string text;
+        std::string chunk;
+        size_t chunks = 0;
+        while (writer.next(chunk, size)) {
+            ++chunks;
+            text += chunk;
+            // Only the last chunk may be shorter.
+            if (!writer.complete()) {
+                EXPECT_LE(size, chunk.size());
+            }
+        }
+        EXPECT_TRUE(writer.complete());
+        EXPECT_TRUE(chunk.empty());
+        EXPECT_EQ(elem->str(), text) << "chunk size " << size;
+        EXPECT_LE(1, chunks);
+    }
+
+    // A scalar is written in one chunk.
+    JSONChunkWriter writer(Element::create("foo"));
+    std::string chunk;
+    EXPECT_FALSE(writer.complete());
+    EXPECT_TRUE(writer.next(chunk, 1));
+    EXPECT_EQ("\"foo\"", chunk);
+    EXPECT_TRUE(writer.complete());
+    EXPECT_FALSE(writer.next(chunk, 1));
+}
+
+} // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,12 +16,14 @@
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
 #include <cc/json_feed.h>
+#include <cc/json_writer.h>
 #include <dhcp/iface_mgr.h>
 #include <config/config_log.h>
 #include <config/timeouts.h>
 #include <util/watch_socket.h>
 #include <boost/bind.hpp>
 #include <boost/enable_shared_from_this.hpp>
+#include <boost/scoped_ptr.hpp>
 #include <array>
 #include <unistd.h>
 
@@ -66,7 +68,8 @@ public:
                ConnectionPool& connection_pool,
                const long timeout)
         : socket_(socket), timeout_timer_(*io_service), timeout_(timeout),
-          buf_(), response_(), connection_pool_(connection_pool), feed_(),
+          buf_(), response_writer_(), response_(), response_sent_(0),
+          connection_pool_(connection_pool), feed_(),
           response_in_progress_(false), watch_socket_(new util::WatchSocket()) {
 
         LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_CONNECTION_OPENED)
@@ -140,6 +143,20 @@ public:
                                           shared_from_this(), _1, _2));
     }
 
+    /// @brief Starts sending a response.
+    ///
+    /// The response is rendered into text one chunk at a time, as the
+    /// previous chunk has been sent, so as the text of a large response
+    /// is never held in memory as a whole.
+    ///
+    /// @param rsp Response to be sent.
+    void startSend(const ConstElementPtr& rsp) {
+        response_writer_.reset(new JSONChunkWriter(rsp));
+        response_.clear();
+        response_sent_ = 0;
+        doSend();
+    }
+
     /// @brief Starts asynchronous send over the unix domain socket.
     ///
     /// This method doesn't block. Once the send operation (that covers the whole
@@ -148,8 +165,14 @@ public:
     /// close the connection gracefully if all data has been sent, or will
     /// call @ref doSend() again to send the next chunk of data.
     void doSend() {
-        size_t chunk_size = (response_.size() < BUF_SIZE) ? response_.size() : BUF_SIZE;
-        socket_->asyncSend(&response_[0], chunk_size,
+        // Render the next chunk when the current one has been sent.
+        if (response_sent_ == response_.size()) {
+            response_writer_->next(response_, BUF_SIZE);
+            response_sent_ = 0;
+        }
+        const size_t remaining = response_.size() - response_sent_;
+        size_t chunk_size = (remaining < BUF_SIZE) ? remaining : BUF_SIZE;
+        socket_->asyncSend(&response_[response_sent_], chunk_size,
            boost::bind(&Connection::sendHandler, shared_from_this(), _1, _2));
 
         // Asynchronous send has been scheduled and we need to indicate this
@@ -211,9 +234,15 @@ private:
     /// @brief Buffer used for received data.
     std::array<char, BUF_SIZE> buf_;
 
-    /// @brief Response created by the server.
+    /// @brief Writer rendering the response created by the server.
+    boost::scoped_ptr<JSONChunkWriter> response_writer_;
+
+    /// @brief Chunk of the response being sent.
     std::string response_;
 
+    /// @brief Number of bytes of the chunk sent so far.
+    size_t response_sent_;
+
     /// @brief Reference to the pool of connections.
     ConnectionPool& connection_pool_;
 
@@ -374,11 +403,9 @@ Connection::receiveHandler(const boost::system::error_code& ec,
         // updated to not timeout before we manage to the send the reply.
         scheduleTimer();
 
-        // Let's convert JSON response to text. Note that at this stage
-        // the rsp pointer is always set.
-        response_ = rsp->str();
-
-        doSend();
+        // Let's send the JSON response, converted to text as it is sent.
+        // Note that at this stage the rsp pointer is always set.
+        startSend(rsp);
         return;
     }
 
@@ -412,16 +439,17 @@ Connection::sendHandler(const boost::system::error_code& ec,
         scheduleTimer();
 
         // No error. We are in a process of sending a response. Need to
-        // remove the chunk that we have managed to sent with the previous
+        // skip the data that we have managed to sent with the previous
         // attempt.
-        response_.erase(0, bytes_transferred);
+        response_sent_ += bytes_transferred;
 
         LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE)
-            .arg(bytes_transferred).arg(response_.size())
+            .arg(bytes_transferred).arg(response_.size() - response_sent_)
             .arg(socket_->getNative());
 
         // Check if there is any data left to be sent and sent it.
-        if (!response_.empty()) {
+        if ((response_sent_ < response_.size()) ||
+            !response_writer_->complete()) {
             doSend();
             return;
         }
@@ -457,8 +485,7 @@ Connection::timeoutHandler() {
     }
 
     ConstElementPtr rsp = createAnswer(CONTROL_RESULT_ERROR, os.str());
-    response_ = rsp->str();
-    doSend();
+    startSend(rsp);
 }
 
 
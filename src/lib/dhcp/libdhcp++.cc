@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -330,8 +330,18 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
                                isc::dhcp::OptionCollection& options,
                                size_t* relay_msg_offset /* = 0 */,
                                size_t* relay_msg_len /* = 0 */) {
+    return (unpackOptions6(buf.begin(), buf.end(), option_space, options,
+                           relay_msg_offset, relay_msg_len));
+}
+
+size_t LibDHCP::unpackOptions6(OptionBufferConstIter begin,
+                               OptionBufferConstIter end,
+                               const std::string& option_space,
+                               isc::dhcp::OptionCollection& options,
+                               size_t* relay_msg_offset /* = 0 */,
+                               size_t* relay_msg_len /* = 0 */) {
     size_t offset = 0;
-    size_t length = buf.size();
+    size_t length = std::distance(begin, end);
     size_t last_offset = 0;
 
     // Get the list of standard option definitions.
@@ -362,10 +372,10 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
         }
 
         // Parse the option header
-        uint16_t opt_type = isc::util::readUint16(&buf[offset], 2);
+        uint16_t opt_type = isc::util::readUint16(&begin[offset], 2);
         offset += 2;
 
-        uint16_t opt_len = isc::util::readUint16(&buf[offset], 2);
+        uint16_t opt_len = isc::util::readUint16(&begin[offset], 2);
         offset += 2;
 
         if (offset + opt_len > length) {
@@ -399,8 +409,8 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
             }
 
             // Parse this as vendor option
-            OptionPtr vendor_opt(new OptionVendor(Option::V6, buf.begin() + offset,
-                                                  buf.begin() + offset + opt_len));
+            OptionPtr vendor_opt(new OptionVendor(Option::V6, begin + offset,
+                                                  begin + offset + opt_len));
             options.insert(std::make_pair(opt_type, vendor_opt));
 
             offset += opt_len;
@@ -445,16 +455,16 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
             // all options and we will remove this elseif. For now,
             // return generic option.
             opt = OptionPtr(new Option(Option::V6, opt_type,
-                                       buf.begin() + offset,
-                                       buf.begin() + offset + opt_len));
+                                       begin + offset,
+                                       begin + offset + opt_len));
         } else {
             // The option definition has been found. Use it to create
             // the option instance from the provided buffer chunk.
             const OptionDefinitionPtr& def = *(range.first);
             assert(def);
             opt = def->optionFactory(Option::V6, opt_type,
-                                     buf.begin() + offset,
-                                     buf.begin() + offset + opt_len);
+                                     begin + offset,
+                                     begin + offset + opt_len);
         }
         // add option to options
         options.insert(std::make_pair(opt_type, opt));
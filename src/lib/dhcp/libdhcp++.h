@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -247,6 +247,33 @@ public:
                                  size_t* relay_msg_offset = 0,
                                  size_t* relay_msg_len = 0);
 
+    /// @brief Parses a part of a buffer as DHCPv6 options and creates
+    /// Option objects.
+    ///
+    /// This variant parses the options between two iterators, so the
+    /// options of a part of a packet (e.g. of a relay level) are parsed
+    /// without copying this part. The relay-msg option offset is relative
+    /// to the @c begin iterator.
+    ///
+    /// @param begin Iterator pointing to the beginning of the options.
+    /// @param end Iterator pointing to the end of the options.
+    /// @param option_space A name of the option space which holds definitions
+    ///        to be used to parse options in the packets.
+    /// @param options Reference to option container. Options will be
+    ///        put here.
+    /// @param relay_msg_offset reference to a size_t structure. If specified,
+    ///        offset to beginning of relay_msg option will be stored in it.
+    /// @param relay_msg_len reference to a size_t structure. If specified,
+    ///        length of the relay_msg option will be stored in it.
+    /// @return offset to the first byte after the last successfully
+    /// parsed option
+    static size_t unpackOptions6(OptionBufferConstIter begin,
+                                 OptionBufferConstIter end,
+                                 const std::string& option_space,
+                                 isc::dhcp::OptionCollection& options,
+                                 size_t* relay_msg_offset = 0,
+                                 size_t* relay_msg_len = 0);
+
     /// @brief Parses provided buffer as DHCPv4 options and creates
     /// Option objects.
     ///
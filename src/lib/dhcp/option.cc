@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -115,8 +115,11 @@ void Option::pack(isc::util::OutputBuffer& buf) const {
 
 void
 Option::packHeader(isc::util::OutputBuffer& buf) const {
+    // The length of an option with sub-options is computed recursively,
+    // so compute it once.
+    const size_t length = len();
     if (universe_ == V4) {
-        if (len() > 255) {
+        if (length > 255) {
             isc_throw(OutOfRange, "DHCPv4 Option " << type_ << " is too big. "
                       << "At most 255 bytes are supported.");
             /// TODO Larger options can be stored as separate instances
@@ -125,11 +128,11 @@ Option::packHeader(isc::util::OutputBuffer& buf) const {
         }
 
         buf.writeUint8(type_);
-        buf.writeUint8(len() - getHeaderLen());
+        buf.writeUint8(length - getHeaderLen());
 
     } else {
         buf.writeUint16(type_);
-        buf.writeUint16(len() - getHeaderLen());
+        buf.writeUint16(length - getHeaderLen());
     }
 }
 
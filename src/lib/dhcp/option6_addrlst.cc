@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -69,6 +69,7 @@ void Option6AddrLst::pack(isc::util::OutputBuffer& buf) const {
     // len field contains length without 4-byte option header
     buf.writeUint16(len() - getHeaderLen());
 
+    uint8_t addr_data[V6ADDRESS_LEN];
     for (AddressContainer::const_iterator addr=addrs_.begin();
          addr!=addrs_.end(); ++addr) {
         if (!addr->isV6()) {
@@ -77,7 +78,8 @@ void Option6AddrLst::pack(isc::util::OutputBuffer& buf) const {
         }
         // If an address is IPv6 address it should have assumed
         // length of V6ADDRESS_LEN.
-        buf.writeData(&addr->toBytes()[0], V6ADDRESS_LEN);
+        addr->toBytes(addr_data);
+        buf.writeData(addr_data, V6ADDRESS_LEN);
     }
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -65,7 +65,9 @@ void Option6IAPrefix::pack(isc::util::OutputBuffer& buf) const {
     buf.writeUint32(valid_);
     buf.writeUint8(prefix_len_);
 
-    buf.writeData(&addr_.toBytes()[0], isc::asiolink::V6ADDRESS_LEN);
+    uint8_t addr_data[isc::asiolink::V6ADDRESS_LEN];
+    addr_.toBytes(addr_data);
+    buf.writeData(addr_data, isc::asiolink::V6ADDRESS_LEN);
 
     // store encapsulated options (the only defined so far is PD_EXCLUDE)
     packOptions(buf);
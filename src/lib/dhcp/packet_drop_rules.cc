@@ -0,0 +1,294 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/packet_drop_rules.h>
+#include <dhcp/packet_queue.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <exceptions/exceptions.h>
+#include <util/io_utilities.h>
+
+#include <algorithm>
+
+using namespace isc::data;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Offset of the transaction id in a DHCPv4 message.
+const size_t DHCPV4_TRANSID_OFFSET = 4;
+
+/// @brief Offset of the client address in a DHCPv4 message.
+const size_t DHCPV4_CIADDR_OFFSET = 12;
+
+/// @brief Offset of the hardware address in a DHCPv4 message.
+const size_t DHCPV4_CHADDR_OFFSET = 28;
+
+/// @brief Finds a DHCPv6 option in on-wire options.
+///
+/// @param data on-wire data.
+/// @param offset offset of the first option.
+/// @param end offset of the end of the options.
+/// @param code code of the option to find.
+/// @param [out] option_offset offset of the option data.
+/// @param [out] option_len length of the option data.
+/// @return true if the option has been found.
+bool
+findOption6(const isc::dhcp::OptionBuffer& data, size_t offset,
+            const size_t end, const uint16_t code, size_t& option_offset,
+            size_t& option_len) {
+    while (offset + 4 <= end) {
+        uint16_t opt_type = readUint16(&data[offset], 2);
+        uint16_t opt_len = readUint16(&data[offset + 2], 2);
+        offset += 4;
+        if (offset + opt_len > end) {
+            return (false);
+        }
+        if (opt_type == code) {
+            option_offset = offset;
+            option_len = opt_len;
+            return (true);
+        }
+        offset += opt_len;
+    }
+    return (false);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+bool
+RawPacketInfo::fromData4(const OptionBuffer& data) {
+    const size_t options_offset = Pkt4::DHCPV4_PKT_HDR_LEN + 4;
+    if ((data.size() < options_offset) || (data[0] != BOOTREQUEST) ||
+        (readUint32(&data[Pkt4::DHCPV4_PKT_HDR_LEN], 4) != DHCP_OPTIONS_COOKIE)) {
+        return (false);
+    }
+
+    transid_ = readUint32(&data[DHCPV4_TRANSID_OFFSET], 4);
+    known_client_ = (readUint32(&data[DHCPV4_CIADDR_OFFSET], 4) != 0);
+
+    // The hardware type is part of the client identification.
+    const size_t hlen = std::min(static_cast<size_t>(data[2]),
+                                 Pkt4::MAX_CHADDR_LEN);
+    client_.assign(1, data[1]);
+    client_.insert(client_.end(), data.begin() + DHCPV4_CHADDR_OFFSET,
+                   data.begin() + DHCPV4_CHADDR_OFFSET + hlen);
+
+    // Look for the message type option. The options overloaded in the
+    // sname and file fields are not considered.
+    size_t offset = options_offset;
+    while (offset < data.size()) {
+        const uint8_t code = data[offset];
+        if (code == DHO_PAD) {
+            ++offset;
+            continue;
+        }
+        if ((code == DHO_END) || (offset + 1 >= data.size())) {
+            break;
+        }
+        const uint8_t len = data[offset + 1];
+        offset += 2;
+        if (offset + len > data.size()) {
+            break;
+        }
+        if ((code == DHO_DHCP_MESSAGE_TYPE) && (len == 1)) {
+            msg_type_ = data[offset];
+            return (true);
+        }
+        offset += len;
+    }
+    return (false);
+}
+
+bool
+RawPacketInfo::fromData6(const OptionBuffer& data) {
+    // Walk down the relay encapsulations to the client's message.
+    size_t begin = 0;
+    size_t end = data.size();
+    for (unsigned level = 0; ; ++level) {
+        if (end - begin < Pkt6::DHCPV6_PKT_HDR_LEN) {
+            return (false);
+        }
+        if (data[begin] != DHCPV6_RELAY_FORW) {
+            break;
+        }
+        size_t len = 0;
+        if ((level >= HOP_COUNT_LIMIT) ||
+            !findOption6(data, begin + Pkt6::DHCPV6_RELAY_HDR_LEN, end,
+                         D6O_RELAY_MSG, begin, len)) {
+            return (false);
+        }
+        end = begin + len;
+    }
+
+    msg_type_ = data[begin];
+    transid_ = (data[begin + 1] << 16) + (data[begin + 2] << 8) + data[begin + 3];
+    known_client_ = ((msg_type_ == DHCPV6_RENEW) || (msg_type_ == DHCPV6_REBIND) ||
+                     (msg_type_ == DHCPV6_CONFIRM) || (msg_type_ == DHCPV6_RELEASE) ||
+                     (msg_type_ == DHCPV6_DECLINE));
+
+    size_t offset = 0;
+    size_t len = 0;
+    if (findOption6(data, begin + Pkt6::DHCPV6_PKT_HDR_LEN, end,
+                    D6O_CLIENTID, offset, len)) {
+        client_.assign(data.begin() + offset, data.begin() + offset + len);
+    }
+    return (true);
+}
+
+PacketDropRules::PacketDropRules(const uint32_t max_client_rate,
+                                 const bool drop_duplicates,
+                                 const std::set<uint8_t>& low_priority_types,
+                                 const uint32_t low_priority_threshold)
+    : max_client_rate_(max_client_rate), drop_duplicates_(drop_duplicates),
+      low_priority_types_(low_priority_types),
+      low_priority_threshold_(low_priority_threshold), window_(0),
+      clients_(), counters_(), mutex_() {
+    if (low_priority_threshold_ > 100) {
+        isc_throw(BadValue, "low priority threshold of "
+                  << low_priority_threshold_ << " is invalid. It must be"
+                  " a percentage of the queue capacity");
+    }
+}
+
+PacketDropRulesPtr
+PacketDropRules::create(const ConstElementPtr& parameters) {
+    if (!parameters || (parameters->getType() != Element::map)) {
+        return (PacketDropRulesPtr());
+    }
+
+    ConstElementPtr max_client_rate = parameters->get("max-client-rate");
+    ConstElementPtr drop_duplicates = parameters->get("drop-duplicates");
+    ConstElementPtr low_priority_types = parameters->get("low-priority-types");
+    ConstElementPtr low_priority_threshold =
+        parameters->get("low-priority-threshold");
+
+    uint32_t rate = 0;
+    if (max_client_rate) {
+        if ((max_client_rate->getType() != Element::integer) ||
+            (max_client_rate->intValue() < 0) ||
+            (max_client_rate->intValue() > 0xffffffff)) {
+            isc_throw(InvalidQueueParameter, "'max-client-rate' parameter"
+                      " must be a positive integer");
+        }
+        rate = static_cast<uint32_t>(max_client_rate->intValue());
+    }
+
+    bool duplicates = false;
+    if (drop_duplicates) {
+        if (drop_duplicates->getType() != Element::boolean) {
+            isc_throw(InvalidQueueParameter, "'drop-duplicates' parameter"
+                      " must be a boolean");
+        }
+        duplicates = drop_duplicates->boolValue();
+    }
+
+    std::set<uint8_t> types;
+    if (low_priority_types) {
+        if (low_priority_types->getType() != Element::list) {
+            isc_throw(InvalidQueueParameter, "'low-priority-types' parameter"
+                      " must be a list of message types");
+        }
+        for (size_t i = 0; i < low_priority_types->size(); ++i) {
+            ConstElementPtr type = low_priority_types->get(i);
+            if ((type->getType() != Element::integer) ||
+                (type->intValue() < 0) || (type->intValue() > 255)) {
+                isc_throw(InvalidQueueParameter, "'low-priority-types'"
+                          " parameter must be a list of message types");
+            }
+            types.insert(static_cast<uint8_t>(type->intValue()));
+        }
+    }
+
+    uint32_t threshold = 50;
+    if (low_priority_threshold) {
+        if ((low_priority_threshold->getType() != Element::integer) ||
+            (low_priority_threshold->intValue() < 0) ||
+            (low_priority_threshold->intValue() > 100)) {
+            isc_throw(InvalidQueueParameter, "'low-priority-threshold'"
+                      " parameter must be a percentage of the capacity");
+        }
+        threshold = static_cast<uint32_t>(low_priority_threshold->intValue());
+    }
+
+    if ((rate == 0) && !duplicates && types.empty()) {
+        return (PacketDropRulesPtr());
+    }
+    return (PacketDropRulesPtr(new PacketDropRules(rate, duplicates, types,
+                                                   threshold)));
+}
+
+bool
+PacketDropRules::shouldDrop(const RawPacketInfo& info, const size_t queue_size,
+                            const size_t capacity, const time_t now) {
+    if (!low_priority_types_.empty() &&
+        (low_priority_types_.count(info.msg_type_) > 0) &&
+        (queue_size * 100 >= capacity * low_priority_threshold_)) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        ++counters_.low_priority_;
+        return (true);
+    }
+
+    if (((max_client_rate_ == 0) && !drop_duplicates_) || info.client_.empty()) {
+        return (false);
+    }
+
+    // The clients are tracked during one second, so as the memory used
+    // remains bounded by the packet rate.
+    if (now != window_) {
+        clients_.clear();
+        window_ = now;
+    }
+
+    ClientState& client = clients_[info.client_];
+    if ((max_client_rate_ > 0) && (client.count_ >= max_client_rate_)) {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        ++counters_.rate_limit_;
+        return (true);
+    }
+
+    if (drop_duplicates_) {
+        if (std::find(client.transids_.begin(), client.transids_.end(),
+                      info.transid_) != client.transids_.end()) {
+            isc::util::thread::Mutex::Locker lock(mutex_);
+            ++counters_.duplicate_;
+            return (true);
+        }
+        client.transids_.push_back(info.transid_);
+    }
+
+    ++client.count_;
+    return (false);
+}
+
+PacketDropRules::Counters
+PacketDropRules::getCounters() const {
+    isc::util::thread::Mutex::Locker lock(mutex_);
+    return (counters_);
+}
+
+ElementPtr
+PacketDropRules::getInfo() const {
+    Counters counters = getCounters();
+    ElementPtr info = Element::createMap();
+    info->set("rate-limit",
+              Element::create(static_cast<int64_t>(counters.rate_limit_)));
+    info->set("duplicate",
+              Element::create(static_cast<int64_t>(counters.duplicate_)));
+    info->set("low-priority",
+              Element::create(static_cast<int64_t>(counters.low_priority_)));
+    return (info);
+}
+
+}; // namespace isc::dhcp
+}; // namespace isc
@@ -0,0 +1,221 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PACKET_DROP_RULES_H
+#define PACKET_DROP_RULES_H
+
+#include <cc/data.h>
+#include <dhcp/option.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <util/threads/sync.h>
+
+#include <boost/shared_ptr.hpp>
+#include <ctime>
+#include <map>
+#include <set>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Information extracted from a packet which hasn't been unpacked.
+///
+/// Packet queues have to decide what to do with a packet in the receiver
+/// thread, before the packet is unpacked by the server. This structure
+/// holds the few fields they need, read from the on-wire data.
+struct RawPacketInfo {
+    /// @brief Constructor.
+    RawPacketInfo()
+        : msg_type_(0), transid_(0), client_(), known_client_(false) {
+    }
+
+    /// @brief Message type.
+    ///
+    /// For a relayed DHCPv6 message it is the type of the client's message.
+    uint8_t msg_type_;
+
+    /// @brief Transaction id.
+    uint32_t transid_;
+
+    /// @brief Client identification.
+    ///
+    /// The hardware type and address for DHCPv4, the DUID for DHCPv6.
+    /// It is empty when the client can't be identified.
+    std::vector<uint8_t> client_;
+
+    /// @brief Indicates if the client claims to have a lease.
+    ///
+    /// It is true for the DHCPv4 messages with the ciaddr set, i.e. sent by
+    /// a client in the BOUND, RENEWING or REBINDING state, and for the
+    /// DHCPv6 Renew, Rebind, Confirm, Release and Decline messages.
+    bool known_client_;
+
+    /// @brief Reads the information from a DHCPv4 message.
+    ///
+    /// @param data on-wire data of the message.
+    /// @return true if the message is a well formed client's message
+    /// carrying a message type, false otherwise.
+    bool fromData4(const OptionBuffer& data);
+
+    /// @brief Reads the information from a DHCPv6 message.
+    ///
+    /// Relay-forward messages are walked down to the client's message.
+    ///
+    /// @param data on-wire data of the message.
+    /// @return true if the message is well formed, false otherwise.
+    bool fromData6(const OptionBuffer& data);
+
+    /// @brief Reads the information from a received DHCPv4 message.
+    ///
+    /// @param pkt message which hasn't been unpacked.
+    /// @return true if the message is a well formed client's message
+    /// carrying a message type, false otherwise.
+    bool fromPacket(const Pkt4& pkt) {
+        return (fromData4(pkt.data_));
+    }
+
+    /// @brief Reads the information from a received DHCPv6 message.
+    ///
+    /// @param pkt message which hasn't been unpacked.
+    /// @return true if the message is well formed, false otherwise.
+    bool fromPacket(const Pkt6& pkt) {
+        return (fromData6(pkt.data_));
+    }
+};
+
+/// @brief Rules dropping packets before they are queued.
+///
+/// Under overload the packet queue fills with packets which the server
+/// would drop or which are worth less than the others. These rules are
+/// evaluated by the queue in the receiver thread using the information
+/// read from the on-wire data, so as these packets are discarded before
+/// taking a place in the queue:
+/// - a client sending more packets per second than the configured rate
+///   gets the extra packets dropped,
+/// - a packet repeating the transaction id of a packet received from the
+///   same client within the same second is dropped,
+/// - a packet of a low priority message type is dropped when the queue
+///   is filled up to the configured threshold.
+///
+/// The rules count the packets they drop. The counters can be read at
+/// any time by another thread.
+class PacketDropRules {
+public:
+
+    /// @brief Numbers of packets dropped by each rule.
+    struct Counters {
+        /// @brief Constructor.
+        Counters()
+            : rate_limit_(0), duplicate_(0), low_priority_(0) {
+        }
+
+        /// @brief Dropped because the client exceeded its rate.
+        uint64_t rate_limit_;
+
+        /// @brief Dropped because the transaction id was repeated.
+        uint64_t duplicate_;
+
+        /// @brief Dropped because of their message type.
+        uint64_t low_priority_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param max_client_rate maximum number of packets accepted from a
+    /// client per second, 0 for no limit.
+    /// @param drop_duplicates drop the packets repeating a transaction id.
+    /// @param low_priority_types low priority message types.
+    /// @param low_priority_threshold queue fill, in percent of its capacity,
+    /// from which low priority messages are dropped.
+    ///
+    /// @throw BadValue if the threshold is greater than 100.
+    PacketDropRules(const uint32_t max_client_rate,
+                    const bool drop_duplicates,
+                    const std::set<uint8_t>& low_priority_types,
+                    const uint32_t low_priority_threshold);
+
+    /// @brief Creates the rules from the queue parameters.
+    ///
+    /// The parameters are the content of the dhcp-queue-control map. The
+    /// rules are specified by the optional "max-client-rate" (integer),
+    /// "drop-duplicates" (boolean), "low-priority-types" (list of integers)
+    /// and "low-priority-threshold" (integer, 50 by default) parameters.
+    ///
+    /// @param parameters queue parameters.
+    /// @return pointer to the rules or null if none is specified.
+    /// @throw InvalidQueueParameter if a parameter is invalid.
+    static boost::shared_ptr<PacketDropRules>
+    create(const data::ConstElementPtr& parameters);
+
+    /// @brief Checks if a packet should be dropped.
+    ///
+    /// This is not thread safe: it is expected to be called by the thread
+    /// enqueuing the packets only.
+    ///
+    /// @param info information read from the packet.
+    /// @param queue_size current number of packets in the queue.
+    /// @param capacity capacity of the queue.
+    /// @param now current time.
+    /// @return true if the packet should be dropped.
+    bool shouldDrop(const RawPacketInfo& info, const size_t queue_size,
+                    const size_t capacity, const time_t now);
+
+    /// @brief Returns the numbers of dropped packets.
+    Counters getCounters() const;
+
+    /// @brief Returns the numbers of dropped packets as a map.
+    data::ElementPtr getInfo() const;
+
+private:
+
+    /// @brief Packets received from a client in the current second.
+    struct ClientState {
+        /// @brief Constructor.
+        ClientState()
+            : count_(0), transids_() {
+        }
+
+        /// @brief Number of accepted packets.
+        uint32_t count_;
+
+        /// @brief Transaction ids of the accepted packets.
+        std::vector<uint32_t> transids_;
+    };
+
+    /// @brief Maximum number of packets per client per second.
+    uint32_t max_client_rate_;
+
+    /// @brief Drop the packets repeating a transaction id.
+    bool drop_duplicates_;
+
+    /// @brief Low priority message types.
+    std::set<uint8_t> low_priority_types_;
+
+    /// @brief Queue fill from which low priority messages are dropped.
+    uint32_t low_priority_threshold_;
+
+    /// @brief Second in which the clients' packets are counted.
+    time_t window_;
+
+    /// @brief Clients seen in the current second.
+    std::map<std::vector<uint8_t>, ClientState> clients_;
+
+    /// @brief Numbers of dropped packets.
+    Counters counters_;
+
+    /// @brief Mutex protecting the counters.
+    mutable isc::util::thread::Mutex mutex_;
+};
+
+/// @brief Pointer to the @c PacketDropRules.
+typedef boost::shared_ptr<PacketDropRules> PacketDropRulesPtr;
+
+}; // namespace isc::dhcp
+}; // namespace isc
+
+#endif // PACKET_DROP_RULES_H
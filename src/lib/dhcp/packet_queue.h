@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #define PACKET_QUEUE_H
 
 #include <cc/data.h>
+#include <dhcp/packet_drop_rules.h>
 #include <dhcp/socket_info.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
@@ -89,6 +90,17 @@ public:
     /// @brief Discards all packets currently in the buffer.
     virtual void clear() = 0;
 
+    /// @brief Returns the rules dropping packets before they are queued.
+    ///
+    /// Implementations applying @c PacketDropRules return them so as the
+    /// server can report the numbers of dropped packets. The default
+    /// implementation returns null.
+    ///
+    /// @return pointer to the rules or null if there is none.
+    virtual PacketDropRulesPtr getDropRules() const {
+        return (PacketDropRulesPtr());
+    }
+
     /// @brief Fetches operational information about the current state of
     /// the queue
     ///
@@ -1,10 +1,11 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <dhcp/packet_queue_priority.h>
 #include <dhcp/packet_queue_ring.h>
 #include <dhcp/packet_queue_mgr4.h>
 
@@ -14,6 +15,7 @@ namespace isc {
 namespace dhcp {
 
 const std::string PacketQueueMgr4::DEFAULT_QUEUE_TYPE4 = "kea-ring4";
+const std::string PacketQueueMgr4::PRIORITY_QUEUE_TYPE4 = "kea-priority4";
 
 PacketQueueMgr4::PacketQueueMgr4() {
     // Register default queue factory
@@ -27,7 +29,28 @@ PacketQueueMgr4::PacketQueueMgr4() {
                           " 'capacity' parameter is missing/invalid: " << ex.what());
             }
 
-            PacketQueue4Ptr queue(new PacketQueueRing4(DEFAULT_QUEUE_TYPE4, capacity));
+            boost::shared_ptr<PacketQueueRing4> queue(new PacketQueueRing4(DEFAULT_QUEUE_TYPE4, capacity));
+            try {
+                queue->setDropRules(PacketDropRules::create(parameters));
+            } catch (const std::exception& ex) {
+                isc_throw(InvalidQueueParameter, DEFAULT_QUEUE_TYPE4 << " factory: "
+                          << ex.what());
+            }
+            return (queue);
+        });
+
+    // Register priority queue factory
+    registerPacketQueueFactory(PRIORITY_QUEUE_TYPE4, [](data::ConstElementPtr parameters)
+                                          -> PacketQueue4Ptr {
+            boost::shared_ptr<PacketQueuePriority4> queue;
+            try {
+                queue.reset(new PacketQueuePriority4(PRIORITY_QUEUE_TYPE4,
+                    createPacketPriorityClasses(parameters, AF_INET)));
+                queue->setDropRules(PacketDropRules::create(parameters));
+            } catch (const std::exception& ex) {
+                isc_throw(InvalidQueueParameter, PRIORITY_QUEUE_TYPE4 << " factory: "
+                          << ex.what());
+            }
             return (queue);
         });
 }
@@ -1,10 +1,11 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <dhcp/packet_queue_priority.h>
 #include <dhcp/packet_queue_ring.h>
 #include <dhcp/packet_queue_mgr6.h>
 
@@ -14,6 +15,7 @@ namespace isc {
 namespace dhcp {
 
 const std::string PacketQueueMgr6::DEFAULT_QUEUE_TYPE6 = "kea-ring6";
+const std::string PacketQueueMgr6::PRIORITY_QUEUE_TYPE6 = "kea-priority6";
 
 PacketQueueMgr6::PacketQueueMgr6() {
     // Register default queue factory
@@ -27,7 +29,28 @@ PacketQueueMgr6::PacketQueueMgr6() {
                           " 'capacity' parameter is missing/invalid: " << ex.what());
             }
 
-            PacketQueue6Ptr queue(new PacketQueueRing6(DEFAULT_QUEUE_TYPE6, capacity));
+            boost::shared_ptr<PacketQueueRing6> queue(new PacketQueueRing6(DEFAULT_QUEUE_TYPE6, capacity));
+            try {
+                queue->setDropRules(PacketDropRules::create(parameters));
+            } catch (const std::exception& ex) {
+                isc_throw(InvalidQueueParameter, DEFAULT_QUEUE_TYPE6 << " factory: "
+                          << ex.what());
+            }
+            return (queue);
+        });
+
+    // Register priority queue factory
+    registerPacketQueueFactory(PRIORITY_QUEUE_TYPE6, [](data::ConstElementPtr parameters)
+                                          -> PacketQueue6Ptr {
+            boost::shared_ptr<PacketQueuePriority6> queue;
+            try {
+                queue.reset(new PacketQueuePriority6(PRIORITY_QUEUE_TYPE6,
+                    createPacketPriorityClasses(parameters, AF_INET6)));
+                queue->setDropRules(PacketDropRules::create(parameters));
+            } catch (const std::exception& ex) {
+                isc_throw(InvalidQueueParameter, PRIORITY_QUEUE_TYPE6 << " factory: "
+                          << ex.what());
+            }
             return (queue);
         });
 }
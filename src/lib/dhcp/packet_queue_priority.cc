@@ -0,0 +1,165 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/simple_parser.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/packet_queue_priority.h>
+
+#include <sys/socket.h>
+
+using namespace isc::data;
+
+namespace {
+
+/// @brief Reads a positive integer parameter of a priority class.
+///
+/// @param class_elem priority class map.
+/// @param name name of the parameter.
+/// @param default_value value returned when the parameter is absent,
+/// 0 if the parameter is mandatory.
+/// @return value of the parameter.
+/// @throw InvalidQueueParameter if the parameter is missing or invalid.
+uint32_t
+getClassInteger(const ConstElementPtr& class_elem, const std::string& name,
+                const uint32_t default_value) {
+    ConstElementPtr elem = class_elem->get(name);
+    if (!elem) {
+        if (default_value == 0) {
+            isc_throw(isc::dhcp::InvalidQueueParameter, "priority class '"
+                      << name << "' parameter is missing");
+        }
+        return (default_value);
+    }
+    if ((elem->getType() != Element::integer) || (elem->intValue() <= 0) ||
+        (elem->intValue() > 0xffffffff)) {
+        isc_throw(isc::dhcp::InvalidQueueParameter, "priority class '"
+                  << name << "' parameter must be a positive integer");
+    }
+    return (static_cast<uint32_t>(elem->intValue()));
+}
+
+/// @brief Creates a default priority class.
+///
+/// @param msg_types message types of the class.
+/// @param known_clients class limited to the clients having a lease.
+/// @param capacity capacity of the class.
+/// @param weight weight of the class.
+/// @return the priority class.
+isc::dhcp::PacketPriorityClass
+makeClass(const std::set<uint8_t>& msg_types, const bool known_clients,
+          const size_t capacity, const unsigned weight) {
+    isc::dhcp::PacketPriorityClass priority_class;
+    priority_class.msg_types_ = msg_types;
+    priority_class.known_clients_ = known_clients;
+    priority_class.capacity_ = capacity;
+    priority_class.weight_ = weight;
+    return (priority_class);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+PacketPriorityClasses
+createPacketPriorityClasses(const ConstElementPtr& parameters,
+                            const uint16_t family) {
+    PacketPriorityClasses classes;
+
+    ConstElementPtr classes_elem = parameters->get("classes");
+    if (!classes_elem) {
+        size_t capacity;
+        try {
+            capacity = SimpleParser::getInteger(parameters, "capacity");
+        } catch (const std::exception& ex) {
+            isc_throw(InvalidQueueParameter, "'capacity' parameter is"
+                      " required when 'classes' is absent: " << ex.what());
+        }
+
+        std::set<uint8_t> renewals;
+        std::set<uint8_t> new_clients;
+        if (family == AF_INET) {
+            renewals.insert(DHCPREQUEST);
+            new_clients.insert(DHCPDISCOVER);
+            classes.push_back(makeClass(renewals, true, capacity, 4));
+        } else {
+            renewals.insert(DHCPV6_RENEW);
+            renewals.insert(DHCPV6_REBIND);
+            new_clients.insert(DHCPV6_SOLICIT);
+            classes.push_back(makeClass(renewals, false, capacity, 4));
+        }
+        classes.push_back(makeClass(new_clients, false, capacity, 1));
+        classes.push_back(makeClass(std::set<uint8_t>(), false, capacity, 2));
+        return (classes);
+    }
+
+    if ((classes_elem->getType() != Element::list) || classes_elem->empty()) {
+        isc_throw(InvalidQueueParameter, "'classes' parameter must be a"
+                  " non empty list of priority classes");
+    }
+
+    for (size_t i = 0; i < classes_elem->size(); ++i) {
+        ConstElementPtr class_elem = classes_elem->get(i);
+        if (class_elem->getType() != Element::map) {
+            isc_throw(InvalidQueueParameter, "priority class must be a map");
+        }
+
+        PacketPriorityClass priority_class;
+        ConstElementPtr types = class_elem->get("message-types");
+        if (types) {
+            if (types->getType() != Element::list) {
+                isc_throw(InvalidQueueParameter, "priority class"
+                          " 'message-types' must be a list of message types");
+            }
+            for (size_t j = 0; j < types->size(); ++j) {
+                ConstElementPtr type = types->get(j);
+                if ((type->getType() != Element::integer) ||
+                    (type->intValue() < 0) || (type->intValue() > 255)) {
+                    isc_throw(InvalidQueueParameter, "priority class"
+                              " 'message-types' must be a list of message"
+                              " types");
+                }
+                priority_class.msg_types_.insert(static_cast<uint8_t>(type->intValue()));
+            }
+        }
+
+        ConstElementPtr known_clients = class_elem->get("known-clients");
+        if (known_clients) {
+            if (known_clients->getType() != Element::boolean) {
+                isc_throw(InvalidQueueParameter, "priority class"
+                          " 'known-clients' must be a boolean");
+            }
+            priority_class.known_clients_ = known_clients->boolValue();
+        }
+
+        priority_class.capacity_ = getClassInteger(class_elem, "capacity", 0);
+        priority_class.weight_ = getClassInteger(class_elem, "weight", 1);
+
+        ConstElementPtr drop_policy = class_elem->get("drop-policy");
+        if (drop_policy) {
+            if ((drop_policy->getType() != Element::string) ||
+                ((drop_policy->stringValue() != "drop-oldest") &&
+                 (drop_policy->stringValue() != "drop-newest"))) {
+                isc_throw(InvalidQueueParameter, "priority class"
+                          " 'drop-policy' must be 'drop-oldest' or"
+                          " 'drop-newest'");
+            }
+            if (drop_policy->stringValue() == "drop-newest") {
+                priority_class.drop_policy_ = PacketPriorityClass::DROP_NEWEST;
+            }
+        }
+
+        classes.push_back(priority_class);
+    }
+
+    return (classes);
+}
+
+}; // namespace isc::dhcp
+}; // namespace isc
@@ -0,0 +1,354 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PACKET_QUEUE_PRIORITY_H
+#define PACKET_QUEUE_PRIORITY_H
+
+#include <dhcp/packet_drop_rules.h>
+#include <dhcp/packet_queue.h>
+#include <util/threads/sync.h>
+
+#include <boost/circular_buffer.hpp>
+#include <ctime>
+#include <set>
+#include <vector>
+
+namespace isc {
+
+namespace dhcp {
+
+/// @brief Priority class of a @c PacketQueuePriority.
+///
+/// A class selects packets by their message type and by whether the
+/// client claims to have a lease. It holds up to its capacity packets and
+/// gets a number of packets, its weight, dequeued in turn.
+struct PacketPriorityClass {
+    /// @brief Policy applied when a packet is added to a full class.
+    enum DropPolicy {
+        DROP_OLDEST, ///< The oldest packet is dropped.
+        DROP_NEWEST  ///< The new packet is dropped.
+    };
+
+    /// @brief Constructor.
+    PacketPriorityClass()
+        : msg_types_(), known_clients_(false), capacity_(0), weight_(1),
+          drop_policy_(DROP_OLDEST) {
+    }
+
+    /// @brief Checks if a packet belongs to the class.
+    ///
+    /// @param info information read from the packet.
+    /// @return true if the packet belongs to the class.
+    bool matches(const RawPacketInfo& info) const {
+        return ((msg_types_.empty() || (msg_types_.count(info.msg_type_) > 0)) &&
+                (!known_clients_ || info.known_client_));
+    }
+
+    /// @brief Message types of the class, all types if empty.
+    std::set<uint8_t> msg_types_;
+
+    /// @brief Only the clients claiming to have a lease belong to the class.
+    bool known_clients_;
+
+    /// @brief Maximum number of packets in the class.
+    size_t capacity_;
+
+    /// @brief Number of packets dequeued in turn.
+    unsigned weight_;
+
+    /// @brief Policy applied when the class is full.
+    DropPolicy drop_policy_;
+};
+
+/// @brief List of priority classes, in the order they are checked.
+typedef std::vector<PacketPriorityClass> PacketPriorityClasses;
+
+/// @brief Creates the priority classes from the queue parameters.
+///
+/// The parameters are the content of the dhcp-queue-control map. The
+/// classes are specified by the optional "classes" list, each class being
+/// a map with the "message-types" (list of integers, all types if absent),
+/// "known-clients" (boolean, false by default), "capacity" (mandatory
+/// integer), "weight" (integer, 1 by default) and "drop-policy"
+/// ("drop-oldest" by default or "drop-newest") parameters. When the list
+/// is absent the default classes are used, each with the "capacity" of
+/// the queue:
+/// - renewals, i.e. DHCPREQUEST from known clients or Renew and Rebind,
+///   with a weight of 4,
+/// - DHCPDISCOVER or Solicit, with a weight of 1,
+/// - other messages with a weight of 2.
+///
+/// @param parameters queue parameters.
+/// @param family AF_INET or AF_INET6.
+/// @return the priority classes.
+/// @throw InvalidQueueParameter if a parameter is invalid.
+PacketPriorityClasses
+createPacketPriorityClasses(const data::ConstElementPtr& parameters,
+                            const uint16_t family);
+
+/// @brief Provides a priority-aware implementation of the PacketQueue
+/// interface.
+///
+/// The queue is made of priority classes, each with its own ring buffer.
+/// A packet is added to the first class it matches, or to the last class
+/// when it matches none. The classes are drained by weighted round robin:
+/// each non empty class gets up to its weight packets dequeued in turn.
+/// This way, when a flood of new clients fills the class of the DHCPDISCOVER
+/// messages, the renewals of the clients having a lease still get through.
+/// As the other queues it can apply early drop rules.
+///
+/// @tparam PacketTypePtr Type of packet the queue contains.
+/// This expected to be either isc::dhcp::Pkt4Ptr or isc::dhcp::Pkt6Ptr
+template<typename PacketTypePtr>
+class PacketQueuePriority : public PacketQueue<PacketTypePtr> {
+public:
+
+    /// @brief Constructor
+    ///
+    /// @param queue_type logical name of the queue implementation
+    /// @param classes priority classes of the queue.
+    ///
+    /// @throw BadValue if there is no class or a class has no capacity or
+    /// no weight.
+    PacketQueuePriority(const std::string& queue_type,
+                        const PacketPriorityClasses& classes)
+        : PacketQueue<PacketTypePtr>(queue_type), classes_(), current_(0),
+          credit_(0), drop_rules_() {
+        if (classes.empty()) {
+            isc_throw(BadValue, "a priority queue requires at least one class");
+        }
+        for (auto c = classes.begin(); c != classes.end(); ++c) {
+            if ((c->capacity_ == 0) || (c->weight_ == 0)) {
+                isc_throw(BadValue, "the capacity and the weight of a priority"
+                          " class must be greater than 0");
+            }
+            classes_.push_back(ClassQueue(*c));
+        }
+    }
+
+    /// @brief virtual Destructor
+    virtual ~PacketQueuePriority(){};
+
+    /// @brief Adds a packet to the queue
+    ///
+    /// The packet is added to the first class it matches or to the last
+    /// class, unless the early drop rules drop it.
+    ///
+    /// @param packet packet to enqueue
+    /// @param source socket the packet came from
+    virtual void enqueuePacket(PacketTypePtr packet, const SocketInfo& /* source */) {
+        RawPacketInfo info;
+        const bool valid = info.fromPacket(*packet);
+        if (valid && drop_rules_ &&
+            drop_rules_->shouldDrop(info, getSize(), getCapacity(), time(NULL))) {
+            return;
+        }
+
+        // Packets which can't be classified go to the last class, the
+        // server will drop them after it fails to unpack them.
+        size_t index = classes_.size() - 1;
+        if (valid) {
+            for (size_t i = 0; i < classes_.size() - 1; ++i) {
+                if (classes_[i].class_.matches(info)) {
+                    index = i;
+                    break;
+                }
+            }
+        }
+
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        ClassQueue& cq = classes_[index];
+        if (cq.queue_.full()) {
+            ++cq.dropped_;
+            if (cq.class_.drop_policy_ == PacketPriorityClass::DROP_NEWEST) {
+                return;
+            }
+        }
+        cq.queue_.push_back(packet);
+    }
+
+    /// @brief Dequeues the next packet from the queue
+    ///
+    /// The class in turn provides the packet, unless it is empty or it
+    /// already provided as many packets as its weight: in this case the
+    /// turn goes to the next class.
+    ///
+    /// @return A pointer to dequeued packet, or an empty pointer
+    /// if the queue is empty.
+    virtual PacketTypePtr dequeuePacket() {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        // Each class is visited at least once with a full credit.
+        for (size_t visited = 0; visited <= classes_.size(); ++visited) {
+            ClassQueue& cq = classes_[current_];
+            if (!cq.queue_.empty() && (credit_ < cq.class_.weight_)) {
+                ++credit_;
+                PacketTypePtr packet = cq.queue_.front();
+                cq.queue_.pop_front();
+                return (packet);
+            }
+            current_ = (current_ + 1) % classes_.size();
+            credit_ = 0;
+        }
+        return (PacketTypePtr());
+    }
+
+    /// @brief Returns True if the queue is empty.
+    virtual bool empty() const {
+        return (getSize() == 0);
+    }
+
+    /// @brief Returns the maximum number of packets in the queue, i.e.
+    /// the sum of the capacities of the classes.
+    size_t getCapacity() const {
+        size_t capacity = 0;
+        for (auto cq = classes_.begin(); cq != classes_.end(); ++cq) {
+            capacity += cq->queue_.capacity();
+        }
+        return (capacity);
+    }
+
+    /// @brief Returns the current number of packets in the queue.
+    virtual size_t getSize() const {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        size_t size = 0;
+        for (auto cq = classes_.begin(); cq != classes_.end(); ++cq) {
+            size += cq->queue_.size();
+        }
+        return (size);
+    }
+
+    /// @brief Discards all packets currently in the queue.
+    virtual void clear() {
+        isc::util::thread::Mutex::Locker lock(mutex_);
+        for (auto cq = classes_.begin(); cq != classes_.end(); ++cq) {
+            cq->queue_.clear();
+        }
+        current_ = 0;
+        credit_ = 0;
+    }
+
+    /// @brief Sets the early drop rules.
+    ///
+    /// It is not thread safe: it is expected to be called before the
+    /// queue is used.
+    ///
+    /// @param drop_rules rules to apply to the packets being queued, null
+    /// to queue all packets.
+    void setDropRules(const PacketDropRulesPtr& drop_rules) {
+        drop_rules_ = drop_rules;
+    }
+
+    /// @brief Returns the early drop rules.
+    ///
+    /// @return pointer to the rules or null if there is none.
+    virtual PacketDropRulesPtr getDropRules() const {
+        return (drop_rules_);
+    }
+
+    /// @brief Fetches pertinent information
+    ///
+    /// In addition to the total capacity and size, it includes for each
+    /// class its capacity, size and the number of packets it dropped
+    /// because it was full.
+    virtual data::ElementPtr getInfo() const {
+        data::ElementPtr info = PacketQueue<PacketTypePtr>::getInfo();
+        info->set("capacity", data::Element::create(static_cast<int64_t>(getCapacity())));
+        info->set("size", data::Element::create(static_cast<int64_t>(getSize())));
+        data::ElementPtr classes = data::Element::createList();
+        {
+            isc::util::thread::Mutex::Locker lock(mutex_);
+            for (auto cq = classes_.begin(); cq != classes_.end(); ++cq) {
+                data::ElementPtr class_info = data::Element::createMap();
+                class_info->set("capacity", data::Element::create(
+                    static_cast<int64_t>(cq->queue_.capacity())));
+                class_info->set("size", data::Element::create(
+                    static_cast<int64_t>(cq->queue_.size())));
+                class_info->set("overflow", data::Element::create(
+                    static_cast<int64_t>(cq->dropped_)));
+                classes->add(class_info);
+            }
+        }
+        info->set("classes", classes);
+        if (drop_rules_) {
+            info->set("dropped", drop_rules_->getInfo());
+        }
+        return (info);
+    }
+
+private:
+
+    /// @brief Priority class with its packets.
+    struct ClassQueue {
+        /// @brief Constructor.
+        ///
+        /// @param priority_class configuration of the class.
+        explicit ClassQueue(const PacketPriorityClass& priority_class)
+            : class_(priority_class), queue_(priority_class.capacity_),
+              dropped_(0) {
+        }
+
+        /// @brief Configuration of the class.
+        PacketPriorityClass class_;
+
+        /// @brief Packets of the class.
+        boost::circular_buffer<PacketTypePtr> queue_;
+
+        /// @brief Number of packets dropped because the class was full.
+        uint64_t dropped_;
+    };
+
+    /// @brief Priority classes.
+    std::vector<ClassQueue> classes_;
+
+    /// @brief Index of the class in turn.
+    size_t current_;
+
+    /// @brief Number of packets the class in turn provided.
+    unsigned credit_;
+
+    /// @brief Early drop rules.
+    PacketDropRulesPtr drop_rules_;
+
+    /// @brief Mutex for protecting queue accesses.
+    mutable isc::util::thread::Mutex mutex_;
+};
+
+/// @brief DHCPv4 priority packet queue
+class PacketQueuePriority4 : public PacketQueuePriority<Pkt4Ptr> {
+public:
+    /// @brief Constructor
+    ///
+    /// @param queue_type logical name of the queue implementation
+    /// @param classes priority classes of the queue.
+    PacketQueuePriority4(const std::string& queue_type,
+                         const PacketPriorityClasses& classes)
+        : PacketQueuePriority(queue_type, classes) {
+    };
+
+    /// @brief virtual Destructor
+    virtual ~PacketQueuePriority4(){}
+};
+
+/// @brief DHCPv6 priority packet queue
+class PacketQueuePriority6 : public PacketQueuePriority<Pkt6Ptr> {
+public:
+    /// @brief Constructor
+    ///
+    /// @param queue_type logical name of the queue implementation
+    /// @param classes priority classes of the queue.
+    PacketQueuePriority6(const std::string& queue_type,
+                         const PacketPriorityClasses& classes)
+        : PacketQueuePriority(queue_type, classes) {
+    };
+
+    /// @brief virtual Destructor
+    virtual ~PacketQueuePriority6(){}
+};
+
+}; // namespace isc::dhcp
+}; // namespace isc
+
+#endif // PACKET_QUEUE_PRIORITY_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,11 +7,13 @@
 #ifndef PACKET_QUEUE_RING_H
 #define PACKET_QUEUE_RING_H
 
+#include <dhcp/packet_drop_rules.h>
 #include <dhcp/packet_queue.h>
 #include <util/threads/sync.h>
 
 #include <boost/function.hpp>
 #include <boost/circular_buffer.hpp>
+#include <ctime>
 #include <sstream>
 
 namespace isc {
@@ -34,7 +36,7 @@ public:
     /// @param queue_type logical name of the queue implementation
     /// @param capacity maximum number of packets the queue can hold
     PacketQueueRing(const std::string& queue_type, size_t capacity)
-        : PacketQueue<PacketTypePtr>(queue_type) {
+        : PacketQueue<PacketTypePtr>(queue_type), drop_rules_() {
         queue_.set_capacity(capacity);
     }
 
@@ -74,13 +76,46 @@ public:
     /// or added to the queue. Derivations are expected to provide
     /// implementations based on their own requirements.  Bear in mind
     /// that the packet has NOT been unpacked at this point. The default
-    /// implementation simply returns false (i.e. keep the packet).
+    /// implementation applies the early drop rules, if any, to the
+    /// information read from the on-wire data. The packets which this
+    /// information can't be read from are kept, the server will drop
+    /// them after it fails to unpack them.
+    ///
+    /// @param packet packet to examine.
     ///
     /// @return true if the packet should be dropped, false if it should be
     /// kept.
-    virtual bool shouldDropPacket(PacketTypePtr /* packet */,
+    virtual bool shouldDropPacket(PacketTypePtr packet,
                             const SocketInfo& /* source */) {
-        return (false);
+        if (!drop_rules_) {
+            return (false);
+        }
+
+        RawPacketInfo info;
+        if (!info.fromPacket(*packet)) {
+            return (false);
+        }
+
+        return (drop_rules_->shouldDrop(info, getSize(), getCapacity(),
+                                        time(NULL)));
+    }
+
+    /// @brief Sets the early drop rules.
+    ///
+    /// It is not thread safe: it is expected to be called before the
+    /// queue is used.
+    ///
+    /// @param drop_rules rules to apply to the packets being queued, null
+    /// to queue all packets.
+    void setDropRules(const PacketDropRulesPtr& drop_rules) {
+        drop_rules_ = drop_rules;
+    }
+
+    /// @brief Returns the early drop rules.
+    ///
+    /// @return pointer to the rules or null if there is none.
+    virtual PacketDropRulesPtr getDropRules() const {
+        return (drop_rules_);
     }
 
     /// @brief Discards packets from one end of the queue.
@@ -201,6 +236,9 @@ public:
        data::ElementPtr info = PacketQueue<PacketTypePtr>::getInfo();
        info->set("capacity", data::Element::create(static_cast<int64_t>(getCapacity())));
        info->set("size", data::Element::create(static_cast<int64_t>(getSize())));
+       if (drop_rules_) {
+           info->set("dropped", drop_rules_->getInfo());
+       }
        return(info);
     }
 
@@ -211,14 +249,17 @@ private:
 
     /// @brief Mutex for protecting queue accesses.
     isc::util::thread::Mutex mutex_;
+
+    /// @brief Early drop rules.
+    PacketDropRulesPtr drop_rules_;
 };
 
 
 /// @brief DHCPv4 packet queue buffer implementation
 ///
-/// This implementation does not (currently) add any drop
-/// or packet skip logic, it operates as a verbatim ring
-/// queue for DHCPv4 packets.
+/// This implementation does not (currently) add any packet
+/// skip logic, it operates as a ring queue for DHCPv4 packets
+/// which drops packets only according to its early drop rules.
 ///
 class PacketQueueRing4 : public PacketQueueRing<Pkt4Ptr> {
 public:
@@ -236,9 +277,9 @@ public:
 
 /// @brief DHCPv6 packet queue buffer implementation
 ///
-/// This implementation does not (currently) add any drop
-/// or packet skip logic, it operates as a verbatim ring
-/// queue for DHCPv6 packets.
+/// This implementation does not (currently) add any packet
+/// skip logic, it operates as a ring queue for DHCPv6 packets
+/// which drops packets only according to its early drop rules.
 ///
 class PacketQueueRing6 : public PacketQueueRing<Pkt6Ptr> {
 public:
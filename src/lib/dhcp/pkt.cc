@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -109,6 +109,28 @@ Pkt::updateTimestamp() {
     timestamp_ = boost::posix_time::microsec_clock::universal_time();
 }
 
+void
+Pkt::markStage(const Stage stage) {
+    stage_times_[stage] = boost::posix_time::microsec_clock::universal_time();
+}
+
+const char*
+Pkt::stageToText(const Stage stage) {
+    switch (stage) {
+    case STAGE_DEQUEUED:
+        return ("dequeued");
+    case STAGE_SUBNET_SELECTED:
+        return ("subnet-selected");
+    case STAGE_LEASE_ALLOCATED:
+        return ("lease-allocated");
+    case STAGE_SENT:
+        return ("sent");
+    default:
+        ;
+    }
+    return ("unknown");
+}
+
 void Pkt::repack() {
     if (!data_.empty()) {
         buffer_out_.writeData(&data_[0], data_.size());
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -126,6 +126,22 @@ protected:
 
 public:
 
+    /// @brief Processing stages timestamped by the server.
+    ///
+    /// The time of each stage reached by a received packet is recorded, so
+    /// as the latency of the stages can be computed when the response is
+    /// sent. The packet reception itself is not a stage: its time is the
+    /// packet timestamp (see @ref getTimestamp).
+    enum Stage {
+        STAGE_DEQUEUED,        ///< taken from the receive queue
+        STAGE_SUBNET_SELECTED, ///< subnet selected for the client
+        STAGE_LEASE_ALLOCATED, ///< lease allocated (or renewed)
+        STAGE_SENT             ///< response sent
+    };
+
+    /// @brief Number of processing stages.
+    static const size_t STAGES_NUM = STAGE_SENT + 1;
+
     /// @brief Prepares on-wire format of DHCP (either v4 or v6) packet.
     ///
     /// Prepares on-wire format of message and all its options.
@@ -396,6 +412,29 @@ public:
         return timestamp_;
     }
 
+    /// @brief Records the time at which a processing stage is reached.
+    ///
+    /// The time is taken from the same clock as the packet timestamp. A
+    /// stage which is reached several times (e.g. a lease allocated for
+    /// each IA) keeps the last time.
+    ///
+    /// @param stage processing stage
+    void markStage(const Stage stage);
+
+    /// @brief Returns the time at which a processing stage was reached.
+    ///
+    /// @param stage processing stage
+    /// @return time of the stage, not_a_date_time if it was not reached.
+    const boost::posix_time::ptime& getStageTime(const Stage stage) const {
+        return (stage_times_[stage]);
+    }
+
+    /// @brief Returns the name of a processing stage.
+    ///
+    /// @param stage processing stage
+    /// @return the name, e.g. "subnet-selected", used in statistic names.
+    static const char* stageToText(const Stage stage);
+
     /// @brief Copies content of input buffer to output buffer.
     ///
     /// This is mostly a diagnostic function. It is being used for sending
@@ -764,6 +803,9 @@ protected:
     /// packet timestamp
     boost::posix_time::ptime timestamp_;
 
+    /// times of the processing stages (not_a_date_time until reached)
+    boost::posix_time::ptime stage_times_[STAGES_NUM];
+
     // remote HW address (src if receiving packet, dst if sending packet)
     HWAddrPtr remote_hwaddr_;
 
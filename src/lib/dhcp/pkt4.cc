@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -125,8 +125,8 @@ Pkt4::pack() {
 
         // write (len) bytes of padding
         if (hw_len > 0) {
-            vector<uint8_t> zeros(hw_len, 0);
-            buffer_out_.writeData(&zeros[0], hw_len);
+            static const uint8_t zeros[MAX_CHADDR_LEN] = { 0 };
+            buffer_out_.writeData(zeros, hw_len);
         }
 
         buffer_out_.writeData(sname_, MAX_SNAME_LEN);
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -291,8 +291,11 @@ Pkt6::packUDP() {
             // then it will be equal to "regular" length + relay-forw header +
             // size of relay-msg option header + possibly size of interface-id
             // option (if present). If there is more than one relay, the whole
-            // process is called iteratively for each relay.
-            calculateRelaySizes();
+            // process is called iteratively for each relay. The total size
+            // is used to size the buffer once for the whole message.
+            buffer_out_.reserve(calculateRelaySizes());
+
+            uint8_t addr_data[isc::asiolink::V6ADDRESS_LEN];
 
             // Now for each relay, we need to...
             for (vector<RelayInfo>::iterator relay = relay_info_.begin();
@@ -301,10 +304,10 @@ Pkt6::packUDP() {
                 // build relay-forw/relay-repl header (see RFC 8415, section 9)
                 buffer_out_.writeUint8(relay->msg_type_);
                 buffer_out_.writeUint8(relay->hop_count_);
-                buffer_out_.writeData(&(relay->linkaddr_.toBytes()[0]),
-                                     isc::asiolink::V6ADDRESS_LEN);
-                buffer_out_.writeData(&relay->peeraddr_.toBytes()[0],
-                                     isc::asiolink::V6ADDRESS_LEN);
+                relay->linkaddr_.toBytes(addr_data);
+                buffer_out_.writeData(addr_data, isc::asiolink::V6ADDRESS_LEN);
+                relay->peeraddr_.toBytes(addr_data);
+                buffer_out_.writeData(addr_data, isc::asiolink::V6ADDRESS_LEN);
 
                 // store every option in this relay scope. Usually that will be
                 // only interface-id, but occasionally other options may be
@@ -413,11 +416,10 @@ Pkt6::unpackMsg(OptionBuffer::const_iterator begin,
     // perhaps for stats gathering we can uncomment this.
     //    size -= sizeof(uint32_t); // We just parsed 4 bytes header
 
-    OptionBuffer opt_buffer(begin, end);
-
-    // If custom option parsing function has been set, use this function
-    // to parse options. Otherwise, use standard function from libdhcp.
-    size_t offset = LibDHCP::unpackOptions6(opt_buffer, DHCP6_OPTION_SPACE, options_);
+    // Parse the options in place: the inner message of a relayed packet
+    // is a part of the packet buffer which does not need to be copied.
+    size_t offset = LibDHCP::unpackOptions6(begin, end, DHCP6_OPTION_SPACE,
+                                            options_);
 
     // If offset is not equal to the size, then something is wrong here. We
     // either parsed past input buffer (bug in our code) or we haven't parsed
@@ -462,12 +464,11 @@ Pkt6::unpackRelayMsg() {
         offset += isc::asiolink::V6ADDRESS_LEN;
         bufsize -= DHCPV6_RELAY_HDR_LEN; // 34 bytes (1+1+16+16)
 
-        // parse the rest as options
-        OptionBuffer opt_buffer(&data_[offset], &data_[offset] + bufsize);
-
-        // If custom option parsing function has been set, use this function
-        // to parse options. Otherwise, use standard function from libdhcp.
-        LibDHCP::unpackOptions6(opt_buffer, DHCP6_OPTION_SPACE, relay.options_,
+        // parse the rest as options, directly from the packet buffer so
+        // as each relay level is parsed without copying the remaining data.
+        LibDHCP::unpackOptions6(data_.begin() + offset,
+                                data_.begin() + offset + bufsize,
+                                DHCP6_OPTION_SPACE, relay.options_,
                                 &relay_msg_offset, &relay_msg_len);
 
         /// @todo: check that each option appears at most once
@@ -479,8 +480,12 @@ Pkt6::unpackRelayMsg() {
             isc_throw(BadValue, "Mandatory relay-msg option missing");
         }
 
-        // store relay information parsed so far
+        // store relay information parsed so far. The options are moved
+        // rather than copied into the stored relay information.
+        OptionCollection relay_options;
+        relay_options.swap(relay.options_);
         addRelayInfo(relay);
+        relay_info_.back().options_.swap(relay_options);
 
         /// @todo: implement ERO (Echo Request Option, RFC 4994) here
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -526,6 +526,8 @@ PktFilterBPF::receive(Iface& iface, const SocketInfo& socket_info) {
     // Decode DHCP data into the Pkt4 object.
     Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(&dhcp_buf[0], dhcp_buf.size()));
 
+    pkt->updateTimestamp();
+
     // Set the appropriate packet members using data collected from
     // the decoded headers.
     pkt->setIndex(iface.getIndex());
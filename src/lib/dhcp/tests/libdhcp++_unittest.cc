@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -571,6 +571,43 @@ TEST_F(LibDhcpTest, unpackEmptyOption6) {
     EXPECT_EQ(4, option_empty->len());
 }
 
+// Check that a part of a buffer can be parsed as DHCPv6 options and
+// that the relay-msg option offset is relative to this part.
+TEST_F(LibDhcpTest, unpackOptions6Range) {
+    const uint8_t raw_data[] = {
+      0xde, 0xad, 0xbe, 0xef,    // data which is not parsed
+      0x00, 0x12, 0x00, 0x02,    // interface-id, length 2
+      0x01, 0x02,
+      0x00, 0x09, 0x00, 0x04,    // relay-msg, length 4
+      0x01, 0x00, 0x00, 0x01,
+      0xde, 0xad                 // data which is not parsed
+    };
+    OptionBuffer buf(raw_data, raw_data + sizeof(raw_data));
+
+    OptionCollection options;
+    size_t relay_msg_offset = 0;
+    size_t relay_msg_len = 0;
+    size_t offset = 0;
+    ASSERT_NO_THROW(offset = LibDHCP::unpackOptions6(buf.begin() + 4,
+                                                     buf.end() - 2,
+                                                     DHCP6_OPTION_SPACE,
+                                                     options,
+                                                     &relay_msg_offset,
+                                                     &relay_msg_len));
+    EXPECT_EQ(14, offset);
+    EXPECT_EQ(10, relay_msg_offset);
+    EXPECT_EQ(4, relay_msg_len);
+
+    // The relay-msg option is not stored.
+    ASSERT_EQ(1, options.size());
+    OptionPtr interface_id = options.begin()->second;
+    ASSERT_TRUE(interface_id);
+    EXPECT_EQ(D6O_INTERFACE_ID, interface_id->getType());
+    ASSERT_EQ(2, interface_id->getData().size());
+    EXPECT_EQ(0x01, interface_id->getData()[0]);
+    EXPECT_EQ(0x02, interface_id->getData()[1]);
+}
+
 // This test verifies that the following option structure can be parsed:
 // - option (option space 'foobar')
 //   - sub option (option space 'foo')
@@ -0,0 +1,242 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/packet_drop_rules.h>
+#include <dhcp/packet_queue.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Creates a DHCPv4 message as received from the wire.
+///
+/// @param type message type.
+/// @param transid transaction id.
+/// @param mac last byte of the client's hardware address.
+/// @return pointer to the message which hasn't been unpacked.
+Pkt4Ptr
+createPkt4(const uint8_t type, const uint32_t transid, const uint8_t mac) {
+    Pkt4 pkt(type, transid);
+    pkt.setHWAddr(HWAddrPtr(new HWAddr(std::vector<uint8_t>(6, mac),
+                                       HTYPE_ETHER)));
+    pkt.pack();
+    const uint8_t* data =
+        static_cast<const uint8_t*>(pkt.getBuffer().getData());
+    return (Pkt4Ptr(new Pkt4(data, pkt.getBuffer().getLength())));
+}
+
+/// @brief Creates a DHCPv6 message as received from the wire.
+///
+/// @param type message type.
+/// @param transid transaction id.
+/// @param duid last byte of the client's DUID.
+/// @param relays number of relays the message went through.
+/// @return pointer to the message which hasn't been unpacked.
+Pkt6Ptr
+createPkt6(const uint8_t type, const uint32_t transid, const uint8_t duid,
+           const unsigned relays = 0) {
+    Pkt6 pkt(type, transid);
+    pkt.addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID,
+                                       OptionBuffer(10, duid))));
+    for (unsigned i = 0; i < relays; ++i) {
+        Pkt6::RelayInfo relay;
+        relay.msg_type_ = DHCPV6_RELAY_FORW;
+        relay.hop_count_ = i;
+        relay.linkaddr_ = IOAddress("2001:db8:1::1");
+        relay.peeraddr_ = IOAddress("fe80::1");
+        relay.options_.insert(std::make_pair(D6O_INTERFACE_ID,
+            OptionPtr(new Option(Option::V6, D6O_INTERFACE_ID,
+                                 OptionBuffer(4, i)))));
+        pkt.addRelayInfo(relay);
+    }
+    pkt.pack();
+    const uint8_t* data =
+        static_cast<const uint8_t*>(pkt.getBuffer().getData());
+    return (Pkt6Ptr(new Pkt6(data, pkt.getBuffer().getLength())));
+}
+
+// This test verifies that the information is read from DHCPv4 messages.
+TEST(RawPacketInfoTest, fromPacket4) {
+    RawPacketInfo info;
+    ASSERT_TRUE(info.fromPacket(*createPkt4(DHCPREQUEST, 0x12345678, 7)));
+    EXPECT_EQ(DHCPREQUEST, info.msg_type_);
+    EXPECT_EQ(0x12345678, info.transid_);
+    std::vector<uint8_t> client(7, 7);
+    client[0] = HTYPE_ETHER;
+    EXPECT_TRUE(info.client_ == client);
+    EXPECT_FALSE(info.known_client_);
+
+    // A client having a lease sets the ciaddr.
+    Pkt4Ptr pkt = createPkt4(DHCPREQUEST, 0x12345678, 7);
+    pkt->data_[12] = 192;
+    ASSERT_TRUE(info.fromPacket(*pkt));
+    EXPECT_TRUE(info.known_client_);
+
+    // A truncated message is rejected.
+    pkt = createPkt4(DHCPREQUEST, 0x12345678, 7);
+    pkt->data_.resize(Pkt4::DHCPV4_PKT_HDR_LEN);
+    EXPECT_FALSE(RawPacketInfo().fromPacket(*pkt));
+
+    // A message without a message type is rejected.
+    pkt = createPkt4(DHCPREQUEST, 0x12345678, 7);
+    pkt->data_.resize(Pkt4::DHCPV4_PKT_HDR_LEN + 4);
+    EXPECT_FALSE(RawPacketInfo().fromPacket(*pkt));
+
+    // A server's message is rejected.
+    pkt = createPkt4(DHCPREQUEST, 0x12345678, 7);
+    pkt->data_[0] = BOOTREPLY;
+    EXPECT_FALSE(RawPacketInfo().fromPacket(*pkt));
+}
+
+// This test verifies that the information is read from DHCPv6 messages,
+// relayed or not.
+TEST(RawPacketInfoTest, fromPacket6) {
+    for (unsigned relays = 0; relays < 3; ++relays) {
+        SCOPED_TRACE(relays);
+        RawPacketInfo info;
+        ASSERT_TRUE(info.fromPacket(*createPkt6(DHCPV6_RENEW, 0x123456, 9,
+                                                relays)));
+        EXPECT_EQ(DHCPV6_RENEW, info.msg_type_);
+        EXPECT_EQ(0x123456, info.transid_);
+        EXPECT_TRUE(info.client_ == std::vector<uint8_t>(10, 9));
+        EXPECT_TRUE(info.known_client_);
+    }
+
+    // A message without client identifier is accepted.
+    Pkt6 pkt(DHCPV6_SOLICIT, 0x123456);
+    pkt.pack();
+    Pkt6 received(static_cast<const uint8_t*>(pkt.getBuffer().getData()),
+                  pkt.getBuffer().getLength());
+    RawPacketInfo info;
+    ASSERT_TRUE(info.fromPacket(received));
+    EXPECT_EQ(DHCPV6_SOLICIT, info.msg_type_);
+    EXPECT_TRUE(info.client_.empty());
+    EXPECT_FALSE(info.known_client_);
+
+    // A relayed message without relayed message is rejected.
+    Pkt6Ptr relayed = createPkt6(DHCPV6_RENEW, 0x123456, 9, 1);
+    relayed->data_.resize(Pkt6::DHCPV6_RELAY_HDR_LEN);
+    EXPECT_FALSE(RawPacketInfo().fromPacket(*relayed));
+}
+
+// This test verifies that the rules are created from the queue parameters.
+TEST(PacketDropRulesTest, create) {
+    // No rules.
+    ElementPtr params = Element::fromJSON("{ \"capacity\": 10 }");
+    EXPECT_FALSE(PacketDropRules::create(params));
+    params = Element::fromJSON("{ \"max-client-rate\": 0,"
+                               " \"drop-duplicates\": false,"
+                               " \"low-priority-types\": [ ] }");
+    EXPECT_FALSE(PacketDropRules::create(params));
+
+    // Valid rules.
+    params = Element::fromJSON("{ \"max-client-rate\": 4,"
+                               " \"drop-duplicates\": true,"
+                               " \"low-priority-types\": [ 1, 3 ],"
+                               " \"low-priority-threshold\": 80 }");
+    PacketDropRulesPtr rules;
+    ASSERT_NO_THROW(rules = PacketDropRules::create(params));
+    ASSERT_TRUE(rules);
+    EXPECT_TRUE(rules->getInfo()->equals(*Element::fromJSON(
+        "{ \"rate-limit\": 0, \"duplicate\": 0, \"low-priority\": 0 }")));
+
+    // Invalid rules.
+    const char* invalid[] = {
+        "{ \"max-client-rate\": -1 }",
+        "{ \"max-client-rate\": \"4\" }",
+        "{ \"drop-duplicates\": 1 }",
+        "{ \"low-priority-types\": 1 }",
+        "{ \"low-priority-types\": [ 256 ] }",
+        "{ \"low-priority-types\": [ 1 ], \"low-priority-threshold\": 101 }"
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        EXPECT_THROW(PacketDropRules::create(Element::fromJSON(invalid[i])),
+                     InvalidQueueParameter) << invalid[i];
+    }
+}
+
+// This test verifies that the packets of a client exceeding its rate are
+// dropped.
+TEST(PacketDropRulesTest, rateLimit) {
+    PacketDropRules rules(2, false, std::set<uint8_t>(), 50);
+    RawPacketInfo info;
+    ASSERT_TRUE(info.fromPacket(*createPkt4(DHCPDISCOVER, 1, 1)));
+    RawPacketInfo other;
+    ASSERT_TRUE(other.fromPacket(*createPkt4(DHCPDISCOVER, 1, 2)));
+
+    EXPECT_FALSE(rules.shouldDrop(info, 0, 10, 1000));
+    EXPECT_FALSE(rules.shouldDrop(info, 0, 10, 1000));
+    EXPECT_TRUE(rules.shouldDrop(info, 0, 10, 1000));
+    EXPECT_FALSE(rules.shouldDrop(other, 0, 10, 1000));
+
+    // The next second the client can send packets again.
+    EXPECT_FALSE(rules.shouldDrop(info, 0, 10, 1001));
+    EXPECT_EQ(1, rules.getCounters().rate_limit_);
+    EXPECT_EQ(0, rules.getCounters().duplicate_);
+    EXPECT_EQ(0, rules.getCounters().low_priority_);
+}
+
+// This test verifies that the packets repeating a transaction id are
+// dropped.
+TEST(PacketDropRulesTest, duplicates) {
+    PacketDropRules rules(0, true, std::set<uint8_t>(), 50);
+    RawPacketInfo info;
+    ASSERT_TRUE(info.fromPacket(*createPkt6(DHCPV6_SOLICIT, 1, 1, 1)));
+    RawPacketInfo next;
+    ASSERT_TRUE(next.fromPacket(*createPkt6(DHCPV6_SOLICIT, 2, 1)));
+    RawPacketInfo other;
+    ASSERT_TRUE(other.fromPacket(*createPkt6(DHCPV6_SOLICIT, 1, 2)));
+
+    EXPECT_FALSE(rules.shouldDrop(info, 0, 10, 1000));
+    EXPECT_TRUE(rules.shouldDrop(info, 0, 10, 1000));
+    EXPECT_FALSE(rules.shouldDrop(next, 0, 10, 1000));
+    EXPECT_FALSE(rules.shouldDrop(other, 0, 10, 1000));
+
+    // The retransmission in the next second is accepted.
+    EXPECT_FALSE(rules.shouldDrop(info, 0, 10, 1001));
+    EXPECT_EQ(0, rules.getCounters().rate_limit_);
+    EXPECT_EQ(1, rules.getCounters().duplicate_);
+
+    // Packets which don't identify the client are not checked.
+    RawPacketInfo anonymous;
+    anonymous.msg_type_ = DHCPV6_SOLICIT;
+    EXPECT_FALSE(rules.shouldDrop(anonymous, 0, 10, 1001));
+    EXPECT_FALSE(rules.shouldDrop(anonymous, 0, 10, 1001));
+}
+
+// This test verifies that the low priority messages are dropped when the
+// queue is filled up to the threshold.
+TEST(PacketDropRulesTest, lowPriority) {
+    std::set<uint8_t> types;
+    types.insert(DHCPDISCOVER);
+    PacketDropRules rules(0, false, types, 80);
+    RawPacketInfo discover;
+    ASSERT_TRUE(discover.fromPacket(*createPkt4(DHCPDISCOVER, 1, 1)));
+    RawPacketInfo request;
+    ASSERT_TRUE(request.fromPacket(*createPkt4(DHCPREQUEST, 1, 1)));
+
+    EXPECT_FALSE(rules.shouldDrop(discover, 7, 10, 1000));
+    EXPECT_TRUE(rules.shouldDrop(discover, 8, 10, 1000));
+    EXPECT_FALSE(rules.shouldDrop(request, 9, 10, 1000));
+    EXPECT_EQ(1, rules.getCounters().low_priority_);
+    EXPECT_TRUE(rules.getInfo()->equals(*Element::fromJSON(
+        "{ \"rate-limit\": 0, \"duplicate\": 0, \"low-priority\": 1 }")));
+}
+
+}
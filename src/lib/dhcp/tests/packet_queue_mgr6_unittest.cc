@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,6 +6,8 @@
 
 #include <config.h>
 
+#include <dhcp/dhcp6.h>
+#include <dhcp/packet_queue_priority.h>
 #include <dhcp/packet_queue_ring.h>
 #include <dhcp/packet_queue_mgr6.h>
 #include <dhcp/tests/packet_queue_testutils.h>
@@ -130,4 +132,50 @@ TEST_F(PacketQueueMgr6Test, customQueueType) {
                       << default_queue_type_ << "\", \"size\": 0 }");
 }
 
+// Verifies that the default queue applies the early drop rules.
+TEST_F(PacketQueueMgr6Test, dropRules) {
+    // Verify that invalid rules are rejected.
+    data::ElementPtr config = makeQueueConfig(default_queue_type_, 100);
+    config->set("max-client-rate", data::Element::create("two"));
+    ASSERT_THROW(mgr().createPacketQueue(config), InvalidQueueParameter);
+
+    // Create a queue with a client rate limit and duplicates suppression.
+    config->set("max-client-rate", data::Element::create(2));
+    config->set("drop-duplicates", data::Element::create(true));
+    ASSERT_NO_THROW(mgr().createPacketQueue(config));
+
+    // Enqueue the same packet three times: the duplicates are dropped.
+    Pkt6 out(DHCPV6_SOLICIT, 1234);
+    out.addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID, OptionBuffer(10, 1))));
+    out.pack();
+    const uint8_t* data = static_cast<const uint8_t*>(out.getBuffer().getData());
+    SocketInfo sock(isc::asiolink::IOAddress("::1"), 777, 10);
+    for (int i = 0; i < 3; ++i) {
+        Pkt6Ptr pkt(new Pkt6(data, out.getBuffer().getLength()));
+        ASSERT_NO_THROW(mgr().getPacketQueue()->enqueuePacket(pkt, sock));
+    }
+    CHECK_QUEUE_INFO (mgr().getPacketQueue(), "{ \"capacity\": 100, \"queue-type\": \""
+                      << default_queue_type_ << "\", \"size\": 1, \"dropped\":"
+                      " { \"rate-limit\": 0, \"duplicate\": 2, \"low-priority\": 0 } }");
+}
+
+// Verifies that the priority queue is registered and created from the
+// queue parameters.
+TEST_F(PacketQueueMgr6Test, priorityQueue) {
+    // Verify that a priority queue without capacity nor classes is rejected.
+    data::ElementPtr config = data::Element::createMap();
+    config->set("enable-queue", data::Element::create(true));
+    config->set("queue-type", data::Element::create(PacketQueueMgr6::PRIORITY_QUEUE_TYPE6));
+    ASSERT_THROW(mgr().createPacketQueue(config), InvalidQueueParameter);
+
+    // Create a priority queue with the default classes.
+    config = makeQueueConfig(PacketQueueMgr6::PRIORITY_QUEUE_TYPE6, 10);
+    ASSERT_NO_THROW(mgr().createPacketQueue(config));
+    CHECK_QUEUE_INFO (mgr().getPacketQueue(), "{ \"capacity\": 30, \"queue-type\": \"kea-priority6\","
+                      " \"size\": 0, \"classes\": ["
+                      " { \"capacity\": 10, \"size\": 0, \"overflow\": 0 },"
+                      " { \"capacity\": 10, \"size\": 0, \"overflow\": 0 },"
+                      " { \"capacity\": 10, \"size\": 0, \"overflow\": 0 } ] }");
+}
+
 } // end of anonymous namespace
@@ -0,0 +1,241 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/packet_queue_priority.h>
+#include <dhcp/tests/packet_queue_testutils.h>
+
+#include <gtest/gtest.h>
+
+#include <sys/socket.h>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Creates a DHCPv4 message as received from the wire.
+///
+/// @param type message type.
+/// @param transid transaction id.
+/// @param ciaddr client address, set by the clients having a lease.
+/// @return pointer to the message which hasn't been unpacked.
+Pkt4Ptr
+createPkt4(const uint8_t type, const uint32_t transid,
+           const std::string& ciaddr = "0.0.0.0") {
+    Pkt4 pkt(type, transid);
+    pkt.setHWAddr(HWAddrPtr(new HWAddr(std::vector<uint8_t>(6, transid),
+                                       HTYPE_ETHER)));
+    pkt.setCiaddr(IOAddress(ciaddr));
+    pkt.pack();
+    const uint8_t* data =
+        static_cast<const uint8_t*>(pkt.getBuffer().getData());
+    return (Pkt4Ptr(new Pkt4(data, pkt.getBuffer().getLength())));
+}
+
+/// @brief Creates a DHCPv6 message as received from the wire.
+///
+/// @param type message type.
+/// @param transid transaction id.
+/// @return pointer to the message which hasn't been unpacked.
+Pkt6Ptr
+createPkt6(const uint8_t type, const uint32_t transid) {
+    Pkt6 pkt(type, transid);
+    pkt.pack();
+    const uint8_t* data =
+        static_cast<const uint8_t*>(pkt.getBuffer().getData());
+    return (Pkt6Ptr(new Pkt6(data, pkt.getBuffer().getLength())));
+}
+
+// This test verifies that the default classes are created from the queue
+// capacity and that the classes are parsed.
+TEST(PacketPriorityClassesTest, create) {
+    ElementPtr params = Element::fromJSON("{ \"capacity\": 20 }");
+    PacketPriorityClasses classes;
+    ASSERT_NO_THROW(classes = createPacketPriorityClasses(params, AF_INET));
+    ASSERT_EQ(3, classes.size());
+    EXPECT_EQ(1, classes[0].msg_types_.count(DHCPREQUEST));
+    EXPECT_TRUE(classes[0].known_clients_);
+    EXPECT_EQ(4, classes[0].weight_);
+    EXPECT_EQ(1, classes[1].msg_types_.count(DHCPDISCOVER));
+    EXPECT_EQ(1, classes[1].weight_);
+    EXPECT_TRUE(classes[2].msg_types_.empty());
+    EXPECT_EQ(2, classes[2].weight_);
+    for (size_t i = 0; i < classes.size(); ++i) {
+        EXPECT_EQ(20, classes[i].capacity_);
+        EXPECT_EQ(PacketPriorityClass::DROP_OLDEST, classes[i].drop_policy_);
+    }
+
+    ASSERT_NO_THROW(classes = createPacketPriorityClasses(params, AF_INET6));
+    ASSERT_EQ(3, classes.size());
+    EXPECT_EQ(1, classes[0].msg_types_.count(DHCPV6_RENEW));
+    EXPECT_EQ(1, classes[0].msg_types_.count(DHCPV6_REBIND));
+    EXPECT_EQ(1, classes[1].msg_types_.count(DHCPV6_SOLICIT));
+
+    params = Element::fromJSON("{ \"classes\": ["
+                               " { \"message-types\": [ 3 ],"
+                               "   \"known-clients\": true,"
+                               "   \"capacity\": 10, \"weight\": 3 },"
+                               " { \"capacity\": 5,"
+                               "   \"drop-policy\": \"drop-newest\" } ] }");
+    ASSERT_NO_THROW(classes = createPacketPriorityClasses(params, AF_INET));
+    ASSERT_EQ(2, classes.size());
+    EXPECT_EQ(1, classes[0].msg_types_.size());
+    EXPECT_TRUE(classes[0].known_clients_);
+    EXPECT_EQ(10, classes[0].capacity_);
+    EXPECT_EQ(3, classes[0].weight_);
+    EXPECT_TRUE(classes[1].msg_types_.empty());
+    EXPECT_FALSE(classes[1].known_clients_);
+    EXPECT_EQ(5, classes[1].capacity_);
+    EXPECT_EQ(1, classes[1].weight_);
+    EXPECT_EQ(PacketPriorityClass::DROP_NEWEST, classes[1].drop_policy_);
+
+    // Invalid classes.
+    const char* invalid[] = {
+        "{ }",
+        "{ \"classes\": [ ] }",
+        "{ \"classes\": [ 1 ] }",
+        "{ \"classes\": [ { \"weight\": 1 } ] }",
+        "{ \"classes\": [ { \"capacity\": 0 } ] }",
+        "{ \"classes\": [ { \"capacity\": 1, \"weight\": -1 } ] }",
+        "{ \"classes\": [ { \"capacity\": 1, \"message-types\": 1 } ] }",
+        "{ \"classes\": [ { \"capacity\": 1, \"message-types\": [ 300 ] } ] }",
+        "{ \"classes\": [ { \"capacity\": 1, \"known-clients\": 1 } ] }",
+        "{ \"classes\": [ { \"capacity\": 1, \"drop-policy\": \"random\" } ] }"
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        EXPECT_THROW(createPacketPriorityClasses(Element::fromJSON(invalid[i]),
+                                                 AF_INET),
+                     InvalidQueueParameter) << invalid[i];
+    }
+}
+
+// This test verifies that the packets are dequeued by weighted round robin
+// between the classes.
+TEST(PacketQueuePriority4, weightedDequeue) {
+    PacketPriorityClasses classes =
+        createPacketPriorityClasses(Element::fromJSON("{ \"capacity\": 10 }"),
+                                    AF_INET);
+    PacketQueuePriority4 q("kea-priority4", classes);
+    EXPECT_TRUE(q.empty());
+    EXPECT_EQ(30, q.getCapacity());
+
+    SocketInfo sock(IOAddress("127.0.0.1"), 777, 10);
+
+    // Enqueue new clients, then clients selecting or renewing a lease.
+    for (uint32_t i = 0; i < 6; ++i) {
+        q.enqueuePacket(createPkt4(DHCPDISCOVER, 100 + i), sock);
+    }
+    for (uint32_t i = 0; i < 6; ++i) {
+        q.enqueuePacket(createPkt4(DHCPREQUEST, 200 + i), sock);
+    }
+    for (uint32_t i = 0; i < 6; ++i) {
+        q.enqueuePacket(createPkt4(DHCPREQUEST, 300 + i, "192.0.2.1"), sock);
+    }
+    EXPECT_EQ(18, q.getSize());
+
+    // Renewals come 4 by 4, the discovers 1 by 1 and the others 2 by 2.
+    const uint32_t expected[] = {
+        300, 301, 302, 303, 100, 200, 201,
+        304, 305, 101, 202, 203,
+        102, 204, 205,
+        103, 104, 105
+    };
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        Pkt4Ptr pkt = q.dequeuePacket();
+        ASSERT_TRUE(pkt);
+        ASSERT_NO_THROW(pkt->unpack());
+        EXPECT_EQ(expected[i], pkt->getTransid()) << "packet " << i;
+    }
+    EXPECT_TRUE(q.empty());
+    EXPECT_FALSE(q.dequeuePacket());
+}
+
+// This test verifies that the renewals get through a flood of new clients:
+// the flood overflows only its own class.
+TEST(PacketQueuePriority4, discoverFlood) {
+    PacketPriorityClasses classes =
+        createPacketPriorityClasses(Element::fromJSON("{ \"capacity\": 50 }"),
+                                    AF_INET);
+    PacketQueuePriority4 q("kea-priority4", classes);
+    SocketInfo sock(IOAddress("127.0.0.1"), 777, 10);
+
+    // 20 new clients for each renewal.
+    for (uint32_t i = 0; i < 1000; ++i) {
+        if (i % 20 == 0) {
+            q.enqueuePacket(createPkt4(DHCPREQUEST, i, "192.0.2.1"), sock);
+        } else {
+            q.enqueuePacket(createPkt4(DHCPDISCOVER, i), sock);
+        }
+    }
+
+    // All the renewals are queued and come four times as fast as the
+    // discovers.
+    EXPECT_EQ(100, q.getSize());
+    size_t renewals = 0;
+    for (int i = 0; i < 63; ++i) {
+        Pkt4Ptr pkt = q.dequeuePacket();
+        ASSERT_TRUE(pkt);
+        ASSERT_NO_THROW(pkt->unpack());
+        if (pkt->getTransid() % 20 == 0) {
+            ++renewals;
+        }
+    }
+    EXPECT_EQ(50, renewals);
+
+    CHECK_QUEUE_INFO(&q, "{ \"capacity\": 150, \"queue-type\": \"kea-priority4\","
+                     " \"size\": 37, \"classes\": ["
+                     " { \"capacity\": 50, \"size\": 0, \"overflow\": 0 },"
+                     " { \"capacity\": 50, \"size\": 37, \"overflow\": 900 },"
+                     " { \"capacity\": 50, \"size\": 0, \"overflow\": 0 } ] }");
+}
+
+// This test verifies the drop policies of the classes.
+TEST(PacketQueuePriority6, dropPolicy) {
+    PacketPriorityClasses classes = createPacketPriorityClasses(
+        Element::fromJSON("{ \"classes\": ["
+                          " { \"message-types\": [ 1 ], \"capacity\": 2,"
+                          "   \"drop-policy\": \"drop-newest\" },"
+                          " { \"capacity\": 2 } ] }"), AF_INET6);
+    PacketQueuePriority6 q("kea-priority6", classes);
+    SocketInfo sock(IOAddress("::1"), 777, 10);
+
+    for (uint32_t i = 0; i < 3; ++i) {
+        q.enqueuePacket(createPkt6(DHCPV6_SOLICIT, 100 + i), sock);
+        q.enqueuePacket(createPkt6(DHCPV6_RENEW, 200 + i), sock);
+    }
+    EXPECT_EQ(4, q.getSize());
+
+    // The newest solicit and the oldest renew were dropped.
+    const uint32_t expected[] = { 100, 201, 101, 202 };
+    for (size_t i = 0; i < sizeof(expected) / sizeof(expected[0]); ++i) {
+        Pkt6Ptr pkt = q.dequeuePacket();
+        ASSERT_TRUE(pkt);
+        ASSERT_NO_THROW(pkt->unpack());
+        EXPECT_EQ(expected[i], pkt->getTransid()) << "packet " << i;
+    }
+
+    // Packets which can't be read go to the last class.
+    Pkt6Ptr malformed(new Pkt6(DHCPV6_SOLICIT, 300));
+    q.enqueuePacket(malformed, sock);
+    CHECK_QUEUE_INFO(&q, "{ \"capacity\": 4, \"queue-type\": \"kea-priority6\","
+                     " \"size\": 1, \"classes\": ["
+                     " { \"capacity\": 2, \"size\": 0, \"overflow\": 1 },"
+                     " { \"capacity\": 2, \"size\": 1, \"overflow\": 1 } ] }");
+
+    q.clear();
+    EXPECT_TRUE(q.empty());
+}
+
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -834,6 +834,40 @@ TEST_F(Pkt4Test, Timestamp) {
     EXPECT_TRUE(ts_period.length().total_microseconds() >= 0);
 }
 
+// Checks that the processing stages can be timestamped.
+TEST_F(Pkt4Test, stageTimes) {
+    scoped_ptr<Pkt4> pkt(new Pkt4(DHCPDISCOVER, 1234));
+    pkt->updateTimestamp();
+
+    // No stage has been reached yet.
+    for (size_t i = 0; i < Pkt::STAGES_NUM; ++i) {
+        EXPECT_TRUE(pkt->getStageTime(static_cast<Pkt::Stage>(i)).
+                    is_not_a_date_time());
+    }
+
+    pkt->markStage(Pkt::STAGE_DEQUEUED);
+    pkt->markStage(Pkt::STAGE_SUBNET_SELECTED);
+    ASSERT_FALSE(pkt->getStageTime(Pkt::STAGE_DEQUEUED).is_not_a_date_time());
+    ASSERT_FALSE(pkt->getStageTime(Pkt::STAGE_SUBNET_SELECTED).
+                 is_not_a_date_time());
+    EXPECT_TRUE(pkt->getStageTime(Pkt::STAGE_LEASE_ALLOCATED).
+                is_not_a_date_time());
+    EXPECT_TRUE(pkt->getStageTime(Pkt::STAGE_SENT).is_not_a_date_time());
+
+    // The stages use the clock of the packet timestamp.
+    EXPECT_LE(pkt->getTimestamp(), pkt->getStageTime(Pkt::STAGE_DEQUEUED));
+    EXPECT_LE(pkt->getStageTime(Pkt::STAGE_DEQUEUED),
+              pkt->getStageTime(Pkt::STAGE_SUBNET_SELECTED));
+
+    EXPECT_EQ(std::string("dequeued"),
+              Pkt::stageToText(Pkt::STAGE_DEQUEUED));
+    EXPECT_EQ(std::string("subnet-selected"),
+              Pkt::stageToText(Pkt::STAGE_SUBNET_SELECTED));
+    EXPECT_EQ(std::string("lease-allocated"),
+              Pkt::stageToText(Pkt::STAGE_LEASE_ALLOCATED));
+    EXPECT_EQ(std::string("sent"), Pkt::stageToText(Pkt::STAGE_SENT));
+}
+
 TEST_F(Pkt4Test, hwaddr) {
     scoped_ptr<Pkt4> pkt(new Pkt4(DHCPOFFER, 1234));
     const uint8_t hw[] = { 2, 4, 6, 8, 10, 12 }; // MAC
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -173,6 +173,8 @@ TEST_F(PktFilterLPFTest, DISABLED_receive) {
     Pkt4Ptr rcvd_pkt = pkt_filter.receive(iface, sock_info_);
     // Check that the packet has been correctly received.
     ASSERT_TRUE(rcvd_pkt);
+    // The packet filter records the reception time.
+    EXPECT_FALSE(rcvd_pkt->getTimestamp().is_not_a_date_time());
 
     // Parse the packet.
     ASSERT_NO_THROW(rcvd_pkt->unpack());
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -79,6 +79,40 @@ struct AllocEngineHooks {
 // module is called.
 AllocEngineHooks Hooks;
 
+/// @brief Updates the number of leases in use in the pool of an IPv4 lease.
+///
+/// The subnet of the lease is looked up in the current configuration.
+///
+/// @param lease Lease added to or removed from its pool.
+/// @param delta Number of leases added (or removed when negative).
+void
+addPoolAssignedLeases4(const Lease4Ptr& lease, const int64_t delta) {
+    Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets4()->getSubnet(lease->subnet_id_);
+    if (subnet) {
+        subnet->addAssignedLeases(Lease::TYPE_V4, lease->addr_, delta);
+    }
+}
+
+/// @brief Updates the delegated prefixes in use in the pool of an IPv6 lease.
+///
+/// The subnet of the lease is looked up in the current configuration.
+/// This does nothing for address leases.
+///
+/// @param lease Lease added to or removed from its pool.
+/// @param delta Number of leases added (or removed when negative).
+void
+addPoolAssignedLeases6(const Lease6Ptr& lease, const int64_t delta) {
+    if (lease->type_ != Lease::TYPE_PD) {
+        return;
+    }
+    Subnet6Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets6()->getSubnet(lease->subnet_id_);
+    if (subnet) {
+        subnet->addAssignedLeases(Lease::TYPE_PD, lease->addr_, delta);
+    }
+}
+
 }; // anonymous namespace
 
 namespace isc {
@@ -178,12 +212,20 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
         isc_throw(AllocFailed, "No pools defined in selected subnet");
     }
 
+    // The leases known to be in use are skipped, unless all the allowed
+    // pools are exhausted: the leases may have expired and not yet been
+    // reclaimed, so they are walked over as usual. The IPv4 allocation
+    // doesn't get here with exhausted pools as it skips the subnet.
+    const bool skip_in_use = !subnet->poolsExhausted(pool_type_, client_classes);
+
     // first we need to find a pool the last address belongs to.
     PoolCollection::const_iterator it;
     PoolCollection::const_iterator first = pools.end();
     PoolPtr first_pool;
     for (it = pools.begin(); it != pools.end(); ++it) {
-        if (!(*it)->clientSupported(client_classes)) {
+        // Exhausted pools are skipped as they have no free address.
+        if (!(*it)->clientSupported(client_classes) ||
+            (skip_in_use && (*it)->isExhausted())) {
             continue;
         }
         if (first == pools.end()) {
@@ -212,7 +254,8 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
         // Trying next pool
         if (retrying) {
             for (; it != pools.end(); ++it) {
-                if ((*it)->clientSupported(client_classes)) {
+                if ((*it)->clientSupported(client_classes) &&
+                    !(skip_in_use && (*it)->isExhausted())) {
                     break;
                 }
             }
@@ -222,13 +265,33 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
             }
         }
 
+        Pool6Ptr pool6;
+        bool use_free_prefixes = false;
+        if (prefix) {
+            pool6 = boost::dynamic_pointer_cast<Pool6>(*it);
+
+            if (!pool6) {
+                // Something is gravely wrong here
+                isc_throw(Unexpected, "Wrong type of pool: "
+                          << (*it)->toText()
+                          << " is not Pool6");
+            }
+            // Get the prefix length
+            prefix_len = pool6->getLength();
+            use_free_prefixes = skip_in_use && pool6->isFreePrefixesValid();
+        }
+
         last = (*it)->getLastAllocated();
         valid = (*it)->isLastAllocatedValid();
         if (!valid && (last == (*it)->getFirstAddress())) {
             // Pool was (re)initialized
-            (*it)->setLastAllocated(last);
-            subnet->setLastAllocated(pool_type_, last);
-            return (last);
+            if (!use_free_prefixes || pool6->isPrefixFree(last)) {
+                (*it)->setLastAllocated(last);
+                subnet->setLastAllocated(pool_type_, last);
+                return (last);
+            }
+            // The first prefix is in use: look for the next free one.
+            valid = true;
         }
         // still can be bogus
         if (valid && !(*it)->inRange(last)) {
@@ -239,21 +302,17 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
 
         if (valid) {
             // Ok, we have a pool that the last address belonged to, let's use it.
-            if (prefix) {
-                Pool6Ptr pool6 = boost::dynamic_pointer_cast<Pool6>(*it);
-
-                if (!pool6) {
-                    // Something is gravely wrong here
-                    isc_throw(Unexpected, "Wrong type of pool: "
-                              << (*it)->toText()
-                              << " is not Pool6");
-                }
-                // Get the prefix length
-                prefix_len = pool6->getLength();
+            IOAddress next = last;
+            bool found = false;
+            if (use_free_prefixes) {
+                // Skip the prefixes known to be in use rather than
+                // looking them up in the lease database one by one.
+                found = pool6->getNextFreePrefix(next);
+            } else {
+                next = increaseAddress(last, prefix, prefix_len);
+                found = (*it)->inRange(next);
             }
-
-            IOAddress next = increaseAddress(last, prefix, prefix_len);
-            if ((*it)->inRange(next)) {
+            if (found) {
                 // the next one is in the pool as well, so we haven't hit
                 // pool boundary yet
                 (*it)->setLastAllocated(next);
@@ -279,6 +338,13 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
 
     // ok to access first element directly. We checked that pools is non-empty
     last = (*first)->getLastAllocated();
+    if (prefix && skip_in_use) {
+        // Start from the first free prefix when they are tracked.
+        Pool6Ptr pool6 = boost::dynamic_pointer_cast<Pool6>(*first);
+        if (pool6 && !pool6->isPrefixFree(last)) {
+            pool6->getNextFreePrefix(last);
+        }
+    }
     (*first)->setLastAllocated(last);
     subnet->setLastAllocated(pool_type_, last);
     return (last);
@@ -857,7 +923,8 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
                 // it has been reserved for us we would have already allocated a lease.
 
                 ConstHostPtr host;
-                if (hr_mode != Network::HR_DISABLED) {
+                if ((hr_mode != Network::HR_DISABLED) &&
+                    subnet->mayBeReserved(hint)) {
                     host = HostMgr::instance().get6(subnet->getID(), hint);
                 }
 
@@ -893,7 +960,8 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
                 if (lease->expired()) {
 
                     ConstHostPtr host;
-                    if (hr_mode != Network::HR_DISABLED) {
+                    if ((hr_mode != Network::HR_DISABLED) &&
+                        subnet->mayBeReserved(hint)) {
                         host = HostMgr::instance().get6(subnet->getID(), hint);
                     }
 
@@ -994,6 +1062,7 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
             /// else. There is no need to check for whom it is reserved, because if
             /// it has been reserved for us we would have already allocated a lease.
             if (hr_mode == Network::HR_ALL &&
+                subnet->mayBeReserved(candidate) &&
                 HostMgr::instance().get6(subnet->getID(), candidate)) {
 
                 // Don't allocate.
@@ -1053,6 +1122,10 @@ AllocEngine::allocateUnreservedLeases6(ClientContext6& ctx) {
                     leases.push_back(existing);
                     return (leases);
                 }
+
+                // The prefix was leased without the server knowing it,
+                // e.g. using the lease commands, don't pick it again.
+                subnet->addAssignedLeases(ctx.currentIA().type_, candidate, 1);
             }
         }
 
@@ -1398,8 +1471,11 @@ AllocEngine::removeNonmatchingReservedLeases6(ClientContext6& ctx,
         // We have to make a bit more expensive operation here to retrieve
         // the reservation for the candidate lease and see if it is
         // reserved for someone else.
-        ConstHostPtr host = HostMgr::instance().get6(ctx.subnet_->getID(),
-                                                     candidate->addr_);
+        ConstHostPtr host;
+        if (ctx.subnet_->mayBeReserved(candidate->addr_)) {
+            host = HostMgr::instance().get6(ctx.subnet_->getID(),
+                                            candidate->addr_);
+        }
         // If lease is not reserved to someone else, it means that it can
         // be allocated to us from a dynamic pool, but we must check if
         // this lease belongs to any pool. If it does, we can proceed to
@@ -1438,6 +1514,7 @@ AllocEngine::removeNonmatchingReservedLeases6(ClientContext6& ctx,
                                    ctx.currentIA().type_ == Lease::TYPE_NA ?
                                    "assigned-nas" : "assigned-pds"),
             static_cast<int64_t>(-1));
+        addPoolAssignedLeases6(candidate, -1);
 
         // In principle, we could trigger a hook here, but we will do this
         // only if we get serious complaints from actual users. We want the
@@ -1481,6 +1558,7 @@ AllocEngine::removeNonmatchingReservedNoHostLeases6(ClientContext6& ctx,
                                    ctx.currentIA().type_ == Lease::TYPE_NA ?
                                    "assigned-nas" : "assigned-pds"),
             static_cast<int64_t>(-1));
+        addPoolAssignedLeases6(candidate, -1);
 
         // Add this to the list of removed leases.
         ctx.currentIA().old_leases_.push_back(candidate);
@@ -1547,6 +1625,7 @@ AllocEngine::removeNonreservedLeases6(ClientContext6& ctx,
                                    ctx.currentIA().type_ == Lease::TYPE_NA ?
                                    "assigned-nas" : "assigned-pds"),
             static_cast<int64_t>(-1));
+        addPoolAssignedLeases6(*lease, -1);
 
         /// @todo: Probably trigger a hook here
 
@@ -1673,6 +1752,7 @@ AllocEngine::reuseExpiredLease(Lease6Ptr& expired, ClientContext6& ctx,
                                        ctx.currentIA().type_ == Lease::TYPE_NA ?
                                        "assigned-nas" : "assigned-pds"),
                 static_cast<int64_t>(1));
+            addPoolAssignedLeases6(expired, 1);
         }
     }
 
@@ -1759,6 +1839,7 @@ Lease6Ptr AllocEngine::createLease6(ClientContext6& ctx,
                                            ctx.currentIA().type_ == Lease::TYPE_NA ?
                                            "assigned-nas" : "assigned-pds"),
                     static_cast<int64_t>(1));
+                addPoolAssignedLeases6(lease, 1);
             }
 
             return (lease);
@@ -2013,6 +2094,7 @@ AllocEngine::extendLease6(ClientContext6& ctx, Lease6Ptr lease) {
                                        ctx.currentIA().type_ == Lease::TYPE_NA ?
                                        "assigned-nas" : "assigned-pds"),
                     static_cast<int64_t>(1));
+                addPoolAssignedLeases6(old_data, 1);
             }
         } else {
             if (!lease->hasIdenticalFqdn(*old_data)) {
@@ -2065,6 +2147,7 @@ AllocEngine::updateLeaseData(ClientContext6& ctx, const Lease6Collection& leases
                                                ctx.currentIA().type_ == Lease::TYPE_NA ?
                                                "assigned-nas" : "assigned-pds"),
                         static_cast<int64_t>(1));
+                    addPoolAssignedLeases6(lease, 1);
                 }
             }
 
@@ -2090,7 +2173,7 @@ AllocEngine::updateLeaseData(ClientContext6& ctx, const Lease6Collection& leases
     return (updated_leases);
 }
 
-void
+bool
 AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeout,
                                    const bool remove_lease,
                                    const uint16_t max_unwarned_cycles) {
@@ -2204,6 +2287,8 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
         LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
                   ALLOC_ENGINE_V6_NO_MORE_EXPIRED_LEASES);
     }
+
+    return (incomplete_reclamation);
 }
 
 void
@@ -2229,7 +2314,7 @@ AllocEngine::deleteExpiredReclaimedLeases6(const uint32_t secs) {
 }
 
 
-void
+bool
 AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeout,
                                    const bool remove_lease,
                                    const uint16_t max_unwarned_cycles) {
@@ -2344,6 +2429,8 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
         LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
                   ALLOC_ENGINE_V4_NO_MORE_EXPIRED_LEASES);
     }
+
+    return (incomplete_reclamation);
 }
 
 template<typename LeasePtrType>
@@ -2451,6 +2538,7 @@ AllocEngine::reclaimExpiredLease(const Lease6Ptr& lease,
                                                              lease->subnet_id_,
                                                              "assigned-pds"),
                                       int64_t(-1));
+        addPoolAssignedLeases6(lease, -1);
 
     }
 
@@ -2539,6 +2627,13 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
                                                          "assigned-addresses"),
                                   int64_t(-1));
 
+    // The address is available again in its pool once the lease is
+    // reclaimed in the database: a lease being reused or renewed stays
+    // counted.
+    if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
+        addPoolAssignedLeases4(lease, -1);
+    }
+
     // Increase total number of reclaimed leases.
     StatsMgr::instance().addValue("reclaimed-leases", int64_t(1));
 
@@ -2755,7 +2850,8 @@ addressReserved(const IOAddress& address, const AllocEngine::ClientContext4& ctx
     if (ctx.subnet_ &&
         ((ctx.subnet_->getHostReservationMode() == Network::HR_ALL) ||
          ((ctx.subnet_->getHostReservationMode() == Network::HR_OUT_OF_POOL) &&
-          (!ctx.subnet_->inPool(Lease::TYPE_V4, address))))) {
+          (!ctx.subnet_->inPool(Lease::TYPE_V4, address)))) &&
+        ctx.subnet_->mayBeReserved(address)) {
         ConstHostPtr host = HostMgr::instance().get4(ctx.subnet_->getID(), address);
         if (host) {
             for (auto id = ctx.host_identifiers_.cbegin(); id != ctx.host_identifiers_.cend();
@@ -3304,8 +3400,14 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
 
     if (!ctx.requested_address_.isV4Zero()) {
         // There is a specific address to be allocated. Let's find out if
-        // the address is in use.
-        Lease4Ptr existing = LeaseMgrFactory::instance().getLease4(ctx.requested_address_);
+        // the address is in use. When the client is renewing its lease
+        // (the most common case) the lease for this address is the one
+        // we have just found for the client, so there is no need to look
+        // it up again.
+        Lease4Ptr existing;
+        if (!client_lease || (client_lease->addr_ != ctx.requested_address_)) {
+            existing = LeaseMgrFactory::instance().getLease4(ctx.requested_address_);
+        }
         // If the address is in use (allocated and not expired), we check
         // if the address is in use by our client or another client.
         // If it is in use by another client, the address can't be
@@ -3436,6 +3538,9 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
         StatsMgr::instance().addValue(
             StatsMgr::generateName("subnet", client_lease->subnet_id_, "assigned-addresses"),
             static_cast<int64_t>(-1));
+        if (!client_lease->stateExpiredReclaimed()) {
+            addPoolAssignedLeases4(client_lease, -1);
+        }
     }
 
     // Return the allocated lease or NULL pointer if allocation was
@@ -3529,6 +3634,7 @@ AllocEngine::createLease4(const ClientContext4& ctx, const IOAddress& addr,
             StatsMgr::instance().addValue(
                 StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
                 static_cast<int64_t>(1));
+            ctx.subnet_->addAssignedLeases(Lease::TYPE_V4, lease->addr_, 1);
 
             return (lease);
         } else {
@@ -3641,6 +3747,11 @@ AllocEngine::renewLease4(const Lease4Ptr& lease,
                 StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
                 static_cast<int64_t>(1));
         }
+
+        // The expired lease is counted in its pool until it is reclaimed.
+        if (ctx.old_lease_->stateExpiredReclaimed()) {
+            ctx.subnet_->addAssignedLeases(Lease::TYPE_V4, lease->addr_, 1);
+        }
     }
     if (skip) {
         // Rollback changes (really useful only for memfile)
@@ -3663,6 +3774,9 @@ AllocEngine::reuseExpiredLease4(Lease4Ptr& expired,
         isc_throw(BadValue, "null subnet specified for the reuseExpiredLease");
     }
 
+    // The expired lease is counted in its pool until it is reclaimed.
+    const bool reclaimed = expired->stateExpiredReclaimed();
+
     if (!ctx.fake_allocation_) {
         // The expired lease needs to be reclaimed before it can be reused.
         // This includes declined leases for which probation period has
@@ -3738,6 +3852,9 @@ AllocEngine::reuseExpiredLease4(Lease4Ptr& expired,
         StatsMgr::instance().addValue(
                 StatsMgr::generateName("subnet", ctx.subnet_->getID(), "assigned-addresses"),
                 static_cast<int64_t>(1));
+        if (reclaimed) {
+            ctx.subnet_->addAssignedLeases(Lease::TYPE_V4, expired->addr_, 1);
+        }
     }
 
     // We do nothing for SOLICIT. We'll just update database when
@@ -3801,6 +3918,7 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
     Subnet4Ptr original_subnet = subnet;
 
     uint64_t total_attempts = 0;
+    bool exhausted = false;
     while (subnet) {
 
         ClientIdPtr client_id;
@@ -3812,12 +3930,23 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
             subnet->getPoolCapacity(Lease::TYPE_V4,
                                     ctx.query_->getClasses());
         uint64_t max_attempts = (attempts_ > 0 ? attempts_ : possible_attempts);
+        CalloutHandle::CalloutNextStep callout_status = CalloutHandle::NEXT_STEP_CONTINUE;
+
         // Skip trying if there is no chance to get something
         if (possible_attempts == 0) {
             max_attempts = 0;
-        }
 
-        CalloutHandle::CalloutNextStep callout_status = CalloutHandle::NEXT_STEP_CONTINUE;
+        } else if (subnet->poolsExhausted(Lease::TYPE_V4,
+                                          ctx.query_->getClasses())) {
+            // All addresses of the pools allowed for the client are in use
+            // so don't walk over them. The expired leases stay counted until
+            // they are reclaimed, which makes their addresses available.
+            max_attempts = 0;
+            exhausted = true;
+            StatsMgr::instance().addValue(
+                StatsMgr::generateName("subnet", subnet->getID(), "pools-exhausted"),
+                static_cast<int64_t>(1));
+        }
 
         for (uint64_t i = 0; i < max_attempts; ++i) {
             IOAddress candidate = allocator->pickAddress(subnet,
@@ -3854,6 +3983,13 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
         }
     }
 
+    // Count the allocations which failed without any attempt because the
+    // pools were exhausted.
+    if (exhausted && (total_attempts == 0)) {
+        StatsMgr::instance().addValue("v4-allocation-fail-exhausted",
+                                      static_cast<int64_t>(1));
+    }
+
     // Unable to allocate an address, return an empty lease.
     LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V4_ALLOC_FAIL)
         .arg(ctx.query_->getLabel())
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -687,7 +687,11 @@ public:
     /// of expired leases, after which the system issues a warning if there
     /// are still expired leases in the database. If this value is 0, the
     /// warning is never issued.
-    void reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeout,
+    ///
+    /// @return true if the reclamation was incomplete, i.e. there are
+    /// expired leases which haven't been reclaimed in this pass because
+    /// the maximum number of leases or the timeout has been reached.
+    bool reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeout,
                                const bool remove_lease,
                                const uint16_t max_unwarned_cycles = 0);
 
@@ -746,7 +750,11 @@ public:
     /// of expired leases, after which the system issues a warning if there
     /// are still expired leases in the database. If this value is 0, the
     /// warning is never issued.
-    void reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeout,
+    ///
+    /// @return true if the reclamation was incomplete, i.e. there are
+    /// expired leases which haven't been reclaimed in this pass because
+    /// the maximum number of leases or the timeout has been reached.
+    bool reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeout,
                                const bool remove_lease,
                                const uint16_t max_unwarned_cycles = 0);
 
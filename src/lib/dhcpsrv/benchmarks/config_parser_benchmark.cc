@@ -0,0 +1,210 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/data.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/simple_parser4.h>
+#include <dhcpsrv/parsers/simple_parser6.h>
+
+#include <iomanip>
+#include <sstream>
+#include <string>
+
+using namespace isc::data;
+using namespace isc::dhcp::bench;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief This is a fixture class used for benchmarking the parsing of
+/// large server configurations, i.e. configurations with many subnets
+/// and host reservations.
+///
+/// The configuration is generated as JSON text by the setup routine. The
+/// benchmarks then measure the time it takes to turn this text into the
+/// staging configuration: parsing JSON into elements, setting defaults,
+/// deriving parameters and parsing subnets with their reservations.
+class ConfigParserBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Setup routine.
+    ///
+    /// Generates the configuration for the number of subnets specified
+    /// as the benchmark range.
+    ///
+    /// @param state reference to the state of the benchmark
+    void SetUp(::benchmark::State const& state) override {
+        subnet_count_ = state.range(0);
+    }
+
+    /// @brief Cleans up after the benchmark.
+    void TearDown(::benchmark::State const&) override {
+        CfgMgr::instance().clear();
+    }
+
+    /// @brief Generates DHCPv4 configuration with subnets and reservations.
+    ///
+    /// Each subnet is a /24 with a single pool and @c HOSTS_PER_SUBNET
+    /// reservations by HW address.
+    ///
+    /// @param subnet_count Number of subnets to generate.
+    /// @return Configuration in JSON format.
+    static std::string generateConfig4(const size_t subnet_count) {
+        std::ostringstream s;
+        s << "{ \"valid-lifetime\": 4000, \"subnet4\": [ ";
+        size_t host = 0;
+        for (size_t i = 0; i < subnet_count; ++i) {
+            const std::string prefix = "10." + std::to_string((i >> 8) & 0xff) +
+                "." + std::to_string(i & 0xff) + ".";
+            s << (i > 0 ? ", " : "")
+              << "{ \"id\": " << (i + 1) << ", "
+              << "\"subnet\": \"" << prefix << "0/24\", "
+              << "\"pools\": [ { \"pool\": \"" << prefix << "100 - "
+              << prefix << "200\" } ], "
+              << "\"reservations\": [ ";
+            for (size_t j = 0; j < HOSTS_PER_SUBNET; ++j, ++host) {
+                s << (j > 0 ? ", " : "")
+                  << "{ \"hw-address\": \"" << std::hex << std::setfill('0')
+                  << "01:02:" << std::setw(2) << ((host >> 24) & 0xff) << ":"
+                  << std::setw(2) << ((host >> 16) & 0xff) << ":"
+                  << std::setw(2) << ((host >> 8) & 0xff) << ":"
+                  << std::setw(2) << (host & 0xff) << std::dec << "\", "
+                  << "\"ip-address\": \"" << prefix << (j + 10) << "\", "
+                  << "\"hostname\": \"host" << host << "\" }";
+            }
+            s << " ] }";
+        }
+        s << " ] }";
+        return (s.str());
+    }
+
+    /// @brief Generates DHCPv6 configuration with subnets and reservations.
+    ///
+    /// Each subnet is a /64 with a single pool and @c HOSTS_PER_SUBNET
+    /// reservations by DUID.
+    ///
+    /// @param subnet_count Number of subnets to generate.
+    /// @return Configuration in JSON format.
+    static std::string generateConfig6(const size_t subnet_count) {
+        std::ostringstream s;
+        s << "{ \"preferred-lifetime\": 3000, \"valid-lifetime\": 4000, "
+          << "\"subnet6\": [ ";
+        size_t host = 0;
+        for (size_t i = 0; i < subnet_count; ++i) {
+            std::ostringstream prefix;
+            prefix << "2001:db8:" << std::hex << i << "::";
+            s << (i > 0 ? ", " : "")
+              << "{ \"id\": " << (i + 1) << ", "
+              << "\"subnet\": \"" << prefix.str() << "/64\", "
+              << "\"pools\": [ { \"pool\": \"" << prefix.str() << "1:0 - "
+              << prefix.str() << "1:ffff\" } ], "
+              << "\"reservations\": [ ";
+            for (size_t j = 0; j < HOSTS_PER_SUBNET; ++j, ++host) {
+                s << (j > 0 ? ", " : "")
+                  << "{ \"duid\": \"" << std::hex << std::setfill('0')
+                  << "01:02:03:04:" << std::setw(2) << ((host >> 24) & 0xff)
+                  << ":" << std::setw(2) << ((host >> 16) & 0xff) << ":"
+                  << std::setw(2) << ((host >> 8) & 0xff) << ":"
+                  << std::setw(2) << (host & 0xff) << "\", "
+                  << "\"ip-addresses\": [ \"" << prefix.str() << (j + 10)
+                  << std::dec << "\" ], "
+                  << "\"hostname\": \"host" << host << "\" }";
+            }
+            s << " ] }";
+        }
+        s << " ] }";
+        return (s.str());
+    }
+
+    /// @brief Parses DHCPv4 configuration into the staging configuration.
+    ///
+    /// @param config Configuration in JSON format.
+    void benchParseConfig4(const std::string& config) {
+        CfgMgr::instance().rollback();
+        ElementPtr global = Element::fromJSON(config);
+        SimpleParser4::setAllDefaults(global);
+        SimpleParser4::deriveParameters(global);
+        Subnets4ListConfigParser parser;
+        parser.parse(CfgMgr::instance().getStagingCfg(), global->get("subnet4"));
+    }
+
+    /// @brief Parses DHCPv6 configuration into the staging configuration.
+    ///
+    /// @param config Configuration in JSON format.
+    void benchParseConfig6(const std::string& config) {
+        CfgMgr::instance().rollback();
+        ElementPtr global = Element::fromJSON(config);
+        SimpleParser6::setAllDefaults(global);
+        SimpleParser6::deriveParameters(global);
+        Subnets6ListConfigParser parser;
+        parser.parse(CfgMgr::instance().getStagingCfg(), global->get("subnet6"));
+    }
+
+    /// @brief Number of subnets in the generated configuration.
+    size_t subnet_count_;
+};
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// parsing of the DHCPv4 configuration with many subnets and reservations.
+BENCHMARK_DEFINE_F(ConfigParserBenchmark, parseConfig4)(benchmark::State& state) {
+    const std::string config = generateConfig4(subnet_count_);
+    while (state.KeepRunning()) {
+        benchParseConfig4(config);
+    }
+}
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// parsing of the DHCPv6 configuration with many subnets and reservations.
+BENCHMARK_DEFINE_F(ConfigParserBenchmark, parseConfig6)(benchmark::State& state) {
+    const std::string config = generateConfig6(subnet_count_);
+    while (state.KeepRunning()) {
+        benchParseConfig6(config);
+    }
+}
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// conversion of the JSON text of a large configuration into elements.
+BENCHMARK_DEFINE_F(ConfigParserBenchmark, fromJSON)(benchmark::State& state) {
+    const std::string config = generateConfig4(subnet_count_);
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(Element::fromJSON(config));
+    }
+}
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// conversion of the elements of a large configuration into JSON text.
+BENCHMARK_DEFINE_F(ConfigParserBenchmark, toJSON)(benchmark::State& state) {
+    ConstElementPtr config = Element::fromJSON(generateConfig4(subnet_count_));
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(config->str());
+    }
+}
+
+/// Defines parameters necessary for running a benchmark that measures
+/// parsing of the DHCPv4 configuration with many subnets and reservations.
+BENCHMARK_REGISTER_F(ConfigParserBenchmark, parseConfig4)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// Defines parameters necessary for running a benchmark that measures
+/// parsing of the DHCPv6 configuration with many subnets and reservations.
+BENCHMARK_REGISTER_F(ConfigParserBenchmark, parseConfig6)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// Defines parameters necessary for running a benchmark that measures
+/// conversion of the JSON text of a large configuration into elements.
+BENCHMARK_REGISTER_F(ConfigParserBenchmark, fromJSON)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+/// Defines parameters necessary for running a benchmark that measures
+/// conversion of the elements of a large configuration into JSON text.
+BENCHMARK_REGISTER_F(ConfigParserBenchmark, toJSON)
+    ->Range(MIN_SUBNET_COUNT, MAX_SUBNET_COUNT)->Unit(UNIT);
+
+}  // namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -12,6 +12,10 @@
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/testutils/lease_file_io.h>
 
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
 using namespace isc::dhcp::bench;
 using namespace isc::dhcp::test;
 using namespace isc::dhcp;
@@ -135,6 +139,64 @@ public:
         removeFiles(getLeaseFilePath("leasefile6_0.csv"));
     }
 
+    /// @brief Returns the number of bytes allocated on the heap.
+    ///
+    /// @return Number of allocated bytes or 0 if it can't be determined
+    /// on this system.
+    static size_t getHeapUsage() {
+#if defined(__GLIBC__) && ((__GLIBC__ > 2) || (__GLIBC_MINOR__ >= 33))
+        return (mallinfo2().uordblks);
+#elif defined(__GLIBC__)
+        return (static_cast<size_t>(mallinfo().uordblks));
+#else
+        return (0);
+#endif
+    }
+
+    /// @brief Measures the heap memory used by the IPv4 leases.
+    ///
+    /// The memory is measured after inserting the leases into the lease
+    /// manager and releasing all other references to them, so as it
+    /// comprises the leases and the lease manager indexes. The creation
+    /// and insertion of the leases is timed.
+    ///
+    /// @param state reference to the state of the benchmark
+    /// @param lease_count number of leases to be inserted
+    void benchMemoryLeases4(::benchmark::State& state, size_t const& lease_count) {
+        state.PauseTiming();
+        SetUp(state);
+        const size_t before = getHeapUsage();
+        state.ResumeTiming();
+        prepareLeases4(lease_count);
+        benchInsertLeases4();
+        state.PauseTiming();
+        leases4_.clear();
+        state.counters["bytes_per_lease"] = (getHeapUsage() - before) / lease_count;
+        state.ResumeTiming();
+    }
+
+    /// @brief Measures the heap memory used by the IPv6 leases.
+    ///
+    /// The memory is measured after inserting the leases into the lease
+    /// manager and releasing all other references to them, so as it
+    /// comprises the leases and the lease manager indexes. The creation
+    /// and insertion of the leases is timed.
+    ///
+    /// @param state reference to the state of the benchmark
+    /// @param lease_count number of leases to be inserted
+    void benchMemoryLeases6(::benchmark::State& state, size_t const& lease_count) {
+        state.PauseTiming();
+        SetUp(state);
+        const size_t before = getHeapUsage();
+        state.ResumeTiming();
+        prepareLeases6(lease_count);
+        benchInsertLeases6();
+        state.PauseTiming();
+        leases6_.clear();
+        state.counters["bytes_per_lease"] = (getHeapUsage() - before) / lease_count;
+        state.ResumeTiming();
+    }
+
     /// @brief Object providing access to v4 lease IO.
     LeaseFileIO io4_;
 
@@ -151,6 +213,14 @@ BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, insertLeases4)(benchmark::State& st
     }
 }
 
+// Defines a benchmark that measures memory used per IPv4 lease.
+BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, memoryLeases4)(benchmark::State& state) {
+    const size_t lease_count = state.range(0);
+    while (state.KeepRunning()) {
+        benchMemoryLeases4(state, lease_count);
+    }
+}
+
 // Defines a benchmark that measures IPv4 leases update.
 BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, updateLeases4)(benchmark::State& state) {
     const size_t lease_count = state.range(0);
@@ -225,6 +295,14 @@ BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, insertLeases6)(benchmark::State& st
     }
 }
 
+// Defines a benchmark that measures memory used per IPv6 lease.
+BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, memoryLeases6)(benchmark::State& state) {
+    const size_t lease_count = state.range(0);
+    while (state.KeepRunning()) {
+        benchMemoryLeases6(state, lease_count);
+    }
+}
+
 // Defines a benchmark that measures IPv6 leases update.
 BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, updateLeases6)(benchmark::State& state) {
     const size_t lease_count = state.range(0);
@@ -280,6 +358,10 @@ BENCHMARK_DEFINE_F(MemfileLeaseMgrBenchmark, getExpiredLeases6)(benchmark::State
 BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, insertLeases4)
     ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
 
+/// A benchmark that measures memory used per IPv4 lease.
+BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, memoryLeases4)
+    ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
+
 /// A benchmark that measures IPv4 leases update.
 BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, updateLeases4)
     ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
@@ -313,6 +395,10 @@ BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, getExpiredLeases4)
 BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, insertLeases6)
     ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
 
+/// A benchmark that measures memory used per IPv6 lease.
+BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, memoryLeases6)
+    ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
+
 /// A benchmark that measures IPv6 leases update.
 BENCHMARK_REGISTER_F(MemfileLeaseMgrBenchmark, updateLeases6)
     ->Range(MIN_LEASE_COUNT, MAX_LEASE_COUNT)->Unit(UNIT);
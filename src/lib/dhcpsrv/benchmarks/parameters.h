@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -31,6 +31,18 @@ constexpr size_t MIN_HOST_COUNT = 512;
 /// @brief A maximum number of leases used in a benchmark
 constexpr size_t MAX_HOST_COUNT = 0xfffd;
 
+/// @brief A minimum number of subnets used in a configuration benchmark
+constexpr size_t MIN_SUBNET_COUNT = 64;
+/// @brief A maximum number of subnets used in a configuration benchmark
+constexpr size_t MAX_SUBNET_COUNT = 8192;
+/// @brief A number of host reservations per subnet in a configuration benchmark
+constexpr size_t HOSTS_PER_SUBNET = 20;
+
+/// @brief A minimum number of options in a packet used in a packing benchmark
+constexpr size_t MIN_OPTION_COUNT = 4;
+/// @brief A maximum number of options in a packet used in a packing benchmark
+constexpr size_t MAX_OPTION_COUNT = 64;
+
 /// @brief A time unit used - all results to be expressed in us (microseconds)
 constexpr benchmark::TimeUnit UNIT = benchmark::kMicrosecond;
 
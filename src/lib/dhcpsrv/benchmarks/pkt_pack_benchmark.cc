@@ -0,0 +1,159 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/option.h>
+#include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <dhcpsrv/benchmarks/parameters.h>
+
+using namespace isc::asiolink;
+using namespace isc::dhcp::bench;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief This is a fixture class used for benchmarking the packing of
+/// DHCP messages into their wire format, i.e. the last step of building
+/// a response.
+///
+/// The messages hold the number of options specified as the benchmark
+/// range. The DHCPv6 message is relayed twice, so as the packing of the
+/// relay encapsulation is measured too.
+class PktPackBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Setup routine.
+    ///
+    /// Creates the messages to be packed.
+    ///
+    /// @param state reference to the state of the benchmark
+    void SetUp(::benchmark::State const& state) override {
+        const size_t option_count = state.range(0);
+        pkt4_ = createPkt4(option_count);
+        pkt6_ = createPkt6(option_count);
+    }
+
+    /// @brief Cleans up after the benchmark.
+    void TearDown(::benchmark::State const&) override {
+        pkt4_.reset();
+        pkt6_.reset();
+    }
+
+    /// @brief Creates a DHCPv4 response.
+    ///
+    /// The response holds a message type option, a relay agent information
+    /// option with two sub-options and options with 4 bytes of data.
+    ///
+    /// @param option_count Number of options in the response.
+    /// @return Pointer to the response.
+    static Pkt4Ptr createPkt4(const size_t option_count) {
+        Pkt4Ptr pkt(new Pkt4(DHCPOFFER, 1234));
+        pkt->setHWAddr(HWAddrPtr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06"))));
+        pkt->setYiaddr(IOAddress("192.0.2.10"));
+        pkt->setGiaddr(IOAddress("192.0.3.1"));
+
+        OptionPtr rai(new Option(Option::V4, DHO_DHCP_AGENT_OPTIONS));
+        rai->addOption(OptionPtr(new Option(Option::V4, RAI_OPTION_AGENT_CIRCUIT_ID,
+                                            OptionBuffer(6, 1))));
+        rai->addOption(OptionPtr(new Option(Option::V4, RAI_OPTION_REMOTE_ID,
+                                            OptionBuffer(6, 2))));
+        pkt->addOption(rai);
+
+        // The message type and relay agent information are already there.
+        uint16_t code = 1;
+        for (size_t i = 2; i < option_count; ++i, ++code) {
+            if ((code == DHO_DHCP_MESSAGE_TYPE) ||
+                (code == DHO_DHCP_AGENT_OPTIONS)) {
+                ++code;
+            }
+            pkt->addOption(OptionPtr(new Option(Option::V4, code,
+                                                OptionBuffer(4, code))));
+        }
+        return (pkt);
+    }
+
+    /// @brief Creates a relayed DHCPv6 response.
+    ///
+    /// The response holds client and server identifiers and IA_NA options
+    /// with an address each. It is encapsulated in two relay levels with
+    /// an interface-id option each.
+    ///
+    /// @param option_count Number of options in the response.
+    /// @return Pointer to the response.
+    static Pkt6Ptr createPkt6(const size_t option_count) {
+        Pkt6Ptr pkt(new Pkt6(DHCPV6_REPLY, 1234));
+        pkt->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID,
+                                            OptionBuffer(14, 1))));
+        pkt->addOption(OptionPtr(new Option(Option::V6, D6O_SERVERID,
+                                            OptionBuffer(14, 2))));
+        for (size_t i = 2; i < option_count; ++i) {
+            Option6IAPtr ia(new Option6IA(D6O_IA_NA, i));
+            ia->setT1(1000);
+            ia->setT2(2000);
+            ia->addOption(OptionPtr(new Option6IAAddr(D6O_IAADDR,
+                                                      IOAddress("2001:db8:1::10"),
+                                                      3000, 4000)));
+            pkt->addOption(ia);
+        }
+
+        for (uint8_t level = 0; level < 2; ++level) {
+            Pkt6::RelayInfo relay;
+            relay.msg_type_ = DHCPV6_RELAY_REPL;
+            relay.hop_count_ = level;
+            relay.linkaddr_ = IOAddress("2001:db8:2::1");
+            relay.peeraddr_ = IOAddress("fe80::1");
+            relay.options_.insert(std::make_pair(D6O_INTERFACE_ID,
+                OptionPtr(new Option(Option::V6, D6O_INTERFACE_ID,
+                                     OptionBuffer(8, level)))));
+            pkt->addRelayInfo(relay);
+        }
+        return (pkt);
+    }
+
+    /// @brief DHCPv4 response to be packed.
+    Pkt4Ptr pkt4_;
+
+    /// @brief DHCPv6 response to be packed.
+    Pkt6Ptr pkt6_;
+};
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// packing of a DHCPv4 response.
+BENCHMARK_DEFINE_F(PktPackBenchmark, pack4)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        pkt4_->pack();
+        benchmark::DoNotOptimize(pkt4_->getBuffer().getData());
+    }
+}
+
+/// Defines steps necessary for conducting a benchmark that measures
+/// packing of a relayed DHCPv6 response.
+BENCHMARK_DEFINE_F(PktPackBenchmark, pack6)(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        pkt6_->pack();
+        benchmark::DoNotOptimize(pkt6_->getBuffer().getData());
+    }
+}
+
+/// Defines parameters necessary for running a benchmark that measures
+/// packing of a DHCPv4 response.
+BENCHMARK_REGISTER_F(PktPackBenchmark, pack4)
+    ->Range(MIN_OPTION_COUNT, MAX_OPTION_COUNT)->Unit(UNIT);
+
+/// Defines parameters necessary for running a benchmark that measures
+/// packing of a relayed DHCPv6 response.
+BENCHMARK_REGISTER_F(PktPackBenchmark, pack6)
+    ->Range(MIN_OPTION_COUNT, MAX_OPTION_COUNT)->Unit(UNIT);
+
+}
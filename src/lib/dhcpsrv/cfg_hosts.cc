@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -82,6 +82,24 @@ CfgHosts::getAll6(const IOAddress& address) {
     return (collection);
 }
 
+ConstHostCollection
+CfgHosts::getAllSubnet4(const SubnetID& subnet_id) const {
+    ConstHostCollection collection;
+    const HostContainerIndex2& idx = hosts_.get<2>();
+    HostContainerIndex2Range r = idx.equal_range(subnet_id);
+    collection.insert(collection.end(), r.first, r.second);
+    return (collection);
+}
+
+ConstHostCollection
+CfgHosts::getAllSubnet6(const SubnetID& subnet_id) const {
+    ConstHostCollection collection;
+    const HostContainerIndex3& idx = hosts_.get<3>();
+    HostContainerIndex3Range r = idx.equal_range(subnet_id);
+    collection.insert(collection.end(), r.first, r.second);
+    return (collection);
+}
+
 template<typename Storage>
 void
 CfgHosts::getAllInternal(const Host::IdentifierType& identifier_type,
@@ -306,8 +324,7 @@ CfgHosts::getHostInternal6(const asiolink::IOAddress& prefix,
 
     // Let's get all reservations that match subnet_id, address.
     const HostContainer6Index0& idx = hosts6_.get<0>();
-    HostContainer6Index0Range r = make_pair(idx.lower_bound(prefix),
-                                            idx.upper_bound(prefix));
+    HostContainer6Index0Range r = idx.equal_range(prefix);
     for (HostContainer6Index0::iterator resrv = r.first; resrv != r.second;
          ++resrv) {
         if (resrv->resrv_.getPrefixLen() == prefix_len) {
@@ -343,8 +360,8 @@ CfgHosts::getAllInternal6(const SubnetID& subnet_id,
 
     // Let's get all reservations that match subnet_id, address.
     const HostContainer6Index1& idx = hosts6_.get<1>();
-    HostContainer6Index1Range r = make_pair(idx.lower_bound(boost::make_tuple(subnet_id, address)),
-                                            idx.upper_bound(boost::make_tuple(subnet_id, address)));
+    HostContainer6Index1Range r =
+        idx.equal_range(boost::make_tuple(subnet_id, address));
 
     // For each IPv6 reservation, add the host to the results list. Fortunately,
     // in all sane cases, there will be only one such host. (Each host can have
@@ -377,45 +394,47 @@ CfgHosts::getHostInternal(const SubnetID& subnet_id, const bool subnet6,
         .arg(subnet_id)
         .arg(Host::getIdentifierAsText(identifier_type, identifier, identifier_len));
 
-    // Get all hosts for a specified identifier. This may return multiple hosts
-    // for different subnets, but the number of hosts returned should be low
-    // because one host presumably doesn't show up in many subnets.
-    HostCollection hosts;
-    getAllInternal<HostCollection>(identifier_type, identifier, identifier_len,
-                                   hosts);
-
+    // Use the identifier, identifier type and subnet id as a composite key
+    // of the hashed index appropriate for the subnet family. There should
+    // be at most one host matching the key.
+    std::vector<uint8_t> identifier_vec(identifier, identifier + identifier_len);
     HostPtr host;
-    // Iterate over the returned hosts and select those for which the
-    // subnet id matches.
-    for (HostCollection::const_iterator host_it = hosts.begin();
-         host_it != hosts.end(); ++host_it) {
-        // Check if this is IPv4 subnet or IPv6 subnet.
-        SubnetID host_subnet_id = subnet6 ? (*host_it)->getIPv6SubnetID() :
-            (*host_it)->getIPv4SubnetID();
-
-        if (subnet_id == host_subnet_id) {
-            // If this is the first occurrence of the host for this subnet,
-            // remember it. But, if we find that this is second @c Host object
-            // for the same client, it is a misconfiguration. Most likely,
-            // the administrator has specified one reservation for a HW
-            // address and another one for the DUID, which gives an ambiguous
-            // result, and we don't know which reservation we should choose.
-            // Therefore, throw an exception.
-            if (!host) {
-                host = *host_it;
-
-            } else {
-                isc_throw(DuplicateHost,  "more than one reservation found"
-                          " for the host belonging to the subnet with id '"
-                          << subnet_id << "' and using the identifier '"
-                          << Host::getIdentifierAsText(identifier_type,
-                                                       identifier,
-                                                       identifier_len)
-                          << "'");
-            }
+    size_t count = 0;
+    if (subnet6) {
+        const HostContainerIndex5& idx = hosts_.get<5>();
+        HostContainerIndex5Range r =
+            idx.equal_range(boost::make_tuple(identifier_vec, identifier_type,
+                                              subnet_id));
+        for (HostContainerIndex5::iterator it = r.first; it != r.second; ++it) {
+            host = *it;
+            ++count;
+        }
+    } else {
+        const HostContainerIndex4& idx = hosts_.get<4>();
+        HostContainerIndex4Range r =
+            idx.equal_range(boost::make_tuple(identifier_vec, identifier_type,
+                                              subnet_id));
+        for (HostContainerIndex4::iterator it = r.first; it != r.second; ++it) {
+            host = *it;
+            ++count;
         }
     }
 
+    // If we find that there is more than one @c Host object for the same
+    // client, it is a misconfiguration. Most likely, the administrator has
+    // specified one reservation for a HW address and another one for the
+    // DUID, which gives an ambiguous result, and we don't know which
+    // reservation we should choose. Therefore, throw an exception.
+    if (count > 1) {
+        isc_throw(DuplicateHost,  "more than one reservation found"
+                  " for the host belonging to the subnet with id '"
+                  << subnet_id << "' and using the identifier '"
+                  << Host::getIdentifierAsText(identifier_type,
+                                               identifier,
+                                               identifier_len)
+                  << "'");
+    }
+
     if (host) {
         LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
                   HOSTS_CFG_GET_ONE_SUBNET_ID_IDENTIFIER_HOST)
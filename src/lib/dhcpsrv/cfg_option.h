@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -93,11 +93,14 @@ public:
         : option_(OptionPtr()), persistent_(persist),
           formatted_value_(), space_name_() {};
 
-    /// @brief Constructor.
+    /// @brief Copy constructor.
+    ///
+    /// The modification time is copied too.
     ///
     /// @param desc descriptor
     OptionDescriptor(const OptionDescriptor& desc)
-        : option_(desc.option_), persistent_(desc.persistent_),
+        : data::StampedElement(desc),
+          option_(desc.option_), persistent_(desc.persistent_),
           formatted_value_(desc.formatted_value_),
           space_name_(desc.space_name_) {
         setContext(desc.getContext());
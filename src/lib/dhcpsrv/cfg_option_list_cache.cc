@@ -0,0 +1,81 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/cfg_option_list_cache.h>
+
+namespace isc {
+namespace dhcp {
+
+const size_t CfgOptionListCache::MAX_ENTRIES;
+
+bool
+CfgOptionListCache::Key::operator<(const Key& other) const {
+    if (cfg_options_ != other.cfg_options_) {
+        return (cfg_options_ < other.cfg_options_);
+    }
+    if (codes_ != other.codes_) {
+        return (codes_ < other.codes_);
+    }
+    return (option_space_ < other.option_space_);
+}
+
+CfgOptionListCache::CfgOptionListCache()
+    : entries_() {
+}
+
+void
+CfgOptionListCache::makeKey(const CfgOptionList& co_list,
+                            const std::string& option_space,
+                            const std::vector<uint16_t>& codes,
+                            Key& key) {
+    key.cfg_options_.reserve(co_list.size());
+    for (CfgOptionList::const_iterator copts = co_list.begin();
+         copts != co_list.end(); ++copts) {
+        key.cfg_options_.push_back(copts->get());
+    }
+    key.option_space_ = option_space;
+    key.codes_ = codes;
+}
+
+const OptionCollection*
+CfgOptionListCache::get(const CfgOptionList& co_list,
+                        const std::string& option_space,
+                        const std::vector<uint16_t>& codes) const {
+    Key key;
+    makeKey(co_list, option_space, codes, key);
+    std::map<Key, Entry>::const_iterator entry = entries_.find(key);
+    if (entry == entries_.end()) {
+        return (0);
+    }
+    return (&entry->second.options_);
+}
+
+const OptionCollection&
+CfgOptionListCache::add(const CfgOptionList& co_list,
+                        const std::string& option_space,
+                        const std::vector<uint16_t>& codes,
+                        const OptionCollection& options) {
+    if (entries_.size() >= MAX_ENTRIES) {
+        clear();
+    }
+
+    Key key;
+    makeKey(co_list, option_space, codes, key);
+    Entry& entry = entries_[key];
+    entry.co_list_ = co_list;
+    entry.options_ = options;
+    return (entry.options_);
+}
+
+void
+CfgOptionListCache::clear() {
+    entries_.clear();
+}
+
+}
+}
@@ -0,0 +1,132 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CFG_OPTION_LIST_CACHE_H
+#define CFG_OPTION_LIST_CACHE_H
+
+#include <dhcp/option.h>
+#include <dhcpsrv/cfg_option.h>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Cache of the options selected from lists of configured options.
+///
+/// When building a response the server walks the options configured for
+/// the host, pool, subnet, shared network, classes and globally (the
+/// @c CfgOptionList) and, for each requested or persistent option code,
+/// picks the first configured instance. For a given list and set of
+/// requested codes the result is always the same, so this class caches it.
+/// The cached options are the instances held by the configuration: they
+/// are shared, not copied, with the responses.
+///
+/// An entry is identified by the configured option containers of the list,
+/// the option space and the requested codes. The entry holds references to
+/// the containers so as they can't be destroyed and their addresses reused
+/// while the entry exists. The cache belongs to the server configuration,
+/// so a new configuration comes with an empty cache. It must be cleared
+/// when options of the configuration are modified in place. The lists
+/// including options fetched from a host database should not be cached
+/// as these options are created for each query.
+class CfgOptionListCache {
+public:
+
+    /// @brief Maximum number of entries.
+    ///
+    /// The cache is cleared when it is full so as clients sending many
+    /// different Parameter Request Lists can't make it grow without limit.
+    static const size_t MAX_ENTRIES = 4096;
+
+    /// @brief Constructor.
+    CfgOptionListCache();
+
+    /// @brief Returns the cached options.
+    ///
+    /// @param co_list list of configured options.
+    /// @param option_space option space of the options.
+    /// @param codes requested option codes.
+    /// @return pointer to the cached options or null if they are not
+    /// cached. The pointer is valid until the cache is modified.
+    const OptionCollection* get(const CfgOptionList& co_list,
+                                const std::string& option_space,
+                                const std::vector<uint16_t>& codes) const;
+
+    /// @brief Caches options.
+    ///
+    /// @param co_list list of configured options.
+    /// @param option_space option space of the options.
+    /// @param codes requested option codes.
+    /// @param options options selected for this list and codes.
+    /// @return reference to the cached options. It is valid until the
+    /// cache is modified.
+    const OptionCollection& add(const CfgOptionList& co_list,
+                                const std::string& option_space,
+                                const std::vector<uint16_t>& codes,
+                                const OptionCollection& options);
+
+    /// @brief Removes all entries.
+    void clear();
+
+    /// @brief Returns the number of entries.
+    size_t size() const {
+        return (entries_.size());
+    }
+
+private:
+
+    /// @brief Identifies an entry.
+    struct Key {
+        /// @brief Addresses of the configured option containers.
+        std::vector<const CfgOption*> cfg_options_;
+
+        /// @brief Option space.
+        std::string option_space_;
+
+        /// @brief Requested option codes.
+        std::vector<uint16_t> codes_;
+
+        /// @brief Less than operator, used by the map of entries.
+        ///
+        /// @param other key to compare to.
+        bool operator<(const Key& other) const;
+    };
+
+    /// @brief Cached options with the containers they were selected from.
+    struct Entry {
+        /// @brief Configured option containers, kept alive by the entry.
+        CfgOptionList co_list_;
+
+        /// @brief Selected options.
+        OptionCollection options_;
+    };
+
+    /// @brief Builds the key of an entry.
+    ///
+    /// @param co_list list of configured options.
+    /// @param option_space option space of the options.
+    /// @param codes requested option codes.
+    /// @param [out] key built key.
+    static void makeKey(const CfgOptionList& co_list,
+                        const std::string& option_space,
+                        const std::vector<uint16_t>& codes,
+                        Key& key);
+
+    /// @brief Cached entries.
+    std::map<Key, Entry> entries_;
+};
+
+/// @brief Pointer to the @c CfgOptionListCache.
+typedef boost::shared_ptr<CfgOptionListCache> CfgOptionListCachePtr;
+
+}
+}
+
+#endif // CFG_OPTION_LIST_CACHE_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <dhcp/option_custom.h>
 #include <dhcpsrv/cfg_subnets4.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/shared_network.h>
 #include <dhcpsrv/subnet_id.h>
@@ -345,31 +346,78 @@ CfgSubnets4::selectSubnet(const IOAddress& address,
 }
 
 void
-CfgSubnets4::removeStatistics() {
+CfgSubnets4::removeStatistics() const {
     using namespace isc::stats;
 
     // For each v4 subnet currently configured, remove the statistic.
-    StatsMgr& stats_mgr = StatsMgr::instance();
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
-        SubnetID subnet_id = (*subnet4)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-addresses"));
-
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-addresses"));
+        removeSubnetStatistics((*subnet4)->getID());
+    }
+}
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+void
+CfgSubnets4::updateReservedAddresses(const ConstCfgHostsPtr& cfg_hosts) const {
+    // The reservations stored in a hosts database can be added or deleted
+    // at any time by another server, by provisioning tools or directly in
+    // the database and they are not enumerated: each candidate address
+    // must be looked up.
+    if (!HostMgr::instance().getHostDataSourceList().empty()) {
+        resetReservedAddresses();
+        return;
+    }
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
+         subnet4 != subnets_.end(); ++subnet4) {
+        const Subnet4Ptr& subnet = *subnet4;
+        if (subnet->getHostReservationMode() == Network::HR_DISABLED) {
+            subnet->resetReservedAddresses();
+            continue;
+        }
+        std::set<IOAddress> addresses;
+        ConstHostCollection hosts = cfg_hosts->getAllSubnet4(subnet->getID());
+        for (ConstHostCollection::const_iterator host = hosts.begin();
+             host != hosts.end(); ++host) {
+            if (!(*host)->getIPv4Reservation().isV4Zero()) {
+                addresses.insert((*host)->getIPv4Reservation());
+            }
+        }
+        subnet->setReservedAddresses(addresses);
+    }
+}
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
+void
+CfgSubnets4::resetReservedAddresses() const {
+    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
+         subnet4 != subnets_.end(); ++subnet4) {
+        (*subnet4)->resetReservedAddresses();
     }
 }
 
+void
+CfgSubnets4::removeSubnetStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "pools-exhausted"));
+}
+
 void
 CfgSubnets4::updateStatistics() {
     using namespace isc::stats;
@@ -392,6 +440,114 @@ CfgSubnets4::updateStatistics() {
     }
 }
 
+void
+CfgSubnets4::updateStatistics(const CfgSubnets4& previous) {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // Find the subnets which have not changed and which already have
+    // lease statistics. The statistics of all other subnets from the
+    // previous configuration are removed.
+    SubnetIDSet unchanged;
+    for (Subnet4Collection::const_iterator old_subnet = previous.subnets_.begin();
+         old_subnet != previous.subnets_.end(); ++old_subnet) {
+        SubnetID subnet_id = (*old_subnet)->getID();
+        Subnet4Ptr subnet = getSubnet(subnet_id);
+        if (subnet && subnet->samePools(**old_subnet) &&
+            stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                            "assigned-addresses"))) {
+            unchanged.insert(subnet_id);
+        } else {
+            removeSubnetStatistics(subnet_id);
+        }
+    }
+
+    // Update the number of available addresses for all subnets and
+    // gather the subnets which require lease statistics recount.
+    SubnetIDSet changed;
+    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
+         subnet4 != subnets_.end(); ++subnet4) {
+        SubnetID subnet_id = (*subnet4)->getID();
+
+        stats_mgr.setValue(StatsMgr::
+                           generateName("subnet", subnet_id, "total-addresses"),
+                                        static_cast<int64_t>
+                                        ((*subnet4)->getPoolCapacity(Lease::
+                                                                     TYPE_V4)));
+
+        if (unchanged.count(subnet_id) == 0) {
+            changed.insert(subnet_id);
+        }
+    }
+
+    if (changed.empty()) {
+        // Nothing to recount.
+        return;
+
+    } else if (unchanged.empty()) {
+        // Nothing can be kept so recount everything in one pass.
+        LeaseMgrFactory::instance().recountLeaseStats4();
+
+    } else {
+        LeaseMgrFactory::instance().recountLeaseStats4(changed);
+    }
+}
+
+void
+CfgSubnets4::recountPoolLeases() {
+    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
+         subnet4 != subnets_.end(); ++subnet4) {
+        recountSubnetPoolLeases(*subnet4);
+    }
+}
+
+void
+CfgSubnets4::recountPoolLeases(const CfgSubnets4& previous) {
+    for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
+         subnet4 != subnets_.end(); ++subnet4) {
+        Subnet4Ptr old_subnet = previous.getSubnet((*subnet4)->getID());
+        if (!old_subnet || !(*subnet4)->samePools(*old_subnet)) {
+            recountSubnetPoolLeases(*subnet4);
+            continue;
+        }
+        // The pools are the same and in the same order.
+        const PoolCollection& pools = (*subnet4)->getPools(Lease::TYPE_V4);
+        const PoolCollection& old_pools = old_subnet->getPools(Lease::TYPE_V4);
+        for (size_t i = 0; i < pools.size(); ++i) {
+            if (!old_pools[i]->isAssignedLeasesValid()) {
+                recountSubnetPoolLeases(*subnet4);
+                break;
+            }
+            pools[i]->setAssignedLeases(old_pools[i]->getAssignedLeases());
+        }
+    }
+}
+
+void
+CfgSubnets4::recountSubnetPoolLeases(const Subnet4Ptr& subnet) {
+    const PoolCollection& pools = subnet->getPools(Lease::TYPE_V4);
+    if (pools.empty()) {
+        return;
+    }
+    for (PoolCollection::const_iterator pool = pools.begin();
+         pool != pools.end(); ++pool) {
+        (*pool)->setAssignedLeases(0);
+    }
+
+    // The expired leases are counted until they are reclaimed, as the
+    // reclamation makes their addresses available.
+    Lease4Collection leases =
+        LeaseMgrFactory::instance().getLeases4(subnet->getID());
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        if (((*lease)->state_ == Lease::STATE_DEFAULT) ||
+            ((*lease)->state_ == Lease::STATE_DECLINED)) {
+            subnet->addAssignedLeases(Lease::TYPE_V4, (*lease)->addr_, 1);
+        }
+    }
+}
+
 ElementPtr
 CfgSubnets4::toElement() const {
     ElementPtr result = Element::createList();
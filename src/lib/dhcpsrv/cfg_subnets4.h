@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <asiolink/io_address.h>
 #include <cc/cfg_to_element.h>
 #include <dhcp/pkt4.h>
+#include <dhcpsrv/cfg_hosts.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_id.h>
 #include <dhcpsrv/subnet_selector.h>
@@ -244,13 +245,64 @@ public:
     /// not expected to change until the next reconfiguration event.
     void updateStatistics();
 
+    /// @brief Updates statistics incrementally.
+    ///
+    /// This variant is used when the new configuration replaces the
+    /// previous one and both use the same lease database. The statistics
+    /// of the subnets which are not present in the new configuration, or
+    /// whose prefix or pools have changed, are removed. The lease statistics
+    /// are recounted only for those subnets which are new or have changed,
+    /// while the lease statistics of the other subnets are kept. The number
+    /// of available addresses is updated for all subnets.
+    ///
+    /// @param previous Subnets configuration being replaced.
+    void updateStatistics(const CfgSubnets4& previous);
+
+    /// @brief Counts the leases in use in each pool.
+    ///
+    /// The leases of each subnet are fetched from the lease database and
+    /// the numbers of leases in use in the pools are set from them. The
+    /// expired leases are counted until they are reclaimed. These numbers
+    /// are then maintained by the allocation engine and used to skip the
+    /// exhausted pools, see @ref Pool::isExhausted.
+    void recountPoolLeases();
+
+    /// @brief Counts the leases in use in each pool incrementally.
+    ///
+    /// The numbers of leases in use are copied from the pools of the
+    /// previous configuration for the subnets whose prefix and pools have
+    /// not changed, and are counted from the lease database for the other
+    /// subnets.
+    ///
+    /// @param previous Subnets configuration being replaced.
+    void recountPoolLeases(const CfgSubnets4& previous);
+
     /// @brief Removes statistics.
     ///
     /// During commitment of a new configuration, we need to get rid of the old
     /// statistics for the old configuration. In particular, we need to remove
     /// anything related to subnets, as there may be fewer subnets in the new
     /// configuration and also subnet-ids may change.
-    void removeStatistics();
+    void removeStatistics() const;
+
+    /// @brief Updates the reserved addresses of the subnets.
+    ///
+    /// The hosts reserved in each subnet using host reservations are
+    /// fetched from the configuration and their addresses are kept by the
+    /// subnet, so the allocation engine doesn't look up the candidate
+    /// addresses which are not reserved. The hosts databases are
+    /// not enumerated: when one is configured the reserved addresses are
+    /// dropped and every candidate is looked up, as its content may change
+    /// at any time.
+    ///
+    /// @param cfg_hosts Hosts specified in the configuration.
+    void updateReservedAddresses(const ConstCfgHostsPtr& cfg_hosts) const;
+
+    /// @brief Forgets the reserved addresses of the subnets.
+    ///
+    /// This is called for the configuration being replaced as the
+    /// reserved addresses of its subnets are no longer maintained.
+    void resetReservedAddresses() const;
 
     /// @brief Unparse a configuration object
     ///
@@ -259,6 +311,16 @@ public:
 
 private:
 
+    /// @brief Removes statistics of a subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    static void removeSubnetStatistics(const SubnetID& subnet_id);
+
+    /// @brief Counts the leases in use in the pools of a subnet.
+    ///
+    /// @param subnet Subnet which pools are counted.
+    static void recountSubnetPoolLeases(const Subnet4Ptr& subnet);
+
     /// @brief A container for IPv4 subnets.
     Subnet4Collection subnets_;
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <asiolink/addr_utilities.h>
 #include <dhcpsrv/cfg_subnets6.h>
 #include <dhcpsrv/dhcpsrv_log.h>
+#include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/subnet_id.h>
 #include <stats/stats_mgr.h>
@@ -243,33 +244,79 @@ CfgSubnets6::getSubnet(const SubnetID id) const {
 }
 
 void
-CfgSubnets6::removeStatistics() {
+CfgSubnets6::removeStatistics() const {
     using namespace isc::stats;
 
-    StatsMgr& stats_mgr = StatsMgr::instance();
     // For each v6 subnet currently configured, remove the statistics.
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
-        SubnetID subnet_id = (*subnet6)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
+        removeSubnetStatistics((*subnet6)->getID());
+    }
+}
+
+void
+CfgSubnets6::updateReservedAddresses(const ConstCfgHostsPtr& cfg_hosts) const {
+    // The reservations stored in a hosts database can be added or deleted
+    // at any time by another server, by provisioning tools or directly in
+    // the database and they are not enumerated: each candidate address
+    // must be looked up.
+    if (!HostMgr::instance().getHostDataSourceList().empty()) {
+        resetReservedAddresses();
+        return;
+    }
+
+    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
+         subnet6 != subnets_.end(); ++subnet6) {
+        const Subnet6Ptr& subnet = *subnet6;
+        if (subnet->getHostReservationMode() == Network::HR_DISABLED) {
+            subnet->resetReservedAddresses();
+            continue;
+        }
+        std::set<IOAddress> addresses;
+        ConstHostCollection hosts = cfg_hosts->getAllSubnet6(subnet->getID());
+        for (ConstHostCollection::const_iterator host = hosts.begin();
+             host != hosts.end(); ++host) {
+            IPv6ResrvRange resrvs = (*host)->getIPv6Reservations();
+            for (IPv6ResrvIterator resrv = resrvs.first;
+                 resrv != resrvs.second; ++resrv) {
+                addresses.insert(resrv->second.getPrefix());
+            }
+        }
+        subnet->setReservedAddresses(addresses);
+    }
+}
+
+void
+CfgSubnets6::resetReservedAddresses() const {
+    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
+         subnet6 != subnets_.end(); ++subnet6) {
+        (*subnet6)->resetReservedAddresses();
+    }
+}
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-nas"));
+void
+CfgSubnets6::removeSubnetStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
-    }
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 }
 
 void
@@ -299,6 +346,126 @@ CfgSubnets6::updateStatistics() {
     }
 }
 
+void
+CfgSubnets6::updateStatistics(const CfgSubnets6& previous) {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // Find the subnets which have not changed and which already have
+    // lease statistics. The statistics of all other subnets from the
+    // previous configuration are removed.
+    SubnetIDSet unchanged;
+    for (Subnet6Collection::const_iterator old_subnet = previous.subnets_.begin();
+         old_subnet != previous.subnets_.end(); ++old_subnet) {
+        SubnetID subnet_id = (*old_subnet)->getID();
+        Subnet6Ptr subnet = getSubnet(subnet_id);
+        if (subnet && subnet->samePools(**old_subnet) &&
+            stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                            "assigned-nas"))) {
+            unchanged.insert(subnet_id);
+        } else {
+            removeSubnetStatistics(subnet_id);
+        }
+    }
+
+    // Update the number of available addresses and prefixes for all
+    // subnets and gather the subnets which require lease statistics
+    // recount.
+    SubnetIDSet changed;
+    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
+         subnet6 != subnets_.end(); ++subnet6) {
+        SubnetID subnet_id = (*subnet6)->getID();
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "total-nas"),
+                           static_cast<int64_t>
+                           ((*subnet6)->getPoolCapacity(Lease::TYPE_NA)));
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                                  "total-pds"),
+                            static_cast<int64_t>
+                            ((*subnet6)->getPoolCapacity(Lease::TYPE_PD)));
+
+        if (unchanged.count(subnet_id) == 0) {
+            changed.insert(subnet_id);
+        }
+    }
+
+    if (changed.empty()) {
+        // Nothing to recount.
+        return;
+
+    } else if (unchanged.empty()) {
+        // Nothing can be kept so recount everything in one pass.
+        LeaseMgrFactory::instance().recountLeaseStats6();
+
+    } else {
+        LeaseMgrFactory::instance().recountLeaseStats6(changed);
+    }
+}
+
+void
+CfgSubnets6::recountPoolLeases() {
+    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
+         subnet6 != subnets_.end(); ++subnet6) {
+        recountSubnetPoolLeases(*subnet6);
+    }
+}
+
+void
+CfgSubnets6::recountPoolLeases(const CfgSubnets6& previous) {
+    for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
+         subnet6 != subnets_.end(); ++subnet6) {
+        Subnet6Ptr old_subnet = previous.getSubnet((*subnet6)->getID());
+        if (!old_subnet || !(*subnet6)->samePools(*old_subnet)) {
+            recountSubnetPoolLeases(*subnet6);
+            continue;
+        }
+        // The pools are the same and in the same order.
+        const PoolCollection& pools = (*subnet6)->getPools(Lease::TYPE_PD);
+        const PoolCollection& old_pools = old_subnet->getPools(Lease::TYPE_PD);
+        for (size_t i = 0; i < pools.size(); ++i) {
+            Pool6Ptr pool = boost::dynamic_pointer_cast<Pool6>(pools[i]);
+            Pool6Ptr old_pool = boost::dynamic_pointer_cast<Pool6>(old_pools[i]);
+            if (!pool || !old_pool || !old_pool->isFreePrefixesValid()) {
+                recountSubnetPoolLeases(*subnet6);
+                break;
+            }
+            pool->copyFreePrefixes(*old_pool);
+        }
+    }
+}
+
+void
+CfgSubnets6::recountSubnetPoolLeases(const Subnet6Ptr& subnet) {
+    const PoolCollection& pools = subnet->getPools(Lease::TYPE_PD);
+    bool tracked = false;
+    for (PoolCollection::const_iterator pool = pools.begin();
+         pool != pools.end(); ++pool) {
+        Pool6Ptr pool6 = boost::dynamic_pointer_cast<Pool6>(*pool);
+        if (pool6 && pool6->initFreePrefixes()) {
+            tracked = true;
+        }
+    }
+    if (!tracked) {
+        return;
+    }
+
+    // The expired leases are left free so as the allocation engine can
+    // reuse them without waiting for their reclamation.
+    Lease6Collection leases =
+        LeaseMgrFactory::instance().getLeases6(subnet->getID());
+    for (Lease6Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        if (((*lease)->type_ == Lease::TYPE_PD) &&
+            ((*lease)->state_ == Lease::STATE_DEFAULT) &&
+            !(*lease)->expired()) {
+            subnet->addAssignedLeases(Lease::TYPE_PD, (*lease)->addr_, 1);
+        }
+    }
+}
+
 ElementPtr
 CfgSubnets6::toElement() const {
     ElementPtr result = Element::createList();
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,17 +8,55 @@
 #include <asiolink/io_address.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/libdhcp++.h>
+#include <database/database_connection.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <sstream>
 #include <string>
 
 using namespace isc::asiolink;
+using namespace isc::db;
 using namespace isc::util;
 
 namespace isc {
 namespace dhcp {
 
+namespace {
+
+/// @brief Checks if lease statistics can be carried over between
+/// configurations.
+///
+/// The statistics of the unchanged subnets can be kept only if both
+/// configurations use the same lease database. The memfile backend
+/// which doesn't persist leases loses them when it is recreated so
+/// the statistics must always be recounted in this case.
+///
+/// @param previous Configuration being replaced.
+/// @param current New configuration.
+/// @return true if the lease statistics can be carried over.
+bool
+sameLeaseDatabase(const SrvConfig& previous, const SrvConfig& current) {
+    const std::string access =
+        current.getCfgDbAccess()->getLeaseDbAccessString();
+    if (access != previous.getCfgDbAccess()->getLeaseDbAccessString()) {
+        return (false);
+    }
+    try {
+        DatabaseConnection::ParameterMap parameters =
+            DatabaseConnection::parse(access);
+        DatabaseConnection::ParameterMap::const_iterator param =
+            parameters.find("persist");
+        if ((param != parameters.end()) && (param->second == "false")) {
+            return (false);
+        }
+    } catch (const std::exception&) {
+        return (false);
+    }
+    return (true);
+}
+
+} // end of anonymous namespace
+
 const size_t CfgMgr::CONFIG_LIST_SIZE = 10;
 
 CfgMgr&
@@ -89,10 +127,9 @@ CfgMgr::commit() {
 
     ensureCurrentAllocated();
 
-    // First we need to remove statistics. The new configuration can have fewer
-    // subnets. Also, it may change subnet-ids. So we need to remove them all
-    // and add it back.
-    configuration_->removeStatistics();
+    // Remember the configuration being replaced to figure out which
+    // statistics need to be updated.
+    SrvConfigPtr previous = configuration_;
 
     if (!configs_.back()->sequenceEquals(*configuration_)) {
         configuration_ = configs_.back();
@@ -105,8 +142,30 @@ CfgMgr::commit() {
         }
     }
 
-    // Now we need to set the statistics back.
-    configuration_->updateStatistics();
+    // The new configuration can have fewer subnets. Also, it may change
+    // subnet-ids or pools. If the lease database is the same, the statistics
+    // of the subnets which haven't changed are kept and only the remaining
+    // ones are recounted. Otherwise, we need to remove them all and add them
+    // back.
+    if ((previous != configuration_) &&
+        sameLeaseDatabase(*previous, *configuration_)) {
+        configuration_->updateStatistics(*previous);
+
+    } else {
+        previous->removeStatistics();
+        configuration_->updateStatistics();
+    }
+
+    // Find the addresses reserved in the subnets, the host data sources
+    // being already opened.
+    if (previous != configuration_) {
+        previous->getCfgSubnets4()->resetReservedAddresses();
+        previous->getCfgSubnets6()->resetReservedAddresses();
+    }
+    configuration_->getCfgSubnets4()->
+        updateReservedAddresses(configuration_->getCfgHosts());
+    configuration_->getCfgSubnets6()->
+        updateReservedAddresses(configuration_->getCfgHosts());
 }
 
 void
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,6 +26,11 @@ namespace dhcp {
 /// all @c Host objects which are identified by a specified identifier, i.e.
 /// HW address or DUID.
 ///
+/// The indexes used for the exact match lookups performed while processing
+/// packets are hashed. The ordered indexes are kept where a range of hosts
+/// must be returned in a stable order, i.e. all hosts for an identifier,
+/// or where hosts are removed by subnet id.
+///
 /// @todo This container will be extended to search for @c Host objects
 /// associated with a specific IPv4 address or IPv6 prefix/length.
 ///
@@ -62,8 +67,8 @@ typedef boost::multi_index_container<
         >,
 
         // Second index is used to search for the host using reserved IPv4
-        // address.
-        boost::multi_index::ordered_non_unique<
+        // address. Only exact matches are looked up so the index is hashed.
+        boost::multi_index::hashed_non_unique<
             // Index using values returned by the @c Host::getIPv4Reservation.
             boost::multi_index::const_mem_fun<Host, const asiolink::IOAddress&,
                                                &Host::getIPv4Reservation>
@@ -81,6 +86,48 @@ typedef boost::multi_index_container<
             // Index using values returned by the @c Host::getIPv6SubnetID
             boost::multi_index::const_mem_fun<Host, SubnetID,
                                               &Host::getIPv6SubnetID>
+        >,
+
+        // Fifth index is used to search for the host using an identifier
+        // in an IPv4 subnet. This is the lookup performed for each
+        // DHCPv4 client so the index is hashed.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, const std::vector<uint8_t>&,
+                    &Host::getIdentifier
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, Host::IdentifierType,
+                    &Host::getIdentifierType
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv4SubnetID
+                >
+            >
+        >,
+
+        // Sixth index is used to search for the host using an identifier
+        // in an IPv6 subnet. This is the lookup performed for each
+        // DHCPv6 client so the index is hashed.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, const std::vector<uint8_t>&,
+                    &Host::getIdentifier
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, Host::IdentifierType,
+                    &Host::getIdentifierType
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv6SubnetID
+                >
+            >
         >
     >
 > HostContainer;
@@ -125,6 +172,26 @@ typedef HostContainer::nth_index<3>::type HostContainerIndex3;
 typedef std::pair<HostContainerIndex3::iterator,
                   HostContainerIndex3::iterator> HostContainerIndex3Range;
 
+/// @brief Fifth index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using an
+/// identifier + identifier type + IPv4 subnet id tuple.
+typedef HostContainer::nth_index<4>::type HostContainerIndex4;
+
+/// @brief Results range returned using the @c HostContainerIndex4.
+typedef std::pair<HostContainerIndex4::iterator,
+                  HostContainerIndex4::iterator> HostContainerIndex4Range;
+
+/// @brief Sixth index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using an
+/// identifier + identifier type + IPv6 subnet id tuple.
+typedef HostContainer::nth_index<5>::type HostContainerIndex5;
+
+/// @brief Results range returned using the @c HostContainerIndex5.
+typedef std::pair<HostContainerIndex5::iterator,
+                  HostContainerIndex5::iterator> HostContainerIndex5Range;
+
 /// @brief Defines one entry for the Host Container for v6 hosts
 ///
 /// It's essentially a pair of (IPv6 reservation, Host pointer).
@@ -169,8 +236,9 @@ typedef boost::multi_index_container<
     // Start specification of indexes here.
     boost::multi_index::indexed_by<
 
-        // First index is used to search by an address.
-        boost::multi_index::ordered_non_unique<
+        // First index is used to search by an address. Only exact
+        // matches are looked up so the index is hashed.
+        boost::multi_index::hashed_non_unique<
 
             // Address is extracted by calling IPv6Resrv::getPrefix()
             // and it will return an IOAddress object.
@@ -179,8 +247,9 @@ typedef boost::multi_index_container<
         >,
 
         // Second index is used to search by (subnet_id, address) pair.
-        // This is
-        boost::multi_index::ordered_unique<
+        // This is the lookup performed for each candidate address by the
+        // allocation engine so the index is hashed.
+        boost::multi_index::hashed_unique<
 
             /// This is a composite key. It uses two keys: subnet-id and
             /// IPv6 address reservation.
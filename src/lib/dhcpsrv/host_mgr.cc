@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -340,6 +340,22 @@ HostMgr::add(const HostPtr& host) {
     if (cache_ptr_) {
         cache(host);
     }
+
+    // The hosts databases can be modified behind the server's back, so the
+    // reserved addresses of the subnets can no longer be trusted.
+    ConstSrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    if (host->getIPv4SubnetID() != 0) {
+        Subnet4Ptr subnet = cfg->getCfgSubnets4()->getSubnet(host->getIPv4SubnetID());
+        if (subnet) {
+            subnet->resetReservedAddresses();
+        }
+    }
+    if (host->getIPv6SubnetID() != 0) {
+        Subnet6Ptr subnet = cfg->getCfgSubnets6()->getSubnet(host->getIPv6SubnetID());
+        if (subnet) {
+            subnet->resetReservedAddresses();
+        }
+    }
 }
 
 bool
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -254,7 +254,8 @@ public:
     /// @brief Adds a new host to the alternate data source.
     ///
     /// This method will throw an exception if no alternate data source is
-    /// in use.
+    /// in use. The reserved addresses of the subnets of the host in the
+    /// current configuration are forgotten, see @ref Subnet::mayBeReserved.
     ///
     /// @param host Pointer to the new @c Host object being added.
     virtual void add(const HostPtr& host);
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -125,6 +125,71 @@ LeaseMgr::recountLeaseStats4() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats4(const SubnetIDSet& subnet_ids) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    int64_t zero = 0;
+    for (SubnetIDSet::const_iterator subnet_id = subnet_ids.begin();
+         subnet_id != subnet_ids.end(); ++subnet_id) {
+        LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery4(*subnet_id);
+        if (!query) {
+            // The backend can't recount a single subnet, so recount all.
+            recountLeaseStats4();
+            return;
+        }
+
+        // Clear subnet level stats.
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "assigned-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "declined-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "reclaimed-declined-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "reclaimed-leases"),
+                           zero);
+
+        // Get counts per state for the subnet.
+        LeaseStatsRow row;
+        while (query->getNextRow(row)) {
+            if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                          "assigned-addresses"),
+                                   row.state_count_);
+            } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+                stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
+                                                          "declined-addresses"),
+                                   row.state_count_);
+            }
+        }
+    }
+
+    // Recalculate the global value from the subnet level values.
+    const Subnet4Collection* subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getAll();
+    int64_t declined = 0;
+    for (Subnet4Collection::const_iterator subnet = subnets->begin();
+         subnet != subnets->end(); ++subnet) {
+        ObservationPtr declined_obs =
+            stats_mgr.getObservation(StatsMgr::generateName("subnet",
+                                                            (*subnet)->getID(),
+                                                            "declined-addresses"));
+        if (declined_obs) {
+            declined += declined_obs->getInteger().first;
+        }
+    }
+    stats_mgr.setValue("declined-addresses", declined);
+}
+
 LeaseStatsQuery::LeaseStatsQuery()
     : first_subnet_id_(0), last_subnet_id_(0), select_mode_(ALL_SUBNETS) {
 }
@@ -270,6 +335,95 @@ LeaseMgr::recountLeaseStats6() {
     }
 }
 
+void
+LeaseMgr::recountLeaseStats6(const SubnetIDSet& subnet_ids) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    int64_t zero = 0;
+    for (SubnetIDSet::const_iterator subnet_id = subnet_ids.begin();
+         subnet_id != subnet_ids.end(); ++subnet_id) {
+        LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery6(*subnet_id);
+        if (!query) {
+            // The backend can't recount a single subnet, so recount all.
+            recountLeaseStats6();
+            return;
+        }
+
+        // Clear subnet level stats.
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "assigned-nas"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "declined-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::
+                           generateName("subnet", *subnet_id,
+                                        "reclaimed-declined-addresses"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "assigned-pds"),
+                           zero);
+
+        stats_mgr.setValue(StatsMgr::generateName("subnet", *subnet_id,
+                                                  "reclaimed-leases"),
+                           zero);
+
+        // Get counts per type and state for the subnet.
+        LeaseStatsRow row;
+        while (query->getNextRow(row)) {
+            switch(row.lease_type_) {
+                case Lease::TYPE_NA:
+                    if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                        stats_mgr.setValue(StatsMgr::
+                                           generateName("subnet", row.subnet_id_,
+                                                        "assigned-nas"),
+                                           row.state_count_);
+                    } else if (row.lease_state_ == Lease::STATE_DECLINED) {
+                        stats_mgr.setValue(StatsMgr::
+                                           generateName("subnet", row.subnet_id_,
+                                                        "declined-addresses"),
+                                           row.state_count_);
+                    }
+                    break;
+
+                case Lease::TYPE_PD:
+                    if (row.lease_state_ == Lease::STATE_DEFAULT) {
+                        stats_mgr.setValue(StatsMgr::
+                                           generateName("subnet", row.subnet_id_,
+                                                        "assigned-pds"),
+                                           row.state_count_);
+                    }
+                    break;
+
+                default:
+                    // We dont' support TYPE_TAs yet
+                    break;
+            }
+        }
+    }
+
+    // Recalculate the global value from the subnet level values.
+    const Subnet6Collection* subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets6()->getAll();
+    int64_t declined = 0;
+    for (Subnet6Collection::const_iterator subnet = subnets->begin();
+         subnet != subnets->end(); ++subnet) {
+        ObservationPtr declined_obs =
+            stats_mgr.getObservation(StatsMgr::generateName("subnet",
+                                                            (*subnet)->getID(),
+                                                            "declined-addresses"));
+        if (declined_obs) {
+            declined += declined_obs->getInteger().first;
+        }
+    }
+    stats_mgr.setValue("declined-addresses", declined);
+}
+
 LeaseStatsQueryPtr
 LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
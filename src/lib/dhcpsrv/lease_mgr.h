@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -579,6 +579,19 @@ public:
     /// adding to the appropriate global statistic.
     void recountLeaseStats4();
 
+    /// @brief Recalculates stats for IPv4 leases in the specified subnets
+    ///
+    /// This variant recalculates the per-subnet statistics listed for
+    /// @ref recountLeaseStats4() only for the specified subnets, using
+    /// the single subnet lease stats query. The statistics of the other
+    /// subnets are left intact. The global declined-addresses statistic
+    /// is recalculated as the sum of the per-subnet values for the
+    /// configured subnets. If the backend does not support the single
+    /// subnet query, the statistics are recounted for all subnets.
+    ///
+    /// @param subnet_ids identifiers of the subnets to recount.
+    void recountLeaseStats4(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv4 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -636,6 +649,19 @@ public:
     /// per subnet and adding to the appropriate global statistic.
     void recountLeaseStats6();
 
+    /// @brief Recalculates stats for IPv6 leases in the specified subnets
+    ///
+    /// This variant recalculates the per-subnet statistics listed for
+    /// @ref recountLeaseStats6() only for the specified subnets, using
+    /// the single subnet lease stats query. The statistics of the other
+    /// subnets are left intact. The global declined-addresses statistic
+    /// is recalculated as the sum of the per-subnet values for the
+    /// configured subnets. If the backend does not support the single
+    /// subnet query, the statistics are recounted for all subnets.
+    ///
+    /// @param subnet_ids identifiers of the subnets to recount.
+    void recountLeaseStats6(const SubnetIDSet& subnet_ids);
+
     /// @brief Creates and runs the IPv6 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
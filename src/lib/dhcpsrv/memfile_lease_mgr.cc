@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -645,6 +645,12 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                  CSVLeaseFile4>(file4,
                                                                 lease_file4_,
                                                                 storage4_);
+            // The identifiers are replaced with equal ones so the indexes
+            // are intact.
+            for (auto lease = storage4_.begin(); lease != storage4_.end();
+                 ++lease) {
+                shareIdentifiers(**lease);
+            }
         }
     } else {
         std::string file6 = initLeaseFilePath(V6);
@@ -653,6 +659,12 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                  CSVLeaseFile6>(file6,
                                                                 lease_file6_,
                                                                 storage6_);
+            // The identifiers are replaced with equal ones so the indexes
+            // are intact.
+            for (auto lease = storage6_.begin(); lease != storage6_.end();
+                 ++lease) {
+                shareIdentifiers(**lease);
+            }
         }
     }
 
@@ -691,6 +703,43 @@ Memfile_LeaseMgr::getDBVersion() {
     return (tmp.str());
 }
 
+void
+Memfile_LeaseMgr::shareIdentifiers(Lease4& lease) const {
+    if (lease.hwaddr_) {
+        const Lease4StorageHWAddressSubnetIdIndex& idx =
+            storage4_.get<HWAddressSubnetIdIndexTag>();
+        Lease4StorageHWAddressSubnetIdIndex::const_iterator stored =
+            idx.find(boost::make_tuple(lease.hwaddr_->hwaddr_));
+        if ((stored != idx.end()) && (*stored)->hwaddr_ &&
+            (*(*stored)->hwaddr_ == *lease.hwaddr_) &&
+            ((*stored)->hwaddr_->source_ == lease.hwaddr_->source_)) {
+            lease.hwaddr_ = (*stored)->hwaddr_;
+        }
+    }
+
+    if (lease.client_id_) {
+        const Lease4StorageClientIdSubnetIdIndex& idx =
+            storage4_.get<ClientIdSubnetIdIndexTag>();
+        Lease4StorageClientIdSubnetIdIndex::const_iterator stored =
+            idx.find(boost::make_tuple(lease.client_id_->getClientId()));
+        if ((stored != idx.end()) && (*stored)->client_id_) {
+            lease.client_id_ = (*stored)->client_id_;
+        }
+    }
+}
+
+void
+Memfile_LeaseMgr::shareIdentifiers(Lease6& lease) const {
+    if (lease.duid_) {
+        const Lease6StorageDuidIndex& idx = storage6_.get<DuidIndexTag>();
+        Lease6StorageDuidIndex::const_iterator stored =
+            idx.find(lease.duid_->getDuid());
+        if ((stored != idx.end()) && (*stored)->duid_) {
+            lease.duid_ = (*stored)->duid_;
+        }
+    }
+}
+
 bool
 Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -708,6 +757,9 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
+    // The caller's lease is stored as is, so it shares the identifiers
+    // of the stored leases too.
+    shareIdentifiers(*lease);
     storage4_.insert(lease);
     return (true);
 }
@@ -729,6 +781,9 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
+    // The caller's lease is stored as is, so it shares the identifiers
+    // of the stored leases too.
+    shareIdentifiers(*lease);
     storage6_.insert(lease);
     return (true);
 }
@@ -1141,7 +1196,9 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    Lease4Ptr lease_copy(new Lease4(*lease));
+    shareIdentifiers(*lease_copy);
+    index.replace(lease_it, lease_copy);
 }
 
 void
@@ -1167,7 +1224,9 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
     }
 
     // Use replace() to re-index leases.
-    index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    Lease6Ptr lease_copy(new Lease6(*lease));
+    shareIdentifiers(*lease_copy);
+    index.replace(lease_it, lease_copy);
 }
 
 bool
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -141,12 +141,22 @@ public:
 
     /// @brief Adds an IPv4 lease.
     ///
-    /// @param lease lease to be added
+    /// The lease object itself is stored, not a copy of it. Its HW address
+    /// and client identifier pointers are replaced with the equal instances
+    /// held by the stored leases of the same client, see
+    /// @c shareIdentifiers. The identifier values are not changed.
+    ///
+    /// @param [in,out] lease lease to be added
     virtual bool addLease(const Lease4Ptr& lease);
 
     /// @brief Adds an IPv6 lease.
     ///
-    /// @param lease lease to be added
+    /// The lease object itself is stored, not a copy of it. Its DUID
+    /// pointer is replaced with the equal instance held by the stored
+    /// leases of the same client, see @c shareIdentifiers. The DUID value
+    /// is not changed.
+    ///
+    /// @param [in,out] lease lease to be added
     virtual bool addLease(const Lease6Ptr& lease);
 
     /// @brief Returns existing IPv4 lease for specified IPv4 address.
@@ -675,6 +685,42 @@ private:
                              boost::shared_ptr<LeaseFileType>& lease_file,
                              StorageType& storage);
 
+protected:
+
+    /// @brief Shares identifiers of the DHCPv4 lease with the stored leases.
+    ///
+    /// The same client often holds multiple leases, e.g. in different
+    /// subnets. Rather than holding a separate copy of the HW address and
+    /// client identifier for each lease, the lease is modified to point to
+    /// the equal HW address and client identifier instances of a stored
+    /// lease. The identifiers of the stored leases must not be modified in
+    /// place.
+    ///
+    /// The lease is modified, which is visible to the caller of
+    /// @c addLease as the added lease is stored as is. @c updateLease4 stores
+    /// a copy of the lease so it leaves the caller's lease untouched.
+    ///
+    /// @param [in,out] lease Lease to be stored, which identifiers are
+    /// replaced.
+    void shareIdentifiers(Lease4& lease) const;
+
+    /// @brief Shares identifiers of the DHCPv6 lease with the stored leases.
+    ///
+    /// The same client often holds multiple leases, e.g. addresses and
+    /// delegated prefixes. Rather than holding a separate copy of the
+    /// DUID for each lease, the lease is modified to point to the equal
+    /// DUID instance of a stored lease. The DUIDs of the stored leases must
+    /// not be modified in place.
+    ///
+    /// The lease is modified, which is visible to the caller of
+    /// @c addLease as the added lease is stored as is. @c updateLease6 stores
+    /// a copy of the lease so it leaves the caller's lease untouched.
+    ///
+    /// @param [in,out] lease Lease to be stored, which DUID is replaced.
+    void shareIdentifiers(Lease6& lease) const;
+
+private:
+
     /// @brief stores IPv4 leases
     Lease4Storage storage4_;
 
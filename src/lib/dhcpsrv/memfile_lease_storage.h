@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,7 @@
 #include <dhcpsrv/lease.h>
 #include <dhcpsrv/subnet_id.h>
 
+#include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/indexed_by.hpp>
 #include <boost/multi_index/member.hpp>
 #include <boost/multi_index/mem_fun.hpp>
@@ -75,7 +76,9 @@ typedef boost::multi_index_container<
         >,
 
         // Specification of the second index starts here.
-        boost::multi_index::ordered_non_unique<
+        // Only exact matches are looked up so the index is hashed. The
+        // hashed index nodes are also smaller than the ordered ones.
+        boost::multi_index::hashed_non_unique<
             boost::multi_index::tag<DuidIaidTypeIndexTag>,
             // This is a composite index that will be used to search for
             // the lease using three attributes: DUID, IAID and lease type.
@@ -119,8 +122,9 @@ typedef boost::multi_index_container<
         >,
 
         // Specification of the fifth index starts here
-        // This index is used to retrieve leases for matching duid.
-        boost::multi_index::ordered_non_unique<
+        // This index is used to retrieve leases for matching duid. Only
+        // exact matches are looked up so the index is hashed.
+        boost::multi_index::hashed_non_unique<
             boost::multi_index::tag<DuidIndexTag>,
             boost::multi_index::const_mem_fun<Lease6,
                                               const std::vector<uint8_t>&,
@@ -195,7 +199,9 @@ typedef boost::multi_index_container<
         >,
 
         // Specification of the fourth index starts here.
-        boost::multi_index::ordered_non_unique<
+        // Only exact matches are looked up so the index is hashed. The
+        // hashed index nodes are also smaller than the ordered ones.
+        boost::multi_index::hashed_non_unique<
             boost::multi_index::tag<ClientIdHWAddressSubnetIdIndexTag>,
             // This is a composite index that uses three values to search for a
             // lease: client id, HW address and subnet id.
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this // file, You can obtain one at http://mozilla.org/MPL/2.0/.  #include <config.h> 
@@ -656,8 +656,9 @@ Subnet4ConfigParser::parse(ConstElementPtr subnet) {
         HostCollection hosts;
         HostReservationsListParser<HostReservationParser4> parser;
         parser.parse(subnet_->getID(), reservations, hosts);
+        CfgHostsPtr cfg_hosts = CfgMgr::instance().getStagingCfg()->getCfgHosts();
         for (auto h = hosts.begin(); h != hosts.end(); ++h) {
-            CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(*h);
+            cfg_hosts->add(*h);
         }
     }
 
@@ -1084,8 +1085,9 @@ Subnet6ConfigParser::parse(ConstElementPtr subnet) {
         HostCollection hosts;
         HostReservationsListParser<HostReservationParser6> parser;
         parser.parse(subnet_->getID(), reservations, hosts);
+        CfgHostsPtr cfg_hosts = CfgMgr::instance().getStagingCfg()->getCfgHosts();
         for (auto h = hosts.begin(); h != hosts.end(); ++h) {
-            CfgMgr::instance().getStagingCfg()->getCfgHosts()->add(*h);
+            cfg_hosts->add(*h);
         }
     }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,6 +14,60 @@
 using namespace isc::asiolink;
 using namespace isc::data;
 
+namespace {
+
+/// @brief Splits an IPv6 address into its high and low order 64 bits.
+///
+/// @param addr IPv6 address.
+/// @param [out] high High order 64 bits of the address.
+/// @param [out] low Low order 64 bits of the address.
+void
+splitAddress(const IOAddress& addr, uint64_t& high, uint64_t& low) {
+    const std::vector<uint8_t>& bytes = addr.toBytes();
+    high = 0;
+    low = 0;
+    for (int i = 0; i < 8; ++i) {
+        high = (high << 8) | bytes[i];
+        low = (low << 8) | bytes[i + 8];
+    }
+}
+
+/// @brief Builds an IPv6 address from its high and low order 64 bits.
+///
+/// @param high High order 64 bits of the address.
+/// @param low Low order 64 bits of the address.
+/// @return IPv6 address.
+IOAddress
+joinAddress(uint64_t high, uint64_t low) {
+    uint8_t bytes[V6ADDRESS_LEN];
+    for (int i = 7; i >= 0; --i) {
+        bytes[i] = static_cast<uint8_t>(high & 0xff);
+        bytes[i + 8] = static_cast<uint8_t>(low & 0xff);
+        high >>= 8;
+        low >>= 8;
+    }
+    return (IOAddress::fromBytes(AF_INET6, bytes));
+}
+
+/// @brief Returns the position of the lowest bit set in a non-zero word.
+///
+/// @param word Word with at least one bit set.
+/// @return position of the lowest bit set, from 0 to 63.
+unsigned
+lowestBit(uint64_t word) {
+    unsigned position = 0;
+    for (unsigned width = 32; width > 0; width /= 2) {
+        const uint64_t mask = (static_cast<uint64_t>(1) << width) - 1;
+        if ((word & mask) == 0) {
+            word >>= width;
+            position += width;
+        }
+    }
+    return (position);
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -21,11 +75,28 @@ Pool::Pool(Lease::Type type, const isc::asiolink::IOAddress& first,
            const isc::asiolink::IOAddress& last)
     :id_(getNextID()), first_(first), last_(last), type_(type),
      capacity_(0), cfg_option_(new CfgOption()), client_class_(""),
-     last_allocated_(first), last_allocated_valid_(false) {
+     last_allocated_(first), last_allocated_valid_(false),
+     assigned_leases_(0), assigned_leases_valid_(false) {
+}
+
+void Pool::addAssignedLeases(const int64_t delta) {
+    if (!assigned_leases_valid_) {
+        return;
+    }
+    if (delta < 0) {
+        const uint64_t removed = static_cast<uint64_t>(-delta);
+        assigned_leases_ = (removed < assigned_leases_ ?
+                            assigned_leases_ - removed : 0);
+    } else if (assigned_leases_ < capacity_) {
+        const uint64_t added = static_cast<uint64_t>(delta);
+        assigned_leases_ = (added < capacity_ - assigned_leases_ ?
+                            assigned_leases_ + added : capacity_);
+    }
 }
 
 bool Pool::inRange(const isc::asiolink::IOAddress& addr) const {
-    return (first_.smallerEqual(addr) && addr.smallerEqual(last_));
+    // Each smallerEqual() would compare the addresses twice.
+    return (!(addr < first_) && !(last_ < addr));
 }
 
 bool Pool::clientSupported(const ClientClasses& classes) const {
@@ -302,6 +373,179 @@ Pool6::init(const Lease::Type& type,
     }
 }
 
+const uint64_t Pool6::MAX_TRACKED_PREFIXES;
+
+bool
+Pool6::initFreePrefixes() {
+    resetFreePrefixes();
+    if ((type_ != Lease::TYPE_PD) || (capacity_ == 0) ||
+        (capacity_ > MAX_TRACKED_PREFIXES)) {
+        return (false);
+    }
+
+    const uint64_t words = (capacity_ + 63) / 64;
+    used_prefixes_.assign(words, 0);
+    full_words_.assign((words + 63) / 64, 0);
+
+    // The bits past the capacity are set so as they are never found free,
+    // the same for the words past the last one.
+    if (capacity_ % 64) {
+        used_prefixes_.back() = ~static_cast<uint64_t>(0) << (capacity_ % 64);
+    }
+    if (words % 64) {
+        full_words_.back() = ~static_cast<uint64_t>(0) << (words % 64);
+    }
+
+    setAssignedLeases(0);
+    return (true);
+}
+
+void
+Pool6::copyFreePrefixes(const Pool6& other) {
+    if (!other.isFreePrefixesValid() || (type_ != other.type_) ||
+        (capacity_ != other.capacity_)) {
+        resetFreePrefixes();
+        return;
+    }
+    used_prefixes_ = other.used_prefixes_;
+    full_words_ = other.full_words_;
+    setAssignedLeases(other.getAssignedLeases());
+}
+
+void
+Pool6::resetFreePrefixes() {
+    // Swap with empty vectors to release the memory.
+    std::vector<uint64_t>().swap(used_prefixes_);
+    std::vector<uint64_t>().swap(full_words_);
+    resetAssignedLeases();
+}
+
+void
+Pool6::usePrefix(const IOAddress& prefix) {
+    if (isFreePrefixesValid() && inRange(prefix)) {
+        setPrefixUsed(getPrefixIndex(prefix), true);
+    }
+}
+
+void
+Pool6::releasePrefix(const IOAddress& prefix) {
+    if (isFreePrefixesValid() && inRange(prefix)) {
+        setPrefixUsed(getPrefixIndex(prefix), false);
+    }
+}
+
+bool
+Pool6::isPrefixFree(const IOAddress& prefix) const {
+    if (!isFreePrefixesValid() || !inRange(prefix)) {
+        return (true);
+    }
+    const uint64_t index = getPrefixIndex(prefix);
+    return ((used_prefixes_[index / 64] &
+             (static_cast<uint64_t>(1) << (index % 64))) == 0);
+}
+
+bool
+Pool6::getNextFreePrefix(IOAddress& prefix) const {
+    if (!isFreePrefixesValid() || !inRange(prefix)) {
+        return (false);
+    }
+    uint64_t index = getPrefixIndex(prefix) + 1;
+    if (index >= capacity_) {
+        return (false);
+    }
+
+    // Look for a free prefix in the word of the index first.
+    uint64_t word = index / 64;
+    uint64_t free = ~used_prefixes_[word] &
+        (~static_cast<uint64_t>(0) << (index % 64));
+    if (free == 0) {
+        // Then look for the next word with a free prefix.
+        ++word;
+        uint64_t summary = word / 64;
+        if (summary >= full_words_.size()) {
+            return (false);
+        }
+        uint64_t not_full = ~full_words_[summary] &
+            (~static_cast<uint64_t>(0) << (word % 64));
+        while (not_full == 0) {
+            if (++summary >= full_words_.size()) {
+                return (false);
+            }
+            not_full = ~full_words_[summary];
+        }
+        word = summary * 64 + lowestBit(not_full);
+        free = ~used_prefixes_[word];
+    }
+    // The bits past the capacity are set so the index is in the pool.
+    index = word * 64 + lowestBit(free);
+
+    // The prefix is the first one of the pool plus index prefixes.
+    uint64_t high;
+    uint64_t low;
+    splitAddress(first_, high, low);
+    const unsigned shift = 128 - prefix_len_;
+    uint64_t add_high = 0;
+    uint64_t add_low = 0;
+    if (shift >= 64) {
+        add_high = index << (shift - 64);
+    } else if (shift == 0) {
+        add_low = index;
+    } else {
+        add_high = index >> (64 - shift);
+        add_low = index << shift;
+    }
+    low += add_low;
+    high += add_high + (low < add_low ? 1 : 0);
+    prefix = joinAddress(high, low);
+    return (true);
+}
+
+uint64_t
+Pool6::getPrefixIndex(const IOAddress& prefix) const {
+    uint64_t high;
+    uint64_t low;
+    splitAddress(prefix, high, low);
+    uint64_t first_high;
+    uint64_t first_low;
+    splitAddress(first_, first_high, first_low);
+
+    // The difference between the prefix and the first prefix of the pool,
+    // divided by the size of the delegated prefixes.
+    const uint64_t diff_low = low - first_low;
+    const uint64_t diff_high = high - first_high - (low < first_low ? 1 : 0);
+    const unsigned shift = 128 - prefix_len_;
+    if (shift >= 64) {
+        return (diff_high >> (shift - 64));
+    } else if (shift == 0) {
+        return (diff_low);
+    }
+    return ((diff_low >> shift) | (diff_high << (64 - shift)));
+}
+
+void
+Pool6::setPrefixUsed(const uint64_t index, const bool used) {
+    if (index >= capacity_) {
+        return;
+    }
+    const uint64_t word = index / 64;
+    const uint64_t bit = static_cast<uint64_t>(1) << (index % 64);
+    const uint64_t word_bit = static_cast<uint64_t>(1) << (word % 64);
+    if (((used_prefixes_[word] & bit) != 0) == used) {
+        return;
+    }
+    if (used) {
+        used_prefixes_[word] |= bit;
+        ++assigned_leases_;
+        if (used_prefixes_[word] == ~static_cast<uint64_t>(0)) {
+            full_words_[word / 64] |= word_bit;
+        }
+    } else {
+        used_prefixes_[word] &= ~bit;
+        --assigned_leases_;
+        full_words_[word / 64] &= ~word_bit;
+    }
+}
+
 data::ElementPtr
 Pool6::toElement() const {
     // Prepare the map
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -161,6 +161,58 @@ public:
         last_allocated_valid_ = false;
     }
 
+    /// @brief Returns the number of leases in use in this pool.
+    ///
+    /// The leases in use are the assigned and the declined leases, i.e.
+    /// the leases which are not available for allocation unless they are
+    /// reclaimed. The number is only meaningful when it is valid, see
+    /// @ref isAssignedLeasesValid.
+    ///
+    /// @return number of leases in use
+    uint64_t getAssignedLeases() const {
+        return (assigned_leases_);
+    }
+
+    /// @brief Checks if the number of leases in use is valid.
+    ///
+    /// The number is not valid until it is set from the lease database
+    /// with @ref setAssignedLeases.
+    ///
+    /// @return true if the number of leases in use is valid
+    bool isAssignedLeasesValid() const {
+        return (assigned_leases_valid_);
+    }
+
+    /// @brief Sets the number of leases in use in this pool.
+    ///
+    /// @param assigned number of leases in use
+    void setAssignedLeases(const uint64_t assigned) {
+        assigned_leases_ = assigned;
+        assigned_leases_valid_ = true;
+    }
+
+    /// @brief Invalidates the number of leases in use in this pool.
+    void resetAssignedLeases() {
+        assigned_leases_ = 0;
+        assigned_leases_valid_ = false;
+    }
+
+    /// @brief Updates the number of leases in use in this pool.
+    ///
+    /// This does nothing when the number is not valid. The number is
+    /// kept between zero and the capacity of the pool.
+    ///
+    /// @param delta number of leases added (or removed when negative)
+    void addAssignedLeases(const int64_t delta);
+
+    /// @brief Checks if all leases of this pool are in use.
+    ///
+    /// @return true if the number of leases in use is valid and is not
+    /// lower than the capacity of the pool.
+    bool isExhausted() const {
+        return (assigned_leases_valid_ && (assigned_leases_ >= capacity_));
+    }
+
     /// @brief Unparse a pool object.
     ///
     /// @return A pointer to unparsed pool configuration.
@@ -234,6 +286,12 @@ protected:
 
     /// @brief Status of last allocated address
     bool last_allocated_valid_;
+
+    /// @brief Number of leases in use in the pool
+    uint64_t assigned_leases_;
+
+    /// @brief Status of the number of leases in use
+    bool assigned_leases_valid_;
 };
 
 /// @brief Pool information for IPv4 addresses
@@ -353,6 +411,79 @@ public:
         return (pd_exclude_option_);
     }
 
+    /// @brief Maximum number of delegated prefixes of a pool for which
+    /// the free prefixes are tracked.
+    ///
+    /// This is the number of /56 prefixes in a /32, for which the bitmap
+    /// takes 2MB.
+    static const uint64_t MAX_TRACKED_PREFIXES = 1 << 24;
+
+    /// @brief Starts tracking the free prefixes of this pool.
+    ///
+    /// The delegated prefixes of a prefix delegation pool are tracked with
+    /// a bitmap, one bit per prefix, which is set when the prefix is in use,
+    /// i.e. when it is leased. All prefixes are initially free and the
+    /// number of leases in use is set to zero, see @ref Pool::isExhausted.
+    /// The prefixes in use must then be set with @ref usePrefix from the
+    /// lease database.
+    ///
+    /// @return true if the prefixes are tracked, false if this is not a
+    /// prefix delegation pool or if it has more than
+    /// @ref MAX_TRACKED_PREFIXES delegated prefixes.
+    bool initFreePrefixes();
+
+    /// @brief Copies the free prefixes tracked by another pool.
+    ///
+    /// This is used during reconfiguration for a pool which has not
+    /// changed. The free prefixes are not tracked if the other pool does
+    /// not track them or if it has a different capacity.
+    ///
+    /// @param other Pool which free prefixes are copied.
+    void copyFreePrefixes(const Pool6& other);
+
+    /// @brief Stops tracking the free prefixes of this pool.
+    void resetFreePrefixes();
+
+    /// @brief Checks if the free prefixes of this pool are tracked.
+    ///
+    /// @return true if the free prefixes are tracked.
+    bool isFreePrefixesValid() const {
+        return (!used_prefixes_.empty());
+    }
+
+    /// @brief Marks a delegated prefix as in use.
+    ///
+    /// This does nothing if the free prefixes are not tracked or if the
+    /// prefix does not belong to the pool.
+    ///
+    /// @param prefix Delegated prefix.
+    void usePrefix(const isc::asiolink::IOAddress& prefix);
+
+    /// @brief Marks a delegated prefix as free.
+    ///
+    /// This does nothing if the free prefixes are not tracked or if the
+    /// prefix does not belong to the pool.
+    ///
+    /// @param prefix Delegated prefix.
+    void releasePrefix(const isc::asiolink::IOAddress& prefix);
+
+    /// @brief Checks if a delegated prefix is free.
+    ///
+    /// @param prefix Delegated prefix.
+    /// @return false if the free prefixes are tracked and the prefix is
+    /// known to be in use, true otherwise.
+    bool isPrefixFree(const isc::asiolink::IOAddress& prefix) const;
+
+    /// @brief Finds the next free delegated prefix.
+    ///
+    /// The free prefixes must be tracked.
+    ///
+    /// @param [in,out] prefix Delegated prefix of the pool from which the
+    /// search starts. It is set to the first free prefix following it.
+    /// @return true if a free prefix was found, false if all the following
+    /// prefixes of the pool are in use.
+    bool getNextFreePrefix(isc::asiolink::IOAddress& prefix) const;
+
     /// @brief Unparse a Pool6 object.
     ///
     /// @return A pointer to unparsed Pool6 configuration.
@@ -393,9 +524,35 @@ private:
     /// @brief Defines prefix length (for TYPE_PD only)
     uint8_t prefix_len_;
 
+    /// @brief Returns the index of a delegated prefix in the pool.
+    ///
+    /// @param prefix Delegated prefix which belongs to the pool.
+    /// @return index of the prefix, counting from the first one.
+    uint64_t getPrefixIndex(const isc::asiolink::IOAddress& prefix) const;
+
+    /// @brief Marks a delegated prefix as in use or free in the bitmap.
+    ///
+    /// The number of leases in use is updated when the prefix changes
+    /// its state.
+    ///
+    /// @param index Index of the delegated prefix.
+    /// @param used true if the prefix is in use, false if it is free.
+    void setPrefixUsed(const uint64_t index, const bool used);
+
     /// @brief A pointer to the Prefix Exclude option (RFC 6603).
     Option6PDExcludePtr pd_exclude_option_;
 
+    /// @brief Bitmap of the delegated prefixes in use.
+    ///
+    /// The bits past the capacity of the pool are set so as they are never
+    /// found free. It is empty when the free prefixes are not tracked.
+    std::vector<uint64_t> used_prefixes_;
+
+    /// @brief Bitmap of the words of @c used_prefixes_ with all bits set.
+    ///
+    /// It allows to skip 4096 prefixes in use at once when looking for
+    /// a free prefix.
+    std::vector<uint64_t> full_words_;
 };
 
 /// @brief a pointer an IPv6 Pool
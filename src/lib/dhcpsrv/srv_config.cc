@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,6 +26,7 @@ namespace dhcp {
 SrvConfig::SrvConfig()
     : sequence_(0), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_list_cache_(new CfgOptionListCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -45,6 +46,7 @@ SrvConfig::SrvConfig()
 SrvConfig::SrvConfig(const uint32_t sequence)
     : sequence_(sequence), cfg_iface_(new CfgIface()),
       cfg_option_def_(new CfgOptionDef()), cfg_option_(new CfgOption()),
+      cfg_option_list_cache_(new CfgOptionListCache()),
       cfg_subnets4_(new CfgSubnets4()), cfg_subnets6_(new CfgSubnets6()),
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
@@ -116,6 +118,7 @@ SrvConfig::copy(SrvConfig& new_config) const {
     // Replace option definitions.
     cfg_option_def_->copyTo(*new_config.cfg_option_def_);
     cfg_option_->copyTo(*new_config.cfg_option_);
+    new_config.cfg_option_list_cache_->clear();
     // Replace the client class dictionary
     new_config.class_dictionary_.reset(new ClientClassDictionary(*class_dictionary_));
     // Replace the D2 client configuration
@@ -177,6 +180,36 @@ SrvConfig::updateStatistics() {
         getCfgSubnets4()->updateStatistics();
 
         getCfgSubnets6()->updateStatistics();
+
+        // The expired leases are counted as in use until they are
+        // reclaimed, so the numbers of leases in use per pool and the
+        // delegated prefixes in use are only maintained when the leases
+        // are reclaimed periodically.
+        if (getCfgExpiration()->getReclaimTimerWaitTime() > 0) {
+            getCfgSubnets4()->recountPoolLeases();
+            getCfgSubnets6()->recountPoolLeases();
+        }
+    }
+}
+
+void
+SrvConfig::updateStatistics(const SrvConfig& previous) {
+    // The statistics of the previous configuration are removed even if
+    // there is no lease manager, as it is done by removeStatistics().
+    if (LeaseMgrFactory::haveInstance()) {
+        getCfgSubnets4()->updateStatistics(*previous.getCfgSubnets4());
+
+        getCfgSubnets6()->updateStatistics(*previous.getCfgSubnets6());
+
+        if (getCfgExpiration()->getReclaimTimerWaitTime() > 0) {
+            getCfgSubnets4()->recountPoolLeases(*previous.getCfgSubnets4());
+            getCfgSubnets6()->recountPoolLeases(*previous.getCfgSubnets6());
+        }
+
+    } else {
+        previous.getCfgSubnets4()->removeStatistics();
+
+        previous.getCfgSubnets6()->removeStatistics();
     }
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -16,6 +16,7 @@
 #include <dhcpsrv/cfg_iface.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfg_option_def.h>
+#include <dhcpsrv/cfg_option_list_cache.h>
 #include <dhcpsrv/cfg_rsoo.h>
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/cfg_subnets4.h>
@@ -181,6 +182,18 @@ public:
         return (cfg_option_);
     }
 
+    /// @brief Returns pointer to the cache of the options selected from
+    /// the configured options when building responses.
+    ///
+    /// The cache is empty in a new configuration. It must be cleared when
+    /// options, subnets, shared networks or classes of this configuration
+    /// are modified in place.
+    ///
+    /// @return Pointer to the cache.
+    CfgOptionListCachePtr getCfgOptionListCache() const {
+        return (cfg_option_list_cache_);
+    }
+
     /// @brief Returns pointer to non-const object holding subnets configuration
     /// for DHCPv4.
     ///
@@ -478,9 +491,23 @@ public:
     ///
     /// This method calls appropriate methods in child objects that update
     /// related statistics. See @ref CfgSubnets4::updateStatistics and
-    /// @ref CfgSubnets6::updateStatistics for details.
+    /// @ref CfgSubnets6::updateStatistics for details. When the expired
+    /// leases are reclaimed periodically, it also counts the leases in use
+    /// in each IPv4 pool, see @ref CfgSubnets4::recountPoolLeases.
     void updateStatistics();
 
+    /// @brief Updates statistics incrementally.
+    ///
+    /// This method is used instead of @ref removeStatistics followed by
+    /// @ref updateStatistics when this configuration replaces the previous
+    /// one and both configurations use the same lease database. Only the
+    /// lease statistics of the new and changed subnets are recounted.
+    /// See @ref CfgSubnets4::updateStatistics(const CfgSubnets4&) and
+    /// @ref CfgSubnets6::updateStatistics(const CfgSubnets6&) for details.
+    ///
+    /// @param previous Configuration being replaced.
+    void updateStatistics(const SrvConfig& previous);
+
     /// @brief Removes statistics.
     ///
     /// This method calls appropriate methods in child objects that remove
@@ -614,6 +641,10 @@ private:
     /// connected to any subnet.
     CfgOptionPtr cfg_option_;
 
+    /// @brief Pointer to the cache of the options selected from the
+    /// configured options.
+    CfgOptionListCachePtr cfg_option_list_cache_;
+
     /// @brief Pointer to subnets configuration for IPv4.
     CfgSubnets4Ptr cfg_subnets4_;
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -58,13 +58,17 @@ Subnet::Subnet(const isc::asiolink::IOAddress& prefix, uint8_t len,
       last_allocated_ia_(lastAddrInPrefix(prefix, len)),
       last_allocated_ta_(lastAddrInPrefix(prefix, len)),
       last_allocated_pd_(lastAddrInPrefix(prefix, len)),
-      last_allocated_time_() {
+      last_allocated_time_(), reserved_addresses_valid_(false) {
     if ((prefix.isV6() && len > 128) ||
         (prefix.isV4() && len > 32)) {
         isc_throw(BadValue,
                   "Invalid prefix length specified for subnet: " << len);
     }
 
+    std::ostringstream tmp;
+    tmp << prefix_ << "/" << static_cast<unsigned int>(prefix_len_);
+    prefix_text_ = tmp.str();
+
     // Initialize timestamps for each lease type to negative infinity.
     last_allocated_time_[Lease::TYPE_V4] = boost::posix_time::neg_infin;
     last_allocated_time_[Lease::TYPE_NA] = boost::posix_time::neg_infin;
@@ -137,9 +141,90 @@ void Subnet::setLastAllocated(Lease::Type type,
 
 std::string
 Subnet::toText() const {
-    std::stringstream tmp;
-    tmp << prefix_ << "/" << static_cast<unsigned int>(prefix_len_);
-    return (tmp.str());
+    return (prefix_text_);
+}
+
+namespace {
+
+/// @brief Checks if two pool collections hold the same address ranges.
+///
+/// @param pools1 First pool collection.
+/// @param pools2 Second pool collection.
+/// @return true if the collections hold pools of the same types, boundaries
+/// and capacities in the same order.
+bool
+samePoolCollections(const PoolCollection& pools1, const PoolCollection& pools2) {
+    if (pools1.size() != pools2.size()) {
+        return (false);
+    }
+    // Pools are kept sorted by their first address so they can be compared
+    // pairwise.
+    for (size_t i = 0; i < pools1.size(); ++i) {
+        const PoolPtr& pool1 = pools1[i];
+        const PoolPtr& pool2 = pools2[i];
+        if ((pool1->getType() != pool2->getType()) ||
+            (pool1->getFirstAddress() != pool2->getFirstAddress()) ||
+            (pool1->getLastAddress() != pool2->getLastAddress()) ||
+            (pool1->getCapacity() != pool2->getCapacity())) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+/// @brief Copies the allocation state of the pools of a replaced subnet.
+///
+/// @param pools Pools of the new subnet.
+/// @param other_pools Same pools of the replaced subnet.
+void
+copyPoolsAllocationState(const PoolCollection& pools,
+                         const PoolCollection& other_pools) {
+    for (size_t i = 0; i < pools.size(); ++i) {
+        const PoolPtr& pool = pools[i];
+        const PoolPtr& other_pool = other_pools[i];
+        if (other_pool->isLastAllocatedValid()) {
+            pool->setLastAllocated(other_pool->getLastAllocated());
+        }
+        Pool6Ptr pool6 = boost::dynamic_pointer_cast<Pool6>(pool);
+        Pool6Ptr other_pool6 = boost::dynamic_pointer_cast<Pool6>(other_pool);
+        if (pool6 && other_pool6 && other_pool6->isFreePrefixesValid()) {
+            pool6->copyFreePrefixes(*other_pool6);
+
+        } else if (other_pool->isAssignedLeasesValid()) {
+            pool->setAssignedLeases(other_pool->getAssignedLeases());
+        }
+    }
+}
+
+} // end of anonymous namespace
+
+void
+Subnet::copyAllocationState(const Subnet& other) {
+    if (inRange(other.last_allocated_ia_)) {
+        last_allocated_ia_ = other.last_allocated_ia_;
+    }
+    if (inRange(other.last_allocated_ta_)) {
+        last_allocated_ta_ = other.last_allocated_ta_;
+    }
+    if (inRange(other.last_allocated_pd_)) {
+        last_allocated_pd_ = other.last_allocated_pd_;
+    }
+    last_allocated_time_ = other.last_allocated_time_;
+
+    if (samePools(other)) {
+        copyPoolsAllocationState(pools_, other.pools_);
+        copyPoolsAllocationState(pools_ta_, other.pools_ta_);
+        copyPoolsAllocationState(pools_pd_, other.pools_pd_);
+    }
+}
+
+bool
+Subnet::samePools(const Subnet& other) const {
+    return ((prefix_ == other.prefix_) &&
+            (prefix_len_ == other.prefix_len_) &&
+            samePoolCollections(pools_, other.pools_) &&
+            samePoolCollections(pools_ta_, other.pools_ta_) &&
+            samePoolCollections(pools_pd_, other.pools_pd_));
 }
 
 uint64_t
@@ -215,6 +300,55 @@ Subnet::sumPoolCapacity(const PoolCollection& pools,
     return (sum);
 }
 
+void
+Subnet::addAssignedLeases(Lease::Type type, const IOAddress& addr,
+                          const int64_t delta) const {
+    PoolPtr pool = getPool(type, addr, false);
+    if (!pool) {
+        return;
+    }
+    if (type == Lease::TYPE_PD) {
+        // The prefix delegation pools track which prefixes are in use.
+        Pool6Ptr pool6 = boost::dynamic_pointer_cast<Pool6>(pool);
+        if (pool6 && (delta > 0)) {
+            pool6->usePrefix(addr);
+        } else if (pool6 && (delta < 0)) {
+            pool6->releasePrefix(addr);
+        }
+    } else {
+        pool->addAssignedLeases(delta);
+    }
+}
+
+bool
+Subnet::poolsExhausted(Lease::Type type,
+                       const ClientClasses& client_classes) const {
+    const PoolCollection& pools = getPools(type);
+    bool found = false;
+    for (PoolCollection::const_iterator p = pools.begin(); p != pools.end(); ++p) {
+        if (!(*p)->clientSupported(client_classes)) {
+            continue;
+        }
+        if (!(*p)->isExhausted()) {
+            return (false);
+        }
+        found = true;
+    }
+    return (found);
+}
+
+void
+Subnet::setReservedAddresses(const std::set<IOAddress>& addresses) {
+    reserved_addresses_ = addresses;
+    reserved_addresses_valid_ = true;
+}
+
+void
+Subnet::resetReservedAddresses() {
+    reserved_addresses_.clear();
+    reserved_addresses_valid_ = false;
+}
+
 std::pair<IOAddress, uint8_t>
 Subnet::parsePrefixCommon(const std::string& prefix) {
     auto pos = prefix.find('/');
@@ -507,16 +641,9 @@ Subnet::inPool(Lease::Type type, const isc::asiolink::IOAddress& addr) const {
         return (false);
     }
 
-    const PoolCollection& pools = getPools(type);
-
-    for (PoolCollection::const_iterator pool = pools.begin();
-         pool != pools.end(); ++pool) {
-        if ((*pool)->inRange(addr)) {
-            return (true);
-        }
-    }
-    // There's no pool that address belongs to
-    return (false);
+    // The pools are sorted and don't overlap so the only pool which may
+    // hold the address is found by a binary search.
+    return (static_cast<bool>(getPool(type, addr, false)));
 }
 
 bool
@@ -529,19 +656,7 @@ Subnet::inPool(Lease::Type type,
         return (false);
     }
 
-    const PoolCollection& pools = getPools(type);
-
-    for (PoolCollection::const_iterator pool = pools.begin();
-         pool != pools.end(); ++pool) {
-        if (!(*pool)->clientSupported(client_classes)) {
-            continue;
-        }
-        if ((*pool)->inRange(addr)) {
-            return (true);
-        }
-    }
-    // There's no pool that address belongs to
-    return (false);
+    return (static_cast<bool>(getPool(type, client_classes, addr)));
 }
 
 bool
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -27,6 +27,7 @@
 #include <boost/shared_ptr.hpp>
 #include <cstdint>
 #include <map>
+#include <set>
 #include <utility>
 
 namespace isc {
@@ -217,9 +218,94 @@ public:
     uint64_t getPoolCapacity(Lease::Type type,
                              const ClientClasses& client_classes) const;
 
+    /// @brief Checks if the subnet has the same prefix and pools as
+    /// other subnet.
+    ///
+    /// The pools are compared by type, boundaries and capacity, so the
+    /// change of the delegated prefix length of a prefix delegation pool
+    /// is detected. Other pool parameters, e.g. options or client classes,
+    /// are not compared. This is used during reconfiguration to find the
+    /// subnets for which the lease statistics must be recounted.
+    ///
+    /// @param other Subnet to compare with.
+    /// @return true if both subnets have the same prefix and pools.
+    bool samePools(const Subnet& other) const;
+
+    /// @brief Takes over the allocation state of the subnet it replaces.
+    ///
+    /// This is used when a subnet is replaced by a new instance without
+    /// reconfiguring the server, e.g. when it is updated from a configuration
+    /// backend. The last allocated addresses and prefixes are copied when
+    /// they belong to this subnet. When the pools have not changed (see
+    /// @ref samePools), the last allocated addresses, the numbers of leases
+    /// in use and the free delegated prefixes of the pools are copied too.
+    /// Otherwise the pools start from their first address and the leases
+    /// in use are not tracked until the next reconfiguration.
+    ///
+    /// @param other Subnet replaced by this subnet.
+    void copyAllocationState(const Subnet& other);
+
+    /// @brief Updates the number of leases in use in the pool of an address.
+    ///
+    /// This does nothing if the address does not belong to a pool or if
+    /// the number of leases in use of the pool is not valid. For prefix
+    /// delegation pools the prefix is marked as in use or free, see
+    /// @ref Pool6::usePrefix.
+    ///
+    /// @param type type of the lease
+    /// @param addr address or prefix of the lease
+    /// @param delta number of leases added (or removed when negative)
+    void addAssignedLeases(Lease::Type type,
+                           const isc::asiolink::IOAddress& addr,
+                           const int64_t delta) const;
+
+    /// @brief Checks if all pools allowed for a client are exhausted.
+    ///
+    /// See @ref Pool::isExhausted.
+    ///
+    /// @param type type of the lease
+    /// @param client_classes List of classes the client belongs to.
+    /// @return true if there is at least one pool of the given type allowed
+    /// for the client and all these pools are exhausted.
+    bool poolsExhausted(Lease::Type type,
+                        const ClientClasses& client_classes) const;
+
+    /// @brief Sets the addresses and prefixes reserved in the subnet.
+    ///
+    /// The set is built at configuration time from the reservations of
+    /// the configuration file, so the allocation engine can skip the host
+    /// lookup for the candidate addresses which are not reserved.
+    ///
+    /// @param addresses reserved IPv4 addresses, or IPv6 addresses and
+    /// delegated prefixes.
+    void setReservedAddresses(const std::set<isc::asiolink::IOAddress>& addresses);
+
+    /// @brief Forgets the reserved addresses.
+    ///
+    /// This is used when the reservations may be modified at runtime,
+    /// i.e. when a host database is configured.
+    void resetReservedAddresses();
+
+    /// @brief Checks if the reserved addresses are valid.
+    bool isReservedAddressesValid() const {
+        return (reserved_addresses_valid_);
+    }
+
+    /// @brief Checks if an address or prefix may be reserved in the subnet.
+    ///
+    /// @param address address or prefix
+    /// @return false if the address is known not to be reserved, true
+    /// if it is reserved or if the reserved addresses are not valid.
+    bool mayBeReserved(const isc::asiolink::IOAddress& address) const {
+        return (!reserved_addresses_valid_ ||
+                (reserved_addresses_.count(address) > 0));
+    }
+
     /// @brief Returns textual representation of the subnet (e.g.
     /// "2001:db8::/64")
     ///
+    /// The text is computed once when the subnet is created.
+    ///
     /// @return textual representation
     virtual std::string toText() const;
 
@@ -416,6 +502,13 @@ protected:
     /// @brief a prefix length of the subnet
     uint8_t prefix_len_;
 
+    /// @brief textual representation of the prefix and prefix length
+    ///
+    /// The prefix never changes after the subnet is created, so the text is
+    /// built once by the constructor. It is used as a key by the subnet
+    /// containers and is compared many times when subnets are inserted.
+    std::string prefix_text_;
+
     /// @brief last allocated address
     ///
     /// This is the last allocated address that was previously allocated from
@@ -441,6 +534,15 @@ protected:
     /// last allocated from this subnet.
     std::map<Lease::Type, boost::posix_time::ptime> last_allocated_time_;
 
+    /// @brief Addresses and prefixes reserved in the subnet.
+    std::set<isc::asiolink::IOAddress> reserved_addresses_;
+
+    /// @brief Status of the reserved addresses.
+    ///
+    /// When false the reserved addresses are unknown and each candidate
+    /// address must be looked up in the host data sources.
+    bool reserved_addresses_valid_;
+
     /// @brief Name of the network interface (if connected directly)
     std::string iface_;
 
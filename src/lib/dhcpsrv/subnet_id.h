@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 
 #include <exceptions/exceptions.h>
 #include <stdint.h>
+#include <set>
 #include <typeinfo>
 
 namespace isc {
@@ -22,6 +23,9 @@ namespace dhcp {
 /// type.
 typedef uint32_t SubnetID;
 
+/// @brief Ordered list aka set of subnetIDs.
+typedef std::set<SubnetID> SubnetIDSet;
+
 /// @brief Special value is used for storing/recognizing global host reservations.
 static const SubnetID SUBNET_ID_GLOBAL = 0;
 /// @brief The largest valid value for auto-generated subnet IDs.
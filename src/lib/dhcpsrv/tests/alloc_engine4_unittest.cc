@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -366,6 +366,40 @@ TEST_F(AllocEngine4Test, simpleRenew4) {
     EXPECT_TRUE(testStatistics("assigned-addresses", 1, subnet_->getID()));
 }
 
+// This test checks that a client renewing its lease, i.e. requesting the
+// address of its lease, gets this lease extended. The lease is found using
+// the client identifier, so the HW address may have changed.
+TEST_F(AllocEngine4Test, requestRenewOwnLease) {
+    time_t now = time(NULL) - 50;
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.105"), hwaddr2_,
+                               &clientid_->getClientId()[0],
+                               clientid_->getClientId().size(),
+                               100, 30, 60, now, subnet_->getID(),
+                               false, false, ""));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 0, false);
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("192.0.2.105"),
+                                    false, false, "", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr renewed = engine.allocateLease4(ctx);
+
+    // The lease should have been renewed.
+    ASSERT_TRUE(renewed);
+    EXPECT_EQ("192.0.2.105", renewed->addr_.toText());
+    ASSERT_TRUE(ctx.old_lease_);
+    EXPECT_EQ(now, ctx.old_lease_->cltt_);
+    EXPECT_TRUE(*renewed->hwaddr_ == *hwaddr_);
+
+    // Check that the lease has been updated in the lease database.
+    Lease4Ptr from_mgr = LeaseMgrFactory::instance().getLease4(renewed->addr_);
+    ASSERT_TRUE(from_mgr);
+    EXPECT_GT(from_mgr->cltt_, now);
+    EXPECT_TRUE(*from_mgr->hwaddr_ == *hwaddr_);
+}
+
 // This test verifies that the allocator picks addresses that belong to the
 // pool
 TEST_F(AllocEngine4Test, IterativeAllocator) {
@@ -659,6 +693,92 @@ TEST_F(SharedNetworkAlloc4Test, discoverSharedNetworkHint) {
 }
 
 
+// This test verifies that the expired leases are counted as in use
+// until they are reclaimed when the configuration is committed.
+TEST_F(SharedNetworkAlloc4Test, expiredLeasesCountedUntilReclaimed) {
+    Lease4Ptr lease = insertLease("192.0.2.17", subnet1_->getID());
+    lease->cltt_ = time(NULL) - 1000;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet1_);
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet2_);
+    CfgMgr::instance().commit();
+
+    ASSERT_TRUE(pool1_->isAssignedLeasesValid());
+    EXPECT_EQ(1, pool1_->getAssignedLeases());
+    EXPECT_TRUE(subnet1_->poolsExhausted(Lease::TYPE_V4, ClientClasses()));
+
+    // The reclamation makes the address available.
+    ASSERT_NO_THROW(engine_.reclaimExpiredLeases4(0, 0, false));
+    EXPECT_EQ(0, pool1_->getAssignedLeases());
+    EXPECT_FALSE(subnet1_->poolsExhausted(Lease::TYPE_V4, ClientClasses()));
+
+    // Reclaiming again doesn't change the counter.
+    ASSERT_NO_THROW(engine_.reclaimExpiredLeases4(0, 0, false));
+    EXPECT_EQ(0, pool1_->getAssignedLeases());
+
+    // The reclaimed lease is reused.
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr_, IOAddress::IPV4_ZERO_ADDRESS(),
+            false, false, "host.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease2 = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ("192.0.2.17", lease2->addr_.toText());
+    EXPECT_EQ(1, pool1_->getAssignedLeases());
+}
+
+// This test verifies that reusing an expired lease which was counted
+// before it expired doesn't count it twice.
+TEST_F(SharedNetworkAlloc4Test, reuseExpiredLeaseAfterRecount) {
+    Lease4Ptr lease = insertLease("192.0.2.17", subnet1_->getID());
+    lease->cltt_ = time(NULL) - 1000;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet1_);
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet2_);
+    CfgMgr::instance().commit();
+    ASSERT_EQ(1, pool1_->getAssignedLeases());
+
+    // Another client requests the address of the expired lease.
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr_, IOAddress("192.0.2.17"),
+            false, false, "host.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease2 = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ("192.0.2.17", lease2->addr_.toText());
+    ASSERT_TRUE(ctx.old_lease_);
+    EXPECT_EQ(1, pool1_->getAssignedLeases());
+
+    // The reused lease is not expired so it isn't reclaimed.
+    ASSERT_NO_THROW(engine_.reclaimExpiredLeases4(0, 0, false));
+    EXPECT_EQ(1, pool1_->getAssignedLeases());
+}
+
+// This test verifies that renewing an expired lease which was counted
+// before it expired doesn't count it twice.
+TEST_F(SharedNetworkAlloc4Test, renewExpiredLeaseAfterRecount) {
+    Lease4Ptr lease = insertLease("192.0.2.17", subnet1_->getID());
+    lease->cltt_ = time(NULL) - 1000;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet1_);
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet2_);
+    CfgMgr::instance().commit();
+    ASSERT_EQ(1, pool1_->getAssignedLeases());
+
+    // The owner of the expired lease renews it.
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr2_, IOAddress("192.0.2.17"),
+            false, false, "host.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease2 = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ("192.0.2.17", lease2->addr_.toText());
+    EXPECT_EQ(1, pool1_->getAssignedLeases());
+
+    ASSERT_NO_THROW(engine_.reclaimExpiredLeases4(0, 0, false));
+    EXPECT_EQ(1, pool1_->getAssignedLeases());
+}
+
 // This test verifies that the server can offer an address from a
 // different subnet than orginally selected, when the address pool in
 // the first subnet is exhausted.
@@ -707,6 +827,75 @@ TEST_F(SharedNetworkAlloc4Test, discoverSharedNetwork) {
     EXPECT_EQ("192.0.2.17", lease2->addr_.toText());
 }
 
+// This test verifies that the exhausted pools are skipped, using the
+// numbers of leases in use per pool maintained by the allocation engine.
+TEST_F(SharedNetworkAlloc4Test, requestSharedNetworkExhaustedPools) {
+    // The address of the first pool is in use when the configuration
+    // is committed so the leases are counted.
+    Lease4Ptr lease = insertLease("192.0.2.17", subnet1_->getID());
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet1_);
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet2_);
+    CfgMgr::instance().commit();
+
+    ASSERT_TRUE(pool1_->isAssignedLeasesValid());
+    EXPECT_EQ(1, pool1_->getAssignedLeases());
+    EXPECT_TRUE(pool1_->isExhausted());
+    ASSERT_TRUE(pool2_->isAssignedLeasesValid());
+    EXPECT_EQ(0, pool2_->getAssignedLeases());
+    EXPECT_TRUE(subnet1_->poolsExhausted(Lease::TYPE_V4, ClientClasses()));
+    EXPECT_FALSE(subnet2_->poolsExhausted(Lease::TYPE_V4, ClientClasses()));
+
+    // The first subnet is skipped and the address is allocated from the
+    // second one.
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr_, IOAddress::IPV4_ZERO_ADDRESS(),
+            false, false, "host.example.com.", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease2 = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_TRUE(subnet2_->inPool(Lease::TYPE_V4, lease2->addr_));
+    EXPECT_EQ(1, pool2_->getAssignedLeases());
+
+    ObservationPtr stat = StatsMgr::instance().getObservation(
+        StatsMgr::generateName("subnet", subnet1_->getID(), "pools-exhausted"));
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(1, stat->getInteger().first);
+
+    // When all pools are exhausted the allocation fails immediately.
+    pool2_->setAssignedLeases(pool2_->getCapacity());
+    stat = StatsMgr::instance().getObservation("v4-allocation-fail-exhausted");
+    int64_t failed = (stat ? stat->getInteger().first : 0);
+    // Use a client which has no lease: the lease of the first pool
+    // belongs to hwaddr2_.
+    HWAddrPtr hwaddr3(new HWAddr(HWAddr::fromText("00:fe:fe:fe:fe:01")));
+    AllocEngine::ClientContext4
+        ctx2(subnet1_, ClientIdPtr(), hwaddr3, IOAddress::IPV4_ZERO_ADDRESS(),
+             false, false, "host.example.com.", true);
+    ctx2.query_.reset(new Pkt4(DHCPDISCOVER, 1234));
+    EXPECT_FALSE(engine_.allocateLease4(ctx2));
+    stat = StatsMgr::instance().getObservation("v4-allocation-fail-exhausted");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(failed + 1, stat->getInteger().first);
+
+    // A lease which expired stays counted until it is reclaimed.
+    lease->cltt_ = time(NULL) - 1000;
+    ASSERT_NO_THROW(LeaseMgrFactory::instance().updateLease4(lease));
+    EXPECT_TRUE(pool1_->isExhausted());
+    ctx2.subnet_ = subnet1_;
+    EXPECT_FALSE(engine_.allocateLease4(ctx2));
+    EXPECT_EQ(failed + 2, stat->getInteger().first);
+
+    // The reclamation of the expired lease makes its address available.
+    ASSERT_NO_THROW(engine_.reclaimExpiredLeases4(0, 0, false));
+    EXPECT_EQ(0, pool1_->getAssignedLeases());
+    EXPECT_FALSE(pool1_->isExhausted());
+
+    ctx2.subnet_ = subnet1_;
+    lease2 = engine_.allocateLease4(ctx2);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ("192.0.2.17", lease2->addr_.toText());
+}
+
 // This test verifies that the server can offer an address from a
 // different subnet than orginally selected, when the address pool in
 // the first subnet is exhausted.
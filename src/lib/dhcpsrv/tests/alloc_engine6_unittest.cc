@@ -458,6 +458,58 @@ TEST_F(AllocEngine6Test, IterativeAllocatorPrefixStep) {
               alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::")).toText());
 }
 
+// This test verifies that the iterative allocator skips the delegated
+// prefixes known to be in use.
+TEST_F(AllocEngine6Test, IterativeAllocatorPrefixStepFreePrefixes) {
+    NakedAllocEngine::NakedIterativeAllocator alloc(Lease::TYPE_PD);
+
+    subnet_.reset(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4));
+
+    Pool6Ptr pool1(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8::"), 56, 60));
+    Pool6Ptr pool2(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:1::"), 48, 48));
+    Pool6Ptr pool3(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:2::"), 56, 64));
+    subnet_->addPool(pool1);
+    subnet_->addPool(pool2);
+    subnet_->addPool(pool3);
+    ASSERT_TRUE(pool1->initFreePrefixes());
+    ASSERT_TRUE(pool2->initFreePrefixes());
+    ASSERT_TRUE(pool3->initFreePrefixes());
+
+    // The first two prefixes and the 2001:db8:0:30::/60 of the first pool
+    // are in use, as well as the only prefix of the second pool and all
+    // prefixes but the last one of the third pool.
+    pool1->usePrefix(IOAddress("2001:db8::"));
+    pool1->usePrefix(IOAddress("2001:db8:0:10::"));
+    pool1->usePrefix(IOAddress("2001:db8:0:30::"));
+    pool2->usePrefix(IOAddress("2001:db8:1::"));
+    for (int i = 0; i < 255; i++) {
+        stringstream prefix;
+        prefix << "2001:db8:2:" << hex << i << dec << "::";
+        pool3->usePrefix(IOAddress(prefix.str()));
+    }
+
+    EXPECT_EQ("2001:db8:0:20::",
+              alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::")).toText());
+    EXPECT_EQ("2001:db8:0:40::",
+              alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::")).toText());
+
+    // Use the other prefixes of the first pool.
+    for (int i = 5; i < 16; i++) {
+        stringstream prefix;
+        prefix << "2001:db8:0:" << hex << i << dec << "0::";
+        pool1->usePrefix(IOAddress(prefix.str()));
+    }
+
+    // The second pool is exhausted so it is skipped.
+    EXPECT_EQ("2001:db8:2:ff::",
+              alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::")).toText());
+
+    // Wrap around to the first free prefix of the first pool.
+    pool1->releasePrefix(IOAddress("2001:db8:0:10::"));
+    EXPECT_EQ("2001:db8:0:10::",
+              alloc.pickAddress(subnet_, cc_, duid_, IOAddress("::")).toText());
+}
+
 TEST_F(AllocEngine6Test, IterativeAllocatorPrefixStepInClass) {
     NakedAllocEngine::NakedIterativeAllocator alloc(Lease::TYPE_PD);
 
@@ -2025,6 +2077,55 @@ TEST_F(AllocEngine6Test, largePDPool) {
     ASSERT_EQ(1, leases.size());
 }
 
+// This test checks that the allocation engine picks the delegated prefixes
+// known to be free and doesn't try to allocate from exhausted pools.
+TEST_F(AllocEngine6Test, pdAllocFreePrefixes) {
+    // A single attempt per allocation.
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 1);
+
+    // Replace the default PD pool with a pool of 4 prefixes.
+    subnet_->delPools(Lease::TYPE_PD);
+    pd_pool_.reset(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:1:2::"),
+                             64, 66));
+    subnet_->addPool(pd_pool_);
+    ASSERT_TRUE(pd_pool_->initFreePrefixes());
+
+    // The first two prefixes are leased to other clients.
+    DuidPtr other_duid(new DUID(vector<uint8_t>(12, 0xfe)));
+    const char* used[] = { "2001:db8:1:2::", "2001:db8:1:2:4000::" };
+    for (int i = 0; i < 2; ++i) {
+        Lease6Ptr lease(new Lease6(Lease::TYPE_PD, IOAddress(used[i]),
+                                   other_duid, 100 + i, 501, 502, 503, 504,
+                                   subnet_->getID(), HWAddrPtr(), 66));
+        ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+        pd_pool_->usePrefix(lease->addr_);
+    }
+
+    // The clients get the two free prefixes.
+    const char* expected[] = { "2001:db8:1:2:8000::", "2001:db8:1:2:c000::" };
+    for (int i = 0; i < 3; ++i) {
+        DuidPtr duid(new DUID(vector<uint8_t>(12, i)));
+        Pkt6Ptr query(new Pkt6(DHCPV6_REQUEST, 1234));
+        AllocEngine::ClientContext6 ctx(subnet_, duid, false, false, "",
+                                        false, query);
+        ctx.currentIA().iaid_ = iaid_;
+        ctx.currentIA().type_ = Lease::TYPE_PD;
+
+        Lease6Collection leases;
+        findReservation(engine, ctx);
+        ASSERT_NO_THROW(leases = engine.allocateLeases6(ctx));
+        if (i < 2) {
+            ASSERT_EQ(1, leases.size());
+            EXPECT_EQ(expected[i], leases[0]->addr_.toText());
+            EXPECT_FALSE(pd_pool_->isPrefixFree(leases[0]->addr_));
+        } else {
+            // The pool is exhausted.
+            EXPECT_TRUE(leases.empty());
+        }
+    }
+    EXPECT_TRUE(pd_pool_->isExhausted());
+}
+
 // This test checks that the allocation engine can delegate addresses
 // from ridiculously large pool. The configuration provides 2^80 or
 // 1208925819614629174706176 addresses. We used to have a bug that would
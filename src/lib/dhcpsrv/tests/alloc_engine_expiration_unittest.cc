@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -309,7 +309,9 @@ public:
     /// @param remove_lease A boolean value indicating if the lease should
     /// be removed when it is reclaimed (if true) or it should be left in the
     /// database in the "expired-reclaimed" state (if false).
-    virtual void reclaimExpiredLeases(const size_t max_leases,
+    ///
+    /// @return true if the reclamation was incomplete.
+    virtual bool reclaimExpiredLeases(const size_t max_leases,
                                       const uint16_t timeout,
                                       const bool remove_lease) = 0;
 
@@ -672,8 +674,12 @@ public:
             // Reclaim 10 most expired leases out of TEST_LEASES_NUM. Since
             // leases are ordered from the most expired to the least expired
             // this should reclaim leases between 0 and 9, then 10 and 19 etc.
-            ASSERT_NO_THROW(reclaimExpiredLeases(reclamation_group_size,
-                                                 0, false));
+            // There are still expired leases left, so the reclamation
+            // should be reported as incomplete.
+            bool incomplete = false;
+            ASSERT_NO_THROW(incomplete = reclaimExpiredLeases(reclamation_group_size,
+                                                              0, false));
+            EXPECT_TRUE(incomplete) << "check failed for i = " << i;
 
             // Check that leases having all indexes between 0 and 9, 19, 29 etc.
             // have been reclaimed.
@@ -686,6 +692,13 @@ public:
                                    LowerBound(i), UpperBound(TEST_LEASES_NUM)))
                 << "check failed for i = " << i;
         }
+
+        // Reclaim the last group. This time the reclamation is complete.
+        bool incomplete = true;
+        ASSERT_NO_THROW(incomplete = reclaimExpiredLeases(reclamation_group_size,
+                                                          0, false));
+        EXPECT_FALSE(incomplete);
+        EXPECT_TRUE(testLeases(&leaseReclaimed, &allLeaseIndexes));
     }
 
     /// @brief Test that DNS updates are generated for the leases for which
@@ -1169,10 +1182,13 @@ public:
     /// @param remove_lease A boolean value indicating if the lease should
     /// be removed when it is reclaimed (if true) or it should be left in the
     /// database in the "expired-reclaimed" state (if false).
-    virtual void reclaimExpiredLeases(const size_t max_leases,
+    ///
+    /// @return true if the reclamation was incomplete.
+    virtual bool reclaimExpiredLeases(const size_t max_leases,
                                       const uint16_t timeout,
                                       const bool remove_lease) {
-        engine_->reclaimExpiredLeases6(max_leases, timeout, remove_lease);
+        return (engine_->reclaimExpiredLeases6(max_leases, timeout,
+                                                remove_lease));
     }
 
     /// @brief Wrapper method for removing expired-reclaimed leases.
@@ -1712,10 +1728,13 @@ public:
     /// @param remove_lease A boolean value indicating if the lease should
     /// be removed when it is reclaimed (if true) or it should be left in the
     /// database in the "expired-reclaimed" state (if false).
-    virtual void reclaimExpiredLeases(const size_t max_leases,
+    ///
+    /// @return true if the reclamation was incomplete.
+    virtual bool reclaimExpiredLeases(const size_t max_leases,
                                       const uint16_t timeout,
                                       const bool remove_lease) {
-        engine_->reclaimExpiredLeases4(max_leases, timeout, remove_lease);
+        return (engine_->reclaimExpiredLeases4(max_leases, timeout,
+                                                remove_lease));
     }
 
     /// @brief Wrapper method for removing expired-reclaimed leases.
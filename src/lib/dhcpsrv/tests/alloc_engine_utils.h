@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -400,6 +400,8 @@ public:
     addHost(HostPtr& host) {
         SrvConfigPtr cfg = boost::const_pointer_cast<SrvConfig>(CfgMgr::instance().getCurrentCfg());
         cfg->getCfgHosts()->add(host);
+        // The subnets keep the reserved addresses found at commit time.
+        cfg->getCfgSubnets6()->updateReservedAddresses(cfg->getCfgHosts());
     }
 
     /// @brief Utility function that creates a host reservation (hwaddr)
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -235,6 +235,40 @@ TEST_F(CfgHostsTest, getAll4ByAddress) {
     EXPECT_EQ(25, *subnet_ids.rbegin());
 }
 
+// This test checks that all reservations for the specified IPv4 or IPv6
+// subnet can be retrieved.
+TEST_F(CfgHostsTest, getAllSubnet) {
+    CfgHosts cfg;
+    // Add hosts in IPv4 subnets 1 and 2, and IPv6 subnets 3 and 4.
+    for (unsigned i = 0; i < 25; ++i) {
+        HostPtr host(new Host(hwaddrs_[i]->toText(false), "hw-address",
+                              SubnetID(1 + i % 2), SubnetID(3 + i % 2),
+                              increase(IOAddress("192.0.2.1"), i)));
+        host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                       increase(IOAddress("2001:db8:1::1"),
+                                                i)));
+        cfg.add(host);
+    }
+
+    ConstHostCollection hosts = cfg.getAllSubnet4(SubnetID(1));
+    ASSERT_EQ(13, hosts.size());
+    for (ConstHostCollection::const_iterator host = hosts.begin();
+         host != hosts.end(); ++host) {
+        EXPECT_EQ(1, (*host)->getIPv4SubnetID());
+    }
+    EXPECT_EQ(12, cfg.getAllSubnet4(SubnetID(2)).size());
+    EXPECT_TRUE(cfg.getAllSubnet4(SubnetID(3)).empty());
+
+    hosts = cfg.getAllSubnet6(SubnetID(4));
+    ASSERT_EQ(12, hosts.size());
+    for (ConstHostCollection::const_iterator host = hosts.begin();
+         host != hosts.end(); ++host) {
+        EXPECT_EQ(4, (*host)->getIPv6SubnetID());
+    }
+    EXPECT_EQ(13, cfg.getAllSubnet6(SubnetID(3)).size());
+    EXPECT_TRUE(cfg.getAllSubnet6(SubnetID(1)).empty());
+}
+
 // This test checks that all reservations for the specified IPv4 subnet can
 // be deleted.
 TEST_F(CfgHostsTest, deleteAll4) {
@@ -0,0 +1,87 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option.h>
+#include <dhcp/option_space.h>
+#include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/cfg_option_list_cache.h>
+
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+// This test verifies that options are cached per option list, option
+// space and requested codes.
+TEST(CfgOptionListCacheTest, getAndAdd) {
+    CfgOptionPtr subnet_options(new CfgOption());
+    CfgOptionPtr global_options(new CfgOption());
+    CfgOptionList co_list;
+    co_list.push_back(subnet_options);
+    co_list.push_back(global_options);
+
+    std::vector<uint16_t> codes;
+    codes.push_back(DHO_ROUTERS);
+    codes.push_back(DHO_DOMAIN_NAME);
+
+    OptionCollection options;
+    OptionPtr routers(new Option(Option::V4, DHO_ROUTERS));
+    options.insert(std::make_pair(DHO_ROUTERS, routers));
+
+    CfgOptionListCache cache;
+    EXPECT_FALSE(cache.get(co_list, DHCP4_OPTION_SPACE, codes));
+
+    const OptionCollection& added = cache.add(co_list, DHCP4_OPTION_SPACE,
+                                              codes, options);
+    ASSERT_EQ(1, added.size());
+    EXPECT_EQ(1, cache.size());
+
+    // The cached option is the configured instance.
+    const OptionCollection* cached = cache.get(co_list, DHCP4_OPTION_SPACE,
+                                               codes);
+    ASSERT_TRUE(cached);
+    ASSERT_EQ(1, cached->size());
+    EXPECT_TRUE(cached->begin()->second == routers);
+
+    // Other codes, option spaces or lists are not cached.
+    std::vector<uint16_t> other_codes(codes.begin(), codes.begin() + 1);
+    EXPECT_FALSE(cache.get(co_list, DHCP4_OPTION_SPACE, other_codes));
+    EXPECT_FALSE(cache.get(co_list, "vendor-4491", codes));
+    CfgOptionList other_list;
+    other_list.push_back(global_options);
+    EXPECT_FALSE(cache.get(other_list, DHCP4_OPTION_SPACE, codes));
+
+    // Clear the cache.
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+    EXPECT_FALSE(cache.get(co_list, DHCP4_OPTION_SPACE, codes));
+}
+
+// This test verifies that the cache is cleared when it is full.
+TEST(CfgOptionListCacheTest, maxEntries) {
+    CfgOptionList co_list;
+    co_list.push_back(CfgOptionPtr(new CfgOption()));
+    OptionCollection options;
+
+    CfgOptionListCache cache;
+    std::vector<uint16_t> codes(1);
+    for (size_t i = 0; i < CfgOptionListCache::MAX_ENTRIES; ++i) {
+        codes[0] = static_cast<uint16_t>(i);
+        cache.add(co_list, DHCP4_OPTION_SPACE, codes, options);
+    }
+    EXPECT_EQ(CfgOptionListCache::MAX_ENTRIES, cache.size());
+
+    codes[0] = static_cast<uint16_t>(CfgOptionListCache::MAX_ENTRIES);
+    cache.add(co_list, DHCP4_OPTION_SPACE, codes, options);
+    EXPECT_EQ(1, cache.size());
+    EXPECT_TRUE(cache.get(co_list, DHCP4_OPTION_SPACE, codes));
+}
+
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -89,6 +89,23 @@ public:
     }
 };
 
+// This test verifies that the option descriptor copy keeps the
+// modification time.
+TEST(OptionDescriptorTest, copy) {
+    OptionDescriptor desc(OptionPtr(new Option(Option::V6, 1)), true, "foo");
+    desc.space_name_ = DHCP6_OPTION_SPACE;
+    const boost::posix_time::ptime modification_time =
+        boost::posix_time::from_time_t(1000);
+    desc.setModificationTime(modification_time);
+
+    OptionDescriptor copy(desc);
+    EXPECT_EQ(desc.option_, copy.option_);
+    EXPECT_TRUE(copy.persistent_);
+    EXPECT_EQ("foo", copy.formatted_value_);
+    EXPECT_EQ(DHCP6_OPTION_SPACE, copy.space_name_);
+    EXPECT_EQ(modification_time, copy.getModificationTime());
+}
+
 // This test verifies the empty predicate.
 TEST_F(CfgOptionTest, empty) {
     CfgOption cfg1;
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -547,6 +547,71 @@ TEST_F(CfgMgrTest, commitStats4) {
     EXPECT_EQ(128, total_addrs->getInteger().first);
 }
 
+// This test verifies that the statistics of the subnets which haven't
+// changed are preserved when the new configuration is committed, and
+// that the statistics are recounted for the new and changed subnets.
+TEST_F(CfgMgrTest, commitStatsIncremental4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET);
+
+    // Let's prepare the "old" configuration: a subnet with id 123.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet1->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 25)));
+    CfgSubnets4Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet1);
+    cfg_mgr.commit();
+
+    // The statistics should have been counted. Pretend there were
+    // addresses assigned, so statistics are non-zero.
+    ASSERT_TRUE(stats_mgr.getObservation("subnet[123].assigned-addresses"));
+    stats_mgr.setValue("subnet[123].assigned-addresses", static_cast<int64_t>(150));
+
+    // The new configuration holds the same subnet and a new one.
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet2->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 25)));
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 42));
+    subnet3->addPool(PoolPtr(new Pool4(IOAddress("192.1.3.0"), 26)));
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet2);
+    subnets->add(subnet3);
+    cfg_mgr.commit();
+
+    // The statistics of the unchanged subnet should have been preserved.
+    ObservationPtr assigned;
+    assigned = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(150, assigned->getInteger().first);
+
+    // The statistics of the new subnet should have been counted.
+    assigned = stats_mgr.getObservation("subnet[42].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(0, assigned->getInteger().first);
+    ObservationPtr total_addrs;
+    total_addrs = stats_mgr.getObservation("subnet[42].total-addresses");
+    ASSERT_TRUE(total_addrs);
+    EXPECT_EQ(64, total_addrs->getInteger().first);
+
+    // Change the pool of the subnet with id 123.
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet4->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 26)));
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets4();
+    subnets->add(subnet4);
+    cfg_mgr.commit();
+
+    // The statistics of the changed subnet should have been recounted.
+    assigned = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(0, assigned->getInteger().first);
+    total_addrs = stats_mgr.getObservation("subnet[123].total-addresses");
+    ASSERT_TRUE(total_addrs);
+    EXPECT_EQ(64, total_addrs->getInteger().first);
+
+    // The subnet with id 42 is gone.
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[42].total-addresses"));
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[42].assigned-addresses"));
+}
+
 // This test verifies that once the configuration is cleared, the statistics
 // are removed.
 TEST_F(CfgMgrTest, clearStats4) {
@@ -626,6 +691,76 @@ TEST_F(CfgMgrTest, commitStats6) {
     EXPECT_EQ(65536, total_addrs->getInteger().first);
 }
 
+// This test verifies that the statistics of the IPv6 subnets which haven't
+// changed are preserved when the new configuration is committed, and
+// that the statistics are recounted for the new and changed subnets.
+TEST_F(CfgMgrTest, commitStatsIncremental6) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    startBackend(AF_INET6);
+
+    // Let's prepare the "old" configuration: a subnet with id 123.
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 123));
+    subnet1->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 121)));
+    CfgSubnets6Ptr subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnets->add(subnet1);
+    cfg_mgr.commit();
+
+    // The statistics should have been counted. Pretend there were
+    // addresses and prefixes assigned, so statistics are non-zero.
+    ASSERT_TRUE(stats_mgr.getObservation("subnet[123].assigned-nas"));
+    stats_mgr.setValue("subnet[123].assigned-nas", static_cast<int64_t>(150));
+    stats_mgr.setValue("subnet[123].assigned-pds", static_cast<int64_t>(15));
+
+    // The new configuration holds the same subnet and a new one.
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4, 123));
+    subnet2->addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 121)));
+    Subnet6Ptr subnet3(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4, 42));
+    subnet3->addPool(PoolPtr(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:3::"), 96, 112)));
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnets->add(subnet2);
+    subnets->add(subnet3);
+    cfg_mgr.commit();
+
+    // The statistics of the unchanged subnet should have been preserved.
+    ObservationPtr assigned;
+    assigned = stats_mgr.getObservation("subnet[123].assigned-nas");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(150, assigned->getInteger().first);
+    assigned = stats_mgr.getObservation("subnet[123].assigned-pds");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(15, assigned->getInteger().first);
+
+    // The statistics of the new subnet should have been counted.
+    assigned = stats_mgr.getObservation("subnet[42].assigned-pds");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(0, assigned->getInteger().first);
+    ObservationPtr total_pds;
+    total_pds = stats_mgr.getObservation("subnet[42].total-pds");
+    ASSERT_TRUE(total_pds);
+    EXPECT_EQ(65536, total_pds->getInteger().first);
+
+    // Change the delegated length of the prefix pool of the subnet with id 42.
+    Subnet6Ptr subnet4(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4, 42));
+    subnet4->addPool(PoolPtr(new Pool6(Lease::TYPE_PD, IOAddress("2001:db8:3::"), 96, 104)));
+    subnets = cfg_mgr.getStagingCfg()->getCfgSubnets6();
+    subnets->add(subnet4);
+    stats_mgr.setValue("subnet[42].assigned-pds", static_cast<int64_t>(10));
+    cfg_mgr.commit();
+
+    // The statistics of the changed subnet should have been recounted.
+    assigned = stats_mgr.getObservation("subnet[42].assigned-pds");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(0, assigned->getInteger().first);
+    total_pds = stats_mgr.getObservation("subnet[42].total-pds");
+    ASSERT_TRUE(total_pds);
+    EXPECT_EQ(256, total_pds->getInteger().first);
+
+    // The subnet with id 123 is gone.
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[123].total-nas"));
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[123].assigned-nas"));
+}
+
 // This test verifies that once the configuration is cleared, the v6 statistics
 // are removed.
 TEST_F(CfgMgrTest, clearStats6) {
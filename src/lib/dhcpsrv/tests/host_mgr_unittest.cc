@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,7 @@
 #include <dhcpsrv/host.h>
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
+#include <dhcpsrv/testutils/memory_host_data_source.h>
 #include <dhcpsrv/tests/test_utils.h>
 
 #if defined HAVE_MYSQL
@@ -537,6 +538,52 @@ TEST_F(HostMgrTest, get6ByPrefix) {
     testGet6ByPrefix(*getCfgHosts(), *getCfgHosts());
 }
 
+// This test verifies that the addresses reserved in the subnets are found
+// when the configuration is committed and that they are not used when a
+// hosts database is configured.
+TEST_F(HostMgrTest, reservedAddresses) {
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3,
+                                   SubnetID(1)));
+    Subnet6Ptr subnet6(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4,
+                                   SubnetID(2)));
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet4);
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets6()->add(subnet6);
+    addHost4(*getCfgHosts(), hwaddrs_[0], SubnetID(1), IOAddress("192.0.2.5"));
+    addHost6(*getCfgHosts(), duids_[0], SubnetID(2), IOAddress("2001:db8:1::5"));
+    addHost6(*getCfgHosts(), duids_[1], SubnetID(2), IOAddress("2001:db8:1:1::"),
+             64);
+    CfgMgr::instance().commit();
+
+    ASSERT_TRUE(subnet4->isReservedAddressesValid());
+    EXPECT_TRUE(subnet4->mayBeReserved(IOAddress("192.0.2.5")));
+    EXPECT_FALSE(subnet4->mayBeReserved(IOAddress("192.0.2.6")));
+    ASSERT_TRUE(subnet6->isReservedAddressesValid());
+    EXPECT_TRUE(subnet6->mayBeReserved(IOAddress("2001:db8:1::5")));
+    EXPECT_TRUE(subnet6->mayBeReserved(IOAddress("2001:db8:1:1::")));
+    EXPECT_FALSE(subnet6->mayBeReserved(IOAddress("2001:db8:1::6")));
+
+    // Adding a host to an alternate host data source invalidates the
+    // reserved addresses of its subnets.
+    HostMgr::instance().getHostDataSourceList().push_back(
+        HostDataSourcePtr(new MemHostDataSource()));
+    HostPtr host(new Host(hwaddrs_[1]->toText(false), "hw-address",
+                          SubnetID(1), SubnetID(2), IOAddress("192.0.2.6")));
+    host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                   IOAddress("2001:db8:1::6")));
+    ASSERT_NO_THROW(HostMgr::instance().add(host));
+    EXPECT_FALSE(subnet4->isReservedAddressesValid());
+    EXPECT_TRUE(subnet4->mayBeReserved(IOAddress("192.0.2.6")));
+    EXPECT_FALSE(subnet6->isReservedAddressesValid());
+    EXPECT_TRUE(subnet6->mayBeReserved(IOAddress("2001:db8:1::6")));
+
+    // The content of a hosts database may change at any time so the
+    // addresses are still looked up after the next reconfiguration.
+    CfgMgr::instance().getStagingCfg()->getCfgSubnets4()->add(subnet4);
+    CfgMgr::instance().commit();
+    EXPECT_FALSE(subnet4->isReservedAddressesValid());
+    EXPECT_TRUE(subnet4->mayBeReserved(IOAddress("192.0.2.7")));
+}
+
 // This test verifies that without a host data source an exception is thrown.
 TEST_F(HostMgrTest, addNoDataSource) {
     // Remove all configuration.
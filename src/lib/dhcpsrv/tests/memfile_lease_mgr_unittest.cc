@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -92,6 +92,7 @@ public:
     }
 
     using Memfile_LeaseMgr::lfcCallback;
+    using Memfile_LeaseMgr::shareIdentifiers;
 };
 
 /// @brief Test fixture class for @c Memfile_LeaseMgr
@@ -956,6 +957,94 @@ TEST_F(MemfileLeaseMgrTest, getLeases6) {
     testGetLeases6();
 }
 
+// This test checks that the stored IPv4 leases of the same client share
+// the HW address and client identifier instances. The added leases are
+// stored as is so they are modified, while the updated leases are not.
+TEST_F(MemfileLeaseMgrTest, shareIdentifiers4) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "4";
+    pmap["persist"] = "false";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr;
+    ASSERT_NO_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)));
+
+    const uint8_t client_id[] = { 1, 2, 3, 4 };
+    HWAddrPtr hwaddr1(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+    HWAddrPtr hwaddr2(new HWAddr(*hwaddr1));
+    Lease4Ptr lease1(new Lease4(IOAddress("192.0.2.1"), hwaddr1, client_id,
+                                sizeof(client_id), 100, 50, 80, time(NULL), 1));
+    Lease4Ptr lease2(new Lease4(IOAddress("192.0.3.1"), hwaddr2, client_id,
+                                sizeof(client_id), 100, 50, 80, time(NULL), 2));
+    ASSERT_TRUE(lease_mgr->addLease(lease1));
+    ASSERT_TRUE(lease_mgr->addLease(lease2));
+    EXPECT_EQ(hwaddr1, lease1->hwaddr_);
+    EXPECT_EQ(lease1->hwaddr_, lease2->hwaddr_);
+    EXPECT_EQ(lease1->client_id_, lease2->client_id_);
+
+    // Other leases of the client are given the stored identifiers.
+    HWAddrPtr hwaddr3(new HWAddr(*hwaddr1));
+    Lease4 lease3(IOAddress("192.0.4.1"), hwaddr3, client_id,
+                  sizeof(client_id), 100, 50, 80, time(NULL), 3);
+    lease_mgr->shareIdentifiers(lease3);
+    EXPECT_EQ(hwaddr1, lease3.hwaddr_);
+    EXPECT_EQ(lease1->client_id_, lease3.client_id_);
+
+    // A lease with a different HW address type must not share it.
+    HWAddrPtr hwaddr4(new HWAddr(hwaddr1->hwaddr_, HTYPE_FDDI));
+    Lease4 lease4(IOAddress("192.0.5.1"), hwaddr4, client_id,
+                  sizeof(client_id), 100, 50, 80, time(NULL), 4);
+    lease_mgr->shareIdentifiers(lease4);
+    EXPECT_EQ(hwaddr4, lease4.hwaddr_);
+    EXPECT_EQ(HTYPE_FDDI, lease4.hwaddr_->htype_);
+
+    // The updated lease is left untouched and returned intact.
+    Lease4Ptr lease5(new Lease4(*lease2));
+    HWAddrPtr hwaddr5 = lease5->hwaddr_;
+    ASSERT_NO_THROW(lease_mgr->updateLease4(lease5));
+    EXPECT_EQ(hwaddr5, lease5->hwaddr_);
+    Lease4Ptr returned = lease_mgr->getLease4(IOAddress("192.0.3.1"));
+    ASSERT_TRUE(returned);
+    detailCompareLease(lease5, returned);
+}
+
+// This test checks that the stored IPv6 leases of the same client share
+// the DUID instance. The added leases are stored as is so they are
+// modified, while the updated leases are not.
+TEST_F(MemfileLeaseMgrTest, shareIdentifiers6) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["universe"] = "6";
+    pmap["persist"] = "false";
+    boost::scoped_ptr<NakedMemfileLeaseMgr> lease_mgr;
+    ASSERT_NO_THROW(lease_mgr.reset(new NakedMemfileLeaseMgr(pmap)));
+
+    DuidPtr duid1(new DUID(std::vector<uint8_t>(8, 1)));
+    DuidPtr duid2(new DUID(*duid1));
+    Lease6Ptr lease1(new Lease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1"),
+                                duid1, 1, 300, 400, 100, 200, 1));
+    Lease6Ptr lease2(new Lease6(Lease::TYPE_PD, IOAddress("3000::"),
+                                duid2, 2, 300, 400, 100, 200, 1,
+                                HWAddrPtr(), 64));
+    ASSERT_TRUE(lease_mgr->addLease(lease1));
+    ASSERT_TRUE(lease_mgr->addLease(lease2));
+    EXPECT_EQ(duid1, lease1->duid_);
+    EXPECT_EQ(duid1, lease2->duid_);
+
+    // Other leases of the client are given the stored DUID.
+    Lease6 lease3(Lease::TYPE_NA, IOAddress("2001:db8:1::2"),
+                  DuidPtr(new DUID(*duid1)), 3, 300, 400, 100, 200, 1);
+    lease_mgr->shareIdentifiers(lease3);
+    EXPECT_EQ(duid1, lease3.duid_);
+
+    // The updated lease is left untouched.
+    Lease6Ptr lease4(new Lease6(*lease2));
+    DuidPtr duid4(new DUID(*duid1));
+    lease4->duid_ = duid4;
+    ASSERT_NO_THROW(lease_mgr->updateLease6(lease4));
+    EXPECT_EQ(duid4, lease4->duid_);
+
+    Lease6Collection returned = lease_mgr->getLeases6(*duid1);
+    ASSERT_EQ(2, returned.size());
+}
+
 // Test that a range of IPv6 leases is returned with paging.
 TEST_F(MemfileLeaseMgrTest, getLeases6Paged) {
     startBackend(V6);
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -281,6 +281,41 @@ TEST(Pool4Test, lastAllocated) {
     EXPECT_FALSE(pool->isLastAllocatedValid());
 }
 
+// This test checks that the number of assigned leases is maintained.
+TEST(Pool4Test, assignedLeases) {
+    Pool4Ptr pool(new Pool4(IOAddress("192.0.2.0"), IOAddress("192.0.2.3")));
+
+    // The counter is initially invalid so it is never exhausted.
+    EXPECT_FALSE(pool->isAssignedLeasesValid());
+    pool->addAssignedLeases(10);
+    EXPECT_EQ(0, pool->getAssignedLeases());
+    EXPECT_FALSE(pool->isExhausted());
+
+    // Set the counter.
+    pool->setAssignedLeases(2);
+    EXPECT_TRUE(pool->isAssignedLeasesValid());
+    EXPECT_EQ(2, pool->getAssignedLeases());
+    EXPECT_FALSE(pool->isExhausted());
+
+    // The counter is kept between 0 and the capacity.
+    pool->addAssignedLeases(2);
+    EXPECT_TRUE(pool->isExhausted());
+    pool->addAssignedLeases(1);
+    EXPECT_EQ(4, pool->getAssignedLeases());
+    pool->addAssignedLeases(-1);
+    EXPECT_EQ(3, pool->getAssignedLeases());
+    EXPECT_FALSE(pool->isExhausted());
+    pool->addAssignedLeases(-5);
+    EXPECT_EQ(0, pool->getAssignedLeases());
+
+    // Reset makes it invalid.
+    pool->setAssignedLeases(4);
+    EXPECT_TRUE(pool->isExhausted());
+    pool->resetAssignedLeases();
+    EXPECT_FALSE(pool->isAssignedLeasesValid());
+    EXPECT_FALSE(pool->isExhausted());
+}
+
 TEST(Pool6Test, constructor_first_last) {
 
     // let's construct 2001:db8:1:: - 2001:db8:1::ffff:ffff:ffff:ffff pool
@@ -676,4 +711,116 @@ TEST(Pool6Test, lastAllocated) {
     EXPECT_FALSE(pool.isLastAllocatedValid());
 }
 
+/// @brief Returns the n-th /56 prefix of 2001:db8::/48.
+///
+/// @param index Index of the prefix.
+IOAddress
+prefix56(const unsigned index) {
+    std::ostringstream s;
+    s << "2001:db8:0:" << std::hex << (index << 8) << "::";
+    return (IOAddress(s.str()));
+}
+
+// Test that the free delegated prefixes are tracked.
+TEST(Pool6Test, freePrefixes) {
+    // Only prefix delegation pools are tracked.
+    Pool6 pool_na(Lease::TYPE_NA, IOAddress("2001:db8::1"),
+                  IOAddress("2001:db8::200"));
+    EXPECT_FALSE(pool_na.initFreePrefixes());
+    EXPECT_FALSE(pool_na.isFreePrefixesValid());
+
+    // The pool is too large to be tracked.
+    Pool6 pool_large(Lease::TYPE_PD, IOAddress("2001::"), 16, 64);
+    EXPECT_FALSE(pool_large.initFreePrefixes());
+    EXPECT_FALSE(pool_large.isFreePrefixesValid());
+
+    // A pool of 256 prefixes.
+    Pool6 pool(Lease::TYPE_PD, IOAddress("2001:db8::"), 48, 56);
+    EXPECT_FALSE(pool.isFreePrefixesValid());
+    EXPECT_TRUE(pool.isPrefixFree(prefix56(0)));
+    IOAddress prefix = prefix56(0);
+    EXPECT_FALSE(pool.getNextFreePrefix(prefix));
+
+    ASSERT_TRUE(pool.initFreePrefixes());
+    EXPECT_TRUE(pool.isFreePrefixesValid());
+    EXPECT_TRUE(pool.isAssignedLeasesValid());
+    EXPECT_EQ(0, pool.getAssignedLeases());
+
+    // Use the prefixes 1 to 130 so as the search crosses words.
+    for (unsigned i = 1; i <= 130; ++i) {
+        pool.usePrefix(prefix56(i));
+    }
+    // Using a prefix twice or a prefix out of the pool changes nothing.
+    pool.usePrefix(prefix56(1));
+    pool.usePrefix(IOAddress("2001:db8:1::"));
+    EXPECT_EQ(130, pool.getAssignedLeases());
+    EXPECT_TRUE(pool.isPrefixFree(prefix56(0)));
+    EXPECT_FALSE(pool.isPrefixFree(prefix56(1)));
+    EXPECT_FALSE(pool.isPrefixFree(prefix56(130)));
+    EXPECT_TRUE(pool.isPrefixFree(prefix56(131)));
+
+    prefix = prefix56(0);
+    ASSERT_TRUE(pool.getNextFreePrefix(prefix));
+    EXPECT_EQ(prefix56(131).toText(), prefix.toText());
+
+    // Releasing a prefix makes it free again.
+    pool.releasePrefix(prefix56(64));
+    EXPECT_EQ(129, pool.getAssignedLeases());
+    prefix = prefix56(0);
+    ASSERT_TRUE(pool.getNextFreePrefix(prefix));
+    EXPECT_EQ(prefix56(64).toText(), prefix.toText());
+
+    // Use all prefixes.
+    for (unsigned i = 0; i < 256; ++i) {
+        pool.usePrefix(prefix56(i));
+    }
+    EXPECT_EQ(256, pool.getAssignedLeases());
+    EXPECT_TRUE(pool.isExhausted());
+    prefix = prefix56(0);
+    EXPECT_FALSE(pool.getNextFreePrefix(prefix));
+
+    // The last prefix is found when it is free.
+    pool.releasePrefix(prefix56(255));
+    EXPECT_FALSE(pool.isExhausted());
+    prefix = prefix56(0);
+    ASSERT_TRUE(pool.getNextFreePrefix(prefix));
+    EXPECT_EQ(prefix56(255).toText(), prefix.toText());
+    EXPECT_FALSE(pool.getNextFreePrefix(prefix));
+
+    // The prefixes in use are copied.
+    Pool6 pool_copy(Lease::TYPE_PD, IOAddress("2001:db8::"), 48, 56);
+    pool_copy.copyFreePrefixes(pool);
+    EXPECT_TRUE(pool_copy.isFreePrefixesValid());
+    EXPECT_EQ(255, pool_copy.getAssignedLeases());
+    EXPECT_TRUE(pool_copy.isPrefixFree(prefix56(255)));
+    EXPECT_FALSE(pool_copy.isPrefixFree(prefix56(254)));
+
+    // Reset stops the tracking.
+    pool.resetFreePrefixes();
+    EXPECT_FALSE(pool.isFreePrefixesValid());
+    EXPECT_FALSE(pool.isAssignedLeasesValid());
+    EXPECT_TRUE(pool.isPrefixFree(prefix56(1)));
+}
+
+// Test that the prefixes past the capacity of a small pool are never free.
+TEST(Pool6Test, freePrefixesSmallPool) {
+    // A pool of 4 prefixes.
+    Pool6 pool(Lease::TYPE_PD, IOAddress("2001:db8::"), 48, 50);
+    ASSERT_TRUE(pool.initFreePrefixes());
+    pool.usePrefix(IOAddress("2001:db8::"));
+    pool.usePrefix(IOAddress("2001:db8:0:8000::"));
+
+    IOAddress prefix("2001:db8::");
+    ASSERT_TRUE(pool.getNextFreePrefix(prefix));
+    EXPECT_EQ("2001:db8:0:4000::", prefix.toText());
+    pool.usePrefix(prefix);
+    ASSERT_TRUE(pool.getNextFreePrefix(prefix));
+    EXPECT_EQ("2001:db8:0:c000::", prefix.toText());
+    pool.usePrefix(prefix);
+
+    EXPECT_TRUE(pool.isExhausted());
+    prefix = IOAddress("2001:db8::");
+    EXPECT_FALSE(pool.getNextFreePrefix(prefix));
+}
+
 }; // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,6 +23,7 @@
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 #include <limits>
+#include <sstream>
 
 // don't import the entire boost namespace.  It will unexpectedly hide uint8_t
 // for some systems.
@@ -585,6 +586,77 @@ TEST(Subnet4Test, get) {
     EXPECT_EQ(28, subnet->get().second);
 }
 
+// This test checks that the samePools() method compares subnet prefixes
+// and pools.
+TEST(Subnet4Test, samePools) {
+    Subnet4 subnet1(IOAddress("192.0.2.0"), 24, 1, 2, 3);
+    subnet1.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.0"), 26)));
+    subnet1.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.100"),
+                                      IOAddress("192.0.2.200"))));
+
+    // Same prefix and pools but different parameters.
+    Subnet4 subnet2(IOAddress("192.0.2.0"), 24, 10, 20, 30);
+    subnet2.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.100"),
+                                      IOAddress("192.0.2.200"))));
+    subnet2.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.0"), 26)));
+    EXPECT_TRUE(subnet1.samePools(subnet2));
+    EXPECT_TRUE(subnet2.samePools(subnet1));
+
+    // Different pool boundaries.
+    Subnet4 subnet3(IOAddress("192.0.2.0"), 24, 1, 2, 3);
+    subnet3.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.0"), 26)));
+    subnet3.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.100"),
+                                      IOAddress("192.0.2.201"))));
+    EXPECT_FALSE(subnet1.samePools(subnet3));
+
+    // Missing pool.
+    Subnet4 subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3);
+    subnet4.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.0"), 26)));
+    EXPECT_FALSE(subnet1.samePools(subnet4));
+
+    // Different prefix length.
+    Subnet4 subnet5(IOAddress("192.0.2.0"), 23, 1, 2, 3);
+    subnet5.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.0"), 26)));
+    subnet5.addPool(PoolPtr(new Pool4(IOAddress("192.0.2.100"),
+                                      IOAddress("192.0.2.200"))));
+    EXPECT_FALSE(subnet1.samePools(subnet5));
+}
+
+// This test checks that a subnet takes over the allocation state of the
+// subnet it replaces.
+TEST(Subnet4Test, copyAllocationState) {
+    Subnet4 subnet1(IOAddress("192.0.2.0"), 24, 1, 2, 3);
+    Pool4Ptr pool1(new Pool4(IOAddress("192.0.2.10"), IOAddress("192.0.2.20")));
+    subnet1.addPool(pool1);
+    subnet1.setLastAllocated(Lease::TYPE_V4, IOAddress("192.0.2.15"));
+    pool1->setLastAllocated(IOAddress("192.0.2.15"));
+    pool1->setAssignedLeases(6);
+
+    // Same pools: the state of the pools is copied.
+    Subnet4 subnet2(IOAddress("192.0.2.0"), 24, 10, 20, 30);
+    Pool4Ptr pool2(new Pool4(IOAddress("192.0.2.10"), IOAddress("192.0.2.20")));
+    subnet2.addPool(pool2);
+    subnet2.copyAllocationState(subnet1);
+    EXPECT_EQ("192.0.2.15", subnet2.getLastAllocated(Lease::TYPE_V4).toText());
+    EXPECT_EQ("192.0.2.15", pool2->getLastAllocated().toText());
+    ASSERT_TRUE(pool2->isAssignedLeasesValid());
+    EXPECT_EQ(6, pool2->getAssignedLeases());
+
+    // Different pools: only the last allocated address of the subnet is kept.
+    Subnet4 subnet3(IOAddress("192.0.2.0"), 24, 10, 20, 30);
+    Pool4Ptr pool3(new Pool4(IOAddress("192.0.2.10"), IOAddress("192.0.2.30")));
+    subnet3.addPool(pool3);
+    subnet3.copyAllocationState(subnet1);
+    EXPECT_EQ("192.0.2.15", subnet3.getLastAllocated(Lease::TYPE_V4).toText());
+    EXPECT_FALSE(pool3->isLastAllocatedValid());
+    EXPECT_FALSE(pool3->isAssignedLeasesValid());
+
+    // Different prefix: the last allocated address is out of range.
+    Subnet4 subnet4(IOAddress("192.0.3.0"), 24, 10, 20, 30);
+    subnet4.copyAllocationState(subnet1);
+    EXPECT_EQ("192.0.3.255", subnet4.getLastAllocated(Lease::TYPE_V4).toText());
+}
+
 
 // Checks if last allocated address/prefix is stored/retrieved properly
 TEST(Subnet4Test, lastAllocated) {
@@ -607,6 +679,67 @@ TEST(Subnet4Test, lastAllocated) {
     EXPECT_THROW(subnet->setLastAllocated(Lease::TYPE_PD, addr), BadValue);
 }
 
+// Checks that the subnet reports when all its pools are exhausted.
+TEST(Subnet4Test, poolsExhausted) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
+
+    // A subnet without pools is not exhausted.
+    EXPECT_FALSE(subnet->poolsExhausted(Lease::TYPE_V4, ClientClasses()));
+
+    Pool4Ptr pool1(new Pool4(IOAddress("192.0.2.0"), IOAddress("192.0.2.1")));
+    Pool4Ptr pool2(new Pool4(IOAddress("192.0.2.128"), 30));
+    pool2->allowClientClass("foo");
+    subnet->addPool(pool1);
+    subnet->addPool(pool2);
+
+    // The counters are not valid yet.
+    subnet->addAssignedLeases(Lease::TYPE_V4, IOAddress("192.0.2.0"), 2);
+    EXPECT_FALSE(subnet->poolsExhausted(Lease::TYPE_V4, ClientClasses()));
+
+    pool1->setAssignedLeases(0);
+    pool2->setAssignedLeases(0);
+    subnet->addAssignedLeases(Lease::TYPE_V4, IOAddress("192.0.2.0"), 1);
+    subnet->addAssignedLeases(Lease::TYPE_V4, IOAddress("192.0.2.1"), 1);
+    EXPECT_EQ(2, pool1->getAssignedLeases());
+
+    // Addresses out of the pools are ignored.
+    subnet->addAssignedLeases(Lease::TYPE_V4, IOAddress("192.0.2.10"), 1);
+    EXPECT_EQ(0, pool2->getAssignedLeases());
+
+    // The second pool is only available to the class foo.
+    EXPECT_TRUE(subnet->poolsExhausted(Lease::TYPE_V4, ClientClasses()));
+    ClientClasses classes;
+    classes.insert("foo");
+    EXPECT_FALSE(subnet->poolsExhausted(Lease::TYPE_V4, classes));
+
+    pool2->setAssignedLeases(pool2->getCapacity());
+    EXPECT_TRUE(subnet->poolsExhausted(Lease::TYPE_V4, classes));
+
+    // Releasing an address makes the subnet available again.
+    subnet->addAssignedLeases(Lease::TYPE_V4, IOAddress("192.0.2.1"), -1);
+    EXPECT_FALSE(subnet->poolsExhausted(Lease::TYPE_V4, classes));
+}
+
+// Checks that the reserved addresses are used only when they are valid.
+TEST(Subnet4Test, reservedAddresses) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 3));
+
+    // Initially all addresses may be reserved.
+    EXPECT_FALSE(subnet->isReservedAddressesValid());
+    EXPECT_TRUE(subnet->mayBeReserved(IOAddress("192.0.2.1")));
+
+    std::set<IOAddress> addresses;
+    addresses.insert(IOAddress("192.0.2.10"));
+    subnet->setReservedAddresses(addresses);
+    EXPECT_TRUE(subnet->isReservedAddressesValid());
+    EXPECT_TRUE(subnet->mayBeReserved(IOAddress("192.0.2.10")));
+    EXPECT_FALSE(subnet->mayBeReserved(IOAddress("192.0.2.1")));
+
+    subnet->resetReservedAddresses();
+    EXPECT_FALSE(subnet->isReservedAddressesValid());
+    EXPECT_TRUE(subnet->mayBeReserved(IOAddress("192.0.2.2")));
+}
+
 // Checks if the V4 is the only allowed type for Pool4 and if getPool()
 // is working properly.
 TEST(Subnet4Test, PoolType) {
@@ -1429,6 +1562,57 @@ TEST(Subnet6Test, PdinRangeinPool) {
     EXPECT_FALSE(subnet->inPool(Lease::TYPE_PD, IOAddress("2001:db8:0:1:0:1::")));
 }
 
+// This test verifies that inPool() finds the pool among many pools,
+// added out of order, with gaps between them.
+TEST(Subnet6Test, inPoolManyPools) {
+    Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8::"), 32, 1, 2, 3, 4));
+
+    // Add 200 prefix pools: 2001:db8:0::/48, 2001:db8:2::/48 ... in reverse
+    // order, every other pool being reserved for the class "foo".
+    for (int i = 199; i >= 0; --i) {
+        std::ostringstream prefix;
+        prefix << "2001:db8:" << std::hex << (2 * i) << "::";
+        Pool6Ptr pool(new Pool6(Lease::TYPE_PD, IOAddress(prefix.str()),
+                                48, 56));
+        if (i % 2) {
+            pool->allowClientClass("foo");
+        }
+        ASSERT_NO_THROW(subnet->addPool(pool));
+    }
+
+    ClientClasses no_class;
+    ClientClasses foo_class;
+    foo_class.insert("foo");
+
+    for (int i = 0; i < 200; ++i) {
+        std::ostringstream first;
+        first << "2001:db8:" << std::hex << (2 * i) << "::";
+        std::ostringstream last;
+        last << "2001:db8:" << std::hex << (2 * i)
+             << ":ffff:ffff:ffff:ffff:ffff";
+        std::ostringstream gap;
+        gap << "2001:db8:" << std::hex << (2 * i + 1) << "::";
+
+        EXPECT_TRUE(subnet->inPool(Lease::TYPE_PD, IOAddress(first.str())))
+            << first.str();
+        EXPECT_TRUE(subnet->inPool(Lease::TYPE_PD, IOAddress(last.str())))
+            << last.str();
+        EXPECT_FALSE(subnet->inPool(Lease::TYPE_PD, IOAddress(gap.str())))
+            << gap.str();
+
+        // The pools for the class "foo" are not allowed without the class.
+        EXPECT_EQ(i % 2 == 0,
+                  subnet->inPool(Lease::TYPE_PD, IOAddress(first.str()),
+                                 no_class)) << first.str();
+        EXPECT_TRUE(subnet->inPool(Lease::TYPE_PD, IOAddress(first.str()),
+                                   foo_class)) << first.str();
+    }
+
+    // Before the first pool and after the last one.
+    EXPECT_FALSE(subnet->inPool(Lease::TYPE_PD, IOAddress("2001:db7::")));
+    EXPECT_FALSE(subnet->inPool(Lease::TYPE_PD, IOAddress("2001:db8:18f::")));
+}
+
 // This test checks if the toText() method returns text representation
 TEST(Subnet6Test, toText) {
     Subnet6 subnet(IOAddress("2001:db8::"), 32, 1, 2, 3, 4);
@@ -1472,6 +1656,30 @@ TEST(Subnet6Test, get) {
     EXPECT_EQ(32, subnet.get().second);
 }
 
+// This test checks that the samePools() method compares the prefix
+// delegation pools including the delegated prefix length.
+TEST(Subnet6Test, samePools) {
+    Subnet6 subnet1(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4);
+    subnet1.addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 96)));
+    subnet1.addPool(PoolPtr(new Pool6(Lease::TYPE_PD, IOAddress("3000::"), 48, 56)));
+
+    Subnet6 subnet2(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4);
+    subnet2.addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 96)));
+    subnet2.addPool(PoolPtr(new Pool6(Lease::TYPE_PD, IOAddress("3000::"), 48, 56)));
+    EXPECT_TRUE(subnet1.samePools(subnet2));
+
+    // Different delegated prefix length.
+    Subnet6 subnet3(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4);
+    subnet3.addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 96)));
+    subnet3.addPool(PoolPtr(new Pool6(Lease::TYPE_PD, IOAddress("3000::"), 48, 64)));
+    EXPECT_FALSE(subnet1.samePools(subnet3));
+
+    // Missing prefix delegation pool.
+    Subnet6 subnet4(IOAddress("2001:db8:1::"), 64, 1, 2, 3, 4);
+    subnet4.addPool(PoolPtr(new Pool6(Lease::TYPE_NA, IOAddress("2001:db8:1::"), 96)));
+    EXPECT_FALSE(subnet1.samePools(subnet4));
+}
+
 // This trivial test checks if interface name is stored properly
 // in Subnet6 objects.
 TEST(Subnet6Test, iface) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -353,6 +353,24 @@ TEST_F(TimerMgrTest, scheduleTimers) {
     EXPECT_GT(calls_count_["timer2"], calls_count_timer2);
 }
 
+// This test verifies that the timer can be scheduled once with an
+// interval other than the registered one.
+TEST_F(TimerMgrTest, scheduleWithInterval) {
+    // Register the timer with a long interval.
+    ASSERT_NO_FATAL_FAILURE(registerTimer("timer1", 10000));
+
+    // Scheduling non-existing timer should fail.
+    EXPECT_THROW(timer_mgr_->setup("timer2", 1), BadValue);
+
+    // Schedule the timer with a short interval. The callback re-schedules
+    // it using the registered interval, so it should be called only once.
+    ASSERT_NO_THROW(timer_mgr_->setup("timer1", 1));
+
+    doWait(500);
+
+    EXPECT_EQ(1, calls_count_["timer1"]);
+}
+
 // This test verifies that exceptions emitted from the callback would
 // be handled by the TimerMgr.
 TEST_F(TimerMgrTest, callbackWithException) {
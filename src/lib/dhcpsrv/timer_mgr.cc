@@ -1,4 +1,4 @@
-// Copyright (C) 2016-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -138,6 +138,16 @@ public:
     /// @throw BadValue if the timer hasn't been registered.
     void setup(const std::string& timer_name);
 
+    /// @brief Schedules the execution of the interval timer using the
+    /// specified interval.
+    ///
+    /// @param timer_name Unique timer name.
+    /// @param interval Interval in milliseconds to be used instead of the
+    /// interval specified during the timer registration.
+    ///
+    /// @throw BadValue if the timer hasn't been registered.
+    void setup(const std::string& timer_name, const long interval);
+
     /// @brief Cancels the execution of the interval timer.
     ///
     /// @param timer_name Unique timer name.
@@ -262,10 +272,25 @@ TimerMgrImpl::setup(const std::string& timer_name) {
 
    // Schedule the execution of the timer using the parameters supplied
    // during the registration.
+   setup(timer_name, timer_info_it->second->interval_);
+}
+
+void
+TimerMgrImpl::setup(const std::string& timer_name, const long interval) {
+
+   // Check if the specified timer exists.
+   TimerInfoMap::const_iterator timer_info_it = registered_timers_.find(timer_name);
+   if (timer_info_it == registered_timers_.end()) {
+       isc_throw(BadValue, "unable to setup timer '" << timer_name << "': "
+                 "no such timer registered");
+   }
+
+   // Schedule the execution of the timer using the specified interval
+   // and the scheduling mode supplied during the registration.
    const TimerInfoPtr& timer_info = timer_info_it->second;
    IntervalTimer::Callback cb = boost::bind(&TimerMgrImpl::timerCallback, this,
                                             timer_name);
-   timer_info->interval_timer_.setup(cb, timer_info->interval_,
+   timer_info->interval_timer_.setup(cb, interval,
                                      timer_info->scheduling_mode_);
 }
 
@@ -383,6 +408,16 @@ TimerMgr::setup(const std::string& timer_name) {
     impl_->setup(timer_name);
 }
 
+void
+TimerMgr::setup(const std::string& timer_name, const long interval) {
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+              DHCPSRV_TIMERMGR_START_TIMER)
+        .arg(timer_name);
+
+    impl_->setup(timer_name, interval);
+}
+
 void
 TimerMgr::cancel(const std::string& timer_name) {
 
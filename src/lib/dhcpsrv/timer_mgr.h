@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -124,6 +124,21 @@ public:
     /// @throw BadValue if the timer hasn't been registered.
     void setup(const std::string& timer_name);
 
+    /// @brief Schedules the execution of the interval timer using the
+    /// specified interval.
+    ///
+    /// This variant of the method uses the specified interval rather than
+    /// the interval specified during the timer registration. It is useful
+    /// for re-scheduling a ONE_SHOT timer which should exceptionally be
+    /// executed sooner or later than usual. The registered interval is
+    /// used again when the timer is scheduled with the other variant.
+    ///
+    /// @param timer_name Unique timer name.
+    /// @param interval Timer interval in milliseconds.
+    ///
+    /// @throw BadValue if the timer hasn't been registered.
+    void setup(const std::string& timer_name, const long interval);
+
     /// @brief Cancels the execution of the interval timer.
     ///
     /// This method has no effect if the timer hasn't been scheduled with
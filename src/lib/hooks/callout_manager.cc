@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -14,12 +14,15 @@
 
 #include <boost/static_assert.hpp>
 
+#include <boost/lexical_cast.hpp>
+
 #include <algorithm>
 #include <climits>
 #include <functional>
 #include <utility>
 
 using namespace std;
+using namespace isc::data;
 
 namespace isc {
 namespace hooks {
@@ -29,6 +32,7 @@ CalloutManager::CalloutManager(int num_libraries)
     : server_hooks_(ServerHooks::getServerHooks()),
       current_hook_(-1), current_library_(-1),
       hook_vector_(ServerHooks::getServerHooks().getCount()),
+      hook_stats_(ServerHooks::getServerHooks().getCount()),
       library_handle_(this), pre_library_handle_(this, 0),
       post_library_handle_(this, INT_MAX), num_libraries_(num_libraries)
 {
@@ -174,6 +178,8 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 stopwatch.start();
                 int status = (*i->second)(callout_handle);
                 stopwatch.stop();
+                recordStatistics(hook_index, current_library_,
+                                 stopwatch.getLastMicroseconds(), status != 0);
                 if (status == 0) {
                     LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
                               HOOKS_CALLOUT_CALLED).arg(current_library_)
@@ -191,6 +197,8 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 // If an exception occurred, the stopwatch.stop() hasn't been
                 // called, so we have to call it here.
                 stopwatch.stop();
+                recordStatistics(hook_index, current_library_,
+                                 stopwatch.getLastMicroseconds(), true);
                 // Any exception, not just ones based on isc::Exception
                 LOG_ERROR(callouts_logger, HOOKS_CALLOUT_EXCEPTION)
                     .arg(current_library_)
@@ -338,6 +346,7 @@ CalloutManager::registerCommandHook(const std::string& command_name) {
         // element will match the index of the hook point in the ServerHooks
         // because ServerHooks allocates indexes incrementally.
         hook_vector_.resize(server_hooks_.getCount());
+        hook_stats_.resize(server_hooks_.getCount());
     }
 }
 
@@ -347,6 +356,87 @@ CalloutManager::ensureHookLibsVectorSize() {
     if (hooks.getCount() > hook_vector_.size()) {
         // Uh oh, there are more hook points that our vector allows.
         hook_vector_.resize(hooks.getCount());
+        hook_stats_.resize(hooks.getCount());
+    }
+}
+
+// Record the execution time of a callout.
+
+void
+CalloutManager::recordStatistics(int hook_index, int library_index,
+                                 int64_t usecs, bool error) {
+    // A callout may have registered a new hook point since the hook index
+    // was validated.
+    if (hook_index >= hook_stats_.size()) {
+        hook_stats_.resize(hook_vector_.size());
+    }
+    CalloutStatistics& stats = hook_stats_[hook_index][library_index];
+    ++stats.calls_;
+    if (error) {
+        ++stats.errors_;
+    }
+    stats.total_usecs_ += usecs;
+    if (usecs > stats.max_usecs_) {
+        stats.max_usecs_ = usecs;
+    }
+}
+
+CalloutManager::CalloutStatistics
+CalloutManager::getStatistics(int hook_index, int library_index) const {
+    if ((hook_index < 0) || (hook_index >= hook_stats_.size())) {
+        return (CalloutStatistics());
+    }
+    std::map<int, CalloutStatistics>::const_iterator it =
+        hook_stats_[hook_index].find(library_index);
+    if (it == hook_stats_[hook_index].end()) {
+        return (CalloutStatistics());
+    }
+    return (it->second);
+}
+
+ElementPtr
+CalloutManager::getStatistics(const std::vector<std::string>&
+                              library_names) const {
+    ElementPtr result = Element::createMap();
+    for (int hook_index = 0; hook_index < hook_stats_.size(); ++hook_index) {
+        if (hook_stats_[hook_index].empty()) {
+            continue;
+        }
+        ElementPtr libraries = Element::createMap();
+        for (std::map<int, CalloutStatistics>::const_iterator it =
+                 hook_stats_[hook_index].begin();
+             it != hook_stats_[hook_index].end(); ++it) {
+            std::string library;
+            if (it->first == 0) {
+                library = "server-pre";
+            } else if (it->first == INT_MAX) {
+                library = "server-post";
+            } else if (it->first <= library_names.size()) {
+                library = library_names[it->first - 1];
+            } else {
+                library = "library-" +
+                    boost::lexical_cast<std::string>(it->first);
+            }
+            ElementPtr stats = Element::createMap();
+            const CalloutStatistics& value = it->second;
+            stats->set("calls",
+                       Element::create(static_cast<int64_t>(value.calls_)));
+            stats->set("errors",
+                       Element::create(static_cast<int64_t>(value.errors_)));
+            stats->set("total-usecs", Element::create(value.total_usecs_));
+            stats->set("max-usecs", Element::create(value.max_usecs_));
+            libraries->set(library, stats);
+        }
+        result->set(server_hooks_.getName(hook_index), libraries);
+    }
+    return (result);
+}
+
+void
+CalloutManager::resetStatistics() {
+    for (std::vector<std::map<int, CalloutStatistics> >::iterator it =
+             hook_stats_.begin(); it != hook_stats_.end(); ++it) {
+        it->clear();
     }
 }
 
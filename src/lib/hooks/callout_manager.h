@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #ifndef CALLOUT_MANAGER_H
 #define CALLOUT_MANAGER_H
 
+#include <cc/data.h>
 #include <exceptions/exceptions.h>
 #include <hooks/library_handle.h>
 #include <hooks/server_hooks.h>
@@ -16,6 +17,9 @@
 #include <climits>
 #include <map>
 #include <string>
+#include <vector>
+
+#include <stdint.h>
 
 namespace isc {
 namespace hooks {
@@ -126,6 +130,15 @@ public:
 /// @ref LibraryHandle::registerCommandCallout can install callouts on this
 /// hook point.
 ///
+/// The execution time of each callout is measured anyway (for the debug
+/// logging), so the CalloutManager also accumulates it per hook point and per
+/// library: the number of calls, the number of calls which failed (returned a
+/// non-zero status or threw), the total and the longest execution time. The
+/// statistics are kept in a small map per hook point so recording them costs
+/// about as much as a map lookup for each callout called. They are returned by
+/// @ref CalloutManager::getStatistics and live as long as the CalloutManager,
+/// i.e. they are reset when the libraries are reloaded.
+///
 /// Note that the callout functions do not access the CalloutManager: instead,
 /// they use a LibraryHandle object.  This contains an internal pointer to
 /// the CalloutManager, but provides a restricted interface.  In that way,
@@ -147,6 +160,26 @@ private:
 
 public:
 
+    /// @brief Execution statistics of the callouts of a library on a hook.
+    struct CalloutStatistics {
+        /// @brief Constructor.
+        CalloutStatistics()
+            : calls_(0), errors_(0), total_usecs_(0), max_usecs_(0) {
+        }
+
+        /// @brief Number of callouts called.
+        uint64_t calls_;
+
+        /// @brief Number of callouts which returned an error or threw.
+        uint64_t errors_;
+
+        /// @brief Total execution time in microseconds.
+        int64_t total_usecs_;
+
+        /// @brief Longest execution time in microseconds.
+        int64_t max_usecs_;
+    };
+
     /// @brief Constructor
     ///
     /// Initializes member variables, in particular sizing the hook vector
@@ -372,6 +405,43 @@ public:
         return (hook_vector_.size());
     }
 
+    /// @brief Returns the execution statistics of a library on a hook.
+    ///
+    /// @param hook_index Index of the hook.
+    /// @param library_index Index of the library (0 and INT_MAX for the
+    ///        server callouts).
+    ///
+    /// @return Statistics of the callouts of the library on the hook, all
+    ///         zero if none was called.
+    CalloutStatistics getStatistics(int hook_index, int library_index) const;
+
+    /// @brief Returns the execution statistics of the callouts.
+    ///
+    /// The result is a map indexed by the names of the hook points on
+    /// which callouts were called, each being a map indexed by library:
+    /// @code
+    /// {
+    ///     "pkt4_receive": {
+    ///         "/usr/lib/kea/hooks/libdhcp_lease_cmds.so": {
+    ///             "calls": 12, "errors": 0,
+    ///             "total-usecs": 96, "max-usecs": 21
+    ///         }
+    ///     }
+    /// }
+    /// @endcode
+    /// The server callouts are reported as "server-pre" and "server-post".
+    ///
+    /// @param library_names Names of the loaded libraries, the library with
+    ///        the index i being at the position i - 1. A library which is
+    ///        not in the list is reported as "library-<index>".
+    ///
+    /// @return Statistics of the callouts as a JSON map.
+    isc::data::ElementPtr
+    getStatistics(const std::vector<std::string>& library_names) const;
+
+    /// @brief Resets the execution statistics of the callouts.
+    void resetStatistics();
+
 private:
 
     /// @brief This method checks whether the hook_vector_ size is suffucient
@@ -395,6 +465,15 @@ private:
     /// may grow the vector size, but will never shrink it.
     void ensureHookLibsVectorSize();
 
+    /// @brief Records the execution time of a callout.
+    ///
+    /// @param hook_index Index of the hook on which the callout was called.
+    /// @param library_index Index of the library of the callout.
+    /// @param usecs Execution time in microseconds.
+    /// @param error true if the callout returned an error or threw.
+    void recordStatistics(int hook_index, int library_index, int64_t usecs,
+                          bool error);
+
     /// @brief Check library index
     ///
     /// Ensures that the current library index is valid.  This is called by
@@ -448,6 +527,11 @@ private:
     /// callout registered for that hook.
     std::vector<CalloutVector> hook_vector_;
 
+    /// Execution statistics of the callouts.  There is one entry in this
+    /// vector for each hook, it maps the library indexes to the statistics
+    /// of their callouts on the hook.  It is sized as the hook_vector_.
+    std::vector<std::map<int, CalloutStatistics> > hook_stats_;
+
     /// LibraryHandle object user by the callout to access the callout
     /// registration methods on this CalloutManager object.  The object is set
     /// such that the index of the library associated with any operation is
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <cc/command_interpreter.h>
 #include <hooks/callout_handle.h>
 #include <hooks/callout_manager.h>
 #include <hooks/callout_manager.h>
@@ -20,6 +21,8 @@
 #include <vector>
 
 using namespace std;
+using namespace isc::config;
+using namespace isc::data;
 
 namespace isc {
 namespace hooks {
@@ -175,6 +178,44 @@ HooksManager::getLibraryInfo() {
     return (getHooksManager().getLibraryInfoInternal());
 }
 
+// Get or reset the execution statistics of the callouts.
+
+ConstElementPtr
+HooksManager::getCalloutStatisticsInternal() {
+    conditionallyInitialize();
+    return (callout_manager_->getStatistics(getLibraryNamesInternal()));
+}
+
+void
+HooksManager::resetCalloutStatisticsInternal() {
+    conditionallyInitialize();
+    callout_manager_->resetStatistics();
+}
+
+ConstElementPtr
+HooksManager::getCalloutStatistics() {
+    return (getHooksManager().getCalloutStatisticsInternal());
+}
+
+void
+HooksManager::resetCalloutStatistics() {
+    getHooksManager().resetCalloutStatisticsInternal();
+}
+
+ConstElementPtr
+HooksManager::calloutStatisticsGetHandler(const std::string& /*name*/,
+                                          const ConstElementPtr& /*params*/) {
+    return (createAnswer(CONTROL_RESULT_SUCCESS, getCalloutStatistics()));
+}
+
+ConstElementPtr
+HooksManager::calloutStatisticsResetHandler(const std::string& /*name*/,
+                                            const ConstElementPtr& /*params*/) {
+    resetCalloutStatistics();
+    return (createAnswer(CONTROL_RESULT_SUCCESS,
+                         "All callout statistics reset."));
+}
+
 // Perform conditional initialization if nothing is loaded.
 
 void
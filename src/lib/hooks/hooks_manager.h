@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #ifndef HOOKS_MANAGER_H
 #define HOOKS_MANAGER_H
 
+#include <cc/data.h>
 #include <hooks/server_hooks.h>
 #include <hooks/libinfo.h>
 
@@ -205,6 +206,44 @@ public:
     /// @return List of loaded libraries (names + parameters)
     static HookLibsCollection getLibraryInfo();
 
+    /// @brief Return the execution statistics of the callouts
+    ///
+    /// Returns the number of calls, of failed calls, the total and the
+    /// longest execution time of the callouts per hook point and per
+    /// library, as described in @ref CalloutManager::getStatistics. The
+    /// statistics are reset when the libraries are (re)loaded.
+    ///
+    /// @return Statistics of the callouts as a JSON map.
+    static isc::data::ConstElementPtr getCalloutStatistics();
+
+    /// @brief Reset the execution statistics of the callouts
+    static void resetCalloutStatistics();
+
+    /// @brief Handles callout-statistics-get command
+    ///
+    /// Returns the statistics of the callouts, see
+    /// @ref getCalloutStatistics. Params parameter is ignored.
+    ///
+    /// @param name name of the command (ignored, should be
+    ///        "callout-statistics-get")
+    /// @param params ignored
+    /// @return answer containing the statistics of the callouts
+    static isc::data::ConstElementPtr
+    calloutStatisticsGetHandler(const std::string& name,
+                                const isc::data::ConstElementPtr& params);
+
+    /// @brief Handles callout-statistics-reset command
+    ///
+    /// Resets the statistics of the callouts. Params parameter is ignored.
+    ///
+    /// @param name name of the command (ignored, should be
+    ///        "callout-statistics-reset")
+    /// @param params ignored
+    /// @return answer confirming success of this operation
+    static isc::data::ConstElementPtr
+    calloutStatisticsResetHandler(const std::string& name,
+                                  const isc::data::ConstElementPtr& params);
+
     /// @brief Validate library list
     ///
     /// For each library passed to it, checks that the library can be opened
@@ -475,6 +514,14 @@ private:
     /// @brief Return a collection of library names with parameters.
     HookLibsCollection getLibraryInfoInternal() const;
 
+    /// @brief Return the execution statistics of the callouts
+    ///
+    /// @return Statistics of the callouts as a JSON map.
+    isc::data::ConstElementPtr getCalloutStatisticsInternal();
+
+    /// @brief Reset the execution statistics of the callouts
+    void resetCalloutStatisticsInternal();
+
     //@}
 
     /// @brief Initialization to No Libraries
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -463,6 +463,72 @@ TEST_F(CalloutManagerTest, CallCalloutsError) {
     EXPECT_EQ(11223344, callout_value_);
 }
 
+// Test that the execution statistics of the callouts are recorded per hook
+// and per library.
+
+TEST_F(CalloutManagerTest, CalloutStatistics) {
+    getCalloutManager()->setLibraryIndex(0);
+    getCalloutManager()->registerCallout("alpha", callout_one);
+    getCalloutManager()->setLibraryIndex(1);
+    getCalloutManager()->registerCallout("alpha", callout_two);
+    getCalloutManager()->registerCallout("alpha", callout_two_error);
+    getCalloutManager()->setLibraryIndex(3);
+    getCalloutManager()->registerCallout("beta", callout_three);
+    getCalloutManager()->setLibraryIndex(INT_MAX);
+    getCalloutManager()->registerCallout("beta", callout_four);
+
+    getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    getCalloutManager()->callCallouts(beta_index_, getCalloutHandle());
+
+    CalloutManager::CalloutStatistics stats =
+        getCalloutManager()->getStatistics(alpha_index_, 0);
+    EXPECT_EQ(2, stats.calls_);
+    EXPECT_EQ(0, stats.errors_);
+    stats = getCalloutManager()->getStatistics(alpha_index_, 1);
+    EXPECT_EQ(4, stats.calls_);
+    EXPECT_EQ(2, stats.errors_);
+    EXPECT_LE(0, stats.max_usecs_);
+    EXPECT_LE(stats.max_usecs_, stats.total_usecs_);
+    stats = getCalloutManager()->getStatistics(beta_index_, 3);
+    EXPECT_EQ(1, stats.calls_);
+    stats = getCalloutManager()->getStatistics(beta_index_, INT_MAX);
+    EXPECT_EQ(1, stats.calls_);
+
+    // Hooks and libraries without calls have no statistics.
+    EXPECT_EQ(0, getCalloutManager()->getStatistics(gamma_index_, 0).calls_);
+    EXPECT_EQ(0, getCalloutManager()->getStatistics(alpha_index_, 2).calls_);
+    EXPECT_EQ(0, getCalloutManager()->getStatistics(-1, 0).calls_);
+
+    // Check the JSON form, the library names being given for the first
+    // two libraries only.
+    std::vector<std::string> names;
+    names.push_back("libfirst.so");
+    names.push_back("libsecond.so");
+    data::ConstElementPtr json = getCalloutManager()->getStatistics(names);
+    ASSERT_TRUE(json);
+    EXPECT_EQ(2, json->size());
+    ASSERT_TRUE(json->get("alpha"));
+    EXPECT_FALSE(json->get("gamma"));
+    ASSERT_TRUE(json->get("alpha")->get("server-pre"));
+    ASSERT_TRUE(json->get("alpha")->get("libfirst.so"));
+    data::ConstElementPtr first = json->get("alpha")->get("libfirst.so");
+    EXPECT_EQ(4, first->get("calls")->intValue());
+    EXPECT_EQ(2, first->get("errors")->intValue());
+    EXPECT_EQ(getCalloutManager()->getStatistics(alpha_index_, 1).total_usecs_,
+              first->get("total-usecs")->intValue());
+    EXPECT_EQ(getCalloutManager()->getStatistics(alpha_index_, 1).max_usecs_,
+              first->get("max-usecs")->intValue());
+    ASSERT_TRUE(json->get("beta"));
+    EXPECT_TRUE(json->get("beta")->get("library-3"));
+    EXPECT_TRUE(json->get("beta")->get("server-post"));
+
+    // Reset the statistics.
+    getCalloutManager()->resetStatistics();
+    EXPECT_EQ(0, getCalloutManager()->getStatistics(alpha_index_, 1).calls_);
+    EXPECT_EQ(0, getCalloutManager()->getStatistics(names)->size());
+}
+
 // Now test that we can deregister a single callout on a hook.
 
 TEST_F(CalloutManagerTest, DeregisterSingleCallout) {
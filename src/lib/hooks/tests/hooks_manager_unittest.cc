@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,7 @@
 #include <hooks/tests/common_test_class.h>
 #define TEST_ASYNC_CALLOUT
 #include <hooks/tests/test_libraries.h>
+#include <cc/command_interpreter.h>
 #include <cc/data.h>
 
 #include <boost/shared_ptr.hpp>
@@ -591,6 +592,46 @@ TEST_F(HooksManagerTest, NoLibrariesCallCallouts) {
     executeCallCallouts(-1, 3, -1, 22, -1, 83, -1);
 }
 
+// Check that the execution statistics of the callouts are returned and
+// reset by the commands.
+
+TEST_F(HooksManagerTest, CalloutStatistics) {
+    HooksManager::preCalloutsLibraryHandle().registerCallout("hookpt_two",
+                                                             testPreCallout);
+    HooksManager::postCalloutsLibraryHandle().registerCallout("hookpt_two",
+                                                              testPostCallout);
+    CalloutHandlePtr handle = HooksManager::createCalloutHandle();
+    HooksManager::callCallouts(hookpt_two_index_, *handle);
+    HooksManager::callCallouts(hookpt_two_index_, *handle);
+
+    ConstElementPtr stats = HooksManager::getCalloutStatistics();
+    ASSERT_TRUE(stats);
+    ASSERT_EQ(1, stats->size());
+    ASSERT_TRUE(stats->get("hookpt_two"));
+    ASSERT_TRUE(stats->get("hookpt_two")->get("server-pre"));
+    ASSERT_TRUE(stats->get("hookpt_two")->get("server-post"));
+    EXPECT_EQ(2, stats->get("hookpt_two")->get("server-pre")->get("calls")
+              ->intValue());
+
+    // The get command returns the same statistics.
+    int rcode = -1;
+    ConstElementPtr answer =
+        HooksManager::calloutStatisticsGetHandler("callout-statistics-get",
+                                                  ConstElementPtr());
+    ConstElementPtr args = isc::config::parseAnswer(rcode, answer);
+    EXPECT_EQ(isc::config::CONTROL_RESULT_SUCCESS, rcode);
+    ASSERT_TRUE(args);
+    EXPECT_TRUE(args->equals(*stats));
+
+    // The reset command removes them.
+    answer = HooksManager::
+        calloutStatisticsResetHandler("callout-statistics-reset",
+                                      ConstElementPtr());
+    isc::config::parseAnswer(rcode, answer);
+    EXPECT_EQ(isc::config::CONTROL_RESULT_SUCCESS, rcode);
+    EXPECT_EQ(0, HooksManager::getCalloutStatistics()->size());
+}
+
 // Test the encapsulation of the ServerHooks::registerHook() method.
 
 TEST_F(HooksManagerTest, RegisterHooks) {
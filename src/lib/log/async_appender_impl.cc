@@ -0,0 +1,179 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_appender_impl.h>
+#include <log/log_formatter.h>
+#include <log/log_messages.h>
+#include <log/logger_name.h>
+#include <log/message_dictionary.h>
+
+#include <log4cplus/loglevel.h>
+#include <log4cplus/version.h>
+#include <boost/bind.hpp>
+#include <boost/lexical_cast.hpp>
+
+using namespace isc::util::thread;
+
+namespace isc {
+namespace log {
+namespace internal {
+
+std::atomic<uint64_t> AsyncAppender::total_dropped_(0);
+
+AsyncAppender::AsyncAppender(const log4cplus::SharedAppenderPtr& appender,
+                             size_t capacity, bool drop)
+    : appender_(appender), ring_(capacity > 0 ? capacity : 1), head_(0),
+      count_(0), drop_(drop), dropped_(0), unreported_(0), stopping_(false),
+      mutex_(), not_empty_(), not_full_(), thread_() {
+    setName(appender_->getName());
+    thread_.reset(new Thread(boost::bind(&AsyncAppender::run, this)));
+}
+
+AsyncAppender::~AsyncAppender() {
+    try {
+        stop();
+        destructorImpl();
+    } catch (...) {
+        // Nothing can be done about it here.
+    }
+}
+
+void
+AsyncAppender::close() {
+    stop();
+    appender_->close();
+}
+
+size_t
+AsyncAppender::getDroppedCount() const {
+    Mutex::Locker lock(mutex_);
+    return (dropped_);
+}
+
+uint64_t
+AsyncAppender::getTotalDroppedCount() {
+    return (total_dropped_.load());
+}
+
+void
+AsyncAppender::append(const log4cplus::spi::InternalLoggingEvent& event) {
+    // The clone holds the formatted message and the original timestamp,
+    // so it can be written later by the writer thread.
+#if LOG4CPLUS_VERSION < LOG4CPLUS_MAKE_VERSION(2, 0, 0)
+    std::auto_ptr<log4cplus::spi::InternalLoggingEvent>
+#else
+    std::unique_ptr<log4cplus::spi::InternalLoggingEvent>
+#endif
+        event_aptr = event.clone();
+    LogEventPtr event_ptr(event_aptr.release());
+
+    {
+        Mutex::Locker lock(mutex_);
+        while (!stopping_ && (count_ == ring_.size())) {
+            if (drop_) {
+                ++dropped_;
+                ++unreported_;
+                ++total_dropped_;
+                return;
+            }
+            not_full_.wait(mutex_);
+        }
+
+        if (!stopping_) {
+            ring_[(head_ + count_) % ring_.size()] = event_ptr;
+            ++count_;
+            not_empty_.signal();
+            return;
+        }
+
+        // There is no signal waking all waiting threads, so pass the
+        // wake-up on to the next thread which may wait for room.
+        not_full_.signal();
+    }
+
+    // The writer thread is gone: write the event directly.
+    appender_->doAppend(*event_ptr);
+}
+
+void
+AsyncAppender::run() {
+    for (;;) {
+        LogEventPtr event_ptr;
+        size_t unreported = 0;
+        {
+            Mutex::Locker lock(mutex_);
+            while (!stopping_ && (count_ == 0)) {
+                not_empty_.wait(mutex_);
+            }
+            if (count_ == 0) {
+                // Stopping and everything has been written.
+                unreported = unreported_;
+                unreported_ = 0;
+                if (unreported == 0) {
+                    return;
+                }
+            } else {
+                event_ptr.swap(ring_[head_]);
+                head_ = (head_ + 1) % ring_.size();
+                --count_;
+                not_full_.signal();
+                // Report the dropped events when the ring has been drained.
+                if (count_ == 0) {
+                    unreported = unreported_;
+                    unreported_ = 0;
+                }
+            }
+        }
+
+        // Write outside of the lock so as the logging threads can store
+        // further events in the meantime.
+        try {
+            if (event_ptr) {
+                appender_->doAppend(*event_ptr);
+            }
+            if (unreported > 0) {
+                reportDropped(unreported);
+            }
+        } catch (...) {
+            // There is nowhere to report the failure to.
+        }
+    }
+}
+
+void
+AsyncAppender::stop() {
+    if (!thread_) {
+        return;
+    }
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = true;
+        not_empty_.signal();
+        not_full_.signal();
+    }
+    thread_->wait();
+    thread_.reset();
+}
+
+void
+AsyncAppender::reportDropped(size_t count) {
+    // This is written directly to the wrapped appender rather than logged
+    // as the logging threads may be waiting for this thread.
+    std::string message(std::string(LOG_ASYNC_DROPPED) + " " +
+                        MessageDictionary::globalDictionary()->
+                        getText(LOG_ASYNC_DROPPED));
+    replacePlaceholder(&message, boost::lexical_cast<std::string>(count), 1);
+    log4cplus::spi::InternalLoggingEvent event(getRootLoggerName(),
+                                               log4cplus::WARN_LOG_LEVEL,
+                                               message, __FILE__, __LINE__);
+    appender_->doAppend(event);
+}
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
@@ -0,0 +1,142 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LOG_ASYNC_APPENDER_H
+#define LOG_ASYNC_APPENDER_H
+
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <log4cplus/appender.h>
+#include <log4cplus/spi/loggingevent.h>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace log {
+namespace internal {
+
+/// \brief Asynchronous Appender
+///
+/// This class wraps another appender (console, file or syslog) and
+/// moves the actual output to a separate thread. A call to append()
+/// only stores a copy of the event, which holds the already formatted
+/// message and its timestamp, in a bounded ring buffer. The writer
+/// thread takes the events from the ring and passes them to the wrapped
+/// appender, so a slow disk or a stalled syslog socket no longer delays
+/// the thread which logged the message.
+///
+/// When the ring is full the appender either blocks the logging thread
+/// until there is room, or drops the event and counts it. The writer
+/// thread reports the number of dropped events with the
+/// LOG_ASYNC_DROPPED message written directly to the wrapped appender.
+///
+/// The events still in the ring are written when the appender is closed
+/// or destroyed, e.g. when logging is reconfigured.
+class AsyncAppender : public log4cplus::Appender {
+public:
+    /// \brief Constructor
+    ///
+    /// Starts the writer thread.
+    ///
+    /// \param appender Appender to which the events are written.
+    /// \param capacity Maximum number of events waiting to be written.
+    /// A zero value is replaced with 1.
+    /// \param drop true if the events should be dropped when the ring is
+    /// full, false if the logging thread should wait.
+    AsyncAppender(const log4cplus::SharedAppenderPtr& appender,
+                  size_t capacity, bool drop);
+
+    /// \brief Destructor
+    ///
+    /// Writes the events still in the ring and stops the writer thread.
+    virtual ~AsyncAppender();
+
+    /// \brief Close the appender
+    ///
+    /// Writes the events still in the ring, stops the writer thread and
+    /// closes the wrapped appender.
+    virtual void close();
+
+    /// \brief Returns the total number of dropped events.
+    size_t getDroppedCount() const;
+
+    /// \brief Returns the number of events dropped by all the appenders.
+    ///
+    /// The count covers the whole life of the process, including the
+    /// appenders replaced by a reconfiguration.
+    static uint64_t getTotalDroppedCount();
+
+protected:
+    /// \brief Store the event in the ring
+    ///
+    /// \param event The event to be written by the writer thread.
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event);
+
+private:
+    /// \brief Pointer to a stored event.
+    typedef boost::shared_ptr<log4cplus::spi::InternalLoggingEvent> LogEventPtr;
+
+    /// \brief Number of events dropped by all the appenders.
+    static std::atomic<uint64_t> total_dropped_;
+
+    /// \brief Body of the writer thread.
+    void run();
+
+    /// \brief Stops the writer thread after the ring has been drained.
+    void stop();
+
+    /// \brief Writes the LOG_ASYNC_DROPPED event to the wrapped appender.
+    ///
+    /// \param count Number of events dropped since the last report.
+    void reportDropped(size_t count);
+
+    /// \brief Appender to which the events are written.
+    log4cplus::SharedAppenderPtr appender_;
+
+    /// \brief Ring of events waiting to be written.
+    std::vector<LogEventPtr> ring_;
+
+    /// \brief Index of the oldest event in the ring.
+    size_t head_;
+
+    /// \brief Number of events in the ring.
+    size_t count_;
+
+    /// \brief Drop events when the ring is full instead of waiting.
+    const bool drop_;
+
+    /// \brief Total number of dropped events.
+    size_t dropped_;
+
+    /// \brief Number of events dropped since the last report.
+    size_t unreported_;
+
+    /// \brief Indicates that the writer thread should exit.
+    bool stopping_;
+
+    /// \brief Mutex protecting the ring and the counters.
+    mutable isc::util::thread::Mutex mutex_;
+
+    /// \brief Signalled when an event is stored or on stop.
+    isc::util::thread::CondVar not_empty_;
+
+    /// \brief Signalled when an event is taken from the ring.
+    isc::util::thread::CondVar not_full_;
+
+    /// \brief The writer thread.
+    boost::scoped_ptr<isc::util::thread::Thread> thread_;
+};
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
+
+#endif // LOG_ASYNC_APPENDER_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,9 @@
 #include <log/log_formatter.h>
 
 #include <cassert>
+#include <cctype>
+#include <cstring>
+#include <vector>
 
 #ifdef ENABLE_LOGGER_CHECKS
 #include <iostream>
@@ -65,5 +68,94 @@ checkExcessPlaceholders(string* message, unsigned int placeholder) {
     }
 }
 
+void
+checkPlaceholder(const string& message, const unsigned placeholder) {
+#ifdef ENABLE_LOGGER_CHECKS
+    const string mark("%" + lexical_cast<string>(placeholder));
+    if (message.find(mark) == string::npos) {
+        isc_throw(MismatchedPlaceholders,
+                  "Missing logger placeholder in message: " << message);
+    }
+#else
+    static_cast<void>(message);
+    static_cast<void>(placeholder);
+#endif /* ENABLE_LOGGER_CHECKS */
+}
+
+void
+formatMessage(string* message, const string& args, const unsigned count) {
+    // Locate the arguments in the buffer. Messages rarely have more than
+    // a few arguments, so avoid allocating for them.
+    struct Argument {
+        const char* text_;
+        size_t len_;
+        bool used_;
+    };
+    const unsigned MAX_INLINE_ARGUMENTS = 16;
+    Argument inline_values[MAX_INLINE_ARGUMENTS];
+    vector<Argument> more_values;
+    Argument* values = inline_values;
+    if (count > MAX_INLINE_ARGUMENTS) {
+        more_values.resize(count);
+        values = &more_values[0];
+    }
+    size_t offset = 0;
+    for (unsigned i = 0; i < count; ++i) {
+        memcpy(&values[i].len_, args.data() + offset, sizeof(size_t));
+        offset += sizeof(size_t);
+        values[i].text_ = args.data() + offset;
+        values[i].used_ = false;
+        offset += values[i].len_;
+    }
+
+    // Copy the message replacing the placeholders for which there is an
+    // argument. Other percent signs and placeholders are kept as they are.
+    const string& text = *message;
+    string result;
+    result.reserve(text.size() + offset);
+    bool excess = false;
+    size_t copied = 0;
+    for (size_t pos = text.find('%'); pos != string::npos;
+         pos = text.find('%', pos)) {
+        size_t end = pos + 1;
+        unsigned placeholder = 0;
+        while ((end < text.size()) && isdigit(text[end]) &&
+               (placeholder <= count)) {
+            placeholder = placeholder * 10 + (text[end] - '0');
+            ++end;
+        }
+        if ((placeholder == 0) || (placeholder > count)) {
+            if ((end > pos + 1) && (placeholder == count + 1)) {
+                excess = true;
+            }
+            pos = end;
+            continue;
+        }
+        result.append(text, copied, pos - copied);
+        Argument& value = values[placeholder - 1];
+        result.append(value.text_, value.len_);
+        value.used_ = true;
+        copied = pos = end;
+    }
+    result.append(text, copied, string::npos);
+
+    // Complain about the arguments without a placeholder, as the
+    // replacePlaceholder does. With the logger checks enabled this has
+    // already been reported by checkPlaceholder.
+    for (unsigned i = 1; i <= count; ++i) {
+        if (!values[i - 1].used_) {
+            result.append(" @@Missing placeholder %" +
+                          lexical_cast<string>(i) + " for '");
+            result.append(values[i - 1].text_, values[i - 1].len_);
+            result.append("'@@");
+        }
+    }
+
+    message->swap(result);
+    if (excess) {
+        checkExcessPlaceholders(message, count + 1);
+    }
+}
+
 }
 }
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #define LOG_FORMATTER_H
 
 #include <cstddef>
+#include <cstring>
 #include <string>
 #include <iostream>
 
@@ -62,6 +63,53 @@ void
 replacePlaceholder(std::string* message, const std::string& replacement,
                    const unsigned placeholder);
 
+///
+/// \brief Internal argument store routine
+///
+/// This is used internally by the Formatter. Appends an argument to the
+/// buffer holding the arguments of a message, prefixed by its length, so
+/// as all arguments are kept in a single string until the message is
+/// output.
+///
+/// \param args The buffer holding the arguments.
+/// \param arg Pointer to the text of the argument.
+/// \param len Length of the text of the argument.
+inline void
+appendArgument(std::string* args, const char* arg, const size_t len) {
+    if (args->empty()) {
+        // Enough for the arguments of most messages.
+        args->reserve(256);
+    }
+    args->append(reinterpret_cast<const char*>(&len), sizeof(len));
+    args->append(arg, len);
+}
+
+///
+/// \brief Internal placeholder check routine
+///
+/// This is used internally by the Formatter for each argument. When the
+/// logger checks are enabled, throws MismatchedPlaceholders if the
+/// placeholder is not in the message. Does nothing otherwise.
+void
+checkPlaceholder(const std::string& message, const unsigned placeholder);
+
+///
+/// \brief The internal formatting routine
+///
+/// This is used internally by the Formatter when the message is output.
+/// Replaces the placeholders %1 to %count by the arguments stored with
+/// \c appendArgument in a single pass over the message, then adds the
+/// same complaints as \c replacePlaceholder and
+/// \c checkExcessPlaceholders for the arguments without a placeholder
+/// and for the first unused placeholder.
+///
+/// \param message The message with placeholders, replaced by the result.
+/// \param args The buffer holding the arguments.
+/// \param count The number of arguments in the buffer.
+void
+formatMessage(std::string* message, const std::string& args,
+              const unsigned count);
+
 ///
 /// \brief The log message formatter
 ///
@@ -84,6 +132,14 @@ replacePlaceholder(std::string* message, const std::string& replacement,
 /// Of course, if the logging is turned off, we don't bother with any replacing
 /// and just return.
 ///
+/// The arguments are not substituted one by one as the .arg calls are made:
+/// each of them is converted to text and appended to a single buffer, and
+/// the message is formatted once, in a single pass, when it is output. So
+/// a message with several arguments costs one scan of the message text
+/// rather than one scan and one copy per argument. A consequence is that
+/// a placeholder contained in an argument is never replaced, whatever the
+/// order of the .arg calls.
+///
 /// User of logging code should not really care much about this class, only
 /// call the .arg method to generate the correct output.
 ///
@@ -115,6 +171,11 @@ private:
     /// \brief Which will be the next placeholder to replace
     unsigned nextPlaceholder_;
 
+    /// \brief The arguments waiting to be placed into the message
+    ///
+    /// Mutable as it is moved to the formatter taking over the output.
+    mutable std::string args_;
+
 
 public:
     /// \brief Constructor of "active" formatter
@@ -134,7 +195,7 @@ public:
     Formatter(const Severity& severity = NONE, std::string* message = NULL,
               Logger* logger = NULL) :
         logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0)
+        nextPlaceholder_(0), args_()
     {
     }
 
@@ -145,8 +206,10 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_)
+        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_),
+        args_()
     {
+        args_.swap(other.args_);
         other.logger_ = NULL;
     }
 
@@ -156,7 +219,7 @@ public:
     ~ Formatter() {
         if (logger_) {
             try {
-                checkExcessPlaceholders(message_, ++nextPlaceholder_);
+                formatMessage(message_, args_, nextPlaceholder_);
                 logger_->output(severity_, *message_);
             } catch (...) {
                 // Catch and ignore all exceptions here.
@@ -175,17 +238,18 @@ public:
             severity_ = other.severity_;
             message_ = other.message_;
             nextPlaceholder_ = other.nextPlaceholder_;
+            args_.clear();
+            args_.swap(other.args_);
             other.logger_ = NULL;
         }
 
         return *this;
     }
 
-    /// \brief Replaces another placeholder
+    /// \brief Adds another argument
     ///
-    /// Replaces another placeholder and returns a new formatter with it.
-    /// Deactivates the current formatter. In case the formatter is not active,
-    /// only produces another inactive formatter.
+    /// Converts the value to text and stores it for the next placeholder.
+    /// In case the formatter is not active, the value is not converted.
     ///
     /// \param value The argument to place into the placeholder.
     template<class Arg> Formatter& arg(const Arg& value) {
@@ -216,31 +280,31 @@ public:
     ///
     /// \param arg The text to place into the placeholder.
     Formatter& arg(const std::string& arg) {
+        return (addArgument(arg.data(), arg.size()));
+    }
+
+    /// \brief C string version of arg.
+    ///
+    /// Avoids the construction of a temporary string.
+    ///
+    /// \param arg The text to place into the placeholder.
+    Formatter& arg(const char* arg) {
         if (logger_) {
-            // Note that this method does a replacement and returns the
-            // modified string. If there are multiple invocations of arg() (e.g.
-            // logger.info(msgid).arg(xxx).arg(yyy)...), each invocation
-            // operates on the string returned by the previous one. This
-            // sequential operation means that if we had a message like "%1 %2",
-            // and called .arg("%2").arg(42), we would get "42 42"; the first
-            // call replaces the %1" with "%2" and the second replaces all
-            // occurrences of "%2" with 42. (Conversely, the sequence
-            // .arg(42).arg("%1") would return "42 %1" - there are no recursive
-            // replacements).
-            try {
-                replacePlaceholder(message_, arg, ++nextPlaceholder_ );
-            }
-            catch (...) {
-                // Something went wrong here, the log message is broken, so
-                // we don't want to output it, nor we want to check all the
-                // placeholders were used (because they won't be).
-                deactivate();
-                throw;
-            }
+            return (addArgument(arg, std::strlen(arg)));
         }
         return (*this);
     }
 
+    /// \brief Character array version of arg.
+    ///
+    /// Makes sure string literals are not converted to pointers and
+    /// passed to the generic version.
+    ///
+    /// \param arg The text to place into the placeholder.
+    template<size_t N> Formatter& arg(const char (&arg)[N]) {
+        return (this->arg(static_cast<const char*>(arg)));
+    }
+
     /// \brief Turn off the output of this logger.
     ///
     /// If the logger would output anything at the end, now it won't.
@@ -256,6 +320,30 @@ public:
             logger_ = NULL;
         }
     }
+
+private:
+    /// \brief Stores another argument.
+    ///
+    /// The argument is only stored, the placeholder is replaced when the
+    /// message is output.
+    ///
+    /// \param arg Pointer to the text to place into the placeholder.
+    /// \param len Length of the text.
+    Formatter& addArgument(const char* arg, const size_t len) {
+        if (logger_) {
+            try {
+                checkPlaceholder(*message_, ++nextPlaceholder_);
+            } catch (...) {
+                // Something went wrong here, the log message is broken, so
+                // we don't want to output it, nor we want to check all the
+                // placeholders were used (because they won't be).
+                deactivate();
+                throw;
+            }
+            appendArgument(&args_, arg, len);
+        }
+        return (*this);
+    }
 };
 
 }
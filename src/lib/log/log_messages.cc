@@ -1,4 +1,4 @@
-// File created from log_messages.mes on Tue Jan 24 2017 20:17
+// File created from log_messages.mes on Sun Oct 18 2026 17:08
 
 #include <config.h>
 
@@ -9,7 +9,9 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_DROPPED = "LOG_ASYNC_DROPPED";
 extern const isc::log::MessageID LOG_BAD_DESTINATION = "LOG_BAD_DESTINATION";
+extern const isc::log::MessageID LOG_BAD_QUEUE_OVERFLOW = "LOG_BAD_QUEUE_OVERFLOW";
 extern const isc::log::MessageID LOG_BAD_SEVERITY = "LOG_BAD_SEVERITY";
 extern const isc::log::MessageID LOG_BAD_STREAM = "LOG_BAD_STREAM";
 extern const isc::log::MessageID LOG_DUPLICATE_MESSAGE_ID = "LOG_DUPLICATE_MESSAGE_ID";
@@ -25,6 +27,7 @@ extern const isc::log::MessageID LOG_NO_SUCH_MESSAGE = "LOG_NO_SUCH_MESSAGE";
 extern const isc::log::MessageID LOG_OPEN_OUTPUT_FAIL = "LOG_OPEN_OUTPUT_FAIL";
 extern const isc::log::MessageID LOG_PREFIX_EXTRA_ARGS = "LOG_PREFIX_EXTRA_ARGS";
 extern const isc::log::MessageID LOG_PREFIX_INVALID_ARG = "LOG_PREFIX_INVALID_ARG";
+extern const isc::log::MessageID LOG_RATE_LIMITED = "LOG_RATE_LIMITED";
 extern const isc::log::MessageID LOG_READING_LOCAL_FILE = "LOG_READING_LOCAL_FILE";
 extern const isc::log::MessageID LOG_READ_ERROR = "LOG_READ_ERROR";
 extern const isc::log::MessageID LOG_UNRECOGNIZED_DIRECTIVE = "LOG_UNRECOGNIZED_DIRECTIVE";
@@ -36,7 +39,9 @@ extern const isc::log::MessageID LOG_WRITE_ERROR = "LOG_WRITE_ERROR";
 namespace {
 
 const char* values[] = {
+    "LOG_ASYNC_DROPPED", "%1 log messages were dropped because the asynchronous logging queue was full",
     "LOG_BAD_DESTINATION", "unrecognized log destination: %1",
+    "LOG_BAD_QUEUE_OVERFLOW", "unrecognized asynchronous logging queue overflow policy: %1",
     "LOG_BAD_SEVERITY", "unrecognized log severity: %1",
     "LOG_BAD_STREAM", "bad log console output stream: %1",
     "LOG_DUPLICATE_MESSAGE_ID", "duplicate message ID (%1) in compiled code",
@@ -52,6 +57,7 @@ const char* values[] = {
     "LOG_OPEN_OUTPUT_FAIL", "unable to open %1 for output: %2",
     "LOG_PREFIX_EXTRA_ARGS", "line %1: $PREFIX directive has too many arguments",
     "LOG_PREFIX_INVALID_ARG", "line %1: $PREFIX directive has an invalid argument ('%2')",
+    "LOG_RATE_LIMITED", "%1 %2 messages were suppressed by the logging rate limit",
     "LOG_READING_LOCAL_FILE", "reading local message file %1",
     "LOG_READ_ERROR", "error reading from message file %1: %2",
     "LOG_UNRECOGNIZED_DIRECTIVE", "line %1: unrecognized directive '%2'",
@@ -1,4 +1,4 @@
-// File created from log_messages.mes on Thu Jul  7 15:32:06 2011
+// File created from log_messages.mes on Sun Oct 18 2026 17:08
 
 #ifndef LOG_MESSAGES_H
 #define LOG_MESSAGES_H
@@ -8,7 +8,9 @@
 namespace isc {
 namespace log {
 
+extern const isc::log::MessageID LOG_ASYNC_DROPPED;
 extern const isc::log::MessageID LOG_BAD_DESTINATION;
+extern const isc::log::MessageID LOG_BAD_QUEUE_OVERFLOW;
 extern const isc::log::MessageID LOG_BAD_SEVERITY;
 extern const isc::log::MessageID LOG_BAD_STREAM;
 extern const isc::log::MessageID LOG_DUPLICATE_MESSAGE_ID;
@@ -24,6 +26,7 @@ extern const isc::log::MessageID LOG_NO_SUCH_MESSAGE;
 extern const isc::log::MessageID LOG_OPEN_OUTPUT_FAIL;
 extern const isc::log::MessageID LOG_PREFIX_EXTRA_ARGS;
 extern const isc::log::MessageID LOG_PREFIX_INVALID_ARG;
+extern const isc::log::MessageID LOG_RATE_LIMITED;
 extern const isc::log::MessageID LOG_READING_LOCAL_FILE;
 extern const isc::log::MessageID LOG_READ_ERROR;
 extern const isc::log::MessageID LOG_UNRECOGNIZED_DIRECTIVE;
@@ -0,0 +1,202 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/log_rate_limiter.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <chrono>
+#include <limits>
+
+using namespace isc::util::thread;
+
+namespace isc {
+namespace log {
+
+LogRateLimiter&
+LogRateLimiter::instance() {
+    // Never destroyed as static loggers may log during the exit.
+    static LogRateLimiter* limiter(new LogRateLimiter());
+    return (*limiter);
+}
+
+LogRateLimiter::LogRateLimiter()
+    : limits_(), enabled_(false), generation_(1), mutex_() {
+}
+
+void
+LogRateLimiter::changed() {
+    enabled_.store(!limits_.empty());
+    ++generation_;
+}
+
+void
+LogRateLimiter::setLimit(const std::string& logger, const unsigned limit,
+                         const unsigned interval) {
+    Mutex::Locker lock(mutex_);
+    if (limit == 0) {
+        limits_.erase(logger);
+    } else {
+        limits_[logger].reset(new Limit(limit, interval));
+    }
+    changed();
+}
+
+void
+LogRateLimiter::clear() {
+    Mutex::Locker lock(mutex_);
+    limits_.clear();
+    changed();
+}
+
+void
+LogRateLimiter::flush(LoggerReports& reports, const int64_t now) {
+    Mutex::Locker lock(mutex_);
+    for (std::map<std::string, LimitPtr>::const_iterator it = limits_.begin();
+         it != limits_.end(); ++it) {
+        Reports limit_reports;
+        it->second->flush(limit_reports, now);
+        if (!limit_reports.empty()) {
+            reports.push_back(std::make_pair(it->first, limit_reports));
+        }
+    }
+}
+
+LogRateLimiter::LimitPtr
+LogRateLimiter::getLimit(const std::string& logger) const {
+    Mutex::Locker lock(mutex_);
+
+    // Use the limit of the logger or of its closest ancestor.
+    std::map<std::string, LimitPtr>::const_iterator it = limits_.find(logger);
+    for (size_t dot = logger.rfind('.');
+         (it == limits_.end()) && (dot != std::string::npos);
+         dot = (dot > 0 ? logger.rfind('.', dot - 1) : std::string::npos)) {
+        it = limits_.find(logger.substr(0, dot));
+    }
+    return (it != limits_.end() ? it->second : LimitPtr());
+}
+
+int64_t
+LogRateLimiter::now() {
+    return (std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+LogRateLimiter::Limit::Limit(const unsigned limit, const unsigned interval)
+    : limit_(limit), interval_(interval > 0 ? interval : 1),
+      next_check_(std::numeric_limits<int64_t>::min()), counters_(),
+      mutex_() {
+}
+
+bool
+LogRateLimiter::Limit::admit(const MessageID& ident, const Severity& severity,
+                             Reports& reports, const int64_t now) {
+    Mutex::Locker lock(mutex_);
+
+    // Remove the counters which interval is over, reporting what they
+    // suppressed, so as the counts are not lost when a storm stops.
+    if (now >= next_check_) {
+        expire(reports, now);
+    }
+
+    std::map<MessageID, Counter>::iterator counter = counters_.find(ident);
+    if (counter == counters_.end()) {
+        Counter first = { now, 1, 0, severity };
+        counters_.insert(std::make_pair(ident, first));
+        return (true);
+    }
+
+    Counter& c = counter->second;
+    if (c.admitted_ < limit_) {
+        ++c.admitted_;
+        return (true);
+    }
+    ++c.suppressed_;
+    c.severity_ = severity;
+    return (false);
+}
+
+void
+LogRateLimiter::Limit::flush(Reports& reports, const int64_t now) {
+    Mutex::Locker lock(mutex_);
+    if (now >= next_check_) {
+        expire(reports, now);
+    }
+}
+
+void
+LogRateLimiter::Limit::expire(Reports& reports, const int64_t now) {
+    next_check_ = now + 1;
+    for (std::map<MessageID, Counter>::iterator c = counters_.begin();
+         c != counters_.end(); ) {
+        if (now - c->second.start_ < static_cast<int64_t>(interval_)) {
+            ++c;
+            continue;
+        }
+        if (c->second.suppressed_ > 0) {
+            Report report = { c->first, c->second.severity_,
+                              c->second.suppressed_ };
+            reports.push_back(report);
+        }
+        counters_.erase(c++);
+    }
+}
+
+void
+LogRateLimiter::parse(const std::string& text, unsigned& limit,
+                      unsigned& interval) {
+    const size_t slash = text.find('/');
+    if ((slash == std::string::npos) || (slash == 0) ||
+        (slash + 1 == text.size())) {
+        isc_throw(BadValue, "invalid rate limit '" << text
+                  << "', expected <count>/<interval> e.g. 100/s");
+    }
+
+    unsigned multiplier = 0;
+    switch (text[text.size() - 1]) {
+    case 's':
+        multiplier = 1;
+        break;
+    case 'm':
+        multiplier = 60;
+        break;
+    case 'h':
+        multiplier = 3600;
+        break;
+    default:
+        isc_throw(BadValue, "invalid rate limit '" << text
+                  << "', the interval unit must be s, m or h");
+    }
+
+    const std::string digits("0123456789");
+    const std::string limit_text = text.substr(0, slash);
+    const std::string count_text = text.substr(slash + 1,
+                                               text.size() - slash - 2);
+    try {
+        if ((limit_text.find_first_not_of(digits) != std::string::npos) ||
+            (count_text.find_first_not_of(digits) != std::string::npos)) {
+            throw boost::bad_lexical_cast();
+        }
+        limit = boost::lexical_cast<unsigned>(limit_text);
+        const unsigned count = (count_text.empty() ? 1 :
+                                boost::lexical_cast<unsigned>(count_text));
+        if ((limit == 0) || (count == 0) ||
+            (count > std::numeric_limits<unsigned>::max() / multiplier)) {
+            throw boost::bad_lexical_cast();
+        }
+        interval = count * multiplier;
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(BadValue, "invalid rate limit '" << text
+                  << "', the count and the interval must be positive"
+                  " integers");
+    }
+}
+
+} // namespace log
+} // namespace isc
@@ -0,0 +1,238 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LOG_RATE_LIMITER_H
+#define LOG_RATE_LIMITER_H
+
+#include <log/logger_level.h>
+#include <log/message_types.h>
+#include <util/threads/sync.h>
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+#include <stdint.h>
+
+namespace isc {
+namespace log {
+
+/// \brief Log Rate Limiter
+///
+/// Limits the number of messages with the same message ID a logger
+/// outputs in a time interval. In a packet storm the same message (e.g. a
+/// packet drop) can be logged hundreds of thousands of times per minute,
+/// and writing them makes the overload worse.
+///
+/// A limit is set for a logger (e.g. "kea-dhcp4.packets") and applies to
+/// its children, unless they have their own limit, independently for each
+/// message ID: with a limit of 100 messages per second, each message ID
+/// can be output 100 times per second by the logger. The messages over the
+/// limit are counted, and the counts are reported once their interval is
+/// over, with the next message output through the limit whatever its ID,
+/// so as the logger can output a summary. As no message may follow a
+/// storm, the servers also flush the counts periodically (see
+/// \ref flush).
+///
+/// The limiter is global and is configured by the logger manager from the
+/// logger specifications. The loggers look up the limit applying to them
+/// once and keep it until the limits are changed, which they detect by a
+/// change of the generation number. When no limit is set, the check made
+/// by the loggers is a single test of an atomic flag.
+class LogRateLimiter : public boost::noncopyable {
+public:
+    /// \brief Number of messages suppressed to be reported.
+    struct Report {
+        /// \brief Message ID of the suppressed messages.
+        MessageID ident_;
+
+        /// \brief Severity of the last suppressed message.
+        Severity severity_;
+
+        /// \brief Number of suppressed messages.
+        uint64_t suppressed_;
+    };
+
+    /// \brief Collection of reports.
+    typedef std::vector<Report> Reports;
+
+    /// \brief Collection of reports by logger name.
+    typedef std::vector<std::pair<std::string, Reports> > LoggerReports;
+
+    /// \brief Limit of a logger and of its children.
+    ///
+    /// It holds the counters of the message IDs, protected by its own
+    /// mutex, so as the loggers having different limits don't contend.
+    class Limit : public boost::noncopyable {
+    public:
+        /// \brief Constructor.
+        ///
+        /// \param limit Maximum number of messages with the same ID output
+        /// in an interval.
+        /// \param interval Length of the interval in seconds, at least 1.
+        Limit(const unsigned limit, const unsigned interval);
+
+        /// \brief Checks if a message may be output.
+        ///
+        /// At most once a second, the counters which interval is over are
+        /// removed and the messages they suppressed are reported.
+        ///
+        /// \param ident Message ID. The message IDs are compared by address,
+        /// which is the case for the IDs defined by the message compiler.
+        /// \param severity Severity of the message.
+        /// \param [out] reports Numbers of messages suppressed in the
+        /// intervals which are over, to be output.
+        /// \param now Current time in seconds.
+        ///
+        /// \return false if the limit has been reached, true otherwise.
+        bool admit(const MessageID& ident, const Severity& severity,
+                   Reports& reports, const int64_t now);
+
+        /// \brief Reports the messages suppressed in the intervals which
+        /// are over.
+        ///
+        /// This makes the same check as \ref admit, at most once a second,
+        /// without a message going through the limit.
+        ///
+        /// \param [out] reports Numbers of messages suppressed in the
+        /// intervals which are over, to be output.
+        /// \param now Current time in seconds.
+        void flush(Reports& reports, const int64_t now);
+
+    private:
+        /// \brief Removes the counters which interval is over.
+        ///
+        /// Must be called with the mutex locked.
+        ///
+        /// \param [out] reports Numbers of messages suppressed by the
+        /// removed counters.
+        /// \param now Current time in seconds.
+        void expire(Reports& reports, const int64_t now);
+
+        /// \brief Counters of a message ID.
+        struct Counter {
+            /// \brief Start of the current interval.
+            int64_t start_;
+
+            /// \brief Messages admitted in the current interval.
+            unsigned admitted_;
+
+            /// \brief Messages suppressed in the current interval.
+            uint64_t suppressed_;
+
+            /// \brief Severity of the last suppressed message.
+            Severity severity_;
+        };
+
+        /// \brief Maximum number of messages per interval.
+        const unsigned limit_;
+
+        /// \brief Length of the interval in seconds.
+        const unsigned interval_;
+
+        /// \brief Time of the next check of the counters.
+        int64_t next_check_;
+
+        /// \brief Counters by message ID.
+        std::map<MessageID, Counter> counters_;
+
+        /// \brief Mutex protecting the counters.
+        isc::util::thread::Mutex mutex_;
+    };
+
+    /// \brief Pointer to a limit.
+    typedef boost::shared_ptr<Limit> LimitPtr;
+
+    /// \brief Returns the global rate limiter.
+    static LogRateLimiter& instance();
+
+    /// \brief Checks if any limit is set.
+    bool isEnabled() const {
+        return (enabled_.load());
+    }
+
+    /// \brief Returns the generation of the limits.
+    ///
+    /// It changes each time a limit is set or removed.
+    unsigned getGeneration() const {
+        return (generation_.load());
+    }
+
+    /// \brief Sets the limit for a logger.
+    ///
+    /// \param logger Full name of the logger (including the root name).
+    /// \param limit Maximum number of messages with the same ID output in
+    /// an interval. Zero removes the limit of the logger.
+    /// \param interval Length of the interval in seconds, at least 1.
+    void setLimit(const std::string& logger, const unsigned limit,
+                  const unsigned interval = 1);
+
+    /// \brief Removes all limits and counters.
+    void clear();
+
+    /// \brief Returns the limit applying to a logger.
+    ///
+    /// This is the limit of the logger or of its closest ancestor.
+    ///
+    /// \param logger Full name of the logger.
+    /// \return Pointer to the limit, null if the logger is not limited.
+    LimitPtr getLimit(const std::string& logger) const;
+
+    /// \brief Reports the messages suppressed in the intervals which are
+    /// over by all limits.
+    ///
+    /// \param [out] reports Numbers of suppressed messages, with the names
+    /// of the loggers having the limits.
+    /// \param now Current time in seconds.
+    void flush(LoggerReports& reports, const int64_t now);
+
+    /// \brief Returns the current time in seconds from the monotonic clock.
+    static int64_t now();
+
+    /// \brief Parses a rate limit.
+    ///
+    /// The text is a number of messages, a slash and an interval given as
+    /// an optional number followed by a unit: "s" for seconds, "m" for
+    /// minutes or "h" for hours, e.g. "100/s" or "1000/10m".
+    ///
+    /// \param text Rate limit to parse.
+    /// \param [out] limit Number of messages.
+    /// \param [out] interval Interval in seconds.
+    ///
+    /// \throw isc::BadValue if the text is not a valid rate limit.
+    static void parse(const std::string& text, unsigned& limit,
+                      unsigned& interval);
+
+private:
+    /// \brief Constructor, use instance().
+    LogRateLimiter();
+
+    /// \brief Updates the flag and the generation after a change.
+    ///
+    /// Must be called with the mutex locked.
+    void changed();
+
+    /// \brief Limits by logger name.
+    std::map<std::string, LimitPtr> limits_;
+
+    /// \brief Indicates whether any limit is set.
+    std::atomic<bool> enabled_;
+
+    /// \brief Generation of the limits.
+    std::atomic<unsigned> generation_;
+
+    /// \brief Mutex protecting the limits.
+    mutable isc::util::thread::Mutex mutex_;
+};
+
+} // namespace log
+} // namespace isc
+
+#endif // LOG_RATE_LIMITER_H
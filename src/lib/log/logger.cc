@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,8 @@
 #include <stdarg.h>
 #include <stdio.h>
 
+#include <log/log_messages.h>
+#include <log/log_rate_limiter.h>
 #include <log/logger.h>
 #include <log/logger_impl.h>
 #include <log/logger_name.h>
@@ -134,9 +136,59 @@ Logger::output(const Severity& severity, const std::string& message) {
     getLoggerPtr()->outputRaw(severity, message);
 }
 
+// Apply the rate limit, if any, outputting the numbers of the messages
+// suppressed in the intervals which are over.
+bool
+Logger::checkRateLimit(const Severity& severity, const MessageID& ident) {
+    if (!LogRateLimiter::instance().isEnabled()) {
+        return (true);
+    }
+    LogRateLimiter::LimitPtr limit = getLoggerPtr()->getRateLimit();
+    if (!limit) {
+        return (true);
+    }
+    LogRateLimiter::Reports reports;
+    const bool admitted = limit->admit(ident, severity, reports,
+                                       LogRateLimiter::now());
+    for (LogRateLimiter::Reports::const_iterator report = reports.begin();
+         report != reports.end(); ++report) {
+        outputSuppressed(report->severity_, report->ident_,
+                         report->suppressed_);
+    }
+    return (admitted);
+}
+
+void
+Logger::outputSuppressed(const Severity& severity, const MessageID& ident,
+                         const uint64_t suppressed) {
+    Formatter(severity, getLoggerPtr()->lookupMessage(LOG_RATE_LIMITED),
+              this).arg(suppressed).arg(ident);
+}
+
+// Output the numbers of the messages suppressed in the intervals which are
+// over, through the loggers which have the limits.
+void
+Logger::flushRateLimits() {
+    LogRateLimiter& limiter = LogRateLimiter::instance();
+    if (!limiter.isEnabled()) {
+        return;
+    }
+    LogRateLimiter::LoggerReports reports;
+    limiter.flush(reports, LogRateLimiter::now());
+    for (LogRateLimiter::LoggerReports::const_iterator it = reports.begin();
+         it != reports.end(); ++it) {
+        Logger logger(it->first.c_str());
+        for (LogRateLimiter::Reports::const_iterator report =
+                 it->second.begin(); report != it->second.end(); ++report) {
+            logger.outputSuppressed(report->severity_, report->ident_,
+                                    report->suppressed_);
+        }
+    }
+}
+
 Logger::Formatter
 Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
-    if (isDebugEnabled(dbglevel)) {
+    if (isDebugEnabled(dbglevel) && checkRateLimit(DEBUG, ident)) {
         return (Formatter(DEBUG, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -146,7 +198,7 @@ Logger::debug(int dbglevel, const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::info(const isc::log::MessageID& ident) {
-    if (isInfoEnabled()) {
+    if (isInfoEnabled() && checkRateLimit(INFO, ident)) {
         return (Formatter(INFO, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -156,7 +208,7 @@ Logger::info(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::warn(const isc::log::MessageID& ident) {
-    if (isWarnEnabled()) {
+    if (isWarnEnabled() && checkRateLimit(WARN, ident)) {
         return (Formatter(WARN, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -166,7 +218,7 @@ Logger::warn(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::error(const isc::log::MessageID& ident) {
-    if (isErrorEnabled()) {
+    if (isErrorEnabled() && checkRateLimit(ERROR, ident)) {
         return (Formatter(ERROR, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
@@ -176,7 +228,7 @@ Logger::error(const isc::log::MessageID& ident) {
 
 Logger::Formatter
 Logger::fatal(const isc::log::MessageID& ident) {
-    if (isFatalEnabled()) {
+    if (isFatalEnabled() && checkRateLimit(FATAL, ident)) {
         return (Formatter(FATAL, getLoggerPtr()->lookupMessage(ident),
                           this));
     } else {
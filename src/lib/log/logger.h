@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,7 @@
 #include <cstdlib>
 #include <string>
 #include <cstring>
+#include <stdint.h>
 
 #include <boost/static_assert.hpp>
 
@@ -309,6 +310,16 @@ public:
     /// \return true if the logger objects are instances of the same logger.
     bool operator==(Logger& other);
 
+    /// \brief Outputs the numbers of suppressed messages
+    ///
+    /// The messages suppressed by a rate limit are otherwise reported with
+    /// the next message going through the limit once their interval is
+    /// over, which may never come after a storm. This reports them at most
+    /// a second after the end of the interval when called periodically,
+    /// e.g. from the main loop of the server. When no rate limit is set
+    /// the call is a single test of an atomic flag.
+    static void flushRateLimits();
+
 private:
     friend class isc::log::Formatter<Logger>;
 
@@ -320,6 +331,26 @@ private:
     /// \param message Text of the message to be output.
     void output(const Severity& severity, const std::string& message);
 
+    /// \brief Applies the rate limit
+    ///
+    /// Checks the message against the rate limit of the logger and outputs
+    /// the number of the suppressed messages with the same ID when they
+    /// should be reported.
+    ///
+    /// \param severity Severity of the message being output.
+    /// \param ident Message identification.
+    ///
+    /// \return false if the message must not be output.
+    bool checkRateLimit(const Severity& severity, const MessageID& ident);
+
+    /// \brief Outputs the number of messages suppressed by the rate limit
+    ///
+    /// \param severity Severity of the last suppressed message.
+    /// \param ident Identification of the suppressed messages.
+    /// \param suppressed Number of suppressed messages.
+    void outputSuppressed(const Severity& severity, const MessageID& ident,
+                          const uint64_t suppressed);
+
     /// \brief Copy Constructor
     ///
     /// Disabled (marked private) as it makes no sense to copy the logger -
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -65,7 +65,8 @@ bool lockfileEnabled() {
 // default constructor.
 LoggerImpl::LoggerImpl(const string& name) :
     name_(expandLoggerName(name)),
-    logger_(log4cplus::Logger::getInstance(name_))
+    logger_(log4cplus::Logger::getInstance(name_)),
+    rate_limit_(), rate_generation_(0), rate_mutex_()
 {
     if (lockfileEnabled()) {
         sync_ = new interprocess::InterprocessSyncFile("logger");
@@ -80,6 +81,19 @@ LoggerImpl::~LoggerImpl() {
     delete sync_;
 }
 
+// Get the rate limit, looking it up again when the limits have changed.
+LogRateLimiter::LimitPtr
+LoggerImpl::getRateLimit() {
+    LogRateLimiter& limiter = LogRateLimiter::instance();
+    const unsigned generation = limiter.getGeneration();
+    isc::util::thread::Mutex::Locker lock(rate_mutex_);
+    if (rate_generation_ != generation) {
+        rate_limit_ = limiter.getLimit(name_);
+        rate_generation_ = generation;
+    }
+    return (rate_limit_);
+}
+
 /// \brief Version
 std::string
 LoggerImpl::getVersion() {
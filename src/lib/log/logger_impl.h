@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -23,8 +23,10 @@
 
 // Kea logger files
 #include <log/logger_level_impl.h>
+#include <log/log_rate_limiter.h>
 #include <log/message_types.h>
 #include <log/interprocess/interprocess_sync.h>
+#include <util/threads/sync.h>
 
 namespace isc {
 namespace log {
@@ -165,6 +167,14 @@ public:
     /// This gets you the unformatted text of message for given ID.
     std::string* lookupMessage(const MessageID& id);
 
+    /// \brief Returns the rate limit applying to the logger
+    ///
+    /// The limit is looked up in the rate limiter when the limits have
+    /// changed since the previous call and kept otherwise.
+    ///
+    /// \return Pointer to the limit, null if the logger is not limited.
+    LogRateLimiter::LimitPtr getRateLimit();
+
     /// \brief Replace the interprocess synchronization object
     ///
     /// If this method is called with NULL as the argument, it throws a
@@ -190,6 +200,9 @@ private:
     std::string                  name_;   ///< Full name of this logger
     log4cplus::Logger            logger_; ///< Underlying log4cplus logger
     isc::log::interprocess::InterprocessSync* sync_;
+    LogRateLimiter::LimitPtr     rate_limit_;      ///< Rate limit in use
+    unsigned                     rate_generation_; ///< Generation of the limit
+    isc::util::thread::Mutex     rate_mutex_;      ///< Protects the rate limit
 };
 
 } // namespace log
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <algorithm>
 #include <vector>
 
+#include <log/async_appender_impl.h>
 #include <log/logger.h>
 #include <log/logger_manager.h>
 #include <log/logger_manager_impl.h>
@@ -202,5 +203,10 @@ LoggerManager::getMutex() {
     return (mutex);
 }
 
+uint64_t
+LoggerManager::getAsyncDroppedCount() {
+    return (internal::AsyncAppender::getTotalDroppedCount());
+}
+
 } // namespace log
 } // namespace isc
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,8 @@
 
 #include <boost/noncopyable.hpp>
 
+#include <stdint.h>
+
 // Generated if, when updating the logging specification, an unknown
 // destination is encountered.
 class UnknownLoggingDestination : public isc::Exception {
@@ -140,6 +142,13 @@ public:
     /// calls.
     static isc::util::thread::Mutex& getMutex();
 
+    /// \brief Return the number of messages dropped by asynchronous output
+    ///
+    /// Counts the messages dropped because the queue of an asynchronous
+    /// output was full, by all the outputs since the process started.
+    /// The count is not reset by a reconfiguration of the logging.
+    static uint64_t getAsyncDroppedCount();
+
 private:
     /// \brief Initialize Processing
     ///
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -24,8 +24,10 @@
 #include <log/logger_manager.h>
 #include <log/logger_manager_impl.h>
 #include <log/log_messages.h>
+#include <log/log_rate_limiter.h>
 #include <log/logger_name.h>
 #include <log/logger_specification.h>
+#include <log/async_appender_impl.h>
 #include <log/buffer_appender_impl.h>
 
 #include <boost/lexical_cast.hpp>
@@ -69,6 +71,13 @@ LoggerManagerImpl::processSpecification(const LoggerSpecification& spec) {
     // Set the additive flag.
     logger.setAdditivity(spec.getAdditive());
 
+    // Set the rate limit.
+    if (spec.getRateLimit() > 0) {
+        LogRateLimiter::instance().setLimit(
+            expandLoggerName(spec.getName()), spec.getRateLimit(),
+            spec.getRateInterval());
+    }
+
     // Output options given?
     if (spec.optionCount() > 0) {
         // Replace all appenders for this logger.
@@ -112,7 +121,7 @@ LoggerManagerImpl::createConsoleAppender(log4cplus::Logger& logger,
         new log4cplus::ConsoleAppender(
             (opt.stream == OutputOption::STR_STDERR), opt.flush));
     setConsoleAppenderLayout(console);
-    logger.addAppender(console);
+    addAppender(logger, console, opt);
 }
 
 // File appender.  Depending on whether a maximum size is given, either
@@ -148,7 +157,23 @@ LoggerManagerImpl::createFileAppender(log4cplus::Logger& logger,
 
     // use the same console layout for the files.
     setConsoleAppenderLayout(fileapp);
-    logger.addAppender(fileapp);
+    addAppender(logger, fileapp, opt);
+}
+
+// Attach the appender, through an asynchronous appender if requested.
+void
+LoggerManagerImpl::addAppender(log4cplus::Logger& logger,
+                               const log4cplus::SharedAppenderPtr& appender,
+                               const OutputOption& opt)
+{
+    if (opt.async) {
+        log4cplus::SharedAppenderPtr asyncapp(
+            new internal::AsyncAppender(appender, opt.queuesize,
+                                        opt.overflow == OutputOption::QUEUE_DROP));
+        logger.addAppender(asyncapp);
+    } else {
+        logger.addAppender(appender);
+    }
 }
 
 void
@@ -172,7 +197,7 @@ LoggerManagerImpl::createSyslogAppender(log4cplus::Logger& logger,
     log4cplus::SharedAppenderPtr syslogapp(
         new log4cplus::SysLogAppender(properties));
     setSyslogAppenderLayout(syslogapp);
-    logger.addAppender(syslogapp);
+    addAppender(logger, syslogapp, opt);
 }
 
 
@@ -210,6 +235,9 @@ void LoggerManagerImpl::initRootLogger(isc::log::Severity severity,
 {
     log4cplus::Logger::getDefaultHierarchy().resetConfiguration();
 
+    // Remove the rate limits with the rest of the configuration.
+    LogRateLimiter::instance().clear();
+
     // Disable log4cplus' own logging, unless --enable-debug was
     // specified to configure. Note that this does not change
     // LogLog's levels (that is still just INFO).
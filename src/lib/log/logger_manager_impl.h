@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -125,6 +125,19 @@ private:
     static void createSyslogAppender(log4cplus::Logger& logger,
                                      const OutputOption& opt);
 
+    /// \brief Attach appender to the logger
+    ///
+    /// If asynchronous output is requested in the output options, the
+    /// appender is wrapped in an \c internal::AsyncAppender, so that the
+    /// messages are written by a separate thread.
+    ///
+    /// \param logger Log4cplus logger to which the appender must be attached.
+    /// \param appender Appender to be attached.
+    /// \param opt Output options for this appender.
+    static void addAppender(log4cplus::Logger& logger,
+                            const log4cplus::SharedAppenderPtr& appender,
+                            const OutputOption& opt);
+
     /// \brief Create buffered appender
     ///
     /// Appends an object to the logger that will store the log events sent
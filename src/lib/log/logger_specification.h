@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -42,7 +42,7 @@ public:
                         isc::log::Severity severity = isc::log::INFO,
                         int dbglevel = 0, bool additive = false) :
         name_(name), severity_(severity), dbglevel_(dbglevel),
-        additive_(additive)
+        additive_(additive), rate_limit_(0), rate_interval_(1)
     {}
 
     /// \brief Set the name of the logger.
@@ -93,6 +93,26 @@ public:
         return additive_;
     }
 
+    /// \brief Set the rate limit.
+    ///
+    /// \param limit Maximum number of messages with the same message ID
+    ///        output in an interval, 0 for no limit.
+    /// \param interval Length of the interval in seconds.
+    void setRateLimit(unsigned limit, unsigned interval = 1) {
+        rate_limit_ = limit;
+        rate_interval_ = interval;
+    }
+
+    /// \return Return the rate limit, 0 if there is no limit.
+    unsigned getRateLimit() const {
+        return rate_limit_;
+    }
+
+    /// \return Return the rate limit interval in seconds.
+    unsigned getRateInterval() const {
+        return rate_interval_;
+    }
+
     /// \brief Add output option.
     ///
     /// \param option Option to add to the list.
@@ -131,6 +151,8 @@ public:
         severity_ = isc::log::INFO;
         dbglevel_ = 0;
         additive_ = false;
+        rate_limit_ = 0;
+        rate_interval_ = 1;
         options_.clear();
     }
 
@@ -139,6 +161,8 @@ private:
     isc::log::Severity          severity_;      ///< Severity for this logger
     int                         dbglevel_;      ///< Debug level
     bool                        additive_;      ///< Chaining output
+    unsigned                    rate_limit_;    ///< Messages per interval
+    unsigned                    rate_interval_; ///< Rate limit interval
     std::vector<OutputOption>   options_;       ///< Logger options
 };
 
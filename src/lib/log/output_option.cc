@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -45,5 +45,18 @@ getStream(const std::string& stream_str) {
     }
 }
 
+OutputOption::QueueOverflow
+getQueueOverflow(const std::string& overflow_str) {
+    if (boost::iequals(overflow_str, "block")) {
+        return OutputOption::QUEUE_BLOCK;
+    } else if (boost::iequals(overflow_str, "drop")) {
+        return OutputOption::QUEUE_DROP;
+    } else {
+        Logger logger("log");
+        LOG_ERROR(logger, LOG_BAD_QUEUE_OVERFLOW).arg(overflow_str);
+        return OutputOption::QUEUE_BLOCK;
+    }
+}
+
 } // namespace log
 } // namespace isc
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -50,10 +50,17 @@ struct OutputOption {
         STR_STDERR = 2
     } Stream;
 
+    /// What to do with a message when the asynchronous output queue is full
+    typedef enum {
+        QUEUE_BLOCK = 0,    ///< wait until there is room in the queue
+        QUEUE_DROP = 1      ///< drop the message and count it
+    } QueueOverflow;
+
     /// \brief Constructor
     OutputOption() : destination(DEST_CONSOLE), stream(STR_STDERR),
                      flush(true), facility("LOCAL0"), filename(""),
-                     maxsize(0), maxver(0)
+                     maxsize(0), maxver(0), async(false), queuesize(1024),
+                     overflow(QUEUE_BLOCK)
     {}
 
     /// Members. 
@@ -65,10 +72,14 @@ struct OutputOption {
     std::string     filename;           ///< Filename if file output
     size_t          maxsize;            ///< 0 if no maximum size
     unsigned int    maxver;             ///< Maximum versions (none if <= 0)
+    bool            async;              ///< true to write in a separate thread
+    size_t          queuesize;          ///< Maximum messages waiting if async
+    QueueOverflow   overflow;           ///< Full queue policy if async
 };
 
 OutputOption::Destination getDestination(const std::string& dest_str);
 OutputOption::Stream getStream(const std::string& stream_str);
+OutputOption::QueueOverflow getQueueOverflow(const std::string& overflow_str);
 
 
 } // namespace log
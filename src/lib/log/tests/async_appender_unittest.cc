@@ -0,0 +1,187 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <log/async_appender_impl.h>
+#include <log/log_messages.h>
+#include <log/logger_manager.h>
+#include <util/threads/sync.h>
+
+#include <log4cplus/loggingmacros.h>
+#include <log4cplus/logger.h>
+#include <log4cplus/nullappender.h>
+#include <log4cplus/spi/loggingevent.h>
+
+#include <string>
+#include <vector>
+
+using namespace isc::log;
+using namespace isc::log::internal;
+using namespace isc::util::thread;
+
+namespace {
+
+/// \brief Appender recording the messages
+///
+/// The appender can be held closed, so as the writer thread of the
+/// asynchronous appender waits in append() while the logging thread
+/// fills the ring.
+class RecordingAppender : public log4cplus::Appender {
+public:
+    RecordingAppender() : messages_(), held_(false), closed_(false),
+                          mutex_(), released_() {
+    }
+
+    virtual ~RecordingAppender() {
+        destructorImpl();
+    }
+
+    virtual void close() {
+        Mutex::Locker lock(mutex_);
+        closed_ = true;
+    }
+
+    /// \brief Makes the writer thread wait in append().
+    void hold() {
+        Mutex::Locker lock(mutex_);
+        held_ = true;
+    }
+
+    /// \brief Lets the writer thread continue.
+    void release() {
+        Mutex::Locker lock(mutex_);
+        held_ = false;
+        released_.signal();
+    }
+
+    std::vector<std::string> getMessages() const {
+        Mutex::Locker lock(mutex_);
+        return (messages_);
+    }
+
+    bool isClosed() const {
+        Mutex::Locker lock(mutex_);
+        return (closed_);
+    }
+
+protected:
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event) {
+        Mutex::Locker lock(mutex_);
+        while (held_) {
+            released_.wait(mutex_);
+        }
+        messages_.push_back(event.getMessage());
+    }
+
+private:
+    std::vector<std::string> messages_;
+    bool held_;
+    bool closed_;
+    mutable Mutex mutex_;
+    CondVar released_;
+};
+
+class AsyncAppenderTest : public ::testing::Test {
+protected:
+    AsyncAppenderTest() : recorder_(new RecordingAppender()),
+                          appender_(recorder_),
+                          logger_(log4cplus::Logger::getInstance("async")) {
+        logger_.setLogLevel(log4cplus::TRACE_LOG_LEVEL);
+    }
+
+    ~AsyncAppenderTest() {
+        recorder_->release();
+        logger_.removeAllAppenders();
+        logger_.addAppender(log4cplus::SharedAppenderPtr(
+                                new log4cplus::NullAppender()));
+    }
+
+    RecordingAppender* recorder_;
+    log4cplus::SharedAppenderPtr appender_;
+    log4cplus::Logger logger_;
+};
+
+// Test that the events are written in order and that closing the
+// appender writes all the stored events.
+TEST_F(AsyncAppenderTest, writeInOrder) {
+    AsyncAppender* async = new AsyncAppender(appender_, 4, false);
+    log4cplus::SharedAppenderPtr async_ptr(async);
+    logger_.addAppender(async_ptr);
+
+    for (int i = 0; i < 100; ++i) {
+        LOG4CPLUS_INFO(logger_, "Message " << i);
+    }
+    async->close();
+    EXPECT_TRUE(recorder_->isClosed());
+
+    std::vector<std::string> messages = recorder_->getMessages();
+    ASSERT_EQ(100, messages.size());
+    for (int i = 0; i < 100; ++i) {
+        std::ostringstream expected;
+        expected << "Message " << i;
+        EXPECT_EQ(expected.str(), messages[i]);
+    }
+    EXPECT_EQ(0, async->getDroppedCount());
+
+    // Events logged after close are written directly.
+    LOG4CPLUS_INFO(logger_, "Late");
+    messages = recorder_->getMessages();
+    ASSERT_EQ(101, messages.size());
+    EXPECT_EQ("Late", messages[100]);
+}
+
+// Test that the events are dropped when the ring is full and that the
+// number of dropped events is reported.
+TEST_F(AsyncAppenderTest, dropWhenFull) {
+    AsyncAppender* async = new AsyncAppender(appender_, 2, true);
+    log4cplus::SharedAppenderPtr async_ptr(async);
+    logger_.addAppender(async_ptr);
+
+    // The writer thread takes at most one event and waits, so the ring
+    // fills up and the remaining events are dropped without waiting.
+    const uint64_t total = LoggerManager::getAsyncDroppedCount();
+    recorder_->hold();
+    for (int i = 0; i < 10; ++i) {
+        LOG4CPLUS_INFO(logger_, "Message " << i);
+    }
+    const size_t dropped = async->getDroppedCount();
+    EXPECT_GE(dropped, 7);
+    EXPECT_LE(dropped, 8);
+
+    // The drops are also counted for the whole process.
+    EXPECT_EQ(total + dropped, LoggerManager::getAsyncDroppedCount());
+
+    recorder_->release();
+    async->close();
+
+    std::vector<std::string> messages = recorder_->getMessages();
+    ASSERT_EQ(10 - dropped + 1, messages.size());
+    EXPECT_EQ("Message 0", messages[0]);
+    const std::string& report = messages.back();
+    EXPECT_EQ(0, report.find(LOG_ASYNC_DROPPED)) << report;
+    std::ostringstream count;
+    count << " " << dropped << " ";
+    EXPECT_NE(std::string::npos, report.find(count.str())) << report;
+}
+
+// Test that a logging thread waits for room in the ring in the blocking
+// mode rather than dropping the event.
+TEST_F(AsyncAppenderTest, blockWhenFull) {
+    AsyncAppender* async = new AsyncAppender(appender_, 1, false);
+    log4cplus::SharedAppenderPtr async_ptr(async);
+    logger_.addAppender(async_ptr);
+
+    for (int i = 0; i < 50; ++i) {
+        LOG4CPLUS_INFO(logger_, "Message " << i);
+    }
+    async->close();
+    EXPECT_EQ(50, recorder_->getMessages().size());
+    EXPECT_EQ(0, async->getDroppedCount());
+}
+
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <benchmark/benchmark.h>
+#include <log/log_formatter.h>
+#include <log/logger_level.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <string>
+
+using namespace isc::log;
+
+namespace {
+
+/// @brief Message with as many placeholders as a typical packet message.
+const char* MESSAGE = "%1: lease %2 has been allocated for %3 seconds"
+    " in subnet %4 (pool %5)";
+
+/// @brief Arguments of the message.
+const std::string LABEL = "[hwtype=1 00:0c:01:02:03:04], cid=[no info],"
+    " tid=0x1234";
+const std::string ADDRESS = "192.0.2.100";
+const unsigned int LIFETIME = 3600;
+const std::string SUBNET = "192.0.2.0/24";
+const std::string POOL = "192.0.2.10-192.0.2.200";
+
+/// @brief Output of the formatter discarding the messages.
+class NullOutput {
+public:
+    void output(const Severity&, const std::string& message) {
+        benchmark::DoNotOptimize(message.data());
+    }
+};
+
+/// @brief Formatter writing to the null output.
+typedef Formatter<NullOutput> NullFormatter;
+
+/// Formats the message by substituting each argument as soon as it is
+/// given, which is how the formatter used to work: each argument costs a
+/// conversion to a string and a scan and a copy of the whole message.
+void BM_formatSequential(benchmark::State& state) {
+    NullOutput output;
+    while (state.KeepRunning()) {
+        std::string* message = new std::string(MESSAGE);
+        replacePlaceholder(message, LABEL, 1);
+        replacePlaceholder(message, ADDRESS, 2);
+        replacePlaceholder(message,
+                           boost::lexical_cast<std::string>(LIFETIME), 3);
+        replacePlaceholder(message, SUBNET, 4);
+        replacePlaceholder(message, POOL, 5);
+        checkExcessPlaceholders(message, 6);
+        output.output(INFO, *message);
+        delete message;
+    }
+}
+
+/// Formats the same message with the formatter, which stores the arguments
+/// and replaces all the placeholders in one pass when the message is
+/// output.
+void BM_formatDeferred(benchmark::State& state) {
+    NullOutput output;
+    while (state.KeepRunning()) {
+        NullFormatter(INFO, new std::string(MESSAGE), &output).arg(LABEL).
+            arg(ADDRESS).arg(LIFETIME).arg(SUBNET).arg(POOL);
+    }
+}
+
+/// Measures the cost of the arguments of a message which is not output,
+/// e.g. because the severity is disabled.
+void BM_formatInactive(benchmark::State& state) {
+    while (state.KeepRunning()) {
+        NullFormatter().arg(LABEL).arg(ADDRESS).arg(LIFETIME).arg(SUBNET).
+            arg(POOL);
+    }
+}
+
+}
+
+BENCHMARK(BM_formatSequential);
+BENCHMARK(BM_formatDeferred);
+BENCHMARK(BM_formatInactive);
+
+BENCHMARK_MAIN()
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -176,4 +176,33 @@ TEST_F(FormatterTest, noRecurse) {
     EXPECT_EQ("%1 %1", outputs[0].second);
 }
 
+// Test that a placeholder in an argument is never replaced, whatever the
+// order of the arguments
+TEST_F(FormatterTest, noRecurseLater) {
+    Formatter(isc::log::INFO, s("%1 %2"), this).arg("%2").arg(42);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("%2 42", outputs[0].second);
+}
+
+// Test that percent signs which are not placeholders are kept and that
+// placeholders with more than one digit are recognized
+TEST_F(FormatterTest, manyArgs) {
+    Formatter(isc::log::INFO,
+              s("100% %11 %10 %9 %8 %7 %6 %5 %4 %3 %2 %1 %"), this).
+        arg(1).arg(2).arg(3).arg(4).arg(5).arg(6).arg(7).arg(8).arg(9).
+        arg(10).arg(std::string("11"));
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("100% 11 10 9 8 7 6 5 4 3 2 1 %", outputs[0].second);
+}
+
+// Test that C strings are accepted as arguments
+TEST_F(FormatterTest, charArg) {
+    const char* text = "pointer";
+    char array[] = "array";
+    Formatter(isc::log::INFO, s("%1 %2 %3"), this).arg(text).arg(array).
+        arg("literal");
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("pointer array literal", outputs[0].second);
+}
+
 }
@@ -0,0 +1,227 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <exceptions/exceptions.h>
+#include <log/log_messages.h>
+#include <log/log_rate_limiter.h>
+
+using namespace isc;
+using namespace isc::log;
+
+namespace {
+
+class LogRateLimiterTest : public ::testing::Test {
+protected:
+    LogRateLimiterTest() : limiter_(LogRateLimiter::instance()) {
+        limiter_.clear();
+    }
+
+    ~LogRateLimiterTest() {
+        limiter_.clear();
+    }
+
+    LogRateLimiter& limiter_;
+};
+
+// Test that the rate limits are parsed.
+TEST_F(LogRateLimiterTest, parse) {
+    unsigned limit = 0;
+    unsigned interval = 0;
+    EXPECT_NO_THROW(LogRateLimiter::parse("100/s", limit, interval));
+    EXPECT_EQ(100, limit);
+    EXPECT_EQ(1, interval);
+    EXPECT_NO_THROW(LogRateLimiter::parse("5/m", limit, interval));
+    EXPECT_EQ(5, limit);
+    EXPECT_EQ(60, interval);
+    EXPECT_NO_THROW(LogRateLimiter::parse("1000/10m", limit, interval));
+    EXPECT_EQ(1000, limit);
+    EXPECT_EQ(600, interval);
+    EXPECT_NO_THROW(LogRateLimiter::parse("1/2h", limit, interval));
+    EXPECT_EQ(1, limit);
+    EXPECT_EQ(7200, interval);
+
+    EXPECT_THROW(LogRateLimiter::parse("", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("100", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("/s", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("100/", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("100/d", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("0/s", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("1/0s", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("-1/s", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("x/s", limit, interval), BadValue);
+    EXPECT_THROW(LogRateLimiter::parse("1/ 1s", limit, interval), BadValue);
+}
+
+// Test that messages over the limit are suppressed and reported once
+// their interval is over.
+TEST_F(LogRateLimiterTest, admit) {
+    EXPECT_FALSE(limiter_.isEnabled());
+    EXPECT_FALSE(limiter_.getLimit("kea.test"));
+
+    const unsigned generation = limiter_.getGeneration();
+    limiter_.setLimit("kea.test", 2, 10);
+    EXPECT_TRUE(limiter_.isEnabled());
+    EXPECT_NE(generation, limiter_.getGeneration());
+    LogRateLimiter::LimitPtr limit = limiter_.getLimit("kea.test");
+    ASSERT_TRUE(limit);
+
+    // Two messages are admitted in the interval.
+    LogRateLimiter::Reports reports;
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, INFO, reports, 100));
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, INFO, reports, 105));
+    EXPECT_FALSE(limit->admit(LOG_BAD_STREAM, INFO, reports, 105));
+    EXPECT_FALSE(limit->admit(LOG_BAD_STREAM, WARN, reports, 109));
+    EXPECT_TRUE(reports.empty());
+
+    // Other message IDs are counted separately.
+    EXPECT_TRUE(limit->admit(LOG_BAD_SEVERITY, INFO, reports, 109));
+    EXPECT_TRUE(reports.empty());
+
+    // The next interval reports the suppressed messages once, with the
+    // severity of the last one.
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, INFO, reports, 110));
+    ASSERT_EQ(1, reports.size());
+    EXPECT_EQ(LOG_BAD_STREAM, reports[0].ident_);
+    EXPECT_EQ(WARN, reports[0].severity_);
+    EXPECT_EQ(2, reports[0].suppressed_);
+    reports.clear();
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, INFO, reports, 110));
+    EXPECT_FALSE(limit->admit(LOG_BAD_STREAM, INFO, reports, 110));
+    EXPECT_TRUE(reports.empty());
+
+    // Removing the limit.
+    limiter_.setLimit("kea.test", 0);
+    EXPECT_FALSE(limiter_.isEnabled());
+    EXPECT_FALSE(limiter_.getLimit("kea.test"));
+}
+
+// Test that the suppressed messages are reported by any message going
+// through the limit once the storm has stopped.
+TEST_F(LogRateLimiterTest, stormStopped) {
+    limiter_.setLimit("kea.test", 1, 5);
+    LogRateLimiter::LimitPtr limit = limiter_.getLimit("kea.test");
+    ASSERT_TRUE(limit);
+
+    LogRateLimiter::Reports reports;
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, ERROR, reports, 100));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_FALSE(limit->admit(LOG_BAD_STREAM, ERROR, reports, 101));
+    }
+
+    // The storm stopped: another message in the interval reports nothing.
+    EXPECT_TRUE(limit->admit(LOG_BAD_SEVERITY, INFO, reports, 104));
+    EXPECT_TRUE(reports.empty());
+
+    // After the interval the next message, whatever its ID, reports the
+    // suppressed messages.
+    EXPECT_FALSE(limit->admit(LOG_BAD_SEVERITY, INFO, reports, 105));
+    ASSERT_EQ(1, reports.size());
+    EXPECT_EQ(LOG_BAD_STREAM, reports[0].ident_);
+    EXPECT_EQ(ERROR, reports[0].severity_);
+    EXPECT_EQ(10, reports[0].suppressed_);
+
+    // The counts are reported only once: only the message suppressed
+    // just above is reported now.
+    reports.clear();
+    EXPECT_TRUE(limit->admit(LOG_BAD_SEVERITY, INFO, reports, 110));
+    ASSERT_EQ(1, reports.size());
+    EXPECT_EQ(LOG_BAD_SEVERITY, reports[0].ident_);
+    EXPECT_EQ(1, reports[0].suppressed_);
+}
+
+// Test that the suppressed messages are reported by the periodic flush
+// when no message follows the storm.
+TEST_F(LogRateLimiterTest, flushWithoutMessage) {
+    limiter_.setLimit("kea.test", 1, 5);
+    limiter_.setLimit("kea.other", 1, 5);
+    LogRateLimiter::LimitPtr limit = limiter_.getLimit("kea.test");
+    ASSERT_TRUE(limit);
+
+    LogRateLimiter::Reports reports;
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, WARN, reports, 100));
+    for (int i = 0; i < 10; ++i) {
+        EXPECT_FALSE(limit->admit(LOG_BAD_STREAM, WARN, reports, 101));
+    }
+
+    // Nothing is reported while the interval lasts.
+    LogRateLimiter::LoggerReports logger_reports;
+    limiter_.flush(logger_reports, 104);
+    EXPECT_TRUE(logger_reports.empty());
+
+    // Once it is over the counts are reported with the name of the logger
+    // having the limit, without any further message.
+    limiter_.flush(logger_reports, 105);
+    ASSERT_EQ(1, logger_reports.size());
+    EXPECT_EQ("kea.test", logger_reports[0].first);
+    ASSERT_EQ(1, logger_reports[0].second.size());
+    EXPECT_EQ(LOG_BAD_STREAM, logger_reports[0].second[0].ident_);
+    EXPECT_EQ(WARN, logger_reports[0].second[0].severity_);
+    EXPECT_EQ(10, logger_reports[0].second[0].suppressed_);
+
+    // The counts are reported only once, by the flush or by a message.
+    logger_reports.clear();
+    limiter_.flush(logger_reports, 106);
+    EXPECT_TRUE(logger_reports.empty());
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, WARN, reports, 107));
+    EXPECT_TRUE(reports.empty());
+}
+
+// Test that the flush checks a limit at most once a second.
+TEST_F(LogRateLimiterTest, flushOnceASecond) {
+    limiter_.setLimit("kea.test", 1, 1);
+    LogRateLimiter::LimitPtr limit = limiter_.getLimit("kea.test");
+    ASSERT_TRUE(limit);
+
+    LogRateLimiter::Reports reports;
+    limit->flush(reports, 100);
+    EXPECT_TRUE(limit->admit(LOG_BAD_STREAM, INFO, reports, 100));
+    EXPECT_FALSE(limit->admit(LOG_BAD_STREAM, INFO, reports, 100));
+
+    // The interval is over but the limit was checked in this second.
+    limit->flush(reports, 100);
+    EXPECT_TRUE(reports.empty());
+    limit->flush(reports, 101);
+    ASSERT_EQ(1, reports.size());
+    EXPECT_EQ(1, reports[0].suppressed_);
+}
+
+// Test that the limit of a logger applies to its children.
+TEST_F(LogRateLimiterTest, children) {
+    limiter_.setLimit("kea", 1);
+    limiter_.setLimit("kea.test.child", 2);
+
+    LogRateLimiter::LimitPtr root = limiter_.getLimit("kea");
+    ASSERT_TRUE(root);
+    EXPECT_EQ(root, limiter_.getLimit("kea.test"));
+    EXPECT_EQ(root, limiter_.getLimit("kea.test.other.deep"));
+
+    // The child has its own limit.
+    LogRateLimiter::LimitPtr child = limiter_.getLimit("kea.test.child");
+    ASSERT_TRUE(child);
+    EXPECT_NE(root, child);
+    EXPECT_EQ(child, limiter_.getLimit("kea.test.child.deep"));
+
+    LogRateLimiter::Reports reports;
+    EXPECT_TRUE(root->admit(LOG_BAD_STREAM, INFO, reports, 1));
+    EXPECT_FALSE(root->admit(LOG_BAD_STREAM, INFO, reports, 1));
+    EXPECT_TRUE(child->admit(LOG_BAD_STREAM, INFO, reports, 1));
+    EXPECT_TRUE(child->admit(LOG_BAD_STREAM, INFO, reports, 1));
+    EXPECT_FALSE(child->admit(LOG_BAD_STREAM, INFO, reports, 1));
+
+    // A logger whose name only starts with the name of a limited logger.
+    EXPECT_FALSE(limiter_.getLimit("keaX"));
+
+    const unsigned generation = limiter_.getGeneration();
+    limiter_.clear();
+    EXPECT_NE(generation, limiter_.getGeneration());
+    EXPECT_FALSE(limiter_.isEnabled());
+    EXPECT_FALSE(limiter_.getLimit("kea.test"));
+}
+
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -22,6 +22,7 @@
 
 #include <log/macros.h>
 #include <log/log_messages.h>
+#include <log/log_rate_limiter.h>
 #include <log/logger.h>
 #include <log/logger_level.h>
 #include <log/logger_manager.h>
@@ -242,6 +243,67 @@ TEST_F(LoggerManagerTest, FileLogger) {
     checkFileContents(file_spec.getFileName(), ids.begin(), ids.end());
 }
 
+// Check that the rate limit of a logger suppresses the repeated messages.
+TEST_F(LoggerManagerTest, RateLimit) {
+    SpecificationForFileLogger file_spec;
+    file_spec.getSpecification().setRateLimit(2, 3600);
+
+    LoggerManager manager;
+    manager.process(file_spec.getSpecification());
+
+    vector<MessageID> ids;
+    {
+        Logger logger(file_spec.getLoggerName().c_str());
+
+        for (int i = 0; i < 5; ++i) {
+            LOG_FATAL(logger, LOG_DUPLICATE_MESSAGE_ID).arg(i);
+        }
+        ids.push_back(LOG_DUPLICATE_MESSAGE_ID);
+        ids.push_back(LOG_DUPLICATE_MESSAGE_ID);
+
+        // Other message IDs have their own count.
+        LOG_FATAL(logger, LOG_NO_SUCH_MESSAGE).arg("test");
+        ids.push_back(LOG_NO_SUCH_MESSAGE);
+    }
+    LoggerManager::reset();
+
+    checkFileContents(file_spec.getFileName(), ids.begin(), ids.end());
+
+    // The reset removed the limit.
+    EXPECT_FALSE(LogRateLimiter::instance().isEnabled());
+}
+
+// Check that the suppressed messages are reported by the periodic flush
+// when no message follows them.
+TEST_F(LoggerManagerTest, RateLimitFlush) {
+    SpecificationForFileLogger file_spec;
+    file_spec.getSpecification().setRateLimit(1, 1);
+
+    LoggerManager manager;
+    manager.process(file_spec.getSpecification());
+
+    vector<MessageID> ids;
+    {
+        Logger logger(file_spec.getLoggerName().c_str());
+
+        const int64_t start = LogRateLimiter::now();
+        for (int i = 0; i < 3; ++i) {
+            LOG_FATAL(logger, LOG_DUPLICATE_MESSAGE_ID).arg(i);
+        }
+        ids.push_back(LOG_DUPLICATE_MESSAGE_ID);
+
+        // Wait for the end of the interval and flush.
+        while (LogRateLimiter::now() < start + 2) {
+            usleep(100000);
+        }
+        Logger::flushRateLimits();
+        ids.push_back(LOG_RATE_LIMITED);
+    }
+    LoggerManager::reset();
+
+    checkFileContents(file_spec.getFileName(), ids.begin(), ids.end());
+}
+
 // Check if the file rolls over when it gets above a certain size.
 TEST_F(LoggerManagerTest, FileSizeRollover) {
     // Set to a suitable minimum that log4cplus can copy with
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -28,6 +28,9 @@ TEST(OutputOptionTest, Initialization) {
     EXPECT_EQ(string(""), option.filename);
     EXPECT_EQ(0, option.maxsize);
     EXPECT_EQ(0, option.maxver);
+    EXPECT_FALSE(option.async);
+    EXPECT_EQ(1024, option.queuesize);
+    EXPECT_EQ(OutputOption::QUEUE_BLOCK, option.overflow);
 }
 
 TEST(OutputOption, getDestination) {
@@ -58,3 +61,14 @@ TEST(OutputOption, getStream) {
     EXPECT_EQ(OutputOption::STR_STDOUT, getStream(""));
 }
 
+
+TEST(OutputOption, getQueueOverflow) {
+    EXPECT_EQ(OutputOption::QUEUE_BLOCK, getQueueOverflow("block"));
+    EXPECT_EQ(OutputOption::QUEUE_BLOCK, getQueueOverflow("BLOCK"));
+    EXPECT_EQ(OutputOption::QUEUE_DROP, getQueueOverflow("drop"));
+    EXPECT_EQ(OutputOption::QUEUE_DROP, getQueueOverflow("DrOp"));
+
+    // bad values should default to block
+    EXPECT_EQ(OutputOption::QUEUE_BLOCK, getQueueOverflow("some bad value"));
+    EXPECT_EQ(OutputOption::QUEUE_BLOCK, getQueueOverflow(""));
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -42,7 +42,10 @@ ConfigDbInfo::getParameterValue(const std::string& name, std::string& value) con
 
 //********* ConfiControlInfo ************//
 
-ConfigControlInfo::ConfigControlInfo(const ConfigControlInfo& other) {
+const uint32_t ConfigControlInfo::DEFAULT_CONFIG_FETCH_WAIT_TIME;
+
+ConfigControlInfo::ConfigControlInfo(const ConfigControlInfo& other)
+    : config_fetch_wait_time_(other.config_fetch_wait_time_) {
     for (auto db : other.db_infos_) {
         addConfigDatabase(db.getAccessString());
     }
@@ -88,6 +91,7 @@ ConfigControlInfo::EMPTY_DB() {
 void
 ConfigControlInfo::clear() {
     db_infos_.clear();
+    config_fetch_wait_time_ = DEFAULT_CONFIG_FETCH_WAIT_TIME;
 }
 
 ElementPtr
@@ -99,12 +103,17 @@ ConfigControlInfo::toElement() const {
     }
 
     result->set("config-databases", db_list);
+    if (config_fetch_wait_time_ != DEFAULT_CONFIG_FETCH_WAIT_TIME) {
+        result->set("config-fetch-wait-time",
+                    Element::create(static_cast<int64_t>(config_fetch_wait_time_)));
+    }
     return(result);
 }
 
 bool
 ConfigControlInfo::equals(const ConfigControlInfo& other) const {
-   return (db_infos_ == other.db_infos_);
+   return ((db_infos_ == other.db_infos_) &&
+           (config_fetch_wait_time_ == other.config_fetch_wait_time_));
 }
 
 } // end of namespace isc::process
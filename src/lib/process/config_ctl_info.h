@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -138,8 +138,12 @@ typedef std::vector<ConfigDbInfo> ConfigDbInfoList;
 class ConfigControlInfo : public isc::data::CfgToElement {
 public:
 
+    /// @brief Default interval between configuration updates fetches.
+    static const uint32_t DEFAULT_CONFIG_FETCH_WAIT_TIME = 30;
+
     /// @brief Constructor.
-    ConfigControlInfo() {};
+    ConfigControlInfo()
+        : config_fetch_wait_time_(DEFAULT_CONFIG_FETCH_WAIT_TIME) {};
 
     /// @brief Copy Constructor.
     ConfigControlInfo(const ConfigControlInfo& other);
@@ -169,6 +173,21 @@ public:
     const ConfigDbInfo& findConfigDb(const std::string& param_name,
                                      const std::string& param_value);
 
+    /// @brief Sets the interval between fetches of configuration updates.
+    ///
+    /// @param wait_time Interval in seconds. The value of 0 disables
+    /// fetching the updates.
+    void setConfigFetchWaitTime(const uint32_t wait_time) {
+        config_fetch_wait_time_ = wait_time;
+    }
+
+    /// @brief Returns the interval between fetches of configuration updates.
+    ///
+    /// @return Interval in seconds.
+    uint32_t getConfigFetchWaitTime() const {
+        return (config_fetch_wait_time_);
+    }
+
     /// @brief Empties the contents of the class, including the database list
     void clear();
 
@@ -193,6 +212,10 @@ private:
 
     /// @brief List of configuration databases
     ConfigDbInfoList db_infos_;
+
+    /// @brief Interval in seconds between fetches of configuration updates
+    /// from the configuration databases.
+    uint32_t config_fetch_wait_time_;
 };
 
 /// @brief Defines a pointer to a ConfigControlInfo
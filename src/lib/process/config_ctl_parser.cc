@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -41,6 +41,11 @@ ConfigControlParser::parse(const data::ConstElementPtr& config_control) {
                 ctl_info->addConfigDatabase(access_string);
             }
         }
+
+        if (config_control->contains("config-fetch-wait-time")) {
+            ctl_info->setConfigFetchWaitTime(getUint32(config_control,
+                                                       "config-fetch-wait-time"));
+        }
     } catch (const isc::ConfigError&) {
         // Position was already added
         throw;
@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -20,6 +20,10 @@ public:
 
     /// @brief Parses a configuration control Element
     ///
+    /// The configuration control holds the list of the configuration
+    /// databases and the interval in seconds between the fetches of
+    /// configuration updates from them (config-fetch-wait-time).
+    ///
     /// @param config_control Element holding the config control content
     /// to be parsed.
     ///
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -32,7 +32,7 @@ DControllerBase::DControllerBase(const char* app_name, const char* bin_name)
     : app_name_(app_name), bin_name_(bin_name),
       verbose_(false), check_only_(false),
       io_service_(new isc::asiolink::IOService()),
-      io_signal_queue_() {
+      io_signal_queue_(), log_flush_timer_() {
 }
 
 void
@@ -140,6 +140,11 @@ DControllerBase::launch(int argc, char* argv[], const bool test_mode) {
     try {
         // Now that we have a proces, we can set up signal handling.
         initSignalHandling();
+
+        // Report the messages suppressed by the logging rate limits when
+        // no further message goes through the limits.
+        log_flush_timer_.reset(new asiolink::IntervalTimer(*io_service_));
+        log_flush_timer_->setup(&isc::log::Logger::flushRateLimits, 1000);
         runProcess();
     } catch (const std::exception& ex) {
         LOG_FATAL(dctl_logger, DCTL_PROCESS_FAILED)
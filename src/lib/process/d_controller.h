@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #ifndef D_CONTROLLER_H
 #define D_CONTROLLER_H
 
+#include <asiolink/interval_timer.h>
 #include <asiolink/io_service.h>
 #include <cc/data.h>
 #include <exceptions/exceptions.h>
@@ -623,6 +624,10 @@ private:
     /// @brief Queue for propagating caught signals to the IOService.
     IOSignalQueuePtr io_signal_queue_;
 
+    /// @brief Timer reporting the messages suppressed by the logging rate
+    /// limits.
+    asiolink::IntervalTimerPtr log_flush_timer_;
+
     /// @brief Singleton instance value.
     static DControllerBasePtr controller_;
 
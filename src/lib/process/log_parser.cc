@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <process/log_parser.h>
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
+#include <log/log_rate_limiter.h>
 #include <log/logger_specification.h>
 #include <log/logger_support.h>
 #include <log/logger_manager.h>
@@ -109,6 +110,21 @@ void LogConfigParser::parseConfigEntry(isc::data::ConstElementPtr entry) {
         info.debuglevel_ = 99;
     }
 
+    // Get the rate limit of the messages with the same ID, if any.
+    isc::data::ConstElementPtr rate_limit_ptr = entry->get("rate-limit");
+    if (rate_limit_ptr) {
+        unsigned limit = 0;
+        unsigned interval = 0;
+        try {
+            isc::log::LogRateLimiter::parse(rate_limit_ptr->stringValue(),
+                                            limit, interval);
+        } catch (const std::exception& ex) {
+            isc_throw(BadValue, ex.what() << " ("
+                      << rate_limit_ptr->getPosition() << ")");
+        }
+        info.rate_limit_ = rate_limit_ptr->stringValue();
+    }
+
     isc::data::ConstElementPtr output_options = entry->get("output_options");
 
     if (output_options) {
@@ -150,6 +166,33 @@ void LogConfigParser::parseOutputOptions(std::vector<LoggingDestination>& destin
             dest.flush_ = flush_ptr->boolValue();
         }
 
+        isc::data::ConstElementPtr async_ptr = output_option->get("async");
+        if (async_ptr) {
+            dest.async_ = async_ptr->boolValue();
+        }
+
+        isc::data::ConstElementPtr queue_size_ptr = output_option->get("queue-size");
+        if (queue_size_ptr) {
+            int64_t queue_size = queue_size_ptr->intValue();
+            if (queue_size <= 0) {
+                isc_throw(BadValue, "Unsupported queue-size value "
+                          << queue_size << ", expected a positive number ("
+                          << queue_size_ptr->getPosition() << ")");
+            }
+            dest.queue_size_ = static_cast<uint64_t>(queue_size);
+        }
+
+        isc::data::ConstElementPtr overflow_ptr = output_option->get("overflow-policy");
+        if (overflow_ptr) {
+            const std::string& policy = overflow_ptr->stringValue();
+            if ((policy != "block") && (policy != "drop")) {
+                isc_throw(BadValue, "Unsupported overflow-policy value '"
+                          << policy << "', expected block or drop ("
+                          << overflow_ptr->getPosition() << ")");
+            }
+            dest.overflow_policy_ = policy;
+        }
+
         destination.push_back(dest);
     }
 }
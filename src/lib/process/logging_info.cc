@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,6 +7,7 @@
 #include <config.h>
 #include <process/logging_info.h>
 #include <process/daemon.h>
+#include <log/log_rate_limiter.h>
 #include <log/logger_name.h>
 
 using namespace isc::log;
@@ -20,7 +21,10 @@ LoggingDestination::equals(const LoggingDestination& other) const {
     return (output_ == other.output_ &&
             maxver_ == other.maxver_ &&
             maxsize_ == other.maxsize_ &&
-            flush_ == other.flush_);
+            flush_ == other.flush_ &&
+            async_ == other.async_ &&
+            queue_size_ == other.queue_size_ &&
+            overflow_policy_ == other.overflow_policy_);
 }
 
 ElementPtr
@@ -35,12 +39,24 @@ LoggingDestination::toElement() const {
     result->set("maxsize", Element::create(static_cast<long long>(maxsize_)));
     // Set flush
     result->set("flush", Element::create(flush_));
+    // Set the asynchronous output parameters when they are not the defaults
+    if (async_) {
+        result->set("async", Element::create(async_));
+    }
+    if (queue_size_ != 1024) {
+        result->set("queue-size",
+                    Element::create(static_cast<long long>(queue_size_)));
+    }
+    if (overflow_policy_ != "block") {
+        result->set("overflow-policy", Element::create(overflow_policy_));
+    }
 
     return(result);
 }
 
 LoggingInfo::LoggingInfo()
-    : name_("kea"), severity_(isc::log::INFO), debuglevel_(0) {
+    : name_("kea"), severity_(isc::log::INFO), debuglevel_(0),
+      rate_limit_() {
     // If configuration Manager is in the verbose mode, we need to modify the
     // default settings.
     if (Daemon::getVerbose()) {
@@ -94,7 +110,8 @@ LoggingInfo::equals(const LoggingInfo& other) const {
     // equality.
     return (name_ == other.name_ &&
             severity_ == other.severity_ &&
-            debuglevel_ == other.debuglevel_);
+            debuglevel_ == other.debuglevel_ &&
+            rate_limit_ == other.rate_limit_);
 }
 
 LoggerSpecification
@@ -106,6 +123,14 @@ LoggingInfo::toSpec() const {
 
     LoggerSpecification spec(name_, severity_, debuglevel_);
 
+    // The rate limit was checked by the parser.
+    if (!rate_limit_.empty()) {
+        unsigned limit = 0;
+        unsigned interval = 1;
+        LogRateLimiter::parse(rate_limit_, limit, interval);
+        spec.setRateLimit(limit, interval);
+    }
+
     // Go over logger destinations and create output options accordingly.
     for (std::vector<LoggingDestination>::const_iterator dest =
              destinations_.begin(); dest != destinations_.end(); ++dest) {
@@ -149,6 +174,11 @@ LoggingInfo::toSpec() const {
         // Copy the immediate flush flag
         option.flush = dest->flush_;
 
+        // Copy the asynchronous output parameters
+        option.async = dest->async_;
+        option.queuesize = dest->queue_size_;
+        option.overflow = getQueueOverflow(dest->overflow_policy_);
+
         // ... and set the destination
         spec.addOutputOption(option);
     }
@@ -201,6 +231,10 @@ LoggingInfo::toElement() const {
     result->set("severity", Element::create(severity));
     // Set debug level
     result->set("debuglevel", Element::create(debuglevel_));
+    // Set rate limit if any
+    if (!rate_limit_.empty()) {
+        result->set("rate-limit", Element::create(rate_limit_));
+    }
     return (result);
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -38,6 +38,18 @@ public:
     /// @brief Immediate flush
     bool flush_;
 
+    /// @brief Write the messages from a separate thread
+    bool async_;
+
+    /// @brief Maximum number of messages waiting to be written when async
+    uint64_t queue_size_;
+
+    /// @brief What to do with a message when the queue is full
+    ///
+    /// Values accepted are: block (wait for room in the queue) and drop
+    /// (drop and count the message).
+    std::string overflow_policy_;
+
     /// @brief Compares two objects for equality.
     ///
     /// @param other Object to be compared with this object.
@@ -47,7 +59,8 @@ public:
 
     /// @brief Default constructor.
     LoggingDestination()
-        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true) {
+        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true),
+          async_(false), queue_size_(1024), overflow_policy_("block") {
     }
 
     /// @brief Unparse a configuration object
@@ -67,11 +80,15 @@ public:
 ///                    "output": "/path/to/the/logfile.log",
 ///                    "maxver": 8,
 ///                    "maxsize": 204800,
-///                    "flush": true
+///                    "flush": true,
+///                    "async": true,
+///                    "queue-size": 4096,
+///                    "overflow-policy": "drop"
 ///                }
 ///            ],
 ///            "severity": "WARN",
-///            "debuglevel": 99
+///            "debuglevel": 99,
+///            "rate-limit": "100/s"
 ///        },
 class LoggingInfo : public isc::data::UserContext, public isc::data::CfgToElement {
 public:
@@ -87,6 +104,12 @@ public:
     /// We use range 0(least verbose)..99(most verbose)
     int debuglevel_;
 
+    /// @brief rate limit of the messages with the same ID
+    ///
+    /// Given as "<count>/<interval>", e.g. "100/s". Empty when the logger
+    /// is not rate limited.
+    std::string rate_limit_;
+
     /// @brief specific logging destinations
     std::vector<LoggingDestination> destinations_;
 
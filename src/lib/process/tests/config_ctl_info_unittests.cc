@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -145,6 +145,31 @@ TEST(ConfigControlInfo, basicOperation) {
     EXPECT_EQ(0, ctl.getConfigDatabases().size());
 }
 
+// Verifies that the interval between fetches of configuration updates
+// can be set and is reset to the default by clear().
+TEST(ConfigControlInfo, configFetchWaitTime) {
+
+    ConfigControlInfo ctl;
+    EXPECT_EQ(ConfigControlInfo::DEFAULT_CONFIG_FETCH_WAIT_TIME,
+              ctl.getConfigFetchWaitTime());
+
+    ctl.setConfigFetchWaitTime(5);
+    EXPECT_EQ(5, ctl.getConfigFetchWaitTime());
+
+    // The copy should have the same interval and compare equal.
+    ConfigControlInfo ctl2(ctl);
+    EXPECT_EQ(5, ctl2.getConfigFetchWaitTime());
+    EXPECT_TRUE(ctl.equals(ctl2));
+
+    // Different intervals make the objects unequal.
+    ctl2.setConfigFetchWaitTime(10);
+    EXPECT_FALSE(ctl.equals(ctl2));
+
+    ctl.clear();
+    EXPECT_EQ(ConfigControlInfo::DEFAULT_CONFIG_FETCH_WAIT_TIME,
+              ctl.getConfigFetchWaitTime());
+}
+
 // Verifies the copy ctor and equality functions ConfigControlInfo
 TEST(ConfigControlInfo, copyAndEquality) {
 
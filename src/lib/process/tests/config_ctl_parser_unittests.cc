@@ -1,4 +1,4 @@
-// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2018-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -37,7 +37,10 @@ TEST(ConfigCtlInfoParser, validConfigs) {
        "        \"user\":\"bob\", \n"
        "        \"password\":\"wonder\" \n"
        "    } \n"
-       "] } \n"
+       "] } \n",
+
+       "{ \"config-databases\": [], \n"
+       "  \"config-fetch-wait-time\": 5 }"
     };
 
     for (auto config : configs) {
@@ -75,6 +78,8 @@ TEST(ConfigCtlInfoParser, invalidConfigs) {
     // Note that configurations are must be valid JSON, but invalid logically.
     std::string configs[] = {
        "{ \"config-databases\": \"not_list\" }",
+       "{ \"config-fetch-wait-time\": -1 }",
+       "{ \"config-fetch-wait-time\": \"30\" }",
        "{ \"config-databases\": [ \n"
        "    { \n"
        "        \"bogus\": \"param\" \n"
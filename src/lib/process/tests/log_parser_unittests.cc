@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,6 +9,7 @@
 #include <process/log_parser.h>
 #include <process/process_messages.h>
 #include <exceptions/exceptions.h>
+#include <log/log_rate_limiter.h>
 #include <log/logger_support.h>
 #include <process/d_log.h>
 #include <testutils/io_utils.h>
@@ -339,6 +340,178 @@ TEST_F(LoggingTest, logRotate) {
     wipeFiles();
 }
 
+// Checks that the rate limit of a logger is parsed, unparsed and applied.
+TEST_F(LoggingTest, rateLimit) {
+
+    const char* config_txt =
+    "{ \"loggers\": ["
+    "    {"
+    "        \"name\": \"kea.packets\","
+    "        \"output_options\": ["
+    "            {"
+    "                \"output\": \"stdout\""
+    "            }"
+    "        ],"
+    "        \"severity\": \"INFO\","
+    "        \"rate-limit\": \"100/s\""
+    "    },"
+    "    {"
+    "        \"name\": \"kea\","
+    "        \"severity\": \"INFO\""
+    "    }"
+    "]}";
+
+    ConfigPtr storage(new ConfigBase());
+    LogConfigParser parser(storage);
+    ConstElementPtr config = Element::fromJSON(config_txt);
+    config = config->get("loggers");
+
+    ASSERT_NO_THROW(parser.parseConfiguration(config));
+    ASSERT_EQ(2, storage->getLoggingInfo().size());
+    EXPECT_EQ("100/s", storage->getLoggingInfo()[0].rate_limit_);
+    EXPECT_TRUE(storage->getLoggingInfo()[1].rate_limit_.empty());
+
+    // The rate limit is unparsed only when it is set.
+    ConstElementPtr unparsed = storage->getLoggingInfo()[0].toElement();
+    ASSERT_TRUE(unparsed->get("rate-limit"));
+    EXPECT_EQ("100/s", unparsed->get("rate-limit")->stringValue());
+    EXPECT_FALSE(storage->getLoggingInfo()[1].toElement()->get("rate-limit"));
+
+    // The rate limit is part of the equality.
+    LoggingInfo other = storage->getLoggingInfo()[0];
+    EXPECT_TRUE(other == storage->getLoggingInfo()[0]);
+    other.rate_limit_ = "10/m";
+    EXPECT_FALSE(other == storage->getLoggingInfo()[0]);
+
+    // The rate limit is converted into the logger specification.
+    isc::log::LoggerSpecification spec = other.toSpec();
+    EXPECT_EQ(10, spec.getRateLimit());
+    EXPECT_EQ(60, spec.getRateInterval());
+    spec = storage->getLoggingInfo()[1].toSpec();
+    EXPECT_EQ(0, spec.getRateLimit());
+
+    // Applying the configuration sets the limit.
+    ASSERT_NO_THROW(storage->applyLoggingCfg());
+    EXPECT_TRUE(isc::log::LogRateLimiter::instance().getLimit("kea.packets"));
+    EXPECT_FALSE(isc::log::LogRateLimiter::instance().getLimit("kea"));
+}
+
+// Checks that an invalid rate limit is rejected.
+TEST_F(LoggingTest, invalidRateLimit) {
+
+    const char* invalid[] = { "100", "0/s", "100/d", "1/0s", "100/ s", "x/s" };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        std::ostringstream os;
+        os << "[ { \"name\": \"kea\", \"severity\": \"INFO\","
+           << " \"rate-limit\": \"" << invalid[i] << "\" } ]";
+        ConfigPtr storage(new ConfigBase());
+        LogConfigParser parser(storage);
+        EXPECT_THROW(parser.parseConfiguration(Element::fromJSON(os.str())),
+                     BadValue) << invalid[i];
+    }
+
+    // The rate limit must be a string.
+    ConfigPtr storage(new ConfigBase());
+    LogConfigParser parser(storage);
+    EXPECT_THROW(parser.parseConfiguration(Element::fromJSON(
+        "[ { \"name\": \"kea\", \"severity\": \"INFO\","
+        " \"rate-limit\": 100 } ]")), BadValue);
+}
+
+// Checks that the asynchronous output parameters are parsed, unparsed and
+// converted into the logger specification.
+TEST_F(LoggingTest, asyncOutput) {
+
+    const char* config_txt =
+    "{ \"loggers\": ["
+    "    {"
+    "        \"name\": \"kea\","
+    "        \"output_options\": ["
+    "            {"
+    "                \"output\": \"logfile.txt\","
+    "                \"async\": true,"
+    "                \"queue-size\": 4096,"
+    "                \"overflow-policy\": \"drop\""
+    "            },"
+    "            {"
+    "                \"output\": \"stdout\""
+    "            }"
+    "        ],"
+    "        \"severity\": \"INFO\""
+    "    }"
+    "]}";
+
+    ConfigPtr storage(new ConfigBase());
+    LogConfigParser parser(storage);
+    ConstElementPtr config = Element::fromJSON(config_txt);
+    config = config->get("loggers");
+
+    ASSERT_NO_THROW(parser.parseConfiguration(config));
+    ASSERT_EQ(1, storage->getLoggingInfo().size());
+    const LoggingInfo& info = storage->getLoggingInfo()[0];
+    ASSERT_EQ(2, info.destinations_.size());
+    EXPECT_TRUE(info.destinations_[0].async_);
+    EXPECT_EQ(4096, info.destinations_[0].queue_size_);
+    EXPECT_EQ("drop", info.destinations_[0].overflow_policy_);
+
+    // The defaults.
+    EXPECT_FALSE(info.destinations_[1].async_);
+    EXPECT_EQ(1024, info.destinations_[1].queue_size_);
+    EXPECT_EQ("block", info.destinations_[1].overflow_policy_);
+
+    // The parameters are unparsed only when they are not the defaults.
+    ConstElementPtr unparsed = info.destinations_[0].toElement();
+    ASSERT_TRUE(unparsed->get("async"));
+    EXPECT_TRUE(unparsed->get("async")->boolValue());
+    ASSERT_TRUE(unparsed->get("queue-size"));
+    EXPECT_EQ(4096, unparsed->get("queue-size")->intValue());
+    ASSERT_TRUE(unparsed->get("overflow-policy"));
+    EXPECT_EQ("drop", unparsed->get("overflow-policy")->stringValue());
+    unparsed = info.destinations_[1].toElement();
+    EXPECT_FALSE(unparsed->get("async"));
+    EXPECT_FALSE(unparsed->get("queue-size"));
+    EXPECT_FALSE(unparsed->get("overflow-policy"));
+
+    // The parameters are part of the equality.
+    LoggingDestination other = info.destinations_[0];
+    EXPECT_TRUE(other.equals(info.destinations_[0]));
+    other.overflow_policy_ = "block";
+    EXPECT_FALSE(other.equals(info.destinations_[0]));
+
+    // The parameters are passed to the output options.
+    isc::log::LoggerSpecification spec = info.toSpec();
+    ASSERT_EQ(2, spec.optionCount());
+    isc::log::LoggerSpecification::const_iterator opt = spec.begin();
+    EXPECT_TRUE(opt->async);
+    EXPECT_EQ(4096, opt->queuesize);
+    EXPECT_EQ(isc::log::OutputOption::QUEUE_DROP, opt->overflow);
+    ++opt;
+    EXPECT_FALSE(opt->async);
+    EXPECT_EQ(isc::log::OutputOption::QUEUE_BLOCK, opt->overflow);
+}
+
+// Checks that invalid asynchronous output parameters are rejected.
+TEST_F(LoggingTest, invalidAsyncOutput) {
+
+    const char* invalid[] = {
+        "\"queue-size\": 0",
+        "\"queue-size\": -1",
+        "\"overflow-policy\": \"random\"",
+        "\"overflow-policy\": 1",
+        "\"async\": \"yes\""
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        std::ostringstream os;
+        os << "[ { \"name\": \"kea\", \"severity\": \"INFO\","
+           << " \"output_options\": [ { \"output\": \"stdout\", "
+           << invalid[i] << " } ] } ]";
+        ConfigPtr storage(new ConfigBase());
+        LogConfigParser parser(storage);
+        EXPECT_THROW(parser.parseConfiguration(Element::fromJSON(os.str())),
+                     isc::Exception) << invalid[i];
+    }
+}
+
 /// @todo Add tests for malformed logging configuration
 
 /// @todo There is no easy way to test applyConfiguration() and defaultLogging().
@@ -0,0 +1,111 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/histogram.h>
+#include <util/boost_time_utils.h>
+#include <exceptions/exceptions.h>
+#include <boost/date_time/c_local_time_adjustor.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <algorithm>
+#include <limits>
+
+using namespace isc::data;
+using namespace boost::posix_time;
+
+namespace isc {
+namespace stats {
+
+Histogram::Histogram(const std::string& name)
+    :name_(name) {
+    reset();
+}
+
+void Histogram::addSample(const StatsDuration& value, const ptime& timestamp) {
+    addSample(static_cast<int64_t>(value.total_microseconds()), timestamp);
+}
+
+void Histogram::addSample(int64_t usecs, const ptime& timestamp) {
+    if (usecs < 0) {
+        usecs = 0;
+    }
+    ++buckets_[getBucketIndex(usecs)];
+    ++count_;
+    total_ += usecs;
+    if (usecs > max_) {
+        max_ = usecs;
+    }
+    timestamp_ = timestamp;
+}
+
+void Histogram::reset() {
+    count_ = 0;
+    total_ = 0;
+    max_ = 0;
+    std::fill(buckets_, buckets_ + BUCKETS, 0);
+    timestamp_ = microsec_clock::universal_time();
+}
+
+uint64_t Histogram::getBucket(size_t index) const {
+    if (index >= BUCKETS) {
+        isc_throw(OutOfRange, "histogram bucket " << index
+                  << " out of range, there are " << BUCKETS << " buckets");
+    }
+    return (buckets_[index]);
+}
+
+size_t Histogram::getBucketIndex(int64_t usecs) {
+    // The index is the number of significant bits of the duration.
+    size_t index = 0;
+    while ((usecs > 0) && (index < BUCKETS - 1)) {
+        usecs >>= 1;
+        ++index;
+    }
+    return (index);
+}
+
+int64_t Histogram::getUpperBound(size_t index) {
+    if (index >= BUCKETS) {
+        isc_throw(OutOfRange, "histogram bucket " << index
+                  << " out of range, there are " << BUCKETS << " buckets");
+    }
+    if (index == BUCKETS - 1) {
+        return (std::numeric_limits<int64_t>::max());
+    }
+    return (static_cast<int64_t>(1) << index);
+}
+
+ConstElementPtr Histogram::getJSON() const {
+    ElementPtr value = Element::createMap();
+    value->set("count", Element::create(static_cast<int64_t>(count_)));
+    value->set("total-usecs", Element::create(total_));
+    value->set("max-usecs", Element::create(max_));
+    ElementPtr buckets = Element::createList();
+    for (size_t i = 0; i < BUCKETS; ++i) {
+        if (buckets_[i] == 0) {
+            continue;
+        }
+        ElementPtr bucket = Element::createList();
+        bucket->add(Element::create(getUpperBound(i)));
+        bucket->add(Element::create(static_cast<int64_t>(buckets_[i])));
+        buckets->add(bucket);
+    }
+    value->set("buckets", buckets);
+
+    ElementPtr entry = Element::createList();
+    entry->add(value);
+    typedef boost::date_time::c_local_adjustor<ptime> local_adjustor;
+    entry->add(Element::create(isc::util::ptimeToText(
+        local_adjustor::utc_to_local(timestamp_))));
+
+    ElementPtr list = Element::createList();
+    list->add(entry);
+    return (list);
+}
+
+};
+};
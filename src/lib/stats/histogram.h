@@ -0,0 +1,155 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef HISTOGRAM_H
+#define HISTOGRAM_H
+
+#include <cc/data.h>
+#include <stats/observation.h>
+#include <boost/shared_ptr.hpp>
+#include <boost/date_time/posix_time/posix_time_types.hpp>
+#include <string>
+#include <stdint.h>
+
+namespace isc {
+namespace stats {
+
+/// @brief Distribution of durations (a latency histogram)
+///
+/// Unlike @ref Observation, which holds the value of a statistic, a
+/// histogram counts the durations falling in buckets which bounds are
+/// powers of two microseconds: the bucket i holds the durations which are
+/// lower than 2^i microseconds and not lower than the bound of the bucket
+/// i - 1. The last bucket holds all the longer durations. The buckets cover
+/// the range from a microsecond to about twenty minutes with a constant
+/// relative precision, so adding a sample is a few arithmetic operations
+/// and the histogram has a fixed size.
+///
+/// The histogram also holds the number of samples, their sum and the
+/// longest duration, so as the mean can be computed.
+class Histogram {
+public:
+
+    /// @brief Number of buckets.
+    static const size_t BUCKETS = 32;
+
+    /// @brief Constructor
+    ///
+    /// Creates an empty histogram.
+    ///
+    /// @param name name of the histogram
+    Histogram(const std::string& name);
+
+    /// @brief Adds a duration to the histogram.
+    ///
+    /// The time of the sample is given by the caller, which usually has
+    /// it at hand (e.g. the time a packet was sent), so the clock is not
+    /// read for each sample.
+    ///
+    /// @param value duration to be added. Negative durations (e.g. when
+    /// the clock was set back) are counted as zero.
+    /// @param timestamp UTC time of the sample.
+    void addSample(const StatsDuration& value,
+                   const boost::posix_time::ptime& timestamp);
+
+    /// @brief Adds a duration in microseconds to the histogram.
+    ///
+    /// @param usecs duration to be added in microseconds.
+    /// @param timestamp UTC time of the sample.
+    void addSample(int64_t usecs, const boost::posix_time::ptime& timestamp);
+
+    /// @brief Removes all samples.
+    void reset();
+
+    /// @brief Returns the number of samples.
+    uint64_t getCount() const {
+        return (count_);
+    }
+
+    /// @brief Returns the sum of the samples in microseconds.
+    int64_t getTotal() const {
+        return (total_);
+    }
+
+    /// @brief Returns the longest sample in microseconds.
+    int64_t getMax() const {
+        return (max_);
+    }
+
+    /// @brief Returns the number of samples in a bucket.
+    ///
+    /// @param index index of the bucket
+    /// @throw isc::OutOfRange if the index is not lower than @ref BUCKETS
+    uint64_t getBucket(size_t index) const;
+
+    /// @brief Returns the index of the bucket holding a duration.
+    ///
+    /// @param usecs duration in microseconds
+    /// @return index of the bucket
+    static size_t getBucketIndex(int64_t usecs);
+
+    /// @brief Returns the upper bound of a bucket.
+    ///
+    /// @param index index of the bucket
+    /// @return the (exclusive) upper bound of the bucket in microseconds,
+    /// the highest int64_t value for the last bucket.
+    /// @throw isc::OutOfRange if the index is not lower than @ref BUCKETS
+    static int64_t getUpperBound(size_t index);
+
+    /// @brief Returns the UTC time of the last sample.
+    const boost::posix_time::ptime& getTimestamp() const {
+        return (timestamp_);
+    }
+
+    /// @brief Returns the histogram as a JSON structure.
+    ///
+    /// The structure has the same layout as the one returned by
+    /// @ref Observation::getJSON, a list of samples each being a list of
+    /// a value and a timestamp, with the value being a map:
+    /// @code
+    /// [ [ { "count": 3, "total-usecs": 2500, "max-usecs": 1500,
+    ///       "buckets": [ [ 1024, 2 ], [ 2048, 1 ] ] },
+    ///     "2019-07-30 10:04:28.386733" ] ]
+    /// @endcode
+    /// Only the buckets holding samples are listed, each as its upper
+    /// bound in microseconds and its number of samples. The timestamp is
+    /// given in local time, as for the observations.
+    ///
+    /// @return a JSON structure representing the histogram
+    isc::data::ConstElementPtr getJSON() const;
+
+    /// @brief Returns the name of the histogram.
+    std::string getName() const {
+        return (name_);
+    }
+
+private:
+    /// @brief Name of the histogram.
+    std::string name_;
+
+    /// @brief Number of samples.
+    uint64_t count_;
+
+    /// @brief Sum of the samples in microseconds.
+    int64_t total_;
+
+    /// @brief Longest sample in microseconds.
+    int64_t max_;
+
+    /// @brief Number of samples in each bucket.
+    uint64_t buckets_[BUCKETS];
+
+    /// @brief UTC time of the last sample (or of the creation or reset).
+    boost::posix_time::ptime timestamp_;
+};
+
+/// @brief Histogram pointer
+typedef boost::shared_ptr<Histogram> HistogramPtr;
+
+};
+};
+
+#endif // HISTOGRAM_H
@@ -1,4 +1,4 @@
-// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,10 +11,145 @@
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
 
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
 using namespace std;
 using namespace isc::data;
 using namespace isc::config;
 
+namespace {
+
+/// @brief Replaces characters not allowed in Prometheus names.
+///
+/// @param name Name to be sanitized.
+/// @param colon_allowed Indicates whether colons are allowed, which is the
+/// case for metric names but not for label names.
+/// @return Name with invalid characters replaced by underscores.
+std::string
+prometheusName(const std::string& name, const bool colon_allowed) {
+    std::string result(name);
+    for (auto c = result.begin(); c != result.end(); ++c) {
+        if (!isalnum(static_cast<unsigned char>(*c)) && (*c != '_') &&
+            (!colon_allowed || (*c != ':'))) {
+            *c = '_';
+        }
+    }
+    return (result);
+}
+
+/// @brief Metric to be written by @c StatsMgr::exportPrometheus.
+struct PrometheusMetric {
+    /// @brief Metric name, e.g. kea_assigned_addresses.
+    std::string name_;
+    /// @brief Comma separated labels, e.g. subnet="1".
+    std::string labels_;
+    /// @brief Observation holding the value.
+    isc::stats::ObservationPtr obs_;
+    /// @brief Histogram, when the metric is not an observation.
+    isc::stats::HistogramPtr histogram_;
+};
+
+/// @brief Converts statistic name to the Prometheus metric name and labels.
+///
+/// Leading context[index]. parts of the statistic name are converted to
+/// labels, the remaining part is converted to the metric name.
+///
+/// @param name Statistic name, e.g. subnet[1].assigned-addresses.
+/// @param [out] metric Metric to be updated.
+void
+toPrometheusMetric(const std::string& name, PrometheusMetric& metric) {
+    size_t pos = 0;
+    for (;;) {
+        const size_t open = name.find('[', pos);
+        if ((open == std::string::npos) || (open == pos)) {
+            break;
+        }
+        const size_t close = name.find(']', open);
+        if ((close == std::string::npos) || (close + 1 >= name.size()) ||
+            (name[close + 1] != '.') ||
+            (name.find('.', pos) < open)) {
+            break;
+        }
+        if (!metric.labels_.empty()) {
+            metric.labels_.push_back(',');
+        }
+        metric.labels_ += prometheusName(name.substr(pos, open - pos), false);
+        metric.labels_ += "=\"";
+        // Escape the label value as required by the exposition format.
+        for (size_t i = open + 1; i < close; ++i) {
+            if ((name[i] == '\\') || (name[i] == '"')) {
+                metric.labels_.push_back('\\');
+            }
+            metric.labels_.push_back(name[i]);
+        }
+        metric.labels_.push_back('"');
+        pos = close + 2;
+    }
+    metric.name_ = "kea_" + prometheusName(name.substr(pos), true);
+}
+
+/// @brief Writes floating point value in the Prometheus format.
+///
+/// @param os Output stream.
+/// @param value Value to be written.
+void
+writePrometheusValue(std::ostream& os, const double value) {
+    if (std::isnan(value)) {
+        os << "NaN";
+    } else if (std::isinf(value)) {
+        os << (value > 0 ? "+Inf" : "-Inf");
+    } else {
+        const std::streamsize precision = os.precision();
+        os << std::setprecision(std::numeric_limits<double>::digits10)
+           << value << std::setprecision(precision);
+    }
+}
+
+/// @brief Writes a histogram in the Prometheus format.
+///
+/// The histogram is written as the cumulative counts of its buckets, named
+/// with the _bucket suffix and labelled with their (inclusive) upper bounds
+/// in seconds, followed by the sum of the samples in seconds and the number
+/// of samples, named with the _sum and _count suffixes.
+///
+/// @param os Output stream.
+/// @param metric Metric holding the histogram.
+void
+writePrometheusHistogram(std::ostream& os,
+                         const PrometheusMetric& metric) {
+    using isc::stats::Histogram;
+    const std::string labels = (metric.labels_.empty() ? "" :
+                                metric.labels_ + ",");
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < Histogram::BUCKETS; ++i) {
+        cumulative += metric.histogram_->getBucket(i);
+        os << metric.name_ << "_bucket{" << labels << "le=\"";
+        if (i == Histogram::BUCKETS - 1) {
+            os << "+Inf";
+        } else {
+            // The bucket bound is exclusive and the samples are whole
+            // microseconds.
+            writePrometheusValue(os, static_cast<double>(
+                Histogram::getUpperBound(i) - 1) / 1000000);
+        }
+        os << "\"} " << cumulative << "\n";
+    }
+    const std::string braced_labels = (metric.labels_.empty() ? "" :
+                                       "{" + metric.labels_ + "}");
+    os << metric.name_ << "_sum" << braced_labels << " ";
+    writePrometheusValue(os, static_cast<double>(metric.histogram_->
+                                                 getTotal()) / 1000000);
+    os << "\n";
+    os << metric.name_ << "_count" << braced_labels << " "
+       << metric.histogram_->getCount() << "\n";
+}
+
+}
+
 namespace isc {
 namespace stats {
 
@@ -24,7 +159,7 @@ StatsMgr& StatsMgr::instance() {
 }
 
 StatsMgr::StatsMgr()
-    :global_(new StatContext()) {
+    :global_(new StatContext()), histograms_() {
 
 }
 
@@ -59,6 +194,30 @@ void StatsMgr::addValue(const std::string& name, const std::string& value) {
     addValueInternal(name, value);
 }
 
+void StatsMgr::addHistogramSample(const std::string& name,
+                                  const StatsDuration& value,
+                                  const boost::posix_time::ptime& timestamp) {
+    std::map<std::string, HistogramPtr>::iterator h = histograms_.find(name);
+    if (h == histograms_.end()) {
+        if (getObservation(name)) {
+            isc_throw(InvalidStatType, "Statistic '" << name
+                      << "' is not a histogram");
+        }
+        h = histograms_.insert(std::make_pair(name, HistogramPtr(
+                                   new Histogram(name)))).first;
+    }
+    h->second->addSample(value, timestamp);
+}
+
+HistogramPtr StatsMgr::getHistogram(const std::string& name) const {
+    std::map<std::string, HistogramPtr>::const_iterator h =
+        histograms_.find(name);
+    if (h == histograms_.end()) {
+        return (HistogramPtr());
+    }
+    return (h->second);
+}
+
 ObservationPtr StatsMgr::getObservation(const std::string& name) const {
     /// @todo: Implement contexts.
     // Currently we keep everything in a global context.
@@ -66,6 +225,11 @@ ObservationPtr StatsMgr::getObservation(const std::string& name) const {
 }
 
 void StatsMgr::addObservation(const ObservationPtr& stat) {
+    if (histograms_.count(stat->getName()) > 0) {
+        isc_throw(InvalidStatType, "Statistic '" << stat->getName()
+                  << "' is a histogram");
+    }
+
     /// @todo: Implement contexts.
     // Currently we keep everything in a global context.
     return (global_->add(stat));
@@ -91,17 +255,22 @@ bool StatsMgr::reset(const std::string& name) {
     if (obs) {
         obs->reset();
         return (true);
-    } else {
-        return (false);
     }
+    HistogramPtr histogram = getHistogram(name);
+    if (histogram) {
+        histogram->reset();
+        return (true);
+    }
+    return (false);
 }
 
 bool StatsMgr::del(const std::string& name) {
-    return (global_->del(name));
+    return (global_->del(name) || (histograms_.erase(name) > 0));
 }
 
 void StatsMgr::removeAll() {
     global_->stats_.clear();
+    histograms_.clear();
 }
 
 isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
@@ -109,6 +278,11 @@ isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
     ObservationPtr obs = getObservation(name);
     if (obs) {
         response->set(name, obs->getJSON()); // that contains the observation
+    } else {
+        HistogramPtr histogram = getHistogram(name);
+        if (histogram) {
+            response->set(name, histogram->getJSON());
+        }
     }
     return (response);
 }
@@ -123,9 +297,88 @@ isc::data::ConstElementPtr StatsMgr::getAll() const {
         // ... and add each of them to the map.
         map->set(s->first, s->second->getJSON());
     }
+    for (std::map<std::string, HistogramPtr>::const_iterator h =
+             histograms_.begin(); h != histograms_.end(); ++h) {
+        map->set(h->first, h->second->getJSON());
+    }
     return (map);
 }
 
+size_t StatsMgr::exportPrometheus(std::ostream& os,
+                                  const std::string& prefix) const {
+    // A prefix ending in a context index selects this index up to the
+    // closing bracket, so as "subnet[1" doesn't select "subnet[10]".
+    std::string selector = prefix;
+    const size_t index_start = selector.rfind('[');
+    if ((index_start != std::string::npos) &&
+        (index_start + 1 < selector.size()) &&
+        (selector.find(']', index_start) == std::string::npos)) {
+        selector.push_back(']');
+    }
+
+    // Statistics are held in the ordered map, so the ones sharing the
+    // prefix are adjacent.
+    std::vector<PrometheusMetric> metrics;
+    for (auto s = global_->stats_.lower_bound(selector);
+         (s != global_->stats_.end()) &&
+             (s->first.compare(0, selector.size(), selector) == 0); ++s) {
+        if (s->second->getType() == Observation::STAT_STRING) {
+            continue;
+        }
+        metrics.push_back(PrometheusMetric());
+        metrics.back().obs_ = s->second;
+        toPrometheusMetric(s->first, metrics.back());
+    }
+    for (auto h = histograms_.lower_bound(selector);
+         (h != histograms_.end()) &&
+             (h->first.compare(0, selector.size(), selector) == 0); ++h) {
+        metrics.push_back(PrometheusMetric());
+        metrics.back().histogram_ = h->second;
+        toPrometheusMetric(h->first, metrics.back());
+    }
+
+    // The exposition format requires that all samples of a metric are
+    // written together, while statistics of various subnets interleave.
+    std::stable_sort(metrics.begin(), metrics.end(),
+                     [](const PrometheusMetric& a, const PrometheusMetric& b) {
+                         return (a.name_ < b.name_);
+                     });
+
+    for (size_t i = 0; i < metrics.size(); ++i) {
+        const PrometheusMetric& metric = metrics[i];
+        if ((i == 0) || (metric.name_ != metrics[i - 1].name_)) {
+            os << "# TYPE " << metric.name_
+               << (metric.histogram_ ? " histogram\n" : " untyped\n");
+        }
+        if (metric.histogram_) {
+            writePrometheusHistogram(os, metric);
+            continue;
+        }
+        os << metric.name_;
+        if (!metric.labels_.empty()) {
+            os << "{" << metric.labels_ << "}";
+        }
+        os << " ";
+        switch (metric.obs_->getType()) {
+        case Observation::STAT_INTEGER:
+            os << metric.obs_->getInteger().first;
+            break;
+        case Observation::STAT_FLOAT:
+            writePrometheusValue(os, metric.obs_->getFloat().first);
+            break;
+        case Observation::STAT_DURATION:
+            writePrometheusValue(os, static_cast<double>(metric.obs_->
+                getDuration().first.total_microseconds()) / 1000000);
+            break;
+        default:
+            // String statistics have been filtered out above.
+            ;
+        }
+        os << "\n";
+    }
+    return (metrics.size());
+}
+
 void StatsMgr::resetAll() {
     // Let's iterate over all stored statistics...
     for (std::map<std::string, ObservationPtr>::iterator s = global_->stats_.begin();
@@ -134,10 +387,14 @@ void StatsMgr::resetAll() {
         // ... and reset each statistic.
         s->second->reset();
     }
+    for (std::map<std::string, HistogramPtr>::iterator h = histograms_.begin();
+         h != histograms_.end(); ++h) {
+        h->second->reset();
+    }
 }
 
 size_t StatsMgr::count() const {
-    return (global_->stats_.size());
+    return (global_->stats_.size() + histograms_.size());
 }
 
 isc::data::ConstElementPtr
@@ -200,6 +457,27 @@ StatsMgr::statisticGetAllHandler(const std::string& /*name*/,
     return (createAnswer(CONTROL_RESULT_SUCCESS, all_stats));
 }
 
+isc::data::ConstElementPtr
+StatsMgr::statisticExportHandler(const std::string& /*name*/,
+                                 const isc::data::ConstElementPtr& params) {
+    std::string prefix;
+    if (params) {
+        ConstElementPtr stat_prefix = params->get("prefix");
+        if (stat_prefix) {
+            if (stat_prefix->getType() != Element::string) {
+                return (createAnswer(CONTROL_RESULT_ERROR,
+                                     "'prefix' parameter expected to be a string."));
+            }
+            prefix = stat_prefix->stringValue();
+        }
+    }
+    std::ostringstream s;
+    instance().exportPrometheus(s, prefix);
+    ElementPtr args = Element::createMap();
+    args->set("prometheus", Element::create(s.str()));
+    return (createAnswer(CONTROL_RESULT_SUCCESS, args));
+}
+
 isc::data::ConstElementPtr
 StatsMgr::statisticResetAllHandler(const std::string& /*name*/,
                                    const isc::data::ConstElementPtr& /*params*/) {
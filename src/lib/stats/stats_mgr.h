@@ -1,4 +1,4 @@
-// Copyright (C) 2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -9,9 +9,11 @@
 
 #include <stats/observation.h>
 #include <stats/context.h>
+#include <stats/histogram.h>
 #include <boost/noncopyable.hpp>
 
 #include <map>
+#include <ostream>
 #include <string>
 #include <vector>
 #include <sstream>
@@ -126,6 +128,22 @@ class StatsMgr : public boost::noncopyable {
     /// @throw InvalidStatType if statistic is not a string
     void addValue(const std::string& name, const std::string& value);
 
+    /// @brief Records a duration in a histogram.
+    ///
+    /// Histograms are statistics holding the distribution of durations,
+    /// e.g. of the packet processing latency, rather than a value (see
+    /// @ref Histogram). They share the name space of the other statistics
+    /// and are returned, reset and removed in the same way.
+    ///
+    /// @param name name of the histogram
+    /// @param value duration observed
+    /// @param timestamp UTC time of the observation
+    /// @throw InvalidStatType if a statistic which is not a histogram has
+    /// this name
+    void addHistogramSample(const std::string& name,
+                            const StatsDuration& value,
+                            const boost::posix_time::ptime& timestamp);
+
     /// @brief Determines maximum age of samples.
     ///
     /// Specifies that statistic name should be stored not as a single value,
@@ -198,6 +216,35 @@ class StatsMgr : public boost::noncopyable {
     /// @return JSON structures representing all statistics
     isc::data::ConstElementPtr getAll() const;
 
+    /// @brief Writes current values of statistics in the Prometheus text
+    /// exposition format.
+    ///
+    /// Unlike @ref getAll this doesn't build any JSON structures and only
+    /// the most recent sample of each statistic is written. Statistics
+    /// are selected by name prefix, which is cheap because they are held
+    /// in an ordered map.
+    ///
+    /// The statistic name is converted to the metric name by prepending
+    /// "kea_" and replacing characters not allowed by Prometheus with
+    /// underscores. Context indexes become labels, e.g.
+    /// subnet[1].assigned-addresses is written as
+    /// kea_assigned_addresses{subnet="1"}. Durations are written in
+    /// seconds. String statistics have no numeric value and are skipped.
+    /// Histograms are written as Prometheus histograms: the cumulative
+    /// counts of the buckets, labelled with their upper bounds in seconds,
+    /// and the sum and the number of the samples, with the _bucket, _sum
+    /// and _count suffixes.
+    ///
+    /// @param os Stream to which the statistics are written.
+    /// @param prefix Only statistics which names start with this prefix
+    /// are written. A prefix ending in a context index is matched up to
+    /// the closing bracket, e.g. "subnet[1" selects the statistics of
+    /// subnet 1 and not those of subnet 10. All statistics are written
+    /// if it is empty.
+    /// @return Number of statistics (including histograms) written.
+    size_t exportPrometheus(std::ostream& os,
+                            const std::string& prefix = "") const;
+
     /// @}
 
     /// @brief Returns an observation.
@@ -207,6 +254,13 @@ class StatsMgr : public boost::noncopyable {
     /// @return Pointer to the Observation object
     ObservationPtr getObservation(const std::string& name) const;
 
+    /// @brief Returns a histogram.
+    ///
+    /// Used in testing only. Production code should use @ref get() method.
+    /// @param name name of the histogram
+    /// @return Pointer to the Histogram object (or NULL)
+    HistogramPtr getHistogram(const std::string& name) const;
+
     /// @brief Generates statistic name in a given context
     ///
     /// Example:
@@ -301,6 +355,29 @@ class StatsMgr : public boost::noncopyable {
     statisticGetAllHandler(const std::string& name,
                            const isc::data::ConstElementPtr& params);
 
+    /// @brief Handles statistic-export command
+    ///
+    /// This method handles statistic-export command, which returns values
+    /// of statistics in the Prometheus text exposition format. It is much
+    /// cheaper than statistic-get-all, because only current values are
+    /// returned and no JSON structure is built for them. An optional
+    /// "prefix" parameter selects the statistics by the name prefix.
+    /// The text is returned in a JSON string as the control channel
+    /// carries JSON only. The Control Agent serves it to Prometheus as
+    /// text/plain, see GET /metrics in the Control Agent documentation.
+    ///
+    /// Example params structure:
+    /// {
+    ///     "prefix": "subnet[1]."
+    /// }
+    ///
+    /// @param name name of the command (ignored, should be "statistic-export")
+    /// @param params structure containing an optional "prefix" or null
+    /// @return answer with the exported text in the "prometheus" argument
+    static isc::data::ConstElementPtr
+    statisticExportHandler(const std::string& name,
+                           const isc::data::ConstElementPtr& params);
+
     /// @brief Handles statistic-reset-all command
     ///
     /// This method handles statistic-reset-all command, which sets values of
@@ -396,6 +473,7 @@ private:
     /// That's an utility method used by public @ref setValue() and
     /// @ref addValue() methods.
     /// @param stat observation
+    /// @throw InvalidStatType if a histogram has the name of the observation
     void addObservation(const ObservationPtr& stat);
 
     /// @private
@@ -424,6 +502,9 @@ private:
 
     // This is a global context. All statistics will initially be stored here.
     StatContextPtr global_;
+
+    // Histograms by name. They are not observations so they are held apart.
+    std::map<std::string, HistogramPtr> histograms_;
 };
 
 };
@@ -0,0 +1,98 @@
+// Copyright (C) 2019 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <stats/histogram.h>
+#include <exceptions/exceptions.h>
+#include <util/boost_time_utils.h>
+#include <boost/date_time/c_local_time_adjustor.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <gtest/gtest.h>
+
+#include <limits>
+
+using namespace isc;
+using namespace isc::stats;
+using namespace boost::posix_time;
+
+namespace {
+
+// Test that the durations are put in the right buckets.
+TEST(HistogramTest, bucketIndex) {
+    EXPECT_EQ(0, Histogram::getBucketIndex(-1));
+    EXPECT_EQ(0, Histogram::getBucketIndex(0));
+    EXPECT_EQ(1, Histogram::getBucketIndex(1));
+    EXPECT_EQ(2, Histogram::getBucketIndex(2));
+    EXPECT_EQ(2, Histogram::getBucketIndex(3));
+    EXPECT_EQ(3, Histogram::getBucketIndex(4));
+    EXPECT_EQ(10, Histogram::getBucketIndex(1023));
+    EXPECT_EQ(11, Histogram::getBucketIndex(1024));
+    EXPECT_EQ(Histogram::BUCKETS - 1,
+              Histogram::getBucketIndex(std::numeric_limits<int64_t>::max()));
+
+    // Each duration is lower than the upper bound of its bucket and not
+    // lower than the upper bound of the previous one.
+    for (int64_t usecs = 1; usecs < 100000; usecs = usecs * 3 + 1) {
+        size_t index = Histogram::getBucketIndex(usecs);
+        ASSERT_GT(index, 0);
+        EXPECT_LT(usecs, Histogram::getUpperBound(index));
+        EXPECT_GE(usecs, Histogram::getUpperBound(index - 1));
+    }
+
+    EXPECT_EQ(1, Histogram::getUpperBound(0));
+    EXPECT_EQ(std::numeric_limits<int64_t>::max(),
+              Histogram::getUpperBound(Histogram::BUCKETS - 1));
+    EXPECT_THROW(Histogram::getUpperBound(Histogram::BUCKETS), OutOfRange);
+}
+
+// Test that the samples are counted and that the histogram can be reset.
+TEST(HistogramTest, addSample) {
+    Histogram histogram("latency");
+    EXPECT_EQ("latency", histogram.getName());
+    EXPECT_EQ(0, histogram.getCount());
+
+    const ptime now = microsec_clock::universal_time();
+    histogram.addSample(time_duration(0, 0, 0, 1000), now);
+    histogram.addSample(static_cast<int64_t>(1500), now);
+    histogram.addSample(static_cast<int64_t>(10), now);
+    histogram.addSample(static_cast<int64_t>(-5), now + seconds(1));
+
+    EXPECT_EQ(4, histogram.getCount());
+    EXPECT_EQ(now + seconds(1), histogram.getTimestamp());
+    EXPECT_EQ(2510, histogram.getTotal());
+    EXPECT_EQ(1500, histogram.getMax());
+    EXPECT_EQ(1, histogram.getBucket(0));
+    EXPECT_EQ(1, histogram.getBucket(4));
+    EXPECT_EQ(2, histogram.getBucket(10) + histogram.getBucket(11));
+    EXPECT_THROW(histogram.getBucket(Histogram::BUCKETS), OutOfRange);
+
+    histogram.reset();
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getTotal());
+    EXPECT_EQ(0, histogram.getMax());
+    for (size_t i = 0; i < Histogram::BUCKETS; ++i) {
+        EXPECT_EQ(0, histogram.getBucket(i));
+    }
+}
+
+// Test that the histogram is reported as JSON.
+TEST(HistogramTest, getJSON) {
+    Histogram histogram("latency");
+    const ptime now = microsec_clock::universal_time();
+    histogram.addSample(static_cast<int64_t>(1000), now);
+    histogram.addSample(static_cast<int64_t>(1000), now);
+    histogram.addSample(static_cast<int64_t>(1500), now);
+
+    // The timestamp is reported in local time.
+    typedef boost::date_time::c_local_adjustor<ptime> local_adjustor;
+    std::string expected = "[ [ { \"buckets\": [ [ 1024, 2 ], [ 2048, 1 ] ],"
+        " \"count\": 3, \"max-usecs\": 1500, \"total-usecs\": 3500 }, \"" +
+        isc::util::ptimeToText(local_adjustor::utc_to_local(now)) + "\" ] ]";
+    EXPECT_EQ(expected, histogram.getJSON()->str());
+}
+
+}
@@ -1,4 +1,4 @@
-// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -15,6 +15,7 @@
 #include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -288,6 +289,65 @@ TEST_F(StatsMgrTest, removeAll) {
     EXPECT_FALSE(StatsMgr::instance().getObservation("delta"));
 }
 
+// This test checks that histograms can be recorded, reported, reset and
+// removed like the other statistics.
+TEST_F(StatsMgrTest, histogram) {
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(1234));
+    StatsMgr::instance().addHistogramSample("latency",
+                                            time_duration(0, 0, 0, 1000),
+                                            microsec_clock::universal_time());
+    StatsMgr::instance().addHistogramSample("latency",
+                                            time_duration(0, 0, 0, 3000),
+                                            microsec_clock::universal_time());
+    EXPECT_EQ(2, StatsMgr::instance().count());
+
+    HistogramPtr histogram = StatsMgr::instance().getHistogram("latency");
+    ASSERT_TRUE(histogram);
+    EXPECT_EQ(2, histogram->getCount());
+    EXPECT_EQ(4000, histogram->getTotal());
+    EXPECT_FALSE(StatsMgr::instance().getObservation("latency"));
+    EXPECT_FALSE(StatsMgr::instance().getHistogram("alpha"));
+
+    // Names are shared with the other statistics.
+    EXPECT_THROW(StatsMgr::instance().addHistogramSample("alpha",
+                     time_duration(0, 0, 0, 1),
+                     microsec_clock::universal_time()), InvalidStatType);
+    EXPECT_THROW(StatsMgr::instance().setValue("latency",
+                     static_cast<int64_t>(1)), InvalidStatType);
+
+    // Check the reporting.
+    std::string exp_str = histogram->getJSON()->str();
+    EXPECT_EQ("{ \"latency\": " + exp_str + " }",
+              StatsMgr::instance().get("latency")->str());
+    ConstElementPtr rep_all = StatsMgr::instance().getAll();
+    ASSERT_TRUE(rep_all);
+    EXPECT_EQ(2, rep_all->size());
+    ASSERT_TRUE(rep_all->get("latency"));
+    EXPECT_EQ(exp_str, rep_all->get("latency")->str());
+
+    // Check the reset.
+    EXPECT_TRUE(StatsMgr::instance().reset("latency"));
+    EXPECT_EQ(0, histogram->getCount());
+    StatsMgr::instance().addHistogramSample("latency",
+                                            time_duration(0, 0, 0, 1000),
+                                            microsec_clock::universal_time());
+    StatsMgr::instance().resetAll();
+    EXPECT_EQ(0, histogram->getCount());
+    EXPECT_EQ(2, StatsMgr::instance().count());
+
+    // Check the removal.
+    EXPECT_TRUE(StatsMgr::instance().del("latency"));
+    EXPECT_FALSE(StatsMgr::instance().getHistogram("latency"));
+    EXPECT_FALSE(StatsMgr::instance().del("latency"));
+    EXPECT_EQ(1, StatsMgr::instance().count());
+    StatsMgr::instance().addHistogramSample("latency",
+                                            time_duration(0, 0, 0, 1000),
+                                            microsec_clock::universal_time());
+    StatsMgr::instance().removeAll();
+    EXPECT_EQ(0, StatsMgr::instance().count());
+    EXPECT_EQ("{  }", StatsMgr::instance().get("latency")->str());
+}
+
 // This is a performance benchmark that checks how long does it take
 // to increment a single statistic million times.
 //
@@ -511,6 +571,152 @@ TEST_F(StatsMgrTest, commandGetAll) {
     EXPECT_EQ(exp_str_delta, rep_all->get("delta")->str());
 }
 
+// Test checks whether statistics are exported in the Prometheus text
+// exposition format.
+TEST_F(StatsMgrTest, exportPrometheus) {
+    StatsMgr::instance().setValue("pkt4-received", static_cast<int64_t>(12));
+    StatsMgr::instance().setValue("alpha", 12.5);
+    StatsMgr::instance().setValue("gamma", time_duration(0, 0, 3, 500000));
+    StatsMgr::instance().setValue("delta", "Lorem ipsum");
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 1,
+                                  "assigned-addresses"),
+                                  static_cast<int64_t>(5));
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 1,
+                                  "total-addresses"),
+                                  static_cast<int64_t>(100));
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 2,
+                                  "assigned-addresses"),
+                                  static_cast<int64_t>(7));
+
+    // The string statistic is skipped and the samples of the metrics
+    // are grouped together.
+    std::ostringstream s;
+    EXPECT_EQ(6, StatsMgr::instance().exportPrometheus(s));
+    EXPECT_EQ("# TYPE kea_alpha untyped\n"
+              "kea_alpha 12.5\n"
+              "# TYPE kea_assigned_addresses untyped\n"
+              "kea_assigned_addresses{subnet=\"1\"} 5\n"
+              "kea_assigned_addresses{subnet=\"2\"} 7\n"
+              "# TYPE kea_gamma untyped\n"
+              "kea_gamma 3.5\n"
+              "# TYPE kea_pkt4_received untyped\n"
+              "kea_pkt4_received 12\n"
+              "# TYPE kea_total_addresses untyped\n"
+              "kea_total_addresses{subnet=\"1\"} 100\n",
+              s.str());
+
+    // Only statistics of the first subnet.
+    s.str("");
+    EXPECT_EQ(2, StatsMgr::instance().exportPrometheus(s, "subnet[1]."));
+    EXPECT_EQ("# TYPE kea_assigned_addresses untyped\n"
+              "kea_assigned_addresses{subnet=\"1\"} 5\n"
+              "# TYPE kea_total_addresses untyped\n"
+              "kea_total_addresses{subnet=\"1\"} 100\n",
+              s.str());
+
+    // The context index is matched up to the closing bracket.
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet", 10,
+                                  "assigned-addresses"),
+                                  static_cast<int64_t>(9));
+    s.str("");
+    EXPECT_EQ(2, StatsMgr::instance().exportPrometheus(s, "subnet[1"));
+    s.str("");
+    EXPECT_EQ(2, StatsMgr::instance().exportPrometheus(s, "subnet[1]"));
+    EXPECT_EQ("# TYPE kea_assigned_addresses untyped\n"
+              "kea_assigned_addresses{subnet=\"1\"} 5\n"
+              "# TYPE kea_total_addresses untyped\n"
+              "kea_total_addresses{subnet=\"1\"} 100\n",
+              s.str());
+    s.str("");
+    EXPECT_EQ(4, StatsMgr::instance().exportPrometheus(s, "subnet["));
+    s.str("");
+    EXPECT_EQ(1, StatsMgr::instance().exportPrometheus(s, "subnet[10"));
+
+    // No match.
+    s.str("");
+    EXPECT_EQ(0, StatsMgr::instance().exportPrometheus(s, "pkt6"));
+    EXPECT_TRUE(s.str().empty());
+}
+
+// Test checks whether histograms are exported as Prometheus histograms.
+TEST_F(StatsMgrTest, exportPrometheusHistogram) {
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(1));
+    const std::string name = StatsMgr::generateName("subnet", 1, "latency");
+    StatsMgr::instance().addHistogramSample(name,
+                                            time_duration(0, 0, 0, 1000),
+                                            microsec_clock::universal_time());
+    StatsMgr::instance().addHistogramSample(name,
+                                            time_duration(0, 0, 0, 3000),
+                                            microsec_clock::universal_time());
+
+    std::ostringstream s;
+    EXPECT_EQ(2, StatsMgr::instance().exportPrometheus(s));
+    const std::string text = s.str();
+
+    // The histogram has its type and each bucket is written with its
+    // inclusive upper bound in seconds and the cumulative count.
+    EXPECT_EQ(0, text.find("# TYPE kea_alpha untyped\nkea_alpha 1\n"
+                           "# TYPE kea_latency histogram\n"
+                           "kea_latency_bucket{subnet=\"1\",le=\"0\"} 0\n"
+                           "kea_latency_bucket{subnet=\"1\",le=\"1e-06\"} 0\n"));
+    EXPECT_NE(std::string::npos,
+              text.find("kea_latency_bucket{subnet=\"1\",le=\"0.000511\"} 0\n"
+                        "kea_latency_bucket{subnet=\"1\",le=\"0.001023\"} 1\n"
+                        "kea_latency_bucket{subnet=\"1\",le=\"0.002047\"} 1\n"
+                        "kea_latency_bucket{subnet=\"1\",le=\"0.004095\"} 2\n"));
+    EXPECT_NE(std::string::npos,
+              text.find("kea_latency_bucket{subnet=\"1\",le=\"+Inf\"} 2\n"
+                        "kea_latency_sum{subnet=\"1\"} 0.004\n"
+                        "kea_latency_count{subnet=\"1\"} 2\n"));
+    // Two lines for alpha, the type, 32 buckets, the sum and the count.
+    EXPECT_EQ(37, std::count(text.begin(), text.end(), '\n'));
+
+    // Histograms are selected by the prefix too.
+    s.str("");
+    EXPECT_EQ(1, StatsMgr::instance().exportPrometheus(s, "subnet[1]."));
+    EXPECT_EQ(0, s.str().find("# TYPE kea_latency histogram\n"));
+    s.str("");
+    EXPECT_EQ(0, StatsMgr::instance().exportPrometheus(s, "subnet[2]."));
+}
+
+// Test checks whether statistic-export command returns the statistics
+// in the Prometheus format and handles the prefix.
+TEST_F(StatsMgrTest, commandStatisticExport) {
+    StatsMgr::instance().setValue("alpha", static_cast<int64_t>(1234));
+    StatsMgr::instance().setValue("beta", static_cast<int64_t>(5));
+
+    // Without parameters all statistics are exported.
+    ConstElementPtr rsp = StatsMgr::instance().statisticExportHandler(
+        "statistic-export", ElementPtr());
+    int status_code;
+    ConstElementPtr rep = parseAnswer(status_code, rsp);
+    ASSERT_EQ(0, status_code);
+    ASSERT_TRUE(rep);
+    ASSERT_TRUE(rep->get("prometheus"));
+    EXPECT_EQ("# TYPE kea_alpha untyped\nkea_alpha 1234\n"
+              "# TYPE kea_beta untyped\nkea_beta 5\n",
+              rep->get("prometheus")->stringValue());
+
+    // With the prefix only matching ones are exported.
+    ElementPtr params = Element::createMap();
+    params->set("prefix", Element::create("be"));
+    rsp = StatsMgr::instance().statisticExportHandler("statistic-export",
+                                                      params);
+    rep = parseAnswer(status_code, rsp);
+    ASSERT_EQ(0, status_code);
+    ASSERT_TRUE(rep);
+    ASSERT_TRUE(rep->get("prometheus"));
+    EXPECT_EQ("# TYPE kea_beta untyped\nkea_beta 5\n",
+              rep->get("prometheus")->stringValue());
+
+    // The prefix must be a string.
+    params->set("prefix", Element::create(1));
+    rsp = StatsMgr::instance().statisticExportHandler("statistic-export",
+                                                      params);
+    rep = parseAnswer(status_code, rsp);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status_code);
+}
+
 // Test checks if statistic-reset handler is able to reset specified statistic.
 TEST_F(StatsMgrTest, commandStatisticReset) {
     StatsMgr::instance().setValue("alpha", static_cast<int64_t>(1234));
@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -447,6 +447,16 @@ public:
     /// constructing a new one. Note it must keep current content.
     void clear() { size_ = 0; }
 
+    /// \brief Reserve space in the buffer.
+    ///
+    /// This method makes sure the buffer can hold at least the specified
+    /// length of data, so writing a message which length is known in
+    /// advance doesn't reallocate the buffer. The data already written is
+    /// kept.
+    ///
+    /// \param len The total length of data the buffer should hold.
+    void reserve(size_t len) { ensureAllocated(len); }
+
     /// \brief Wipe buffer content.
     ///
     /// This method is the destructive alternative to clear().
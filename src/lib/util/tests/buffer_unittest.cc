@@ -1,4 +1,4 @@
-// Copyright (C) 2009-2018 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2009-2019 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -294,6 +294,25 @@ TEST_F(BufferTest, outputBufferZeroSize) {
     });
 }
 
+TEST_F(BufferTest, outputBufferReserve) {
+    obuffer.writeUint8(1);
+    obuffer.reserve(5000);
+    EXPECT_LE(5000, obuffer.getCapacity());
+    EXPECT_EQ(1, obuffer.getLength());
+    EXPECT_EQ(1, obuffer[0]);
+
+    // Writing the reserved length doesn't reallocate the buffer.
+    const void* data = obuffer.getData();
+    const size_t capacity = obuffer.getCapacity();
+    obuffer.skip(4999);
+    EXPECT_EQ(data, obuffer.getData());
+    EXPECT_EQ(capacity, obuffer.getCapacity());
+
+    // Reserving less than the capacity does nothing.
+    obuffer.reserve(10);
+    EXPECT_EQ(capacity, obuffer.getCapacity());
+}
+
 TEST_F(BufferTest, inputBufferReadVectorAll) {
     std::vector<uint8_t> vec;
 